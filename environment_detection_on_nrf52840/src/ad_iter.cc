@@ -0,0 +1,34 @@
+/*
+Follows bt_data_parse(), but without a callback per element and without a net_buf_simple.
+*/
+
+#include "ad_iter.h"
+
+void ad_iter_init(struct ad_iter *iter, const uint8_t *data, int len)
+{
+	iter->data = data;
+	iter->len = len;
+}
+
+bool ad_iter_next(struct ad_iter *iter, struct bt_data *element)
+{
+	if (iter->len <= 1) {
+		return false;
+	}
+
+	int len = iter->data[0];
+
+	//length 0 terminates the data early, longer than the remaining data is malformed
+	if (len == 0 || len > iter->len - 1) {
+		return false;
+	}
+
+	element->type = iter->data[1];
+	element->data_len = len - 1;
+	element->data = &iter->data[2];
+
+	iter->data += len + 1;
+	iter->len -= len + 1;
+
+	return true;
+}
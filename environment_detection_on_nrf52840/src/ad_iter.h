@@ -0,0 +1,24 @@
+/*
+Iterator over the AD structures (length, type, data) of advertising data.
+The elements point into the advertising data, nothing is copied.
+*/
+
+#ifndef AD_ITER_H_
+#define AD_ITER_H_
+
+#include <zephyr/types.h>
+#include <bluetooth/bluetooth.h>
+
+struct ad_iter {
+	const uint8_t *data; //next AD structure
+	int len; //remaining bytes
+};
+
+//start iterating over len bytes of advertising data
+void ad_iter_init(struct ad_iter *iter, const uint8_t *data, int len);
+
+//get next AD structure (as bt_data_parse() would pass it)
+//return false at the end of the data, on early termination or malformed data
+bool ad_iter_next(struct ad_iter *iter, struct bt_data *element);
+
+#endif
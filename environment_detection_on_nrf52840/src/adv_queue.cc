@@ -0,0 +1,69 @@
+/*
+head and tail are free running counters, the record index is the counter modulo ADV_QUEUE_SIZE.
+atomic_set() is a full memory barrier, so a record is completely written before the producer
+publishes it and completely processed before the consumer hands its slot back.
+*/
+
+#include "adv_queue.h"
+
+#include <string.h>
+
+static_assert((ADV_QUEUE_SIZE & (ADV_QUEUE_SIZE - 1)) == 0, "ADV_QUEUE_SIZE must be a power of two");
+
+bool adv_queue_push(struct adv_queue *queue, const bt_addr_le_t *addr, int8_t rssi,
+		    uint8_t adv_type, const uint8_t *data, uint16_t data_len, uint32_t timestamp,
+		    uint8_t epoch)
+{
+	uint32_t head = (uint32_t)atomic_get(&queue->head);
+	uint32_t tail = (uint32_t)atomic_get(&queue->tail);
+
+	if (head - tail >= ADV_QUEUE_SIZE) {
+		atomic_inc(&queue->dropped);
+		return false;
+	}
+
+	if (data_len > ADV_DATA_MAX_LEN) {
+		atomic_inc(&queue->truncated);
+		data_len = ADV_DATA_MAX_LEN;
+	}
+
+	struct adv_record *record = &queue->records[head & (ADV_QUEUE_SIZE - 1)];
+
+	bt_addr_le_copy(&record->addr, addr);
+	record->rssi = rssi;
+	record->adv_type = adv_type;
+	record->timestamp = timestamp;
+	record->epoch = epoch;
+	record->data_len = data_len;
+	memcpy(record->data, data, data_len);
+
+	atomic_set(&queue->head, (atomic_val_t)(head + 1));
+
+	return true;
+}
+
+const struct adv_record *adv_queue_peek(struct adv_queue *queue)
+{
+	uint32_t tail = (uint32_t)atomic_get(&queue->tail);
+
+	if (tail == (uint32_t)atomic_get(&queue->head)) {
+		return NULL;
+	}
+
+	return &queue->records[tail & (ADV_QUEUE_SIZE - 1)];
+}
+
+void adv_queue_release(struct adv_queue *queue)
+{
+	atomic_set(&queue->tail, atomic_get(&queue->tail) + 1);
+}
+
+uint32_t adv_queue_position(struct adv_queue *queue)
+{
+	return (uint32_t)atomic_get(&queue->head);
+}
+
+bool adv_queue_is_processed(struct adv_queue *queue, uint32_t position)
+{
+	return (int32_t)((uint32_t)atomic_get(&queue->tail) - position) >= 0;
+}
@@ -0,0 +1,56 @@
+/*
+Lock-free single-producer/single-consumer ring buffer for received advertisements.
+The Bluetooth scan callback (producer) only copies a compact record into the queue,
+the aggregation thread (consumer) parses the records and updates the scan data.
+*/
+
+#ifndef ADV_QUEUE_H_
+#define ADV_QUEUE_H_
+
+#include <zephyr/types.h>
+#include <sys/atomic.h>
+#include <bluetooth/addr.h>
+
+//queued advertisements, power of two
+#define ADV_QUEUE_SIZE 64
+
+//max length of (legacy) advertising or scan response data
+#define ADV_DATA_MAX_LEN 31
+
+struct adv_record {
+	bt_addr_le_t addr;
+	int8_t rssi;
+	uint8_t adv_type;
+	uint8_t data_len;
+	uint8_t epoch; //scan epoch the advertisement was received in
+	uint32_t timestamp; //CPU cycles
+	uint8_t data[ADV_DATA_MAX_LEN]; //AD structures
+};
+
+struct adv_queue {
+	atomic_t head; //written by producer only
+	atomic_t tail; //written by consumer only
+	atomic_t dropped; //advertisements dropped because the queue was full
+	atomic_t truncated; //advertisements with data longer than ADV_DATA_MAX_LEN
+	struct adv_record records[ADV_QUEUE_SIZE];
+};
+
+//producer: copy advertisement into the queue
+//return false if the queue is full and the advertisement was dropped
+bool adv_queue_push(struct adv_queue *queue, const bt_addr_le_t *addr, int8_t rssi,
+		    uint8_t adv_type, const uint8_t *data, uint16_t data_len, uint32_t timestamp,
+		    uint8_t epoch);
+
+//consumer: get oldest record without removing it, NULL if queue is empty
+const struct adv_record *adv_queue_peek(struct adv_queue *queue);
+
+//consumer: remove oldest record after it was processed
+void adv_queue_release(struct adv_queue *queue);
+
+//amount of records pushed so far
+uint32_t adv_queue_position(struct adv_queue *queue);
+
+//true if all records pushed before position were released
+bool adv_queue_is_processed(struct adv_queue *queue, uint32_t position);
+
+#endif
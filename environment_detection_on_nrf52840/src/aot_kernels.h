@@ -0,0 +1,234 @@
+/*
+Int8 kernels for the ahead-of-time compiled model (model_aot.cc, generated by tools/aot_model).
+The arithmetic follows the TFLM reference kernels (fully connected, softmax with the gemmlowp
+fixed point exp), tools/model_outputs checks that the outputs are bit-exact to the interpreter.
+Layer shapes are template parameters, the loops have constant bounds.
+*/
+
+#ifndef AOT_KERNELS_H_
+#define AOT_KERNELS_H_
+
+#include <stdint.h>
+
+//quantization of a fully connected layer (per tensor)
+struct aot_fully_connected_params {
+	int32_t input_offset; //-zero point of the input
+	int32_t output_offset; //zero point of the output
+	int32_t output_multiplier; //input scale * weights scale / output scale as Q0.31 and shift
+	int output_shift;
+	int32_t output_min; //clamp of the output (fused activation)
+	int32_t output_max;
+};
+
+//quantization of a softmax layer (int8 output with scale 1/256 and zero point -128)
+struct aot_softmax_params {
+	int32_t input_multiplier; //beta * input scale as fixed point Q5.26 multiplier and left shift
+	int input_left_shift;
+	int32_t diff_min; //smaller differences to the max input give output 0
+};
+
+//fixed point helpers as in gemmlowp
+static inline int32_t aot_rounding_doubling_high_mul(int32_t a, int32_t b)
+{
+	if (a == INT32_MIN && b == INT32_MIN) {
+		return INT32_MAX;
+	}
+
+	int64_t ab = (int64_t)a * b;
+	int32_t nudge = ab >= 0 ? (1 << 30) : (1 - (1 << 30));
+
+	return (int32_t)((ab + nudge) / (1ll << 31));
+}
+
+static inline int32_t aot_rounding_divide_by_pot(int32_t x, int exponent)
+{
+	int32_t mask = (int32_t)((1ll << exponent) - 1);
+	int32_t remainder = x & mask;
+	int32_t threshold = (mask >> 1) + (x < 0 ? 1 : 0);
+
+	return (x >> exponent) + (remainder > threshold ? 1 : 0);
+}
+
+static inline int32_t aot_saturating_shift_left(int32_t x, int exponent)
+{
+	int32_t threshold = (int32_t)((1ll << (31 - exponent)) - 1);
+
+	if (x > threshold) {
+		return INT32_MAX;
+	}
+	if (x < -threshold) {
+		return INT32_MIN;
+	}
+
+	return (int32_t)((uint32_t)x << exponent);
+}
+
+static inline int32_t aot_multiply_by_quantized_multiplier(int32_t x, int32_t multiplier, int shift)
+{
+	int left_shift = shift > 0 ? shift : 0;
+	int right_shift = shift > 0 ? 0 : -shift;
+
+	return aot_rounding_divide_by_pot(
+		aot_rounding_doubling_high_mul(x * (1 << left_shift), multiplier), right_shift);
+}
+
+/*
+exp(x) for x in [-1/4, 0), x and result Q0.31
+*/
+static inline int32_t aot_exp_on_interval_between_negative_one_quarter_and_0(int32_t a)
+{
+	const int32_t constant_term = 1895147668; //exp(-1/8)
+	const int32_t constant_1_over_3 = 715827883;
+
+	int32_t x = a + (1 << 28); //a + 1/8
+	int32_t x2 = aot_rounding_doubling_high_mul(x, x);
+	int32_t x3 = aot_rounding_doubling_high_mul(x2, x);
+	int32_t x4 = aot_rounding_doubling_high_mul(x2, x2);
+	int32_t x4_over_4 = aot_rounding_divide_by_pot(x4, 2);
+	int32_t polynomial = aot_rounding_divide_by_pot(
+		aot_rounding_doubling_high_mul(x4_over_4 + x3, constant_1_over_3) + x2, 1);
+
+	return constant_term + aot_rounding_doubling_high_mul(constant_term, x + polynomial);
+}
+
+/*
+exp(x) for x <= 0, x Q5.26 and result Q0.31
+*/
+static inline int32_t aot_exp_on_negative_values(int32_t a)
+{
+	const int fractional_bits = 26;
+	const int32_t one_quarter = 1 << (fractional_bits - 2);
+	//exp(-2^exponent) as Q0.31 for exponent -2 to 4
+	static const int32_t multipliers[] = { 1672461947, 1302514674, 790015084, 290630308,
+					       39332535,   720401,	   242 };
+
+	int32_t a_mod_quarter_minus_one_quarter = (a & (one_quarter - 1)) - one_quarter;
+	int32_t result = aot_exp_on_interval_between_negative_one_quarter_and_0(
+		aot_saturating_shift_left(a_mod_quarter_minus_one_quarter, 5));
+	int32_t remainder = a_mod_quarter_minus_one_quarter - a;
+
+	for (int exponent = -2; exponent <= 4; exponent++) {
+		if (remainder & (1 << (fractional_bits + exponent))) {
+			result = aot_rounding_doubling_high_mul(result, multipliers[exponent + 2]);
+		}
+	}
+
+	return a == 0 ? INT32_MAX : result;
+}
+
+/*
+1 / (1 + x) for x in [0, 1), x Q0.31 and result Q0.31 (Newton-Raphson)
+*/
+static inline int32_t aot_one_over_one_plus_x_for_x_in_0_1(int32_t a)
+{
+	int64_t sum = (int64_t)a + INT32_MAX;
+	int32_t half_denominator = (int32_t)((sum + (sum >= 0 ? 1 : -1)) / 2);
+	const int32_t constant_48_over_17 = 1515870810; //Q2.29
+	const int32_t constant_neg_32_over_17 = -1010580540;
+	const int32_t one = 1 << 29;
+
+	int32_t x = constant_48_over_17 +
+		    aot_rounding_doubling_high_mul(half_denominator, constant_neg_32_over_17);
+
+	for (int i = 0; i < 3; i++) {
+		int32_t half_denominator_times_x = aot_rounding_doubling_high_mul(half_denominator, x);
+		int32_t one_minus_half_denominator_times_x = one - half_denominator_times_x;
+
+		x = x + aot_saturating_shift_left(
+				aot_rounding_doubling_high_mul(x, one_minus_half_denominator_times_x), 2);
+	}
+
+	return aot_saturating_shift_left(x, 1);
+}
+
+static inline int aot_count_leading_zeros(uint32_t x)
+{
+	int count = 0;
+
+	while (count < 32 && !(x & (1u << (31 - count)))) {
+		count++;
+	}
+
+	return count;
+}
+
+/*
+output = activation((input - input zero point) * weights + bias), weights [OUT][IN]
+*/
+template <int IN, int OUT>
+static inline void aot_fully_connected(const int8_t *input, const int8_t (&weights)[OUT * IN],
+				       const int32_t (&bias)[OUT],
+				       const struct aot_fully_connected_params &params,
+				       int8_t *output)
+{
+	for (int o = 0; o < OUT; o++) {
+		const int8_t *row = &weights[o * IN];
+		int32_t acc = 0;
+
+		for (int i = 0; i < IN; i++) {
+			acc += row[i] * (input[i] + params.input_offset);
+		}
+		acc += bias[o];
+		acc = aot_multiply_by_quantized_multiplier(acc, params.output_multiplier,
+							  params.output_shift);
+		acc += params.output_offset;
+		acc = acc < params.output_min ? params.output_min : acc;
+		acc = acc > params.output_max ? params.output_max : acc;
+		output[o] = (int8_t)acc;
+	}
+}
+
+/*
+int8 softmax of N values
+*/
+template <int N>
+static inline void aot_softmax(const int8_t *input, const struct aot_softmax_params &params,
+			       int8_t *output)
+{
+	const int accumulation_integer_bits = 12;
+	int32_t max_in_row = input[0];
+	int32_t exps[N];
+
+	for (int i = 1; i < N; i++) {
+		max_in_row = input[i] > max_in_row ? input[i] : max_in_row;
+	}
+
+	//sum of exp(beta * (input - max)) as Q12.19
+	int32_t sum_of_exps = 0;
+
+	for (int i = 0; i < N; i++) {
+		int32_t diff = input[i] - max_in_row;
+
+		exps[i] = 0;
+		if (diff >= params.diff_min) {
+			int32_t diff_rescaled = aot_rounding_doubling_high_mul(
+				diff * (1 << params.input_left_shift), params.input_multiplier);
+
+			exps[i] = aot_exp_on_negative_values(diff_rescaled);
+			sum_of_exps += aot_rounding_divide_by_pot(exps[i], accumulation_integer_bits);
+		}
+	}
+
+	//reciprocal of the sum
+	int headroom_plus_one = aot_count_leading_zeros((uint32_t)sum_of_exps);
+	int num_bits_over_unit = accumulation_integer_bits - headroom_plus_one;
+	int32_t shifted_sum_minus_one =
+		(int32_t)(((uint32_t)sum_of_exps << headroom_plus_one) - (1u << 31));
+	int32_t shifted_scale = aot_one_over_one_plus_x_for_x_in_0_1(shifted_sum_minus_one);
+
+	for (int i = 0; i < N; i++) {
+		int32_t diff = input[i] - max_in_row;
+		int32_t value = INT8_MIN;
+
+		if (diff >= params.diff_min) {
+			value = aot_rounding_divide_by_pot(
+					aot_rounding_doubling_high_mul(shifted_scale, exps[i]),
+					num_bits_over_unit + 31 - 8) +
+				INT8_MIN;
+			value = value > INT8_MAX ? INT8_MAX : value;
+		}
+		output[i] = (int8_t)value;
+	}
+}
+
+#endif
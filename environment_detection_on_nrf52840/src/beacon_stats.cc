@@ -0,0 +1,127 @@
+/*
+The feature values are identical to the ones computed from the full list of beacons of every
+device (which was stored up to MAX_BEACONS_RECEIVED beacons per device before).
+*/
+
+#include "beacon_stats.h"
+
+static_assert(MAX_BEACONS_RECEIVED <= UINT8_MAX, "beacon count must fit into uint8_t");
+static_assert(MAX_BEACONS_RECEIVED * 128 <= INT16_MAX + 1, "RSSI sum must fit into int16_t");
+
+void beacon_stats_init(struct beacon_stats *stats)
+{
+	stats->first = 0;
+	stats->last = 0;
+	stats->rssi_sum = 0;
+	stats->count = 0;
+	//initial min/max as used for a device without beacons
+	stats->min_rssi = 0;
+	stats->max_rssi = -100;
+}
+
+void beacon_stats_add(struct beacon_stats *stats, int8_t rssi, uint32_t timestamp)
+{
+	//a RSSI of 0 marked an empty beacon slot, such beacons were never counted
+	if (rssi == 0 || stats->count >= MAX_BEACONS_RECEIVED) {
+		return;
+	}
+
+	if (stats->count == 0) {
+		stats->first = timestamp;
+	}
+	stats->last = timestamp;
+
+	if (rssi < stats->min_rssi) {
+		stats->min_rssi = rssi;
+	}
+	if (rssi > stats->max_rssi) {
+		stats->max_rssi = rssi;
+	}
+
+	stats->rssi_sum += rssi;
+	stats->count++;
+}
+
+void beacon_stats_features(const struct beacon_stats *stats, int device_count,
+			   int features[BEACON_FEATURES_COUNT])
+{
+	int avg_received = 0;
+	int min_received = MAX_BEACONS_RECEIVED;
+	int max_received = 0;
+
+	int avg_avg_rssi = 0;
+	int min_rssi = 0;
+	int max_rssi = -100;
+	int avg_rssi_difference = 0;
+
+	int min_avg_rssi = 0;
+	int max_avg_rssi = -100;
+
+	//time difference (in CPU cycles) between beacons
+	int avg_avg_difference_between_beacons = 0;
+	int avg_difference_first_last = 0;
+
+	for (int i = 0; i < device_count; i++) {
+		int j = stats[i].count;
+
+		//devices with a full beacon list were not counted for avg_received
+		if (j < MAX_BEACONS_RECEIVED) {
+			avg_received += j;
+		}
+
+		if (j < min_received && j != 0) {
+			min_received = j;
+		}
+		if (j > max_received) {
+			max_received = j;
+		}
+		avg_rssi_difference += (stats[i].max_rssi - stats[i].min_rssi);
+
+		if (j != 0) {
+			int current_avg = stats[i].rssi_sum / j;
+			avg_avg_rssi += current_avg;
+
+			if (current_avg > max_avg_rssi) {
+				max_avg_rssi = current_avg;
+			}
+
+			if (current_avg < min_avg_rssi) {
+				min_avg_rssi = current_avg;
+			}
+		}
+		if (j > 1) {
+			//the differences between consecutive beacons add up to last - first
+			int first_last = (int)(stats[i].last - stats[i].first);
+
+			avg_avg_difference_between_beacons += (first_last / (j - 1));
+			avg_difference_first_last += first_last;
+		}
+
+		if (stats[i].min_rssi < min_rssi) {
+			min_rssi = stats[i].min_rssi;
+		}
+		if (stats[i].max_rssi > max_rssi) {
+			max_rssi = stats[i].max_rssi;
+		}
+	}
+	if (device_count != 0) {
+		avg_received = avg_received / device_count;
+		avg_avg_rssi = avg_avg_rssi / device_count;
+		avg_rssi_difference = avg_rssi_difference / device_count;
+		avg_avg_difference_between_beacons =
+			avg_avg_difference_between_beacons / device_count;
+		avg_difference_first_last = avg_difference_first_last / device_count;
+	}
+
+	features[0] = avg_received;
+	features[1] = min_received;
+	features[2] = max_received;
+	features[3] = avg_avg_rssi;
+	features[4] = min_avg_rssi;
+	features[5] = max_avg_rssi;
+	features[6] = min_rssi;
+	features[7] = max_rssi;
+	features[8] = avg_rssi_difference;
+	features[9] = avg_avg_difference_between_beacons;
+	features[10] = avg_difference_first_last;
+}
@@ -0,0 +1,37 @@
+/*
+Per device accumulator for received beacons (RSSI, timestamp).
+The accumulator is updated with every received beacon, the RSSI and timing features of a scan
+are computed from the accumulators of all devices without keeping the individual beacons.
+*/
+
+#ifndef BEACON_STATS_H_
+#define BEACON_STATS_H_
+
+#include <zephyr/types.h>
+
+//max amount of beacons from one device that are taken into account
+#define MAX_BEACONS_RECEIVED 140
+
+//amount of RSSI and timing feature values (avg_received ... avg_difference_first_last)
+#define BEACON_FEATURES_COUNT 11
+
+struct beacon_stats {
+	uint32_t first; //timestamp (CPU cycles) of first beacon
+	uint32_t last; //timestamp (CPU cycles) of last beacon
+	int16_t rssi_sum;
+	uint8_t count;
+	int8_t min_rssi;
+	int8_t max_rssi;
+};
+
+//reset accumulator of a device
+void beacon_stats_init(struct beacon_stats *stats);
+
+//add newly received beacon data (RSSI, timestamp)
+void beacon_stats_add(struct beacon_stats *stats, int8_t rssi, uint32_t timestamp);
+
+//compute the RSSI and timing feature values of a scan from the accumulators of device_count devices
+void beacon_stats_features(const struct beacon_stats *stats, int device_count,
+			   int features[BEACON_FEATURES_COUNT]);
+
+#endif
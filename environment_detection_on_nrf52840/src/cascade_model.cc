@@ -0,0 +1,37 @@
+//generated by neural_network.ipynb from 2212 data samples of ./unseen_data/{14.09,15.09,15.09 (2)} (depth 6, min samples 50, purity 0.98), do not edit
+#include "cascade_model.h"
+
+int cascade_classify(const int *row, float *probability)
+{
+	if (row[5] <= 149) {
+		if (row[0] <= 2) {
+			if (row[18] <= -66) {
+				return -1; //91 data samples, 68 of them nature
+			}
+			*probability = 1.000f;
+			return 10; //nature: 129 of 129 data samples
+		}
+		if (row[0] <= 11) {
+			if (row[17] <= -49) {
+				return -1; //171 data samples, 118 of them park
+			}
+			if (row[9] <= 36) {
+				if (row[5] <= 14) {
+					return -1; //50 data samples, 48 of them car
+				}
+				*probability = 1.000f;
+				return 8; //car: 133 of 133 data samples
+			}
+			return -1; //51 data samples, 42 of them car
+		}
+		return -1; //1376 data samples, 340 of them bus
+	}
+	if (row[22] <= 68974) {
+		return -1; //50 data samples, 34 of them restaurant
+	}
+	if (row[5] <= 174) {
+		return -1; //50 data samples, 48 of them restaurant
+	}
+	*probability = 1.000f;
+	return 11; //restaurant: 111 of 111 data samples
+}
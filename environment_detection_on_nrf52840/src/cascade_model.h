@@ -0,0 +1,15 @@
+/*
+First stage of the cascade classifier (CASCADE build option): a shallow decision tree on the feature
+values of the latest scan, trained and exported by neural_network.ipynb (cascade_model.cc). It answers only
+where it is confident, all other data samples are classified by the neural network.
+*/
+
+#ifndef CASCADE_MODEL_H_
+#define CASCADE_MODEL_H_
+
+//predict the environment from the feature values of the latest scan (DATA_LINE_LENGTH values)
+//return index of the environment and write its probability to probability, -1 if the tree is not
+//confident (probability is not written)
+int cascade_classify(const int *row, float *probability);
+
+#endif
@@ -6,16 +6,25 @@ Contains the environments to classify between, mean and std values for normaliza
 #ifndef TENSORFLOW_LITE_MICRO_EXAMPLES_HELLO_WORLD_CONSTANTS_H_
 #define TENSORFLOW_LITE_MICRO_EXAMPLES_HELLO_WORLD_CONSTANTS_H_
 
+#include "model_input.h"
+
 //environments that can be detected by the neural network
 extern const char available_env[][50];
 extern const int available_env_len;
 
-//mean and std values for all 46 features to normalize input data
-extern const float mean_list[46];
-extern const float std_list[46];
+//mean and std values for all features of the model input to normalize input data
+extern const float mean_list[MODEL_INPUT_FEATURES];
+extern const float std_list[MODEL_INPUT_FEATURES];
 
 //pre trained neural network
 extern const unsigned char g_modelurd[];
 extern const int g_model_len;
 
+//raw input mode (RAW_INPUT): pre trained neural network with int8 input and output and the per feature
+//quantization of the raw feature values (normalization included), generated by tools/fold_normalization
+extern const float raw_input_scale[MODEL_INPUT_FEATURES];
+extern const float raw_input_zero_point[MODEL_INPUT_FEATURES];
+extern const unsigned char g_model_raw[];
+extern const int g_model_raw_len;
+
 #endif 
@@ -0,0 +1,113 @@
+/*
+Open addressing hash table (linear probing) mapping BLE addresses to device indices.
+*/
+
+#include "device_table.h"
+
+#include <string.h>
+
+static_assert((DEVICE_TABLE_SLOTS & (DEVICE_TABLE_SLOTS - 1)) == 0,
+	      "DEVICE_TABLE_SLOTS must be a power of two");
+static_assert(2 * DEVICE_TABLE_SLOTS >= 3 * MAX_DEVICES, "DEVICE_TABLE_SLOTS too small");
+static_assert(MAX_DEVICES > 0 && MAX_DEVICES <= INT16_MAX, "device index must fit into int16_t");
+
+/*
+hash the 6 address bytes and the address type (FNV-1a)
+*/
+static uint32_t hash_addr(const bt_addr_le_t *addr)
+{
+	uint32_t h = 2166136261u;
+
+	for (int i = 0; i < (int)sizeof(addr->a.val); i++) {
+		h = (h ^ addr->a.val[i]) * 16777619u;
+	}
+	h = (h ^ addr->type) * 16777619u;
+
+	return h;
+}
+
+/*
+find the slot holding addr or the empty slot where addr would be inserted
+*/
+static int find_slot(const struct device_table *table, const bt_addr_le_t *addr)
+{
+	int slot = hash_addr(addr) & (DEVICE_TABLE_SLOTS - 1);
+
+	while (table->slots[slot].generation == table->generation &&
+	       bt_addr_le_cmp(&table->addr[table->slots[slot].index], addr) != 0) {
+		slot = (slot + 1) & (DEVICE_TABLE_SLOTS - 1);
+	}
+
+	return slot;
+}
+
+void device_table_clear(struct device_table *table)
+{
+	table->generation++;
+
+	//slots are only cleared when the generation wraps around (generation 0 is never used)
+	if (table->generation == 0) {
+		memset(table->slots, 0, sizeof(table->slots));
+		table->generation = 1;
+	}
+	table->count = 0;
+}
+
+int device_table_find(const struct device_table *table, const bt_addr_le_t *addr)
+{
+	const struct device_slot *slot = &table->slots[find_slot(table, addr)];
+
+	if (slot->generation != table->generation) {
+		return -1;
+	}
+
+	return slot->index;
+}
+
+int device_table_add(struct device_table *table, const bt_addr_le_t *addr)
+{
+	struct device_slot *slot = &table->slots[find_slot(table, addr)];
+
+	if (slot->generation == table->generation) {
+		return slot->index;
+	}
+
+	if (table->count >= MAX_DEVICES) {
+		return -1;
+	}
+
+	//new device
+	int index = table->count++;
+	bt_addr_le_copy(&table->addr[index], addr);
+	slot->generation = table->generation;
+	slot->index = index;
+
+	return index;
+}
+
+void device_table_replace(struct device_table *table, int index, const bt_addr_le_t *addr)
+{
+	int hole = find_slot(table, &table->addr[index]);
+
+	//remove the old address: move following slots of the probe sequence back into the hole
+	//unless they would be moved before their home slot
+	for (int slot = (hole + 1) & (DEVICE_TABLE_SLOTS - 1);
+	     table->slots[slot].generation == table->generation;
+	     slot = (slot + 1) & (DEVICE_TABLE_SLOTS - 1)) {
+		int home = hash_addr(&table->addr[table->slots[slot].index]) & (DEVICE_TABLE_SLOTS - 1);
+
+		if (((slot - home) & (DEVICE_TABLE_SLOTS - 1)) >=
+		    ((slot - hole) & (DEVICE_TABLE_SLOTS - 1))) {
+			table->slots[hole] = table->slots[slot];
+			hole = slot;
+		}
+	}
+	table->slots[hole].generation = 0;
+
+	//insert the new address
+	struct device_slot *slot = &table->slots[find_slot(table, addr)];
+
+	bt_addr_le_copy(&table->addr[index], addr);
+	slot->generation = table->generation;
+	slot->index = index;
+}
@@ -0,0 +1,59 @@
+/*
+Table of unique devices (BLE addresses) seen during a scan.
+Devices are kept in a dense array in the order they were first seen, an open addressing
+hash index keyed on the binary address maps an address to its position in that array.
+Hash slots are tagged with the generation of the table, so clearing the table only starts a new
+generation and slots of older generations count as empty.
+The capacity is fixed at build time, when the table is full a device can be replaced by a new one.
+*/
+
+#ifndef DEVICE_TABLE_H_
+#define DEVICE_TABLE_H_
+
+#include <zephyr/types.h>
+#include <bluetooth/addr.h>
+
+//max unique devices tracked per scan epoch, can be set at build time (see CMakeLists.txt)
+//RAM per device and epoch: 7 bytes address, 16 bytes beacon stats, 4 bytes services and
+//4 bytes per hash slot (1.5 to 3 slots per device), so 33 to 39 bytes, 99 to 117 bytes
+//for all SCAN_EPOCH_BUFFERS (3, 7 with SCAN_EPOCH_OVERLAP 3) epochs
+#ifndef MAX_DEVICES
+#define MAX_DEVICES 150
+#endif
+
+//smallest power of two of at least 1.5 times n
+constexpr int device_table_slots(int n, int slots = 1)
+{
+	return 2 * slots >= 3 * n ? slots : device_table_slots(n, 2 * slots);
+}
+
+//hash slots, power of two and at least 1.5 times MAX_DEVICES to keep probe sequences short
+#define DEVICE_TABLE_SLOTS device_table_slots(MAX_DEVICES)
+
+struct device_slot {
+	uint16_t generation; //slot is empty if it differs from the generation of the table
+	int16_t index; //index into addr
+};
+
+struct device_table {
+	int count;
+	uint16_t generation;
+	bt_addr_le_t addr[MAX_DEVICES]; //device ids
+	struct device_slot slots[DEVICE_TABLE_SLOTS];
+};
+
+//remove all devices, must be called before the table is used
+void device_table_clear(struct device_table *table);
+
+//get index of device addr
+//return -1 if addr not found
+int device_table_find(const struct device_table *table, const bt_addr_le_t *addr);
+
+//get index of device addr, add it as new unique device if not found
+//return -1 if addr not found and table is full
+int device_table_add(struct device_table *table, const bt_addr_le_t *addr);
+
+//replace the device at index by addr, which must not be in the table
+void device_table_replace(struct device_table *table, int index, const bt_addr_le_t *addr);
+
+#endif
@@ -0,0 +1,78 @@
+/*
+All statistics are maintained on insert, so reading them is O(1).
+*/
+
+#include "histogram.h"
+
+#include <string.h>
+
+void histogram_clear(struct histogram *hist)
+{
+	hist->generation++;
+
+	//bins are only cleared when the generation wraps around (generation 0 is never used)
+	if (hist->generation == 0) {
+		memset(hist->bins, 0, sizeof(hist->bins));
+		hist->generation = 1;
+	}
+	hist->count = 0;
+	hist->sum = 0;
+	hist->distinct_sum = 0;
+	hist->min = 0;
+	hist->max = 0;
+}
+
+void histogram_add(struct histogram *hist, int value)
+{
+	struct histogram_bin *bin = &hist->bins[(uint8_t)value];
+
+	if (bin->generation != hist->generation) {
+		//first value of this bin
+		bin->generation = hist->generation;
+		bin->count = 0;
+		hist->distinct_sum += value;
+	}
+	if (bin->count != UINT16_MAX) {
+		bin->count++;
+	}
+
+	if (hist->count == 0 || value < hist->min) {
+		hist->min = value;
+	}
+	if (hist->count == 0 || value > hist->max) {
+		hist->max = value;
+	}
+
+	hist->count++;
+	hist->sum += value;
+}
+
+int histogram_quantile(const struct histogram *hist, int percent)
+{
+	if (hist->count == 0) {
+		return 0;
+	}
+
+	//rank of the value, at least the first one
+	int rank = (percent * hist->count + 99) / 100;
+	int count = 0;
+
+	if (rank < 1) {
+		rank = 1;
+	}
+
+	//values are visited in ascending order from min to max, so signed and unsigned values work
+	for (int value = hist->min; value < hist->max; value++) {
+		const struct histogram_bin *bin = &hist->bins[(uint8_t)value];
+
+		if (bin->generation == hist->generation) {
+			count += bin->count;
+
+			if (count >= rank) {
+				return value;
+			}
+		}
+	}
+
+	return hist->max;
+}
@@ -0,0 +1,38 @@
+/*
+Count histogram over all byte values (one bin per value) with running statistics.
+Used for values taken from beacon data like TxPower (signed or unsigned byte) and manufacturer data length (unsigned).
+Bins are tagged with the generation of the histogram, so clearing it does not touch the bins.
+*/
+
+#ifndef HISTOGRAM_H_
+#define HISTOGRAM_H_
+
+#include <zephyr/types.h>
+
+#define HISTOGRAM_BINS 256
+
+struct histogram_bin {
+	uint16_t generation; //bin is empty if it differs from the generation of the histogram
+	uint16_t count; //saturating
+};
+
+struct histogram {
+	uint16_t generation;
+	struct histogram_bin bins[HISTOGRAM_BINS]; //indexed by the byte of the value
+	int count; //amount of values
+	int sum; //sum of all values
+	int distinct_sum; //sum of all different values
+	int min;
+	int max;
+};
+
+//remove all values, must be called before the histogram is used
+void histogram_clear(struct histogram *hist);
+
+//add value, must be in range of int8_t or uint8_t
+void histogram_add(struct histogram *hist, int value);
+
+//value below or at which percent of all values are (nearest rank), 0 if there are no values
+int histogram_quantile(const struct histogram *hist, int percent);
+
+#endif
@@ -0,0 +1,95 @@
+/*
+Registers are merged by taking the maximum, the estimate uses the linear counting correction
+for small cardinalities (as in the original HyperLogLog paper).
+*/
+
+#include "hll.h"
+
+#include <math.h>
+#include <string.h>
+
+/*
+hash address type and address to 32 bits (splitmix64 finalizer)
+*/
+static uint32_t hash_addr(const bt_addr_le_t *addr)
+{
+	uint64_t h = addr->type;
+
+	for (int i = 0; i < (int)sizeof(addr->a.val); i++) {
+		h = (h << 8) | addr->a.val[i];
+	}
+
+	h ^= h >> 30;
+	h *= 0xbf58476d1ce4e5b9ull;
+	h ^= h >> 27;
+	h *= 0x94d049bb133111ebull;
+	h ^= h >> 31;
+
+	return (uint32_t)(h >> 32);
+}
+
+/*
+estimate cardinality from the registers of one or two (merged) sketches
+*/
+static int estimate(const uint8_t *a, const uint8_t *b)
+{
+	float sum = 0;
+	int zeros = 0;
+
+	for (int i = 0; i < HLL_REGISTERS; i++) {
+		uint8_t rank = a[i];
+
+		if (b != NULL && b[i] > rank) {
+			rank = b[i];
+		}
+		if (rank == 0) {
+			zeros++;
+		}
+		sum += ldexpf(1.0f, -rank);
+	}
+
+	float m = HLL_REGISTERS;
+	float alpha = 0.7213f / (1.0f + 1.079f / m);
+	float e = alpha * m * m / sum;
+
+	if (e <= 2.5f * m && zeros != 0) {
+		//linear counting
+		e = m * logf(m / zeros);
+	}
+
+	return (int)(e + 0.5f);
+}
+
+void hll_clear(struct hll *hll)
+{
+	memset(hll->registers, 0, sizeof(hll->registers));
+}
+
+void hll_add(struct hll *hll, const bt_addr_le_t *addr)
+{
+	uint32_t h = hash_addr(addr);
+	uint32_t rest = h << HLL_BITS;
+	uint8_t rank = 1;
+
+	//position of the first set bit of the bits not used for the register index
+	while (rank <= 32 - HLL_BITS && !(rest & 0x80000000u)) {
+		rest <<= 1;
+		rank++;
+	}
+
+	uint8_t *reg = &hll->registers[h >> (32 - HLL_BITS)];
+
+	if (rank > *reg) {
+		*reg = rank;
+	}
+}
+
+int hll_estimate(const struct hll *hll)
+{
+	return estimate(hll->registers, NULL);
+}
+
+int hll_union_estimate(const struct hll *a, const struct hll *b)
+{
+	return estimate(a->registers, b->registers);
+}
@@ -0,0 +1,33 @@
+/*
+HyperLogLog sketch estimating the amount of distinct devices (BLE addresses) seen in a scan epoch.
+Its size is constant whatever the amount of devices, the estimate is used when there are more
+devices than the device table can hold (standard error about 6.5%).
+*/
+
+#ifndef HLL_H_
+#define HLL_H_
+
+#include <zephyr/types.h>
+#include <bluetooth/addr.h>
+
+//address hash bits selecting the register, 2^HLL_BITS registers of one byte
+#define HLL_BITS 8
+#define HLL_REGISTERS (1 << HLL_BITS)
+
+struct hll {
+	uint8_t registers[HLL_REGISTERS]; //max rank (position of the first set bit) per register
+};
+
+//remove all devices
+void hll_clear(struct hll *hll);
+
+//add device addr, adding the same device again does not change the sketch
+void hll_add(struct hll *hll, const bt_addr_le_t *addr);
+
+//estimated amount of distinct devices added
+int hll_estimate(const struct hll *hll);
+
+//estimated amount of distinct devices added to a or b (union of both)
+int hll_union_estimate(const struct hll *a, const struct hll *b);
+
+#endif
@@ -11,6 +11,9 @@ All user interaction (to select environment and daytime) is happening via a disp
 
 #include "main_functions.h"
 #include "constants.h"
+#include "scan_epoch.h"
+#include "adv_queue.h"
+#include "scan_schedule.h"
 
 #include <zephyr.h>
 #include <device.h>
@@ -45,7 +48,7 @@ All user interaction (to select environment and daytime) is happening via a disp
 #define SECOND 1000
 
 //scan
-#define SCAN_COUNT 5
+#define SCAN_COUNT DATA_ROWS
 #define SCAN_TIME 3
 
 const struct bt_le_scan_param scan_param = {
@@ -56,8 +59,7 @@ const struct bt_le_scan_param scan_param = {
 };
 
 //data sample
-#define DATA_LINE_LENGTH 46
-#define DATA_LENGTH 230
+#define DATA_LENGTH (DATA_RECORD_LENGTH * SCAN_COUNT)
 
 const char environments[][50] = {
 	"apartment",   "house",		 "street", "car",  "train",  "bus",    "plane",
@@ -69,24 +71,20 @@ const char environments[][50] = {
 const char daytimes[][50] = { "mo", "no", "ev" };
 #define DAYTIME_COUNT 3
 
-const char most_common_services[][10] = {
-	"0af0", "1802", "180f", "1812", "1826", "2222", "ec88", "fd5a",
-	"fd6f", "fdd2", "fddf", "fe03", "fe07", "fe0f", "fe61", "fe9f",
-	"fea0", "feb9", "febe", "fee0", "ff0d", "ffc0", "ffe0",
-};
-#define MOST_COMMON_SERVICES_COUNT 23
-
 const char feature_names[] =
 	"label, device_count, lost_devices, new_devices, different_services, services_count, txpower_count, tx_power_avg, min_txpower, max_txpower, man_packet_len_count, manufacturer_data_lengths_sum, manufacturer_data_len_avg, avg_received, min_received, max_received, avg_avg_rssi, min_avg_rssi, max_avg_rssi, min_rssi, max_rssi, avg_rssi_difference, avg_avg_difference_between_beacons, avg_difference_first_last";
 
+//names of the optional RSSI quantile values (after the services), model input if the model was
+//trained with them (model_input.h)
+const char rssi_quantile_names[] =
+	", rssi_p10, rssi_median, rssi_p90, avg_rssi_p10, avg_rssi_median, avg_rssi_p90";
+
 //how many samples are created/predicted until program terminates
 #define N_SAMPLES 50
 
-//Limitations that max out SRAM
-#define MAX_DEVICES 150 //max unique devices
-#define MAX_BEACONS_RECEIVED 140 //max amount of beacons from one device
-#define MAX_DIFFERENT_TX_POWERS 30 //max unique txpowers received
-#define MAX_DIFFERENT_MAN_PACKET_LEN 30 //max unique manufacturer packet lengths
+//thread that aggregates received advertisements
+#define AGGREGATION_STACK_SIZE 2048
+#define AGGREGATION_PRIORITY 5 //higher than main thread (CONFIG_MAIN_THREAD_PRIORITY)
 
 //buttons
 #define SWA_NODE DT_ALIAS(swa)
@@ -136,33 +134,23 @@ bool sd_card_initialized = false;
 data extracted from received BLE beacons
 */
 
-//unique devices we receive at least one beacon
-static int device_count = 0;
-static int beacons_received[MAX_DEVICES][MAX_BEACONS_RECEIVED][2]; //each beacon grouped by device
-static char devices[MAX_DEVICES][BT_ADDR_LE_STR_LEN]; //device ids
-
-//TxPower and manufacturer data length
-static int txPower[MAX_DIFFERENT_TX_POWERS][2];
-static int manufacturer_data_len[MAX_DIFFERENT_MAN_PACKET_LEN][2];
+//received advertisements waiting for aggregation
+static struct adv_queue adv_queue;
+K_SEM_DEFINE(adv_queue_sem, 0, 1);
 
-//provided services
-static int different_services = 0;
-static int services_count = 0;
-static char services[MOST_COMMON_SERVICES_COUNT][10]; //services UUIDs
-static bool dev_services[MAX_DEVICES]
-			[MOST_COMMON_SERVICES_COUNT]; //which devices provide which service
+//the scan epochs collecting beacons and the previous ones
+static struct scan_epoch epochs[SCAN_EPOCH_BUFFERS];
+static atomic_t active_epoch; //epoch that started last
 
-static int old_device_count = 0;
-static char old_devices[MAX_DEVICES][BT_ADDR_LE_STR_LEN];
-
-//final data sample that is written to SD-card in CSV file
-static int data_sample[230];
+//final data samples that are written to SD-card in CSV file
+//one per overlapping epoch: each contains scans that followed each other back to back
+static struct data_window data_samples[SCAN_EPOCH_OVERLAP];
 
 //number of data samples existing
 static int data_file_count = 0;
 
 //data sample string that is written to CSV file
-static char data_str[3000];
+static char data_str[4000];
 
 //measure time needed for processing and classification
 static int time_points[4];
@@ -180,155 +168,50 @@ static bool daytime_selected;
 //current classification (prediction and probability)
 static classification current_classification;
 
-//get index of device addr
-//return -1 if addr not found
-int getIndex(char *addr)
-{
-	for (int i = 0; i < device_count; i++) {
-		if (!strcmp(devices[i], addr)) {
-			return i;
-		}
-	}
-	return -1;
-}
-
-//add new unique device (BLE adress)
-void addDevice(char *addr)
-{
-	strcpy(devices[device_count], addr);
-	if (device_count < MAX_DEVICES) {
-		device_count++;
-	}
-}
-
-//add newly received beacon data (RSSI, timestamp) to device at index
-void addRssi(int rssi, int index)
-{
-	for (int i = 0; i < MAX_BEACONS_RECEIVED; i++) {
-		if (beacons_received[index][i][0] == 0) {
-			beacons_received[index][i][0] = rssi;
-			//save amount of CPU cycles elapsed (timestamp)
-			beacons_received[index][i][1] = k_cycle_get_32();
-			break;
-		}
-	}
-}
+#ifdef ADAPTIVE_SCAN
+//pauses of the scanning while the predictions are stable
+static struct scan_schedule schedule;
+static int64_t scanning_since; //uptime (ms) of the latest scan start
+#endif
 
 /*
-obtain txpower, manufacturer data and service UUIDs from beacon data
+aggregation thread
+processes the advertisements queued by scan_cb
 */
-static bool eir_found(struct bt_data *data, void *user_data)
+static void aggregation_thread(void *p1, void *p2, void *p3)
 {
-	bt_addr_le_t *addr = static_cast<bt_addr_le_t *>(user_data);
-	char result[BT_ADDR_LE_STR_LEN];
-
-	bt_addr_le_to_str(addr, result, BT_ADDR_LE_STR_LEN);
-
-	uint8_t txp = 0;
-	uint8_t len = 0;
-
-	switch (data->type) {
-	case BT_DATA_TX_POWER:
-
-		txp = data->data[0];
-
-		for (int i = 0; i < MAX_DIFFERENT_TX_POWERS; i++) {
-			if (txPower[i][0] == txp) {
-				txPower[i][1]++;
-				break;
-			}
-			if (txPower[i][1] == 0) {
-				txPower[i][1]++;
-				txPower[i][0] = txp;
-				break;
-			}
-		}
-
-		break;
-	case BT_DATA_MANUFACTURER_DATA:
-		len = data->data_len;
-		for (int i = 0; i < MAX_DIFFERENT_MAN_PACKET_LEN; i++) {
-			if (manufacturer_data_len[i][0] == len) {
-				manufacturer_data_len[i][1]++;
-				break;
-			}
-			if (manufacturer_data_len[i][1] == 0) {
-				manufacturer_data_len[i][1]++;
-				manufacturer_data_len[i][0] = len;
-				break;
-			}
-		}
-		break;
-
-	case BT_DATA_UUID16_SOME:
-	case BT_DATA_UUID16_ALL:
-		if (data->data_len % sizeof(uint16_t) != 0U) {
-			printk("AD malformed\n");
-			return true;
-		}
-
-		for (int i = 0; i < data->data_len; i += sizeof(uint16_t)) {
-			struct bt_uuid *uuid;
-			uint16_t u16;
-
-			memcpy(&u16, &data->data[i], sizeof(u16));
-
-			struct bt_uuid_16 temp[] = { { .uuid = { BT_UUID_TYPE_16 },
-						       .val = (sys_le16_to_cpu(u16)) } };
-
-			uuid = ((struct bt_uuid *)(temp));
-
-			char uuid_str[100];
-			bt_uuid_to_str(uuid, uuid_str, sizeof(uuid_str));
+	const struct adv_record *record;
 
-			for (int j = 0; j <= different_services; j++) {
-				if (!strcmp(services[j], uuid_str)) {
-					if (!dev_services[getIndex(result)][j]) {
-						dev_services[getIndex(result)][j] = true;
-						services_count++;
-					}
-
-					return false;
-				}
-				if (j == different_services) {
-					strcpy(services[j], uuid_str);
-					different_services++;
-					dev_services[getIndex(result)][j] = true;
-					services_count++;
-
-					return false;
-				}
+	while (1) {
+		k_sem_take(&adv_queue_sem, K_FOREVER);
+
+		while ((record = adv_queue_peek(&adv_queue)) != NULL) {
+			//add beacon to all epochs that were collecting when it was received
+			for (int i = 0; i < SCAN_EPOCH_OVERLAP; i++) {
+				scan_epoch_add(&epochs[(record->epoch + SCAN_EPOCH_BUFFERS - i) %
+						       SCAN_EPOCH_BUFFERS],
+					       record);
 			}
+			adv_queue_release(&adv_queue);
 		}
 	}
-	return true;
 }
 
+K_THREAD_DEFINE(aggregation_tid, AGGREGATION_STACK_SIZE, aggregation_thread, NULL, NULL, NULL,
+		AGGREGATION_PRIORITY, 0, 0);
+
 /*
 callback method when new beacon is received
+only queues the beacon for the active epochs, processing is done by the aggregation thread
 */
 static void scan_cb(const bt_addr_le_t *addr, int8_t rssi, uint8_t adv_type,
 		    struct net_buf_simple *buf)
 {
-	char result[BT_ADDR_LE_STR_LEN];
-
-	bt_addr_le_to_str(addr, result, BT_ADDR_LE_STR_LEN);
-
-	int index = getIndex(result);
-
-	if (index == -1) {
-		//new device
-
-		addDevice(result);
-
-		int ind = getIndex(result);
-		addRssi(rssi, ind);
-	} else {
-		//known device
-		addRssi(rssi, index);
+	//save amount of CPU cycles elapsed (timestamp)
+	if (adv_queue_push(&adv_queue, addr, rssi, adv_type, buf->data, buf->len,
+			   k_cycle_get_32(), (uint8_t)atomic_get(&active_epoch))) {
+		k_sem_give(&adv_queue_sem);
 	}
-
-	bt_data_parse(buf, eir_found, (void *)addr);
 }
 
 /*
@@ -700,47 +583,191 @@ void writeDataFile()
 }
 
 /*
-reset all data variables after scan and update old devices
+end the oldest active scan epoch and start collecting beacons in a new one
+the epoch that is reused is the oldest one, which is no longer needed
+return the epoch that ended
 */
-void reset()
+struct scan_epoch *switchEpoch()
 {
-	for (int i = 0; i < device_count; i++) {
-		for (int j = 0; j < MAX_BEACONS_RECEIVED; j++) {
-			beacons_received[i][j][0] = 0;
-			beacons_received[i][j][1] = 0;
-		}
-		strcpy(old_devices[i], devices[i]);
-		strcpy(devices[i], "");
+	int active = (int)atomic_get(&active_epoch);
+	int ended = (active + SCAN_EPOCH_BUFFERS - (SCAN_EPOCH_OVERLAP - 1)) % SCAN_EPOCH_BUFFERS;
+	int next = (active + 1) % SCAN_EPOCH_BUFFERS;
+	uint32_t now = k_cycle_get_32();
+
+	scan_epoch_reset(&epochs[next], now);
+	epochs[ended].end = now;
+	atomic_set(&active_epoch, next);
+
+	//scan_cb runs in the cooperative Bluetooth RX thread, so every beacon of the ended epoch
+	//is queued at this point; wait until all of them are aggregated
+	uint32_t queued = adv_queue_position(&adv_queue);
+	while (!adv_queue_is_processed(&adv_queue, queued)) {
+		k_msleep(1);
+	}
 
-		for (int j = 0; j < MOST_COMMON_SERVICES_COUNT; j++) {
-			dev_services[i][j] = false;
-		}
+	return &epochs[ended];
+}
+
+/*
+start scanning with new epochs, the radio keeps listening while the previous epoch is processed
+the other epochs are empty until they are used (no devices in the scan before the first one)
+*/
+int startScanning()
+{
+	for (int i = SCAN_EPOCH_BUFFERS - 1; i >= 0; i--) {
+		scan_epoch_reset(&epochs[i], k_cycle_get_32());
 	}
-	for (int i = 0; i < MOST_COMMON_SERVICES_COUNT; i++) {
-		strcpy(services[i], "");
+	atomic_set(&active_epoch, 0);
+
+#ifdef ADAPTIVE_SCAN
+	scanning_since = k_uptime_get();
+#endif
+
+	return bt_le_scan_start(&scan_param, scan_cb);
+}
+
+#ifdef ADAPTIVE_SCAN
+/*
+stop scanning for the given seconds, then start again with new epochs
+the data samples are scanned again from their first scan
+*/
+int pauseScanning(int seconds)
+{
+	int err = bt_le_scan_stop();
+	if (err) {
+		return err;
+	}
+	schedule.radio_on += k_uptime_get() - scanning_since;
+
+	//beacons still queued belong to the old epochs, aggregate them before the epochs are reset
+	uint32_t queued = adv_queue_position(&adv_queue);
+	while (!adv_queue_is_processed(&adv_queue, queued)) {
+		k_msleep(1);
+	}
+
+	k_sleep(K_SECONDS(seconds));
+
+	return startScanning();
+}
+
+/*
+append the decision of the scan schedule and its cost so far to the schedule log on the SD-card
+*/
+void writeScheduleLog(int pause)
+{
+	int64_t now = k_uptime_get();
+	int64_t uptime = MAX(now - schedule.start, 1);
+	int64_t radio_on = schedule.radio_on + now - scanning_since;
+	uint32_t cpu_ms = (uint32_t)k_cyc_to_ms_floor64(schedule.cpu_cycles);
+
+	//duty cycle and cost per hour so far
+	printk("schedule: %s, pause %d s, radio on %d%% (%d s/h), CPU %u ms/h\n",
+	       pause > 0 ? "stable" : "full rate", pause, (int)(100 * radio_on / uptime),
+	       (int)(3600 * radio_on / uptime), (uint32_t)(3600000ll * cpu_ms / uptime));
+
+	if (!sd_card_initialized) {
+		return;
 	}
 
-	for (int k = 0; k < MAX_DIFFERENT_TX_POWERS; k++) {
-		txPower[k][0] = 0;
-		txPower[k][1] = 0;
+	char log_path[50];
+	strcpy(log_path, disk_mount_pt);
+	strcat(log_path, evalPath);
+	strcat(log_path, "/schedule.csv");
+
+	struct fs_file_t log_file;
+
+	if (openOrCreateFile(&log_file, log_path) < 0) {
+		return;
 	}
 
-	for (int k = 0; k < MAX_DIFFERENT_MAN_PACKET_LEN; k++) {
-		manufacturer_data_len[k][0] = 0;
-		manufacturer_data_len[k][1] = 0;
+	//uptime_ms, index, probability, pause_s, radio_on_ms, cpu_ms
+	char line[100];
+	sprintf(line, "%u, %d, %d, %d, %u, %u\n", (uint32_t)now, current_classification.index,
+		(int)round(current_classification.probability * 100), pause, (uint32_t)radio_on,
+		cpu_ms);
+
+	fs_seek(&log_file, 0, FS_SEEK_END);
+	fs_write(&log_file, line, strlen(line));
+	fs_sync(&log_file);
+	fs_close(&log_file);
+}
+#endif
+
+#ifdef PROVISIONAL
+/*
+print and display the current classification as provisional prediction of a data sample with the
+given scans, it is not saved
+*/
+void showProvisional(int scans)
+{
+	int env_index = current_classification.index;
+	int round_prob = (int)round(current_classification.probability * 100);
+
+	printk("provisional prediction after %d scans: %s (index: %d) (prob: %d%%)\n", scans,
+	       available_env[env_index], env_index, round_prob);
+
+	//the prediction is marked with ?
+	char disp[50];
+	sprintf(disp, "t: %s (%s)\n\np?: %s %d%%", environments[current_environment],
+		daytimes[current_daytime], available_env[env_index], round_prob);
+	setDisplayText(disp);
+}
+#endif
+
+/*
+classify the data sample to current_classification
+with MODEL_REGISTRY by the most accurate model within the inference budget
+*/
+void classifySample(const struct data_window *sample)
+{
+#ifdef MODEL_REGISTRY
+	loop_model(sample, model_select(INFERENCE_BUDGET), &current_classification);
+#else
+	loop(sample, &current_classification);
+#endif
+}
+
+#ifdef MODEL_REGISTRY
+/*
+print allocation and inference cost of every model in the registry
+*/
+void printModelCosts(void)
+{
+	for (int m = 0; m < MODEL_COUNT; m++) {
+		const struct inference_stats *cost = model_stats_get((enum model_id)m);
+
+		if (cost->unusable) {
+			printk("model %s: tensor allocation failed, not used\n",
+			       model_name((enum model_id)m));
+			continue;
+		}
+		printk("model %s: %d invokes, %u cycles avg, max %u, allocation: %u cycles, tensor arena used: %d bytes\n",
+		       model_name((enum model_id)m), cost->invokes,
+		       (uint32_t)(cost->total_cycles / MAX(cost->invokes, 1)), cost->max_cycles,
+		       cost->setup_cycles, cost->arena_used);
 	}
-	old_device_count = device_count;
-	device_count = 0;
-	different_services = 0;
-	services_count = 0;
+}
+#endif
+
+/*
+epoch that ended when epoch started (the last scan)
+*/
+struct scan_epoch *previousEpoch(struct scan_epoch *epoch)
+{
+	return &epochs[(epoch - epochs + SCAN_EPOCH_BUFFERS - SCAN_EPOCH_OVERLAP) %
+		       SCAN_EPOCH_BUFFERS];
 }
 
 /*
 First the user selects the current environment and time of the day
-Secondly a BLE scan is performed while saving data from received BLE beacons
-Thirdly the raw data is processed to features
-Lastly the data sample is crafted from the latest 5 scans and classified to one of the selected environments (printed on display)
+Secondly overlapping BLE scan epochs are performed while saving data from received BLE beacons
+Thirdly the raw data of an epoch is processed to features while the next epochs are already scanning
+Lastly the data sample is crafted from the latest 5 scans that followed each other back to back and classified to one of the selected environments (printed on display)
+A new data sample is classified every SCAN_TIME / SCAN_EPOCH_OVERLAP seconds
 The data sample and the prediction are saved on the SD card for further evaluation
+With ADAPTIVE_SCAN scanning pauses after a prediction while the predictions are stable
+With PROVISIONAL the data samples are classified from their first scan on, provisional predictions are shown until they are complete
+With MODEL_REGISTRY every data sample is classified by the most accurate model within INFERENCE_BUDGET cycles (0: the cheapest model)
 */
 void main(void)
 {
@@ -785,261 +812,119 @@ void main(void)
 	printk("\nScanning... \n");
 	setDisplayText("Scanning...");
 
-	//collect and detect samples
-	for (int r = 0; r < N_SAMPLES + SCAN_COUNT; r++) {
-		//start time
-		time_points[0] = k_cycle_get_32();
-
-		reset();
-
-		//shift back the feature values of the 4 latest scans by one scan and make room for a new scan
-		for (int i = DATA_LINE_LENGTH * 4 - 1; i >= 0; i--) {
-			data_sample[i + DATA_LINE_LENGTH] = data_sample[i];
-		}
+#ifdef ADAPTIVE_SCAN
+	scan_schedule_init(&schedule, k_uptime_get());
+#endif
 
-		//perform BLE scan
-		err = bt_le_scan_start(&scan_param, scan_cb);
-		if (err) {
-			printk("Starting scanning failed (err %d)\n", err);
-			break;
-		}
-
-		k_msleep(SECOND * SCAN_TIME);
-
-		err = bt_le_scan_stop();
-
-		if (err) {
-			printk("Stopping scanning failed (err %d)\n", err);
-			break;
-		}
-		//BLE scan performed
+	err = startScanning();
+	if (err) {
+		printk("Starting scanning failed (err %d)\n", err);
+		return;
+	}
 
-		//BLE scan time
-		time_points[1] = k_cycle_get_32();
+	int64_t epoch_end = k_uptime_get();
 
-		//for monotoring device count and services
-		printk("\nDevices: %d; services: ", device_count);
+	//epoch r counts from run_start, where scanning (re)started
+	int run_start = 0;
+	int predictions = 0;
 
-		for (int i = 0; i < different_services; i++) {
-			printk("%s, ", services[i]);
+	//collect and detect samples
+	for (int r = 0; predictions < N_SAMPLES; r++) {
+		//wait until the oldest scan epoch is over
+		epoch_end += SECOND * SCAN_TIME / SCAN_EPOCH_OVERLAP;
+		int64_t remaining = epoch_end - k_uptime_get();
+		if (remaining > 0) {
+			k_msleep(remaining);
+		} else {
+			//processing overran the epoch: it ends now and the next one a full epoch later,
+			//instead of catching up with epochs that are too short
+			printk("epoch ends %d ms late\n", (int)-remaining);
+			epoch_end = k_uptime_get();
 		}
-		printk("\n");
-
-		/*
-		process raw data received during the BLE scan to feature values 
-		*/
 
-		//compare to last scan: new devices, lost devices
-		int new_device_count = 0;
-		int lost_device_count = 0;
-
-		for (int k = 0; k < device_count; k++) {
-			for (int l = 0; l < old_device_count; l++) {
-				if (!strcmp(devices[k], old_devices[l])) {
-					break;
-				}
-				if (l == old_device_count - 1) {
-					new_device_count++;
-				}
-			}
-		}
+		struct scan_epoch *epoch = switchEpoch();
+		//BLE scan performed
 
-		for (int k = 0; k < old_device_count; k++) {
-			for (int l = 0; l < device_count; l++) {
-				if (!strcmp(old_devices[k], devices[l])) {
-					break;
-				}
-				if (l == device_count - 1) {
-					lost_device_count++;
-				}
-			}
+		//the first epochs started before scanning started, they are discarded (a scan before the
+		//first scan of a data sample has no devices)
+		if (r - run_start < SCAN_EPOCH_OVERLAP - 1) {
+			scan_epoch_reset(epoch, epoch->end);
+			continue;
 		}
-		data_sample[0] = device_count;
-		data_sample[1] = lost_device_count;
-		data_sample[2] = new_device_count;
-
-		//TxPower count, min, max, avg
-		int txpower_count = 0;
-		int txpower_avg = 0;
 
-		int min_txpower = 200;
-		int max_txpower = 0;
+		//data sample of the scans that followed each other back to back up to this epoch
+		int scan = r - run_start - (SCAN_EPOCH_OVERLAP - 1);
+		struct data_window *data_sample = &data_samples[scan % SCAN_EPOCH_OVERLAP];
 
-		for (int k = 0; k < MAX_DIFFERENT_TX_POWERS; k++) {
-			if (txPower[k][1] != 0) {
-				txpower_count += txPower[k][1];
-				txpower_avg += (txPower[k][0] * txPower[k][1]);
-
-				if (txPower[k][0] > max_txpower) {
-					max_txpower = txPower[k][0];
-				}
-
-				if (txPower[k][0] < min_txpower) {
-					min_txpower = txPower[k][0];
-				}
-			}
-		}
-		if (txpower_count != 0) {
-			txpower_avg /= txpower_count;
-		}
+		//start time and BLE scan time
+		time_points[0] = epoch->start;
+		time_points[1] = epoch->end;
 
-		//manufacturer packet length count, avg and sum
-		int man_packet_len_count = 0;
-		int man_packet_len_avg = 0;
-		int man_packet_len_sum = 0;
+		//epochs follow each other without a gap
+		printk("\nEpoch %d: start %u, end %u, gap to previous epoch: %d cycles\n", scan,
+		       epoch->start, epoch->end, (int)(epoch->start - previousEpoch(epoch)->end));
 
-		for (int k = 0; k < MAX_DIFFERENT_MAN_PACKET_LEN; k++) {
-			if (manufacturer_data_len[k][1] != 0) {
-				man_packet_len_count += manufacturer_data_len[k][1];
-				man_packet_len_avg +=
-					(manufacturer_data_len[k][0] * manufacturer_data_len[k][1]);
+		//for monotoring device count and services
+		printk("Devices: %d, evicted devices: %d; dropped beacons: %d, truncated beacons: %d; ignored services: %d; services: ",
+		       epoch->devices.count, epoch->devices_evicted, (int)atomic_get(&adv_queue.dropped),
+		       (int)atomic_get(&adv_queue.truncated), epoch->services_overflow);
 
-				man_packet_len_sum += manufacturer_data_len[k][0];
+		for (int s = 0; s < MOST_COMMON_SERVICES_COUNT; s++) {
+			if (epoch->service_devices[s] != 0) {
+				printk("%04x, ", most_common_services[s]);
 			}
 		}
-		if (man_packet_len_avg != 0) {
-			man_packet_len_avg /= man_packet_len_count;
+		for (int i = 0; i < epoch->other_services_count; i++) {
+			printk("%04x, ", epoch->other_services[i]);
 		}
+		printk("\n");
 
-		data_sample[3] = different_services;
-		data_sample[4] = services_count;
-		data_sample[5] = txpower_count;
-		data_sample[6] = txpower_avg;
-		data_sample[7] = min_txpower;
-		data_sample[8] = max_txpower;
-		data_sample[9] = man_packet_len_count;
-		data_sample[10] = man_packet_len_sum;
-		data_sample[11] = man_packet_len_avg;
-
-		// RSSI feature values
-		int avg_received = 0;
-		int min_received = MAX_BEACONS_RECEIVED;
-		int max_received = 0;
-
-		int avg_avg_rssi = 0;
-		int min_rssi = 0;
-		int max_rssi = -100;
-		int avg_rssi_difference = 0;
-
-		int min_avg_rssi = 0;
-		int max_avg_rssi = -100;
-
-		//time difference (in CPU cycles) between beacons
-		int avg_avg_difference_between_beacons = 0;
-		int avg_difference_first_last = 0;
-
-		for (int i = 0; i < device_count; i++) {
-			double avg_r = 0;
-			int j = 0;
-
-			int current_min_rssi = 0;
-			int current_max_rssi = -100;
-			int current_avg_bt_bc = 0;
-			for (j = 0; j < MAX_BEACONS_RECEIVED; j++) {
-				if (beacons_received[i][j][0] == 0) {
-					avg_received += j;
-					break;
-				}
-
-				if (beacons_received[i][j][0] < current_min_rssi) {
-					current_min_rssi = beacons_received[i][j][0];
-				}
-				if (beacons_received[i][j][0] > current_max_rssi) {
-					current_max_rssi = beacons_received[i][j][0];
-				}
-
-				avg_r += beacons_received[i][j][0];
-				if (j > 0) {
-					current_avg_bt_bc += beacons_received[i][j][1] -
-							     beacons_received[i][j - 1][1];
-				}
-			}
-			if (j < min_received && j != 0) {
-				min_received = j;
-			}
-			if (j > max_received) {
-				max_received = j;
-			}
-			avg_rssi_difference += (current_max_rssi - current_min_rssi);
-
-			if (j != 0) {
-				int current_avg = (avg_r / j);
-				avg_avg_rssi += current_avg;
-
-				if (current_avg > max_avg_rssi) {
-					max_avg_rssi = current_avg;
-				}
-
-				if (current_avg < min_avg_rssi) {
-					min_avg_rssi = current_avg;
-				}
-			}
-			if (j > 1) {
-				avg_avg_difference_between_beacons += (current_avg_bt_bc / (j - 1));
-				avg_difference_first_last +=
-					beacons_received[i][j - 1][1] - beacons_received[i][0][1];
-			}
+		/*
+		process raw data received during the BLE scan to feature values 
+		the new scan replaces the oldest scan of the data sample, only its values are normalized
+		*/
+		scan_epoch_features(epoch, previousEpoch(epoch), data_window_add(data_sample));
+		data_window_normalize(data_sample);
 
-			if (current_min_rssi < min_rssi) {
-				min_rssi = current_min_rssi;
-			}
-			if (current_max_rssi > max_rssi) {
-				max_rssi = current_max_rssi;
+		//timestamp after processing a scan
+		time_points[2] = k_cycle_get_32();
+#ifdef ADAPTIVE_SCAN
+		schedule.cpu_cycles += (uint32_t)(time_points[2] - time_points[1]);
+#endif
+
+#ifdef PROVISIONAL
+		//until the data sample is complete its predictions are provisional
+		if (data_sample->scans <= SCAN_COUNT) {
+			classifySample(data_sample);
+#ifdef ADAPTIVE_SCAN
+			schedule.cpu_cycles += (uint32_t)(k_cycle_get_32() - time_points[2]);
+#endif
+			if (current_classification.index != -1) {
+				showProvisional(data_sample->scans);
 			}
+			continue;
 		}
-		if (device_count != 0) {
-			avg_received = avg_received / device_count;
-			avg_avg_rssi = avg_avg_rssi / device_count;
-			avg_rssi_difference = avg_rssi_difference / device_count;
-			avg_avg_difference_between_beacons =
-				avg_avg_difference_between_beacons / device_count;
-			avg_difference_first_last = avg_difference_first_last / device_count;
-		}
+#endif
 
-		data_sample[12] = avg_received;
-		data_sample[13] = min_received;
-		data_sample[14] = max_received;
-		data_sample[15] = avg_avg_rssi;
-		data_sample[16] = min_avg_rssi;
-		data_sample[17] = max_avg_rssi;
-		data_sample[18] = min_rssi;
-		data_sample[19] = max_rssi;
-		data_sample[20] = avg_rssi_difference;
-		data_sample[21] = avg_avg_difference_between_beacons;
-		data_sample[22] = avg_difference_first_last;
-
-		//provided services
-		for (int s = 0; s < MOST_COMMON_SERVICES_COUNT; s++) {
-			for (int t = 0; t < different_services; t++) {
-				if (!strcmp(most_common_services[s], services[t])) {
-					int s_count = 0;
-					for (int u = 0; u < device_count; u++) {
-						if (dev_services[u][t]) {
-							s_count++;
-						}
-					}
-					data_sample[23 + s] = s_count;
-					break;
-				}
+		//only if 5 scans were performed after the first scan of this data sample
+		if (data_sample->scans > SCAN_COUNT) {
+			//classify data sample
+			classifySample(data_sample);
+			predictions++;
 
-				if (t == different_services - 1) {
-					data_sample[23 + s] = 0;
-				}
+			if (current_classification.index == -1) {
+				printk("no prediction\n");
+				continue;
 			}
-		}
 
-		//timestamp after processing a scan
-		time_points[2] = k_cycle_get_32();
-
-		//only if at least 5 scans were performed
-		if (r > SCAN_COUNT - 1) {
-			//classify data sample
-			loop(&data_sample[0], &current_classification);
 			int env_index = current_classification.index;
 			int round_prob = (int)round(current_classification.probability * 100);
 
 			//timestamp after classification
 			time_points[3] = k_cycle_get_32();
+#ifdef ADAPTIVE_SCAN
+			schedule.cpu_cycles += (uint32_t)(time_points[3] - time_points[2]);
+#endif
 
 			char current_env_str[20];
 			strcpy(current_env_str, environments[current_environment]);
@@ -1052,6 +937,24 @@ void main(void)
 			printk("predicted environment: %s (index: %d) (prob: %d%%)\n",
 			       available_env[env_index], env_index, round_prob);
 
+			const struct inference_stats *inference = inference_stats_get();
+
+			printk("inference: %u cycles (avg %u, max %u), tensor arena used: %d bytes, high-water: %d bytes\n",
+			       inference->last_cycles,
+			       (uint32_t)(inference->total_cycles / MAX(inference->invokes, 1)),
+			       inference->max_cycles, inference->arena_used,
+			       inference->arena_high_water);
+#ifdef CASCADE
+			printk("cascade: %d of %d data samples escalated to the neural network (%d%%), first stage: %u cycles avg\n",
+			       inference->escalations, inference->classifications,
+			       100 * inference->escalations / MAX(inference->classifications, 1),
+			       (uint32_t)(inference->first_stage_cycles /
+					  MAX(inference->classifications, 1)));
+#endif
+#ifdef MODEL_REGISTRY
+			printModelCosts();
+#endif
+
 			//show true and predicted environnment on the display
 			char disp[50];
 			strcpy(disp, "t: ");
@@ -1084,9 +987,13 @@ void main(void)
 				strcpy(data_str, "");
 				strcat(data_str, feature_names);
 				for (int s = 0; s < MOST_COMMON_SERVICES_COUNT; s++) {
-					strcat(data_str, ", ");
-					strcat(data_str, most_common_services[s]);
+					char service[10];
+					sprintf(service, ", %04x", most_common_services[s]);
+					strcat(data_str, service);
 				}
+#ifdef RSSI_QUANTILES
+				strcat(data_str, rssi_quantile_names);
+#endif
 
 				strcat(data_str, ", time_point_1");
 				strcat(data_str, ", time_point_2");
@@ -1096,7 +1003,7 @@ void main(void)
 
 				//feature values
 				for (int i = 0; i < DATA_LENGTH; i++) {
-					if (i % DATA_LINE_LENGTH == 0 && i != 0) {
+					if (i % DATA_RECORD_LENGTH == 0 && i != 0) {
 						for (int j = 1; j < 4; j++) {
 							char time_point[20];
 							sprintf(time_point, ", %d",
@@ -1107,7 +1014,8 @@ void main(void)
 						strcat(data_str, current_env_str);
 					}
 					char value[20];
-					sprintf(value, ", %d", data_sample[i]);
+					sprintf(value, ", %d",
+						data_window_row(data_sample, i / DATA_RECORD_LENGTH)[i % DATA_RECORD_LENGTH]);
 					strcat(data_str, value);
 				}
 
@@ -1155,9 +1063,34 @@ void main(void)
 
 				fs_close(&env_file);
 			}
+
+#ifdef ADAPTIVE_SCAN
+			//pause scanning while the predictions are stable
+			int pause = scan_schedule_update(&schedule, current_classification.index,
+							 current_classification.probability);
+
+			writeScheduleLog(pause);
+			if (pause > 0) {
+				err = pauseScanning(pause);
+				if (err) {
+					printk("Restarting scanning failed (err %d)\n", err);
+					break;
+				}
+				run_start = r + 1;
+				epoch_end = k_uptime_get();
+				for (int i = 0; i < SCAN_EPOCH_OVERLAP; i++) {
+					data_window_reset(&data_samples[i]);
+				}
+			}
+#endif
 		}
 	}
 
+	err = bt_le_scan_stop();
+	if (err) {
+		printk("Stopping scanning failed (err %d)\n", err);
+	}
+
 	setLED0(true);
 	setLED1(true);
 	fs_unmount(&mp);
@@ -5,67 +5,302 @@ Using a predefined neural network we predict the environment to a given data sam
 
 #include "main_functions.h"
 
-#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
 #include "constants.h"
+#include "model_ops.h"
+#ifdef MODEL_ARENA_MEASURED
+#include "model_arena.h"
+#endif
+#include "model_aot.h"
+#include "cascade_model.h"
 #include "tensorflow/lite/micro/micro_error_reporter.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/version.h"
 #include <sys/printk.h>
+#include <sys/util.h>
 #include <math.h>
+#include <string.h>
 
 #include <zephyr.h>
 
-#define DATA_LINE_LENGTH 46
-#define DATA_ROWS 5
-
-static float prepared_data[DATA_LINE_LENGTH*DATA_ROWS];
+#include <new>
 
 
 namespace
 {
+#ifndef AOT_MODEL
 tflite::ErrorReporter *error_reporter = nullptr;
+const tflite::MicroOpResolver *op_resolver = nullptr;
 const tflite::Model *model = nullptr;
 tflite::MicroInterpreter *interpreter = nullptr;
 TfLiteTensor *input = nullptr;
 TfLiteTensor *output = nullptr;
 
+// The interpreter is built in place, again for every model that is allocated in the arena
+alignas(tflite::MicroInterpreter) uint8_t interpreter_buffer[sizeof(tflite::MicroInterpreter)];
+
+#ifdef MODEL_REGISTRY
+// Models to select from, they time-share the tensor arena
+struct model_entry {
+	const char *name;
+	const unsigned char *data;
+};
+
+const struct model_entry models[MODEL_COUNT] = {
+	{ "g_modelurd", g_modelurd },
+	{ "g_model_raw", g_model_raw },
+};
+
+// Model allocated in the arena (-1: none) and the cost of every model
+int current_model = -1;
+struct inference_stats model_stats[MODEL_COUNT];
+#endif
+
 // Create an area of memory to use for input, output, and intermediate arrays.
-const int kModelArenaSize = 6064;
-// Extra headroom for model + alignment + future interpreter changes.
-const int kExtraArenaSize = 560 + 16 + 160;
-const int kTensorArenaSize = kModelArenaSize + kExtraArenaSize;
-static uint8_t tensor_arena[kTensorArenaSize];
+// With MEASURE_ARENA the size the model needs is computed at build time (model_arena.h, see
+// tools/arena_size.cc), TENSOR_ARENA_SIZE sets a larger arena. Without it TENSOR_ARENA_SIZE sets
+// the arena, by default the size of g_modelurd (6064 bytes) and the interpreter data (736 bytes),
+// which is not checked at build time (setup() reports a failed allocation).
+#ifdef MODEL_ARENA_MEASURED
+#ifdef MODEL_REGISTRY
+const int kModelArenaSize = MAX(MODEL_ARENA_SIZE, MODEL_RAW_ARENA_SIZE);
+#elif defined(RAW_INPUT)
+const int kModelArenaSize = MODEL_RAW_ARENA_SIZE;
+#else
+const int kModelArenaSize = MODEL_ARENA_SIZE;
+#endif
+#ifdef TENSOR_ARENA_SIZE
+const int kTensorArenaSize = TENSOR_ARENA_SIZE;
+#else
+const int kTensorArenaSize = kModelArenaSize;
+#endif
+static_assert(kTensorArenaSize >= kModelArenaSize, "tensor arena is too small for the model");
+#else
+#define MODEL_ARENA_ALIGNMENT 16
+#ifdef TENSOR_ARENA_SIZE
+const int kTensorArenaSize = TENSOR_ARENA_SIZE;
+#else
+const int kTensorArenaSize = 6064 + 736;
+#endif
+#endif
+alignas(MODEL_ARENA_ALIGNMENT) static uint8_t tensor_arena[kTensorArenaSize];
+
+// Unused bytes of the arena keep this value (for the high-water mark)
+const uint8_t kArenaFill = 0xa5;
+#endif
+
+struct inference_stats stats;
 } 
 
 /*
-normalize data sample; must be done since neural network is trained with normalized data
+normalize feature values of one scan; must be done since neural network is trained with normalized data
+features without deviation are 0
 */
-void prepare_data(int raw_data[], int length, int rows, float *prepared)
+void prepare_data(const int raw_data[], int length, float *prepared)
 {
 	for (int i = 0; i < length; i++) {
 		if (std_list[i] != 0) {
-			for (int j = 0; j<rows; j++){
-				
-				prepared[length*j + i] = (raw_data[length*j + i] - mean_list[i]) / std_list[i];
-				
-				
-			}
-			
+			prepared[i] = (raw_data[i] - mean_list[i]) / std_list[i];
+		} else {
+			prepared[i] = 0;
 		}
 	}
 }
 
 /*
-initialize neural network
+normalize and quantize feature values of one scan for the int8 input of the neural network
+scale and zero point per feature include the normalization (see tools/fold_normalization.cc)
+*/
+void quantize_data(const int raw_data[], int length, int8_t *prepared)
+{
+	for (int i = 0; i < length; i++) {
+		int value = (int)roundf(raw_data[i] * raw_input_scale[i] + raw_input_zero_point[i]);
+
+		prepared[i] = (int8_t)MIN(MAX(value, INT8_MIN), INT8_MAX);
+	}
+}
+
+/*
+feature values of one scan as the model gets them
+lost and new devices of the first scan are unknown, the model gets their mean values
+*/
+static const int *known_values(const int raw_data[], bool first_scan, int row[DATA_LINE_LENGTH])
+{
+	if (!first_scan) {
+		return raw_data;
+	}
+
+	memcpy(row, raw_data, DATA_LINE_LENGTH * sizeof(int));
+	row[FEATURE_LOST_DEVICES] = (int)roundf(mean_list[FEATURE_LOST_DEVICES]);
+	row[FEATURE_NEW_DEVICES] = (int)roundf(mean_list[FEATURE_NEW_DEVICES]);
+
+	return row;
+}
+
+//the normalization has a value for every feature of the model input
+static_assert(sizeof(mean_list) / sizeof(mean_list[0]) == DATA_LINE_LENGTH &&
+		      sizeof(std_list) / sizeof(std_list[0]) == DATA_LINE_LENGTH,
+	      "mean_list and std_list need DATA_LINE_LENGTH values");
+static_assert(sizeof(raw_input_scale) / sizeof(raw_input_scale[0]) == DATA_LINE_LENGTH &&
+		      sizeof(raw_input_zero_point) / sizeof(raw_input_zero_point[0]) ==
+			      DATA_LINE_LENGTH,
+	      "raw_input_scale and raw_input_zero_point need DATA_LINE_LENGTH values");
+
+/*
+model input values of the feature values of one scan, for float or int8 input (AOT_MODEL: int8)
+*/
+#ifndef AOT_MODEL
+static void normalize_row(const int raw_data[], bool first_scan, float *prepared)
+{
+	int row[DATA_LINE_LENGTH];
+
+	prepare_data(known_values(raw_data, first_scan, row), DATA_LINE_LENGTH, prepared);
+}
+#endif
+
+static void normalize_row(const int raw_data[], bool first_scan, int8_t *prepared)
+{
+	int row[DATA_LINE_LENGTH];
+
+	quantize_data(known_values(raw_data, first_scan, row), DATA_LINE_LENGTH, prepared);
+}
+
+#ifndef AOT_MODEL
+/*
+bytes of the tensor arena written so far
+the interpreter allocates from both ends of the arena, the longest run of bytes that still have
+the fill value is the part that was never used
+*/
+static int arena_high_water(void)
+{
+	int unused = 0;
+	int run = 0;
+
+	for (int i = 0; i < kTensorArenaSize; i++) {
+		run = tensor_arena[i] == kArenaFill ? run + 1 : 0;
+		unused = MAX(unused, run);
+	}
+
+	return kTensorArenaSize - unused;
+}
+#endif
+
+void data_window_reset(struct data_window *window)
+{
+	window->scans = 0;
+}
+
+int *data_window_add(struct data_window *window)
+{
+	int previous = window->newest;
+
+	window->scans = MIN(window->scans + 1, DATA_ROWS + 1);
+
+	window->newest = (window->newest + DATA_ROWS - 1) % DATA_ROWS;
+	memcpy(window->raw[window->newest], window->raw[previous], sizeof(window->raw[previous]));
+
+	return window->raw[window->newest];
+}
+
+void data_window_normalize(struct data_window *window)
+{
+	normalize_row(window->raw[window->newest], window->scans == 1,
+		      window->normalized[window->newest]);
+}
+
+const int *data_window_row(const struct data_window *window, int scan)
+{
+	return window->raw[(window->newest + scan) % DATA_ROWS];
+}
+
+/*
+model input of a scan (0: latest scan)
+scans the data sample does not have yet are filled with the latest scan
+*/
+static const model_input_t *data_window_input(const struct data_window *window, int scan)
+{
+	return window->normalized[(window->newest + (scan < window->scans ? scan : 0)) % DATA_ROWS];
+}
+
+/*
+model input of all scans, from the latest to the oldest one
+the normalized rows of the data window are copied, a model with the other input type (float or
+int8) gets the rows normalized from the feature values
+*/
+static void data_window_fill(const struct data_window *window, model_input_t *input)
+{
+	for (int j = 0; j < DATA_ROWS; j++) {
+		memcpy(&input[DATA_LINE_LENGTH * j], data_window_input(window, j),
+		       sizeof(window->normalized[0]));
+	}
+}
+
+#ifndef AOT_MODEL
+#ifdef RAW_INPUT
+static void data_window_fill(const struct data_window *window, float *input)
+#else
+static void data_window_fill(const struct data_window *window, int8_t *input)
+#endif
+{
+	for (int j = 0; j < DATA_ROWS; j++) {
+		int scan = j < window->scans ? j : 0;
+
+		normalize_row(data_window_row(window, scan), scan == window->scans - 1,
+			      &input[DATA_LINE_LENGTH * j]);
+	}
+}
+#endif
+
+/*
+count an inference of cycles CPU cycles
+*/
+static void count_invoke(struct inference_stats *inference, uint32_t cycles)
+{
+	inference->invokes++;
+	inference->last_cycles = cycles;
+	inference->max_cycles = MAX(inference->max_cycles, cycles);
+	inference->total_cycles += cycles;
+}
+
+#ifdef AOT_MODEL
+/*
+initialize neural network: the ahead-of-time compiled model (model_aot.cc) needs no initialization
 */
 void setup()
 {
+	printk("sample input: %d, ahead-of-time compiled model\n", DATA_LINE_LENGTH * DATA_ROWS);
+}
 
-	static tflite::MicroErrorReporter micro_error_reporter;
-	error_reporter = &micro_error_reporter;
+/*
+predict data sample with the ahead-of-time compiled neural network
+*/
+static void model_loop(const struct data_window *window, struct classification *ptr)
+{
+	static int8_t sample[DATA_ROWS][DATA_LINE_LENGTH];
+
+	//rows from the latest to the oldest scan
+	data_window_fill(window, &sample[0][0]);
 
-	model = tflite::GetModel(g_modelurd);
+	uint32_t start = k_cycle_get_32();
+
+	ptr->index = classify(&sample[0][0], &ptr->probability);
+
+	count_invoke(&stats, k_cycle_get_32() - start);
+}
+#else
+/*
+build the interpreter for a model in the tensor arena, replacing the one allocated before
+return false if the model is not supported or does not fit in the arena
+*/
+static bool allocate_model(const unsigned char *model_data)
+{
+	if (interpreter != nullptr) {
+		interpreter->~MicroInterpreter();
+		interpreter = nullptr;
+	}
+
+	model = tflite::GetModel(model_data);
 
 	if (model->version() != TFLITE_SCHEMA_VERSION) {
 		TF_LITE_REPORT_ERROR(error_reporter,
@@ -73,61 +308,285 @@ void setup()
 				     "to supported version %d.",
 				     model->version(), TFLITE_SCHEMA_VERSION);
 		printk("model not supported\n");
-		return;
+		return false;
 	}
 
-	static tflite::AllOpsResolver resolver;
+	memset(tensor_arena, kArenaFill, sizeof(tensor_arena));
 
 	// Build an interpreter to run the model with.
-	static tflite::MicroInterpreter static_interpreter(model, resolver, tensor_arena,
-							   kTensorArenaSize, error_reporter);
-	interpreter = &static_interpreter;
+	tflite::MicroInterpreter *allocated = new (interpreter_buffer) tflite::MicroInterpreter(
+		model, *op_resolver, tensor_arena, kTensorArenaSize, error_reporter);
 
 	// Allocate memory from the tensor_arena for the model's tensors.
-	TfLiteStatus allocate_status = interpreter->AllocateTensors();
+	TfLiteStatus allocate_status = allocated->AllocateTensors();
 
 	if (allocate_status != kTfLiteOk) {
 		TF_LITE_REPORT_ERROR(error_reporter, "AllocateTensors() failed");
 		printk("tensor allocation failed\n");
 
-		return;
+		//loop() does not run a partially allocated model
+		allocated->~MicroInterpreter();
+		return false;
 	}
 
 	// Obtain pointers to the model's input and output tensors.
-	input = interpreter->input(0);
-	output = interpreter->output(0);
+	input = allocated->input(0);
+	output = allocated->output(0);
+
+	if ((input->type != kTfLiteFloat32 && input->type != kTfLiteInt8) ||
+	    (output->type != kTfLiteFloat32 && output->type != kTfLiteInt8)) {
+		printk("model input or output is neither float nor int8\n");
+		allocated->~MicroInterpreter();
+		return false;
+	}
+
+	//data_window_fill() writes DATA_ROWS scans, the environments are read from the output
+	int input_count = 1;
+	int output_count = 1;
+
+	for (int i = 0; i < input->dims->size; i++) {
+		input_count *= input->dims->data[i];
+	}
+	for (int i = 0; i < output->dims->size; i++) {
+		output_count *= output->dims->data[i];
+	}
+	if (input_count != DATA_LINE_LENGTH * DATA_ROWS || output_count != available_env_len) {
+		printk("model input %d (expected %d) or output %d (expected %d) does not match\n",
+		       input_count, DATA_LINE_LENGTH * DATA_ROWS, output_count, available_env_len);
+		allocated->~MicroInterpreter();
+		return false;
+	}
+
+	interpreter = allocated;
+
+	return true;
+}
+
+#ifdef MODEL_REGISTRY
+/*
+allocate a model of the registry in the tensor arena, unless it is allocated already
+*/
+static bool select_model(enum model_id id)
+{
+	if (id == current_model && interpreter != nullptr) {
+		return true;
+	}
+
+	uint32_t start = k_cycle_get_32();
+
+	current_model = -1;
+	if (!allocate_model(models[id].data)) {
+		//the arena does not change, the allocation would fail again
+		model_stats[id].unusable = true;
+		return false;
+	}
+	current_model = id;
 
-	//print expected and actual input size and used memory 
-	int expected = input->dims->data[1];
-	printk("sample input: %d, expected input: %d, used tensor bytes: %d\n", DATA_LINE_LENGTH*DATA_ROWS, expected, interpreter->arena_used_bytes());
+	model_stats[id].setup_cycles = k_cycle_get_32() - start;
+	model_stats[id].arena_used = interpreter->arena_used_bytes();
+	stats.arena_used = model_stats[id].arena_used;
+
+	return true;
+}
+#endif
+
+/*
+initialize neural network
+*/
+void setup()
+{
+
+	uint32_t start = k_cycle_get_32();
+
+	static tflite::MicroErrorReporter micro_error_reporter;
+	error_reporter = &micro_error_reporter;
+
+	//register only the ops used by the model (generated by tools/model_ops)
+	//the ops of g_model_raw are a subset of the ones of g_modelurd
+#define ADD_OP(name) resolver.Add##name();
+#if defined(RAW_INPUT) && !defined(MODEL_REGISTRY)
+	static tflite::MicroMutableOpResolver<MODEL_RAW_OPS_COUNT> resolver;
+	MODEL_RAW_OPS(ADD_OP)
+#else
+	static tflite::MicroMutableOpResolver<MODEL_OPS_COUNT> resolver;
+	MODEL_OPS(ADD_OP)
+#endif
+#undef ADD_OP
+	op_resolver = &resolver;
+
+#ifdef MODEL_REGISTRY
+	//the first model is allocated now, the others when they are selected
+	bool allocated = select_model(MODEL_FLOAT);
+#elif defined(RAW_INPUT)
+	bool allocated = allocate_model(g_model_raw);
+#else
+	bool allocated = allocate_model(g_modelurd);
+#endif
+
+	if (!allocated) {
+		return;
+	}
+
+	stats.arena_used = interpreter->arena_used_bytes();
+	stats.setup_cycles = k_cycle_get_32() - start;
+
+	//print input size (checked against the model by allocate_model()) and used memory
+	printk("sample input: %d, used tensor bytes: %d\n", DATA_LINE_LENGTH*DATA_ROWS, interpreter->arena_used_bytes());
+#ifdef MODEL_ARENA_MEASURED
+	printk("setup: %u cycles, tensor arena: %d bytes (model needs %d)\n", stats.setup_cycles,
+	       kTensorArenaSize, kModelArenaSize);
+#else
+	printk("setup: %u cycles, tensor arena: %d bytes\n", stats.setup_cycles, kTensorArenaSize);
+#endif
 }
 
 /*
 predict data sample with pretrained neural network
 */
-void loop(int data_sample[DATA_LINE_LENGTH*DATA_ROWS], struct classification *ptr)
+static void model_loop(const struct data_window *window, struct classification *ptr)
 {
-	prepare_data(data_sample, DATA_LINE_LENGTH, DATA_ROWS, prepared_data);
+	//no prediction without an initialized neural network
+	if (interpreter == nullptr) {
+		ptr->index = -1;
+		ptr->probability = 0;
+		return;
+	}
 
-	for (int i = 0; i < DATA_LINE_LENGTH*DATA_ROWS; i++) {
-		input->data.f[i] = prepared_data[i];
+	//rows from the latest to the oldest scan
+	if (input->type == kTfLiteInt8) {
+		data_window_fill(window, input->data.int8);
+	} else {
+		data_window_fill(window, input->data.f);
 	}
 
 	//execute network
+	uint32_t start = k_cycle_get_32();
+
 	interpreter->Invoke();
+
+	uint32_t cycles = k_cycle_get_32() - start;
+
+	count_invoke(&stats, cycles);
+	stats.arena_high_water = arena_high_water();
+#ifdef MODEL_REGISTRY
+	count_invoke(&model_stats[current_model], cycles);
+	model_stats[current_model].arena_high_water = stats.arena_high_water;
+#endif
+
 	float max_value = 0;
 	int env_index_pred = -1;
 
-	//find environment with highest probability
-	for (int i = 0; i<available_env_len; i++){
-		float pred = output->data.f[i];
-		if( pred> max_value){
-			max_value = pred;
-			env_index_pred = i;
+	if (output->type == kTfLiteInt8) {
+		//find environment with highest probability, the int8 values have the same order as the
+		//probabilities, only the highest one is dequantized
+		int max_quantized = output->params.zero_point;
+
+		for (int i = 0; i < available_env_len; i++) {
+			if (output->data.int8[i] > max_quantized) {
+				max_quantized = output->data.int8[i];
+				env_index_pred = i;
+			}
+		}
+		max_value = (max_quantized - output->params.zero_point) * output->params.scale;
+	} else {
+		//find environment with highest probability
+		for (int i = 0; i<available_env_len; i++){
+			float pred = output->data.f[i];
+			if( pred> max_value){
+				max_value = pred;
+				env_index_pred = i;
+			}
 		}
 	}
-	
 
 	ptr->index = env_index_pred;
 	ptr->probability = max_value;
 }
+#endif
+
+/*
+predict data sample
+cascade classifier (CASCADE): the first stage classifies the latest scan, only the data samples it is
+not confident about are predicted by the neural network
+*/
+void loop(const struct data_window *window, struct classification *ptr)
+{
+	ptr->provisional = window->scans <= DATA_ROWS;
+
+#ifdef CASCADE
+	uint32_t start = k_cycle_get_32();
+	int index = cascade_classify(data_window_row(window, 0), &ptr->probability);
+
+	stats.classifications++;
+	stats.first_stage_cycles += k_cycle_get_32() - start;
+
+	if (index != -1) {
+		ptr->index = index;
+		return;
+	}
+	stats.escalations++;
+#endif
+
+	model_loop(window, ptr);
+}
+
+const struct inference_stats *inference_stats_get(void)
+{
+	return &stats;
+}
+
+#ifdef MODEL_REGISTRY
+void loop_model(const struct data_window *window, enum model_id model, struct classification *ptr)
+{
+	//without the model loop() makes no prediction
+	select_model(model);
+	loop(window, ptr);
+}
+
+enum model_id model_select(uint32_t budget_cycles)
+{
+	//every model is tried before the costs are compared
+	for (int i = 0; i < MODEL_COUNT; i++) {
+		if (!model_stats[i].unusable && model_stats[i].invokes == 0) {
+			return (enum model_id)i;
+		}
+	}
+
+	int selected = -1;
+	int cheapest = -1;
+	uint64_t cheapest_average = UINT64_MAX;
+
+	for (int i = 0; i < MODEL_COUNT; i++) {
+		if (model_stats[i].unusable) {
+			continue;
+		}
+
+		uint64_t average = model_stats[i].total_cycles / model_stats[i].invokes;
+
+		//the models are ordered by accuracy, the first one within the budget is the most accurate
+		if (selected == -1 && budget_cycles != 0 && average <= budget_cycles) {
+			selected = i;
+		}
+		if (average < cheapest_average) {
+			cheapest_average = average;
+			cheapest = i;
+		}
+	}
+
+	if (selected == -1) {
+		selected = cheapest;
+	}
+
+	return selected != -1 ? (enum model_id)selected : MODEL_FLOAT;
+}
+
+const struct inference_stats *model_stats_get(enum model_id model)
+{
+	return &model_stats[model];
+}
+
+const char *model_name(enum model_id model)
+{
+	return models[model].name;
+}
+#endif
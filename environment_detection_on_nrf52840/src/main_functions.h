@@ -2,6 +2,10 @@
 #ifndef TENSORFLOW_LITE_MICRO_EXAMPLES_HELLO_WORLD_MAIN_FUNCTIONS_H_
 #define TENSORFLOW_LITE_MICRO_EXAMPLES_HELLO_WORLD_MAIN_FUNCTIONS_H_
 
+#include "scan_epoch.h"
+
+//scans in a data sample
+#define DATA_ROWS 5
 
 #ifdef __cplusplus
 extern "C" {
@@ -11,12 +15,93 @@ extern "C" {
 struct classification {
 	int index;
 	float probability;
+	bool provisional; //data sample is not complete yet, missing scans are filled with the latest one
+};
+
+//input values of the neural network: normalized feature values
+//raw input mode (RAW_INPUT): the model takes the int8 quantized values, normalization and
+//quantization are done in one step; the model output is int8 as well
+#ifdef RAW_INPUT
+typedef int8_t model_input_t;
+#else
+typedef float model_input_t;
+#endif
+
+//data sample: feature values of the latest DATA_ROWS scans in a ring of rows
+//the rows are normalized once when they are added
+//the first scan has no scan before it, the data sample is complete with DATA_ROWS scans after it
+struct data_window {
+	int newest; //row of the latest scan
+	int scans; //scans added since the data sample started, up to DATA_ROWS + 1
+	int raw[DATA_ROWS][DATA_RECORD_LENGTH]; //values as computed from the scans (see scan_epoch.h)
+	model_input_t normalized[DATA_ROWS][DATA_LINE_LENGTH];
 };
+
+//cost of the inference, to compare model variants (float or int8 input and output)
+struct inference_stats {
+	int arena_used; //bytes of the tensor arena used by the model
+	int arena_high_water; //bytes of the tensor arena written up to the latest Invoke()
+	uint32_t setup_cycles; //CPU cycles of setup() (per model: its latest tensor allocation)
+	int invokes;
+	uint32_t last_cycles; //CPU cycles of the latest Invoke()
+	uint32_t max_cycles;
+	uint64_t total_cycles;
+	bool unusable; //allocation of the model failed (MODEL_REGISTRY), it is not selected again
+
+	//cascade classifier (CASCADE)
+	int classifications; //data samples classified by the first stage
+	int escalations; //data samples the first stage left to the neural network
+	uint64_t first_stage_cycles; //CPU cycles of the first stage, all classifications
+};
+
 // Initialize neural network
 void setup();
 
-// Predict environment of given data sample
-void loop(int data_sample[230], struct classification *ptr);
+// Start a new data sample without scans
+void data_window_reset(struct data_window *window);
+
+// Start a new scan in the data sample, replacing the oldest one
+// return the row for its feature values, initialized with the values of the previous scan
+int *data_window_add(struct data_window *window);
+
+// Normalize the feature values of the latest scan, after they were written to its row
+void data_window_normalize(struct data_window *window);
+
+// Feature values of a scan (0: latest scan)
+const int *data_window_row(const struct data_window *window, int scan);
+
+// Predict environment of given data sample, index -1 if the neural network is not initialized
+// (CASCADE: the first stage is tried before the neural network)
+// the prediction of a data sample that is not complete is provisional
+void loop(const struct data_window *window, struct classification *ptr);
+
+// Arena usage and Invoke() cycles so far
+const struct inference_stats *inference_stats_get(void);
+
+#ifdef MODEL_REGISTRY
+//neural networks to select from per prediction (MODEL_REGISTRY), they time-share one tensor arena
+//sized for the largest; the more accurate ones come first
+enum model_id {
+	MODEL_FLOAT, //g_modelurd: float input and output
+	MODEL_RAW, //g_model_raw: int8 input and output, normalization folded into the input
+	MODEL_COUNT
+};
+
+// Predict environment of given data sample with the given model, loop() uses the latest one
+// selecting another model allocates it in the tensor arena (setup_cycles of its stats)
+void loop_model(const struct data_window *window, enum model_id model, struct classification *ptr);
+
+// Model for the next prediction: models that did not run yet are tried first, then the most
+// accurate one whose average Invoke() cycles are within budget_cycles, the cheapest one if none is
+// within the budget or budget_cycles is 0 (default INFERENCE_BUDGET: select by cost only)
+// models that could not be allocated are skipped (MODEL_FLOAT if none can, loop() makes no prediction)
+enum model_id model_select(uint32_t budget_cycles);
+
+// Arena usage, allocation and Invoke() cycles of a model so far
+const struct inference_stats *model_stats_get(enum model_id model);
+
+const char *model_name(enum model_id model);
+#endif
 
 #ifdef __cplusplus
 }
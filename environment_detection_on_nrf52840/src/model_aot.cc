@@ -0,0 +1,6938 @@
+//generated by tools/aot_model from g_model_raw (model_raw.cc), do not edit
+#include "model_aot.h"
+#include "aot_kernels.h"
+
+namespace
+{
+
+//sequential_153/sequential_152/dense_228/MatMul
+constexpr int8_t weights_0[52900] = {
+	29, 2, -31, 28, -14, 37, -13, -19, -55, 22, 4, 2, 11, 31, 19, 23,
+	29, 18, 21, 12, 4, 27, -22, 24, 29, -12, -10, 3, -31, -21, -5, -29,
+	1, 8, 11, -18, 20, -18, 20, 19, -31, 27, -25, 17, 31, -11, 10, 0,
+	17, 9, 32, 24, -26, -34, -47, 7, 14, 2, -24, -15, 28, -41, -3, 4,
+	7, -15, -23, 7, 30, 5, 12, 13, -4, 19, -29, 22, 14, 1, 2, -31,
+	-18, -4, -15, 17, 7, -28, 30, -14, 4, -14, 12, 5, 5, -40, 2, -13,
+	28, 35, 1, -20, -46, 26, 26, -8, -35, 33, -22, 17, -16, -3, -12, 18,
+	-4, -25, -14, 37, 32, -4, -20, 22, -20, 2, -5, 5, -29, -7, -28, -29,
+	-4, -7, 2, 15, 34, 0, -16, -28, -6, 30, 14, -10, -10, 35, 38, 27,
+	17, -28, -1, -25, 33, -21, -11, -15, -50, -10, 1, 9, 3, 15, -45, -40,
+	-24, -26, 15, -22, -5, -33, -25, 11, 5, -23, 2, 17, -14, -21, 31, -14,
+	-31, -32, -13, -7, -7, -12, -23, -14, 9, 11, -38, 21, 29, 1, -9, -22,
+	-26, 28, 1, 19, -29, -6, 7, 17, 20, -11, -9, 8, -51, -19, -53, -25,
+	28, 10, 33, -3, 23, -1, -4, 28, -27, 8, 35, -22, 9, -1, -23, 16,
+	16, -9, 23, 10, 19, 22, -13, 5, -45, 7, 15, 31, 44, -30, 10, 30,
+	13, -13, 26, -7, -19, -11, -57, 4, -18, 3, -55, -14, 35, 30, -30, -2,
+	-11, -29, 34, -14, 23, -22, 22, 13, 14, -1, -28, 23, 8, 25, -19, 5,
+	18, -22, 12, 9, 17, -45, -34, -26, 52, 29, 44, 13, 42, 13, 45, 40,
+	26, -32, 19, 24, -13, 54, -36, -8, -38, 11, 32, 26, 3, -25, -38, -28,
+	20, 12, -11, 7, 27, -21, -2, 1, 3, 13, 18, 25, 21, -23, -5, 30,
+	-12, 14, -18, -21, 34, -5, 3, -30, -22, -18, -31, 5, 21, 1, 18, 11,
+	1, 41, -45, 33, -14, 26, -61, 24, 43, -16, -8, -11, 2, -28, 12, -29,
+	32, 18, 5, 8, 26, 8, -9, 23, -17, 16, -15, -19, -26, 17, -29, -13,
+	-20, -20, 35, -69, 46, 31, 9, -38, -41, 39, 10, -44, 20, 17, -20, 20,
+	-40, 56, -31, 22, -36, 42, 11, -10, -10, -17, -34, 15, 24, 26, 7, 16,
+	-14, -9, 19, 9, -34, 31, -38, -14, -11, 29, 6, -2, -17, -26, -25, -31,
+	27, -41, 8, 12, 16, -22, -34, -16, -6, -57, -25, -3, 8, 24, 12, 49,
+	-28, 11, -50, 8, 15, 11, -18, 11, -14, 13, -17, -19, -18, -27, 16, 11,
+	-3, -18, -37, -32, -28, -3, 0, 4, -14, -5, 25, 14, 14, 6, 11, -2,
+	-27, 17, -23, 48, -24, -35, 45, -23, -28, 31, -7, -40, 20, -48, 29, 10,
+	-8, 14, 1, 14, -13, 25, -8, 5, 16, 30, -21, 6, -31, 24, 20, -24,
+	21, 10, 25, 29, 30, -4, -10, -32, 33, -5, -5, 10, 42, 42, -18, 12,
+	-15, 48, -2, -16, 31, 10, -40, 22, 5, 19, 12, 7, 40, -32, 8, 10,
+	20, 0, 24, -5, -9, 26, -23, 11, -5, 32, 25, -11, 26, -16, 27, -12,
+	7, 15, -19, 1, 5, 14, -13, 34, -24, 14, 12, 0, -15, 10, -38, 0,
+	12, 4, 49, -9, -29, 16, 38, -31, -18, -18, -18, 5, 32, 13, 2, -6,
+	1, 30, -17, 9, -18, 22, 13, 9, 28, 9, -1, 21, -27, -13, 7, 34,
+	-21, 24, 13, 19, 31, 28, 10, 17, 7, 32, 10, 24, 11, 24, -15, -10,
+	56, 7, -15, -25, 22, -34, -12, -15, 19, -35, -2, 18, 20, 13, -14, 33,
+	-11, -7, 5, 11, 14, -1, -22, 9, 27, -31, 33, 27, -7, -25, -19, 4,
+	-33, -8, 11, -6, 26, 22, -12, -16, -24, -16, -5, 51, -32, -22, 62, 1,
+	2, -23, -3, -27, -25, -13, -20, 4, -22, 4, -29, 14, -14, 31, 11, -10,
+	-27, 27, 19, -17, 4, 0, 10, 21, 7, 15, -16, -16, -32, 11, 13, 5,
+	-26, -6, 21, 29, 0, -39, -25, 51, -11, 9, -19, 10, -10, -14, 19, -23,
+	0, -9, -46, 18, -33, 16, 18, 23, 21, 1, -25, -17, 21, 7, -13, -32,
+	33, -21, -8, -15, -20, -7, 11, 26, -29, 10, 13, 18, -28, 24, 14, -4,
+	4, 22, 17, 19, -15, -3, -6, 42, 18, 40, -11, 30, -4, -29, -13, -34,
+	-21, 11, -3, 11, 10, 7, -18, -7, 34, -18, -26, -3, 21, -13, -15, 2,
+	-22, 31, -12, -25, -19, 10, 21, -19, 3, 22, -28, -16, -8, 24, 11, 7,
+	2, -33, -2, 46, -20, 9, -29, 25, -44, -4, -10, -3, 46, 20, -42, -12,
+	-43, -35, 28, 15, -33, 14, 23, -20, 21, 10, 20, -6, 2, -5, 6, 2,
+	2, 6, 18, 10, 8, -4, 27, 5, 12, 14, 22, -24, -19, -25, 17, -66,
+	-25, 51, -11, 48, 5, 38, -37, -6, 7, 10, 28, 24, -11, 10, -16, 4,
+	-4, 43, -23, -23, 11, -18, -21, -27, 18, 17, -1, -22, 6, 28, -33, 30,
+	31, -11, -25, 16, -8, -20, 28, 0, 4, -17, -14, 10, -43, -67, -40, 17,
+	17, 21, -26, 23, 21, -52, 1, 2, 37, -7, -27, 9, -37, -40, 32, 25,
+	16, 43, -5, 4, -7, 20, -25, 25, 4, 25, -14, -8, 12, -25, 11, -23,
+	23, -4, -29, -13, -15, 28, 13, -12, -13, 8, 11, -13, -26, 40, 9, -25,
+	21, 20, 43, 32, 7, -31, 2, 24, -17, -27, 19, -32, -32, 41, 49, 30,
+	13, -4, 16, -17, -10, -21, 32, -2, -25, -19, 22, -13, 22, -4, 2, 5,
+	15, 10, 26, -32, -28, 21, 18, -16, -5, -19, 31, 36, -23, 1, 14, -6,
+	8, -5, 37, -19, -32, -8, -12, 14, 18, 9, -40, -22, 24, -9, 14, -26,
+	29, -32, 30, 16, -27, -16, 4, -5, 14, -7, -21, -31, -29, 16, 3, -22,
+	-14, -17, -11, 13, 24, -29, 5, 5, -30, 37, 27, -18, -23, 35, -5, 10,
+	-23, -4, -37, -28, -58, 19, -29, 1, -26, -55, -28, -6, -23, 20, 19, -28,
+	12, -3, 25, -31, 7, 14, 31, 18, 7, -4, -34, -7, 14, 22, -32, -22,
+	10, 27, 16, -16, -31, -15, 8, 27, 0, 30, -12, 9, -1, -2, 18, -6,
+	-45, -13, -18, -44, 25, 15, -24, 17, 29, 35, 19, 20, 4, 6, 28, -17,
+	-11, -11, -19, 7, -14, -28, -18, 2, -26, 25, 28, 29, -14, 22, -12, -29,
+	-25, -30, -21, -10, -1, -14, -43, 12, 1, -1, 15, -1, 7, 13, -27, 5,
+	-15, 8, 22, -24, -53, 44, 41, -7, -3, 23, -4, -20, -21, 2, -21, -8,
+	-30, -6, 11, -27, 18, -22, 23, 0, -22, 11, -21, -2, 30, -22, -19, 39,
+	-15, -1, 9, -23, 10, 28, -23, 4, 16, 6, 50, 20, 1, -24, -19, -18,
+	14, 20, 9, -4, 12, 2, -15, -28, 33, -28, -12, -26, -21, -30, 3, 23,
+	-28, 27, 21, -33, -2, -32, 24, 23, 6, 17, 1, 8, 35, -13, 2, -42,
+	36, -9, -18, -18, 19, 6, 38, -27, 21, -24, 43, 26, 30, -14, -18, -24,
+	9, 21, -21, -22, 34, 4, 15, 22, 11, 24, 27, -30, 21, 8, -3, 29,
+	3, 27, -19, 32, 6, -31, -1, -13, 34, -25, 18, 22, 21, -17, -7, 18,
+	-37, -25, 35, 27, -13, 24, 21, 25, 65, -5, 1, 39, -19, -12, 5, -24,
+	16, -20, 8, 19, 7, 16, 23, 1, 9, -25, -1, -31, -14, -14, 21, 2,
+	35, -13, 11, 0, -21, -35, 24, 2, -19, -12, 22, -38, 2, 12, -27, 12,
+	50, 28, 35, 11, -15, 10, -4, 12, 9, -1, -27, -11, -34, 17, 39, -6,
+	29, 22, -4, 2, 7, -34, -31, -24, 23, -12, -25, 18, 22, -13, -11, -10,
+	18, -32, 8, -6, -8, 30, -35, -1, -32, -20, 31, -19, -5, 35, 17, -21,
+	22, -21, -28, 6, 14, -21, 39, -1, -38, -27, 18, -13, -17, 2, -17, 18,
+	-29, 15, 16, 27, 0, 6, 3, 9, 19, 2, -26, -7, -15, -16, 19, -31,
+	10, -10, 3, -26, -8, 0, 44, 4, -15, -68, 16, -49, 14, 41, -4, -31,
+	6, -11, 31, -34, 4, -23, 8, 9, -6, 15, -31, 24, 6, -11, -8, -3,
+	10, -4, 1, -28, -17, -6, 7, 11, -21, 32, -12, 20, 3, 3, -12, 15,
+	27, 14, 0, -29, 14, 9, 11, -39, 4, 1, -22, 40, 33, 18, -7, -27,
+	27, 20, 21, -8, -20, 34, -38, 27, -25, -5, -2, -31, -4, -1, 10, 11,
+	7, -27, 30, -16, -16, -30, -17, -22, 11, -8, 19, 4, 17, 32, 4, 19,
+	7, 17, 33, -17, -4, -54, -1, -46, 2, 28, -11, -28, 6, -21, 61, -13,
+	3, 0, -5, 8, 11, -40, 1, 2, -28, 23, -22, 18, -18, 24, 17, 22,
+	-25, 4, -16, 10, 4, -15, -3, 25, -14, 31, 30, 10, 25, -28, -20, 17,
+	-10, -18, -3, -18, -14, -20, 5, 17, 20, 8, 24, 26, 39, -6, -1, -26,
+	-17, 2, -10, -13, 6, -12, 25, 13, 14, -17, 7, 12, 10, -6, 12, 6,
+	6, -30, -15, -24, 14, -28, 29, 20, -25, -30, -27, -24, -28, -8, -21, -1,
+	1, -65, 1, -19, 16, 28, -23, 65, -4, 9, 12, 33, -1, 30, 27, 55,
+	37, 6, 63, 14, 21, 1, -13, 5, -18, 28, 12, 17, -31, 5, 23, -24,
+	-21, 16, -1, -22, 8, -31, -35, 31, -9, 27, 38, -24, 9, -71, -30, -3,
+	27, -14, -34, 0, -13, 15, 8, -10, 18, -18, 7, -3, -24, 5, 10, 34,
+	-11, 8, -15, 18, 8, -3, 12, 20, -26, 34, -31, -13, -1, -6, -12, 16,
+	-17, -7, 16, 23, -2, -19, -7, 9, 16, 4, 7, -78, 0, 18, -1, 4,
+	-1, 58, -9, -21, 63, 21, 21, -47, 18, 12, -10, -3, 4, 4, -10, -1,
+	-7, 14, -21, -2, 25, 32, -24, 4, -26, 4, -8, 31, -30, 15, 30, 7,
+	29, 9, -7, -12, 11, -3, 30, 8, -15, -73, -20, -23, 8, -32, 11, 31,
+	1, -1, 28, 26, 49, 2, 19, 16, -7, 14, -18, -19, -26, 19, -5, -24,
+	20, 2, 27, -17, 15, -1, -18, -5, 8, 6, 20, -5, 0, 34, 26, 22,
+	-14, -18, -31, -9, 44, -18, -18, -63, 35, 19, 0, 12, -38, 23, 28, 9,
+	31, 16, 22, -2, 56, 16, 38, 26, -32, -23, -10, -10, -35, 26, 14, 7,
+	-17, -14, -4, 27, 10, 7, -3, -6, -36, -5, 31, 3, -27, 28, 13, 3,
+	-33, -6, 47, 30, -16, -65, -10, -10, 54, 14, -31, -2, 15, 11, 45, 0,
+	45, -32, 12, 21, 1, -15, -12, 10, -39, -21, -29, 2, -2, 1, -27, 7,
+	6, -7, -5, -20, 7, 17, -30, -21, -4, 23, -35, -21, -12, 22, 5, 36,
+	3, 16, -1, -17, -36, 4, -14, 58, 16, 19, -18, -21, 12, -8, -4, 59,
+	-45, -3, 11, -7, 21, 33, -16, -11, -28, -4, -20, -5, -5, 12, 20, -23,
+	-25, 4, 25, -11, -8, 16, 17, -5, -6, -13, 23, -16, 5, -12, 0, 26,
+	24, -17, -8, 19, -1, 6, 26, 19, 23, 21, -27, -13, 37, 30, -39, -2,
+	4, -42, 49, -21, -25, -13, 5, 17, 30, 6, -7, 2, -6, -29, 2, 18,
+	-25, 5, 18, -25, -27, 32, -17, -1, -25, 23, 30, -25, -10, 31, 23, -30,
+	-31, -27, 5, 8, -7, 27, -4, 11, 17, -12, 31, 38, -2, -1, -22, -27,
+	13, 32, 3, 16, 13, -32, 25, 15, -1, 24, -14, 8, -32, 2, 14, 17,
+	18, -20, -3, -20, -12, 20, -12, -12, 6, 18, -36, 40, 15, -16, -10, 22,
+	41, 48, 14, 18, 38, -3, 20, 3, -6, 28, -35, -8, -17, -16, 60, 2,
+	34, 15, -12, -25, -2, -19, -17, -14, -3, -34, -1, 28, 31, -20, 12, 14,
+	13, -22, -26, -15, 25, 0, -18, 21, -27, -2, -30, -22, 17, -16, 46, 29,
+	-11, -25, -15, 19, 37, -10, 19, -6, -2, -50, -37, -53, 22, -6, -18, 6,
+	3, 20, -10, -30, 16, 28, 28, 15, 20, -4, 14, 10, 15, -27, -7, -25,
+	-5, -20, 5, -12, 19, -7, 32, 3, 7, -8, -8, 46, 21, -45, -8, 30,
+	-19, -38, 26, -32, -6, -43, -50, 36, -21, 26, -20, 1, 28, -30, -13, -20,
+	30, -14, -22, 19, -13, -29, 3, -20, 23, -20, 15, -24, -21, -15, 9, 11,
+	-22, -19, -29, -19, -5, -40, 12, 13, -8, -26, -23, -18, 6, 52, 3, 5,
+	44, 10, 0, -45, -25, 16, 13, -10, 2, -24, 10, -10, 15, -14, -4, 28,
+	11, 1, 10, 4, 30, -32, -33, 26, 29, 19, -8, 32, 11, -2, -23, -22,
+	-8, -27, -11, 23, 7, 30, -14, 14, 5, -47, -23, 48, -27, 22, 33, -7,
+	22, -22, 0, 20, 11, 32, -5, 10, -28, 2, 27, -16, -21, 7, -1, 17,
+	29, -19, -6, -13, -14, 23, 16, -8, 5, 3, 15, -14, 2, 9, -31, 17,
+	4, -4, -29, 21, 26, 20, -21, -2, -29, -7, -50, -9, 53, 30, -2, -12,
+	-16, -25, -6, 4, 21, -10, -25, -28, -14, 24, 22, -5, 25, -8, 17, 15,
+	-10, 25, -18, 14, 25, -20, -12, 18, -13, -9, -21, 9, -17, -19, -18, -22,
+	11, 24, -35, 37, -21, 13, -21, 2, -33, -10, 9, -4, 24, -26, 22, -4,
+	2, 5, -3, -10, 25, -28, 27, 7, -24, -30, 14, 9, 21, -8, -10, -32,
+	-31, 14, 22, 7, 31, 6, -10, 20, 9, -27, 2, 9, -9, -6, 20, 20,
+	-38, -29, 11, -1, -51, 40, -2, 7, -13, -4, -29, -27, -4, -30, -5, 23,
+	-14, 11, -28, -9, 26, -1, -3, 0, 10, -22, -35, -1, 14, -16, 9, -23,
+	2, -22, -38, 15, -33, 0, -14, 19, 25, 31, 3, 1, -3, 27, -25, -12,
+	9, 4, 30, 30, 28, 7, -8, 18, -22, 21, 21, -48, 6, -19, 28, -1,
+	0, -34, 4, 30, 18, 32, 3, -26, -6, 30, -7, -24, 20, -29, 2, 4,
+	17, 4, 3, -26, -24, -8, 18, 33, 29, -15, 12, 27, 4, -9, 40, -14,
+	11, 54, -13, 27, 6, 28, -27, -4, 35, -17, 14, -18, 15, 15, 7, 17,
+	-24, 2, -27, -25, 17, -15, 26, -31, -20, -24, 29, 21, 16, 9, 2, 23,
+	-13, 14, -31, -21, 11, -25, 23, -8, 13, 53, -52, -18, 31, 3, -18, 12,
+	16, -18, -14, -33, 27, -13, -36, -49, 19, 7, -18, 29, -36, -20, 3, -20,
+	15, -24, 23, 8, -1, -25, 31, 8, -9, 4, 45, 24, -3, 1, 22, -13,
+	-42, 26, -9, 29, -5, 38, -20, 10, -29, -36, -8, 31, 13, 9, 26, 27,
+	-43, -8, -2, -17, -8, -57, -1, -18, -14, 56, 15, 42, 19, -25, -20, -9,
+	18, 23, -28, 29, -32, 12, -14, -5, 36, -31, -34, -5, -12, 22, 1, 34,
+	8, 27, -26, 3, -4, 8, -63, -18, 6, -53, -5, 19, 26, 43, 34, -31,
+	-15, -73, 26, -57, 24, -7, 44, -8, -37, -3, -6, 4, 9, 21, -1, 27,
+	1, -21, 18, -34, -34, 4, 1, 2, -12, 26, 19, -14, -29, 23, 22, -19,
+	-7, 2, 4, -3, -51, 16, 19, -21, 26, 43, 8, -11, -21, -28, 7, -49,
+	-11, -61, 8, -1, 34, -11, -34, 12, -28, 30, 36, -14, 30, 26, 34, 30,
+	6, -7, -17, -27, 20, 5, -15, -12, -15, -20, 8, -8, 7, -33, -2, -10,
+	-6, 2, -38, 26, 14, -41, 5, 46, 0, 28, 27, 31, -27, -47, 28, -26,
+	45, 35, 24, 7, 25, -12, -26, 30, 25, -16, 0, -10, -29, 0, -25, -4,
+	-17, -17, -15, -7, 28, -23, 29, 28, -33, 30, 24, -29, -1, 19, -1, 20,
+	-8, 11, -40, -20, 21, 5, 9, 9, 3, 20, 24, -26, -4, -31, -24, 35,
+	15, 14, 6, 4, 26, 18, 27, -35, -1, -19, -14, 9, 23, 7, -10, 18,
+	42, -17, -29, -21, 24, -5, -18, 27, 17, 19, 4, 11, -2, 25, -27, -4,
+	-11, -46, 4, 16, -23, -13, -36, -26, -1, -36, -25, -26, -34, 4, 1, 1,
+	-34, -6, -15, -23, 35, 23, 23, 30, -2, 3, -20, -1, 14, -8, -20, 6,
+	21, 21, 25, 28, 23, 23, 16, -15, -26, -14, -16, -17, -10, 34, 4, -3,
+	-5, 9, 75, 17, 4, -1, 19, 20, 0, 24, 33, 68, 59, -17, 2, 23,
+	-34, 0, -24, 22, -24, -9, -34, -2, -1, 20, 30, -17, 16, -29, 37, -28,
+	4, -30, 9, 7, 11, 23, -17, 10, -39, 8, -7, 24, -23, 8, -24, -33,
+	72, 29, 2, 9, -30, -28, 21, -16, -15, 48, 20, 7, 53, 15, -1, -8,
+	23, -24, -25, 26, -31, 16, -7, -5, -30, -7, 10, -4, 45, 25, 17, -27,
+	16, -30, -10, 21, 15, -24, -30, 14, -4, -15, -47, 12, -8, -2, 66, -17,
+	-6, -13, 2, -14, -31, 12, 23, 25, 33, 19, -11, -3, -3, 19, -23, 21,
+	7, -29, -31, 14, 21, 7, 4, -4, -22, -6, 1, -25, -17, -5, -25, -30,
+	-7, 4, -16, 1, 1, 8, -8, -4, -28, -33, -16, -56, 68, -10, 8, -30,
+	-24, -16, 31, 8, 11, 14, 12, 1, 10, 4, 28, 23, 13, -14, -4, -5,
+	14, -30, 4, -26, 10, 30, 40, -18, 9, 26, 6, 15, -18, -5, 33, -20,
+	9, -35, 2, -7, -36, -41, -10, 1, 41, -42, 55, -15, 14, 19, -51, -16,
+	10, 8, 45, 21, 15, -2, -18, -3, -4, 15, -16, 10, 1, -33, -27, -8,
+	32, -25, -13, 20, -17, 4, 22, 6, -11, 7, -29, 8, 3, -32, -13, 6,
+	32, 31, -2, -19, -41, -19, -30, 10, 24, -11, 12, -21, 27, 10, -13, -72,
+	-41, -53, 48, 38, -22, -27, 30, -20, 27, 27, 3, -12, -8, 20, 23, 8,
+	-5, 33, -7, 20, 22, -14, -24, -30, -40, -3, -7, -13, 24, 14, -4, -11,
+	-15, 0, -23, 2, -23, -17, 21, 5, 42, 16, 18, -7, 10, -49, -9, -52,
+	11, -15, -11, -9, 17, 8, -15, -28, -11, -7, -25, -27, 20, 0, -12, 12,
+	-20, -11, -17, 3, 21, 9, -32, 29, -29, -22, -12, -13, -27, 6, 0, 13,
+	39, 31, 18, -26, 66, -7, 37, -7, 20, 36, -2, -48, 37, -77, 4, 1,
+	-5, -4, 4, 25, 9, 6, -20, -8, -22, 30, 22, 15, -36, 30, 27, 20,
+	-28, -8, -35, -26, -4, 26, -22, 14, -8, -17, 2, -2, 8, 21, 17, 30,
+	39, 7, 13, -2, 0, 3, 18, 3, 31, -87, 6, -82, 18, 12, -7, 16,
+	-17, -10, -2, 13, -15, 4, 1, -20, 22, -21, -19, 6, 20, -25, -24, 6,
+	20, 1, -27, 13, -34, 21, 2, -25, -9, -18, -12, 4, -24, 11, 39, -8,
+	70, 9, 11, -10, 26, 8, -10, -67, -14, -71, 14, 22, 32, -23, 2, 32,
+	11, 13, -35, 22, -6, 29, -24, -21, 8, 24, -5, 29, 3, 21, -11, 9,
+	0, -12, -11, -1, -23, 16, 8, 34, -13, -19, -1, -24, -35, -27, 20, 40,
+	-28, -30, -77, 26, -29, -12, -1, -32, -15, 2, 12, -12, 22, 22, -5, 18,
+	-31, 12, 18, -11, -14, -19, -15, 15, -23, 24, -20, -2, -19, -22, -35, -18,
+	-35, -6, -21, 0, -10, 19, 15, -8, -46, -1, -22, 1, 55, 35, -30, -14,
+	-61, 13, -26, -24, 17, -30, -11, 16, 28, -4, 1, -21, -14, 6, -5, 7,
+	26, -19, -21, -22, -21, 30, -32, -14, -26, -20, 10, 36, -10, 4, 6, -14,
+	5, 28, 1, 41, 27, 24, 16, 30, -20, -12, 48, 50, -42, -24, -51, 44,
+	-12, -24, 36, -42, -20, 17, 9, 9, -6, 24, 24, -2, 10, 0, -8, 8,
+	11, -25, -26, 21, -21, 4, 6, 5, 9, -14, -20, 12, 10, 22, 21, 24,
+	40, 4, -12, 24, 7, -3, -4, -14, 45, 20, 19, 10, -17, 54, -22, -63,
+	24, -53, -15, -7, -18, -17, 17, -25, -20, 33, -19, 23, 7, 25, -13, -7,
+	9, -24, -18, 3, 7, -22, 3, 1, 8, -15, -35, 3, -17, 20, 6, -30,
+	-4, 14, -12, -41, -36, -27, 27, -6, -25, -30, 29, 6, 16, -27, 0, -51,
+	-9, -8, 9, -5, -19, -4, -14, -27, -34, 28, -12, -6, -17, -22, -16, -1,
+	-13, -28, 16, 19, 0, -20, -23, 7, -37, 14, 36, -20, -10, -36, -49, 24,
+	-38, -37, -16, -17, 28, -35, 30, 29, 29, -7, 1, 19, -66, 43, 10, 31,
+	-34, 24, 7, -8, 9, -9, 8, 10, -16, 4, 16, -5, -20, 24, -6, -9,
+	-1, 28, -8, -22, 11, -19, -36, 22, 18, 2, -15, -46, -15, 7, -17, -15,
+	-57, -20, 78, -42, 13, 8, -24, 25, 23, -4, -34, -15, -1, 30, -16, 16,
+	7, -17, 24, -4, -4, 28, -27, 30, 34, -26, 13, -17, -17, -1, -26, -30,
+	-14, 3, 10, -9, 14, 2, 19, -31, 42, -16, -22, 23, -11, -53, -23, 4,
+	35, 0, 23, 1, -16, 26, 40, -26, -9, 11, 0, 19, -25, -1, -12, 11,
+	4, 11, 4, -27, 11, 23, 2, -14, -42, 20, 1, 30, -29, 25, 4, -2,
+	12, 30, -5, -23, 2, -12, 4, -34, 7, -14, -27, -20, -39, 4, 55, -29,
+	47, 6, -3, 9, 27, -43, -6, 34, -29, 10, 3, -4, -31, 14, -17, 8,
+	5, 15, 1, -6, -12, -31, -20, 2, 9, -11, -10, -21, 0, 0, -14, 26,
+	-10, 7, -23, -9, 22, -15, -28, 1, -51, -58, -70, -29, 37, -50, 19, 2,
+	3, 47, -12, -1, -36, 37, -13, 6, -40, 44, -30, 13, -8, -14, -29, -31,
+	-9, -28, -1, 22, -30, 11, -10, -20, -33, -25, 7, -2, 13, 6, -24, 6,
+	-14, -21, -35, 16, 32, 19, 41, 34, 18, 23, -25, 10, 15, 27, -10, 22,
+	18, 42, 12, 19, 4, -12, 25, 9, 10, -11, -13, 0, -29, -20, 31, 28,
+	-20, -9, 2, 12, -4, 14, 23, -4, -28, 12, -2, 32, 26, 32, 9, -24,
+	-6, 26, 30, 16, 29, -9, 25, -9, -5, 29, 22, 30, 20, 10, -11, 24,
+	10, -4, -4, -14, 46, -21, -30, 6, 10, 32, 27, -28, -12, -3, 32, 8,
+	-6, -21, -13, -28, -1, 6, -25, -28, 3, -14, -6, 0, 20, -17, -34, 43,
+	-1, -8, 14, 20, 30, 47, 17, 47, 16, 6, 17, 10, -5, 49, -22, 32,
+	-10, 10, -13, -22, 3, 13, 2, -8, 26, 18, 23, 0, 33, -3, 0, 0,
+	-33, 18, -27, 3, 29, -2, 13, 23, 15, -2, 1, -36, -3, 24, 43, -14,
+	33, -27, 1, 36, -7, 43, 10, -10, -5, -11, -13, 2, -16, -19, 6, -9,
+	-21, 6, 17, 21, 9, -13, 24, 8, 10, 20, -17, 1, 31, -8, -20, 28,
+	5, -28, -31, -13, -31, 6, -13, 1, 11, -2, -21, 39, 36, 7, -11, -3,
+	28, 38, 3, 58, 35, -23, 54, 22, -36, 38, -14, 5, -14, 14, -22, -32,
+	-16, -23, -7, -21, 2, 5, -8, 27, -17, 17, 9, 24, -20, 1, -28, -27,
+	30, -18, 28, -23, 28, -9, -36, -5, 18, 61, -35, 3, -26, 46, -22, -5,
+	-38, -16, 53, -18, -11, 34, 1, 9, -2, -20, -34, -4, 10, 11, -7, -29,
+	23, 14, 1, -4, 21, -19, -9, 28, -21, 26, 15, -27, -15, 1, -9, 22,
+	2, 16, 21, 7, 0, 10, 6, 50, -21, 23, -2, 33, -41, -38, -19, -16,
+	54, 22, 28, -2, -11, 9, -31, -6, -16, 16, -30, -30, 28, 12, 1, 6,
+	27, 26, 1, 10, 29, 2, 0, 23, -2, 22, 26, -28, -20, 5, -7, -13,
+	-31, 33, -45, -16, -26, 28, 27, 5, -41, 12, 26, -18, -28, -28, 17, -7,
+	21, -26, -29, -34, -12, -27, 19, 9, 26, -8, -28, 0, 17, 23, 5, 8,
+	-14, -25, -19, 32, 10, 7, -10, -11, -22, -21, 23, 1, 19, -23, -17, 10,
+	-37, -6, -31, 61, -2, -35, -15, 16, -38, 18, -27, -47, -12, 20, -28, -8,
+	13, -40, 25, 7, -30, 15, -16, -21, 31, 1, 26, 1, -6, -22, 24, 4,
+	3, -3, 28, 12, -29, -12, 13, 22, -19, 2, -31, -10, -5, -21, 5, -5,
+	-7, 38, 9, -5, -26, -8, 20, -44, -22, -16, 6, 20, -28, -12, -4, 2,
+	34, 32, -16, 23, 8, 2, -22, -2, 27, -29, -8, -27, -11, -32, 20, 33,
+	28, -18, 4, -19, -4, 18, 15, -30, 6, -29, -14, -8, -18, -27, 0, 1,
+	-24, 25, 1, -2, 28, -21, 41, 45, 0, -41, -47, -22, -19, 17, -28, -24,
+	-15, -21, 4, -21, 17, -11, 33, -32, 1, 24, -14, -26, 17, -2, -27, -31,
+	17, 14, 28, 19, -24, 3, 19, 23, -12, 21, 11, -21, 17, 26, -8, 10,
+	-11, -15, 18, -34, -4, 33, 23, 20, 10, -3, -25, -1, 16, 2, -12, -15,
+	15, -13, -1, 17, 17, -34, 17, 1, -5, 7, 30, 29, 25, -22, 29, 29,
+	-13, 2, 12, 8, -21, 19, 33, 1, -10, -40, -30, -24, -31, -14, -1, -25,
+	-7, -39, -13, 50, 8, 0, 6, -37, 8, 36, -4, -36, 12, 14, 27, -1,
+	14, -8, 34, 12, -25, 10, -26, -6, 33, 29, 35, 13, 16, -14, -1, -32,
+	24, -28, 37, 24, 9, 29, -15, 22, -21, -18, 24, 0, -28, 18, 6, -46,
+	26, -7, -10, -14, -13, -45, -2, 33, -3, 12, -3, -22, 19, 5, 33, -5,
+	20, -29, 9, 21, 16, -4, 34, -7, 12, 14, -24, 6, 19, 21, -9, -19,
+	29, 21, 10, -30, -18, -1, 3, -22, 10, 9, 15, 13, -27, -34, -11, 25,
+	-27, 28, -22, 13, -5, -4, -2, -5, 13, 6, 35, 30, -24, 19, -2, 28,
+	-7, -5, -22, -30, 0, -18, 2, -29, -21, -1, -5, -23, 21, -20, 29, 1,
+	-21, 5, -46, -7, -58, -10, -26, 37, 24, 21, 9, -23, 31, -6, 45, 12,
+	-4, 5, -16, 12, -17, 15, -28, -24, 59, 6, -7, 32, 12, 34, -5, -9,
+	17, -16, 32, -29, 15, 3, -21, -15, -9, -24, 33, -23, -11, -8, 10, -25,
+	-12, 8, -35, -53, -11, -21, 20, 15, -18, -13, 5, 20, 12, 19, -14, -14,
+	29, 30, -9, -13, -8, -36, -13, 46, 6, 5, 14, -22, 13, 4, -17, -15,
+	24, 32, 0, -4, -26, -18, 5, -4, 18, -19, 22, 12, 10, -22, -40, -16,
+	2, -20, -1, -11, -8, 0, -18, -28, 57, -29, -1, 0, -17, 1, 24, 11,
+	-10, 30, -46, -30, 36, 46, -3, -26, 18, -7, 11, -28, -24, -3, -25, 29,
+	20, 21, -15, 4, 6, -8, -13, 16, -6, 26, 11, 2, -31, 9, -35, -30,
+	-48, -10, 34, -2, 9, -6, 26, 31, 12, -1, 35, -20, 36, -22, -23, -15,
+	-13, -33, -1, 17, 20, -16, -23, -8, -2, 6, 8, 11, -22, -3, -3, 8,
+	20, -8, -18, -31, 16, 12, -13, 25, 29, 6, 21, -18, -25, -30, -57, 34,
+	48, 27, -14, -8, 67, 23, 34, -8, 22, -31, 19, -24, -34, -23, -63, 15,
+	19, -12, -22, 30, -24, 30, -10, -27, 18, 21, -25, 0, 24, -27, 4, 17,
+	-17, 6, -21, -19, 23, -20, -7, -3, -1, -20, -18, -11, 19, 36, -18, -22,
+	-5, -6, 22, -5, 18, 30, 31, -28, 20, -14, -13, -65, 2, 19, -13, 26,
+	17, 7, 25, 27, 7, 5, 20, -13, -27, 26, 9, 15, -10, -11, -3, 12,
+	-13, 14, -20, -6, -28, 11, 21, -11, -26, 21, 55, 15, -16, -21, 5, -31,
+	14, -5, -22, 4, 33, -39, -29, -23, 19, -43, -47, 21, 4, -22, 13, 21,
+	7, 17, 28, -31, 26, 18, 26, 2, -20, -9, 17, 11, 7, 28, -11, -7,
+	-9, 30, 6, -10, -23, -20, -54, 36, 34, -32, -6, -4, 2, -3, 36, 29,
+	-1, -13, 10, 3, -26, 28, -14, -47, -9, -6, 3, 4, -15, 6, -15, -10,
+	-9, 4, 7, 9, -7, -16, -2, 22, 17, -27, 18, 6, 15, -32, -16, 7,
+	26, -21, -12, -14, -47, 24, 23, -11, -17, 6, -14, -28, 51, -9, -6, -34,
+	11, 21, -14, 11, 0, -65, -19, -1, -17, -6, 29, 29, 5, -19, 3, 2,
+	31, -15, -11, -9, -12, 17, 6, -2, 18, -10, 30, -17, 17, -24, -7, -24,
+	26, -48, -41, -5, 36, 9, 28, -1, -13, 0, 11, 6, -31, 17, 37, 5,
+	-45, -11, -34, -52, -26, -1, -19, -36, -5, 1, 17, -32, -8, -33, -4, 7,
+	28, 14, 2, -32, 16, 27, 5, 21, 15, 10, -27, 18, -12, -33, 27, 39,
+	-16, -3, 29, -16, -19, 29, -22, -13, 20, -23, -29, 17, 22, -9, -9, -7,
+	-4, -57, 2, -24, -4, -36, -6, -28, -29, -20, -17, 10, -17, -5, -23, 34,
+	31, 6, -11, 21, 33, -18, 16, 28, 6, 4, -8, -23, 8, -8, 21, -9,
+	16, -15, 5, 1, 24, -22, -27, -33, -1, 2, -9, -14, 2, 6, 22, -34,
+	-9, 36, -15, 27, -2, 31, -23, -4, -27, 6, 13, 22, -28, -17, 16, 28,
+	21, -7, -16, 33, -14, 32, 29, -11, -24, 10, -17, 13, -3, 8, 42, -23,
+	31, 5, 14, 7, -7, 18, 3, 34, 21, 0, -11, 33, 22, 18, -12, -37,
+	-7, -2, -30, -15, -27, -20, -6, -18, -31, 16, 10, 18, 17, 13, -20, 4,
+	23, -26, -36, 19, -33, 13, -33, -3, -5, -18, -25, -11, 42, 19, 36, 17,
+	-16, -1, -6, 0, 11, 25, -31, 2, 25, 22, 10, -25, 48, -26, -42, 0,
+	-20, 13, 29, -18, -29, -30, 27, 16, -16, -2, -14, -8, 5, -16, 28, 6,
+	-31, -27, 26, 34, -16, 8, -10, 41, -17, 4, -2, 23, 34, -3, -6, -21,
+	-26, -10, -10, -24, 3, -36, 6, 13, 33, -44, -23, -26, -14, 1, -9, 33,
+	23, 13, -6, 32, 7, 29, -25, -18, -16, -9, -26, -26, 27, 18, -6, 26,
+	-27, -7, 1, 20, 26, -5, -4, 8, 4, 37, 12, -40, 6, -7, -43, 47,
+	-51, -15, -44, -21, 11, 23, -5, -10, -21, -23, -31, 24, -22, -23, 8, -19,
+	21, 15, -4, -5, -16, 9, 24, 26, -33, -13, 10, -19, 5, -15, -30, -30,
+	-3, -31, 38, -31, -18, 8, 10, 13, 52, 2, -1, 31, -45, 38, -48, -14,
+	-33, 3, 5, 19, 14, -28, 25, -7, -7, 26, -2, -23, 1, -4, -20, 8,
+	-7, -30, -4, 17, -12, -10, 8, 1, 17, -4, -3, -21, 26, 8, 22, -7,
+	18, 16, 27, 8, 33, 34, 17, -13, -39, -36, -6, 38, -35, -9, -23, 24,
+	-16, 23, -8, 26, 11, -15, -4, 32, 1, -4, 3, 2, -25, 26, -1, 20,
+	21, 3, -26, 12, -26, -7, 14, 17, 18, 17, 1, -24, -28, 4, 23, -7,
+	-36, -31, 44, 10, 8, 1, -13, -12, -51, 16, -28, 15, 0, 25, 4, -7,
+	18, 23, 6, 3, 29, 37, 2, 2, -35, 32, -10, -17, 1, -19, 24, -30,
+	20, -25, 27, -31, 1, -27, -3, -31, 15, -27, -17, -12, 35, -23, 27, -3,
+	43, 30, -8, -28, -29, -31, -48, 27, -1, 7, -17, 16, -16, 11, 19, -11,
+	-18, 13, 62, -31, -22, 2, -3, -29, -28, 21, -26, 24, -30, 13, -13, -20,
+	24, 1, -32, -15, -19, -27, -30, -24, -16, -29, -2, -11, 50, -5, 33, -6,
+	-16, 2, 11, -16, -36, -18, -57, 36, -40, 27, -22, 11, -22, -42, 2, -14,
+	2, 22, 15, 16, -3, -3, 23, -33, -13, -11, 24, -4, 28, -16, -25, -10,
+	34, -32, 18, -9, -22, 28, -11, 2, -11, 41, 40, -29, 23, -29, -25, -35,
+	1, 30, -59, 33, -25, -8, 27, 61, -26, -27, -21, 3, 7, -29, -38, 24,
+	-27, -23, 14, 7, 13, 15, 23, -24, 26, 24, 9, -21, -29, -31, -14, 16,
+	21, -33, -5, -1, 4, 9, 20, 31, 17, 28, 30, 6, 11, 17, 15, 3,
+	-76, 35, -42, 19, -24, 51, -3, -12, -18, -7, -37, -22, 12, -34, -22, -12,
+	-23, -20, 32, 29, -1, 33, -11, -8, -23, -21, 30, -2, -18, -8, -21, -21,
+	-23, -12, -6, -32, 24, 34, 42, -29, -7, 2, -8, 4, -20, 3, -23, 13,
+	-21, 32, -6, 47, -10, -2, 2, -5, 12, -29, -12, 33, 9, -29, 2, 18,
+	26, 24, 21, 7, 10, -25, 3, 21, 31, -7, 24, -27, 22, 10, 4, 19,
+	29, -28, 15, 8, 53, 41, 0, -9, 11, -28, 6, -14, -81, -14, 13, 11,
+	23, 33, 13, 6, -30, -10, -21, -45, -17, 8, 35, -9, 30, -20, -28, -31,
+	-1, -15, -25, -29, 0, 20, -20, 28, -6, 21, 2, -14, 31, -16, -20, 13,
+	11, -32, 9, 30, -29, 69, 21, 2, 12, 12, -8, 33, 8, -29, -59, -3,
+	-11, 20, 3, 36, 25, 10, -3, -32, -16, -13, 19, -16, 10, 4, 26, 27,
+	-10, -31, 23, 9, 16, -20, -16, 27, -12, -30, 13, 19, 17, 23, -27, 8,
+	-30, -8, 13, 50, 12, -29, 22, 37, -2, 9, 4, 4, -53, 43, -24, 7,
+	-14, 18, -29, -1, -21, 33, -25, 15, -36, -8, 15, 33, 9, 7, -36, 27,
+	10, -18, -25, 9, -3, -5, -7, -12, 24, -22, 23, -25, -11, -4, 12, 61,
+	-14, 19, -28, 8, -23, 63, 7, 26, 9, -15, -48, 14, -30, 49, 11, 13,
+	-4, -21, 15, -33, -7, -1, 27, 7, -23, 15, -19, -12, -20, 1, -2, 28,
+	-12, 6, -35, 29, -20, 25, 2, -11, -25, 11, -20, -32, -22, 40, 9, 57,
+	-17, 0, 37, 54, -19, 66, -23, 26, -30, 20, -21, -5, -12, 16, 1, 4,
+	-9, 18, 18, 4, 20, 10, -24, -26, -4, 4, -19, 23, 32, -23, -12, 26,
+	-23, 19, -15, 15, -18, -21, -26, 3, 15, -14, -51, 49, -16, 33, 8, -33,
+	27, 49, 0, 24, -30, -29, 7, -1, 8, 56, -24, 64, 55, -21, 22, 13,
+	16, 31, -7, 28, 22, -31, -29, 19, 17, -20, -24, 16, -37, -11, -33, 29,
+	-18, 34, 29, 7, 16, -15, -23, -16, -52, 39, -43, -61, 7, -2, -48, 0,
+	-11, 31, -22, 4, 38, -26, 4, -8, -21, 45, -17, -1, 19, -13, 18, -17,
+	2, 35, -31, 3, 22, 19, 17, 16, 3, 15, 36, -10, -3, 26, 18, -6,
+	14, 28, -8, 31, -14, -53, -20, 20, -54, -30, 29, 15, 8, -6, -33, 31,
+	-23, 8, 10, -46, 12, -14, -12, 6, -11, 8, 31, -16, -3, 21, -16, -29,
+	-23, -10, -20, 32, 25, -9, -16, -27, -15, -17, -25, -23, -21, -16, 20, -18,
+	-28, 12, 25, -6, -33, 47, -19, -38, 22, -26, -3, -40, 1, 4, -29, 43,
+	-40, -14, 20, -36, -2, 31, -31, -4, -4, -15, 1, 31, -5, -24, -14, 16,
+	-28, 37, -36, 33, -30, 7, 19, -12, 34, 21, -28, -6, -7, 31, -6, 37,
+	16, 0, -26, 28, -46, -39, 37, -24, -38, -42, -38, -4, -1, 39, 24, -18,
+	-32, -20, 0, 15, -17, -5, 6, -1, 4, -17, 29, 1, 10, -20, 13, 3,
+	-38, 3, 16, 2, 8, 2, 10, -19, -9, -23, 1, -29, -25, 29, -23, -22,
+	-36, -6, -43, -26, 52, 34, 11, -1, -17, -24, -1, 38, 5, 6, -35, 0,
+	-10, 6, -29, -2, 5, 1, -28, 6, 22, 31, 11, 14, -32, 29, -24, -21,
+	-14, -4, -12, 35, 10, 25, 7, 20, 15, -25, 6, 6, -29, -61, -19, 14,
+	13, 57, -14, 16, 23, 49, 0, -19, -6, -42, 59, 42, -14, 6, -45, -11,
+	39, 3, -10, 2, 5, 16, 5, 29, 6, -10, 0, 10, 34, -5, -8, 13,
+	-13, -6, 19, -27, 15, 10, 36, -24, -16, 0, 8, -32, -24, -7, -25, 81,
+	-3, 59, 37, 42, -10, 27, 9, -12, 11, 71, -51, -16, -18, -18, 48, 0,
+	-21, -27, -11, 14, -37, 18, -22, -18, 1, -11, -30, -25, 29, -17, -33, -1,
+	-17, -6, 26, -33, -25, -13, -34, -33, -41, -5, -3, 27, -36, 45, 26, 54,
+	41, 47, -5, -20, -48, -27, 7, 45, -31, 61, 14, -1, 46, -6, -53, -19,
+	-1, -18, 28, 21, 28, 5, 29, -6, 19, 0, -4, -2, -9, -18, 15, -13,
+	-24, -27, 7, -17, 30, 20, -37, -19, -12, 5, -12, 49, -14, 25, 4, 1,
+	15, -7, -22, -49, 25, 32, -13, 21, -38, -29, 39, 16, -30, -25, -3, 13,
+	11, -29, -10, -3, 11, 12, -1, 14, 4, 19, -15, 6, -27, 5, -31, -18,
+	-17, -11, 7, -21, 0, 12, 32, -4, -33, 40, -6, -17, 11, 62, -17, 53,
+	-40, 6, 37, 28, -19, 42, 22, -14, 44, -6, -44, -40, -28, 0, -30, -3,
+	-28, 25, 15, 16, 20, 18, -21, -29, 0, 16, -33, -5, -8, -22, -21, -31,
+	25, -23, 1, 7, -39, -50, 2, 15, 11, 10, -24, -8, 20, -18, -23, -1,
+	4, 17, 17, 16, -13, 0, -3, 14, 20, 19, -23, 34, 27, 30, 3, -8,
+	6, 3, -26, 12, -14, -4, -8, 33, 28, -1, -17, -29, 9, -21, 8, 25,
+	-19, -9, -12, -41, 4, -10, 4, -24, -5, 14, 20, 5, -10, 12, -4, 18,
+	9, -11, 25, -26, 47, -4, 43, -1, 27, -9, 27, 0, -24, 12, -34, -29,
+	29, -15, -9, -30, 23, 26, 12, -18, -7, 8, 23, 19, -32, -25, 4, 12,
+	-19, 23, 15, -8, 20, 22, -9, 28, -4, 8, -41, -23, 31, 21, -14, -14,
+	-23, -34, -28, 44, -19, -20, 5, 28, -2, -23, -19, 6, -14, 25, -3, 13,
+	27, 5, -15, -12, -24, 29, 14, 15, 21, -32, 2, -15, 7, -25, 7, -7,
+	-21, -5, -7, -11, 6, 12, 31, -5, -23, 25, 1, -33, 17, -49, 10, -29,
+	26, -10, 42, -22, 23, -8, 3, -9, 30, 23, -7, -10, -23, 18, -14, 30,
+	-9, 24, -18, 23, 14, -15, -18, -3, -27, 8, -19, 8, -30, -17, -23, -40,
+	6, -20, -4, -28, 34, -31, 20, -33, 18, -15, -7, -47, 12, -4, -38, -6,
+	-5, 10, -13, -3, 7, 5, -13, -26, 3, -7, -26, 26, 24, 26, -10, 29,
+	-10, 27, -17, 30, -14, 21, -12, -12, -36, 15, 22, 11, 2, -1, -75, -8,
+	-85, -13, 5, 25, -23, 26, -4, 74, -28, 31, -28, -48, -6, -7, -19, 30,
+	9, -25, -16, 13, 14, -12, 22, 3, -11, 17, -7, -17, -25, 12, -40, 7,
+	31, -21, -41, -26, -32, 21, -48, 9, 35, -28, -7, 3, -77, 23, -31, 31,
+	-16, 23, -4, -11, -26, 53, -10, 16, -28, -13, 34, 9, 5, -11, 13, 19,
+	-21, 19, 33, 14, 34, -16, -28, -15, 15, 25, -22, 12, -15, 9, 26, -4,
+	-2, 20, -4, -21, -45, 19, 25, 18, 5, 10, -16, -21, -17, 4, 8, 29,
+	-23, 18, 3, 36, 0, 20, -20, -27, 6, 5, 2, 43, -22, -23, 2, -26,
+	-26, 33, -11, 33, -11, 27, -24, 9, -32, -1, 16, 32, 10, -23, -40, 30,
+	-22, 21, -32, 6, 50, -19, 17, -30, -21, 33, -27, -15, 21, -20, 35, -8,
+	3, 22, 14, -3, -46, -57, 22, -9, -1, -1, -18, 13, 6, 19, -6, -1,
+	27, 0, -8, -23, 3, -26, -30, -26, -2, 23, 2, -1, 10, -30, -2, -27,
+	-39, -13, 40, 0, 10, 2, -52, 22, -7, 4, 15, -5, -22, -12, 16, 75,
+	-21, 9, -34, -68, 31, -31, -13, 34, -20, 8, 11, 21, 30, -20, 14, -19,
+	23, 24, 0, -11, 9, -26, -6, 11, -8, -1, -1, -11, 0, 2, 28, -35,
+	23, -10, -3, 37, -10, 1, 68, -1, 9, 21, 15, 24, 3, -21, -19, 19,
+	-33, -15, 54, -24, 36, 37, -3, 30, 0, -30, 23, 23, -3, 31, -26, 30,
+	19, 10, -10, 29, -11, -29, -12, -24, 21, -9, -31, 30, 12, 1, -5, -15,
+	6, 12, -18, -47, 25, 32, 24, -25, -4, -5, 46, -15, 17, 17, 18, -45,
+	24, -20, 18, 28, 2, -22, -6, 28, 7, 11, -22, -25, 33, -31, -3, 15,
+	-3, -2, 13, 14, 29, -21, 23, -2, -29, -15, -22, 28, -33, -61, 37, 33,
+	-17, -37, 26, -18, -23, -3, -42, -5, -19, 11, 29, 4, -26, 9, 23, -3,
+	-12, 15, -3, -9, 23, 23, -20, 7, -6, -33, 29, 24, 9, 9, -3, 13,
+	-11, -29, -2, 10, -20, -18, -7, -23, 31, 7, -21, -56, 31, 44, -28, 15,
+	53, 13, 24, 31, -3, -8, -8, 31, 28, -35, 16, -65, -22, 2, -10, 8,
+	-1, -28, 27, 5, -29, 8, 14, -2, 31, -10, -12, -7, -31, 18, -3, -16,
+	34, -30, -17, 28, 11, 9, 41, -19, -30, -66, 28, 23, -26, 13, 33, 29,
+	-3, 41, -28, 14, 7, -19, 15, -27, 2, -43, 9, 13, -5, 49, -17, 31,
+	-2, -33, -2, 25, 13, -27, 23, -31, 13, 24, 30, 9, 22, -17, 16, 15,
+	30, -18, -18, 29, -19, 20, 14, -16, 5, -8, -24, 24, 13, -21, -18, -36,
+	-11, -9, -8, -27, 16, 7, 1, 11, -7, 23, 6, 0, 16, 22, 19, 23,
+	-30, -8, -26, 28, -29, -29, 9, -11, -27, 19, 42, -1, -18, -7, -20, 23,
+	-26, 4, 11, 30, -23, -20, -17, -3, -19, 46, 26, -50, 15, -25, 20, -37,
+	14, -28, -19, 0, 26, 0, -5, 49, -25, -20, 7, -4, 37, 13, 21, 24,
+	30, 28, -3, -8, -15, 12, -14, 28, -4, 17, -26, -27, 9, 21, 24, -22,
+	36, 27, -20, 5, -42, -11, -3, -5, 1, -46, 17, -25, -23, -32, -22, -18,
+	-3, -31, -9, 13, -12, 33, 27, -51, -12, -29, 35, -26, -1, -33, -7, 17,
+	27, -14, 4, -14, 27, -10, -8, 24, 7, 27, 21, 20, -11, 16, 36, 15,
+	-21, -3, -31, 43, 7, 6, -29, -8, 31, 9, 18, -21, 19, -29, -23, -9,
+	16, 18, -35, 31, 7, -65, 16, -32, -25, 4, -27, 23, -27, 5, 26, -11,
+	27, -8, -13, 19, 16, -9, 14, 0, 33, -9, 0, 15, 2, 0, -13, 13,
+	-42, 8, 2, 18, -32, -25, 18, -33, 3, -6, 8, 16, -7, -6, -23, 1,
+	-45, 28, 3, -4, 12, 3, 18, 11, 18, 5, 25, 19, -1, 4, 31, -20,
+	-19, 29, 16, -14, 2, 29, 33, -5, -9, -20, -4, -29, -41, -38, -19, 1,
+	5, 22, -28, -50, -43, 1, 8, 8, -13, 19, 3, -4, -9, -11, 2, -4,
+	-23, -30, -23, 2, 23, -23, 26, 29, -27, -18, 24, -4, -30, 31, 10, -16,
+	-7, 18, -12, 30, -5, 18, 15, -6, 18, -16, -30, -31, -42, -25, 44, 23,
+	-1, -24, -41, 8, 1, 21, -5, -13, -13, 18, -26, 28, -16, 14, 1, -18,
+	6, -30, -6, 32, 28, 10, -2, 12, -20, -4, -36, -27, 16, 14, -23, -27,
+	-13, -21, 13, -6, -11, 2, -41, -5, -36, -1, -34, 32, 31, -9, 19, 8,
+	-18, 5, 17, -38, 8, 14, -36, -34, -35, 11, -11, 0, -1, 12, -8, -16,
+	1, 21, 0, -9, 15, 13, -21, -8, -5, 5, 0, 22, -29, -25, 29, 25,
+	-17, 30, -14, 29, -41, -41, -6, -28, -23, -12, 24, 16, 7, -29, 23, 16,
+	-4, 6, -4, 22, 15, -20, 2, -9, 5, 22, -20, 3, 18, 7, -19, 27,
+	21, -11, 19, -15, 7, 17, -24, -8, 21, -20, -36, -24, 14, -16, -15, -31,
+	10, 1, -11, -16, 9, -16, -52, 41, 20, -7, -7, 16, -10, -20, 16, -21,
+	-36, -33, -42, -9, -26, -9, -46, 19, -8, -33, 20, -21, -18, 11, 30, 35,
+	4, 7, 24, 6, 14, -21, 7, -6, -38, -9, -7, -20, 25, -22, 29, 33,
+	-3, -40, -42, 32, -13, -5, 19, -23, 33, -4, -24, -28, 8, 11, -5, 13,
+	4, -22, 0, -10, -36, 6, 32, 1, 3, -18, -31, -22, -12, 8, 3, 3,
+	-16, 11, -2, -19, -37, -6, 7, -28, 19, -3, 6, 7, 23, -23, 11, -41,
+	-7, 46, -36, -47, 3, -22, -10, -46, -64, 18, -20, 35, -24, 8, 22, 8,
+	5, -6, -7, 20, -6, -11, -1, 25, 23, 26, -5, -3, -22, -13, 11, 17,
+	5, 19, 21, 18, -7, -23, 16, -26, -7, 28, -4, 16, -2, -44, -22, 24,
+	-4, -16, 40, 6, -30, 6, -54, 8, 6, -2, -15, -29, -30, 8, -17, -33,
+	-24, -6, 2, -10, 6, -9, -2, -17, -36, 31, -21, -1, 3, 30, 1, 20,
+	-9, 1, -34, 25, -34, 20, -28, 2, -22, 7, 17, -13, -43, 46, -2, -39,
+	-5, 18, 13, -44, -2, 12, -4, -2, -25, -9, -45, 26, -38, -21, -26, -5,
+	-6, 16, 11, -24, 3, -4, -9, 12, -34, -11, -35, 35, 10, 21, -23, -15,
+	1, 19, -36, 17, 15, -22, -5, -2, -1, -39, -47, 25, -4, -5, 0, 6,
+	4, -57, -34, 0, 1, 30, 20, -34, -31, -7, -15, 17, -23, 17, -7, -14,
+	-34, -1, 25, -11, -24, 13, 23, -11, -16, -21, 19, -22, -19, -12, 19, 3,
+	-20, 31, -32, -5, 24, -14, 10, -18, -8, 4, 6, 7, -24, -3, 32, -34,
+	-39, 70, 17, 12, 3, -35, -47, -5, 20, 45, 51, -1, 31, -27, -4, 4,
+	-24, 2, 21, 30, 19, 4, 33, 10, -21, -10, -14, 21, 13, -26, -6, 5,
+	-10, -8, -5, 9, -9, -6, -6, 37, 24, -21, -24, -10, -20, 22, -37, 29,
+	-3, 22, 40, -37, -34, -22, 42, 64, 30, -13, 38, 0, 10, 10, -11, -12,
+	-28, -10, -14, -33, 4, -32, 23, -7, 33, -9, -4, -21, -30, 0, -23, -10,
+	29, -12, 16, -14, -12, 20, 11, -19, -5, -2, 12, 17, -24, 29, -38, 7,
+	31, -35, -52, 3, 2, 52, 19, -30, 48, 18, -16, 12, -29, 10, -12, -18,
+	30, 20, -24, -13, -13, 4, 15, -27, 0, -15, 23, 21, -6, 25, -7, -10,
+	40, -28, -24, 15, -9, -6, -32, 29, 13, -34, -59, 31, 0, 28, -19, 9,
+	7, 2, -5, 42, 20, 1, -1, -11, -26, -24, 2, -29, -14, 14, 26, 19,
+	18, -15, 20, 24, 4, -25, 0, -16, -26, 17, -14, -23, 0, 9, 50, -17,
+	-26, 61, 29, -28, -19, -1, -19, 18, -36, 24, 9, -9, 20, -25, -32, -46,
+	-9, 57, 11, -12, -20, 31, -9, 7, 37, 25, 23, 20, -1, -8, -17, 3,
+	-28, -11, 26, -30, -16, 15, 20, 6, 17, -6, -21, 9, -13, 24, -20, 0,
+	-37, 19, 2, 43, 42, -25, -5, 14, 7, -41, -45, 26, -23, -5, -12, -19,
+	19, -33, -1, -20, 22, 4, 29, -28, 22, -33, 29, -4, 8, -34, -17, 4,
+	-19, 16, -15, 20, 3, 9, 25, -23, -32, -28, -30, -33, 26, 19, 6, 62,
+	-30, 39, 37, -38, -21, -21, -6, 20, -50, 34, -4, 9, -36, -40, -30, -10,
+	-39, 11, -9, 12, 27, 21, 21, 26, 30, 6, -2, -24, 9, -12, 19, -2,
+	-22, 18, -4, -29, -20, -26, -23, 32, 1, -10, -31, 12, -35, 41, -35, 38,
+	39, -9, -3, -5, 16, 12, 29, 39, -17, 23, -9, -55, -4, 17, 12, -9,
+	-32, -24, 22, -5, -1, 16, -23, 2, 29, 9, 5, -24, -7, 0, 13, -6,
+	-2, -18, 5, -16, 31, -1, -24, -23, -32, 25, -33, 34, 5, 14, 3, -36,
+	37, -18, -10, 2, 9, 24, 22, 21, -19, -9, 0, 23, -27, -15, -10, -25,
+	25, -5, -7, 28, 24, -23, 9, 12, 24, -19, 12, -9, -4, 22, -16, -9,
+	31, -22, 9, -2, -12, -40, 17, -10, -5, 32, -2, 2, 35, 19, -1, 21,
+	27, -25, -29, -2, 18, 8, -12, -12, -6, -4, 31, -3, -20, 6, 13, 24,
+	24, 9, 29, -5, 32, 11, 11, 29, -11, 16, 23, 20, -28, -9, -16, -25,
+	20, -27, -6, 23, -4, 18, 13, -35, -50, -35, 38, -41, 3, 20, -28, 13,
+	37, -37, -19, -7, 16, 43, -13, -2, -2, -16, -2, 32, -21, 16, -22, 25,
+	15, -31, 19, 28, 15, -27, -10, 16, 17, -13, -18, 17, 29, -28, -18, -7,
+	15, 18, -11, 19, 40, -22, -23, -14, 27, -30, -34, 5, -20, 26, 46, -33,
+	15, 9, 18, 58, 10, 49, -5, 14, -24, -27, 6, -11, -20, -20, 7, -28,
+	24, 9, -9, 23, 36, -17, 48, 34, -31, -1, -31, -18, 18, -6, 9, -35,
+	9, -5, 28, 14, -18, -19, 24, -39, -21, 59, -32, 16, -33, 9, 33, -6,
+	35, 25, 58, 27, -24, 24, -19, 2, -14, 15, 32, 18, -4, 19, -12, 23,
+	15, 25, 5, 13, 27, 23, 9, -29, 23, -4, 30, 31, 53, -28, -9, -9,
+	45, -39, -27, 12, -24, 9, 14, 30, -6, -19, 23, 7, 0, -25, 24, 46,
+	46, 30, -23, -32, 22, -14, -19, -12, 21, -15, -22, 9, -10, 5, 4, 16,
+	4, -20, -11, 9, -17, 6, 16, 5, -23, -4, 8, -40, -32, -30, 23, -25,
+	13, 41, -7, -36, -30, 33, -14, 27, 30, -19, 7, 15, -1, 18, 42, 40,
+	-10, 33, 27, -12, 25, -10, 32, 33, -15, 18, -9, -21, 2, 13, 30, 21,
+	27, -16, -7, 21, -35, -5, -13, -5, 5, 20, 13, -32, -15, 29, 22, -40,
+	2, 25, 13, 8, -20, -24, 22, 16, -13, 28, -36, -36, 0, -14, -26, 50,
+	-16, 1, -12, 23, 7, -23, 17, -2, 11, -13, -27, -8, 22, 8, 11, 23,
+	31, 15, -5, -4, -14, -13, 23, 8, -17, -9, -44, -29, -34, -36, 24, 23,
+	16, 37, -39, -8, 23, 3, -5, -29, -30, -4, -16, -30, -17, 14, 28, -15,
+	2, 21, -2, 24, -24, 19, 17, -22, 13, 15, 16, -1, 37, 4, 20, 17,
+	7, -16, -2, -12, 16, 30, -30, 7, 20, 5, -22, -15, -10, -26, -5, 40,
+	12, -42, -19, -12, -24, 8, -7, 18, 9, -26, 10, 25, 19, -6, -17, -21,
+	-28, 0, 6, -28, 11, -1, -13, -27, 36, 0, 27, 15, -7, -24, -16, -35,
+	-5, -5, -23, -2, 29, -36, -20, 27, 5, -39, -24, -24, -25, 18, 11, -1,
+	8, -18, -7, 39, 19, -38, 8, 24, -17, 27, -25, 0, -26, -8, -14, -34,
+	32, -4, 20, -21, 8, 21, 20, 24, -5, 22, 20, -4, 11, 26, -21, 6,
+	19, 25, -11, 16, 8, -29, 20, -36, 11, 14, -14, -11, -34, -24, 15, -9,
+	-17, 4, 0, -21, -2, 8, -18, 42, -23, 20, -8, 8, 12, 12, -1, 27,
+	2, 28, 37, -33, 1, -3, -5, 9, 36, -1, -20, 2, 6, 13, -36, -11,
+	-11, 16, -10, 6, 41, -23, 8, -31, 11, -49, -18, 2, -2, -11, 12, 5,
+	17, 35, -1, -36, -34, 8, 9, 1, 6, -15, -19, -7, 4, 25, 19, 9,
+	-10, -29, -29, 27, -25, 16, 7, -14, -19, -28, -20, -13, -30, 38, 29, 15,
+	-29, -14, -18, -15, 18, -24, 54, -19, -18, -41, -4, -30, -24, 5, -47, -2,
+	18, -22, -20, -34, -17, -12, 28, -33, -21, -14, -3, -33, -23, -15, -7, -27,
+	27, -27, -3, -14, 19, 5, -7, 12, 8, 23, 27, 7, 15, 19, -14, 5,
+	12, -24, 2, -5, 2, 14, 13, -9, -28, 0, -4, 0, -16, -2, 20, 6,
+	9, -37, 18, 3, 7, -2, -17, 23, -5, 31, -4, 12, 8, -16, -4, 12,
+	-26, -28, 2, -20, 29, -19, -22, -8, -19, 14, 14, -17, 17, -13, 21, -37,
+	3, 23, 48, -13, 33, -13, -13, -19, 37, 3, 19, 17, 44, 18, -15, -13,
+	-14, 4, 27, 7, -6, -3, 24, 33, 20, 10, -30, -3, 4, 2, -2, -22,
+	7, -5, -1, 8, 2, 26, -28, 52, 35, 40, -33, -33, -17, -34, 4, -9,
+	46, -16, -10, -18, -24, -5, 34, -11, -17, 13, 20, 27, 5, -26, -22, -15,
+	-14, 16, -1, 12, 7, 15, 29, 24, 17, 23, -17, -19, -26, 5, 29, 6,
+	32, -30, 33, 10, -18, -12, 12, 62, -6, 51, -16, -23, 22, 7, 1, 8,
+	-36, -19, -28, -31, -5, 23, -8, -37, -12, 22, -34, 33, 13, 29, 31, 15,
+	28, -14, 2, -14, -13, -15, -20, 26, 28, -6, 26, -2, -17, -13, 7, 14,
+	6, 3, 40, -13, 38, 22, 0, -10, 21, -46, 30, 23, 13, 36, 0, -24,
+	-5, -14, -8, -12, -12, 17, 32, 21, 19, -18, 26, -30, -25, -21, -10, 24,
+	33, -28, -8, -21, -4, 26, 5, -31, 19, -12, -20, -19, -21, -1, 9, -31,
+	-6, 31, 19, 48, 27, 41, -2, 0, -16, 1, -39, 1, -13, 27, 0, -2,
+	11, -6, -2, 3, 21, 3, -25, 24, -17, 12, -11, 23, 22, 30, -6, -27,
+	-9, 10, -23, -31, 1, -25, -34, -7, -18, 14, 2, 19, 7, -28, 30, 31,
+	5, 3, 19, 29, -1, 17, 6, -10, 31, 1, -42, 15, 0, -19, 1, -3,
+	3, 1, -22, 5, -6, -23, 20, -26, -12, -34, 13, 1, -10, -30, 24, -19,
+	27, 4, -29, 9, 7, 24, 19, 8, 26, 2, -16, 33, 37, 33, 20, 40,
+	7, 44, 15, 3, -36, 38, 27, 10, -10, -25, 3, -33, -23, -12, -8, -34,
+	-27, 4, -20, -11, -20, 25, 19, -22, 20, -33, -10, -28, 7, -18, -6, -28,
+	7, 6, -15, 14, -26, -29, 26, -30, 5, -13, 4, 24, -12, -16, -37, 38,
+	0, -45, 15, 20, 7, 16, -5, 24, -7, -60, 16, -26, 3, -24, 26, 9,
+	0, 21, 5, -9, -2, 8, -11, 13, 3, 14, 19, -28, -9, 18, -9, 11,
+	-27, 1, -31, -18, -21, 16, 3, -8, 0, -25, -15, 32, -55, 32, -1, -28,
+	-28, -11, 43, 35, -11, 12, -8, -50, -32, -31, 1, -23, 9, 16, -15, -3,
+	-25, 3, -30, 22, -32, 32, -7, 1, -13, -27, 12, 19, 32, 20, 22, 25,
+	17, -11, -34, -9, -16, -1, -4, -6, -16, -12, 7, 9, -27, -34, 21, 34,
+	-7, 25, -21, 14, 26, -13, -32, -10, 9, -22, 24, 30, 5, 4, -1, -21,
+	-6, -27, 25, -11, 17, 5, -12, 13, -34, -10, -16, -27, 1, -28, -27, 19,
+	-3, 3, 19, 10, -9, -3, 12, 22, -39, 10, -8, -54, 5, -10, -1, 8,
+	-15, 5, -36, -30, -28, -35, -5, -14, 21, 16, -28, -5, 32, -17, -22, -23,
+	-25, -25, -2, -7, -13, -21, 23, 16, -17, 21, 10, 27, 0, -3, -7, -31,
+	-17, 0, -26, 24, -31, 36, -26, 32, 5, -13, -37, 19, 34, -22, -18, 13,
+	-36, -38, -4, -11, -43, -37, 29, 53, -13, 6, 21, 9, -23, 12, -23, 8,
+	-14, 12, 33, -17, 23, 28, 20, 21, 3, 14, -17, 1, -21, 16, 24, 21,
+	-11, 0, -30, 5, 38, -36, 17, 15, -10, 37, -41, 13, -20, 25, 14, 33,
+	-37, 20, -40, -12, 21, -9, 5, 18, -18, 28, -17, 23, 31, -29, 28, -35,
+	-14, 8, -6, 12, 0, -32, -15, -17, 10, 16, 28, 6, 29, -13, 4, 29,
+	14, 12, 27, -1, 20, -19, -38, 43, -28, -13, -14, -34, -13, 2, -36, -3,
+	11, 27, 36, 12, -10, -4, 13, -24, 11, -34, 25, -33, 34, -23, -31, 25,
+	35, 6, -23, -2, 9, 18, 32, -31, -17, -25, 27, 12, 11, -14, 13, -14,
+	-9, -33, 15, 24, 5, 43, -42, 22, -12, 8, 27, -5, -11, -22, -25, 31,
+	-5, -18, 23, -17, 16, -4, 26, -28, 15, -34, -30, -20, 13, 26, 29, 5,
+	-18, -28, 6, -17, 31, -11, 4, 25, 23, -20, -24, 8, 15, 32, 9, -25,
+	15, 40, -17, 25, -4, 5, -27, 3, 34, 6, 1, 5, -35, 30, 27, -1,
+	2, -39, 7, -16, 5, -19, 21, -27, 22, -27, -8, -17, 5, -8, -20, 4,
+	-15, 15, -29, 15, 16, -5, 30, 25, -28, -42, -29, 28, -5, -6, -8, 15,
+	-35, 41, -45, -10, 7, 25, 46, -5, -7, -4, -19, -10, 17, -28, 13, 9,
+	5, 28, 12, -19, 30, -23, 13, 7, 34, -12, -22, 29, 23, 14, -33, -34,
+	-4, -20, 9, 18, -27, 23, 17, -55, -48, 10, 45, -6, -14, -9, -21, 11,
+	26, -53, 3, 23, 28, 31, 31, 18, -2, -31, -25, -40, 17, 1, -19, 24,
+	0, -24, 28, 1, 6, -2, -17, 20, -9, 3, -33, 7, 7, 31, -8, 16,
+	-9, 26, -30, 1, 30, -38, -24, 20, 34, 48, 2, -7, -2, -3, 49, -56,
+	10, -39, 26, 3, 0, -49, -24, -56, -31, -30, 30, -30, 1, 9, 13, -6,
+	21, -19, -1, 24, -10, 34, -4, 8, 29, 20, -3, -10, 0, -28, 32, -18,
+	-28, 24, -19, 6, -20, 32, 14, 31, 14, -19, -41, 29, 12, -25, -3, -32,
+	1, 2, -2, -36, 11, -37, -44, -17, 37, -1, -14, 28, 29, 22, 26, 1,
+	-34, -2, -28, -4, 19, 14, 20, -12, 5, -31, 18, -1, -31, 20, -19, 11,
+	20, -37, -30, -17, 34, 40, -35, -27, -22, 34, 38, -39, -21, 3, -5, 28,
+	29, 24, -21, -11, -18, -20, 30, -21, -29, 29, 20, 23, -13, -27, -27, 11,
+	17, 0, -21, 33, 5, -9, 15, -13, -5, 9, -1, -12, 20, -10, 8, 9,
+	-15, -13, 16, 42, -17, -4, -1, -16, 14, -11, -21, 3, 50, 33, 3, -11,
+	5, -29, -8, -41, 60, 2, -18, 9, -27, -7, -6, -33, -31, 31, -25, 9,
+	-10, -16, -2, 22, 3, -3, -9, 0, 4, -31, -14, -21, -32, -16, -58, 20,
+	5, 7, 21, -25, 5, 5, -18, 24, 35, 22, 11, -74, -2, -58, 31, -35,
+	-6, 1, 51, -21, 10, 1, 27, -14, 30, 33, -17, -8, 30, -26, -28, 18,
+	-26, 23, -5, 24, -25, -1, 25, 2, -31, -17, -20, -14, -26, -14, 37, 13,
+	43, -24, 5, -1, -22, -6, -32, 46, -17, 10, -22, -35, 12, -26, 1, 12,
+	11, -11, 17, 36, -23, 4, 27, -29, 15, 36, -15, 3, -10, 14, -33, 8,
+	-30, 37, -15, 8, -23, -3, -6, 25, 21, -34, 2, 7, -6, 2, -23, 29,
+	-30, -2, -49, -19, -24, 35, 22, -42, -31, -52, 30, -29, -5, -1, 31, 13,
+	-6, -29, -35, 26, 19, -22, -36, -3, -25, -20, -16, 31, -24, -14, -5, 9,
+	-1, -27, -42, -19, -22, -29, 8, -42, -50, 9, 20, -1, -18, -39, 16, 15,
+	-35, 23, -12, -28, 12, 7, -10, -29, 7, 27, -9, -7, 21, 10, -35, -27,
+	-3, 11, -28, 10, -32, 12, 16, -24, -22, -10, 8, -6, -7, 25, -34, 18,
+	-4, 24, 13, 17, -26, -52, -21, -2, 26, -20, 7, -37, -19, -36, -2, -32,
+	38, 31, -36, -27, -34, -38, -9, -13, 17, -17, 9, -10, -24, 2, 10, -5,
+	-36, -9, 8, -22, -8, 13, 4, 20, 24, -16, -19, -6, -17, -5, 18, 15,
+	-23, -4, -33, -35, -39, 57, 9, 30, 16, 6, 28, -49, -54, 32, -14, -5,
+	16, -2, 21, 15, -28, -2, -27, 17, 17, 24, 2, -15, -7, 33, -4, 5,
+	24, 17, -13, -16, -23, -18, 14, -5, -12, 32, 1, -1, -6, -24, -24, -19,
+	-12, 12, -15, 31, -26, 17, 7, -4, 35, -39, -73, -6, -34, 1, 31, -2,
+	4, 27, 12, -13, 35, 35, 14, 47, 26, 21, -17, 15, 2, 14, -4, 13,
+	-4, -21, -33, 8, 10, -25, 28, 33, -29, 6, 13, 34, -38, 16, 34, -9,
+	-15, 17, -33, -15, 18, 2, 12, -19, -43, 44, -22, 28, -1, 40, -1, 17,
+	-14, -21, 13, 21, 26, 11, 10, 2, 26, 27, -36, -24, -36, 33, -1, 4,
+	6, -23, -21, -12, 28, -28, 10, 11, 8, -11, -27, -13, -3, -34, -36, -6,
+	25, 9, 38, 0, 34, -52, -53, -12, -14, 10, 26, 18, 15, -1, -19, 9,
+	0, 8, -7, -2, 12, -23, 0, -14, 2, 20, 26, -1, -20, -25, -16, 29,
+	2, 12, -10, 25, 15, 3, 2, -2, 16, 10, 5, -48, -28, 8, -35, 17,
+	8, 6, 21, -33, -8, 30, -4, -37, 0, 14, 27, 31, 22, -23, 19, 39,
+	11, 40, -4, 32, 3, 34, 18, -16, -32, -20, 9, -17, -18, 1, 11, 31,
+	34, 1, 4, 28, 28, 19, 6, -27, -6, 26, -20, 31, 32, 50, 17, 28,
+	-15, -19, 40, -5, -4, -29, -5, -70, 23, -47, -22, -20, 25, 12, -4, -31,
+	16, 18, 10, 25, 23, -1, 0, -3, -9, -11, -34, 14, 28, 12, 0, -20,
+	21, 25, 16, 20, -13, -33, -22, 1, -19, -7, 22, 31, -5, -21, -28, -25,
+	52, 42, -2, 21, 21, -20, 4, 6, 18, 5, 27, 17, 5, -28, 11, -30,
+	-26, -8, -30, -2, -9, -15, -28, -7, 12, 7, -11, 16, 8, 9, -23, -13,
+	8, 19, 20, 7, 3, 15, -46, 14, -22, 35, 27, 34, -2, 4, 57, 12,
+	-7, -28, 30, -74, -13, -37, -32, -8, 14, 12, -9, -7, 4, -9, 14, -26,
+	22, 16, 3, 28, -1, 6, -2, 31, 32, -10, 22, 13, 8, 13, -14, 26,
+	-20, 12, -1, 17, 6, -9, -24, 45, -2, 25, -4, -14, 24, 8, 43, 8,
+	-19, -45, -19, 5, 7, -29, 24, 26, -27, -34, 1, 28, 20, -27, -8, 23,
+	-33, -29, 12, 1, -31, 22, 2, 7, -24, 1, 13, 8, 31, 10, -24, 29,
+	18, -13, -19, -13, 16, 44, 1, 0, -24, 11, 79, 35, -21, -27, 39, -36,
+	-19, -18, -25, -32, 23, 10, -6, -29, -20, 6, 24, -33, -20, 12, -6, 25,
+	-26, 10, -18, -13, -10, -22, -25, 17, 6, 25, 11, -22, -18, -10, 21, 0,
+	-33, -18, -17, 11, 8, 24, -1, -24, 28, -11, 14, -16, 2, -2, -57, 3,
+	-10, -21, -127, -24, 33, 21, 25, 10, -2, 24, -31, 0, -33, -28, -12, -13,
+	-6, -15, -8, -33, 4, -6, 34, 27, 13, 12, -33, 18, 7, -5, 9, -7,
+	21, 19, 9, 14, 6, 14, 37, 34, 26, -24, 15, 13, -42, 24, -3, -27,
+	-80, 1, -1, 11, -23, 12, 18, -4, 22, -13, 24, 26, -2, 20, 16, -33,
+	17, -25, -37, 22, -21, -9, -3, -20, -5, -2, -1, -48, 8, -35, 10, 8,
+	1, 6, 8, -4, -2, -6, 6, -8, 7, 6, 3, 16, -3, -20, -87, 24,
+	14, 37, -1, -26, -31, -27, 11, 13, -21, 24, 2, 4, -32, 15, 11, 26,
+	-11, -2, -3, 21, 15, 3, 30, 22, 0, -24, -44, -6, 6, 47, -15, -9,
+	-6, 9, 13, -23, 10, 18, 12, -1, -12, 3, -22, -42, -54, 39, 38, -9,
+	-7, -17, -35, -20, -23, 11, -29, 12, 14, 8, -3, 6, 15, 15, 19, 8,
+	15, 14, -37, -3, 19, 14, 24, -31, -32, -10, 14, 19, 24, 1, -7, -10,
+	-17, -4, 17, -12, 9, -1, -45, 41, 18, -14, -70, 75, 63, 27, -4, 18,
+	15, -12, 26, -29, -13, -16, -24, -26, -15, -29, -5, -26, -1, -17, -28, 31,
+	-15, -12, 5, -29, -8, 2, 11, -15, -26, -18, -24, 32, 15, 14, -5, 18,
+	11, -6, -7, 22, -20, -3, 2, -1, -25, -21, -36, -28, 9, 12, -7, 20,
+	23, 20, -1, 9, -25, 9, 0, 18, -10, 27, 8, 5, -30, -11, 13, -18,
+	-26, 24, 15, 18, 53, -57, -8, 7, -3, 17, -28, 16, -34, -46, 44, -4,
+	8, 30, 20, -57, -6, -35, -2, 43, 14, -36, -28, -18, 9, 11, 33, -13,
+	25, -14, 23, -16, 7, 4, -13, 7, -20, 4, 20, 32, -12, 10, -23, 16,
+	-12, 23, -16, -37, -15, 7, -28, 7, -4, 43, -13, -35, 7, -28, 36, -9,
+	11, -40, 3, 35, -18, -1, -13, -5, -2, -10, 22, 19, -10, 29, -8, -22,
+	-15, -16, -5, 17, 29, -23, -11, -12, -2, 20, -12, 29, -32, -11, 20, 17,
+	46, -41, -41, -17, 32, -10, -3, 40, 19, 33, 9, -29, 38, -8, -16, 0,
+	-13, -1, -43, 12, 29, 43, -9, -28, -30, -31, -26, -30, 27, 26, 25, -32,
+	-27, -16, -21, 25, 6, -10, -30, -18, -26, 5, 16, 25, -7, 5, -1, -38,
+	-38, 5, -15, 0, 19, 11, 32, -25, 5, 18, 10, -30, -21, -28, -15, 16,
+	-13, 0, -15, 18, -13, 19, -9, 22, 29, -17, 12, -32, 17, 31, 18, -10,
+	9, -11, -16, 27, 17, -4, -7, -29, -20, 12, -16, -6, -8, -5, 57, 10,
+	-31, -27, 27, -41, -17, -9, -20, 36, -22, 13, -31, -54, -56, -11, -38, -24,
+	23, -24, 8, 10, 27, -18, 8, 7, 9, -10, -3, 20, -35, -21, -6, -21,
+	-34, -9, 26, 25, -15, 16, -36, 9, -8, 7, 16, 25, 68, -41, -23, 14,
+	18, -22, -33, 3, -44, -14, 17, 8, 27, -22, -16, 21, -19, -21, 23, -27,
+	-34, 10, -34, 14, -9, -16, -20, -1, -37, 23, -36, -14, 28, -11, -33, -3,
+	-5, 37, -28, 13, 6, 24, 36, -1, 15, 4, 43, -36, -11, 19, 16, 10,
+	-26, -22, 33, 13, -13, 52, 0, 33, -46, -17, -6, -46, 10, 8, -1, -18,
+	-23, 8, 3, 17, 17, 25, -20, -28, 17, 35, 20, -5, 5, -12, 25, 12,
+	-33, 36, -26, 0, 32, 9, 37, -17, 26, -11, 30, 28, 26, 6, -15, -29,
+	-5, -28, -12, 36, 19, -19, -45, 1, -14, -22, 9, -8, -3, 23, -33, 22,
+	6, 13, 4, 33, -22, 18, 16, 19, 23, -8, -15, 23, -9, -28, -10, 10,
+	-32, 14, 2, 37, -5, 4, 65, 2, 32, 18, 39, -25, -40, -38, 4, -4,
+	20, 9, 6, 3, -10, 22, 17, -22, -17, -27, -31, 23, -15, 29, 25, -12,
+	0, -19, -28, 7, -9, 32, 24, 1, -23, -11, -9, 18, -12, 23, 14, 21,
+	28, 5, -45, -1, 27, 2, 33, -24, -27, 30, -42, -26, 34, 34, -1, -45,
+	6, 35, -26, 57, -32, -5, 26, -26, 19, -8, -14, -23, 19, -2, -25, 10,
+	-28, -21, 10, -32, 17, 2, -12, -18, -26, 22, 8, -15, 31, -10, 31, 2,
+	-31, -4, 20, -43, 49, -6, 26, -13, -23, -36, 49, 10, 24, 19, -21, 9,
+	-4, 54, -16, 4, 0, 39, -7, 10, 19, 26, -22, -23, 20, 5, -3, -2,
+	-12, -30, 1, 7, -11, -15, 30, 20, -3, -3, -3, 26, -13, 27, -14, 34,
+	34, -26, 47, -29, 2, 7, -18, -5, 53, -6, 31, -25, -21, -3, 5, 52,
+	-8, 12, -17, -5, -17, -10, -25, 6, 29, -5, 18, -15, 28, -31, 12, -22,
+	22, -23, -29, -26, -19, 0, -36, 32, -15, 19, 2, 17, -21, 23, 8, -28,
+	34, 10, 38, 4, -48, -14, 25, 3, 19, -26, 9, 29, 3, 67, 4, 15,
+	-6, 8, 11, -17, -29, -12, 9, -25, -16, 3, -22, -27, 4, -3, 31, -18,
+	-25, -23, 13, 13, -19, 13, 26, 31, 29, -14, -9, 25, 16, -3, 42, 3,
+	37, -11, 12, -27, 49, 10, -15, -3, 3, -31, -15, 77, 1, -17, 1, 26,
+	20, -23, -10, -5, -20, -1, 5, 27, -11, -20, 19, 22, -22, -24, -6, 10,
+	14, 7, -24, 2, -3, 9, 32, -16, 10, 44, 2, -20, 36, 47, 53, -3,
+	-61, 0, -88, 41, 1, -7, -9, -1, 1, 68, -23, 22, 33, -14, -13, -9,
+	-9, -24, -14, 15, 27, -1, -6, -24, -39, 3, -30, -20, 31, -24, -23, -14,
+	10, -20, 11, 33, 14, -1, -22, -23, -14, -3, 50, -5, 37, -5, -57, 4,
+	-29, 35, 4, -1, 12, -3, -16, 47, 4, -8, 47, 7, 22, 16, 1, 16,
+	-5, -8, 12, -4, -20, 15, 6, 16, -10, 21, -5, -29, -14, 32, 19, 15,
+	6, 33, 52, -16, -16, -21, -3, -17, -5, 1, 13, -32, -51, 17, -49, 17,
+	0, -12, 15, 16, -9, 2, -3, 7, 21, -21, 7, 8, 8, 25, 0, -27,
+	17, 32, 16, 28, 9, 25, -10, 31, -7, -23, 4, -6, -23, -9, -21, 13,
+	33, -27, 0, -28, -25, 5, 5, 17, 12, -20, -32, 31, -71, -1, -26, 3,
+	14, 15, -39, -31, 4, 13, 37, -11, 28, -24, -21, 14, -26, -13, 14, -25,
+	-30, 5, -8, 16, 16, -6, 24, 21, 16, 30, -15, -9, 6, -18, 7, -77,
+	-27, 14, -36, 40, 34, 17, 1, -15, -26, 20, -20, 36, -21, 5, 4, -39,
+	-38, -49, -34, 5, 71, -2, -29, 18, 26, 5, -25, -27, -8, 6, -4, -7,
+	17, -27, 24, 24, 24, 11, 29, 15, -33, 20, -32, 18, 1, -1, 38, -58,
+	48, -21, -1, -2, 3, 22, -2, 18, -35, 9, 5, -10, 12, 6, -13, -9,
+	-43, -46, 21, 23, -31, 16, -34, -11, -17, -11, -26, 0, 19, -2, 17, -1,
+	-5, 4, -11, 28, 9, 4, 5, 21, 29, 18, 15, 42, 42, -7, 5, -38,
+	37, 14, -16, 43, -21, 39, 7, -18, -15, 10, -15, 39, 0, -17, -3, -46,
+	7, 23, 28, 7, 10, -24, 19, -15, -13, 2, 25, 25, -11, -17, -13, -6,
+	-1, -28, 5, 6, -18, 28, -17, 20, -37, 43, 4, -36, 24, 19, -10, 20,
+	27, 4, 26, 40, 11, -12, -3, -16, 19, 24, 17, 10, -18, -31, -22, -29,
+	29, 25, 5, -11, 4, 27, -5, -24, 31, 19, -25, -29, 30, -23, -32, -20,
+	10, -9, 3, -29, 27, 19, -31, 26, -2, -28, 7, -34, 35, 44, 37, 28,
+	-4, 41, -14, 6, -25, -34, 34, 25, -9, -36, 16, -33, 0, -30, 4, -19,
+	7, 7, -7, -14, 24, -30, 34, 18, -7, -7, -31, 26, -12, -5, -14, -29,
+	-33, 9, -30, -11, 17, 36, -17, -61, 26, -18, 2, 9, 31, 22, 19, 21,
+	16, -24, 4, 22, 28, 32, -21, -34, -24, -34, 31, -36, -30, -24, 6, 16,
+	33, 22, -1, -21, 21, 3, -21, -33, -23, 8, -13, -3, 12, -22, 14, -9,
+	10, -19, 1, -31, -9, -15, 30, 36, 20, -10, 18, 37, 42, 9, 17, 26,
+	-10, 7, -25, 13, 2, 3, -5, 13, 27, 38, -3, -28, 21, -23, 2, 7,
+	31, 3, -23, -24, -10, -26, -24, 29, -4, 21, -13, -27, 2, -8, -15, -32,
+	12, -36, -5, -2, 11, 32, -21, 25, 30, 12, 9, -14, 21, 15, -22, 30,
+	-28, 18, -15, -2, 38, -42, 51, 19, 23, -29, 21, 26, -21, -14, -1, -28,
+	-25, -2, 35, -3, 13, -2, 11, 13, -11, 31, -2, -15, -31, -4, 18, -10,
+	-41, 30, 56, 46, -18, 10, 36, 6, 12, -26, 32, -23, -10, 21, -34, 3,
+	-17, -2, 4, -32, 34, 11, 26, 12, 23, -7, -4, 22, -20, -19, -30, 6,
+	5, -8, 17, -18, 7, 1, 9, -32, 36, -26, 5, -10, -24, -30, -10, 30,
+	31, 31, 8, -28, 44, 13, 39, 2, 17, 31, 27, 21, 20, -9, -7, -7,
+	19, -34, 2, 38, -4, 14, 27, 8, 26, -1, 20, -8, -21, 7, -18, -12,
+	15, -11, 18, 25, 26, 8, -1, 34, -9, -14, 25, -66, -40, 11, 51, 40,
+	-31, 16, 53, 14, 5, 40, 5, -27, 3, 27, 23, 26, 8, 6, 71, -54,
+	76, -16, -1, 27, -17, 30, -22, -7, -25, -3, -15, -27, 27, -26, 4, -30,
+	23, 16, 30, 21, -19, 0, -7, 21, -39, -5, -1, -19, 9, -7, -11, -28,
+	42, -10, 20, -29, 32, -34, -8, -41, 30, 38, -8, 15, -17, 49, -39, -33,
+	-3, -4, -3, -7, 1, 15, -8, 29, -4, -26, 4, -11, -27, -5, -33, -20,
+	0, -15, 26, -19, 30, 3, 6, 9, -10, 20, 30, -35, 28, 12, -3, 0,
+	61, -43, -1, -7, 15, -18, -24, 19, -9, 44, -56, 17, 26, 2, 14, 3,
+	29, -13, -8, 24, 20, -29, -3, 19, 10, 4, -16, -31, 12, -11, 32, -22,
+	8, 16, -23, 25, 15, -9, -14, 11, 6, -35, -21, -8, -16, -26, 22, -27,
+	26, 0, 32, -49, -33, 36, -20, 4, -25, -15, 10, -12, 14, 29, -12, 6,
+	18, 31, 31, 2, 29, 16, -2, -2, -22, 8, 7, 34, 2, 28, -15, 31,
+	-33, 6, -2, 31, 9, -45, -3, 14, -26, -8, 32, 5, 56, -9, -14, 26,
+	18, 13, -23, 44, -42, -4, -15, 29, 4, 0, -20, -11, -18, -10, 28, 8,
+	-27, -3, 7, 12, -24, -21, -30, 21, -9, 30, -9, 13, 15, 31, -2, 10,
+	-14, 34, 47, -24, 4, -12, -25, -27, -7, -17, 52, 15, 55, -27, 3, -15,
+	-9, 6, 1, 42, 5, 29, -25, -20, 13, 23, -2, -24, 20, 21, -3, 20,
+	4, 33, -31, 32, 16, 9, 12, 31, -1, -31, -7, -23, -17, 18, 1, 37,
+	-26, -63, -13, 13, -1, 27, -26, -22, 10, -20, -41, -25, -15, -30, -39, 25,
+	5, -4, 25, 16, -14, 36, -37, 4, -31, 16, -34, 9, 7, -10, -37, 17,
+	-35, 28, -33, -28, 27, -20, 2, -23, -5, -11, -9, -12, -4, 38, 34, 1,
+	-11, 35, 40, -2, -32, 20, -10, -45, -12, 23, -27, -16, -1, 16, -27, -16,
+	8, 14, 7, 2, 26, -7, 13, 6, -34, 30, -2, -21, -1, -27, -13, -31,
+	-32, 22, -1, 11, 20, 21, 21, 18, -9, -16, 37, 10, 16, -49, -46, -4,
+	22, 10, -25, -22, 19, -42, 15, -33, -26, -42, 1, 20, 18, 29, 29, 12,
+	-13, -26, 22, -5, -6, -23, -26, 8, -2, -15, 22, -14, -26, 14, -9, -22,
+	23, 24, -32, 24, 13, -10, 6, 20, 8, 45, 41, -28, -39, 42, 46, -14,
+	-31, 12, 13, -29, 4, -24, -8, -17, -2, 8, 19, -25, 16, 35, 31, 22,
+	-24, 20, -5, 4, 27, -26, 27, -18, -21, -16, 14, -10, 18, -25, 37, 0,
+	29, 27, 19, 29, -22, -8, 31, 48, 9, -66, -6, 24, 26, -3, -36, -26,
+	32, -73, 10, 16, -11, -8, 32, 56, 35, 5, 28, 28, 50, 29, 0, 24,
+	17, 11, -22, 9, -4, 27, -4, -26, 23, -11, 21, -22, -22, -16, -5, 15,
+	4, -28, 22, -19, 0, 1, -43, -11, -26, -26, 26, -31, -56, -36, 29, 14,
+	16, -18, 22, -54, -24, -7, 16, 41, 41, 7, -17, -4, 26, 23, -18, 11,
+	-34, 3, -4, -11, 24, 14, 0, 22, 13, 10, -14, 5, -29, -25, -7, -3,
+	20, 5, -13, -11, -14, 32, -37, -37, -16, 19, -53, -14, -9, 9, -20, 14,
+	13, 2, 55, 13, 25, 30, 46, 20, 24, 1, 23, -4, -23, 28, -4, 4,
+	26, -5, 12, 29, 13, 10, 0, 18, -1, 8, -28, 27, 10, 23, 21, 0,
+	4, -7, -34, 22, -23, -34, -11, 27, -5, 27, 43, 2, 38, -25, -7, 1,
+	-13, -25, -27, 37, 36, 43, -42, -4, 13, -22, -20, -30, -8, -20, -4, 0,
+	-23, 4, -35, 10, -2, 15, 20, -7, -2, 30, -19, 11, -33, -33, 10, -32,
+	-11, 18, -10, -32, -10, 22, -29, 12, 53, 1, -32, 7, -3, -58, 33, -15,
+	10, 22, 34, 12, -22, 16, 17, 3, -14, -31, -1, 1, -3, 12, 32, -6,
+	-12, -4, 36, 23, 21, -9, -32, -8, -21, 30, -31, 17, 16, -24, -15, 28,
+	-25, -23, -4, -10, 12, -14, 42, 13, 5, -15, 5, -61, 32, -15, 21, 30,
+	14, 1, 1, 4, 20, -27, -3, 29, -5, 30, 21, 28, -32, -5, 1, 32,
+	5, -17, -12, 20, -16, -4, -6, -33, 31, 21, 8, -19, 24, 17, 21, 51,
+	-8, 20, 24, 11, -17, 3, 0, 19, 18, 30, 25, 7, 37, 3, 17, 29,
+	-2, 25, 3, -12, -2, -5, -5, -7, 25, 1, 33, -30, -19, -11, 6, 28,
+	-27, -13, 20, 9, 29, 18, 27, 4, 27, 2, -20, 42, 35, 13, 17, 4,
+	9, 23, -21, 39, -6, -31, -2, -9, 29, 24, 21, -37, 1, 54, -24, 30,
+	10, -5, 27, 16, 29, 3, -10, 27, -2, 25, -4, -7, 24, -4, -8, -10,
+	-9, 13, 28, 4, 9, -2, 5, -5, 5, -1, 48, -5, 12, -21, 39, -15,
+	1, 11, -3, -23, -19, 40, 4, -20, 32, 12, -13, 64, -5, -17, -31, 2,
+	-1, 23, -14, 25, 15, -23, -3, -15, -12, -32, -23, 15, -22, -17, 20, 0,
+	-10, 0, -31, 2, -17, 4, 5, 20, 4, 21, 28, -25, -14, 38, 16, -7,
+	21, 7, 2, 3, -1, 14, 30, -35, -2, 46, -7, -2, -7, 8, -28, -2,
+	-10, -20, 30, -19, -3, -19, 14, 18, -18, 0, 15, 9, -15, 10, 1, 12,
+	28, -12, -18, -38, 22, -12, -4, 51, 7, 6, 43, 49, 26, 2, 8, -16,
+	7, 37, 15, -21, -17, -11, 53, 37, 18, 26, -7, 20, 1, 14, 12, 7,
+	28, 25, -6, -5, -6, 15, -31, 16, 17, -30, -10, 13, 1, 10, -21, 19,
+	18, 18, 29, 3, 47, 26, 41, -10, 13, 9, -53, 10, 30, 34, -18, -62,
+	5, 8, 35, 31, 27, 10, 31, 30, 31, 14, 15, 9, -28, -11, -32, -15,
+	18, 26, -33, -30, 12, 18, -12, -26, -26, -25, -1, -24, -28, 5, 41, 15,
+	-9, -23, 38, -2, 37, -17, -3, -31, -55, 8, 11, 14, -35, -56, -21, -8,
+	17, 12, -14, -28, 17, 29, 13, 27, 11, 15, -29, 32, -12, -1, 10, -21,
+	-1, 0, 31, 19, -7, -15, -3, -23, 34, -21, -16, 4, 39, -15, 11, -8,
+	25, 31, 13, -14, 20, -37, 1, -3, -2, 14, 32, -5, 23, 23, 37, 33,
+	49, 44, 15, 25, -12, -32, -14, 30, 7, -21, 15, -22, 26, 15, -31, 28,
+	32, -1, -18, 13, -29, 26, -27, -1, -8, 27, -14, -1, 6, -13, 28, 2,
+	28, 34, 6, -17, -10, -36, -45, 15, -8, -47, -18, -23, 31, -21, 6, -45,
+	0, -11, -28, 31, -7, -4, -13, 14, 34, -23, 16, -31, -1, 26, -27, 5,
+	7, 31, 5, -4, -15, -15, 31, -4, 33, 17, 23, -1, 13, 14, 22, -17,
+	2, -5, -18, -17, 21, 22, -15, -4, 3, 6, 29, 44, 12, 3, -7, 18,
+	35, 9, 28, -1, 23, -1, -28, -28, 13, 27, 1, -10, 36, 12, 28, 30,
+	20, -13, 37, -12, 23, 20, 14, 32, -15, 24, 53, -17, -2, 39, -51, 4,
+	-66, -15, 31, 20, -28, 43, -30, -16, 13, 18, 3, -22, -5, 26, -4, -1,
+	-31, -7, -2, 11, 17, -30, 4, -33, -5, 1, -3, 5, -10, -22, 28, -24,
+	5, -8, 27, -5, 17, 26, 19, 45, 15, 12, 18, 41, -31, 42, -71, 13,
+	-9, -22, 9, 10, 4, 21, 5, -18, 34, -2, 21, 9, 10, -6, -2, 2,
+	32, 25, 16, 23, 29, 17, -23, -4, -1, 13, -25, -16, -20, -25, -7, 8,
+	1, 25, -1, 4, -25, 2, 0, -17, -2, 35, -27, 33, -12, 49, -29, -43,
+	-5, 38, -69, 5, -42, 5, 34, -12, 18, -5, 26, 11, 31, -14, 12, -4,
+	-28, 30, -3, -35, -13, -12, -23, -31, 32, 3, 30, -4, -2, -12, -7, -14,
+	-27, 0, 15, 24, 0, 19, -5, 43, -39, 12, -50, 5, 17, -23, -7, 14,
+	-49, -11, 4, -12, 30, -4, -15, 3, -15, -10, -12, -5, 4, 17, -8, -34,
+	-27, -15, -16, 2, 8, -1, -8, 5, -4, 25, 4, 4, 24, 0, 18, 7,
+	26, 23, 3, -20, 14, 60, -44, -3, -61, 11, -21, -33, 7, 7, -27, -24,
+	-2, -3, 23, -26, -1, -4, 17, 6, -14, -34, 16, 16, 5, 20, -25, 19,
+	17, -30, -26, 9, 27, 8, 14, 10, 12, -15, -11, 14, 0, -11, 30, 0,
+	59, 32, -26, -18, 37, -24, 19, 54, 14, 33, -1, 15, 23, 19, 7, -4,
+	-7, 49, 3, 2, 12, -34, 5, 17, -12, -30, -17, 15, -16, -18, -28, -9,
+	-35, 28, 6, -29, 26, 26, 31, -1, 17, 22, -26, -19, -14, -2, 9, 17,
+	-34, 18, 12, -48, 6, 4, -7, -2, -24, 45, 4, 48, -3, -27, 8, 31,
+	-4, -17, -18, -13, 31, -11, 29, -10, -6, -8, -18, 11, 15, -33, 4, -29,
+	40, -32, 10, -20, -1, 2, 18, 27, -14, -5, 8, -33, 54, 13, -13, 6,
+	17, -3, 28, 23, 22, -18, -28, 1, -25, 13, -31, -52, -16, 53, -6, 4,
+	-5, -14, 18, -1, 8, -19, 25, -5, 2, -7, -20, 8, -3, 1, 21, -13,
+	3, 21, 35, 22, 20, 26, 32, -49, 40, -30, 39, -23, -40, -15, 34, -14,
+	-20, 34, 23, 37, -59, -22, 12, -10, 22, -22, -4, 34, -27, -28, 18, 11,
+	5, 0, 9, -18, 0, -31, -29, 4, 27, 31, -12, 22, 16, 17, 33, 10,
+	29, -31, 12, 18, 23, -14, -23, -1, 45, -7, -46, 9, 35, -10, -16, 61,
+	34, 17, 16, 22, -16, 3, 3, -66, -20, 43, -16, -7, -8, -34, 26, 18,
+	12, -27, 21, -7, -15, 14, 14, 7, -21, -16, -8, 11, 29, 29, -7, 2,
+	33, -8, -30, -34, -62, -43, -9, 55, -5, -3, 7, -64, 13, -30, 21, -43,
+	-2, 31, -9, 5, -24, -7, 19, 40, -43, 14, -16, 6, 13, 16, 29, -23,
+	6, -9, 28, 16, 17, -2, 11, -6, 10, 3, 30, -34, -17, 13, 12, 19,
+	3, 18, -34, -44, -28, 6, -13, 35, -3, -39, 38, -32, -6, -16, 11, 0,
+	21, 28, 15, 4, -18, 47, -10, 23, 18, -27, 28, -14, 1, -14, -9, 17,
+	-1, -1, -20, -2, 9, 22, 28, 29, 5, -7, -13, 7, -13, 26, 26, 35,
+	-4, -57, 10, 48, 20, -26, 27, -43, 42, -31, 12, -16, -7, -3, 20, 28,
+	-20, 0, 4, 27, 6, -21, -14, 26, -1, 0, -24, 4, 29, -5, 13, -31,
+	23, 17, -29, 18, -8, 25, 32, -23, -10, 12, 11, 31, 20, 16, 13, 2,
+	-22, 25, 12, 36, -33, -53, 36, -33, -7, -32, 32, -4, 4, -30, 4, -34,
+	-17, -3, 7, 33, -29, -11, 9, 13, 13, 12, -11, -33, 34, 32, 7, -8,
+	23, -34, -6, -22, -6, 20, -23, -3, -22, -10, 0, 21, -20, -8, 16, 52,
+	-17, -8, -44, -61, 8, -13, -2, 16, -10, -7, -1, 30, 13, -23, -9, -10,
+	-9, 22, -10, -15, 4, 12, -5, 5, 16, -23, 13, -30, 2, 1, 11, 18,
+	-23, 16, 7, -28, -27, -25, 33, -23, -34, 37, 17, 1, 31, -16, -5, -35,
+	-9, 18, -47, -23, -24, -5, 10, 61, 32, 10, -21, 19, 23, 10, -10, 18,
+	-20, 10, -14, 14, -14, -7, 2, -5, -27, 25, 1, 27, 4, -30, -7, 0,
+	-27, -21, 0, 28, -31, -18, 13, 19, -29, 4, -4, -19, 39, -1, -29, -8,
+	38, 3, 2, -5, 18, 52, 22, -14, -31, -14, 8, 29, 1, -8, 12, -21,
+	-32, 25, 26, -6, -25, -31, -28, -21, 0, -3, -2, -21, 14, 32, 27, 28,
+	1, 15, 19, 17, -33, 8, -5, 41, 9, -4, -13, -25, -4, 46, 1, -8,
+	-13, 9, 24, 37, -1, 22, -22, -4, -4, 53, 31, -11, 14, 10, -22, 29,
+	1, 2, 28, 14, -26, 17, -21, -17, 26, 33, 0, 29, 20, 31, 26, 0,
+	-6, 6, -33, -18, 0, 51, 19, 6, 5, -1, 0, 20, 2, -45, 0, -6,
+	32, 2, 22, -5, 1, 42, 33, 6, 31, -7, 13, 9, 17, 3, -18, -11,
+	25, 7, 23, 34, 5, 22, -3, -6, -10, 8, 19, 13, -2, -12, -21, 13,
+	12, -39, 18, 0, 38, 29, -9, -27, -33, -6, -31, 9, 7, 4, 66, 45,
+	5, 7, -46, 48, 19, 29, -26, -33, 15, -3, -32, 33, 33, -29, 23, -25,
+	-17, -27, -5, -11, -16, -32, -31, 19, 27, -13, 7, 16, 2, 0, 13, -21,
+	0, -42, -31, 1, 33, 39, 32, 18, 6, -5, -36, -19, -21, 1, 26, -17,
+	15, -21, 25, -5, 9, 0, -23, -25, 11, -4, 26, 20, -8, -29, 8, 4,
+	6, 20, -30, -8, -18, 18, -1, 0, -15, 10, 14, -20, -23, -32, -9, -38,
+	-28, -43, 25, 14, -22, 11, 33, 13, 2, 18, -33, 39, 3, -9, 11, 19,
+	8, 34, -26, 25, -32, 34, -23, 17, 25, -6, -29, -10, -23, -28, -33, 17,
+	-20, -13, 21, -12, 29, 1, 22, 29, -14, -15, -6, 19, -12, -28, -18, -4,
+	29, -11, -19, -27, 30, 32, -36, 22, -8, -11, 0, -27, -38, 17, 23, -5,
+	-17, -4, -33, -26, 27, -13, 19, -29, -19, 9, -21, -2, 11, 13, -8, -26,
+	3, 16, 24, -6, -10, 9, 15, 10, -31, -8, -8, -26, -38, -5, -23, 0,
+	4, 33, 38, -15, -63, -11, 4, 17, -4, -32, 7, 38, 6, 21, 35, 14,
+	-13, 1, 28, -2, -27, 21, 30, 34, 15, 9, -38, 34, -33, 28, -7, -4,
+	30, -1, -25, 4, 13, -10, 3, 33, 8, -4, -32, -20, -32, 14, 24, -6,
+	-3, -20, -2, -2, -32, 12, -3, -33, -15, 34, 11, -4, 4, 24, -24, 14,
+	15, -30, -22, 18, 9, 23, 28, 35, -16, 31, -12, -27, 7, -16, -14, -22,
+	2, -13, -15, -20, -16, -7, -1, 31, -11, 52, 5, 35, 32, -11, 40, -19,
+	33, 43, 47, -23, -21, -21, -17, -37, -9, -14, 40, -18, 10, 34, -33, 0,
+	18, -26, -5, 16, -3, 23, -14, 23, -28, 0, 28, -11, -27, 27, -3, 11,
+	-4, -7, 11, 5, -16, 32, -38, 47, -37, 21, -13, -4, 8, -65, 3, -16,
+	-1, 12, -11, -11, 35, -52, -34, -21, 10, 9, 17, -28, 4, 21, 23, -3,
+	11, 28, -1, -28, -19, 27, -7, 16, 1, 15, -21, 15, 5, -26, 16, -25,
+	4, -7, -6, -18, -8, 49, -18, 32, 11, -9, 37, -58, 57, 34, 7, 1,
+	-33, -8, -21, -22, 46, -22, 15, 19, -9, -31, -5, 15, 22, 23, 25, 21,
+	-10, 12, -19, 18, 17, -23, -24, 8, -6, 14, 27, 13, 15, -12, 34, -18,
+	13, 17, 4, 6, -36, -7, -13, -11, 15, -75, -7, 29, 7, 1, -10, -3,
+	37, -34, -10, -37, 24, -14, -13, 14, 7, -6, -20, -2, 21, -6, -35, -27,
+	-38, -18, -28, -19, -21, -5, -5, 8, 21, 24, -26, 29, 35, -13, -1, 4,
+	-46, 36, -32, 15, -12, 0, -5, -48, -4, 30, 13, 7, -46, -36, -20, -50,
+	47, 0, 36, 15, -23, -24, 21, -15, -20, -23, -5, -12, -33, -17, 6, -30,
+	4, -6, -35, -19, -23, 0, -10, 29, 22, -21, 2, -35, 3, 13, 48, -16,
+	-31, 4, -10, -27, 51, -37, -37, 4, 9, 9, -13, 30, -21, -5, 53, 18,
+	-17, -37, 7, -4, -20, 30, -15, 22, 34, 28, 11, 6, -16, 32, 5, -5,
+	18, -1, 8, 19, 17, 28, 21, -34, 7, 13, -3, 6, 40, 15, -37, 26,
+	17, -30, 58, -33, -9, -16, -39, -20, 26, 17, 5, 13, 45, 35, 14, -33,
+	-24, -25, -26, 2, -12, -22, 1, -22, 8, 21, -19, 18, -23, -11, 33, 8,
+	-4, -11, 34, -10, 0, -28, 8, -3, -36, 10, 37, -30, -4, 21, -18, -35,
+	43, -9, -41, 2, -6, 5, 1, 24, -43, -12, -9, 4, -3, -68, 23, 22,
+	27, -17, -6, -11, 3, -15, 18, 14, -24, -7, 34, 28, -13, 2, -26, -8,
+	40, 6, -1, -31, -5, -5, 7, -37, 33, 0, 18, -14, 15, -27, 37, -26,
+	-42, -31, -3, 6, -12, -47, -37, 18, 5, 23, -17, -26, 21, 0, -15, 21,
+	4, 9, -19, -7, 34, -31, 23, -32, -28, 0, 0, -32, 4, -2, -13, -15,
+	12, 10, -7, -32, -13, 35, 25, 17, -28, 17, 9, -15, 6, 9, 10, -33,
+	6, -9, -34, 24, 25, 25, 11, 26, -17, -24, -12, -25, 3, -15, 9, -12,
+	28, -9, 13, 13, 25, -24, -10, -12, -20, -25, -11, 9, 36, 30, -23, -25,
+	-4, 18, 19, -13, -2, -43, -44, 23, -11, 47, 52, -37, 20, 37, 27, 19,
+	2, 17, -16, 5, 23, 9, -30, 15, -4, 14, 24, 3, -30, 12, -17, -25,
+	-22, -27, -15, -11, 21, -20, -23, 11, -1, -22, -17, -6, 23, 4, -34, 25,
+	-17, -36, 29, -2, -50, -38, -14, 39, 4, -3, -7, 28, -6, 16, -22, -11,
+	-3, 33, -21, 3, -1, -3, 12, 17, -14, 3, 20, 28, -17, 18, -18, 3,
+	-29, -25, -30, 12, -15, -1, 22, 18, -25, 31, -3, 20, -6, -11, -2, 35,
+	-29, -4, 5, 1, -60, -6, 28, -37, 0, 36, -8, -16, -19, -44, -27, -18,
+	6, 29, 5, 3, -22, 17, -7, -30, 13, 14, -8, 4, 27, -15, -42, 13,
+	-10, -11, -27, -5, -17, 31, 20, -26, -9, 26, -16, -1, 42, -27, -23, -12,
+	-58, 20, 21, -4, 6, 13, 8, -11, 4, 40, 36, -39, 1, 9, 41, -6,
+	5, -23, -10, 18, 29, 26, -19, 26, 2, 24, -29, -20, -19, 1, -24, 17,
+	-28, -19, 0, -13, 2, 1, -2, -2, -38, -18, 5, 12, 4, -36, 19, -20,
+	2, -21, 43, 1, -38, -9, -24, 6, -15, 20, -37, 43, -37, 31, -2, -29,
+	25, -12, -5, 2, 5, 21, -2, 1, -7, 8, 3, 31, -14, 28, -34, 34,
+	-6, -26, 11, -22, -31, 1, -21, 27, 7, -36, 47, -6, -28, 34, 37, -18,
+	31, -37, -8, -28, -29, 20, -15, 42, 6, 22, 22, 42, 5, 2, 32, 18,
+	-1, -19, 33, -23, -15, -8, 15, 28, 31, -15, 22, -30, 33, -11, 13, 1,
+	-3, -4, 24, -24, -23, 34, 26, -28, 9, 53, -2, 7, 32, -24, 50, -28,
+	23, -13, -43, 25, 26, 34, -35, 32, -19, 10, 33, -1, 2, -23, 29, -6,
+	-32, -5, -15, -26, -6, 21, -2, -2, -4, 27, 24, 3, -30, 3, -13, 10,
+	-8, 18, -14, 22, -6, -25, 13, 42, 17, 17, 0, -5, 39, -81, -12, -27,
+	-7, -19, 6, -8, 19, -12, 4, -8, 42, -26, -12, -33, 25, 5, 4, -32,
+	-24, 20, 25, -13, 37, 2, -22, 9, 34, -24, 25, -17, 8, -33, 32, -4,
+	18, 10, -24, 24, 57, 10, -9, -7, -6, -16, 33, -62, 24, -19, -27, -19,
+	-14, 2, -20, -23, 15, 5, -6, -14, -17, 16, -16, -34, 0, 8, -20, 6,
+	-12, 7, 11, -32, 6, 12, 29, 25, 12, -3, 10, -21, 26, -31, -30, 28,
+	-39, -13, 59, 46, -26, 25, 1, -32, 20, -94, -17, -15, -60, -3, -10, 47,
+	19, -8, -14, -10, 49, -23, -15, -9, -19, -33, 16, -6, 7, 6, -2, 17,
+	16, 11, -28, 16, -24, 12, -27, -34, -20, -17, 20, -10, 9, 16, -14, 23,
+	28, 28, 11, -10, -14, -13, 28, 5, -6, -1, 2, 24, -25, -41, -24, 44,
+	32, 5, 1, -28, 1, 11, 4, -12, 14, -1, -30, 23, 12, -14, -25, 11,
+	40, 0, 31, 4, 3, -14, 16, 19, 6, 21, 7, -17, 39, -7, 5, -28,
+	-24, 30, -22, 30, 6, -30, 6, -17, -36, -39, -40, -8, 17, 25, 28, -14,
+	9, -38, 7, -15, 29, 31, -6, 11, -16, -8, -11, -30, 1, 12, 39, 24,
+	22, -32, 29, 21, 38, 20, -18, -17, 31, 1, 15, 0, 45, -33, -10, 0,
+	-33, -35, 26, 6, -30, -23, 12, -23, -20, 3, -17, 2, 42, 20, -18, -36,
+	-6, -31, 8, 31, 6, 26, 5, 22, 0, -23, 17, -33, 22, 13, 26, -14,
+	-9, 7, -18, -34, 1, -33, -2, -32, 20, 35, 3, -30, -27, 44, 7, -24,
+	6, 9, -9, -37, -2, 4, 27, 5, 29, 30, 43, -1, -20, -11, 14, 2,
+	22, -14, -21, -29, -6, -24, 1, 30, 17, -18, 34, -7, 39, 19, -19, 13,
+	1, -3, -1, -18, 8, 4, 27, 38, 25, -36, -2, 27, 8, 18, 20, -53,
+	-21, -38, 31, -1, 29, -3, 21, -2, 22, -29, -19, -8, -25, 7, -13, 8,
+	29, -21, -6, 14, 17, -16, -6, 4, 36, -32, 19, 11, 32, -3, -3, -27,
+	6, 28, -13, 7, 14, 49, 17, 16, -61, 37, -4, 9, 15, -8, -27, 29,
+	-44, 42, 11, 13, 41, -30, -44, 25, 38, 5, -32, 8, 29, 29, -24, 16,
+	32, -27, 24, 0, -13, 33, -9, -26, 17, -4, -1, 14, -16, -29, 27, 9,
+	40, -8, 28, 21, -39, 21, -47, 43, 2, 2, -25, -31, -14, -15, -4, -10,
+	1, -11, 10, 5, 18, 14, 6, -14, -7, 4, -20, -17, -21, -23, 30, -16,
+	-10, -27, 16, -10, -19, -13, -1, 25, 11, 9, 2, -9, -12, -6, 6, 1,
+	-32, 56, -41, 18, -28, -6, 7, 20, 15, -16, 0, 27, -34, -3, 2, -9,
+	16, -21, -59, -1, 15, -7, -16, -6, 13, 2, -17, 26, -14, -19, 25, -28,
+	-15, -15, 0, 31, 11, -31, 27, 1, 15, 11, 9, 11, 36, 16, 21, 61,
+	1, 19, -10, 16, 16, 12, 43, -12, -19, 26, -22, 1, 31, 5, -14, 5,
+	-11, 1, -6, 29, -32, 0, 25, 21, -22, 19, 4, -22, -30, 11, -26, -19,
+	10, 10, -20, 3, -10, 25, 1, -6, -21, -32, 44, 19, 14, 55, 6, 35,
+	-18, 17, -14, -9, -15, -2, -4, -35, -37, -26, 29, -27, 43, -5, -56, -16,
+	-9, -16, -32, -14, 34, -30, 16, 25, 29, 20, 30, -10, 32, -1, -3, 27,
+	-28, -27, -1, 6, 26, 6, -1, -3, -22, 2, 20, 40, -8, 3, 19, -26,
+	-23, 3, 19, -5, -18, -11, 50, 78, -40, -5, 34, -41, -19, 42, 44, 23,
+	33, -6, 16, -27, 7, 16, 9, -28, 7, -34, 24, -9, -34, -28, -13, 15,
+	27, -25, -23, 20, 22, 19, 19, -13, -11, 18, 40, 4, -13, -8, -12, 4,
+	26, 33, -39, -45, 29, 39, -43, -3, 14, 13, -29, 52, 10, -39, -5, -24,
+	-6, -20, 26, 14, 32, -1, -30, -17, 28, 28, 15, 1, 7, 0, 23, 6,
+	-9, -14, 12, 22, -17, -30, -12, -4, -13, -3, 23, -35, 25, 8, 14, 22,
+	-7, 13, 28, 37, -24, -15, -9, -5, -33, 20, 4, 11, -6, -24, -10, -34,
+	-4, 8, 2, -20, -14, -4, -27, -24, -19, 18, -9, -6, 4, -5, -10, -30,
+	17, -3, -8, -45, -29, 31, 6, -8, 20, 3, 22, 29, 25, -36, 6, 20,
+	27, 38, 21, -2, 3, 4, 11, 26, 16, -37, 15, 25, -12, -9, -11, -8,
+	-15, -29, -24, -13, 32, -33, 13, 18, 6, 27, -18, -6, -18, 10, 19, -33,
+	19, -27, -21, 5, -7, 53, 38, 15, -44, 26, -18, 23, -25, -39, 6, 18,
+	9, -11, 42, -14, -50, 20, 52, -21, -4, -25, 7, -21, 11, -4, -28, -25,
+	16, -26, 1, -22, -9, 19, 10, -31, 27, 14, 30, -4, -28, -4, 24, 17,
+	26, 24, 29, 28, 38, 30, 26, 14, 14, 58, -12, -34, -36, -5, 15, -38,
+	30, 27, 37, 14, 3, -41, 15, -30, 32, 28, 26, 22, 1, 28, -17, 11,
+	2, 31, 18, 1, 15, -28, 4, -13, 12, 3, 8, -9, -27, -17, 3, 5,
+	-9, 25, 37, -9, 19, 3, 15, 57, 15, 24, -21, 30, -6, 14, -25, 26,
+	-28, -2, 38, -7, -18, 0, -31, -8, 3, -9, -18, -31, 17, -30, -23, 5,
+	-22, -31, -19, 28, 14, -19, -35, 17, 27, -1, 38, 3, 20, 12, -31, -24,
+	36, 17, 21, 30, 53, 43, 12, -19, -3, 28, -9, -39, 7, 1, -10, 0,
+	24, 1, 26, -11, -1, 19, 20, -2, 15, -24, 8, 31, -5, 23, 5, 32,
+	-30, 17, 27, -30, 14, 13, -6, 17, 1, 10, -5, 13, -4, 3, 32, 22,
+	-19, 15, 31, 39, 13, 10, 20, 34, -13, -27, -36, 30, 11, 1, -8, -8,
+	6, -8, -12, 16, 17, 22, 26, -15, 25, 19, 16, -14, -5, 34, 10, 2,
+	28, 14, -9, 16, -21, 1, 2, -36, -2, 0, 14, -30, -5, 38, -9, 47,
+	33, 49, 5, -26, -28, 48, -9, -23, -11, -26, -6, -4, -5, 24, -32, -31,
+	-13, -19, 19, -24, -27, -25, -15, 11, -24, -10, -26, 23, 0, 32, 8, 6,
+	-23, 20, 9, 26, -41, 28, 44, 31, -18, -37, -43, -64, 36, 13, 43, 10,
+	8, -23, 4, -8, 0, -2, -21, 20, -16, 4, -25, -15, -7, -11, 23, 4,
+	21, 3, -20, 21, 11, -7, 27, -28, 7, 35, 5, -8, -17, 16, -5, -6,
+	-27, 29, 18, 19, 13, 28, 18, -77, -44, -57, 44, -3, -13, -29, 4, 21,
+	-6, -35, 10, -23, 0, 61, 18, 13, -7, 21, -13, 33, -8, -24, -24, -19,
+	8, -17, 28, -16, -18, -30, 14, -26, -33, 27, 32, 9, -29, 1, 12, -5,
+	-7, 1, 6, 2, 14, -76, -56, -11, -25, 10, 22, -13, -23, 38, 30, 22,
+	28, -28, 27, 8, 19, 9, -19, -41, 32, 4, 13, -18, 5, -7, 0, 6,
+	-23, 33, -3, -26, 5, -26, 26, 9, 5, 14, 8, -23, -23, 21, -35, 23,
+	45, 1, -6, -70, -68, -39, 21, 42, 36, -26, -19, 23, 28, 12, -19, -22,
+	-14, 16, 32, 13, -21, 8, 30, 27, -23, -30, 33, 6, 27, -26, 6, 18,
+	-1, 5, -24, -16, -25, -22, 20, -16, -39, -31, -23, 32, -32, 30, -2, -1,
+	-25, -84, -75, -47, -15, 6, 31, 14, 2, 26, 29, -1, 0, -13, -1, -2,
+	36, 12, 16, 18, 34, -6, -15, -2, -15, -26, 17, -28, -16, 27, 5, -5,
+	18, -3, -15, 9, 18, 19, -34, 16, -29, 24, -10, 38, 10, 13, 48, 23,
+	-60, 27, -44, -7, -1, -59, 49, 21, 73, 41, -2, -19, 20, -63, -25, 0,
+	32, -31, -21, -20, -32, -15, 16, -22, 3, 25, -10, -13, -3, -1, 23, 11,
+	-6, 24, -16, -2, -4, 6, -19, 28, 5, -1, -6, 15, 39, -20, -36, -25,
+	-48, 3, 28, -23, 26, -1, 46, 46, -18, -36, 26, -15, -20, 21, -2, -49,
+	-24, -18, -22, -9, -23, -2, -29, 2, 3, -18, 20, 19, -18, 15, -39, -18,
+	-9, -19, 22, 21, -16, 27, -18, 8, -5, 34, 36, 29, -50, 3, -4, 17,
+	-5, -12, 16, -23, 18, 8, 0, 0, -7, 25, 2, 0, 45, -5, -23, 35,
+	-29, -15, 7, -22, -11, 12, 25, -2, -27, 25, 29, 9, -8, 4, -15, -24,
+	20, -12, 12, 24, -34, -17, 8, 33, 33, 18, -35, -44, -16, -8, -43, -30,
+	19, 6, 31, 35, -20, 41, -45, 40, -44, 45, 59, -2, -31, 27, -21, -12,
+	23, 20, -1, -25, 19, 0, 23, -5, 15, 12, -20, -19, -15, 31, -15, 14,
+	-4, 10, -13, 16, -20, 22, 29, 26, -36, 18, 12, -18, -35, -19, -23, -7,
+	7, 35, -3, 41, -28, 53, -65, -9, 30, -29, 28, -15, 0, -26, -8, 30,
+	29, -16, 27, 27, 28, -27, -9, -2, -5, 17, 32, 16, 19, -3, -31, 21,
+	30, -30, -2, 28, -34, 23, -10, -20, 20, 26, 41, -42, 29, -13, 1, -23,
+	21, -7, -28, 15, 20, -37, 1, -13, -3, 6, 3, 6, -18, 33, -14, -31,
+	-11, -27, 8, 25, -27, 29, 19, -17, 24, -19, 3, 8, -31, -1, -13, 32,
+	23, 26, -25, 7, -41, -36, -11, -21, 31, -55, 12, -25, 11, 17, 31, -8,
+	-14, 2, -10, -30, 8, -19, 12, 7, -22, 7, 4, -5, -19, 29, -22, 22,
+	11, -29, -10, -3, -9, 25, 0, -20, 1, 9, 1, 1, 9, -12, 27, 23,
+	-38, -10, -13, 3, 11, -2, 10, -57, -29, -6, -16, -16, 28, 2, -20, -16,
+	33, -8, 31, -2, 18, 19, -29, -29, 6, 23, 7, 17, -12, 1, 33, 13,
+	-26, 22, -9, -31, -1, -4, 27, -7, -5, -14, 28, 31, -25, 0, -42, 42,
+	-45, -6, 10, 12, 10, -27, -32, 23, -39, 6, -16, 11, -7, 8, 17, -21,
+	33, -8, -18, 22, -24, -7, -9, 25, -1, 21, 3, 7, 13, -5, 10, -20,
+	8, -26, 29, 18, -9, 20, -18, 14, -18, 32, 28, -9, -29, 19, -31, -42,
+	-31, 9, 47, -47, 10, -11, -22, 7, 4, -4, -25, 2, -8, -38, 22, 17,
+	15, -26, 18, -21, -19, -21, 28, 28, 11, 25, 17, 21, -16, -26, -24, 26,
+	-15, -13, 14, -28, 15, -29, -27, -9, 0, 45, 17, 5, 21, -30, -2, -34,
+	-25, 36, -54, 25, 19, 3, 0, 45, 8, 54, -2, 26, -40, 39, 8, 27,
+	-33, 31, -31, 13, 24, 8, 15, 9, 18, 9, 32, -5, -22, -26, 16, 27,
+	23, 35, 28, -25, -31, -3, -24, -3, 25, -31, -28, 18, 8, -35, -30, 14,
+	-27, 30, 13, 16, 9, 3, -7, -7, -9, 23, -2, -14, -24, 13, 20, -5,
+	-18, -14, 10, 11, -23, 12, -8, -2, -3, -27, -16, -14, -27, 27, -14, 32,
+	11, 6, 15, -9, 15, 12, -27, -12, -10, 16, -14, -15, -27, 34, -5, 17,
+	6, 43, -15, 6, -41, -7, -8, -7, -2, -13, 5, 26, 7, 17, -6, 27,
+	30, -23, 3, 26, 22, 29, 20, -31, 3, 28, 20, -1, -14, 23, 6, 31,
+	-35, 6, 18, 7, 6, -20, -28, -26, 21, 22, -3, 18, -51, 25, -21, 52,
+	9, -6, 8, 16, 12, -19, 30, -5, -17, 32, 5, -23, -20, -28, -33, -24,
+	11, 31, 23, -20, -3, -31, -12, 3, 13, -26, 22, 11, -3, 28, 27, 18,
+	25, -19, 3, -11, 16, -2, 0, 4, -1, 23, 0, -6, 6, 32, -3, 10,
+	9, -11, -4, 2, -11, -10, -23, -21, -28, 1, 16, -15, -12, -12, -7, 28,
+	24, -19, -3, -23, 7, -24, -3, -21, -15, 12, 19, -11, 20, -35, -3, 55,
+	-33, -9, -50, -40, -7, 58, 17, -12, 20, 17, 27, -6, -5, -32, 4, -11,
+	-58, 18, -13, -2, -16, -22, -7, -26, -15, -14, -33, -10, -20, 30, -7, -19,
+	1, -15, -31, -20, -6, 31, -18, -13, 14, 23, -4, -6, -3, 28, 13, 37,
+	-29, -69, 2, 57, -1, 33, -11, -8, -9, 6, -8, 10, 9, 4, -55, -22,
+	36, 29, -8, -20, 14, -16, -1, 11, -20, 2, 29, 30, -7, -15, -12, 32,
+	-36, -23, -9, 8, 20, -31, 2, -25, -13, 5, -12, 36, 25, -1, -12, -48,
+	10, 39, 9, -2, 15, -23, 23, -40, -37, 16, -23, -16, -44, 24, -13, 14,
+	9, 22, -24, -21, -11, -13, 3, 29, -30, -21, 28, 8, -10, 33, -22, 11,
+	-29, 33, 23, 12, -28, -6, 14, -23, -50, 42, 26, 7, -18, -76, 0, 51,
+	-32, -43, -6, 26, -6, -38, 21, 7, 10, 25, -31, -4, 22, 28, 22, 33,
+	-21, 0, 0, 12, -25, 3, -29, 26, -8, -15, 4, -24, -8, 3, -27, 30,
+	-12, 23, 32, -11, 38, 16, -26, -15, 12, 2, -39, -60, -15, 42, 0, -11,
+	23, 9, -35, -20, -24, -23, -23, 9, -20, 12, 30, -1, -3, -4, 27, -19,
+	-10, 0, -2, -2, 12, -10, -32, 24, 35, 1, 17, 18, -34, 16, 4, 23,
+	11, -28, 25, 20, 43, -10, 70, -40, -41, -34, 17, -61, -19, 20, 15, 11,
+	20, 32, -1, -25, 21, -68, -34, -36, 53, -5, -10, 20, 32, 6, 24, 9,
+	11, 12, -21, -30, -7, -7, 28, 1, 16, 3, -16, -15, 2, -26, -18, -20,
+	-8, -19, 13, 4, 108, -11, -31, 6, 9, -16, 13, -30, 13, -15, -32, -6,
+	-4, 24, -26, -12, -48, 3, 19, 28, 4, 26, 11, 24, -5, -8, 25, 14,
+	20, 9, 32, -21, -32, -7, -2, -27, 4, 7, 27, 23, -11, -2, 38, -16,
+	0, -9, 85, -16, -46, -12, 2, -58, -11, -7, 22, -42, -18, 30, -10, 13,
+	-5, -20, -8, -32, 26, 28, 7, 7, 19, 1, -32, 10, -10, 17, 2, 6,
+	31, 3, 23, -11, 39, -17, 16, 34, -4, -12, -32, 26, 11, 8, -33, -28,
+	83, -45, -30, -22, 19, -43, -16, -14, 2, -25, -35, 11, 9, 9, -3, -27,
+	-31, -18, 30, 3, -16, 20, 14, 28, 26, 19, 1, 22, 27, 7, -2, 29,
+	20, 17, 30, -17, 25, 21, 7, 32, -23, 33, 20, -5, 10, -37, 107, -23,
+	-27, -14, -24, 8, 17, -33, -35, 3, -35, 15, 5, -6, -15, -2, -10, 1,
+	33, 5, 9, 24, -21, -20, 6, -25, 11, 18, 27, 14, -16, -27, 28, -7,
+	-11, 8, 7, -9, -19, -16, -21, 29, 19, -62, -25, 17, 1, -6, -18, 24,
+	-5, 14, 14, -45, 24, -34, -15, -16, 0, 4, -34, -23, -21, 18, 28, 8,
+	4, -11, 22, -28, 0, -16, 14, -18, 12, 5, -27, -18, 14, 6, 6, -16,
+	24, 8, -22, 10, 21, -22, 14, -32, -11, -20, -11, 28, 26, 14, 20, -12,
+	-8, 9, 26, 12, -7, -26, 21, 9, -11, -47, -6, 6, 26, -19, -28, 5,
+	2, 23, 25, -26, 7, 17, 7, -18, -1, 4, 22, -18, -15, -7, -18, -16,
+	-23, -24, 29, 22, 5, -44, -54, 10, -14, -22, 26, 49, -31, -10, 24, 0,
+	25, 27, 37, 17, -14, 6, -10, -22, -18, 20, 15, -25, 32, 15, 0, -22,
+	1, -28, -14, 9, 33, -10, 16, -1, -26, -27, -32, -30, -8, -6, 3, 26,
+	-2, -10, 1, -22, 4, -13, -25, 29, 8, -1, -19, 9, 0, 9, 30, -40,
+	45, 23, 16, -18, 9, 28, 9, 16, -26, -20, 1, -20, -25, 16, 27, -9,
+	-13, -34, -10, -29, 15, -3, -31, -26, -1, -34, 32, -2, -19, -3, -19, -3,
+	1, -16, -15, -28, 20, 23, 28, 31, 22, -8, 26, 7, -17, 23, 18, 23,
+	8, 55, -40, 43, 12, 7, 23, -32, 3, 24, -11, -10, 10, 18, -29, 28,
+	14, -2, -26, -6, -5, 12, -10, 17, -20, -33, 28, 0, 10, -14, -12, 40,
+	0, 1, -31, -30, -5, -16, 24, -22, 37, -10, -4, 25, 29, -37, -2, -4,
+	39, 16, 2, 7, -6, -13, 7, 23, -11, -27, -10, -23, 17, -23, -11, 18,
+	7, -6, -5, 12, 25, -11, -2, -12, 27, -8, 26, -10, -31, -12, -8, 32,
+	20, -38, 13, -30, 24, 15, 34, 9, -16, 20, 38, -39, -16, -38, -22, 8,
+	-19, 7, -26, 2, -10, -15, -32, -30, -8, -9, 11, 20, 24, 0, -12, -11,
+	-25, -30, -34, 22, -25, 2, -14, -8, -31, 17, 0, 21, 3, 36, 19, -23,
+	-11, -25, 17, 14, -23, 12, -19, 17, -16, -23, 14, -22, 31, 20, 32, 30,
+	24, -13, 13, -11, -29, 8, -28, 10, -10, -3, -17, 24, 11, 13, -4, -21,
+	-35, 9, -22, 4, 5, 4, 3, -16, -30, 20, -7, 1, -5, -58, -57, -18,
+	20, -29, -25, 16, 5, -24, 28, 28, 42, -37, 22, 24, 15, 13, -7, 35,
+	-31, -6, 9, 13, -29, -25, 32, 31, -6, 20, -30, -5, -18, 31, 9, -16,
+	-30, 33, -34, 1, -24, 18, -41, 47, 7, 9, 0, 2, -49, -49, 15, 18,
+	34, 27, -42, 17, 12, -8, 10, 0, -11, 26, -4, -1, -26, 19, 6, 27,
+	-27, -6, 10, -27, 20, -11, -1, -22, -17, 27, -13, 16, -3, 8, -3, 4,
+	-11, 6, 13, -5, -22, 3, -9, 23, 28, 16, 33, 40, 10, -5, 42, 64,
+	-21, 10, 5, 76, 8, -22, -41, 9, 11, -8, -12, 4, 1, -9, 21, -22,
+	24, 10, 11, 4, 23, -28, 20, -6, 33, 14, -14, 27, -12, -29, -20, -33,
+	-17, 20, -20, -20, 8, -11, 12, 0, 25, 6, -3, 28, 20, 16, -6, -10,
+	3, 38, 23, 28, -1, -35, 43, -40, 37, -16, 35, 23, 8, 13, 26, -27,
+	28, -7, -2, 24, 29, 16, 1, 30, 14, -33, -9, -1, -17, 24, 8, 24,
+	-20, 16, 28, -22, -2, 28, -6, 49, 6, 38, 11, 48, -26, -7, 29, 58,
+	9, -21, -46, -38, 45, -36, 39, -5, -11, 15, -8, -8, 33, 27, -11, 18,
+	35, -33, 29, 12, -21, -3, -4, 9, 27, -23, 9, 3, -22, 27, -14, 2,
+	21, 15, -8, 13, -19, 44, 3, 4, 51, 71, 4, 2, 18, 6, 27, 12,
+	-43, -34, 27, -13, -10, -22, -26, 17, -25, -23, 5, -33, -21, 17, 3, -15,
+	24, 19, -6, -23, -20, 23, 5, 15, 15, 15, 22, -16, -6, -14, 1, -50,
+	3, 15, 26, 12, -11, 47, 49, 22, -42, 28, 15, 42, -5, 1, 11, -28,
+	3, -9, 21, -34, -1, -1, -10, -7, 8, -24, -3, 19, -13, -4, 8, 0,
+	16, -19, 15, 10, 9, -33, -11, -33, -11, 2, -47, 15, -12, 25, -16, 27,
+	32, -7, 13, 14, 41, 5, 30, 34, 20, 9, 36, 4, -8, -16, -20, -22,
+	-36, -13, 5, -10, -13, 20, 15, -17, 6, 4, 2, 16, -24, -22, 31, -14,
+	-16, 23, -12, 12, -23, 16, 15, -22, -22, -17, -28, -5, -46, 2, 38, -24,
+	28, -27, -3, -39, 31, 24, 7, -2, -23, 9, -17, -2, 5, -7, 15, -14,
+	7, -23, -23, 31, -3, -30, -35, 15, -20, -21, 0, 4, 10, 29, 14, 28,
+	-9, 9, 24, -5, -30, 21, -24, 5, -3, -46, -44, 9, -12, 5, 25, -4,
+	25, -34, 26, 16, 14, -25, 19, -22, -26, -24, -18, 11, -30, -8, 27, -15,
+	-26, -11, -26, -18, 20, -24, 6, -14, 12, 27, 16, -5, -7, -26, 29, 25,
+	-34, 2, 27, -14, -27, -26, -31, -19, -64, -18, 14, 9, -1, -27, 34, -14,
+	1, 20, 24, -35, -4, -21, -30, -7, -15, -2, -25, -23, -2, -8, 1, 7,
+	1, 8, 13, -31, 27, 12, -21, -28, -29, -8, 5, -22, 6, 33, -27, -26,
+	25, 14, -18, 32, 12, -45, -37, -14, -25, 21, 32, 15, -12, -39, 23, 35,
+	-2, 3, 7, -40, -18, 13, 24, 5, 32, -4, -33, 22, 24, 13, -28, 21,
+	8, 30, 17, 2, 0, -5, 2, 29, 16, 16, 25, -16, -31, 7, -13, -24,
+	23, 27, 14, -4, 19, 23, -17, 10, -14, -2, -52, 2, -57, 6, -71, 33,
+	-11, -9, 18, -33, -8, -27, 7, 42, -17, 10, 3, -11, -10, 30, 33, 9,
+	-10, -19, 15, -6, -9, -3, 6, 18, 5, 11, -2, -6, -24, 5, 18, -15,
+	22, 29, 7, -20, 14, -41, -11, 43, -1, 44, -30, 13, 15, 14, 26, 0,
+	-29, 11, 1, 3, -1, 12, -8, -22, 13, 16, -11, 1, -19, 25, 7, -18,
+	-11, 26, -28, -3, -1, 21, 8, 3, 38, -21, 23, -26, -7, -23, -3, 44,
+	12, 28, 8, -5, -38, 0, -39, 29, 9, 13, -15, 19, 19, 30, -24, -35,
+	9, 12, -3, -10, 32, -27, 31, -30, -8, -34, -28, 27, 31, -25, -8, 2,
+	0, 7, -1, -23, 24, -4, 12, 10, 32, 0, 2, 4, 20, 2, 13, -32,
+	12, -2, 26, -21, -17, 9, -1, -5, -59, 8, 24, 28, -15, 0, 14, 34,
+	-19, 28, -24, 22, -5, 14, 10, -22, -29, 1, -23, 14, 33, -5, 7, 13,
+	-9, -29, 32, -16, 32, 7, 16, 17, -8, 10, -29, -19, -15, 33, -5, -36,
+	-24, -7, -20, 24, 17, 19, -4, 36, -17, 26, 29, -11, 10, -13, -17, -11,
+	-18, -32, -15, 12, 22, -17, -22, 19, -8, 9, 11, -7, -34, -33, -29, 11,
+	21, -13, 13, -29, 8, 12, 30, 10, 34, 11, 34, 71, 26, 4, 17, 41,
+	-4, -18, 2, -33, -35, -47, 29, -26, -22, 14, 22, -16, 8, -3, -22, -11,
+	27, 1, -29, -26, -11, 27, -32, 6, 2, -2, -22, 12, 0, 3, 3, -29,
+	-19, 25, -11, 16, 8, 9, -30, 31, 19, 55, 34, -7, -14, 30, -7, -72,
+	39, -14, 17, 15, -3, 20, 34, -24, 9, 16, -13, -7, 25, 28, 24, -3,
+	12, -13, 11, -26, -36, 34, -8, -30, 10, 33, -4, 29, 7, 2, -21, 16,
+	0, 25, 14, 24, 17, -23, 49, 60, 11, -12, 6, 6, -34, -41, 39, -11,
+	3, -9, 3, 24, -3, -8, -3, 24, -19, 25, 15, -29, -37, 24, -18, 13,
+	27, -1, -31, 21, -16, -1, -12, 0, 10, -13, -34, 35, -12, -7, -25, 3,
+	13, -34, -14, -9, 30, 47, -3, 3, 10, -8, -41, -71, -24, 17, 36, -35,
+	12, -11, 3, 10, 31, 26, 6, -7, -22, -17, -18, -20, 17, -28, -25, -26,
+	20, 20, 11, 17, -33, -11, -3, 20, -13, 36, 14, 25, -17, 28, 12, -40,
+	8, 4, 38, 61, 4, -31, -13, -6, -39, -76, -19, -1, -26, 3, -35, -6,
+	-26, 12, 3, -20, 38, 27, 29, -6, 10, -5, -21, 16, -5, -29, -16, 2,
+	12, -5, -7, 26, 10, 17, -27, -14, -12, 17, 10, 6, 4, 18, -28, -39,
+	1, -23, 33, 4, -30, -39, 27, -39, 27, 1, -3, -21, -17, -59, 3, -24,
+	-13, 18, 24, 10, 17, 20, -32, -10, -30, -31, -33, -16, -20, -26, 22, -16,
+	-19, -16, -20, -17, 11, -33, -18, -25, -2, -19, 4, -40, 2, 17, -19, 29,
+	-22, 34, 7, -19, 21, -45, 31, -33, -4, 21, 18, -37, -13, -13, 13, -1,
+	46, -16, -15, -13, -14, -23, -16, -28, 12, 9, -20, 32, 9, 12, 8, -18,
+	-9, -17, 6, 20, 9, 17, 28, 3, 11, 0, -33, 54, 6, -18, 28, -8,
+	-53, -14, -15, -46, -7, -6, -33, 26, -5, -38, -9, -18, 10, 9, 23, 13,
+	-12, -22, -28, -19, -16, -1, 31, 16, 14, -13, -19, 28, 4, 22, 26, 26,
+	28, 30, -19, 19, 30, -26, -36, 24, -2, 19, 36, -14, -31, 24, -43, -9,
+	-37, -19, 5, 9, 1, -18, -37, 28, 20, 39, -46, 38, 32, 19, -12, 31,
+	11, 8, -30, 28, -22, 16, 11, 8, -28, 23, 19, -22, 2, 16, -26, -29,
+	-9, 16, 25, -31, 4, 7, -17, -2, -8, 18, 1, -11, -25, -40, -13, -37,
+	24, -12, -51, -14, 25, -3, 5, -9, -26, 25, 16, -47, -6, 20, 30, -27,
+	25, -23, -15, 26, 18, 10, 23, 5, 4, -11, 28, 0, 26, 26, -6, -8,
+	-12, -11, 25, -44, -10, -59, 25, 35, 24, -26, -25, -24, 23, 17, -30, -5,
+	31, -45, 31, -22, 24, 31, 0, 0, 36, 1, -4, -3, -14, -23, -1, 9,
+	-15, 12, 6, 9, 20, 8, 31, -17, -7, 32, 10, -10, -5, -24, -19, 3,
+	-6, -18, -16, -12, 16, 4, 8, -25, -55, 9, 40, 16, 4, 0, 35, 8,
+	56, 7, 36, 29, 15, 1, -7, -1, -24, 20, 2, -5, -2, 31, -17, -25,
+	13, 25, 23, -30, -27, -11, -15, 17, 8, 15, 37, -16, -2, -21, -14, -35,
+	-29, 16, -8, 45, -8, -6, -25, -11, 6, 43, -36, 8, 21, -21, 13, -34,
+	14, 16, 24, 14, 16, 15, 4, 22, 19, 33, 16, -11, -2, -11, -27, 27,
+	-16, 27, -6, 31, -9, -5, 30, -15, 8, 13, -30, -28, -13, -49, -13, 5,
+	42, 11, -4, -2, -46, -37, 53, 56, -41, -2, 7, -57, -23, -45, 25, -17,
+	29, 1, 30, -22, -1, -16, -24, -31, 25, -9, 22, 2, -26, -15, -12, -14,
+	-28, 0, 21, 30, 7, 11, -18, -8, 32, -13, -15, -65, 0, -14, 31, 12,
+	-29, -11, -49, -50, 38, 61, -13, -34, -10, -35, 34, -43, -9, -33, 23, 22,
+	42, 15, -29, -30, 11, -2, -2, 11, 14, 26, -19, 10, 13, 9, -28, -28,
+	-20, -6, 19, 34, 23, -17, 18, 9, -30, -16, 32, 25, -58, -4, 28, -6,
+	-28, 58, 9, 6, 47, 8, 20, 12, -20, -50, -2, 3, -39, 10, -42, -25,
+	10, -4, 16, 3, 28, -7, -21, -1, 21, -27, 16, 1, 13, -24, -25, -23,
+	-17, 27, 3, -25, -22, -13, 13, -1, 38, 25, -24, -18, -36, 20, -12, 58,
+	-30, -4, 7, 48, -10, -21, -15, -6, 1, -2, -22, -59, 7, 0, -30, -27,
+	37, -6, -10, -30, 28, -25, -25, 5, 11, -23, 10, 14, 17, -26, 15, 1,
+	28, 8, 24, 27, 8, 31, 4, 18, -56, -1, 11, 22, -5, 18, -36, -29,
+	-12, -13, 5, -9, 14, -18, -18, -8, -38, 14, 29, 15, 25, -29, 33, -18,
+	-10, 7, -22, -12, -6, 7, 14, 18, 22, 8, -23, -31, 10, 26, 0, -27,
+	5, 10, -9, 17, 44, 29, -7, 30, 12, -7, 49, 25, -7, 42, -21, -35,
+	-31, -5, -8, -5, -1, -22, -7, -4, -54, -8, -22, 0, -7, -11, 0, -10,
+	25, -19, 3, -33, -25, -31, 39, -9, -26, 13, -30, 17, -30, 20, -28, 1,
+	36, 16, 25, 20, -10, 34, -13, -7, 63, 2, -6, 26, -33, 4, -5, 16,
+	-9, -39, -26, -29, 89, 37, -4, 18, -20, -6, 19, -17, -25, -3, -27, -20,
+	34, -26, -15, -33, 14, -6, 20, 19, 17, -10, 6, -10, -30, 32, -5, -46,
+	-2, 17, 58, 27, 17, 10, -21, 5, -8, 40, -26, -4, 10, -27, -46, -6,
+	-16, 15, 58, 2, -5, -14, 3, -30, -32, -15, -30, 12, -10, 25, 5, -33,
+	-18, 24, 20, -29, 11, -22, 24, -27, 26, 24, -3, -25, 43, -11, 6, 25,
+	73, 1, 25, 1, -26, -34, -5, 44, -18, -28, 18, -64, 13, 40, -5, -24,
+	27, -16, -12, -48, 15, 2, 21, 12, 26, -22, 33, -13, -12, -2, 26, 31,
+	-21, -19, 2, 23, 32, -17, 25, 15, 30, -10, 26, 6, -6, 28, 66, 40,
+	16, 15, -29, -40, 8, 16, -6, -57, 12, -32, -11, -3, -37, 15, 38, -8,
+	-18, 19, 35, 2, -4, 28, 21, -3, -25, 22, 26, -30, 37, 30, 7, 23,
+	2, -13, 13, -13, 38, -25, 12, 2, -18, -1, 5, 6, 31, 36, 28, 32,
+	-10, -40, 22, 8, -9, -40, -5, -8, 5, 16, -39, -29, 39, 11, -16, -23,
+	16, 7, -6, 1, -16, 31, 11, 29, -19, -27, -17, 23, -15, -23, 5, 5,
+	-9, -7, 14, -32, 10, -26, 17, -15, -20, 2, 54, 24, 22, 4, -24, -61,
+	2, 8, -25, -35, 16, -30, -37, 50, -33, 5, 40, -10, 35, -57, 30, -24,
+	-28, 23, 25, -10, 2, 13, -5, 29, -19, -32, -14, 6, -11, -11, -5, 6,
+	-2, 15, -8, -2, 2, -10, 14, 32, 2, -26, -8, -14, -37, 72, -40, -59,
+	28, 6, 1, 10, -10, -23, -3, 25, 2, -28, 15, 0, 0, -4, 27, -31,
+	-1, 25, -17, 33, -20, 12, 8, -29, 22, 23, -2, -31, 32, -1, -22, 3,
+	-15, -26, 30, 3, 6, 7, -33, 24, -27, 30, -6, 53, -41, -37, -1, 16,
+	43, -5, -14, -19, -6, 5, -36, 12, -11, -13, 16, -10, 18, 32, 15, -7,
+	-9, 1, -1, -10, 29, 6, -15, -16, 8, -6, 7, 14, -29, -1, 7, 6,
+	-11, -4, 33, 11, -45, -8, -31, -19, 10, 41, 2, 16, -10, -26, -32, -38,
+	-10, -17, -10, 18, 3, -26, 35, -7, 24, 11, -30, 24, -21, 21, -33, 12,
+	-12, -6, -9, -28, 17, -14, -2, 21, -10, 5, -39, -1, -15, 3, 30, -40,
+	31, 13, -37, -3, -45, -13, 1, -5, 10, 20, 14, -24, -30, -29, -21, -30,
+	-27, 22, -49, 3, -3, -37, -15, -12, -19, 2, -21, -8, 2, 11, 31, 20,
+	-11, 18, -6, 1, -12, 9, -22, 22, 3, -3, -5, -10, 28, -28, 27, -45,
+	3, -41, -57, -4, -43, 19, 13, 22, 16, -22, 25, -22, 4, 10, 19, -12,
+	21, -6, 48, -29, -8, 0, 2, 1, -10, -1, -6, 8, 5, -3, -8, 33,
+	-21, -17, 29, -1, -27, 13, -20, 34, 4, 19, -19, 26, 27, 21, 20, -50,
+	28, 20, 2, -20, 24, 17, 4, -11, -27, -11, -25, 21, 12, 13, 0, -2,
+	36, -6, 11, 11, -31, 26, 0, 11, 17, 7, 33, 6, -18, 4, 34, -8,
+	34, -3, -31, 9, -25, -22, -25, 31, 14, 15, 26, 38, 34, -48, 3, -4,
+	-12, -10, 3, 9, 26, -19, 27, -4, -3, -20, 13, -24, -25, 23, 17, 21,
+	17, -12, 21, 10, -13, -19, 13, -22, -30, 31, -26, 7, 9, 15, -19, -10,
+	18, 16, -36, -26, -2, -29, -9, -10, -9, 11, 22, -48, 39, 9, 7, -8,
+	-35, -20, 6, -5, -31, -1, -29, -52, -24, -1, -12, 6, -17, -11, -16, -16,
+	-23, -15, -18, 1, 32, -17, 16, -16, -5, 8, -29, 4, 10, -1, -1, -3,
+	-29, 29, -32, -22, -5, -24, -13, -5, -25, -18, 48, 15, -16, -2, -34, -10,
+	24, 26, 14, -48, 0, -32, 14, -7, 2, -51, -5, -9, 28, -17, -18, -2,
+	17, 23, -8, -12, 13, -19, 21, -24, 18, 3, 34, 7, 4, -31, -25, 7,
+	-7, 32, 12, 9, 10, 17, 6, -48, 13, 13, -23, -5, -6, -11, 49, -26,
+	14, -16, -18, -57, -11, -9, -5, -26, 0, 15, 17, -22, 31, 33, 6, -24,
+	-5, 4, 12, -17, 21, 19, -19, 16, 33, -15, 1, 26, 11, 24, -22, 32,
+	-46, 37, 65, -24, 35, -23, -14, 7, -5, 0, -7, -28, 6, -1, -32, 5,
+	-3, 13, 8, 8, 29, -28, -35, 2, -29, -24, -17, -1, 28, -22, 32, 14,
+	16, -32, -27, 16, 3, -16, 5, -33, -2, 7, 4, -29, 21, -20, 6, 0,
+	19, 1, 10, 7, -4, -34, 10, 22, 30, -29, 9, -37, -10, 6, -41, 24,
+	-2, -35, 7, -9, -11, -1, -12, 23, 4, -33, -9, 28, -16, -11, -5, -24,
+	-9, -24, 12, -29, 20, -4, 6, -9, 24, -31, 25, -19, -36, 13, 16, -18,
+	45, -23, -30, -23, 8, 15, -29, -17, -37, -45, 55, -8, -19, 17, 8, -29,
+	34, -4, 22, -23, 30, -17, 14, 1, 36, -30, 12, 25, -14, -30, -27, 17,
+	-7, 6, 7, 18, -31, -14, 27, 25, 14, 22, -1, -33, 21, 29, -1, -7,
+	33, 20, 7, -6, -2, -37, -20, -10, -30, -10, 0, 24, 10, -1, 37, 3,
+	23, 21, -8, 23, -10, 30, -12, -17, -12, -30, 9, -3, 21, -6, 15, -32,
+	3, -5, -28, 14, -8, -6, 5, 27, -47, -1, 29, 22, 21, -16, 29, -22,
+	-10, -14, -23, -8, -4, -24, -10, 41, -15, 21, -28, -5, -4, -43, 10, 23,
+	23, 30, 2, -19, 8, -17, 11, -2, -4, -23, -25, -27, -5, 28, -27, 17,
+	19, 31, -32, -11, -25, -14, -44, -4, -24, -6, -51, -45, 33, 10, -17, -24,
+	70, 4, 11, -6, 36, -59, 17, 36, -13, 45, -39, 36, -43, 8, -3, 25,
+	-25, -9, 17, 20, 12, -20, -6, 9, -4, -9, 1, 19, -30, 30, 13, 3,
+	0, -1, 8, -20, -33, 3, -43, -13, -46, 2, -3, -8, -21, 23, 3, -25,
+	-34, -13, 40, -9, -17, -12, 14, -8, -29, 45, -17, 9, -14, 22, -33, 27,
+	4, -16, -14, -16, 12, 16, -24, -18, 32, 26, 24, -9, -20, 25, 8, 13,
+	-21, 12, -2, 18, -13, -23, -59, -6, 43, 14, -12, -24, 32, -27, 42, 3,
+	12, -22, 47, -10, 1, 48, 24, -1, 17, 27, -31, 18, 0, 12, -12, 19,
+	17, 27, 3, 28, 21, -19, -13, -14, -13, -27, 6, -20, -28, -4, 31, -3,
+	-14, -1, -46, 7, -36, -28, 33, 4, 19, 26, 9, 19, 66, -11, 6, -21,
+	20, -14, -20, 36, 15, 14, -47, -9, -7, -7, 11, -26, -6, -23, -5, 32,
+	25, -2, -12, -17, -33, 25, 21, 26, -5, -4, 13, 22, -5, 30, 14, -45,
+	-29, -21, -39, -28, 8, -23, 30, -9, 61, -39, 12, -20, 11, -26, 1, 27,
+	30, 9, 13, 7, -8, 13, -16, -25, 17, -5, -19, -23, -34, -29, -31, -24,
+	-24, -2, -25, -30, 5, -17, -25, -1, -20, -10, -5, -12, 29, 11, 16, -9,
+	19, -25, -51, -51, -11, 4, 16, -10, -1, 35, -48, -84, 41, 4, -20, 27,
+	27, -17, 20, -8, -23, 8, 31, 29, -20, -3, 30, 23, 22, -20, -15, 25,
+	33, 15, -12, 11, 3, -5, -30, 27, 12, -23, 9, -1, 42, -18, -3, 20,
+	-6, -24, -40, -22, -22, -20, 18, -17, -31, -71, 7, 5, 28, 10, 49, -15,
+	32, -36, 11, -10, 14, 6, -29, -14, 18, 32, -22, 17, 14, 21, 2, -11,
+	3, 17, 11, -24, -31, -18, -20, 10, 41, 17, 3, -21, -22, -34, -7, -60,
+	-6, -21, 8, 18, 24, 28, -16, -34, -3, -19, -43, 23, 59, -14, -17, -32,
+	-9, 23, 34, 8, -24, 25, -8, 33, -32, 10, 23, 3, -13, 18, -17, -23,
+	-17, -28, -24, 18, 27, 34, 51, -6, 40, -40, 17, -30, -13, -55, -17, 0,
+	-17, 12, -4, 19, -18, -15, -42, -6, -11, 9, 48, -36, 17, -19, 23, -17,
+	-14, -13, -27, 18, 3, 11, 32, -20, 8, -5, 0, 5, 2, -22, -10, -15,
+	-6, 8, 32, -27, 42, 19, 0, -37, -29, -16, 2, -30, -61, -10, -2, 15,
+	-20, 31, 5, -64, 15, -25, -35, 20, 56, -12, -13, 27, 27, -25, -7, -27,
+	-5, 17, -17, -12, -4, 10, 14, 6, 25, 16, -14, 33, -10, -6, 13, 19,
+	21, -31, 30, -26, -10, -7, 63, -28, -9, -7, -4, -46, 32, -47, -15, -18,
+	23, -68, -36, -20, 10, 15, 19, -17, 22, 20, -13, -23, 1, -4, 26, -7,
+	-14, 18, -30, 1, -19, -5, 33, -22, 19, -21, -19, -12, 27, -32, -7, 14,
+	-13, -13, 12, -25, 49, -15, 1, -18, -17, -21, 10, 2, -10, -10, 21, -68,
+	-9, 6, 10, -13, 49, -4, 15, 4, 12, 23, 30, 16, -27, -33, -1, -6,
+	-7, -17, 13, -22, 15, -21, 17, -31, -20, -14, 30, -6, -5, 32, 40, -15,
+	16, -33, 27, -28, 14, -4, 16, -13, 25, -4, 20, -16, -2, -32, -11, -38,
+	-27, -52, 33, 10, -17, 4, -10, 24, 32, -23, -30, -4, 22, -16, 19, 15,
+	-13, 7, -2, -28, 4, 3, 23, -23, 45, 12, 13, 27, 9, 8, -16, -9,
+	18, -27, 8, 21, 8, -21, 33, -7, -22, -22, 19, -50, -31, -8, 27, -15,
+	44, 22, -27, 19, 28, -28, -30, -32, -18, -31, -27, -25, -30, 13, 17, -23,
+	-25, -16, 49, 1, -17, -9, 21, 31, -6, 27, 20, -11, -4, -15, 55, -22,
+	12, 34, 2, -62, 42, 18, -2, 13, 3, -69, -17, -27, -11, -28, 46, -7,
+	7, 15, 4, 24, 29, 10, 32, -16, 9, -1, -14, 12, 26, -29, 32, 22,
+	17, 5, -34, -12, 33, 1, -31, 23, 6, -6, 18, -16, 24, -4, -38, 13,
+	27, 16, 35, -36, 0, -3, -26, 4, 6, 4, 14, 7, -33, 27, -14, -14,
+	-1, -19, 5, 6, 11, 30, 18, -32, 24, 21, -5, 10, -27, 9, -29, 24,
+	12, 30, -2, -15, -25, 26, 22, 28, 10, 1, -9, -11, 11, -14, 39, 20,
+	-3, 3, 6, 28, -35, -17, 5, 46, 27, 5, -39, -24, -28, -9, 6, 12,
+	16, 32, 22, 16, 10, 23, 21, -5, -19, -21, -13, 20, 4, 1, 31, -18,
+	18, 26, -22, -16, 24, 5, 25, 26, -27, -23, 5, -16, 8, -10, 28, 16,
+	58, -27, -31, 29, 43, 39, 17, 39, -30, 15, -30, 21, -11, -11, -3, -5,
+	1, -5, 1, -5, -8, 5, -6, -3, 27, 9, 3, -9, 19, -22, -20, 6,
+	-33, 6, -9, -16, -9, -18, -27, 18, -4, -24, 15, 35, 57, -19, 3, 26,
+	33, -41, 7, 25, 36, -17, 3, -27, 5, 16, -1, 34, -3, -31, 17, -2,
+	-3, -15, 21, 2, 22, 26, 3, 23, 26, -2, -13, -10, 21, 1, 14, 34,
+	7, -31, -1, 22, -29, 27, 25, 40, 9, 32, 18, -4, 46, 30, 39, 10,
+	21, -8, 32, -23, 6, 15, -27, -11, -13, 33, 4, -14, 19, -30, 30, -12,
+	9, 4, -19, 2, 17, -14, -30, 15, 22, 14, 4, 31, -3, 9, -11, -18,
+	25, 24, 54, 14, -12, 15, 35, 1, -14, -31, -24, -15, 9, 16, -4, 4,
+	8, -41, -49, 1, 0, 34, -23, 26, 21, 4, -9, 16, 26, -9, 6, 28,
+	-25, -13, 4, -9, 9, -23, -7, 9, -27, 2, -8, 3, 23, 20, 18, -2,
+	28, 33, 17, -18, 2, 15, 13, -27, 2, 12, -22, 5, -3, 19, -14, -8,
+	12, -37, -18, 36, -13, -4, 19, -22, 15, -24, -33, -1, 11, 33, 27, -12,
+	-36, 26, -2, -3, -12, -1, -14, 14, 24, 7, 26, 20, 0, -11, 1, -15,
+	3, -6, -22, -6, 39, -58, 37, -24, -31, 34, 27, 9, 14, 4, -48, 7,
+	10, 32, -6, 10, -34, 19, -25, 11, -32, 1, 21, -26, -17, 19, -17, -2,
+	-23, 25, 10, 12, 1, -21, -3, -13, 8, 12, 7, 13, 2, -2, -6, 18,
+	-26, -27, 5, -30, -13, 9, -13, 12, 3, 34, 13, -36, -6, 30, 13, 25,
+	5, 30, 8, 2, -23, -23, 17, -20, -22, 31, 25, -10, -24, -20, -36, -20,
+	-21, 30, -12, 29, -4, 3, 15, -8, 1, 4, 31, 18, -26, 21, 23, -33,
+	-17, -39, -26, 7, -13, -10, 5, -15, 12, -48, 1, 58, 11, 8, 14, -4,
+	-37, 32, -14, 26, -16, 4, -15, 8, 5, -13, 13, -30, 18, -9, -13, 1,
+	-7, -18, 7, -29, -8, -39, -49, 49, 12, -31, 5, 13, -11, -34, -6, -21,
+	-34, 4, -23, -91, 11, -31, -19, -4, 18, -21, 26, 15, -8, 12, 0, -14,
+	-12, 26, 11, 29, 7, -7, 20, 27, -12, -27, 13, 18, -12, 17, 24, 6,
+	10, -10, -4, -37, -10, 61, 12, -41, 21, 7, -8, -31, 29, -20, -25, -4,
+	-5, -72, 20, -17, -19, 32, 18, 13, 31, -1, -18, 16, 20, -8, -30, -5,
+	-11, 0, 30, -14, -28, 7, -10, 10, 8, -4, 14, -19, 2, -1, 28, 1,
+	-10, -4, -48, 54, -3, -23, 47, -5, 2, -50, 13, -49, 3, 23, 19, -65,
+	19, -29, -3, -7, 5, -10, -15, -31, -30, 29, -25, -32, -19, 16, 33, -19,
+	22, -25, 8, -7, 26, -23, -5, -16, 11, -33, -5, -33, -22, 32, -3, -6,
+	9, 51, 14, -23, 38, -47, -34, 14, 49, -39, -12, -31, -15, -43, -18, -25,
+	-15, -2, 41, 11, -25, 20, -21, 5, 14, 5, -1, -16, -9, -19, -27, 20,
+	21, -29, -12, -17, 27, -27, -21, 12, -2, -28, 6, -1, 19, -21, -37, 56,
+	37, -21, 32, -50, -32, 0, 47, -37, 11, -14, -25, -72, -13, -29, 6, -1,
+	-3, -4, -28, -9, 33, 16, -12, 10, 3, -1, 15, 14, -14, 21, -33, 23,
+	20, -15, -4, -23, -9, 31, -30, -4, 34, 24, -9, -7, -24, -41, -34, -9,
+	10, 8, -9, 9, 20, 39, 44, 24, 14, -4, 49, -14, -1, -3, -4, -19,
+	-22, 2, -13, 16, -17, -16, 8, -29, -22, -28, -7, -5, -31, -33, 16, 23,
+	-6, 8, 27, -16, -9, 1, -11, -23, -9, 10, 7, -38, -29, -21, 50, 34,
+	20, -3, -2, 36, -9, -21, 2, -9, 18, -27, -25, 10, 15, -16, -3, 35,
+	-6, 23, -20, 33, -22, 11, 12, -26, -10, -13, 20, 0, 10, -17, 15, 14,
+	-33, -21, 20, -9, 20, -8, 8, 27, -25, -25, 14, 12, 41, -14, -7, 19,
+	41, 33, 26, -13, 3, 9, 7, 27, 41, -2, -4, -2, -21, 7, 6, 21,
+	-8, -30, -29, -29, -21, -7, -13, -21, -30, 12, 22, 1, -23, -15, -25, 14,
+	-22, -13, 19, -25, 37, -14, -35, -37, -28, -16, 21, 18, 10, -5, 14, -15,
+	-6, 36, 28, -40, 36, 5, 23, 36, -59, -35, -18, -5, 1, -2, 18, -17,
+	-13, -9, 19, 4, 15, 30, -20, 8, 22, 10, 20, 22, 25, 24, -23, 20,
+	19, 0, -17, -3, 11, -2, 3, -9, -6, -19, -20, -7, 40, -42, -13, -10,
+	-10, -49, 11, -19, -10, 18, -22, 0, -36, 40, -26, -31, -24, -30, -26, -4,
+	30, -6, -35, -8, 7, 18, -13, -1, 20, -14, -28, 34, -6, -23, -34, 29,
+	-22, -10, -27, -33, -37, 19, -43, -17, -44, 16, -21, 14, -24, 40, 23, 19,
+	44, -47, 38, -16, 27, -30, -4, 16, 21, -12, 7, -25, 3, 7, -16, -6,
+	-27, -10, -14, -25, -27, 27, 19, 8, -4, 30, -30, -24, 17, -19, -36, -4,
+	24, -10, -66, 16, 6, 30, -36, 15, -6, 15, -51, -30, 8, -13, -13, -10,
+	7, -5, 6, -21, 12, 6, 3, -22, 3, -29, 4, -23, 4, -14, -21, 30,
+	18, 3, 25, 28, 0, -30, -9, 12, -25, -15, -34, -24, -43, 8, 20, -43,
+	-69, -6, 4, -22, 26, 2, -17, -18, 11, 33, 13, -1, 30, -14, -33, -28,
+	12, -10, -39, 33, -27, 13, 10, 21, -15, -23, -28, 4, 30, 15, -22, 10,
+	-30, -12, -3, -13, 14, 34, -18, 27, 6, -6, -7, -39, 2, 12, -16, 38,
+	2, 33, -4, 0, -10, 14, 1, 22, 22, 1, -20, -49, 5, -41, 8, -4,
+	20, -8, -13, -30, -3, -1, -2, 32, -27, 29, -5, 17, -2, 2, 26, 0,
+	2, -28, -29, -16, -10, 26, -10, -29, -33, -16, 22, 16, -55, 11, 47, -24,
+	51, -1, -18, -2, 43, 38, 10, -19, 25, -22, -40, -31, 0, 8, 23, 39,
+	19, -27, -10, 18, 19, 2, -10, 4, -32, -6, 9, 25, -18, -29, -10, 16,
+	8, 26, -4, 32, -15, 25, 13, -7, 32, 47, 17, -14, -8, 35, -2, 32,
+	44, -2, -26, -8, -14, 51, -8, 21, 6, -29, 5, -5, -7, -8, 4, 12,
+	-8, 7, 29, -32, -7, -26, 28, -21, 17, -4, -6, 6, 18, -31, -22, -6,
+	-7, -2, 16, -23, -14, -5, 37, 35, 37, -7, -8, -5, 4, -12, 13, 4,
+	-30, -7, -7, 51, -5, 8, 14, -41, -9, 14, -13, -2, -15, 27, 20, -22,
+	-3, -11, 3, -33, 25, -29, -21, 2, -4, 14, 13, 15, -1, -22, 2, -23,
+	16, 25, -9, -7, 31, 50, 11, -3, -2, -21, 18, -21, 38, 35, -19, 23,
+	-16, 37, -11, -2, -7, -42, -20, -29, -13, -29, 35, 22, 14, -33, -19, -10,
+	10, -1, 0, -26, 16, 23, -18, -6, 11, 29, -9, -2, -28, 1, -24, 4,
+	6, -11, 3, 51, 6, -34, 24, 30, 29, 28, 23, 23, -5, -26, -25, 59,
+	13, -27, -15, -34, -30, 41, -52, 4, 36, 21, 9, -8, -10, 8, -19, 20,
+	-16, 17, 37, -13, 19, -34, -12, -25, -1, 1, 32, 27, -7, -29, 12, 9,
+	-2, 19, -23, 13, -24, -6, 48, 26, 5, 34, -30, 20, -29, 46, 5, -10,
+	6, 0, -25, 25, -34, -5, 29, 14, 8, 21, -7, -17, -8, -24, 14, -11,
+	-8, 18, 5, -5, -15, -32, 32, -3, -31, -18, -15, -17, 21, -9, 22, -7,
+	-24, 9, 5, -12, -3, -45, 49, 22, 27, -37, 21, 33, -56, 21, -5, 31,
+	25, 11, 12, -26, -27, 27, -12, -11, 20, 17, -1, 32, 27, 21, -14, -15,
+	-13, 27, -25, -7, 1, -5, 4, -8, 10, 25, -21, 25, 9, -20, 32, 7,
+	-21, -31, 1, -50, 45, 53, 2, -3, -18, -25, -42, 45, -4, -9, 19, 19,
+	9, -29, -9, 8, 9, -12, -3, -18, -13, -27, 30, 5, 27, 16, -20, 17,
+	15, 10, -14, 1, 3, 13, -18, -6, -6, -7, 0, 4, 24, 51, -2, 12,
+	49, -11, 20, 4, 25, -29, 9, 20, -42, 23, -25, 30, 28, 7, 8, -16,
+	16, 32, -22, -21, 23, 30, -16, -9, 8, -31, -12, 22, -31, 14, -29, -25,
+	-30, -32, -2, 0, -16, 27, -31, -39, 8, 8, 0, 40, 19, 2, 36, -47,
+	8, -25, 16, -21, -39, 9, -26, 9, 42, 43, 38, 15, -33, -6, 18, -30,
+	6, 21, -25, 2, -24, 33, 6, 21, 8, 10, 22, 1, 11, 17, 19, -26,
+	-7, 33, 15, 29, 7, -39, -28, 11, 5, 15, -22, -17, 26, -60, 23, 11,
+	31, -14, -41, 7, -29, 20, -8, 41, 22, -4, 6, 2, 23, 7, -29, 30,
+	-29, 21, 21, -23, -10, -27, 11, 26, 26, 0, 4, -6, 5, 12, 12, 13,
+	-7, -2, -22, -27, -6, 23, -25, 23, 35, -25, 14, 13, -20, -26, 16, 5,
+	7, -28, -8, -8, -10, -57, -41, -31, 36, -29, 13, -22, 19, -31, 16, -13,
+	-19, -27, 18, -20, -5, -15, -20, -3, -4, 0, 19, -5, -15, -12, 5, -6,
+	-1, 29, -5, -1, 6, -13, 19, 23, 19, 16, 0, 8, 9, 39, -27, 21,
+	-27, 8, 17, -54, -62, -26, 12, 24, -15, 13, -11, 0, 17, 17, -23, -11,
+	13, 19, -24, 26, -29, 10, -6, -8, 9, 25, -6, -14, 24, 27, 27, -7,
+	-1, 44, -1, 35, -11, -31, 4, -10, -14, -26, 12, 32, -14, 6, 4, -32,
+	-11, -66, 37, -26, 49, -18, -29, -4, 25, -10, 30, -7, -20, 21, -33, -32,
+	-26, 22, 3, -26, 26, 17, 3, 16, -19, -26, 25, 12, -9, 14, 21, 44,
+	-6, 26, -17, -7, 34, -2, 18, 12, 36, 25, -11, -18, -20, -15, 5, -43,
+	-36, -11, 43, 10, 4, 5, -22, 15, -7, -30, -14, 9, -4, -30, 17, 1,
+	-17, 14, -11, 13, -27, -20, -2, -8, -5, 27, 34, 31, -10, 28, -19, -8,
+	-9, 10, 32, 41, -6, 19, 16, 8, 3, -20, -6, 0, -21, -46, -17, -33,
+	55, 8, 27, 10, 19, -11, 14, 10, -22, 13, -4, -21, 7, 31, 15, -22,
+	-26, 3, -19, 9, -31, 23, 15, 8, -32, 6, 16, -14, 38, 7, -16, 30,
+	-45, -10, -5, 2, -2, -20, -42, 45, 1, 11, 13, -4, 20, 8, -10, -21,
+	-6, -5, -5, -3, 19, 31, 17, -6, -34, 8, 13, -24, -32, -16, 19, 28,
+	-2, 22, -25, 23, 16, 21, -20, 22, -2, -14, 2, 8, -36, 36, -55, -30,
+	45, 19, 30, -2, -22, 15, -10, 14, 28, 6, 11, 1, -16, 56, 4, -5,
+	1, -17, -34, -27, -13, -4, -9, 14, 1, -11, 0, 30, -5, 2, 6, -14,
+	-9, 22, 9, -30, -27, 37, 45, 13, -8, -34, -24, -13, -38, 1, 46, 29,
+	-32, -3, 4, 40, 15, -19, 11, -32, 45, -1, -2, 6, 21, -14, -19, -30,
+	-27, -31, -14, -25, 16, 23, 12, 11, -31, -15, -25, -26, 22, -5, -24, -25,
+	9, -18, 9, 25, 47, -6, -10, 18, -48, 17, -40, -26, 35, 3, 0, 18,
+	-31, 6, 44, 3, -38, -14, 31, -1, -30, 15, -33, -27, -20, -18, 16, -27,
+	2, 23, 0, 32, 27, -12, 15, 20, -10, 33, 25, -13, 16, 21, 16, -22,
+	-55, -1, 29, -6, 15, -31, -19, -36, 10, 2, 7, -7, 9, -7, -46, -7,
+	16, -25, 14, -11, 44, 1, 4, 62, 11, -25, -28, -13, 29, -15, -18, -29,
+	16, 9, 24, 35, -7, 0, -24, -28, 20, -21, -35, 4, -14, 15, -28, -8,
+	-48, -22, -56, 67, 11, 9, -8, 6, 60, -24, 39, 31, -18, -84, -37, 2,
+	-39, -46, 5, 13, 36, -47, 10, -30, -8, 14, 12, -9, -18, -26, 29, -4,
+	-8, 7, -9, 34, -12, 8, 11, 31, 5, 31, 3, 4, 26, -25, -35, -28,
+	-6, 11, -13, -2, 0, -30, 21, -22, 5, -11, -4, -69, -42, -15, -45, -44,
+	30, 5, -18, -8, -25, -20, -3, 32, 30, 17, -1, 29, 13, -17, 2, -28,
+	-26, 21, -3, 13, -26, -20, 28, -24, 3, 19, 25, 9, -19, 13, -59, 54,
+	5, 1, 38, -15, 50, 9, 11, -27, 11, -60, -13, 38, -14, -37, 38, -5,
+	24, -25, -3, 20, 25, -21, -32, -9, -15, 13, 4, 17, 24, 13, -8, -22,
+	-15, 4, -30, 3, 22, -12, -27, 26, 19, -22, -11, -11, -1, 56, -13, 4,
+	-24, -10, 0, -19, 30, -9, -22, -64, -13, 21, 8, 8, 65, -5, 4, -10,
+	-3, 20, -9, 2, -9, -24, 25, 1, 20, -23, -22, 7, -7, -6, 6, 33,
+	25, -26, 24, 33, 2, 4, 8, 33, -33, 9, -60, 74, 5, -20, 20, 1,
+	33, -15, -2, -6, -14, -12, -46, -13, -27, 9, 18, -20, 16, 25, -9, -12,
+	8, 24, 9, 32, 11, -30, 12, -15, -14, 3, -12, 2, -29, 33, 21, 25,
+	-29, 13, 12, 32, -14, -32, 36, -44, -6, 20, -21, 20, -13, 30, 5, 24,
+	-32, 4, -49, 22, -18, 26, -33, -17, -41, 7, 21, 4, 9, 19, 15, -1,
+	28, 24, 28, 30, -26, -4, -15, 26, 20, 17, -19, 14, 17, -22, 25, 6,
+	-21, 27, -20, 12, -45, -22, 20, -8, 3, 25, -14, 15, 27, 21, -23, -35,
+	-27, 4, -5, 1, -26, -17, 17, -33, 21, 28, 10, 17, -21, -2, 13, -20,
+	-25, 22, -31, -11, -27, -35, 21, 7, 33, 16, -4, 2, 32, 14, 22, 13,
+	-11, -9, -19, -7, 12, -9, -25, 6, 16, 14, 62, 26, 18, -45, -53, 8,
+	-22, 18, -6, 36, 17, -12, 19, 26, -6, -33, 0, 31, 30, 18, 13, -13,
+	-8, 21, 0, 4, 32, -22, -29, -9, 30, -30, 34, 6, 31, 4, -6, 36,
+	7, -28, 42, -13, -1, -46, -14, 12, 78, 13, -27, 0, -28, 8, 9, -19,
+	7, -18, 17, -4, 25, -30, -29, 15, 22, 4, -23, -18, -29, -8, -22, -11,
+	-11, 25, -32, -34, 31, -6, -5, -22, -20, 6, 32, -18, 4, -24, -26, -38,
+	6, -19, -33, -23, 33, -20, 61, 18, 14, -19, -22, 55, -35, 45, -23, 21,
+	47, 60, 6, -2, -3, 21, -29, 29, 0, 12, -6, -30, 28, -27, 32, -2,
+	23, -28, 13, -14, -24, -18, -19, -26, -27, 4, 21, -25, -20, -42, 43, 50,
+	0, 8, 23, 58, 1, 23, -1, -6, 27, -5, 1, -5, 8, 7, 49, 11,
+	18, -4, 11, -10, -27, -25, 11, -28, 6, 23, -24, -30, -3, -7, -17, 0,
+	-21, -31, 4, -20, 10, -6, 18, 8, 25, -39, -7, 10, 37, 28, -11, -21,
+	32, 53, -19, 18, -28, -4, 30, 12, -21, 11, 25, -12, 9, 51, 14, -12,
+	22, 16, 18, 22, 5, -9, 8, -11, 18, -21, -20, -31, 10, 10, -8, -30,
+	-11, -17, -8, -35, 5, 28, -20, 2, -6, -14, 2, 34, 14, -10, -10, 25,
+	-8, 47, -1, 23, 13, 9, -23, 31, 29, -16, 17, 54, 2, -46, 22, 21,
+	15, 25, 31, 19, 2, 14, 35, -35, 19, -16, 20, 8, -10, 8, 19, -3,
+	17, -16, 5, 26, -29, -7, -9, 6, 4, 44, -11, 13, 40, 16, -24, -3,
+	-10, -20, -17, 35, -11, -13, -19, -14, 37, 19, -5, -37, -16, -1, -22, 7,
+	3, -2, -26, -23, -21, -28, -17, 9, 4, 2, 1, -13, 15, -29, -27, 1,
+	-12, -16, 12, -8, -1, -44, 28, 37, 3, -18, 14, 29, -18, 49, 30, -17,
+	-23, 18, -32, -4, 7, -25, -41, 27, 7, -5, -2, 14, 0, -20, 12, -13,
+	36, 28, -1, 3, -1, 14, -11, 4, -4, -20, -28, 0, 27, -2, 23, -25,
+	-14, -20, 20, 41, -3, -11, 36, -6, 10, 26, -24, 55, -34, -15, 5, 45,
+	1, 5, -18, -56, -19, -12, 31, -6, -30, 18, -7, -27, -23, -12, 18, -25,
+	-19, 12, 34, 15, 30, -25, 7, 24, 5, -18, -4, -5, 24, 23, 0, 8,
+	13, 31, 16, 30, 45, 30, 12, 49, 28, 41, -16, -53, -8, 16, -17, -29,
+	12, -5, -11, -18, -3, -35, -29, 20, -2, 23, -1, -31, 8, -11, 13, -28,
+	5, -18, -2, -23, 13, 20, -24, -12, -10, -15, 30, 5, 18, -11, -37, -15,
+	4, -8, 22, -10, -44, 63, -17, 18, -33, -14, -11, -8, -31, 10, -21, -29,
+	-24, -25, 19, -32, -4, -11, -9, -2, -15, -8, 18, -7, -33, 28, -6, -31,
+	-25, 30, 3, -2, -19, -19, -19, -12, -4, 27, 19, -11, -30, -7, -29, 3,
+	-9, 8, -34, 68, 19, 31, -39, -20, -11, 6, 8, 14, -7, -19, 19, -11,
+	2, -23, -14, 0, -23, -30, -15, -14, -3, 33, 11, 18, -9, -24, 6, 21,
+	26, -2, -11, 0, -30, -5, 19, 17, 15, -11, -24, 10, 0, -5, 39, 30,
+	16, 20, 26, 62, -36, -32, -17, 20, -21, 27, 8, 4, 1, 12, 6, -24,
+	-13, 6, 13, 17, -16, 8, 25, 16, 2, -17, 22, 12, -5, -21, -32, -33,
+	-30, 28, -29, -15, 6, 3, 3, -14, -14, 1, 35, 60, -17, 57, 5, -8,
+	39, -25, -2, -12, 37, -62, -46, 47, -20, 24, 66, 9, -20, -9, 19, 15,
+	-3, 33, 26, 0, -31, -30, 12, 0, -4, 34, 20, 12, 0, 33, -9, -6,
+	-11, -17, 2, 23, -30, -7, 3, -23, -1, 33, -7, 33, 10, 2, -15, -42,
+	-9, 0, 35, -54, -17, 27, 9, 31, 53, -5, -17, -3, -23, 11, -25, -9,
+	27, -18, -12, -1, -10, -2, -24, -16, -26, -31, 9, 15, 13, 27, -19, -10,
+	-19, -29, -2, 21, -26, 2, -3, 32, 11, 32, -4, 13, 11, -25, 25, -9,
+	11, 0, -49, 16, 23, -24, 34, 9, -19, 34, -15, -6, -32, -12, 17, 14,
+	-23, 2, -13, 9, -30, -32, -19, -27, -13, 31, 16, 23, -2, -20, 16, -13,
+	-16, 27, 9, 7, -30, 13, 14, 18, 13, -22, 26, 5, -4, -10, 32, -32,
+	8, 49, 14, 8, 72, -28, 33, -3, -27, 32, 12, 34, 16, 11, 15, -12,
+	21, 27, -8, -12, 6, 12, -10, -31, -31, -13, 34, 18, 32, -20, -36, 15,
+	-14, 7, -2, 34, -19, 45, 45, 0, -17, -44, 29, -39, 18, -15, -15, 16,
+	16, 32, 31, -18, 33, -14, -8, 4, -8, -4, -2, -30, 24, 2, -12, -26,
+	3, -10, 5, 19, 9, 0, -30, 34, -7, -19, -24, -8, -3, -28, -22, -54,
+	25, 2, -20, -42, 29, 4, 67, 2, 29, -13, -6, 44, -25, -27, -30, -41,
+	3, -14, 46, 43, -14, -17, 3, 3, 35, -4, 24, -20, -19, 27, 14, 25,
+	3, 13, -31, -18, -22, -31, -16, -4, -20, -32, -39, 7, -34, -45, 20, 1,
+	-14, -39, -5, 24, -20, 1, 20, -2, 3, 19, -24, -6, -40, -18, 3, 13,
+	36, 26, 20, 14, 0, 11, 36, -19, -3, 2, 24, 20, -14, -8, -28, 29,
+	-31, -19, -8, -36, -15, -23, 34, -22, 29, 36, -45, -25, 46, 4, -38, 18,
+	-1, 12, 56, -34, -11, -22, 2, 3, -28, 25, -24, -3, 5, -21, 0, -5,
+	-4, -21, -5, 1, 36, 15, -10, -1, 14, -23, 8, -18, 22, 4, -15, 14,
+	21, 29, -22, 6, -25, -17, 22, 5, -39, -61, 40, 22, -22, 23, 24, -30,
+	38, 19, -20, 46, -27, 32, -9, -2, 11, -14, -8, 16, -7, 27, 21, -6,
+	-16, -20, 25, 30, 15, -21, 17, 19, 22, 16, 6, 4, 27, 14, -13, 4,
+	28, -10, -18, 11, 47, 53, -25, -60, 51, -1, -42, 14, 15, 49, 52, -29,
+	-36, 16, -4, -20, -2, -4, -38, -1, 24, -8, 28, 6, -6, -23, -12, 21,
+	-3, 18, -6, 13, -16, -35, 20, -25, 13, -11, 18, -20, 25, 10, -26, -30,
+	17, 16, -18, -30, 5, -11, 22, -25, -2, 1, 3, -21, -14, -7, -33, -2,
+	42, -59, -24, -10, -24, 33, 7, 4, -33, 45, -22, -15, -27, -7, 4, 33,
+	8, -28, 25, 18, -37, -20, -33, 24, -3, -16, 3, 5, 3, 6, -25, -22,
+	16, -41, 6, 9, 52, -14, 32, -8, 1, 6, 21, -25, -16, -6, 6, -12,
+	3, -13, 16, -52, 25, -10, -14, 13, -15, -18, -2, 13, -20, -34, 5, -8,
+	-13, 29, -35, -31, -23, -29, 8, 3, 30, 28, -13, -22, -26, 6, 6, -36,
+	-39, -11, 44, 25, 6, -40, -28, -9, 5, 26, 5, -23, -23, -37, 23, -21,
+	16, -1, 56, 3, -28, 12, -22, 21, -11, 3, 34, 11, 29, 17, 32, -4,
+	16, 18, -30, 22, -28, 27, -8, 20, 35, 11, 20, 21, 26, -6, -34, 5,
+	34, 28, 19, -31, -30, -31, -38, 14, 5, -13, -4, -56, -21, -26, -17, -47,
+	39, 14, -43, 29, 34, -8, -3, -31, 23, -34, -15, -34, -10, 12, 10, 2,
+	15, 15, -23, 3, -30, 22, 11, -34, 10, 20, 31, -13, -37, -9, 22, 33,
+	-11, -20, 2, -37, -27, 17, -6, 24, 33, -60, 17, -7, 30, 0, 20, -7,
+	1, -18, -22, 15, 19, -24, 4, 4, 8, -8, -18, -7, -33, -2, 4, 3,
+	5, 9, 1, 2, -18, -2, 10, 18, 6, 5, 8, 27, -6, -4, -28, 28,
+	21, 18, -37, 15, 12, -20, -30, 80, -6, 24, -40, 38, -1, -22, 35, -9,
+	11, 21, -31, -12, -10, 13, 11, 14, 14, -1, 13, -13, 36, -8, 10, 31,
+	-11, -14, 15, -3, 10, -33, -13, 12, 11, 6, 24, -6, 22, 14, -22, 59,
+	-7, 59, -8, -19, -18, 72, -35, -13, 8, 29, 16, -2, 37, 14, -26, 22,
+	29, 33, -12, 2, -32, 12, -12, -1, -17, 30, -2, 17, 24, 15, 11, -24,
+	-27, -3, -22, -11, -18, -22, -16, 54, -22, -27, -10, 10, 17, 53, -30, 54,
+	-45, 10, -4, 34, -16, -26, -26, 50, 18, 19, -1, 11, 17, -24, 5, -18,
+	9, -28, -24, 24, -7, -19, 36, 2, -11, -16, 37, 17, -17, 11, -20, 6,
+	28, -19, -10, -41, -26, 39, 4, -42, -1, -31, -38, 43, 5, 33, 1, -33,
+	8, 25, -49, -26, -38, 28, 26, 8, -2, 28, -2, -18, -29, 3, 19, -27,
+	13, 32, -21, 13, 20, 0, -23, 9, 28, -20, 4, 24, -19, -9, 1, 12,
+	-8, -13, -36, -10, -5, -31, 1, -11, 10, 37, 3, 13, -3, 1, -29, 83,
+	-10, 1, -31, 43, 25, -12, 28, 21, 30, 3, 32, 2, 11, -21, 15, -4,
+	-9, 0, 30, 10, -25, 32, 34, -22, 31, -21, 18, -33, 28, 5, -41, 40,
+	37, -10, -4, 26, 11, 30, -34, 9, 6, 22, -15, 24, 26, 67, -29, 23,
+	-19, -30, 12, -17, 24, -41, -3, 20, -35, 3, 29, -28, 11, -30, -5, 22,
+	-24, 7, -31, -8, 20, 0, -19, -24, -19, -15, 10, 25, -7, 14, -1, 12,
+	7, 13, -1, 31, -47, 44, -40, 51, -20, -24, -28, 65, -37, 41, -29, -43,
+	-14, -56, 34, 16, 30, 9, 4, 28, -5, -10, 31, -9, 32, 16, -16, -24,
+	-31, 3, 18, -25, 8, -16, -20, -23, 10, -1, -2, -10, 17, 32, 6, 23,
+	13, -27, -41, 1, 6, 20, -14, -22, 23, 1, -12, 7, -15, -56, 17, 20,
+	-2, -25, 34, -20, 2, 10, 27, -2, 35, -33, -15, 10, 31, 12, 5, -9,
+	28, -13, -10, 21, 27, 24, -4, -29, -59, -24, 32, 11, -10, 24, -19, -2,
+	-20, 19, -15, -23, -14, -34, -6, 60, -40, 15, 24, -53, -41, -15, 47, -20,
+	-15, 31, 3, -17, -8, -2, -1, 3, 27, -13, 0, -16, 12, 9, -29, -2,
+	-4, -21, -23, 9, 9, 23, -57, -33, 33, 44, 17, -28, 2, 28, 0, 23,
+	11, -7, -12, -10, -5, 9, -49, 50, 0, -52, -8, 20, 11, -26, 27, -6,
+	-14, -19, 27, -30, -7, 16, -5, 10, 14, -2, -24, 18, -25, 25, -23, -29,
+	12, 21, -19, -33, -14, 12, 25, -22, -35, -39, 34, -10, 15, 15, 25, -24,
+	20, -19, -12, -10, 18, -28, 12, -5, -34, -23, 24, 11, -27, -23, 14, 22,
+	-12, 4, 29, 14, 6, -13, -18, 0, 23, 33, -8, 27, -6, -8, 21, 16,
+	27, -9, 1, 0, -30, -72, -9, -22, 37, 17, -7, 6, 50, -23, 12, 14,
+	-8, 20, 4, -5, 8, 1, -20, -3, 13, 8, -26, 13, -7, -26, -32, -3,
+	-33, -19, -19, 4, -10, 2, -24, -26, 31, -12, 6, 3, -11, 1, -34, 17,
+	14, -31, -18, -54, -1, -28, 30, 9, -40, -16, 38, -25, 35, 20, -17, 30,
+	-16, -26, -5, -13, 16, -2, 36, -29, 11, 18, -5, -26, -26, 12, -30, -22,
+	-22, -23, -34, 21, 13, 21, -9, -7, 25, 10, -27, 17, -34, 16, -37, -17,
+	24, -44, -1, -37, 50, 1, 21, -3, 58, 8, 26, -34, -28, 16, -36, -28,
+	-20, 5, -47, 12, 0, -2, -34, 18, -9, 20, -16, -24, -14, 17, 24, -16,
+	30, 28, 20, 5, -29, 19, 32, 4, -15, 14, -8, -22, -25, 19, -6, -20,
+	-1, 23, 30, -1, 58, -33, 38, -48, 12, 8, 1, 8, 25, -26, -32, 23,
+	-52, -26, -1, -16, 22, 32, -9, -30, 3, -21, 17, 9, -29, 31, 21, 34,
+	11, 13, 32, 14, 20, -14, 16, 20, -29, -3, -23, -38, -18, 15, 13, -7,
+	46, -16, 8, 28, 69, 8, -13, 48, 3, -16, -6, -4, 14, 5, -34, -21,
+	64, -28, -23, -10, 6, 29, 19, 26, -2, 24, 29, 13, 28, -30, 32, 16,
+	-10, 29, -2, 16, 21, 31, -1, -19, -17, -2, 19, -10, -15, -9, 42, -46,
+	14, -24, 40, -13, 25, 39, -4, 31, -31, -5, -17, -7, -29, -23, 39, -41,
+	-18, -28, -23, -26, -5, -24, -7, 12, -22, 32, 2, 11, 14, -14, -26, 14,
+	5, 11, 24, -28, 29, -23, -10, -10, 35, 1, -19, -26, 17, -12, -27, -13,
+	27, -27, -23, 3, -4, 4, -4, -9, -29, -8, 2, -42, 32, -23, 28, -4,
+	-6, -31, 33, -33, 0, -21, 33, 8, 6, 32, 15, -15, -37, -27, -21, 19,
+	15, -32, -10, -26, -42, 30, 31, -7, 25, 15, -13, 11, -35, 25, 44, 21,
+	30, 0, 28, 42, 15, -29, -25, -14, -3, -51, -2, -38, 5, 16, 12, 31,
+	-19, -13, -10, -20, -27, 1, 8, -33, 0, 30, -34, 5, 25, -7, 8, -21,
+	9, -5, -2, 29, 27, -24, 3, 43, -35, -36, -62, -20, -7, -4, -18, 39,
+	-19, -16, -29, 14, -21, 12, 23, -47, 45, -17, -13, 13, -5, -4, 1, -6,
+	6, -21, -28, 29, -2, 11, -29, 0, -2, -9, 11, 15, 3, 26, -29, -25,
+	20, -16, 12, -11, 13, -20, 44, -48, -20, 37, 23, -48, 30, -7, -6, -17,
+	-47, 29, -39, 31, 22, 11, 25, -18, -17, 25, -19, -3, 16, -5, 28, -13,
+	10, -18, 1, 15, 31, 5, -10, -8, -15, -9, 19, -4, 26, -27, -3, 16,
+	1, 2, -16, -22, 12, 12, -8, 44, -4, -17, -33, -31, -16, 7, -16, -25,
+	8, 26, 16, -22, 45, -5, 3, -28, 19, -33, 32, -4, -21, 17, -15, -9,
+	16, -28, 20, 26, 25, 13, -28, 19, -7, 21, -15, 20, -9, -32, -19, -1,
+	-2, -25, -12, -5, -22, 8, -22, -41, -38, 43, 6, 41, -11, -42, 2, 27,
+	2, -21, 22, 3, 14, -25, 18, 17, 13, -1, 11, -12, -31, -5, -22, 30,
+	-22, -2, 25, -8, 6, -21, -7, -27, 0, 30, 19, -37, 30, 27, 33, -29,
+	-14, -50, -12, 39, 12, -45, -52, 33, -22, -2, -2, -17, -20, -8, -9, 42,
+	31, 15, -20, 21, 26, -14, 14, 10, 3, -16, -2, -34, 2, 1, -21, -25,
+	21, -23, 1, -17, 6, 17, -19, -28, 3, -4, 8, 28, 11, 13, 11, -40,
+	21, 14, -5, -4, -22, 33, -52, -40, -16, 11, -23, 4, -15, -14, 13, 40,
+	30, 25, -4, -7, 26, -14, -19, -17, 14, 26, -25, 24, 31, -23, 15, -30,
+	13, 25, 26, -24, -27, 17, -22, 6, 19, 8, 34, -12, 23, -2, 19, -10,
+	1, -8, 0, -17, 2, -22, -26, 21, -13, -38, -24, 2, 1, -8, -7, 7,
+	25, -18, 23, 19, 28, 7, 33, 7, -31, -16, -7, -31, -13, -25, 30, -6,
+	-29, 30, -3, 27, -9, 25, -16, -27, 61, -44, -28, -37, 28, 22, 57, -26,
+	-24, 7, 27, -1, 3, -5, 12, 9, -15, 9, 13, 34, -10, 16, 11, -27,
+	-29, -22, 24, -15, -21, -16, -17, -23, -18, -5, 5, -13, -31, 3, -15, 1,
+	19, -11, 4, 10, 1, 4, 0, -45, 3, -20, 14, -24, 46, -29, -19, 20,
+	-29, 70, 33, 34, 28, 13, -16, -52, 27, 24, -8, -21, 0, 8, -5, 18,
+	-11, -26, -30, -9, 14, 21, 6, 29, -18, -27, 9, 18, -30, 11, -17, -15,
+	-41, 14, 17, -11, 19, -20, 26, -2, 49, -20, 50, -14, 35, -20, -31, 18,
+	-12, -12, 8, -17, -10, -19, 10, 16, 25, -8, 0, -4, 28, 18, -32, 23,
+	4, -16, 0, -5, -14, 14, -36, -9, 0, -1, -34, 5, -11, 9, -24, 25,
+	32, -29, 5, -25, 24, -43, 17, -11, 48, -16, 18, 7, -50, 9, -42, -7,
+	-15, 12, -41, 0, -5, 22, 5, 14, -22, -2, -29, -18, 29, 32, -26, 25,
+	-5, -2, 13, -6, 23, -12, 28, -3, -6, 25, -32, 31, 20, -7, -14, -13,
+	-65, -1, -19, 29, -17, 44, 4, 2, -12, 3, 15, 9, 6, -74, -7, -74,
+	4, 16, 0, -42, 22, 28, 28, 0, -34, -12, -17, 26, 1, -1, -40, 34,
+	-28, -22, -29, 28, -31, 0, -18, -9, -2, -21, -40, -22, 2, -35, -60, -17,
+	15, 24, 25, 14, -31, -18, -10, -9, 25, -16, 23, -63, 23, 11, -16, -3,
+	19, 10, 1, -9, -34, -21, -19, -24, 25, -22, 1, -26, 8, 18, 27, 28,
+	-9, -16, -32, 14, 12, -6, -29, -14, -29, 10, -19, -24, -47, 5, 34, -14,
+	7, 0, 12, 2, -33, -8, -4, 17, -7, -44, -28, -5, 1, -30, -4, -28,
+	-17, 34, 1, -14, -15, 27, 20, 37, 15, -15, -3, 28, 23, 6, -13, 13,
+	18, 5, -22, -3, -36, -19, -12, 7, -2, -39, -24, -39, 1, 42, 13, 44,
+	36, 22, -25, 24, 31, 10, -16, -32, -21, 35, -20, -23, 15, 3, -20, -22,
+	-35, -16, 7, 21, -32, -1, -29, 17, -37, -11, 13, 17, -29, 4, 11, 14,
+	-7, 8, -30, -20, 17, -28, -9, -26, -72, -4, 28, -16, 1, 36, 19, -1,
+	5, 46, 6, 41, 3, -49, 15, -9, -32, -10, 33, -8, 7, 27, 4, 32,
+	28, -21, -2, -28, 26, 13, -11, 24, 30, -12, 17, -3, 18, 18, -11, 11,
+	-3, -9, -15, -12, -6, 5, 12, -38, 15, 31, -25, -27, 23, -32, 19, 3,
+	23, -8, -36, -14, 0, -39, -4, 4, -4, -25, 3, 8, 7, 6, 6, -9,
+	-14, -20, -16, -11, -5, 23, -7, 10, 1, 0, 27, 30, 7, -9, 8, -7,
+	11, 18, -1, -25, -16, 28, 22, 41, -15, 11, 25, -41, 46, -6, 24, 30,
+	-43, -61, -27, -64, 7, -1, 29, 34, 10, -7, 14, 6, 27, -27, -5, 32,
+	-23, -24, 15, 30, -13, 33, -13, -24, -21, 25, 20, 5, -24, 4, 3, 0,
+	24, -27, 24, -19, 13, 48, 1, 6, -2, 18, -6, 21, -10, 2, -15, -24,
+	28, -24, 23, 10, -6, -29, -5, -18, 24, -15, 11, -13, 22, 2, -31, -21,
+	-9, -20, -26, -28, -30, -2, -13, 27, 9, 12, 10, 17, -22, 32, 5, 7,
+	-17, 5, -16, 7, -24, 4, 38, 9, -39, 26, 21, 22, -14, -68, -30, -41,
+	45, 0, -3, 12, -18, 28, 28, 7, 27, -4, -14, 32, -2, 32, -31, -5,
+	-4, -5, 6, 0, -19, -1, -29, 6, -20, -29, -40, 3, -4, -13, 14, 17,
+	0, 35, -3, -1, 56, 30, 41, 39, 11, 38, 27, -12, 3, -47, -8, 3,
+	-25, 4, -22, 18, -24, 19, 14, 2, -25, -24, -24, -3, 17, -2, -23, 8,
+	15, 34, -23, 7, 27, 21, -26, 8, 18, -31, 23, 24, 21, 11, 45, 25,
+	36, -5, -42, 11, -32, 12, 7, 40, 10, -21, -8, -37, -9, 3, 8, 2,
+	-23, 18, -13, -11, 9, 1, 2, -21, 28, 13, -19, -5, -28, -23, 12, 18,
+	-20, -16, 29, 27, -31, -9, 12, -21, 9, 18, 10, 20, -11, 2, 41, 48,
+	-13, 11, -13, -15, -37, 34, 28, 8, -8, -15, 24, -5, 47, -25, -10, -18,
+	7, -32, 25, 3, -32, -24, -4, -26, 35, 10, -20, 3, 4, -29, -27, 11,
+	-24, 1, 10, 9, 15, 31, 19, -3, -18, -4, 5, 26, 41, 15, 24, 5,
+	-23, -34, -8, 33, -13, 26, -4, -2, 29, -53, -21, 31, -10, 5, -17, 15,
+	-16, 17, -16, -11, 22, -32, -3, -7, -37, 23, -3, 2, 10, 32, 26, 18,
+	3, -13, -37, -31, -15, 42, 19, 12, 24, -29, 12, 27, 40, -29, -3, -8,
+	-10, 33, 20, 25, -3, -15, 16, -26, 31, 8, -28, -3, 15, -5, 12, 29,
+	-15, -6, 27, 2, -6, -31, 27, 16, 24, 25, 30, -28, 24, 20, 12, 20,
+	-39, 37, 25, 46, -17, 23, 29, 12, -25, 6, 21, 31, -41, 18, -28, -5,
+	-45, 3, -16, 36, -1, -55, -43, 20, -3, 10, 31, 19, 3, 28, 30, -26,
+	-30, -23, -19, 17, 15, 9, -17, -15, -12, 19, 10, -21, 18, 21, -22, -18,
+	4, -1, 0, 28, 16, 7, 27, -35, 34, 10, 15, 12, -60, -15, -25, 26,
+	33, -27, -4, 5, 11, 6, 24, 11, -21, 1, -10, 24, 34, -3, 30, -9,
+	-8, -4, -27, 14, 3, -3, -18, 21, -3, 2, -13, 19, -16, -21, 1, -37,
+	21, 23, -35, -12, -16, 21, 28, -19, 22, -22, -56, -14, -24, -41, 22, 14,
+	-8, 7, 2, 1, -25, -13, -20, 25, 6, 6, -3, -9, -13, 3, 18, -19,
+	8, -14, 13, 4, 8, -32, 19, -1, 11, -7, 3, -14, 9, 7, -27, 2,
+	0, -12, 42, 21, 8, -13, 2, -55, -39, 10, -49, 5, -42, -22, -53, -1,
+	-49, 13, -26, 16, -12, -7, -13, -34, 5, -34, 19, -35, 24, 2, -34, 4,
+	-38, -14, 13, -31, -4, 6, 5, 3, -24, -17, -9, 22, -8, 38, 7, -39,
+	31, -22, 8, -16, 20, -18, -30, 34, -4, -46, 13, -45, -32, -21, -3, 32,
+	12, -1, -1, -9, 25, 4, -5, -17, 3, 23, 22, -4, 16, 17, 10, -16,
+	31, 19, -31, -10, 15, -12, 8, -13, -15, 18, 13, -16, -27, -21, 9, -36,
+	-6, -26, 30, 6, -55, 10, -3, -2, -2, -49, -8, -8, -33, 13, 2, 7,
+	10, -22, -21, -31, -6, -20, 20, -26, -31, -2, 5, -3, -49, 0, -12, -13,
+	8, -18, -31, -32, -3, -7, 4, 25, 19, -8, -23, -20, -14, 14, -25, -38,
+	-30, 26, -27, 30, 20, -9, 24, -12, 18, 3, -3, 37, 18, 6, -24, -9,
+	-29, -28, -30, -18, 9, 26, 20, -18, 22, -24, -23, -13, -1, 15, 4, 35,
+	12, -24, -26, -3, -25, -19, 18, -4, -7, -26, 23, -16, 4, -8, 12, 33,
+	-18, -9, 27, 4, 8, -24, 13, -15, -30, 13, -17, -2, -16, 1, -30, -29,
+	-4, -28, -9, 30, 10, 7, 9, 15, 25, 25, 8, -14, 17, 7, 27, -7,
+	21, 20, -8, 23, 12, -25, -9, 24, -28, 36, 16, 14, -30, 14, 37, 9,
+	33, 4, 17, 2, 13, 45, -12, 11, -25, -5, 6, -9, -9, 23, -26, -28,
+	-21, 19, -24, 18, -31, -18, 12, -10, 4, 25, -6, -24, 26, -16, 3, 4,
+	-21, 27, -6, -26, -21, 17, -31, -19, 25, 22, 6, 29, 19, 45, -17, -17,
+	-42, 12, 8, -46, 11, -23, -31, -16, -5, 5, 17, -1, 16, 5, 24, -23,
+	-15, 20, -8, -21, -8, 15, -1, 4, -28, 4, -29, -26, -22, -21, 1, 7,
+	-38, -1, 8, -33, -14, 23, -45, -29, -5, 24, 37, 49, 51, -1, -35, 11,
+	-22, -17, -2, -16, 1, 4, -6, 22, -11, -11, -16, 30, 25, -31, -34, -4,
+	-21, 4, 20, -29, -30, 11, 2, 26, -25, -2, -54, 31, 22, 42, -28, -49,
+	22, -38, 15, -27, 21, -14, -11, -35, 20, 5, -24, -23, -14, -2, 25, -25,
+	-17, 5, -21, 22, -22, -22, -13, -26, 18, -16, 22, 2, 6, 26, 34, -11,
+	-23, -11, -32, 26, 16, 0, 2, 9, 0, 51, 41, 40, -41, -31, 25, -49,
+	8, -20, 29, 28, -26, -3, -18, -8, -38, 1, 26, -1, -14, -28, -45, 17,
+	29, 15, 26, -11, 3, 6, 17, 2, -19, 34, 23, -28, -17, -22, -24, 8,
+	5, 9, 21, -10, -10, -15, 5, 39, 37, 5, 1, -42, 11, -19, 35, -21,
+	-31, 8, 1, 31, 3, 2, -13, -5, 29, -7, -29, -45, 3, -1, -24, 1,
+	34, 32, -17, -12, 25, -17, -3, 14, 20, 31, 22, -9, -4, -9, 0, -5,
+	-23, 21, -16, 28, -16, 3, 13, 1, -29, 0, 10, -30, -18, 34, 14, 25,
+	-13, -5, -39, 22, 29, -19, 25, -20, -10, -20, 36, -8, 27, -29, -4, -11,
+	-5, 31, 2, -18, -31, -21, -14, -8, 22, 0, -25, 22, -2, -5, 16, 32,
+	22, 11, -12, 65, 57, 17, -37, -45, -18, -6, 2, -16, 39, 8, -30, -37,
+	7, 11, 27, -28, -15, 15, -7, -10, 47, 30, -3, 18, -15, -13, -15, -10,
+	-3, -16, 30, 25, -9, -9, -10, 28, 8, -1, 32, 14, -24, -4, 25, -4,
+	-1, 17, 6, -24, -29, -48, 25, 34, -17, 40, 8, 52, -29, -39, 40, -74,
+	-12, -29, -16, 7, -12, 47, 12, -32, -6, -24, -11, 34, -31, -27, 26, -32,
+	11, 31, 9, 5, -24, -16, -25, 16, 2, -26, -16, 3, -28, -13, 35, 11,
+	-28, -5, -8, 12, -3, -13, 29, 8, 34, 18, 12, 18, 31, -67, -31, 5,
+	-4, 31, -39, 23, 19, -21, -5, 2, -27, -4, 19, -18, -21, -16, -7, -27,
+	10, -11, 7, 19, -21, -15, -11, -6, 1, 26, 26, -31, 27, -10, -26, -22,
+	2, 28, -7, 12, -3, 34, 17, 33, 9, -27, 24, -18, 25, 14, 17, -14,
+	-23, 34, -16, -20, -11, -4, 24, 11, -19, 15, -7, -9, -4, 22, 25, 5,
+	14, -25, 18, -19, 1, 31, -11, -26, -15, 20, 52, -24, -9, -36, 2, -9,
+	-18, 0, 3, 49, 32, 10, -9, -11, 45, -23, 1, -10, 18, 11, -25, 12,
+	-36, -4, -19, 29, 22, -13, 13, -2, 30, 12, 11, -21, -5, 13, 8, 9,
+	-12, 32, -32, -18, 13, -21, -10, 1, 9, 25, -4, -54, 7, -10, -13, 25,
+	-2, 28, -6, 22, 0, -15, 18, -41, -12, 23, 0, 17, -1, 40, -2, 12,
+	0, 2, -27, 2, -21, 23, 9, 23, 31, 6, -25, -7, 22, -7, 15, -13,
+	24, 9, 14, -28, -26, -22, 10, -30, -2, -26, 22, 10, 12, -12, -31, -22,
+	-14, -45, 1, 9, 11, -59, -31, -42, 18, -33, 16, 11, 45, 8, -17, 10,
+	-18, -30, -4, 29, 3, -23, 10, 8, 10, -28, -1, 23, 5, 5, -23, 33,
+	-27, 8, -29, 14, 21, 9, 33, -23, 55, -14, 20, -33, 10, -13, 34, -58,
+	13, -14, 15, -82, 26, 30, 22, 0, 28, -5, 20, 22, 22, 23, 14, 2,
+	-17, 19, -26, -13, 22, 8, 23, -2, 27, -24, 25, -33, -6, -21, -24, 18,
+	-23, -10, 42, -5, 21, -17, 50, -23, -2, 4, -17, 13, 18, -32, 5, -2,
+	1, -45, 12, 32, 32, 4, -16, 18, 22, 12, -7, -9, -12, -24, 22, -18,
+	28, 2, 26, -28, 1, -24, 23, -6, 48, -12, -27, 17, 15, -28, 25, 9,
+	44, 11, 6, -29, 35, -9, 19, -27, -3, -21, 46, -43, -6, 19, -30, -76,
+	-9, -14, 14, -26, 18, 27, 2, -18, 0, -30, -5, 2, -8, -20, 19, -7,
+	21, -11, 21, -31, -23, 4, 45, 6, 15, -8, -6, -18, 15, -19, 36, 3,
+	8, -55, 58, -16, 16, -24, -7, -18, 33, -18, -6, -20, 7, -55, 18, -26,
+	20, -8, 7, 24, 29, 33, 7, -10, 5, -25, -12, -19, -30, -20, 4, -21,
+	7, -7, 36, 12, 27, -3, -34, 24, 37, -27, 21, 2, 4, -22, -31, 5,
+	35, 42, -1, 32, 9, 31, -29, 10, 7, -16, -29, -32, 26, 29, -10, -58,
+	11, -1, 60, -32, 12, -25, -29, 24, -2, 28, -30, -22, -17, -34, 23, 11,
+	-10, -30, 26, 17, -24, -22, 18, 0, 12, 28, 25, -40, 4, -14, 16, 13,
+	0, 0, 16, -39, 16, 18, 53, -23, -20, -10, 21, 46, -2, 5, -52, 44,
+	32, 10, 18, 11, -9, 28, 25, 5, 15, 7, -20, 24, -28, -5, -1, -16,
+	-14, -29, 23, 8, 15, 5, 20, -35, 20, -23, -16, 9, 30, 21, -44, 11,
+	19, -42, 9, 29, 42, -10, 15, -27, -11, 41, 36, 15, -43, 35, 23, 7,
+	-2, -18, -8, -15, 2, -20, 26, 4, 16, -30, 4, 28, 28, 7, -32, -35,
+	-30, 18, -31, 19, -29, -10, -28, 25, 34, -39, 11, 42, -13, 3, -15, -31,
+	-33, -27, 3, -1, -2, -19, -22, -9, 13, -35, -11, 37, 56, -32, 34, 18,
+	-1, -3, 34, -12, 15, -19, -27, 29, 23, 13, 5, -17, -2, -8, 34, -19,
+	-20, 20, 2, -7, 13, 25, 26, -27, -10, 23, -1, -4, 7, 19, 11, 19,
+	-41, 3, 4, -41, -18, 34, -19, -25, -43, -10, -7, -14, -23, -11, 21, 10,
+	33, -32, 26, -14, -5, 10, 35, -2, -24, -16, 32, -31, 17, 31, 14, 30,
+	-1, -32, 17, -44, 14, 45, 43, 23, -37, -19, 23, -16, -18, -10, -10, -9,
+	15, 4, 16, 3, -9, 8, -46, -2, -35, -12, -26, -14, -3, -19, 24, -23,
+	-31, 26, -19, 19, 3, 9, 8, -26, 32, -31, -30, 24, -26, 27, 30, -20,
+	-20, -33, -29, 28, 31, -45, -23, -13, -8, 1, 28, -6, 15, -22, 1, -6,
+	-41, 20, 16, 23, -13, -33, 3, 5, 17, -4, -8, -28, 20, -18, -22, -24,
+	10, -11, 28, 3, 0, -26, 14, -2, -2, 3, 20, 7, 24, 5, 9, -29,
+	-3, 16, -1, -18, -22, -24, -15, -37, 32, 25, 12, -13, 10, -20, -24, 3,
+	-29, -19, -37, -10, -9, -22, 15, -11, 12, 9, 6, -16, -27, -25, -1, -11,
+	36, -16, -7, 10, 22, 20, 1, 27, -20, 15, -28, -28, 10, -1, -32, 45,
+	-16, -52, 30, 7, -31, -22, -21, 35, 13, 24, 11, -38, 10, 25, -16, -28,
+	-5, -2, -3, 9, 12, 17, -21, -31, 31, -6, -12, -19, -9, -32, 2, 22,
+	6, 9, 35, -17, -12, -1, 9, 16, -26, 19, -7, -12, -8, 58, 33, -7,
+	-13, -21, 12, -27, -19, 35, 16, 32, 18, -4, -46, 9, -42, -31, 3, 10,
+	3, 4, -5, -1, -15, 14, -27, 12, 16, 12, -12, -32, 35, -7, -12, -23,
+	36, -23, 21, -2, 32, 2, -28, 28, -4, -7, -47, 13, -26, 12, -10, -21,
+	18, -41, -26, 14, -43, 18, 13, -2, -5, 18, -21, 9, 13, 2, -18, -22,
+	13, 26, 8, -4, -35, -11, -22, 17, -35, -5, -32, 25, 27, 18, -35, 25,
+	27, 16, 31, 25, -20, -23, -41, 4, -29, -7, -39, 11, 42, -12, 28, 2,
+	-50, 28, -20, -17, -4, -22, 13, -23, -13, -19, -13, -19, 2, -11, -28, -25,
+	4, -5, 4, 16, -6, 15, 22, 26, -4, -21, 6, -19, -6, 5, -30, 16,
+	30, -4, -23, -31, -16, 0, -41, 20, -21, 9, 18, -4, -16, 16, -58, 27,
+	-47, 16, -24, 11, -5, -3, 25, 36, -18, 3, 12, 25, -23, -3, -30, 30,
+	29, -30, 1, 14, 13, 3, -13, 32, 29, 35, -11, 31, 16, 7, 24, 13,
+	14, -10, -9, -26, -40, 2, 4, -47, -9, -10, 30, -14, -1, -1, -39, 12,
+	-8, 21, 5, 8, -1, -12, -11, 7, 23, 21, -33, -27, 28, -30, 27, 34,
+	8, -4, -20, -8, 2, 20, 15, 26, -6, 31, 22, -14, -31, 35, 2, -21,
+	-7, -8, -25, 28, 6, -2, 0, 22, 9, 9, -43, 4, -12, 45, 13, -43,
+	-1, 7, -5, 39, -33, 3, -26, -13, -14, -6, -3, 14, 8, -11, -20, 8,
+	-27, 1, -24, 7, -31, 20, -16, -4, 6, -27, -4, 29, 17, -19, -23, -24,
+	-11, -7, -6, -18, 15, -24, -21, 4, 45, -41, 36, 0, -24, 20, 1, -20,
+	-31, -34, -16, 3, -13, 25, -25, 31, -4, -15, -4, 16, 12, 10, -16, -22,
+	8, 28, -30, 15, -29, -9, -34, 29, -13, 22, 18, -4, 15, -26, -21, -3,
+	47, 42, 12, -26, -28, -5, 52, -56, -1, 16, 6, 11, 19, -26, -43, 8,
+	17, -6, -40, 1, -30, -1, -13, 26, 30, -24, 16, -38, -9, -35, -18, 21,
+	15, -24, 15, 17, -27, 9, -5, -35, 11, -36, 9, 24, 8, 20, 13, 26,
+	-4, -11, -27, 20, 28, -29, 37, -7, -23, 20, -8, 43, -12, -26, 15, -13,
+	-20, 0, -24, -2, -20, 22, 26, 23, 35, -10, 12, -19, 25, -34, -7, 6,
+	-23, -7, -26, 2, -11, 13, 15, 11, 19, 26, -18, 1, 45, 48, 17, -42,
+	-19, -34, -10, -35, 56, 8, -5, -31, -21, -27, -28, -7, -20, -11, -24, -18,
+	34, -18, -21, 4, -4, -19, -3, 15, -22, 19, -29, 7, 15, -38, 27, 3,
+	7, 29, 8, 28, -5, -37, 10, -9, -24, -2, 26, 43, -15, -50, 3, 21,
+	6, 2, 48, -30, -8, -11, -13, -22, 0, 7, 25, 26, -14, 14, -7, 14,
+	27, -5, 34, 15, -11, -37, 15, 9, -7, -4, -6, 28, -12, -3, -5, -30,
+	24, 18, 34, 21, 41, 26, -57, -1, -18, 17, -7, -35, 20, 8, -17, -21,
+	20, 15, 16, -68, -15, 12, 2, -5, -15, 17, -56, -17, 26, 17, 36, -21,
+	18, 6, -17, 17, -17, 25, -10, 14, -1, 18, 19, -13, 13, 3, 28, 9,
+	25, 10, 29, 1, -15, 5, -48, 14, 20, -9, 4, 11, 23, -15, 35, -32,
+	-1, -55, 43, -20, 29, 27, 25, 55, -36, -7, 29, 3, -7, 28, -2, -12,
+	21, -6, 18, -12, -9, 10, 27, 19, -16, 28, -25, 16, 10, -3, 32, -13,
+	53, 5, -31, -5, -24, -17, 27, -2, -17, -25, 24, -4, 35, -31, 38, -84,
+	33, 4, -5, 41, 27, 19, -24, 21, 15, 19, 2, -15, 29, 16, -30, -27,
+	34, -29, 22, 27, 2, 0, 18, 9, -26, 14, 22, -5, -3, 21, 2, -1,
+	-26, -18, -3, -27, 49, 20, -43, -11, 20, -17, -9, 2, 21, -45, -9, -18,
+	-17, 21, 41, 38, -31, 9, -10, 22, 8, 23, -12, 16, 6, 24, 4, 27,
+	-25, -29, -12, 26, 14, -20, -18, 6, 7, 23, 29, -23, 21, -29, -27, -35,
+	11, 4, -9, 11, -38, 18, 43, 16, 40, -22, 2, -62, -22, 20, -25, 1,
+	45, 13, -14, -26, 8, -24, 8, -31, 16, 26, 34, -17, -29, 2, -32, -25,
+	10, -15, 29, -5, -22, 0, -22, -14, 29, -16, -40, 3, 11, 4, -1, 19,
+	-6, -32, -2, 2, -28, 28, -28, -6, -17, 28, 23, -9, 16, -23, 8, -18,
+	3, -22, 12, 30, -8, 2, -34, 2, 12, -15, -7, -9, 5, 33, -35, 23,
+	11, -3, -35, -9, -27, -6, 15, 21, 19, -1, 30, 23, -7, 20, -1, -8,
+	23, -18, -6, 15, -27, 42, -47, 57, -24, 11, -2, -4, -15, -55, 29, -14,
+	23, 3, -3, -20, -17, 4, 17, 27, -36, 25, -3, 32, 27, -5, -6, -5,
+	-14, 19, -12, -18, -7, 31, -11, -8, 12, -5, -1, -8, 11, -31, -17, 32,
+	17, -16, -10, 42, 3, 34, 6, 4, 8, -2, -20, -22, -35, 62, -33, 34,
+	-9, 28, 28, 8, -34, 14, -28, -4, 16, -9, 5, 17, 26, 19, -28, 22,
+	0, 5, 14, 12, -6, -1, 9, 20, -6, -36, 10, 19, -5, -1, -2, 28,
+	-10, 3, -9, 61, -13, -12, -8, 10, -17, -16, -39, 2, 29, 15, -2, 2,
+	-31, -27, 17, 13, 12, 28, 4, 23, -22, 3, 8, -26, 8, -28, 5, -12,
+	-13, -7, -2, -16, 8, -28, -47, -10, -11, -28, 20, 6, -50, 28, -25, -4,
+	-29, 2, 18, 15, 19, 19, 0, 8, -20, 26, 22, -3, -31, -15, -5, -22,
+	27, -19, -36, -3, -18, 19, -20, 21, -15, -24, -35, -28, -8, -11, -9, 2,
+	-14, -12, 27, 6, 14, 6, 25, 35, 45, -4, 6, -33, -26, -8, -12, -36,
+	-10, -50, 28, 44, -31, 5, 6, 9, -32, 13, -2, 17, 13, 27, -24, -27,
+	-3, -1, -8, 10, -4, -17, -6, 20, 26, 2, 17, 23, 0, 0, -2, 0,
+	24, -31, 8, -29, 7, 47, 35, -23, 19, -17, 5, 6, -5, -53, 9, -35,
+	44, -9, 3, 6, -34, -14, 16, 19, 36, -2, -30, -11, -16, -26, 4, 24,
+	-2, -29, -19, 26, 42, 29, 1, 0, -1, -34, -7, -32, 28, 23, 6, -41,
+	9, -23, 7, -1, 6, -3, -7, -5, 8, -6, 44, -36, 24, 5, -19, 22,
+	-14, 21, -38, -2, -15, 10, -10, -2, 19, 22, -7, -18, 8, 29, 24, 2,
+	36, 3, 9, -27, -25, 15, 29, 25, -26, 8, 35, 35, 24, 9, -2, -30,
+	7, -2, 2, 14, -41, 20, 21, 19, 8, -9, 31, 3, 45, -3, 6, 0,
+	9, 11, -15, -8, 25, 24, -2, 14, 9, 23, 29, -20, -15, -28, -6, -5,
+	-23, -25, 1, -11, -13, 0, -26, 2, 28, 17, -10, 17, -38, 6, -20, 41,
+	-8, 30, -4, -16, 1, 7, 53, -24, 14, 1, -5, 12, -57, 32, -22, 7,
+	8, -17, -17, 7, 15, 31, 26, 4, -19, -13, -29, -13, 6, -7, -1, 9,
+	25, 26, 1, -28, 35, -9, -7, -13, -37, -18, 40, 3, 12, 4, 3, 29,
+	-47, 10, 20, -5, -27, 14, -15, 16, 3, 55, -3, 38, 1, -27, -24, 7,
+	-25, 32, -34, -24, 18, 9, 7, 29, -25, 21, -24, -6, 7, 32, -21, 0,
+	23, -14, -2, -30, -15, 13, 2, 1, -6, 12, 59, 25, -22, 26, -24, -16,
+	-35, 16, -16, 20, 8, 41, 5, 16, -68, -1, -14, 41, -32, 14, 10, 19,
+	-12, 3, -35, -14, -31, -7, 29, 9, -32, -21, -32, 20, -23, -2, -41, 15,
+	-10, 36, 2, 1, 14, -35, 32, -22, 52, -15, -3, 44, 10, 14, -68, 28,
+	8, 6, -7, -19, 25, 38, 0, -2, 38, -23, -16, -1, 16, -23, 6, 26,
+	-11, 10, 28, 7, -36, -28, 14, 14, -34, -9, -11, 9, -35, -10, -19, -28,
+	22, -15, 14, -9, 46, -35, 70, 15, -43, -15, -42, 23, -12, -14, -5, -1,
+	1, -42, 13, 22, 32, -16, 21, 44, -9, 17, -12, -2, 9, 36, 2, 14,
+	17, 7, 24, -17, -32, -20, 15, 24, -1, -27, 15, 3, -33, 11, -6, -31,
+	-56, -19, 20, -30, 33, 8, -21, 46, -37, -19, -56, 19, -24, -48, -4, -22,
+	13, 34, -24, 4, 14, 24, -20, 37, -31, -25, -3, -3, -9, 8, -30, 21,
+	-13, 4, -28, 13, -19, -16, 27, -13, -9, -1, -1, -1, -19, -6, 12, 13,
+	41, -11, 24, 4, 10, -12, 8, 41, -42, -18, 13, 26, -6, 24, -33, 12,
+	49, 18, -20, -9, -28, 25, 5, -10, 23, -33, 11, 7, -15, -14, 1, 15,
+	20, -26, -41, 16, 20, 29, -16, -16, 1, 3, 0, -16, -1, 73, 18, -14,
+	23, 30, 12, 6, -55, -40, -47, -37, 32, 20, 3, 18, -14, -20, 36, 58,
+	-23, -1, 20, 9, -22, -11, 20, 5, 22, 12, -5, -21, 13, -23, -25, 17,
+	-5, -1, 15, 9, 5, -26, 13, -12, -19, 14, 13, 23, -3, -7, -10, -23,
+	-7, 9, 7, 2, -14, -33, 24, -3, -7, 41, 2, -10, -18, 42, 42, -40,
+	-5, -32, -21, 14, -2, -10, -30, -23, 23, -24, -2, 31, -34, -4, 9, -5,
+	-5, 10, -1, -20, -2, 30, -33, -10, -10, 45, -21, -5, 13, 2, 15, -17,
+	-25, 12, -11, -9, 28, -6, -25, -15, 0, -44, 8, 21, 69, 0, -23, 11,
+	-9, 26, 2, -27, -23, -32, -23, 24, -1, -17, -27, -4, -28, -11, 29, -26,
+	3, -20, 17, 1, -15, -42, -37, 42, 18, -18, 29, 17, 18, -41, -9, 31,
+	-14, -4, 37, 36, -7, -7, 27, -61, -24, 31, 4, -49, -20, -21, -7, 29,
+	3, 4, -8, 8, -28, -16, -29, 19, -35, 21, 3, 1, 3, -29, 18, -31,
+	-3, 24, 24, -25, 22, 20, -49, 2, -42, 15, 27, 0, 36, 36, -32, 26,
+	-48, -3, 28, 23, 4, 25, 39, 55, -28, -19, -31, -9, -17, 13, 2, -13,
+	16, 25, -23, 33, 23, 5, 24, -29, 9, 25, -1, 0, 18, -8, -7, 2,
+	17, -5, -22, -7, -5, 38, 21, -40, -27, -8, 67, -23, -23, 20, -31, -9,
+	-26, -28, -4, -5, -20, 44, 26, -7, 25, 34, -7, -11, -24, -30, 10, -20,
+	-29, 11, -2, 5, 37, 16, -18, -10, 17, 2, 24, -8, 24, 33, -27, -29,
+	1, -16, -54, -15, -9, 18, 23, 46, 7, -2, 27, 0, -30, 44, -21, 45,
+	-5, -8, -24, 30, 23, 5, 26, 24, -6, -12, 2, -25, 5, 20, -22, 16,
+	32, 9, 15, -9, 15, -28, -27, 7, 11, -8, -21, -19, -25, -23, 18, 4,
+	-29, -23, 6, -31, -6, 37, 49, 34, -2, 1, -34, 35, -35, 19, 33, -25,
+	-20, 6, 28, 19, 4, 20, -10, 33, 33, 4, 25, -24, 5, 14, 0, -9,
+	-4, 14, 15, 23, 3, -6, -36, -4, 17, 4, -14, 5, 18, 5, -48, 17,
+	9, -4, 24, 31, 65, 50, -4, -29, 16, 28, 10, 1, -7, -20, -16, 45,
+	0, 50, 16, 5, -8, -14, 13, 21, -2, -25, 7, 1, 23, -12, 35, -32,
+	-2, -29, -17, 24, -24, 18, 20, 11, -36, -8, -11, 46, 47, -25, 14, 20,
+	-8, -39, 2, 27, 30, 33, 3, 19, 0, -13, 15, 27, 10, -19, 31, -24,
+	-32, 7, 27, -10, 14, -7, -23, 5, -16, -10, 14, 8, 10, -7, 8, 24,
+	-25, 22, -10, -5, 22, 15, 11, 21, -20, 58, 39, -27, 13, 15, 46, -54,
+	-71, -22, -20, -23, 31, -22, 14, 5, 17, -5, 0, -6, -30, -16, -22, -1,
+	11, -16, 1, -32, -32, 17, 17, -21, 31, -13, -27, -21, 38, -14, 29, 5,
+	16, -7, 11, -22, -29, 8, 33, 5, 22, -26, 13, 23, 37, -42, -40, 20,
+	-16, 32, 2, 9, 19, -19, 37, 10, -27, -21, 18, 21, 3, 31, -21, 10,
+	-27, 18, 3, -29, -21, -5, 17, -10, 4, -22, 8, -11, 27, 7, -11, 14,
+	-21, -15, -14, 33, -32, 21, -5, -20, -9, 8, 53, -63, -32, -20, 5, -4,
+	21, -23, 10, 15, 26, 29, -31, 30, 3, 8, 7, 16, -4, -11, 26, 4,
+	-15, -6, -16, 22, 29, -2, 38, 9, 32, -24, 9, -27, 3, -2, 22, 9,
+	-18, 9, -15, 8, 17, 31, 11, 39, 44, -43, -53, -4, -2, 11, -27, -40,
+	25, -7, 3, 59, 11, 10, -23, -22, -31, -22, -9, 10, -10, 32, 10, -28,
+	-1, 13, 14, 13, 6, 25, 37, -19, 16, 17, -2, -29, -31, -30, 10, -31,
+	25, 18, -6, 26, 20, -48, 20, -4, 30, 0, -14, -8, -5, -8, -8, -3,
+	6, -32, -14, -13, -21, 2, -31, -22, -26, 11, -17, -20, 29, -1, 14, -14,
+	7, 19, -21, 0, -21, -19, 8, -19, -3, -31, -31, -14, 16, -35, 18, -6,
+	38, 12, 36, 3, -6, 8, -5, 2, -24, -10, -53, -8, 19, -15, -26, -32,
+	8, -3, -13, 37, 14, 20, 2, 6, -17, 11, 23, -21, -16, -17, 11, 10,
+	9, 22, 11, -16, -30, 2, -24, -1, -22, 29, -38, 19, -15, 19, -14, -39,
+	28, -30, 25, -1, 25, -36, -23, -15, -42, -28, 17, 13, 29, -34, -26, -18,
+	-9, 35, -25, 14, 30, 10, -26, -33, 14, -28, -32, -20, 19, -25, -26, 10,
+	-40, 26, -20, -24, -1, 32, -33, -28, -15, -19, 5, 3, 38, -10, 24, -37,
+	14, -22, 15, -28, 13, 11, 3, 20, -14, 6, -22, -34, -15, 4, -16, 33,
+	21, 4, -25, -31, 14, -21, 33, -16, 21, 33, 18, 22, -30, -28, 11, 31,
+	14, 23, 30, -5, -23, -21, -17, -12, 14, 4, 2, -28, 40, -38, 19, 24,
+	-14, -31, 4, 27, -47, 29, 18, -38, -10, -24, -5, 34, 0, 34, -26, -31,
+	21, -31, 27, 25, -32, 20, 33, -4, 4, -18, -21, -21, -23, 5, 35, -30,
+	-30, -4, 4, 17, 26, -30, -48, 23, 12, -30, 31, 27, -22, -32, 13, 30,
+	23, -22, -20, -70, -34, -18, 38, 30, -20, 12, 32, -10, -33, 18, -29, -2,
+	-33, -22, 30, 10, -12, 6, -11, -18, 1, 8, -12, -32, 20, 19, -11, 13,
+	19, 7, 1, -4, -35, -21, -44, 13, -14, -21, -28, -7, 28, 19, 13, 20,
+	-1, -34, -40, 21, 26, 34, 7, 10, -1, -32, 18, 32, 11, 17, 11, 12,
+	-32, -18, -3, -24, 19, -22, -29, 27, 35, 11, 25, -22, 24, 24, -17, 31,
+	-5, -8, -30, 22, -5, -5, 31, 25, 6, -17, 29, 28, -17, -28, -22, -15,
+	-17, 12, -1, -4, 28, -26, 24, -34, -13, 9, 19, 9, -10, 14, -13, -32,
+	7, -27, -30, -30, 6, -3, 20, 16, -23, 12, -15, -11, 33, 23, 36, -21,
+	-16, 40, -41, 12, 17, 5, 11, -2, 9, 35, 4, 21, -42, -19, -15, -15,
+	2, -3, -21, -13, 34, -32, 28, 3, 12, 12, 21, -6, 5, -32, -34, -26,
+	0, -3, 10, 18, -15, 2, 17, -12, -19, -18, 4, 29, 2, -33, -29, 11,
+	-41, -20, 1, 23, 0, 14, 50, 42, -25, 3, -7, -29, -10, 28, -15, 18,
+	-1, 5, 47, -52, 10, -16, 31, 27, 5, 20, 3, -1, 10, -9, -27, 1,
+	-24, -14, 19, -8, -24, -21, 19, 30, -22, -10, -12, 31, 30, -30, -1, -15,
+	-75, -83, -28, 42, 31, 5, 5, -4, -7, 15, -21, 57, -61, -30, -10, -5,
+	-23, 13, -12, 5, -13, -9, 17, -5, -17, -26, 16, 0, -33, -14, -17, 29,
+	18, -29, 6, -30, 29, 11, -5, 3, -23, 35, 37, -18, -17, -11, -59, -76,
+	14, 49, 7, -27, -4, 2, -2, 20, 36, 25, 2, -1, -22, -12, -5, -1,
+	-7, -20, -26, 15, 30, -15, 19, -27, 3, 32, -26, -7, -20, -26, -3, -27,
+	36, 26, -8, 5, 19, 25, -41, 12, 25, -43, -40, 6, -47, -1, 0, 25,
+	-26, 23, -33, 29, -6, 42, -3, 17, 17, -1, -24, -21, -15, -19, 34, 1,
+	12, 21, 25, -26, -16, -26, 32, 14, 3, -26, 28, -34, -17, 25, 3, -4,
+	28, -19, 1, 1, -48, -20, 17, -50, -33, -48, -24, -30, 5, -5, -12, 6,
+	45, 9, 39, 4, -13, 23, -30, -31, -43, -15, -23, -5, -2, 18, 34, 29,
+	-17, 13, -26, 6, -7, -1, 20, -34, -25, 16, -16, 6, 32, 26, -30, 18,
+	33, -13, -13, 17, 80, -37, -14, -47, -18, -58, 5, 24, -45, -22, 18, -25,
+	28, 7, -14, -15, -40, -66, -10, -5, -10, -30, -7, -28, -16, 25, -19, -11,
+	-10, -12, -14, -8, 26, 21, 17, -4, -29, -23, -10, 8, 15, -12, -28, 17,
+	-47, 32, 18, -53, -37, 14, -12, 20, -21, 8, -3, 6, 9, -26, 54, 1,
+	-17, -18, 1, -28, 33, 17, -53, -24, -9, 28, -22, 21, -12, 16, 17, 23,
+	-2, 8, 17, 24, 25, 14, 11, 10, -26, -17, 18, -1, -5, -19, -26, 4,
+	-26, 14, -27, 47, 13, -1, 26, -5, 24, 1, 0, -12, -12, 0, 1, 3,
+	20, 12, 46, 13, -25, 13, 28, -16, -29, -32, -7, -3, 13, 7, -13, 9,
+	26, -2, -2, 19, 30, -15, -26, -11, -7, 5, -32, 0, -43, -17, 11, -29,
+	-39, 59, -17, 35, 41, -20, -42, -32, 11, -50, 57, 7, 9, 10, 6, -20,
+	42, 10, -50, 24, -10, -21, 23, -30, 33, 27, 9, 15, -18, -3, -10, 18,
+	-26, -18, 14, -1, -31, -32, -6, 22, -28, 29, 9, 21, -10, -14, -14, 58,
+	-13, 7, -11, 34, 2, -3, 1, -16, 36, -1, -29, 35, -34, -21, 37, 12,
+	-35, -26, -17, 8, 3, 8, -28, 1, -7, -30, 12, 21, -1, -24, -23, 29,
+	32, -12, -2, 22, 5, 18, -1, 31, -12, -15, 20, -28, -17, 11, -4, 18,
+	35, 15, -19, -45, -1, -46, 28, -15, 17, 19, -24, -19, 27, 18, -53, 42,
+	5, -6, 15, -23, -29, -6, 25, 6, 23, 10, -17, -7, 26, -5, 33, 29,
+	-29, 25, -14, -8, 19, -22, -14, -31, -3, 35, 29, 12, -35, 17, -17, 13,
+	48, -25, 20, 34, 16, -3, 1, 5, -1, 9, -19, 23, -34, -18, 24, -1,
+	26, 16, 6, -1, 16, -7, -7, 16, -18, -9, -23, -10, 31, -24, -7, 15,
+	-8, 22, 24, -12, -30, 11, 26, 0, -17, -24, 24, 14, -2, 11, -11, -41,
+	12, -3, -25, 11, -14, -37, -7, -13, -7, 20, 27, -17, -7, -22, 9, -6,
+	-4, -31, -29, -20, -28, -29, 12, 4, 21, -27, 19, -22, -14, 4, 18, -19,
+	-24, 24, -17, -8, 14, -48, -28, -42, 4, 6, -23, -33, 45, -18, 22, 24,
+	-20, -12, -19, -51, 10, -10, 14, -15, 36, -20, -9, 18, -8, -5, -32, 5,
+	0, -13, 24, 33, -18, 25, -9, 8, -10, 2, 13, -25, 23, -1, 6, -21,
+	-23, 12, 25, -46, -41, -39, -25, 30, -23, 27, 71, -19, 34, 7, 1, -17,
+	-37, -30, 38, -25, 4, -35, 15, 8, -6, -25, 32, -14, 10, -31, -15, 27,
+	32, 32, -1, -30, -26, -8, 1, 13, 19, 19, -2, -19, -4, -2, -9, -19,
+	-40, -38, 11, -4, 25, 16, 21, -18, 69, 8, 29, 5, 23, -30, -17, 13,
+	32, -5, -33, -27, 41, 16, 20, 13, 22, 4, -23, 27, 5, -30, 23, -9,
+	33, -17, -33, -3, 13, 10, 16, -24, -7, -1, 10, 27, 7, -43, 18, -1,
+	-33, 50, -3, -9, -1, -17, 33, 17, -15, -26, -2, 42, -9, 9, 29, -19,
+	-64, -10, -3, -3, 11, 15, -20, 3, -4, -27, 21, -30, 8, 2, -16, 26,
+	11, -27, 10, 12, -16, 21, -9, 18, -21, 14, -27, 3, -33, -7, -22, 1,
+	23, -10, 52, -54, 39, -35, 10, -18, 8, 11, -31, -5, 14, -38, -33, 2,
+	15, -9, -15, -19, 4, 13, 18, -33, -18, -19, -9, -11, 21, 0, -7, 21,
+	25, -30, 6, 28, -13, -2, -24, 31, -33, -12, -8, -11, -35, 22, 19, 13,
+	-15, -30, 60, -11, -3, -47, 11, 6, 15, 1, 28, -7, -58, 19, 23, 16,
+	-30, 10, 7, 22, -12, 26, 5, 20, 0, 8, 30, -22, -5, -24, 14, 7,
+	28, -13, 14, -5, -12, -13, 4, 1, -22, 7, -40, 33, 8, -5, 47, -20,
+	5, -8, 3, 6, -25, 21, 18, 4, 22, -37, 2, 9, -36, -20, 19, 18,
+	-26, -32, 21, 2, -5, 27, 6, 5, 35, -17, -7, 16, 16, 29, -6, -8,
+	-11, 0, 16, -14, -23, -26, -18, 26, -46, -2, 27, -12, 4, -43, -7, -9,
+	20, -47, -2, 54, 19, 49, -38, -18, -20, -24, 9, 3, -21, 5, -19, 0,
+	-10, 5, 14, -12, 25, 30, 35, 28, -2, 8, -5, 31, 31, 27, 33, -25,
+	-2, 7, -4, 41, 23, -40, -7, -2, -23, -45, 29, -1, -4, -9, 14, -14,
+	19, 47, 15, 20, 0, -17, 24, 34, -3, -8, 4, 28, 6, 1, 33, 14,
+	-11, 14, -28, 10, 9, -13, 35, 7, -23, 21, 18, -14, 26, -25, -27, 18,
+	-53, -9, 12, 23, 7, 7, 7, -69, 38, -13, 14, -43, -49, 12, -32, 60,
+	-10, -17, -26, -24, 45, -1, 5, 3, -15, -1, -4, -36, 30, -9, 7, -1,
+	23, -28, 8, 17, -21, 21, -39, -11, -13, -20, 13, -2, 2, -22, -37, 0,
+	13, 8, 11, -32, -28, -66, 16, 19, 20, -33, -14, 23, -32, 0, -3, 39,
+	-60, -26, -19, -18, 13, 34, 28, -8, -24, -35, -9, -11, -9, 4, 3, -7,
+	-29, -23, -23, 2, -44, 7, -24, -5, -21, 2, 39, -6, -68, 11, 22, 2,
+	3, -21, -44, -52, 13, 31, -5, 20, -5, -13, -34, 22, -27, 17, -23, -21,
+	-32, -21, -2, 25, -19, -3, 24, -32, 23, 2, -5, -13, 23, -37, -15, 14,
+	-18, -1, 10, 0, 35, -10, -4, 7, 1, -4, -70, -19, 46, 13, 10, 20,
+	-32, -21, 29, 14, 39, -23, -11, 2, -2, 54, 7, -8, -35, 2, -8, -14,
+	16, -18, 37, -19, 27, 4, -10, -15, 29, -31, -16, -4, 25, 8, 12, 2,
+	-16, 3, -28, 22, -11, 14, -15, -15, 20, -4, -67, -16, -8, -35, -14, -26,
+	-12, -1, 51, 60, 7, -14, 9, -16, -34, 3, 2, 0, 36, 12, 52, 29,
+	1, -31, -25, -27, -16, -5, 7, -23, 32, -32, 8, -6, -26, 6, 28, -8,
+	5, 22, -14, 4, 21, -27, -35, -46, -54, -6, -14, 19, 12, -19, 19, -25,
+	35, 34, -7, -30, 0, 8, -26, 16, 14, -3, -26, -4, -19, 45, -15, -11,
+	-1, 19, 18, -17, -19, 27, -30, 4, -8, 25, 31, 18, -22, -5, -9, -20,
+	-16, 17, -2, 28, -40, -29, -3, -33, 20, 10, -16, -13, 15, -17, 1, 53,
+	10, -25, -19, -26, -4, -35, -35, 14, -4, 12, 49, 26, -8, 18, -2, 27,
+	-28, 15, -32, -1, 33, 12, -23, -6, 22, 2, 19, -2, -25, 28, -22, 19,
+	-3, 4, -31, -13, -33, -33, 20, -3, 35, -7, -20, -30, 61, 59, -12, -22,
+	-24, -18, 12, -18, 7, -16, 20, 0, 15, 20, -24, 2, 3, -18, 29, 31,
+	-5, 15, -19, 18, 29, -22, -24, -32, -20, -28, 3, -3, 3, -8, 16, -22,
+	-17, -28, -17, -18, -9, 5, -19, -18, -23, -50, 17, 42, 16, -28, 18, 4,
+	29, 1, 6, 30, -1, 31, 30, 7, -22, -8, -13, 3, -27, 5, -13, -10,
+	-4, 29, 21, -18, -1, -23, 18, 10, 9, 8, -16, -25, -17, 21, -50, 27,
+	8, -12, 8, -7, 1, -41, -9, -19, -13, 2, 11, -21, 2, 37, 9, -22,
+	17, -19, -11, 25, -4, 50, -15, -30, 1, -30, -28, -3, -25, -31, -11, -3,
+	33, 29, 9, 31, -16, -27, 31, 1, 4, 8, 11, -29, -50, 22, 0, -19,
+	-7, 44, -34, -22, -16, -32, 22, 5, -5, 5, 19, 49, -15, 15, -21, -27,
+	1, 24, 16, 54, -32, 26, -16, 24, -5, 20, -3, 20, -26, -24, -20, -7,
+	-25, 12, 8, 24, -19, 22, -6, -25, 18, -13, -8, 21, 26, 26, -15, 23,
+	23, -33, 33, -22, 34, 25, -3, -20, 0, 29, -17, -17, -6, -17, 34, -24,
+	-12, 32, 13, 1, 20, -27, 32, -21, -14, 8, -21, 31, 1, 6, 13, -6,
+	4, -24, 19, 26, -9, 15, -1, 31, -54, 15, 28, -18, 34, 10, -29, 38,
+	36, 18, 11, 32, 15, 22, 22, 6, -22, 12, 7, -10, -18, -13, -41, 43,
+	14, -22, -4, 25, -16, 21, -2, -26, 17, -21, -7, 7, -13, -33, -5, -1,
+	-3, 6, 30, 11, 29, 22, -14, -12, -20, -12, -19, 64, 10, -16, 28, -4,
+	44, -2, 1, 21, 15, 28, -16, 18, -22, -35, -21, -15, -48, 13, 8, 8,
+	27, -28, -32, -11, -6, -1, -19, -27, -14, -31, 9, 21, -16, 33, -13, 7,
+	-10, 11, 20, -13, 0, 3, -7, -12, -25, -33, -30, -1, 12, -5, -15, 6,
+	22, 6, 19, 22, 4, -7, -6, 13, -32, 7, -10, 17, 1, 17, -13, 18,
+	1, 35, -16, -26, 22, -11, -7, -22, 3, -13, -36, -25, 16, 3, -5, 5,
+	28, 30, -40, 20, -15, 18, -35, -41, 34, -32, 37, -36, 7, 21, -15, 42,
+	33, 36, -33, 13, -38, 11, -18, -16, 2, -10, 28, 32, 9, 12, 4, -8,
+	-7, 5, 10, 23, -3, 13, 30, 27, 30, 16, -22, -25, 31, -23, 31, -18,
+	-1, -21, -9, 6, -31, -28, 0, -14, 15, -16, 0, -16, 25, 33, 21, 30,
+	-9, 11, -29, 9, -10, -41, -5, 30, -19, -12, 1, -23, -9, -23, -7, -19,
+	-12, -6, -33, -13, 7, 18, -34, 24, -12, 9, 3, -1, -10, -33, -26, -5,
+	37, -11, -25, -25, -1, 9, -12, -15, -16, 10, 43, 16, 8, 18, -35, 47,
+	-1, 34, -22, 26, -40, 23, -19, -11, -26, 28, 14, 11, -16, -20, 20, 14,
+	-21, 0, -10, -8, 24, 7, -33, 30, -20, 16, -30, 30, -53, -53, 17, 50,
+	-29, 8, -21, -9, 21, -2, -19, 8, 29, -5, 3, 21, 2, 60, -24, 43,
+	-17, -36, -34, -12, 2, -13, -21, -10, -14, -6, -30, 13, -6, -10, -27, 14,
+	-19, 11, -9, 0, -8, 28, 6, 10, 33, -2, -17, -3, 13, -27, -34, -21,
+	-3, -1, 14, 28, 49, 36, 20, -22, 12, 22, 3, 41, 2, -22, -56, -17,
+	2, 12, 9, -33, 1, -11, 28, 22, -19, -25, -8, -1, 33, -2, 13, -9,
+	-19, -11, 21, -21, -4, -18, -31, -26, 42, -20, 12, -34, 13, -39, -41, -15,
+	30, 55, 39, 2, 21, -1, -15, 24, -28, -8, 14, 3, -39, 27, -14, 1,
+	10, -12, -1, -31, 0, -14, -12, -21, 5, -16, 26, 12, 23, 22, 19, 27,
+	-2, 21, -33, -21, -26, 25, -5, 11, 29, -64, -29, -22, -13, 24, 7, 53,
+	40, 51, -22, 3, -24, 3, -34, -20, -27, 9, -57, 25, 14, -9, 1, -4,
+	-18, -33, 28, -25, -13, -16, -27, -17, -8, 24, -25, 30, 10, 13, 23, -25,
+	29, -11, 30, 3, 38, 42, 29, -69, 22, -38, -43, -14, -5, 63, 19, 39,
+	4, -34, -33, 21, 24, -6, 15, -26, -33, -3, -8, 5, -26, -31, 6, 14,
+	-10, 18, -4, -26, 24, 11, 14, 24, 5, 18, -11, 21, 34, 7, -15, -1,
+	28, -20, -20, 25, 7, -79, 19, -14, 8, 28, 1, 24, 49, 9, -27, -20,
+	-26, 4, 19, 24, -6, 31, -34, -31, 0, -7, 32, 23, 18, -13, -1, 12,
+	-14, 0, -6, -26, 30, -23, 18, 3, 25, 11, 13, -9, -32, 30, 8, -25,
+	22, -22, -20, -8, 50, 30, -6, 18, 30, -38, 29, -43, -42, -7, -25, -10,
+	-18, 8, -2, -20, -14, 10, 11, 9, -23, 24, 9, -29, -16, 22, -20, 26,
+	-13, -17, -3, 7, -33, -2, 24, -29, 13, 30, 31, 7, 18, -7, 17, 17,
+	-11, -19, 45, -3, 30, 19, -41, -15, 14, -47, -29, 13, 1, -36, -9, -35,
+	16, 8, 1, -22, 25, -44, 22, 16, 5, 0, 31, 1, 1, 0, 4, 23,
+	6, 27, -14, -5, -12, -27, -28, 32, 31, 5, -31, 10, -21, -23, -7, 26,
+	-6, -1, 1, -3, 13, 24, 20, -19, -25, -9, 9, -27, -10, -2, -8, 4,
+	6, 7, 12, -17, 6, -8, -19, -27, 11, -21, 30, -31, -21, 18, 5, 4,
+	-6, 32, -12, 24, 1, 24, -9, -10, 8, -5, -21, 2, -14, 39, -10, 37,
+	-5, 0, -12, 18, -12, -22, 1, 10, 1, 14, 28, 20, -6, 20, 7, -23,
+	23, -42, 15, -1, 31, -6, -23, -14, -15, 23, -10, -22, -34, 9, -31, 20,
+	-5, 10, -17, 21, 3, 11, -3, 5, 18, -14, -16, 40, 46, 13, 46, -12,
+	14, -28, -13, -55, -18, 19, -39, -42, 3, -7, -28, 13, 40, -8, -7, -25,
+	-9, -26, 0, 34, 13, 26, -2, -16, -2, 28, -19, 17, -22, -15, 34, -18,
+	30, -24, 26, 4, -22, 30, 27, -7, -12, 7, 67, 24, -4, -27, 18, -39,
+	-14, -13, 34, 5, 39, 50, -52, -19, -37, -42, 43, -10, 28, 55, -8, 5,
+	-20, 16, -27, 14, -5, -16, 33, 22, -16, 28, 7, -4, 34, 14, -11, 6,
+	-7, -23, -20, 23, 17, -6, -3, 8, 60, -20, -4, 30, 15, 6, 20, -34,
+	-21, 43, 15, 20, 11, 0, -2, -33, 25, 32, -25, 41, 32, -18, 4, 5,
+	-23, -1, 31, 0, 35, 20, 28, 31, 14, 5, 40, -6, 0, -20, -13, -20,
+	9, 31, -9, 10, -13, -38, 71, 17, -26, -27, 11, -24, 0, 15, -28, -11,
+	14, 18, 4, 27, -10, -33, 4, 36, -16, -27, 29, -28, -26, -34, 28, 13,
+	29, 3, 1, -27, 5, -10, 7, -18, 43, -4, 29, 29, -1, 24, 19, -19,
+	-26, 24, 20, -43, 72, 24, 13, 2, 24, -12, -30, -14, 31, -41, -1, -4,
+	-31, 25, -11, -19, -1, 23, -5, -4, 13, -5, 21, -30, -29, -7, 0, -10,
+	-19, -10, -6, -9, -15, 27, 14, 10, -9, -1, 7, 4, -6, 14, 16, -1,
+	21, -24, 21, 21, 3, 42, 27, -14, 10, 16, -37, -29, -3, 47, -41, -11,
+	-9, -73, 25, 2, -40, 40, -18, -8, -1, -14, -31, -24, -28, -12, 19, 12,
+	27, 11, 5, -6, 18, -23, -13, -16, 1, 29, 21, 24, 47, 20, -32, -18,
+	16, 48, 45, 3, -17, 14, -30, 72, -46, 18, -43, -5, -31, 4, 16, -5,
+	2, -10, 0, -18, 13, 29, -24, 22, 9, -32, -13, -20, 4, 19, 31, -13,
+	23, 3, -21, 23, 17, -10, -14, 13, 27, 3, 22, -17, -18, -57, 39, 1,
+	30, -18, -15, 7, -10, 57, -25, -6, 3, -28, -22, 4, -23, 6, 1, -22,
+	3, 17, 3, -2, -23, -11, 14, 19, 29, 19, 26, 23, -5, -30, -13, -27,
+	-17, 21, 28, -30, -2, -11, 28, 15, 43, -25, -36, -40, 20, 8, 9, -3,
+	5, 35, 9, 72, -20, -5, -2, 13, -11, 21, -31, 20, 32, -18, -4, 16,
+	-10, -10, -16, -5, 31, 12, -31, -13, 32, -19, -5, -8, 26, -28, -2, -12,
+	24, -3, -17, -10, 16, 21, 31, 0, -37, -27, -5, 33, 45, -31, 5, -17,
+	-39, 49, -45, -2, -1, -48, 6, 20, -24, 7, 30, -20, -17, 30, -3, -19,
+	26, -3, 27, 17, 3, 26, -32, 18, 6, -4, -30, 18, 13, 8, -28, -22,
+	-11, 10, 12, -14, 14, 22, -10, -18, 8, 30, 23, 14, 1, -13, -52, 44,
+	-31, -20, 10, -28, 36, 16, 20, 7, 9, -17, 29, -29, -3, -27, 11, -29,
+	-6, 23, 22, -12, -1, 31, 21, -2, -4, -18, 6, 17, -27, -20, 25, 22,
+	0, 9, -7, -20, 1, -14, -27, 66, -35, -26, 35, -33, 45, -37, 45, -21,
+	6, -32, -21, 16, -9, -2, -22, -1, 25, 3, -22, -29, 13, 26, -16, -31,
+	-16, 20, -14, -22, 16, -14, -29, -26, -33, -14, -26, 5, -4, 24, 22, -1,
+	16, 21, -21, 5, -51, 13, 13, -5, 28, -40, 12, -37, 59, -14, -16, -30,
+	-2, 14, -5, 35, 16, 7, 14, 25, 6, 17, 8, -11, 25, 1, 15, -10,
+	-25, -19, -7, -3, 21, 25, -12, 26, 23, 30, 25, -22, 26, -27, -23, -23,
+	-27, -31, -13, -4, -12, 10, 54, -58, 47, -3, 42, 7, 31, -7, 6, 28,
+	8, 17, -14, 30, 7, 14, 26, -32, -9, 24, 13, -18, -1, -6, -4, -13,
+	-16, -6, -23, -23, -1, -3, -7, -32, -14, -24, 3, -1, -40, -19, -30, -45,
+	-18, 37, -41, -25, 34, -50, 43, 33, 24, 34, 27, 19, -29, 46, -20, 32,
+	12, 13, 32, 26, -27, -18, -28, 8, -20, -10, -31, 31, -4, 26, 19, 16,
+	16, 21, -23, 7, 21, -25, 27, 5, 19, 21, -18, -32, -1, -18, -10, 42,
+	12, -5, 48, -59, 64, 53, 48, -13, 30, -23, -14, 42, -31, 3, 3, 33,
+	13, 12, 28, 4, -17, -12, 14, 15, -4, -30, -1, -33, -28, 21, -1, -25,
+	5, 10, 10, 14, 18, -29, -8, -34, 21, 33, 3, -40, -17, -4, 51, 20,
+	31, 17, 21, 62, 19, 16, 24, -4, 10, 32, 16, 57, 1, -8, 3, -12,
+	-11, 15, -25, -21, -13, -31, -19, 25, -29, 12, 19, 10, -15, -19, 28, -3,
+	-19, 2, 7, 14, -16, 27, -31, 4, -2, -5, 13, -18, 1, -37, 2, 25,
+	37, 17, 21, -19, -12, 14, -28, 1, -23, 36, 4, -23, 29, -30, 25, 5,
+	28, -11, 25, -20, -34, 35, -24, 3, 25, 0, 16, -7, 28, 30, 25, -19,
+	17, -5, -22, -9, 18, 2, 28, -29, 4, -20, 8, -1, 38, -7, 31, 38,
+	34, 4, -40, 38, -5, -11, -42, 49, -28, 2, 59, 9, 5, -15, 9, -24,
+	18, 24, 9, -9, 21, -23, -31, -5, 10, -7, -27, -12, -26, -4, -21, -24,
+	20, 10, -28, 47, 8, -24, 10, -35, 6, -47, 24, -29, 14, 2, 0, 11,
+	-39, 6, -29, 0, -16, 20, 16, -29, 10, 12, -14, 16, -24, 12, 31, 16,
+	-22, 1, -13, 10, -8, -23, 27, 4, 13, 22, 21, 30, -13, 23, -32, -1,
+	-22, 37, 19, 37, 19, -10, 32, -56, 25, -2, 19, 45, -11, 31, 49, 18,
+	-12, 13, -33, 40, 8, -7, 51, 52, 22, -7, -6, -29, 25, -4, 11, 5,
+	24, -21, 18, -23, 14, 23, 19, 5, 5, 20, -16, -16, 9, -7, 0, 16,
+	-34, 19, 21, 0, 31, -9, -8, 17, -49, 35, 10, -2, 38, 44, -37, 21,
+	6, 1, -6, -14, 42, -18, 22, 16, 23, 26, -30, -11, 27, 4, -32, -2,
+	-24, -26, -34, 31, 15, 32, 12, -31, -12, -8, -3, -28, 9, -10, -35, 7,
+	49, 51, -1, -20, 7, 10, -3, 22, -2, 7, 44, 8, -40, 29, -28, 7,
+	23, -6, 23, 33, -21, 23, 13, 7, -13, 10, -30, 6, 31, 9, -29, 16,
+	-1, -27, 1, 18, 4, -3, -8, -6, -9, 15, -2, -37, 19, 19, 46, 54,
+	2, 33, -2, 27, -21, 31, -30, -12, 33, 70, 2, 7, -29, 40, 23, 13,
+	-5, -10, -12, -20, 23, -29, -30, 25, -20, 7, 11, 24, 12, 15, -24, -18,
+	-13, 21, 4, 19, -12, 25, -33, -5, 20, -27, -4, 30, -9, 18, 42, -11,
+	3, 53, -23, 34, -7, -23, 30, 55, 14, 15, 2, 23, 5, -23, -6, 25,
+	-7, -24, -35, 9, 2, 13, 22, 14, -14, 17, 24, 33, -24, -6, -6, 8,
+	-27, 24, -19, -32, 29, 12, -9, -8, 26, 12, 11, 0, 55, 19, -7, 51,
+	3, 58, 2, -11, 53, 51, -6, 12, -46, 30, 31, 4, 20, 9, -14, -20,
+	-5, -14, 8, -19, -11, 13, -8, 6, -24, -26, 21, -18, -39, 3, -6, 23,
+	-22, -30, 30, -21, -24, -2, -46, 50, -49, 32, -23, -33, -15, -36, -7, -39,
+	-51, -7, -42, -10, 33, -35, -6, 39, 22, 2, -13, -12, -32, -12, 28, -28,
+	-23, 20, -12, -6, -26, -1, -11, 24, 13, 17, 8, -3, 6, 10, -28, 1,
+	18, -18, -29, -28, -41, 42, -47, 5, 3, -28, 6, -40, 45, -21, -30, 8,
+	14, -19, -15, -30, -21, -22, 18, 10, -36, 13, -1, -30, 20, 3, 27, -21,
+	32, 15, 29, -23, 4, 21, 3, -25, 17, -25, 25, -17, 8, 9, -5, 24,
+	-24, 28, 10, 31, 9, -17, -18, -19, 0, -34, 14, -31, 22, -32, -40, 2,
+	38, 23, 7, 14, -21, 2, -45, 11, 8, 0, -5, -13, 2, 23, 20, -3,
+	21, -26, 31, -7, -6, -25, 23, -4, -32, 6, -18, -19, 8, 24, 5, 6,
+	-7, 8, -28, 17, 39, -7, -6, -41, 34, -22, 7, 8, -14, 18, 22, -23,
+	0, 3, 22, 44, -41, -1, 12, -32, -24, 26, 8, -4, 24, 16, -21, 3,
+	11, 18, -3, 24, 15, -17, -7, 9, -22, 27, -23, 14, -21, -22, 35, 7,
+	18, -8, -21, 1, 32, 11, 21, -30, -8, -15, -33, 6, 25, -5, 4, 13,
+	26, 10, -16, 34, 21, -32, -27, 15, -4, 27, 8, 23, -11, -14, 11, 27,
+	16, -3, 24, 33, -23, 30, 28, -7, 0, 22, -19, -30, -36, 2, 14, -28,
+	7, -39, 10, 14, 21, 33, -13, 40, -34, -6, 38, 20, -17, -22, -51, 8,
+	-12, -1, -18, 2, -29, 13, 19, 9, -1, 8, -14, -12, 6, 8, -29, 11,
+	-23, -22, -10, -25, 1, -8, 19, 10, -27, 7, 15, -19, 13, 9, -42, 5,
+	-41, 0, 17, 18, -10, 18, -29, -22, 1, -19, 38, -10, -48, -28, -10, 18,
+	-22, -27, -31, 18, 17, 27, -15, 0, 1, 17, -3, 28, -33, 13, 3, 3,
+	-16, -26, -24, -27, -3, 20, -19, -39, 16, 3, 10, 9, 4, -26, -20, -13,
+	-13, 39, -7, -7, 37, -7, 32, -25, -13, -57, -3, -24, 30, -25, -3, -12,
+	-3, 14, 31, -6, -18, 28, 19, -23, -25, -10, -24, -25, 11, 33, 19, -21,
+	22, -29, -10, 30, 27, -15, -14, -21, -3, -16, -37, 1, -22, -13, -6, 50,
+	25, 35, 15, -19, 0, -29, -13, -47, -58, -32, 35, -29, -3, -21, -12, 21,
+	-34, -26, -1, 33, 31, 22, 18, -6, 12, -17, 9, 32, 8, 16, -18, 4,
+	25, -1, 21, -33, -28, 18, 4, 7, -21, 10, -29, -1, -21, 24, 13, 41,
+	22, -28, 9, -38, -15, -5, -10, -23, 29, -20, 2, -27, -19, 12, -29, -7,
+	-18, 23, -12, -8, -9, -1, 5, -4, -12, -24, -30, 11, -10, 3, -9, -5,
+	-32, -1, 2, 14, 25, 16, 9, 4, 26, 44, 1, 42, -5, 25, -25, 24,
+	-15, 29, -49, -42, -60, 18, -10, 27, -11, 3, 3, -7, -24, 30, 17, 2,
+	-22, -24, 14, 28, 15, 8, -29, -9, 4, -9, 0, 11, -25, -31, -1, 11,
+	9, -9, 19, 10, -38, -30, -9, -10, 24, 2, 10, -32, 6, -5, -38, 23,
+	-28, 12, -37, 31, 0, 23, -9, -6, 15, 4, 23, 11, -19, -7, -12, -30,
+	24, 17, 7, 27, -9, 13, 22, 7, 0, -27, -6, 1, -13, -30, 5, 29,
+	40, 9, 20, -32, -1, -13, -16, 23, 38, 9, -20, -10, -3, 43, -29, -18,
+	-6, 26, 68, 21, -14, -16, 8, -21, 1, 29, -26, 8, -19, 31, 1, 24,
+	0, 26, -11, 17, -5, -15, -37, 30, 11, 25, -6, -32, 25, -27, -8, 29,
+	7, -55, -10, 32, 12, 26, 12, 19, 0, 15, -18, 8, 7, -15, -34, 34,
+	17, 7, -6, -29, -26, 34, 23, 24, -22, 10, -6, -4, 2, -25, 9, -13,
+	-26, -19, -28, 18, -4, 10, -10, -23, 6, 17, 10, 21, -10, 43, 5, -46,
+	-23, -3, 36, -37, 21, 19, -43, -14, 5, -7, -37, 20, -47, 37, 34, 0,
+	-21, 21, -18, -5, 24, -26, 12, -22, 11, 5, -8, 14, -4, -25, -42, 20,
+	-11, 8, -19, -21, -27, -14, -8, -40, -67, 11, -10, -14, 11, -26, 11, -9,
+	9, -1, 10, -12, -6, -38, -17, -23, 18, 46, -16, 8, -6, -11, -9, -4,
+	17, 17, 10, -3, -28, 6, 11, -19, 13, 25, 10, 18, 32, 3, -32, 1,
+	5, 7, 26, -9, 48, -3, -54, 8, -73, -18, -4, 11, -1, 13, 22, 10,
+	22, 1, 23, -65, 5, 12, 7, 54, 3, 10, -24, -1, -7, 28, -17, 16,
+	-8, 33, -27, 20, 9, 11, 3, 30, 36, 9, 10, -19, 17, -23, -26, -13,
+	3, -28, 12, -18, -39, 34, -26, 19, 29, -1, 27, -21, -1, -4, 35, -20,
+	6, -90, -31, -16, -28, 38, 41, 0, -26, 3, 16, -7, 29, 14, -24, -10,
+	19, -16, -21, -33, 17, 15, -10, -13, -10, -9, 4, 18, -8, 11, -6, -3,
+	16, -45, -58, 13, -54, -1, -21, -8, 1, -24, 46, -1, 27, -27, 16, -100,
+	-52, 5, 28, 17, 19, 9, -25, -2, -15, -25, 24, -17, -21, -20, 27, 15,
+	-30, 8, 1, -22, -14, -5, 0, -23, -22, 16, 8, 10, 31, 10, 48, -28,
+	-53, 14, -73, 24, 13, 29, -5, -22, 34, 9, 19, 17, 4, -93, -13, 2,
+	-9, 29, 28, -2, -21, -3, 16, -3, 14, -4, 14, 22, -23, 10, 3, -4,
+	7, 12, -18, 4, 9, 28, -18, -10, -13, -19, -17, -13, -2, 13, -34, -15,
+	-3, 35, -7, -7, -41, 29, -15, 1, 23, 33, -4, -11, -8, -15, 30, 18,
+	16, 1, -25, 24, -2, -22, -15, -4, -31, -15, 25, -12, 12, 12, 19, -17,
+	18, -32, 13, 15, 2, -30, 3, -13, 27, 0, -6, 7, -33, 25, 24, -12,
+	5, 7, -27, -9, 26, -16, 15, -16, -3, -56, -30, 20, -18, 12, 4, -16,
+	-31, 6, -20, -11, -3, -11, 14, 6, -16, -22, 9, 22, -9, 28, 18, 33,
+	19, 10, 17, -13, -19, -23, -26, 20, 8, -7, -29, 45, 20, 1, 17, -14,
+	-17, 13, 2, 28, 17, -11, 13, -36, -18, 0, 1, -3, 1, 4, -28, -3,
+	26, -24, 8, 28, 30, -7, -21, -23, 10, 3, -8, 17, -3, -22, -14, 2,
+	-22, -2, 18, 24, -13, 11, 42, -13, -10, 21, 32, 14, 5, -30, -47, 14,
+	13, 3, 14, 26, 12, -43, -19, 14, 6, -3, -6, -8, -21, -12, 32, 22,
+	12, 22, -1, 2, -13, -25, 3, -27, 14, 33, -21, 4, 9, 27, 19, -10,
+	-1, 12, 25, 4, 48, -6, -52, 23, 20, 39, 3, 7, -5, 15, -5, 30,
+	19, -2, 37, -43, 1, 0, 0, -6, -25, -9, -44, -4, 14, -31, 16, -18,
+	-14, -24, -16, -28, 3, -16, -26, 7, 23, -30, 0, -18, -1, 24, 28, 13,
+	24, 9, 5, -32, -19, 85, 26, -19, -55, 4, -26, 18, 10, -35, 34, 13,
+	46, -18, -4, -3, 1, -4, -24, 11, -6, 1, 1, -28, 22, -8, 27, 14,
+	24, -24, -23, 22, -18, 29, -6, -11, 18, -1, -13, -13, 3, 28, 11, 33,
+	13, -38, -5, 32, 19, -40, -58, -27, 6, 5, 1, -41, 36, 24, 36, 19,
+	-23, 9, -13, -2, 11, -4, 44, 21, 15, -29, -14, -27, 19, 20, -14, 2,
+	18, 6, -32, 23, 22, -23, -7, 11, -11, 16, -17, -1, -9, -26, -4, -34,
+	3, 42, 4, -28, -36, 7, -26, -34, -17, -35, 6, 22, 63, 23, -28, 29,
+	-1, 20, 1, 14, -9, 23, 31, -1, -17, -2, -7, 24, -31, 6, 9, -14,
+	-1, 19, -5, -15, 4, -11, -20, 8, -7, -3, 12, 25, 23, -12, 15, 67,
+	-17, -44, -29, -8, -17, -30, -11, -7, 43, 38, 43, 9, -32, 8, -13, 45,
+	-37, 8, -22, 10, -21, 27, 26, -3, 14, 25, -11, -3, 2, 16, 17, 0,
+	-10, 16, -9, 28, 3, -27, -10, -27, -5, 1, -27, -42, -19, 11, 26, -10,
+	-66, -7, -8, -25, -9, -6, 32, -4, 61, 49, 11, -25, -5, -10, -39, 28,
+	-12, -11, -20, 4, 12, 13, 17, -30, -33, -4, 8, 34, 20, -18, -22, -23,
+	-14, -2, 19, 30, -17, -5, 5, -1, 30, -7, 3, -12, -19, -10, 29, 42,
+	-13, -14, 14, -9, 14, 41, 32, -22, 28, -40, 28, -51, 15, 12, -32, -5,
+	7, -6, -21, 21, -23, 4, -35, -27, -17, -3, 0, -25, -11, 34, 18, 12,
+	11, 26, -14, 18, -31, 8, 20, 28, -3, -5, 0, -14, 37, -20, -26, -20,
+	7, 27, -33, 29, 9, -5, -8, -62, 15, -50, 50, 15, 0, -21, -24, 12,
+	-5, 5, 12, 7, -38, 25, 15, -17, -32, 0, 19, 33, -33, 32, -18, 27,
+	14, 20, -7, -6, -5, 12, -5, -32, 27, 13, 1, 28, -14, -25, -6, 22,
+	-25, 17, 30, -31, 16, -60, 39, -13, 3, 6, 17, 3, -19, 13, -35, -6,
+	-3, 12, -38, -21, 9, 6, 1, 1, 23, -13, 23, 2, -21, 12, 23, -6,
+	24, 16, -13, -14, -32, -20, 21, 42, 13, -13, 10, 20, -11, 28, -1, 36,
+	-11, -17, 24, -34, 7, -66, 34, 21, -25, 46, 19, 16, -24, 5, 16, -27,
+	6, 10, -31, -15, 23, -18, 22, -21, -32, 32, 2, 35, -35, -10, -20, 37,
+	-15, 18, -18, 3, 23, 30, 30, 27, 25, 23, -17, 29, 29, -11, 48, -26,
+	-33, -58, 2, -6, 7, 28, -5, 24, -15, 9, 26, -19, -8, 24, -3, -27,
+	-9, -10, 1, -21, 9, 6, 11, 7, -20, 30, -38, 24, 4, 7, 5, -52,
+	-60, -34, -18, -6, -7, 17, 7, -25, 35, -42, -28, -36, 8, 34, 30, 19,
+	7, 36, -3, 6, -26, 29, -15, 30, 12, -7, 17, 23, 9, 30, -32, 23,
+	-23, -22, 34, -32, 8, -28, -19, 6, 14, -23, -17, 25, 21, -5, -21, 10,
+	-2, 25, -4, -19, -25, -27, 37, 29, -27, 4, -46, -2, 21, -37, -3, 36,
+	4, -20, -9, -15, -17, -3, -9, -8, 21, -19, -11, -31, 13, -28, -2, -2,
+	-29, 20, -7, 15, 3, 2, 24, -19, 1, 31, 35, -31, -16, -18, -22, 9,
+	-14, -10, -55, -23, -21, 17, -47, -23, 4, 10, 52, -25, -22, 14, 19, -7,
+	-13, 3, -28, -6, -1, 33, -1, 30, -20, 25, 25, -32, -31, -24, 18, -27,
+	39, -31, 14, -31, -5, 21, -23, -24, 30, -13, -31, -24, -14, 2, 16, 1,
+	-7, -24, 28, 19, -25, -29, 6, -1, 14, -42, -20, 10, 26, -14, -21, 10,
+	-20, 17, -18, 6, -3, -24, 4, 20, 16, 4, -7, 19, -14, -20, -7, -5,
+	-14, 3, 23, -8, -7, -5, 2, -15, -61, 37, 27, 31, 17, 4, -49, -5,
+	18, -2, -38, -31, -11, -31, -25, -54, 3, 22, 9, 25, -10, 5, 7, 1,
+	11, -30, 23, -18, -10, 13, -1, -19, -21, -19, -3, 1, -23, 0, -13, 33,
+	28, 7, 12, -16, 16, 24, 5, -2, -30, -56, 31, -24, 46, 53, 11, 7,
+	-30, -23, -6, 10, -3, -17, 27, -9, -25, -4, -40, -41, -9, 6, -6, -31,
+	20, 19, 7, 17, -27, 9, -3, 8, 21, -15, 3, 19, 17, -7, -1, 2,
+	18, -29, 9, -13, 10, 22, -12, -28, -9, -52, 20, 58, 0, 47, 29, 29,
+	-3, -15, -18, -3, -19, 13, -43, 29, 18, 18, -26, 18, 14, 19, -1, 24,
+	5, 0, -24, 0, 19, -30, 16, -25, -31, 21, -33, -22, 8, -6, 0, 6,
+	-17, -3, -7, 4, 43, 2, 3, -48, 17, 58, 12, 56, -14, -26, -3, -9,
+	30, 16, -13, -10, -13, 36, 20, 3, 10, -21, -3, -8, 16, -22, 11, 1,
+	-28, -23, 20, 6, 2, -1, -37, -32, -4, 4, 8, -12, -22, 21, 0, -3,
+	-38, 1, 4, -17, -61, -32, 12, 11, 13, -26, -7, -16, 28, -1, 9, 25,
+	20, 20, -39, 40, 60, 0, -30, 10, -31, 34, 9, -21, 21, 1, 14, -13,
+	8, 25, 19, -1, -5, 25, -21, -3, 16, 2, -11, 29, 20, 9, -26, 11,
+	20, 30, -74, -38, -23, 78, -17, -17, -27, -16, -8, -50, 8, -10, 26, -29,
+	-33, 4, -35, 13, 10, -27, 29, 33, -9, -3, -24, -32, 4, -25, 34, -1,
+	0, -25, 13, 32, -28, 8, -25, 4, -35, 22, -62, 25, 50, -10, -36, 22,
+	18, -47, -3, -14, -37, 29, 21, -14, -13, 21, -43, 33, -23, -11, -29, 9,
+	-25, -3, -20, -15, 24, -13, -18, 4, -25, 11, -27, 16, 18, 20, 11, -15,
+	-34, -35, 31, -27, -13, 9, 20, 1, -49, 20, 3, -36, 20, 4, -24, -17,
+	10, -8, -7, -17, 13, -5, 3, 6, 17, 45, -10, -51, -10, -38, -16, -8,
+	-15, -25, -13, -10, -15, -11, 2, -30, 1, 10, -16, -7, -6, 20, -12, 7,
+	15, 2, 14, -9, -25, 5, -55, 23, -5, -18, -1, 22, 9, -54, 7, -30,
+	16, 21, 7, -7, 6, 32, 24, 35, -55, -39, 8, -18, -4, 18, 14, -4,
+	-33, -15, 26, 9, 31, -30, 29, 20, -7, -24, -11, 27, 18, -19, 19, 7,
+	36, -23, 27, -25, -34, 7, 11, 7, 10, 8, -18, -47, -25, -20, 17, -1,
+	36, 20, -30, 10, -11, 59, -64, -2, 3, -25, -2, -52, 0, -30, 30, 6,
+	-14, -21, 22, 0, 36, -10, -7, -8, 29, -31, -10, -14, 30, -15, 15, 25,
+	-10, -8, -44, 3, 35, 7, -17, 1, -18, -33, 11, 15, -24, -6, 27, 26,
+	19, 40, 27, 41, -55, 11, -3, 10, -9, 11, 1, -21, -6, 29, 24, 27,
+	16, -9, -9, 14, -16, 0, 16, -9, -4, -29, -30, 28, -22, -34, 10, 25,
+	-45, 28, -14, -67, 1, 24, -46, -1, -29, 38, 33, -21, 3, -14, -18, 22,
+	12, 70, -42, -35, -1, 16, 10, 64, -7, 23, -25, -33, 22, 16, 31, -28,
+	14, 5, -17, -27, -23, -22, 30, -11, -15, -21, -27, -7, -4, -34, -33, -33,
+	26, -51, 53, 13, -14, -35, -31, 45, -8, -9, -15, -47, 19, 51, 13, 43,
+	-34, -38, 5, 3, 12, -25, -15, -24, 23, -8, -3, -22, -16, -25, 35, 21,
+	-14, 6, -11, -35, 0, -35, -1, 28, 36, 22, -27, 20, -15, 9, 11, -25,
+	6, 7, -13, -27, 5, -1, 28, -29, -3, -9, 22, 35, 17, 8, -16, -25,
+	6, 19, -26, 27, -23, 21, -17, -1, -1, -2, -26, 8, -1, 6, 4, 1,
+	9, -21, -15, 1, -3, -23, -22, 8, 11, 1, -42, 35, 23, -36, -7, 59,
+	-38, 26, -21, -17, 36, 18, -25, -8, -3, 32, 28, 29, -59, -63, 20, 6,
+	13, 7, 37, 20, -13, 15, 13, -27, 14, -3, 20, 16, 19, -34, 2, -12,
+	1, -16, -26, 27, 0, -1, -4, -27, -40, 2, 13, -64, 8, 27, 19, -40,
+	33, 1, -15, 29, -2, -2, 4, 25, 8, 47, -49, -42, 18, -17, 9, 29,
+	24, -25, 16, -24, -16, -10, 37, -3, -13, 28, -4, -30, 8, -20, -10, -28,
+	32, -37, 31, 3, -10, -9, 24, 29, 30, -17, 39, 45, -35, 32, -17, 40,
+	-5, -29, 10, 2, -3, -10, -20, -1, -17, 21, 3, 24, 26, -21, 5, -1,
+	22, -23, 1, -19, -26, -24, 9, 5, 20, 12, -13, -10, 16, -27, -9, -18,
+	-13, 29, 10, 33, 39, 26, -16, 11, -6, 62, 6, -1, 1, 0, -20, 11,
+	10, -24, -29, 13, 19, 9, -1, 27, 18, -9, 35, -33, -19, -24, 7, -16,
+	-5, 21, -8, -18, 21, 9, -26, -22, 6, -19, -28, 28, 23, 21, 28, -29,
+	21, 1, 12, -15, -6, 15, 15, 65, 7, 25, -18, -21, 22, -27, -8, -15,
+	41, 17, 3, 11, -14, -25, -43, 6, 28, -23, 29, 11, -25, 32, -4, -27,
+	-7, 9, -17, 29, 10, -18, 18, -14, -22, 13, 5, -6, -10, -3, -19, -10,
+	44, 18, -16, 1, -2, 14, -28, 3, -17, -4, 13, -32, 18, -16, -26, -16,
+	-8, -9, 20, -1, -15, 0, -10, 13, 16, 25, 22, -9, -31, -26, 5, -14,
+	8, 3, 31, 6, -19, 2, 4, -18, -15, 10, 0, 3, -10, 10, 50, -6,
+	-23, 7, 40, 48, -45, 18, -27, 38, -29, -12, -28, 23, -34, 6, 6, 13,
+	24, 14, 2, -13, 12, -18, -2, -19, 32, -20, -8, -8, -10, 3, 20, 30,
+	-1, 5, 2, 5, 33, 32, 28, -26, 3, -13, 12, 25, 70, -20, -13, 5,
+	45, 64, -47, 0, -31, 44, -3, 11, 7, 22, -24, -22, 22, 16, 11, -10,
+	-28, -5, 13, 1, -32, -27, -21, 26, -1, 1, -12, -22, -2, 2, 27, -22,
+	-18, -3, 17, -27, -19, 25, -18, 3, -23, -17, 65, 11, -8, 35, 14, 12,
+	-26, 23, 12, 7, -21, 8, 8, -19, -2, 29, -5, 2, 4, 29, -27, 1,
+	24, 24, 15, 29, 25, -19, -5, 11, 1, -18, 2, 25, -24, -13, -30, 22,
+	14, 18, -26, -13, -3, -3, 21, -18, 62, 24, 23, 19, 12, 37, 21, 31,
+	-10, 10, 2, -9, 40, 6, -8, 16, 19, 52, 36, -6, -36, 29, 32, -14,
+	-13, 5, -23, -13, -33, -5, -9, -21, 29, -12, 22, 26, 3, -28, 7, 32,
+	19, -30, -34, 20, -35, -26, 54, 14, -3, 8, -5, 33, -16, -1, 10, 19,
+	-31, 2, 14, -11, -51, -17, 12, -9, 24, 51, 13, 37, -3, 25, 20, 20,
+	25, -13, -5, -28, -6, 3, -27, 15, -12, -12, -5, -13, -3, -1, -5, 4,
+	2, -23, -34, -12, 17, 15, 9, 31, 21, 11, 1, 45, -19, -5, 12, 36,
+	28, 20, 9, -7, 7, 6, 53, 9, -49, 3, 30, -9, 19, 15, -30, -4,
+	6, -2, 20, 18, -22, 27, 5, 12, -30, -11, -3, -9, -30, -23, -2, -23,
+	-18, 28, 17, -16, 5, -9, -13, -45, 9, 26, 8, 15, -47, -6, 15, 4,
+	-7, -78, -76, 43, -8, -7, -11, -25, 39, 33, -5, -21, 9, 2, -29, 30,
+	16, 33, -9, -15, 9, -21, 2, 34, 16, 4, 24, -26, -3, -21, 20, -18,
+	-1, -4, 14, -39, 19, -38, 49, -42, 1, -10, -35, 19, 9, 19, -36, -30,
+	-5, 23, -26, 3, -17, -11, 24, 39, -21, 30, -12, 20, -22, -5, 13, -25,
+	-31, -7, 30, -7, -7, 15, -14, 9, 14, -15, 25, 1, -5, -14, 12, 16,
+	12, 4, -3, -77, 27, -54, -21, 42, -45, -16, 7, -1, -19, -35, 13, -11,
+	-39, 7, -56, -9, 42, 63, 16, -32, 24, -22, -32, -9, 17, -32, -2, 13,
+	4, 15, 4, 31, -11, -2, 33, 21, -35, -29, 2, -18, -2, 26, 24, -15,
+	49, -52, -2, -3, -13, -3, -45, -37, 0, 1, -17, -19, -65, 38, -38, 36,
+	-26, 7, 20, -6, -22, 7, -22, 8, -29, -30, 5, -5, -17, 15, -9, 2,
+	-9, -3, -15, 29, -13, 30, -2, 28, 18, 1, 36, 23, 4, 5, 40, -66,
+	56, -38, -45, -10, -50, 7, 26, 42, 6, -62, -28, 20, -6, 3, -41, -44,
+	55, -15, -28, -10, -27, -21, 24, -24, 27, -24, -18, 27, -34, -29, 16, -7,
+	-1, 3, 21, -26, 5, 18, 8, 23, 41, 27, 12, -30, 23, 2, 17, 27,
+	20, 16, 9, 13, -1, -17, -15, -83, -22, 16, 2, 9, 38, 15, 20, -12,
+	-30, 6, -16, -5, 9, 9, 15, 19, -18, 20, 15, -12, -19, -5, 34, -28,
+	-29, -32, 23, -25, 32, -3, 18, 5, 14, -47, -31, 9, -21, -12, 24, 4,
+	-11, 17, -4, 7, 38, -48, -14, -20, -3, 26, 36, -1, -7, 5, 23, 3,
+	33, 28, 32, 22, -15, -8, -31, 4, 14, -26, -27, -17, -10, 1, -25, 3,
+	-15, 9, -21, 5, 11, -15, 8, 7, -32, 54, 30, -8, 10, -8, -22, 10,
+	-9, 19, -9, -71, -10, -7, -16, -3, 10, 14, 35, -28, -9, 4, 13, -25,
+	28, -26, -11, -20, -1, 14, -6, -15, 9, -23, 19, -15, 4, 10, -22, 22,
+	-12, 16, 44, 6, -26, 11, 12, 47, -5, 23, -13, -29, 8, 37, 4, 26,
+	32, -50, -16, -10, -36, 12, 24, -4, -31, -41, 24, -20, 17, 16, 33, -27,
+	-6, -30, -28, 24, -1, -24, 1, 20, 24, 18, -14, -19, -4, -23, 33, -8,
+	38, 42, -17, -51, -17, 7, 7, 0, 10, -43, 19, 17, -42, -33, 10, -73,
+	11, 24, -17, -16, 37, 4, 26, 6, -7, 21, -7, 15, 29, -17, 5, -17,
+	-20, -23, 20, -22, -3, -21, 36, 9, 8, -33, -13, 9, 25, 6, 15, 6,
+	-24, 20, -33, -22, -8, -22, -18, 26, 82, 12, 29, -18, -18, -61, 22, -3,
+	-8, -1, 17, -24, 11, -7, -29, -9, 30, 3, -29, -24, 9, 4, -11, 25,
+	10, -8, -14, -17, 16, 20, -24, 20, 14, -28, -6, 32, 7, -20, -32, 16,
+	5, 2, 23, -9, -36, -16, 50, -19, 2, -3, -6, -30, -18, 14, 23, 24,
+	18, 23, -1, -27, 6, 15, 16, 19, 17, 6, -34, 8, 2, 21, 5, 29,
+	27, -16, 16, -7, 20, -17, -14, 1, -18, -23, -12, 31, -5, 36, -46, -27,
+	-12, 9, 1, -5, 52, -2, 71, 33, -24, -10, -30, 10, -10, -15, -45, -30,
+	34, -26, -2, -22, -17, -25, -24, 33, 6, 32, 6, 4, 0, -26, -25, 34,
+	1, -24, -9, 29, 15, 8, 15, 24, -3, -4, 6, 33, -36, -20, 7, -23,
+	34, -37, 33, -12, 21, 21, -2, -20, -41, 33, -24, 44, 20, -24, 32, 14,
+	17, 27, 13, 20, 27, -1, 2, -27, 17, 20, 27, -23, -14, 5, 28, -2,
+	-8, 23, -2, 28, -7, 24, -20, -6, -3, 1, -23, -12, 21, -19, 39, 7,
+	45, -10, 47, -4, 2, -10, -41, 1, 30, 46, 15, -53, 49, -26, 22, 12,
+	0, 23, -2, 27, -20, 17, 30, -12, 21, -31, 23, 15, -4, -7, 14, 3,
+	-17, -6, -2, -22, 7, 8, -25, 36, -20, -28, -59, 39, 4, 13, 37, 23,
+	-31, 18, -46, -20, -25, -26, 39, -28, 13, 32, -13, 7, 30, -13, 21, 7,
+	27, -22, 14, 4, -17, -16, 25, -19, 11, -7, 8, 10, 17, 12, 13, -21,
+	18, -10, 31, -7, 4, -28, -53, 20, -13, 22, 17, 46, 19, 26, -17, -22,
+	-16, -22, 4, -79, 15, 31, 30, 18, 2, 24, 31, 13, 33, -8, 12, 26,
+	-23, 33, -27, 14, -22, 9, -27, 32, -4, 27, 0, -9, -34, 26, 2, 26,
+	15, 13, 5, 4, 1, 9, -5, 11, -27, 8, 17, 15, -17, 3, 7, 28,
+	-18, -57, 29, 44, -28, 13, -21, 21, 25, -22, -11, -25, -28, -16, -28, -11,
+	-7, -20, 3, 27, -9, 25, -22, -11, -6, 19, -9, 26, 24, -26, -24, -13,
+	-31, 2, -45, 20, -53, 46, 21, 8, 14, -31, 15, -1, 17, 21, -11, -39,
+	22, 28, -3, 34, 21, 23, -8, 5, -20, 23, -4, -8, 14, 10, -13, 26,
+	-32, 5, -17, 23, -23, -17, 22, 21, -9, 14, -21, -29, 29, 33, -3, 15,
+	-20, -27, -72, 2, -26, 5, 6, -5, 0, -2, -5, -23, 13, -15, -13, 36,
+	-42, 26, -4, 4, 1, 0, -21, 10, -18, 29, 18, -11, 10, -32, 15, 3,
+	28, 5, -26, 12, -14, 23, -25, -6, 0, -32, -14, -29, -28, -16, -2, 25,
+	-1, -24, 27, -19, 28, -11, 3, -28, 9, 22, 24, 27, -3, 19, 22, -9,
+	-2, -35, -32, -28, -10, 32, -10, -14, 22, 22, 11, -15, -12, 28, -4, 25,
+	18, -29, -31, 15, -5, -23, 28, 14, 17, 11, -7, -36, 10, 28, 0, -12,
+	-4, -15, 4, -47, 13, -19, 13, 41, 1, 27, 6, -3, 15, -33, 21, -25,
+	-33, 12, -5, 13, 0, -27, 22, -24, -3, 18, -18, 5, 26, -32, 8, -9,
+	2, 4, -16, 11, 26, -10, -20, 26, 19, 5, -1, -4, 1, -24, 15, 16,
+	5, -6, -7, 27, 12, 39, -28, -18, -25, -5, 21, -6, 13, -7, -4, -7,
+	4, -14, 5, 25, -28, -21, -3, 17, -29, 27, -31, -9, 16, -33, -24, -12,
+	2, 32, -15, -22, -25, -10, -16, -55, 16, 19, -15, 34, 22, 9, -7, -40,
+	-9, -4, 7, 1, -35, -24, -15, -36, 46, -1, -10, -3, -7, -1, 26, -33,
+	-18, -29, -14, 11, 20, 26, 29, 30, 4, -17, 2, 7, -19, 12, 18, -31,
+	19, 24, -25, -34, -22, -37, 12, 47, 6, -30, 14, 42, -7, 11, -18, 16,
+	30, 0, 11, 38, -43, -37, 11, -2, 35, 15, -8, 0, -18, -25, 13, -4,
+	27, -9, -7, 15, 0, -17, 25, -4, 30, 27, -17, -5, -10, -11, -10, -12,
+	-44, 17, -23, 37, -19, -6, 19, 21, 7, -20, 28, -12, -18, 24, 47, 45,
+	-2, 38, -20, 37, -13, -9, 5, -39, 1, -2, -17, 5, 4, 31, 11, -22,
+	-7, -30, -13, 14, -11, 26, -7, 27, -13, 2, -12, 16, 27, -22, 13, -1,
+	-26, -18, 0, 5, 16, 15, -43, -48, 6, 26, 12, -30, 11, 38, -25, 41,
+	-42, 21, -17, 4, 5, -9, -27, -32, -9, 8, -28, -18, -25, 2, -17, -23,
+	-11, 2, -5, 28, -44, 5, -24, 15, -37, -6, -17, -12, -10, -7, -19, -19,
+	10, 22, -8, -42, -13, 10, 26, -5, -24, 26, 17, 8, -7, 1, 10, 31,
+	-30, 7, 28, -26, -30, 30, 18, 25, -17, -20, -22, -17, -19, 32, -17, 16,
+	-13, 12, -8, -7, 16, -11, 7, 22, -34, 13, 0, -12, -2, 33, 4, 5,
+	-6, 15, -42, -22, 10, 7, -23, -30, 31, 16, -9, 6, -15, 22, -78, 5,
+	53, -2, -9, 9, 6, -21, -24, -19, 1, -23, 30, 10, -13, 24, -38, -2,
+	-10, 13, -15, -12, -24, 31, 3, -28, 12, 8, 19, 42, 38, 33, 31, 25,
+	-23, 1, 16, 6, 4, -29, 26, 31, -4, -16, 14, -3, -24, 1, 0, -28,
+	-25, -18, 21, 19, 32, 1, 24, 25, 10, 32, 8, 23, 22, -11, -30, -14,
+	-3, -16, -14, 4, -2, 0, 23, 9, 43, 0, 0, 64, 11, 14, 17, -7,
+	51, 0, -17, 13, -13, 9, -42, -28, -45, -11, 9, 9, 0, 20, -8, -35,
+	4, 27, -2, 7, 16, 23, -13, 17, -10, 13, -13, -15, -13, -29, -21, -34,
+	27, 1, -29, -25, -10, 3, -9, -7, -27, 34, -6, 34, 3, -2, 25, -6,
+	11, -47, -46, 24, -36, 5, -45, -30, -8, 5, 7, 16, -8, 16, 2, -28,
+	19, 5, 24, -30, 28, -11, 19, -18, -23, -5, 11, -19, -1, 23, 20, -7,
+	-14, 4, 16, 10, 26, 12, 23, 34, -12, -10, -11, 0, -9, 40, -11, -46,
+	-34, -25, -59, 1, -19, -27, 43, -13, 5, -14, -27, 17, 29, 16, 21, 24,
+	-9, 5, -20, 20, -22, 11, -20, 10, -22, 4, 32, -31, -11, 20, 18, 19,
+	-40, 4, -18, -3, 9, 47, -30, -9, 22, -4, 12, 19, 13, -11, -26, -31,
+	-78, -21, -29, -16, 53, -5, 35, 25, -17, 26, -2, 14, 26, 0, 22, 16,
+	23, 9, -4, -10, 25, -25, 11, 14, -1, 18, -25, 16, -27, -3, -39, -5,
+	5, -38, -1, 43, -18, -34, 9, -12, 27, -2, -14, -38, 4, 8, -58, -13,
+	-51, 23, 34, -32, -27, 30, 36, 15, -30, -30, -11, 9, -14, -37, 11, -14,
+	14, -34, 2, -20, 28, 1, 2, -15, 15, 7, 4, -18, -11, -5, 47, 14,
+	-10, 16, 9, -8, 1, -5, 5, -17, 3, -9, 26, 42, -26, 42, -50, -3,
+	11, -27, -15, 13, -9, 27, -20, -24, -14, -28, -8, 5, -18, 14, -5, -29,
+	11, -3, 9, 8, -30, 14, -6, -1, 17, -20, -23, 33, 6, -13, -9, -18,
+	-5, -48, -12, -2, -12, -47, 10, 22, -15, 33, -27, -22, -33, 2, 15, -34,
+	22, -41, -10, 14, -25, 13, 26, 24, 3, -15, 11, 4, 26, 11, -2, 17,
+	0, -18, -14, -16, -20, 23, 2, 5, 4, 2, -3, -2, 7, -9, 7, -29,
+	3, 32, -8, 22, -15, 34, -15, 3, -13, -6, -27, 30, 2, -19, 3, -21,
+	6, 7, -6, 30, 22, 14, 14, 0, 16, -26, 15, -2, 0, -22, -11, -10,
+	35, -16, -23, -25, -6, 16, -29, 3, 16, 12, 11, -52, -27, -23, -26, 24,
+	11, 13, 32, -28, 32, 46, -16, -11, -30, 1, -6, -48, 6, 8, -26, -32,
+	29, -11, 33, -12, 34, -10, 25, -7, -11, -21, -5, -27, 29, 7, -12, -18,
+	10, 7, -12, 16, 4, 13, 4, 5, -24, -12, 9, -40, 5, -21, 22, -6,
+	-3, 7, -12, -6, 18, 41, 10, 20, 16, 20, 16, -41, -29, -22, 8, -15,
+	-28, -3, -18, -20, -26, 1, 11, -9, 24, 7, -27, -30, 3, -18, -19, -14,
+	35, -10, -5, 25, 17, -31, 1, -13, 31, -9, 44, -19, 13, 11, 33, 22,
+	33, -40, 29, -40, 3, -20, 38, -15, 9, -27, -22, -3, -4, -1, -27, 32,
+	2, 7, 13, -33, -22, 2, -4, 6, 6, 23, -19, -1, 6, -9, -12, 20,
+	-7, 9, 40, -26, -14, 25, 5, 8, -17, -37, 38, -14, -30, 17, 34, -22,
+	20, -28, 23, 5, 25, 31, 16, -17, 31, -32, -31, -8, 4, -6, 6, 28,
+	-23, -34, -30, 23, 19, -10, -21, 29, 27, 9, 10, -27, 29, 19, 0, 38,
+	13, -30, 24, 18, 16, 21, 14, -27, -7, 1, 6, -2, 18, -9, 20, -6,
+	-34, -4, 42, 11, 26, -18, 2, -9, -16, 10, -8, -26, -3, -33, 3, 20,
+	-2, 19, -22, 16, -20, 10, 30, 10, -3, 29, -10, -20, 34, 14, 30, -15,
+	22, 28, -4, 20, -9, -9, 0, 13, 12, 31, 11, -30, 3, -29, 25, -27,
+	42, 19, -15, -2, -7, -6, 17, -6, -8, 26, 30, -5, -14, 27, 7, 13,
+	-4, 21, 19, 5, 27, 13, -28, 15, -27, -19, 15, -20, -23, 0, -20, -19,
+	17, 35, 15, 6, 40, 13, -48, 15, -5, 6, -36, -47, -30, -7, 1, 15,
+	30, 6, -14, 31, 24, -27, -14, 11, 33, 0, -14, -16, 9, 27, -33, 15,
+	28, 30, 32, -9, 3, -29, 24, 32, -16, 17, 15, -4, -32, -15, 27, -12,
+	-36, 53, 12, -14, -49, -25, -35, 3, -45, -35, -56, 21, 37, -10, 9, 13,
+	22, -26, 24, 21, 28, 30, -5, -24, 19, -19, -25, -15, -4, -33, -7, -13,
+	-12, 26, -9, 21, -10, -15, 18, 14, 12, -4, 4, -15, -4, -52, -13, 12,
+	-24, -15, 18, -7, 39, 42, -36, -24, -36, -21, 17, -7, -10, 20, -3, -13,
+	-33, 29, -24, 22, -2, 4, -1, -8, 20, 29, 19, -15, 25, -27, 24, 31,
+	-13, -9, 19, 7, 29, 16, 10, -1, 20, -30, 17, -2, -49, 5, -8, -45,
+	-37, 4, -15, 27, -33, 24, -17, 7, 18, 27, 25, 48, 2, -11, -22, -31,
+	-9, 4, -14, -19, 30, -30, -26, -22, -7, -15, 4, 25, -22, -9, 31, -32,
+	-10, 19, -20, -6, 6, 9, -33, 28, -3, -22, -2, 41, -30, -47, -25, -15,
+	-39, 36, 0, 31, -14, -5, -5, 0, 2, 42, 3, 29, 19, 11, 14, -29,
+	28, 28, -28, 25, 28, -4, -26, -2, 2, -23, 0, 8, -32, -8, 28, 4,
+	-23, -29, -28, -8, 0, -19, 9, -25, -5, 52, -22, 16, 13, 17, -16, 13,
+	-3, 42, 4, -12, 15, 1, -14, 15, -23, -16, 9, -26, 0, 4, -23, 13,
+	11, -18, 3, -1, -6, 27, -19, 1, 7, 15, -11, 19, 10, -12, 35, -8,
+	-18, 2, 24, 27, 9, 36, 30, -19, -7, 23, 27, 25, 24, -8, -46, -24,
+	-18, -23, 34, 37, -1, -28, -7, -10, -29, -15, 30, 19, 6, -32, -8, 17,
+	-4, 17, 11, 20, -3, -12, 6, 7, -2, 20, 13, -24, -21, -23, -9, 42,
+	33, 47, 21, -15, -4, -33, 19, 27, -8, 27, -7, 0, -34, 26, 14, 12,
+	15, 5, -1, -23, -28, -9, 10, 2, 12, -10, 18, 5, -26, -27, 28, 0,
+	14, 4, -13, -24, 8, -32, 31, 5, 6, 29, -22, -42, -4, 21, -11, -4,
+	29, 16, 33, -47, 20, 57, 16, 18, -4, -44, -17, -9, 8, 35, 12, -2,
+	3, -5, -27, -32, 13, -9, 25, -27, -11, -20, 31, 29, 11, -7, -6, -9,
+	35, -34, -6, 9, -8, 30, 9, -29, -13, -33, -9, 20, 13, 60, -8, 4,
+	2, -45, 30, 39, 2, 23, 5, -28, -28, 3, -9, 10, 21, -15, 2, -41,
+	-14, 27, -25, 12, 12, -33, 35, -22, -1, -25, -12, -23, -1, 28, -15, -9,
+	14, -11, 10, 17, 4, 28, 4, -2, -41, 5, -14, 54, -24, 13, 5, -49,
+	6, -12, 4, 28, -25, -24, -26, 20, -19, -18, -26, -11, -1, -41, 11, 31,
+	30, 0, -29, 26, 28, 22, -11, -31, -24, -22, 26, -8, 12, -13, -7, 27,
+	33, -2, -23, -24, 27, -20, -58, -39, 15, -52, 32, -33, 9, -8, 50, 3,
+	-21, 6, -38, -18, -13, -14, -44, -2, -10, -39, 71, 44, -30, 1, 29, 27,
+	2, -10, 29, 15, 9, -12, -5, 19, -34, -20, 3, 22, -5, 28, -36, 20,
+	8, 6, 24, -11, 21, -13, 34, -50, -19, -25, -28, 29, 27, 5, -28, 20,
+	38, 48, -4, 14, -14, -6, -28, -14, 34, 17, 25, -2, 8, -2, 24, 5,
+	18, -17, 7, -26, -31, -11, -33, -5, 3, 6, 24, -21, -9, -24, -19, 8,
+	-9, 0, -1, -41, 39, -52, -26, -26, -14, -6, -7, -18, -33, 2, -23, 0,
+	-59, -5, 7, -39, -56, -4, 15, -18, 3, 17, 15, -31, -24, -23, -19, 8,
+	24, -10, -22, -24, 6, 31, -13, 0, -15, -27, 9, -5, -21, 28, 9, -11,
+	13, -37, 50, -38, 18, -75, -2, 21, -2, 30, -32, 29, -1, 10, -36, 0,
+	-14, 3, -28, -8, 23, -11, 18, 23, -24, 1, 15, 30, -27, -8, 29, -21,
+	-15, -21, 14, -15, 9, 6, 31, -20, 20, 13, -9, -19, -29, -36, 8, 24,
+	53, -50, -50, -50, -44, 13, 5, -9, 34, -26, 22, 54, -21, -27, 7, -39,
+	-22, -27, 11, 33, -30, 17, -8, 26, 6, -9, -13, -9, 17, 33, -10, 32,
+	8, 16, 7, 18, -18, 22, 21, -25, 27, 2, 26, -23, 7, 11, 37, 74,
+	-39, 22, 19, 13, -7, -33, -48, -12, -34, 21, -10, 35, 13, -3, -23, 38,
+	39, -31, -33, 5, -21, 17, 6, 22, -5, -21, -28, 19, 2, -18, -20, 15,
+	24, -23, 23, 26, 28, 13, 29, 11, 40, -23, -39, 8, 24, 40, 5, 35,
+	23, 3, 15, -60, 8, 31, -42, 48, 13, 1, 11, -8, -10, 25, -25, 30,
+	2, 25, -9, 19, -33, -25, -9, 23, 13, 5, 26, -19, -33, -27, 27, -22,
+	-37, 5, 18, 13, 9, -9, -17, -26, -24, 15, -19, 53, 1, -12, 15, 24,
+	26, 0, 36, 0, 16, 36, -19, -16, -10, 0, -19, 3, -1, 35, -2, 12,
+	-18, 25, -31, 22, 19, 34, -5, 27, -27, -22, -20, 15, -29, -5, -19, 35,
+	20, -4, -14, -29, 22, 10, -7, 14, 5, 71, 14, -22, 0, 18, 38, -48,
+	-40, -9, -51, -14, 30, -18, 28, 34, -23, -15, -15, 11, -11, -25, 21, 28,
+	10, 24, 26, -15, 7, -11, 17, 18, -21, 19, -22, 13, 29, -23, 17, 13,
+	6, -24, 36, 2, 1, 16, 30, 35, 13, 19, 3, -16, 19, -53, -33, -28,
+	-32, -23, -9, 1, 35, 3, 5, 3, 47, 0, 19, -7, 0, 6, 7, -7,
+	4, -21, -6, -29, -12, -11, -14, -17, 20, 13, -6, 31, -3, 19, -11, -8,
+	14, 16, -48, 56, 14, -52, 15, -18, -35, -26, 34, -26, 34, -7, -25, -64,
+	9, -8, -34, -11, 37, 16, -14, 47, -17, 15, -24, 25, -18, -7, 18, -26,
+	-23, 1, 12, -27, -18, 26, 37, 30, 13, -4, -27, 11, 26, -25, -9, -3,
+	-31, 71, 15, -38, -15, -38, -6, -12, -7, -26, 4, -40, 8, -70, -42, -43,
+	-11, 33, 35, -17, -11, -26, -4, 18, -10, 12, -3, -3, -11, -30, -4, 21,
+	-39, -25, 8, -12, 0, -33, 4, -29, 23, -22, -15, 8, 24, -7, -23, 42,
+	20, -64, 41, -14, 11, 15, 5, -43, 30, 24, -19, -42, 19, -32, 42, -13,
+	10, 10, -38, 3, -19, -12, -27, 8, 11, -20, 0, -23, 27, -32, 14, -13,
+	-14, -15, 32, -14, 6, 1, 21, -21, 3, -3, 32, -41, -34, 36, 6, -62,
+	12, -59, -49, -13, 22, 7, 3, 5, -8, -77, -21, -22, 49, 22, 19, -1,
+	0, 31, -12, -32, 29, -32, 18, -23, -12, 14, 20, 3, -29, -14, 28, -14,
+	-28, 5, -9, -1, -20, 1, -9, 6, 11, -9, -6, 21, -21, -10, 7, -23,
+	-6, 20, 29, -24, -29, 16, -5, -122, -34, -26, -27, 4, 47, 1, -24, -17,
+	-32, -31, 32, 19, -3, -21, 9, 6, 29, 10, -4, 14, 16, -30, 34, 26,
+	-20, -32, 26, 6, 24, -21, 48, 10, 33, 22, 52, -6, -45, 2, 33, -6,
+	-22, 41, -16, 9, -36, 10, -25, 5, -4, 17, 52, -9, 34, -8, -2, 33,
+	-23, -24, 21, -17, 13, 23, -29, 14, 31, -20, 12, 18, -25, -32, 2, 16,
+	17, 27, 2, 13, -8, -12, -20, 20, 64, 41, -23, -17, 5, 44, -14, 46,
+	14, 7, -3, 12, 8, -13, -2, -26, 40, -4, -10, -21, -33, 35, 2, 22,
+	-33, 17, -22, 2, 10, 30, 6, -26, 19, 13, -29, -1, -4, -7, -2, -6,
+	-6, 3, 46, 4, -14, 3, 40, 37, -16, -9, 44, -7, -55, 21, -8, 16,
+	22, 39, -38, -9, -2, 15, -31, -4, 46, 19, -35, -12, 11, 21, -3, -22,
+	-29, 13, -29, 18, -13, -6, -25, 19, 7, 22, 9, 30, -9, -29, -13, -6,
+	30, -34, 8, 39, 31, 5, -33, 27, 1, -21, -6, 63, -8, 6, -6, 37,
+	-44, -3, -35, -19, 40, 4, 26, -20, -17, -22, -18, 13, 13, 1, 0, 34,
+	3, 27, 1, -7, 2, 1, -7, 26, 9, 11, -25, -24, -11, 31, 38, -35,
+	-24, 36, 63, 47, -23, 5, 39, 35, -58, 70, 5, 10, 15, 52, -23, -28,
+	-15, -13, 53, -13, 48, -40, 17, -10, -23, -19, -11, 1, -20, 1, 20, -13,
+	-18, -11, -2, -3, 11, 19, -27, -19, 1, -6, -31, 32, -7, -47, -9, -13,
+	12, 38, -4, 14, 41, 38, -18, 20, 10, 18, 21, -31, -1, -37, 35, -17,
+	20, 2, 26, 37, -11, 20, 13, -10, -8, 11, -31, 32, 15, -3, 10, -12,
+	14, 7, -23, 8, 28, 13, -31, -14, 6, 26, 31, -3, -36, -18, 26, 1,
+	52, 8, 9, 10, 4, 61, -21, 8, 23, 7, 40, -39, 17, 23, 46, 14,
+	-25, 2, 33, -11, 24, 28, 25, 4, -19, -12, 16, 10, 22, -22, 21, 1,
+	25, -5, -33, -22, 23, 28, -1, 14, -10, -47, -29, -8, 29, 16, 16, -14,
+	49, -14, -14, 52, -11, -15, 39, 15, 11, -30, -16, -24, 42, 18, -10, -19,
+	28, 25, 10, 3, -13, -5, -23, 6, 25, -11, 13, 1, -31, 15, 15, -17,
+	-7, 4, -13, 0, -3, 32, -11, -45, -14, -30, -12, 33, -2, -18, 14, 17,
+	-18, 15, 9, 1, 38, -23, 9, -2, -26, 2, 41, 2, 24, 14, -7, -10,
+	-21, -22, -1, 22, -7, 17, 0, -7, 5, -32, 13, 10, 12, -4, -32, 19,
+	2, -17, -21, 22, 24, -61, -42, -4, 37, 10, -18, -8, 26, 16, -17, 50,
+	-29, 14, 21, 26, 14, -45, 33, -34, 17, -15, 18, 28, -10, 31, 18, 13,
+	18, -30, -29, -4, -1, -16, 22, 22, -20, -17, 12, 2, 1, -25, -18, -22,
+	-12, -23, -12, 30, -14, -38, -38, 29, -32, 38, -1, 21, -30, -45, 12, 27,
+	21, 31, 26, 7, 1, 18, -47, 17, 7, 26, 6, 8, -16, 33, 27, 32,
+	-15, 28, -9, 3, 17, -16, -21, -28, 20, -22, -12, -7, -13, 3, -13, -19,
+	6, 16, -14, -62, 20, 16, -6, 30, 12, 22, -8, -20, 26, 36, -6, -5,
+	8, -9, 39, -8, -34, 29, 5, 28, 25, -18, 23, -20, -35, 24, 21, 2,
+	3, -29, -29, -3, -15, -19, -29, -31, 24, 17, -2, 8, 2, -12, 11, -4,
+	7, -14, 1, 24, -16, 20, 12, -20, -2, 12, 6, 9, -13, -20, 17, 38,
+	26, -19, 5, 45, 13, 30, 25, -19, 12, 21, -19, 29, 9, 30, 12, 11,
+	-23, 33, 17, 3, 24, -18, -15, 20, -24, 28, 13, -28, 3, 46, 27, -53,
+	-38, -25, -25, 9, 18, 21, -10, 18, -27, 23, -17, -19, -23, 46, 22, -39,
+	-15, 11, 41, -2, 17, -4, -23, 15, 21, 21, -32, -12, -25, -27, 28, 19,
+	-29, -24, 16, 7, 10, -11, -15, -15, 8, 0, 40, 44, 19, -17, 6, 36,
+	27, 33, -1, -2, -21, 18, -52, -23, -5, -37, -33, 4, 19, -4, 37, 30,
+	3, 29, -33, -6, -11, -4, -36, 19, -1, 8, 10, -2, -28, -25, 21, 12,
+	-4, -27, -18, -11, -22, 26, -30, -2, -23, -4, 10, -27, -21, -12, 33, 22,
+	-4, 49, -39, 63, -18, -6, 32, -15, -30, 6, -42, 33, 11, 4, -9, 27,
+	0, -31, -8, 10, 18, 26, -26, 9, 26, -15, -29, 0, -3, -23, 18, -17,
+	7, 18, -19, 23, 4, 7, 22, 24, -33, -34, -18, -9, -24, 29, 20, 21,
+	-51, 53, -35, -33, 15, 1, -35, 0, -17, -16, -12, -28, 6, 9, -17, -27,
+	2, -27, 7, -23, 21, -24, -15, 8, 5, -19, 24, -24, -29, -8, -22, -8,
+	-31, -33, -24, 9, -3, 18, 1, 6, 28, 26, 5, 28, 13, 25, -30, 41,
+	-48, -12, 18, 40, 6, 8, 19, 2, -36, -15, 13, 20, -31, 15, 8, -10,
+	-29, 21, 8, -31, -26, 30, -8, 9, -3, -9, 8, 8, 19, 7, 29, -4,
+	8, 7, 25, -20, 1, -64, 0, -6, -17, -24, 4, -2, -58, 47, -22, 10,
+	25, 50, 26, -16, 8, 6, 21, -21, 21, 28, 5, 15, 21, 20, -24, -18,
+	17, -31, 17, -28, -13, -29, 13, -29, -1, -32, 24, 8, 28, 9, 0, -26,
+	29, 7, -14, -29, 27, 14, 28, 32, 19, 25, -54, -1, -22, 24, -5, 39,
+	-26, -7, -34, 2, 1, -13, 4, -28, 27, 15, -33, 7, 29, 9, 4, 25,
+	9, -9, -10, 9, 9, 11, -19, 21, -3, -3, 3, -12, 12, -12, 19, 24,
+	-3, -24, 27, 13, -42, 36, -33, 13, 47, 14, 26, 4, -32, 30, -31, 47,
+	-32, 14, -67, 26, -43, 2, -1, 17, 20, -21, 6, 32, -5, -13, 26, -13,
+	17, 14, -1, -1, 12, 11, 9, 16, -12, 16, 28, -20, 24, 31, 34, -23,
+	19, 8, -47, -14, -2, 39, 37, 27, 22, -16, 11, -11, 7, 32, -44, -20,
+	-20, 13, -9, -36, 15, -9, 5, 20, 11, 1, -6, -18, 4, -11, 19, -3,
+	-16, 6, -25, 8, 12, -7, 22, 1, 27, 19, -22, 22, -12, -38, -5, -11,
+	-25, 37, -4, -12, 23, 23, -10, -55, 18, -8, 4, 30, 21, -41, -3, -15,
+	-22, -13, 9, 12, 10, -10, 9, 23, 0, 2, 23, 32, -15, 34, 2, -20,
+	17, -11, -15, 26, -36, -5, 22, -15, 5, -7, 27, -38, -31, -36, -8, -2,
+	8, 8, 51, 39, 34, 18, -13, 33, 38, 19, -10, -20, 41, 20, -17, -14,
+	19, -7, -12, 4, 30, 17, 7, 15, -32, -4, 33, 9, -5, -26, 22, 11,
+	-34, -26, 1, 9, -30, -22, 15, -20, 29, -65, 18, 17, -1, -11, 18, -27,
+	40, 40, 15, -28, -44, 57, 16, 10, 2, 3, -15, 33, -21, 14, -27, -25,
+	-10, -11, 26, -15, 2, -27, 15, 5, 30, 0, -32, -8, 18, 29, 32, 4,
+	-15, 5, 22, -8, 1, 5, -3, 3, -2, -36, -46, -38, 6, 1, 9, -42,
+	12, -4, 20, 16, -3, 3, -2, -10, -10, 32, 31, -28, -21, -24, 30, -8,
+	-17, -3, -6, -7, 20, 3, -36, -8, 25, 1, -8, 5, 13, 29, -4, -10,
+	17, -1, -16, 14, -26, 6, -25, -32, -17, -21, -40, -5, -18, -19, 22, 10,
+	31, -2, -12, -9, 23, -37, -39, 24, 13, 12, 4, 9, -20, -14, -15, 2,
+	-17, 14, -18, -32, 18, 19, -20, -10, -13, -18, 25, 0, 20, 26, -30, -11,
+	-42, 3, 0, 47, -45, 5, -16, 8, 7, -15, 24, -9, -1, 15, 12, 27,
+	4, -29, 11, -35, 21, 13, -2, 11, -19, -11, -19, -9, -15, -21, 5, -11,
+	-13, 16, -19, 24, -23, -21, 18, 9, 14, -21, 18, 17, -25, -7, -13, -36,
+	13, 55, -5, -4, 6, 11, 21, -30, 1, -32, 20, 19, 36, 51, -34, 14,
+	-22, 7, -4, 19, -26, 33, -21, -2, 24, 9, -31, -23, -16, 1, -32, -8,
+	2, -9, 24, 9, -18, -20, -5, 31, -5, -17, -2, -6, 2, 17, 5, 47,
+	-14, 9, -38, 3, 3, 26, 21, 21, -1, -21, 49, 25, -46, 10, -18, -3,
+	16, 12, -32, -30, 13, 18, 29, -26, 18, -6, -1, 2, -23, 12, 17, 7,
+	-13, -19, -23, -10, 2, -27, 24, -5, -4, 0, 22, -47, -44, 54, -8, -52,
+	17, -9, -39, 3, 9, -27, 13, 3, -2, -14, -1, -35, -16, 30, -33, 16,
+	41, 1, 24, 21, -17, -14, -31, -11, -10, -18, 27, -22, 13, 31, -17, -16,
+	40, 8, -2, 38, 12, 19, 20, -12, 2, -5, -46, 58, -31, -52, -13, -17,
+	-35, -1, -24, -20, -16, 11, 26, -25, -21, -27, -9, 35, -7, -19, 14, -3,
+	9, 20, -30, 38, 4, 14, -31, -23, -32, 15, -18, 18, -24, -14, -2, 32,
+	-35, 14, -12, -22, 14, -11, -20, -20, 2, 35, -43, -40, -21, 9, 16, -21,
+	-27, 4, 1, 39, -9, -3, -28, -3, -7, 36, 9, -33, 25, 32, 0, 33,
+	-30, 7, 1, -7, 14, -16, 21, -24, 22, 31, 27, 26, -7, 5, -26, 18,
+	-16, -6, -21, -1, 33, -31, 9, 64, -35, -63, 17, 12, -28, -21, -22, 12,
+	12, -6, 23, -42, -9, 1, -3, 25, 5, -10, 21, -18, -25, -17, 28, 36,
+	-21, 2, -33, 1, 12, 21, -23, -1, -10, 10, -5, 38, 20, 8, 5, -2,
+	-30, 11, 19, -30, -13, 49, -21, -18, 7, -14, -36, -5, -33, 12, -42, 24,
+	-8, -23, -35, 16, 5, 11, 0, -7, -2, 6, 21, 9, -24, 36, 26, 31,
+	15, 10, -9, -14, 18, -24, 27, -11, 36, 8, -1, -22, -5, -13, 20, 6,
+	10, -24, -43, 2, 14, 38, 20, -42, -14, 35, 31, -41, -54, 29, 3, 4,
+	10, 24, 20, 17, 4, -20, -7, 13, -2, 30, 12, 10, -2, 26, 28, -5,
+	-7, 26, -22, -18, 7, -4, 18, 6, -36, -2, -10, 18, 18, -2, -19, -15,
+	-34, 0, -1, -6, 21, -54, -35, -2, 21, -18, -27, -19, -21, 45, 57, -6,
+	-10, -14, 15, -15, 43, 19, 19, -14, 26, -17, 25, 6, 21, 12, -14, -16,
+	-3, 3, -20, 20, -19, 7, -33, 33, 22, 10, 31, 30, -11, 13, -42, 3,
+	-13, 58, -20, -9, -10, 42, -19, -26, -29, 0, -17, -12, -5, -4, -19, 20,
+	8, -26, -5, 1, 14, 33, -3, -32, -16, 27, 9, -28, -14, -19, -20, 8,
+	-1, 17, -24, 19, 17, -19, 15, 11, 15, 0, -1, -34, -64, 2, 15, 40,
+	0, -17, 0, -4, -17, -49, 26, 32, -30, 1, 16, -6, -20, -32, 25, 5,
+	63, 27, -32, 33, -27, 5, 8, -1, -29, -11, 16, -21, -32, -18, 0, -10,
+	-6, -4, -31, 5, 17, -9, -22, -3, -15, 7, -33, -15, 39, 55, 30, -18,
+	18, 6, -37, -5, 25, 16, 23, -25, -9, -31, -5, -14, -32, -21, -14, -28,
+	-14, -26, 15, 6, 15, 0, -33, 15, -19, 2, -38, 6, 27, 11, 26, -24,
+	-13, -8, -22, -20, -22, -26, 33, -28, 2, -11, -7, -6, -3, -2, 17, 8,
+	-5, -1, 17, -10, 51, -53, -43, 31, -3, -1, -15, -2, 21, 15, -32, 12,
+	-21, 23, -29, -7, -19, 8, -9, 3, -24, -16, -19, -19, 21, -18, -11, 5,
+	19, -27, -6, -30, 32, -20, -7, -19, -6, -21, 7, -48, -17, 24, -39, 42,
+	15, 10, 20, -54, 4, 22, -4, 0, -4, -26, -2, 13, -15, 25, 15, 16,
+	-5, 19, 30, -4, 18, -12, 6, 2, 4, 30, -8, 12, 16, 8, -17, 12,
+	-8, 1, 38, 16, -3, 1, 21, -9, -32, -8, 55, -8, -45, -3, 41, -9,
+	9, 7, -44, 5, -6, 26, -17, -24, 38, -21, -11, 15, 18, -13, -25, 17,
+	-11, 30, 2, -22, -9, -22, -24, -8, -24, 33, -19, -9, 2, 7, -26, 3,
+	10, 18, 0, 22, 10, -21, -11, -41, 27, -36, -55, -4, 28, 10, 12, -25,
+	-7, 14, -33, 16, -14, -18, -25, 23, 18, 31, -17, 30, -8, -3, 19, -13,
+	6, 29, -10, -3, 26, 33, 17, 31, -7, 21, 2, -30, -25, 11, 41, 9,
+	5, 30, 17, -23, -3, -23, -5, -38, -57, 21, 50, -17, -8, -15, -3, 4,
+	31, 6, 10, 43, -18, 30, 0, -23, -29, 32, -7, 8, 32, -30, -5, 22,
+	-10, -24, -1, 2, -8, 14, 9, 19, 5, -14, -7, 27, -7, 33, 61, 47,
+	-15, -41, -30, 10, 10, -10, 17, 40, 19, 14, 9, -46, -2, -34, -20, -8,
+	-22, -17, -29, -1, -34, -30, -1, 8, 8, 13, -34, -30, 7, 19, 28, -18,
+	-9, 15, -7, 12, 30, 28, -3, 34, 16, -18, 10, 28, 20, -29, -21, -1,
+	-24, -42, -8, -14, 3, 5, 11, -24, 25, -52, 15, 18, -2, 36, 5, -13,
+	7, 26, 1, 25, 5, -9, -3, 4, 10, 30, -11, 16, -32, 16, 31, 13,
+	36, -28, -13, -30, -6, 32, -12, 15, 18, 20, -13, 27, -56, -52, -29, -32,
+	33, 34, -3, -21, 39, 35, 41, -43, 13, 21, 34, -15, 21, -45, -10, 8,
+	24, -25, 0, 23, 15, -7, -4, 19, 23, -13, -7, -15, 9, -24, -2, -31,
+	15, 27, 21, 2, -17, 10, 5, 2, 40, -6, -13, -36, 33, -6, -18, 0,
+	-28, 16, -14, 40, 36, -12, 16, 3, -23, 11, -46, -16, 9, -8, 28, 5,
+	-13, 26, 23, 7, 1, -23, -16, 29, -1, 19, 0, -5, 28, 13, -16, -28,
+	-12, -1, 7, 2, -19, 55, 13, 48, 10, -15, -2, -7, 32, 23, 20, 16,
+	-9, 35, -1, 8, 20, -17, 10, 20, 19, -22, -7, 8, -20, 23, 10, 10,
+	13, -10, -9, -19, 8, -2, -24, 19, 32, -4, 20, -1, 17, -15, 8, 28,
+	-2, 21, -25, 27, 24, 9, 7, -19, -28, 35, 28, 22, -50, -37, -2, -19,
+	-6, -29, -17, 3, 39, 7, -13, -1, 26, -14, 25, -27, 17, 26, 5, 22,
+	25, 9, -16, -28, 12, 11, -15, 28, -3, 27, 28, -21, 18, 23, -22, -29,
+	11, -5, -21, -6, -4, 26, 18, -21, 8, -1, -42, -11, 15, -16, 20, -8,
+	30, -5, 19, 33, -1, 44, 19, 10, 12, -4, 0, 13, -33, 21, 26, 11,
+	12, -9, 5, 16, -28, 30, 16, -3, -17, 26, 15, -4, -34, 9, 25, 5,
+	10, 19, 17, 34, -32, 17, 48, 18, -29, -15, -9, 23, -25, -2, 0, 20,
+	4, -7, -7, -3, 21, 30, 7, 22, -25, 7, -3, 21, 3, 27, -33, -15,
+	-13, -25, -12, 7, 20, -14, 9, -11, -21, -27, -25, 31, 0, -15, 27, -20,
+	-18, -14, 2, 30, 31, 12, -33, -27, 18, 24, -3, -9, 9, -21, 23, 17,
+	31, 2, 26, 41, 1, -29, -21, -16, 18, 10, 23, 11, -22, 13, -11, 6,
+	15, 28, -4, -27, -29, -11, -28, 35, -25, 14, -9, -31, -27, -10, 0, 8,
+	-20, -17, 15, -26, -33, -22, -12, 12, 7, 16, 1, 43, 20, -17, -14, 3,
+	-22, 15, 17, -15, 26, -9, 12, 27, 26, -16, -27, 19, 10, -13, -29, -16,
+	5, 8, 9, 17, 4, 32, -2, 1, 32, -17, 18, -12, 81, -5, 15, 26,
+	51, -38, -13, -10, -18, -14, -21, 8, 29, -19, 47, 6, -64, 18, -27, -31,
+	-3, 23, 10, 12, 12, 32, -19, -17, -3, 20, 27, -25, -31, -23, 14, -16,
+	-36, 32, 0, 13, -24, 24, -17, -3, 11, 3, 40, -43, 18, 59, 3, 1,
+	-60, -33, 3, -17, -13, -38, 27, 10, -13, -17, -14, 4, 17, 14, 25, 18,
+	15, -16, -31, 17, -38, 28, -5, -20, -13, 5, 12, 22, -17, -2, 14, 26,
+	12, 9, 11, -23, 29, 21, -9, 37, 66, -11, 34, 46, 17, -31, -33, -24,
+	-16, -3, -37, -30, 3, -36, 6, -2, -3, 5, 30, 24, 7, -8, 8, -7,
+	10, -16, -32, -11, -36, 10, -8, -15, -11, -14, 31, -23, -26, -24, 18, 6,
+	-36, 35, -29, 0, -27, 7, 56, 9, -1, 43, -5, -36, -11, 7, 17, -23,
+	29, -14, 11, -27, 32, 18, -28, 5, 10, -5, 13, 25, -30, -6, -31, 13,
+	27, 24, 10, 16, -17, 19, -37, 3, 9, 11, 14, -1, 22, 8, -22, 5,
+	27, 18, -8, 16, 29, -18, 5, 23, 3, 13, -20, -41, 27, -18, -1, -6,
+	1, 45, 31, -19, 11, 11, 26, -12, -20, -19, -7, 12, 24, 5, -2, 16,
+	-21, -26, -8, -18, 14, -24, -21, 2, -33, 32, 16, 10, 2, 32, -11, 4,
+	35, 28, -26, 20, -15, 35, -35, 14, 42, 73, 6, -4, 31, 10, -17, 23,
+	8, 13, -36, 48, 3, -15, 25, 6, -12, -22, -5, -11, -19, 10, -21, -31,
+	-12, -1, 7, -31, 7, -26, 28, -21, -38, -18, -18, 27, -6, 25, -22, 20,
+	-18, 6, -27, 5, -12, -17, 39, 1, 9, -21, -23, 27, 13, 7, 21, 14,
+	10, -11, -7, -34, -2, 23, 21, -6, -20, 0, 19, 16, 24, -26, -1, 8,
+	34, 27, -14, 8, 13, 14, -6, 16, 9, 28, -15, 10, -13, 30, 19, -22,
+	0, 24, -6, -4, 1, 17, -5, -7, -43, 46, -11, 14, -14, 35, 6, -5,
+	5, 10, 17, 9, 6, -4, 0, -10, -24, -3, 12, 20, -15, 24, 16, -30,
+	26, 29, 24, -8, -3, 10, -33, -14, -18, 32, 38, 23, -32, 37, -30, -19,
+	13, -3, 45, -16, -6, -20, -20, 42, -18, -25, 26, 26, 39, 9, 7, 19,
+	4, 2, -1, 9, 14, 28, -16, 5, 4, 20, 19, 6, 20, -28, 27, -10,
+	-23, 5, -14, -27, -15, 26, -17, 26, 38, 47, 1, -21, 0, -18, 31, 17,
+	49, 44, -11, 7, -48, 29, -24, -23, 18, 23, 8, 54, -17, 8, 10, -29,
+	-19, 9, -21, 7, 5, -9, -15, -2, -27, 27, 1, 19, 30, -7, 2, 3,
+	-36, -18, -16, -14, 24, 3, -26, 32, 29, 33, -7, -15, 7, 32, 25, 39,
+	-14, 14, 34, -28, 3, 33, -20, 24, -34, -20, -20, -10, 20, 6, -12, 7,
+	-17, 4, 1, 17, 22, -3, 5, -25, -5, 8, -19, 25, -12, -9, 18, 27,
+	21, -13, 21, -9, -20, 50, -25, -17, -10, -8, 48, -28, -46, -5, 8, 16,
+	4, -37, -4, -8, 29, 2, -3, -16, 41, -21, 14, -16, -15, 28, -4, 6,
+	-28, -21, -19, -11, -10, 28, 20, -9, -29, 27, -4, 29, -1, 15, 27, -25,
+	39, -10, 0, 37, -29, -21, 2, 32, 44, 22, -32, -34, 43, -2, -16, -31,
+	13, -16, -25, -4, -8, -36, 23, 37, 12, -21, -8, 9, 7, 30, -31, 14,
+	-26, -25, 29, -27, -14, 24, 22, -4, -24, 13, 17, -18, -5, -3, 37, 7,
+	5, 21, -21, -13, -3, 3, -32, 14, -37, -29, 15, -11, -5, -36, -23, -18,
+	-37, 3, -32, -26, 11, 14, 29, -31, 25, -25, 0, -6, 6, -21, 1, -16,
+	-4, -2, -23, 15, -17, -10, 24, 29, 1, -2, 25, -8, -10, -13, -19, 23,
+	-28, -3, -50, 10, -23, 12, -34, -32, 4, 8, 27, 11, -34, -50, -13, -42,
+	-16, 6, 18, -9, -7, 6, -19, 10, -1, -31, -23, 1, -10, 3, -27, 10,
+	10, -21, 11, 14, 34, -14, -11, -22, 8, 8, 9, -6, 1, 10, -24, 31,
+	57, 9, 27, 39, 38, -31, -6, -15, 5, 83, -1, -3, -15, -22, 13, 39,
+	39, 1, 33, -4, -26, 16, -20, 27, -4, 25, -14, 13, -19, -35, -8, -8,
+	25, -4, 34, 12, -17, -16, 4, -2, -30, -22, 24, 32, 45, 20, -3, -14,
+	-25, 1, 42, -41, -11, -2, -18, 37, -2, 31, 10, 23, 18, 20, 26, -38,
+	-8, 7, 6, -8, -11, -30, -13, -5, 25, 27, 24, 18, -11, 9, 13, 19,
+	-24, -18, -7, 1, 27, 11, -12, -8, -20, -17, 18, -26, 25, 37, 25, 25,
+	-2, 26, 2, -6, 43, 48, -31, -2, -13, -23, -25, 6, -10, -24, 22, 29,
+	-9, -9, 4, -17, 31, -12, -23, -5, -11, 7, -4, 28, -7, 24, 20, 6,
+	-15, -6, 12, -35, -2, 3, -16, 28, -23, 3, 56, -10, -20, 47, 58, 20,
+	-14, -42, 29, 66, -5, -1, 17, -29, -25, -40, -2, -6, -2, 11, -12, -34,
+	-27, -31, -7, -19, 20, 11, -9, 10, -35, -32, -2, 22, -25, 16, 19, 7,
+	-19, -3, 7, -6, -19, -8, 2, -9, 4, -17, -32, -4, 60, 26, 5, -11,
+	-32, 58, -34, 43, -25, 2, -7, 11, 27, -5, 9, -30, -17, -3, 17, -29,
+	-20, -29, -22, -32, 33, 5, 19, -24, -29, 30, -7, 23, 15, -31, -12, 23,
+	5, 14, -4, -18, 25, 35, -3, 24, 46, -1, -33, 20, 12, -11, 4, 15,
+	-7, -18, 9, 1, -38, -12, -29, 33, -13, 14, -25, -31, 0, 20, 32, -7,
+	0, 22, 11, 24, -9, 8, -28, 30, -29, 21, 15, 18, -16, -14, -7, -6,
+	-35, 28, 27, -10, 30, -3, 25, -1, -10, 29, 30, 10, 32, 8, -10, 42,
+	-13, -35, -13, -12, -13, -22, 28, -23, 25, -3, 10, 7, -23, 10, 0, 9,
+	-8, -18, -17, 26, 21, -17, 9, 26, -10, -1, 32, -34, -18, -13, -38, 9,
+	8, 16, 15, -32, 50, 5, -26, 21, -20, 33, 10, -20, -35, 29, 2, -4,
+	-37, 0, 3, -19, 2, -3, -8, 13, -24, 19, 11, 12, -16, 29, 31, -33,
+	13, 2, -10, 22, 7, -24, 24, -12, -24, 31, -15, -36, 1, -30, -16, 41,
+	30, -34, -14, -11, -13, -34, 11, -7, 17, -36, 19, 10, -34, -5, -51, 37,
+	31, 9, 4, -30, 25, 16, -8, -5, -20, -20, -21, 33, -29, -25, -39, 13,
+	-14, -21, -29, -26, -13, -27, 23, 0, -24, -34, -19, 6, 7, 33, 32, -27,
+	2, 20, -31, 4, -26, 22, 34, -5, -30, 47, -44, 7, -65, 35, -32, 22,
+	25, 19, 22, -26, 33, 1, -21, 3, 29, 16, 8, 28, -21, -7, -20, 28,
+	-24, 4, 11, -28, -6, 19, 0, 26, 36, 56, 19, -34, 27, 24, -39, -49,
+	-41, 22, 37, -2, 13, -73, -17, 21, 0, -5, -6, 0, -5, -29, 14, 11,
+	-4, -19, -10, -12, 28, 7, -22, 32, -22, 32, -3, 9, 7, 13, 31, 21,
+	-26, -23, -11, 14, 11, -15, 21, 43, 3, -22, 43, 0, -41, -26, -41, -22,
+	-5, -5, -6, -16, 1, -17, 22, -13, -6, -16, 24, 19, 27, 5, -27, -17,
+	-12, 29, -20, -23, -12, -19, 1, -10, -28, 15, -8, -3, 7, 19, 35, -24,
+	29, -18, 18, -36, -13, 46, 49, -38, -2, 1, -19, -36, -9, 41, 13, -16,
+	0, -49, 2, 31, -30, -15, 6, 0, 7, 1, 29, 28, 29, -28, 14, -12,
+	-4, -19, -8, -12, 8, -16, -21, 14, 7, -23, 17, -5, 13, -30, -4, -27,
+	24, 21, -28, 25, 36, -29, 7, 3, -26, -46, -8, 10, 45, -20, 3, -30,
+	-34, -2, 6, 5, -48, -20, 41, 21, 20, 27, -15, -2, -11, 22, -27, 21,
+	29, 31, -13, 26, -22, -1, 24, -1, -5, -28, 10, -16, -8, 17, 14, 16,
+	18, 23, 40, -12, 14, 27, -15, 6, -25, 17, -2, 31, 9, -53, -12, 35,
+	-30, -10, -12, 4, 38, 20, -28, -17, 11, 8, -9, -19, -13, -20, 15, -24,
+	33, -23, 15, -21, 23, 8, 6, -20, -13, 6, 4, 15, -10, 23, -45, -12,
+	63, -27, -1, 1, 3, 16, -51, 46, -59, 9, 21, 12, 9, -34, -20, 44,
+	65, -22, 14, 24, 3, 25, 5, 23, 29, -30, -32, 33, 17, 13, -30, 28,
+	29, -2, -23, -1, -4, 32, -1, 30, -3, 24, 18, -40, -41, 19, 20, -20,
+	21, 20, 16, 19, -27, 11, -45, 11, 39, 33, -14, -3, -21, -6, 38, 7,
+	26, 16, -24, 15, -11, 27, 10, -24, 27, -1, -20, -2, -7, -9, 28, 15,
+	-20, 14, 10, 30, -25, 11, 0, -32, 34, -30, -47, -21, 63, -23, 9, -8,
+	-28, 6, -42, 19, -62, -30, 10, 16, -17, -22, 11, -3, 25, 10, -6, 13,
+	15, -32, 25, -26, -32, -8, 7, 12, -23, -4, 4, -34, 31, -14, 15, -9,
+	32, 22, -6, 27, 15, -7, 8, 1, 1, 22, 67, 16, 12, 6, -20, 7,
+	-37, 9, -29, 9, 38, 45, -4, 6, -49, 33, 25, 41, -15, 7, 10, -8,
+	-21, 28, 3, -15, -12, 3, -4, -21, -10, -6, -24, 5, 0, -27, 27, 6,
+	17, 19, -27, 10, -7, -34, -39, 16, 72, 12, 5, 14, 8, -14, -31, 40,
+	10, 2, 38, 49, -24, -42, -10, 22, 24, -39, -20, 0, -12, -28, 23, 21,
+	-13, 31, 1, -21, 31, -16, -31, 6, -6, -33, 7, 11, 4, -7, 34, 20,
+	5, 27, -25, -42, -34, -9, -8, 26, -8, 1, -3, 15, 16, -50, 23, -3,
+	6, -17, -25, -8, -8, -3, -50, 9, 30, 23, -4, -4, -4, 33, -26, -27,
+	-16, 1, 0, 20, -7, -9, 17, 26, 2, -28, -17, 2, 17, 2, -31, 18,
+	-14, -29, 29, 25, -28, -4, -48, -10, -14, 9, -9, -46, 5, -21, 22, 20,
+	11, -30, -26, 28, -45, 49, -20, 34, -27, 30, -32, 28, 9, -21, 22, 4,
+	-32, 28, -11, 22, -13, -14, -35, -4, 13, 14, 24, 9, 3, -27, -29, 16,
+	-12, -10, -26, -2, -40, -7, -52, -16, -3, -2, 10, -31, -1, 20, -2, 18,
+	-34, -25, -21, 33, -58, 18, -4, 4, -22, 23, -10, 18, 19, -22, -20, -17,
+	-16, -6, 10, -4, -27, 1, 8, 27, -27, -16, 20, 20, 13, -7, 14, -13,
+	26, -17, 9, 10, -22, -5, 10, -31, 28, -2, -28, 27, -11, -40, 23, -21,
+	-30, -11, -30, -19, 22, 6, 10, 15, -16, -18, 11, 35, -15, -4, 1, 27,
+	-30, -23, -45, -25, -32, -20, -9, -18, -7, -3, -29, -6, 0, -9, 29, 21,
+	0, -12, 28, -37, -5, -34, 30, 24, -10, -9, -11, -51, -28, -6, 26, -19,
+	-15, -22, 1, 30, 2, -6, -23, 33, 8, -1, 12, -23, -32, 13, -33, 15,
+	-17, 27, 12, 5, -5, 8, -20, 24, -39, -8, -15, 17, 16, -11, -17, 31,
+	-3, 20, 58, 33, 44, 12, 25, 18, 15, -14, -37, -12, -7, -33, 37, 7,
+	-29, 11, 28, 22, -23, -19, 15, 21, -13, 26, -16, -15, 23, -22, -6, -19,
+	0, 21, -27, -27, 27, 11, -6, 5, 28, 18, -20, 4, 5, 4, -23, -23,
+	32, 3, -3, -19, -3, 4, -17, 12, -33, -7, -6, 15, 24, 27, 6, -14,
+	0, 32, -5, 21, 2, -14, -6, -7, 2, -4, -28, -3, 32, -13, -2, -1,
+	0, -26, -31, -11, -26, -3, 0, 6, 1, 33, 16, -19, 16, 24, -45, -59,
+	-20, -24, -6, -37, 41, 19, -22, 25, -19, 21, -4, -14, -34, -6, -21, -7,
+	-1, 34, 18, -8, -29, 23, 21, 33, -3, 22, -31, -9, -6, 33, 3, 26,
+	-25, -28, -24, 6, -12, 14, -23, 38, 28, 8, -21, -1, 26, 2, 38, -19,
+	-19, 22, 30, 42, 5, 34, 1, -20, 42, -2, -7, 8, 10, 17, -22, -20,
+	-2, -29, -30, -1, 10, -30, 25, 30, -26, 14, -9, -10, -27, 9, 9, -13,
+	9, -45, 16, 15, -46, 41, 19, -8, 38, -30, 53, 14, -2, -29, -11, -7,
+	26, -7, 7, -3, 20, -55, 34, -6, -28, -2, 22, -22, 27, 2, 16, -30,
+	-17, -15, 3, -24, -14, 0, -34, -22, -19, 32, 25, 10, 6, 24, -10, 22,
+	18, -12, 26, 11, -25, -28, -12, 16, 47, -4, 28, 27, -5, 33, -17, 20,
+	-24, -4, 34, -22, 0, 38, 30, -26, 8, -4, -19, -28, 12, 15, -22, -19,
+	-13, 27, 0, -14, -6, 23, -24, 14, 4, 12, -2, 21, -10, -18, 22, -21,
+	-34, -38, 2, 37, -39, 59, 4, -33, 36, -24, -10, 44, -17, 23, -9, -25,
+	-15, 29, -10, -16, -22, -8, -30, -6, 1, 5, 4, -19, -20, -1, -19, -6,
+	4, 6, -17, -25, 18, -21, -11, 11, -16, -2, -34, 12, 42, -30, -40, -40,
+	-51, 9, -29, 36, 39, 0, 20, -32, -26, 10, -26, -22, -8, -9, -8, -5,
+	-26, -15, 1, -17, -17, -14, 4, -32, 25, 18, 21, -6, -1, -1, -16, 22,
+	-10, 11, 34, -12, -26, -5, 30, -31, -62, 14, 56, -25, -3, -14, 6, -27,
+	16, 31, 15, 13, 0, -30, 3, 41, 13, 22, -18, -33, -22, 2, -8, -33,
+	-14, -3, -12, -14, -4, 4, 3, -34, -28, 25, 9, 0, 19, 18, -17, 16,
+	20, -29, 12, 4, -29, 0, -22, -10, 66, -39, -48, -52, -51, -35, -7, -27,
+	-15, 6, -2, 16, -2, 14, 0, 47, -24, -32, -14, 5, 11, -1, 32, -8,
+	-6, 6, 27, -3, 34, -9, 35, -2, -23, 0, -20, 29, -16, 12, -25, 23,
+	19, 20, 10, 23, 10, 36, 36, 15, -56, -14, 4, 26, 24, 11, 30, 19,
+	2, 31, -14, -15, -24, -13, 10, -15, 12, 14, -6, 32, 19, 3, 27, -19,
+	3, 9, 23, 3, 13, -28, 28, 16, 16, -30, 7, 34, 33, 26, -3, -26,
+	12, 25, 33, 15, 21, 7, -30, 7, 40, 22, -45, 31, -3, 12, -18, -14,
+	-26, -22, -16, 12, 13, 16, -10, 7, 2, 2, 31, 4, 18, 26, 14, 19,
+	3, -18, -25, -8, -17, 25, -1, -24, 13, -5, -8, 31, -3, -25, -31, -28,
+	-22, -12, 31, 14, -42, 7, 2, 12, 22, 47, 5, 16, 22, -34, -30, 29,
+	4, -33, -10, 0, -23, 3, -4, 25, -25, -20, 16, 36, 4, -16, -17, 7,
+	1, 28, 24, 3, 9, 30, -16, -8, -34, -13, -9, 17, -18, -23, 28, 5,
+	-42, 62, -37, 35, 21, 23, -22, 41, 5, -8, -14, -2, -1, 24, 17, -4,
+	-3, -31, 19, 3, -10, 44, -6, 22, 13, 24, 16, -28, 14, -8, 14, 3,
+	27, 16, -26, -25, 29, -7, 30, 21, 22, 35, -16, -21, 52, 5, -5, 69,
+	26, 50, -6, 33, -23, 12, 43, 7, -26, 12, -22, 11, 26, -32, 33, -9,
+	14, 12, -21, 39, -22, -27, -10, 17, 8, 8, -25, -25, 0, -23, -3, -8,
+	-7, 29, 16, 12, -15, 18, -5, 32, -20, 31, 14, -11, -7, -34, -23, -3,
+	4, -12, 3, 25, -25, 5, -32, 20, 44, -18, 15, -9, 3, -42, 8, 0,
+	27, 50, -15, 10, -28, -31, 15, 1, 31, 14, 12, 12, 32, 10, -15, -5,
+	10, 11, 1, 21, -9, 16, 6, 27, -19, 32, 0, -6, -31, 18, 7, -41,
+	3, 9, -16, -23, -16, 13, -5, -3, -12, -26, -4, -21, 46, 40, -9, -7,
+	-4, -17, -34, -1, 1, -3, -25, 15, 20, 9, -3, -4, 22, -5, 4, 6,
+	-33, -19, 0, 26, -9, -4, -9, -20, 13, 18, -18, 41, 29, 22, 7, 23,
+	17, -23, -3, 17, 52, -4, -11, 12, 20, 16, -2, -37, -2, -8, -33, 12,
+	-2, -27, -9, 12, -7, 8, -19, 27, -17, -6, 9, -31, -36, 14, 3, 26,
+	15, 28, -34, -14, 20, 26, -33, -35, 16, 23, 20, -3, -19, 19, 15, 15,
+	-17, 8, 16, 10, -3, 8, 3, 14, 34, 50, 8, -18, 29, 18, -28, 29,
+	-1, 16, 7, -24, 12, 17, 26, 34, -13, 21, -2, 26, -36, 14, -18, 25,
+	-1, 33, 17, 20, 25, 0, 34, 20, 16, -13, 3, 14, -31, -38, 14, 31,
+	13, 10, -27, 43, -38, -28, 10, 42, 2, 19, -22, 1, -8, 12, 25, -12,
+	-33, -4, 14, -13, 11, -11, -25, 23, 19, 17, -21, 15, 6, -9, 22, -18,
+	-52, -20, -12, 8, 10, 38, -24, -1, -15, -26, 26, 34, -11, -20, 42, 66,
+	-5, -6, -20, -23, -19, 36, 0, -34, -14, -9, 20, -6, -15, 30, -24, -12,
+	10, 7, -13, 8, 13, -5, -24, 25, -11, -29, 9, -33, 28, 25, 4, 16,
+	7, 1, -22, 33, -35, 35, 4, 2, -12, 45, 13, 1, 11, 58, 12, 19,
+	24, -65, 5, -15, -4, -17, -24, 17, -3, 17, 29, -32, -14, 27, -17, 19,
+	-27, -4, -26, 22, 8, -32, -26, 3, 22, -11, -7, -34, -25, -1, 33, 3,
+	-25, 4, -17, -3, 16, -26, 0, 3, -26, 10, 33, -3, -5, 10, -41, -19,
+	31, -26, -6, -17, -23, 26, -23, -27, -17, 4, 28, -21, 22, 20, 1, 10,
+	-14, 10, -5, 8, -2, -12, -25, 28, 10, 16, 10, 3, -9, 25, 35, 34,
+	-20, -22, 23, -25, 16, 19, 9, -35, 29, 45, 12, 45, 6, -4, 30, 5,
+	-45, -27, 13, -11, 33, -21, 3, -12, 16, 19, 22, -8, 0, 17, -26, -33,
+	8, 5, 29, -35, -12, -12, -1, 3, -26, -8, 39, 28, 7, 64, 31, 38,
+	-20, -24, 10, -10, -33, -31, 20, 59, 4, 21, 9, -9, 22, -16, -25, -27,
+	-7, -23, 2, -13, -8, 2, -1, 9, -29, -4, -18, 0, -21, -10, -11, -10,
+	-22, -29, -21, -31, 15, 23, 46, -22, -8, -33, -8, 36, 21, -29, 9, 38,
+	-22, 18, -8, 7, -31, -6, 24, 9, -6, 2, -27, 19, 10, 20, -17, 31,
+	-11, 12, 12, 7, 13, 28, -9, 2, 25, -15, 26, -20, 3, -26, 13, -32,
+	-29, 20, -1, -29, 43, -5, -26, -25, 18, 26, 30, -44, 18, 47, 3, 19,
+	1, -26, 8, -25, -4, 14, 5, 5, 9, 4, 28, 20, -8, 18, -14, -4,
+	15, 11, -4, 3, -6, -17, 18, -33, -31, 22, -35, 3, 29, -10, 4, 7,
+	-13, 24, 15, 33, -9, -23, -34, 15, -2, -37, 0, 25, -19, 40, -10, -20,
+	-14, -9, -14, 8, -27, 26, -33, -13, 15, 29, 9, 8, 7, 32, -4, 16,
+	7, -4, 0, 1, -6, -26, -31, -5, 11, 12, 4, -21, -33, 17, 20, 27,
+	46, 32, -28, 15, -1, -11, 3, -50, -10, 17, 2, 21, -26, -2, -54, -24,
+	28, -8, -13, 20, -28, 23, 11, -5, 32, 29, -11, -17, -23, 30, 17, -32,
+	-23, -24, -3, 28, 2, -23, -15, -17, 23, -17, 20, -26, -13, -7, 10, -2,
+	-24, -36, -20, 34, -32, 9, 22, 1, -12, -1, 4, -25, -4, -31, -26, 35,
+	19, 32, 19, -2, -43, -18, -26, -19, 0, -27, -24, 28, -33, -29, 32, -24,
+	-27, 13, -29, -32, 9, 25, 24, 23, 14, -19, 25, -23, 33, 32, -9, -1,
+	-21, -46, 37, 13, -29, -5, 4, -7, -12, 2, 30, -52, 3, -11, 19, -6,
+	-41, 20, -5, 13, 32, 16, -23, -10, 8, -23, -9, -2, -24, -7, 13, -17,
+	-7, 16, -29, 6, -1, 2, -15, -17, -21, -13, -3, -3, -16, 10, -33, -27,
+	13, -31, 25, -6, 32, -9, 16, -12, 0, -54, 35, -31, 28, 20, 56, -34,
+	-2, -34, 32, -8, -26, 16, -28, -19, 17, 1, 20, -25, 11, 17, -5, 9,
+	36, 26, -23, -25, -29, 5, 35, -21, -17, -18, 39, 10, -26, -24, -16, 2,
+	32, 49, 43, 13, -7, 13, -24, -46, 20, 2, -1, 18, 15, -15, 11, 9,
+	-11, -4, -26, -12, -3, -24, 16, -12, -5, -9, 30, -4, 5, -14, 10, -12,
+	31, 13, -13, -12, -10, 31, 36, 22, 11, 4, -34, -46, 14, -29, -6, 1,
+	34, -14, 33, -7, 36, -45, 23, 4, 25, 1, -37, 24, -9, -5, -25, -3,
+	-6, -7, -13, 20, 3, -16, -7, 14, 20, -16, 4, -4, -28, 33, 26, 1,
+	-21, 30, -6, 19, -15, 0, -5, -42, -13, -59, 20, -42, 11, 18, 36, 9,
+	-15, -10, 4, 0, -27, -14, -18, 14, -12, -39, -45, -23, 33, -25, -27, 14,
+	-20, -27, 0, 17, -3, -9, -10, 1, -16, 0, 15, -10, -11, 22, 3, 11,
+	-8, 25, 28, -15, 3, 1, -19, 15, 43, -7, -55, -36, -5, 24, -30, -5,
+	15, -7, -29, -55, -9, -18, -28, 13, -3, -22, 16, 34, -27, 12, -31, 31,
+	30, -21, 6, 32, 26, 8, -4, 3, -41, 9, -26, -12, -15, -11, 5, 25,
+	38, 8, -14, -1, -14, 15, 45, -18, -53, -15, -24, -2, 2, -14, -9, -42,
+	27, 5, -25, -24, 11, -1, -26, 12, -24, 24, -3, 20, 4, 10, 5, -3,
+	12, -28, 22, -16, -22, 33, -28, -26, -1, -21, -23, 34, 22, 0, -12, -33,
+	-34, 9, -3, 4, 30, -2, -28, 10, 19, 24, 17, -16, 16, -28, -7, -13,
+	-31, 16, 19, -31, 4, -37, 3, 27, 21, 20, 0, -11, -11, -12, -7, 11,
+	-13, -4, -7, -4, 16, -29, -12, 34, -3, -6, -19, -30, 24, -53, -14, 23,
+	26, -29, 31, -21, -46, -18, 17, -37, -11, -6, -7, 10, -26, 67, -1, 57,
+	-26, -35, 16, -6, -18, 9, 18, 20, 17, -10, 18, 35, -3, -22, 27, 5,
+	-7, -26, -44, 31, -31, 0, -6, 7, -17, 7, -8, -50, -7, 24, -31, 35,
+	60, -11, -39, 0, 10, -25, 18, -15, 15, -4, 33, 41, -6, 37, 9, -2,
+	-6, -9, -15, -4, 11, 32, 21, -27, -31, -11, 14, -1, 27, 1, 15, -27,
+	-30, 19, -35, 7, -2, 12, 17, 22, 43, 1, 32, -4, 43, 22, -15, -1,
+	28, 43, -59, -14, -18, 7, 12, 83, 25, -7, -25, 6, 3, -8, 6, -13,
+	23, -9, 19, -12, 3, -13, -27, -18, 12, -16, 28, 4, 16, 23, 23, -2,
+	27, -2, -12, 9, 21, -22, 12, -5, 1, -6, 39, -4, -3, 24, 1, 41,
+	1, -9, -19, 5, 22, 40, 24, 28, -24, 33, 13, 56, 33, 34, -21, -30,
+	13, -20, -11, -15, -9, 30, -2, -17, -29, -1, -28, 12, 10, 31, -28, -7,
+	-4, 30, -27, -21, 31, -22, -13, 22, -3, 3, -3, -4, -1, -5, -19, 30,
+	-39, 8, -9, 55, 20, -14, -2, -29, -10, 35, 43, -6, -20, -12, -10, 6,
+	-35, 27, -22, -3, -19, 6, -4, 32, -2, 8, -24, -30, -11, 21, -29, -11,
+	7, -9, 18, -3, -3, 10, 15, 2, -34, 13, 20, 20, -18, 25, -58, -2,
+	2, 19, 22, 26, -10, 19, 19, -5, 22, -4, -14, 7, -5, -19, -24, -16,
+	-28, -17, -24, -16, 4, -7, -24, 18, -36, -8, -28, -25, -2, 32, -32, -15,
+	-13, -50, -37, 7, 40, 11, 28, 14, -1, 27, -8, 16, -9, -4, -21, 77,
+	32, 28, -15, 3, 25, 9, 49, 15, -20, -8, -14, 10, -11, -5, -22, 25,
+	-9, 36, -4, 1, 14, 17, 28, -13, -26, 10, -1, 24, -36, 19, 38, -15,
+	7, -52, -7, 8, -6, -40, 1, 38, 29, 10, 9, -8, 39, -14, 9, 47,
+	29, 2, -9, -14, 0, 57, -4, 6, 29, 26, 10, 19, 9, 5, -29, 2,
+	6, 7, -5, -10, -37, 11, -22, 9, 10, -25, -12, 32, 7, -5, 9, -49,
+	10, 28, 12, -46, -19, 0, 1, -44, 2, 15, -23, -28, 15, -24, -30, -4,
+	-19, -19, -48, 35, -19, -20, 11, 13, -30, -7, -29, 10, -1, -14, 16, -17,
+	24, 21, 3, -7, 2, 24, -32, 4, -14, -10, 29, -12, -31, -70, -33, -13,
+	50, -8, -40, 27, 27, 8, 7, -2, -4, -57, -35, -22, -31, -8, -26, -18,
+	-36, 17, -20, 7, -26, -26, -16, -26, -10, 0, 28, 3, -10, -8, -6, 1,
+	-15, 24, -30, 23, -8, 31, -8, 19, -13, 12, -28, -38, 15, 42, 3, -26,
+	-28, -15, -4, 2, 4, 27, -24, -4, -24, -20, 14, 16, -6, 5, -18, 42,
+	5, -29, -3, 28, -21, -14, -22, 29, 33, -26, -28, 14, 14, -30, 13, 25,
+	10, 28, 3, -13, -3, -19, 4, -27, -7, -36, -33, 8, 30, -56, -17, 40,
+	-8, -44, 65, 11, -3, -40, 39, -24, 5, 11, 45, 13, -8, -27, 9, 3,
+	20, -20, 0, -25, 11, -1, 13, 12, -26, -26, 2, -8, -33, -20, -2, -10,
+	-4, 1, -6, 15, 16, -33, 23, -2, 4, -1, -18, 0, -9, 28, -59, 23,
+	-37, -31, -34, 38, 23, -24, 23, -22, -2, 18, 1, -2, 1, -22, -16, 11,
+	-28, 33, -22, -6, 1, -13, 18, -9, -34, 27, -12, 22, 9, -20, -7, -22,
+	-14, 27, -8, -5, 19, -6, 16, 9, -35, 32, 20, 17, -65, 3, -27, 15,
+	36, 42, -25, -26, -38, -15, -11, 19, -10, -12, 32, -18, -30, -10, 1, 10,
+	26, 10, -32, 1, -21, -30, -9, 29, 24, 23, -27, -12, -19, -15, 22, 0,
+	21, -18, -19, -10, 27, -28, -21, 26, -8, 19, -44, 30, -19, -2, 12, 35,
+	5, 8, -22, 6, 12, -30, 14, -3, 27, 28, 29, -20, -22, 35, -1, 7,
+	-24, 30, -34, 19, -2, 31, 26, 20, 19, 28, 32, -27, -17, 11, -13, -6,
+	0, 9, 34, 35, -33, -27, 4, -2, 11, 38, 28, -30, 10, 62, -19, 24,
+	-36, 0, 16, 12, -13, 15, -31, 7, -12, -16, 12, 6, 16, -28, 1, 10,
+	30, -20, -25, -9, 0, 16, 16, -9, -6, 17, 7, 24, -22, 1, -4, -25,
+	12, -24, -31, -22, -11, 53, 23, 53, -17, -14, -13, 30, -3, -25, -13, -49,
+	0, -34, 16, -31, 18, -16, 29, 13, -23, 0, -6, 15, -6, 7, -11, 28,
+	-14, 33, -8, -19, -28, -11, -31, -24, -6, -7, 25, -30, -14, -8, 28, -76,
+	68, 19, -19, 24, -13, 12, -54, 21, -33, -13, 13, -19, 10, 52, -3, -11,
+	11, -1, 20, -15, -13, -1, 22, -11, 21, 19, -9, -13, 7, -2, -24, -1,
+	40, 35, 0, 5, -36, 25, -26, -19, 3, -19, -48, 0, 35, -32, 36, 15,
+	-69, 5, 17, 12, -69, 0, -23, -3, -8, -31, 22, 19, -2, -18, 34, -16,
+	17, -11, -36, 34, 21, 28, -15, -24, -5, 20, -3, 32, -25, 35, 10, -17,
+	-11, 30, 8, 36, 26, -6, 20, -30, -27, 17, 44, -82, 40, 18, -61, -16,
+	17, -13, -72, 7, -39, 13, 2, -60, 0, 42, 2, -18, 22, 0, -8, -5,
+	-27, -3, 5, -25, -18, -8, -32, 37, -19, 8, 21, -6, 8, 37, -8, -8,
+	-28, 30, 23, -8, 43, -28, -16, 12, 28, -71, 76, 20, -32, 2, 16, 32,
+	-37, 42, -9, 27, -37, -9, 26, 47, -5, -13, 21, 50, 30, -27, -4, -18,
+	17, 27, -27, 31, -36, 31, -24, -24, -20, 7, 5, -22, 4, 5, 14, 38,
+	1, 1, 37, 8, -53, -2, 5, -33, 56, 23, -54, 13, -4, -15, -104, -6,
+	-17, -31, 0, -66, 28, 42, 30, -3, 32, 33, -25, 15, -30, -21, 5, 3,
+	15, 1, 27, -13, -25, 0, -6, -28, 44, 20, 9, 22, -31, 35, -31, 20,
+	-21, 36, 8, 4, 1, -38, 25, 41, 29, 32, -42, -14, 19, -10, -9, -11,
+	22, -30, -3, -16, 5, 2, 4, -23, -21, 29, 27, 21, 10, 14, 31, 28,
+	22, -12, -31, -8, -12, -31, 5, -15, 12, -3, -29, -15, -30, -21, 16, 7,
+	24, 38, 14, 4, -28, 26, 14, 27, -45, -34, -26, -4, 35, -49, -19, 2,
+	39, -16, 19, -17, -33, 18, 17, -19, -21, 14, 20, -7, 2, 14, 19, -1,
+	-22, 1, 18, 34, 37, 15, 10, -26, 27, -30, 0, 1, 23, 14, -23, -3,
+	-30, 7, -14, -7, 46, -12, 3, -35, -42, 5, 33, -37, 20, -37, -16, -25,
+	-1, 14, -32, -20, -33, 29, -30, 4, -4, 7, 22, -1, 26, -1, 18, -20,
+	-7, 4, 11, -14, 24, -23, 29, 28, -12, -29, 6, 23, -8, 4, 11, 10,
+	11, -30, 51, 27, 4, 6, -3, -27, 36, -25, -13, -17, -6, -27, -7, 7,
+	-45, -12, -24, 18, 22, -24, 27, -15, -21, 1, 18, -9, 33, -32, 8, 27,
+	6, 34, 2, -2, -2, -11, 25, -4, 6, 6, 20, 7, 29, -55, 29, 3,
+	29, -24, -1, -6, -48, -37, -7, -54, 28, 3, 5, -27, -43, 18, -36, 11,
+	14, 15, 8, 29, 24, -24, -25, -32, 16, -7, -28, 32, 16, 27, -14, 21,
+	8, 19, 6, 2, 10, -31, 39, -52, -42, -17, -14, -13, 16, -19, -31, -12,
+	79, -33, 3, -31, -4, -13, -19, 8, -13, -18, -68, -33, 43, 39, -2, 22,
+	-9, -7, 2, -25, -5, -10, -10, -10, 6, -32, 27, 1, -33, -34, -17, 17,
+	19, 1, 26, -22, -6, -37, -45, 12, 28, -18, 29, -33, -4, -14, 48, 6,
+	-8, -30, -5, -39, 6, 33, -24, -38, -48, -26, 67, -19, 0, 12, -16, 7,
+	-7, -19, 29, -31, 24, -11, 34, -12, -27, -32, 21, -3, 16, 25, 13, -10,
+	-15, -10, 12, -35, -23, 20, 26, 4, -28, -22, 25, 26, 26, 8, 33, -3,
+	-40, 9, -5, -30, -26, -36, -50, -29, 68, -18, 29, -4, 7, -15, -12, -22,
+	3, 28, 19, 20, 33, 5, 12, 10, -7, 15, -7, 23, 19, 0, 9, -15,
+	35, -42, -21, -19, -9, 33, -8, -1, 1, -9, 38, -9, -26, -14, 0, 17,
+	-26, 20, 22, -12, -43, -8, 68, 20, 23, 7, -23, -25, 1, -22, -18, 13,
+	-17, -21, -1, -27, -4, 27, -25, -18, -7, -33, -21, -3, -4, 31, -27, -11,
+	-52, -8, -18, -19, -27, -24, 20, 27, 38, -45, -4, -1, -32, 11, -46, -7,
+	28, 42, -1, -36, 50, 20, -5, 18, 16, 0, 10, -8, 22, 16, -9, 16,
+	-25, 27, -10, 23, 4, -33, -29, -30, 27, 1, -1, -28, 13, -36, 1, -4,
+	8, 48, 12, 16, 28, 17, -18, -29, 3, 27, 34, -10, -29, 31, -11, 8,
+	-30, 23, -31, -28, -28, -10, -4, 2, -9, -11, 12, 14, 4, 4, -24, -30,
+	11, -30, -5, 32, 25, 23, -2, -3, 8, 0, 1, -18, -28, -31, -32, 7,
+	27, -14, 12, -38, -26, 14, -29, 23, -30, -20, -26, -40, -29, -39, 18, 26,
+	-23, -11, 16, -1, 32, -29, -29, 25, -19, -24, -7, 26, -15, 26, 17, 5,
+	18, -18, 14, 31, 30, 4, -13, -25, 26, -10, 0, 7, -3, 38, 16, -24,
+	-8, 9, -31, -27, 28, -15, 2, -16, -2, -26, 21, 14, -16, 33, -3, -14,
+	-1, 1, 21, 23, -31, 30, -4, -22, -16, 5, -27, -33, 12, -28, -19, -24,
+	-28, 3, -24, -20, 6, 14, -29, -3, -36, 11, -21, 29, -1, 20, -14, 25,
+	2, 1, 48, -12, -21, -9, 33, 5, 24, -33, -24, 14, -11, 34, -4, 16,
+	-15, -25, -4, -5, -19, 25, 18, 6, -12, 6, 10, -32, 16, 16, 10, 18,
+	-33, 23, -18, 9, -5, -30, 25, 7, -40, 41, 15, -27, -21, 3, -36, -30,
+	3, -11, -35, 16, -3, 23, -33, -38, 31, -14, -16, 7, 31, 28, 19, 24,
+	-9, -8, -10, 1, -25, 1, 19, 13, 31, 29, 8, -6, -25, 31, 1, 14,
+	-14, -10, 8, 47, 16, -20, 49, -50, -40, -19, -4, -22, -59, -11, 15, -9,
+	19, -19, -39, 22, -21, -25, 49, 11, -1, -31, 2, 32, -23, 21, -9, 19,
+	-21, -9, 2, -28, 19, 3, -29, 30, -18, -25, -12, -14, -6, 26, 15, -14,
+	7, 37, 13, 31, 46, -25, -15, 12, -12, -10, -41, 26, 48, -30, 34, -40,
+	18, 8, -18, -6, 0, 18, 9, -37, -22, -28, 18, -15, 7, -29, 30, 12,
+	22, -13, -17, -10, -27, 29, 3, 7, 22, -16, 33, -11, -9, -20, 30, 21,
+	-15, 18, 60, 9, -40, 10, -6, 10, -20, -19, 25, -8, 14, -43, -57, 15,
+	-6, -9, 30, 31, -51, 0, -7, -28, 20, -13, 6, -31, 9, -15, 5, -34,
+	10, 0, 25, 27, 28, -12, -6, 16, 29, -5, 8, -28, -23, 22, 13, -10,
+	60, 17, 6, 6, -18, 15, -27, -21, 47, 11, 35, -12, -21, 5, -15, -53,
+	26, 13, -36, -18, -18, -27, 8, -7, 3, -33, 0, 15, 32, 29, 8, 9,
+	29, -21, 0, 9, 31, -19, -8, -21, -24, 18, -6, 20, 34, 16, 61, -16,
+	-37, -11, -31, -30, -27, -3, 48, 18, 39, -27, 7, -38, -21, -54, 18, -16,
+	-15, -37, -27, 28, 23, -9, 14, -31, -22, 15, -20, -16, 18, 14, -6, -30,
+	1, 11, -12, -6, 6, 30, 3, 4, -35, -40, -20, 32, -13, 59, -4, 1,
+	14, -29, 13, -39, 13, -32, 34, 51, -34, -6, -3, -44, -32, 3, 30, -1,
+	31, 22, -17, -30, 11, 23, 14, 23, -19, 12, 1, 17, 20, 5, -19, -1,
+	10, 32, 37, -27, -31, -15, -35, -36, 6, 44, -31, 19, -57, 40, -29, 2,
+	31, -52, 23, -24, -11, 12, 13, -38, -14, -22, -1, -13, 42, -21, -16, -5,
+	26, 14, 20, -11, 4, -27, 2, -17, -8, -6, 15, -12, 20, 22, 21, -9,
+	7, -14, -17, 23, -35, -41, 8, 53, 22, 5, -36, 30, -15, -26, 10, -60,
+	-1, -23, 15, 31, 7, 18, 0, -49, 8, 15, -18, -27, -22, -5, -9, 25,
+	-12, -24, -23, 7, -17, -28, 20, -25, -16, -19, 4, -3, -11, 19, -20, -23,
+	16, -19, -33, 35, 11, 53, -38, 13, -52, -12, 6, 9, 7, -43, 8, 3,
+	42, 33, -28, 2, -19, -40, -23, -13, -10, -35, -4, 25, 18, -24, 8, -15,
+	-13, -16, -26, 16, -12, 3, -16, 17, -5, 0, -17, -1, 26, 16, 3, 4,
+	16, 11, -7, 64, -35, 54, -32, 18, 21, 14, -8, -13, 12, -32, 16, 23,
+	-23, 35, -13, 4, -8, -15, 11, -5, -8, -20, -30, 0, 27, 26, -28, 7,
+	4, -23, -4, 7, 20, 6, -25, 13, -3, 31, -25, -24, -17, 6, 19, 23,
+	-18, 0, -24, 2, -12, -12, -12, 25, -9, -2, -2, 29, 1, -57, 19, -54,
+	44, 25, 39, -2, 11, -2, 7, -13, 31, 16, -16, 16, -4, -20, 21, 22,
+	25, 36, 46, -1, -16, -22, 6, -10, 21, 13, -13, 34, 32, -22, 8, -31,
+	-46, 1, 24, 20, 1, -1, -10, -8, 11, -2, -10, -51, 28, -53, 36, 10,
+	-3, -34, 20, -24, -11, 5, 31, 0, 12, 11, -7, 34, 9, 17, -6, -9,
+	26, 1, 11, -5, -25, 13, -29, -28, -18, -23, 46, 9, 16, 22, -17, 29,
+	41, 5, -35, 36, -37, 19, -28, -22, -34, -35, -2, -37, 16, 55, -6, 24,
+	13, -46, -23, 31, 32, 19, -8, -30, 25, -14, -12, -25, -32, 32, -1, 23,
+	49, 15, -24, 30, -20, -2, -6, -9, 50, -6, -26, -8, -36, -16, -9, 33,
+	-20, 28, 20, 5, -59, -29, -3, -39, -15, 13, 38, 22, -7, 11, -16, -34,
+	-10, 1, 8, -21, -11, 5, 18, -25, -4, -7, 29, 24, -7, 17, -3, -25,
+	33, -13, 24, -23, 30, 2, 28, 1, -4, 6, -45, -53, 24, 2, -10, -20,
+	-26, 35, -36, 44, 32, -65, -10, -39, 49, 18, -5, -20, 35, -23, 1, 26,
+	30, 15, -14, -19, -13, -11, -33, -8, -17, -28, 2, 4, 14, -17, 22, 24,
+	-21, 5, -9, 34, 11, -16, 31, -31, -21, -30, 21, -17, 20, -15, -21, -26,
+	4, 30, 22, 7, -12, 25, -24, 32, -20, 18, -38, 13, -3, 8, 22, -12,
+	3, 23, 24, -32, 2, -25, -30, -9, 10, -15, 20, -2, -24, -28, -20, 28,
+	-18, 18, 3, 1, -12, 6, -18, 27, -8, 24, 31, 38, -4, -18, -17, 37,
+	-15, -26, -25, -23, 30, 11, -25, 25, -11, 32, -15, 25, -29, -8, 12, -24,
+	-25, -8, -14, 12, 7, -23, -30, 1, 27, -13, -5, -14, 2, -17, 13, 3,
+	22, 28, 15, -34, 24, -11, -33, -18, 3, 10, 24, -6, -14, -25, 16, -41,
+	29, 13, 11, -9, -24, 2, -21, 35, 20, 16, -27, -25, -32, 28, 3, 9,
+	-19, -16, 8, 19, -4, -9, -15, 9, -8, 0, -5, -30, -9, 11, 8, 8,
+	2, 0, -19, -26, -3, -25, 14, 29, 1, 29, -14, 19, 27, -37, -31, 9,
+	16, -9, -36, 10, 27, 16, 25, 4, -1, 22, -22, -24, 29, 30, 25, 10,
+	16, 28, 26, -32, -24, -6, -16, 2, -4, 5, -28, 6, 26, -1, -14, 18,
+	6, -2, 18, 15, 46, -16, 25, 47, 25, -17, 25, -26, -6, -30, 25, 38,
+	-39, 5, -10, 42, 9, 27, -27, 7, -15, -18, -10, -25, -19, -14, 2, -5,
+	12, 28, 14, 22, -23, -4, -33, 18, 2, -16, -33, -31, -26, -9, -8, 15,
+	-3, 14, 5, -1, -3, 4, 18, 1, 35, 31, 27, 34, 30, -31, -2, 3,
+	3, -27, 0, 8, 21, 12, 23, -12, 24, -12, 33, -3, -24, 4, 0, -17,
+	18, -25, -4, 2, 39, -14, 5, 4, -40, 15, -9, 28, -26, 28, 32, -22,
+	-18, 20, 30, -9, 14, 10, 21, 8, 1, 8, -11, 5, 13, 4, 16, 10,
+	17, 29, -29, 25, 2, -13, -13, -1, -6, 16, -4, 18, 31, -31, 29, 0,
+	-18, -10, 33, -20, -13, 20, 19, 21, -30, 48, -19, 40, -30, 14, 16, -17,
+	23, -17, -29, -34, 48, -20, -1, 39, -20, -1, -35, -30, 11, 26, -13, -20,
+	-8, -5, 7, -19, 10, -2, 5, 4, -12, 17, 21, 17, -1, 22, -25, 13,
+	35, -7, 11, 28, -25, 5, 0, 57, -44, 54, -22, 12, -6, 7, 44, 2,
+	8, -7, 23, -12, 15, 17, -33, 21, -8, -41, -28, -15, -3, 4, -31, -31,
+	-2, -18, 35, 6, 26, 4, 12, 29, 5, -7, -25, 15, -7, -5, -10, 27,
+	-4, 29, 2, -4, 9, 32, -26, 40, 12, 28, -24, -37, -6, 28, -10, -20,
+	50, -18, -15, 23, 26, 9, 0, -4, -16, 4, -18, 22, -17, -36, -6, 18,
+	17, 11, -6, 13, 26, -22, 17, 20, 20, 24, 11, 13, -6, 9, 12, 26,
+	-25, -10, 28, -37, -42, 48, -4, 10, 1, 5, -5, 27, -8, 7, -62, 9,
+	-30, 74, -22, -56, 8, -15, -33, -2, -26, -12, -5, -7, 6, -21, 31, 23,
+	-18, 25, 24, 9, -28, -14, -30, -30, 29, -10, -22, -27, 21, 32, -2, 23,
+	15, 14, -15, -5, -24, -53, 30, 39, -23, -6, 33, -38, -38, 36, -48, 35,
+	-31, -50, -27, -2, 35, 18, 21, 19, 6, 4, -4, -16, 19, 25, 21, -12,
+	-24, -16, 12, -21, -9, 17, -17, 23, -14, -9, 8, 7, -5, -22, 7, 19,
+	-22, 39, -17, -24, 14, 2, 1, -28, 24, -31, -58, 21, -19, 46, -40, -41,
+	9, -18, -6, 0, -11, -7, 12, -9, 7, 29, 10, -10, -12, 4, 32, 21,
+	3, 12, -29, -18, -13, 21, 32, 15, 17, 22, -7, 13, -5, 32, -30, 20,
+	-8, 10, 8, 36, 14, 39, 6, 2, -25, 27, -19, 38, -16, -36, -9, -16,
+	-49, 8, 16, 2, -15, 13, -27, 0, -13, 29, 17, -20, 12, 15, -30, 2,
+	17, -23, -30, 27, -16, 25, 31, 15, -38, 34, 15, 10, 21, 14, -3, 30,
+	20, 14, 5, 17, -54, -19, -24, -13, 9, 0, 10, -40, 59, 12, 5, 43,
+	17, -10, -30, -13, 4, -30, -31, -31, 32, 8, -23, 10, -38, 32, -40, 30,
+	-32, -30, -20, -14, 18, -12, 17, -25, 8, -17, 14, -44, -28, -9, -28, 1,
+	47, 0, -5, 13, 0, -35, 17, -53, 40, -32, -36, 0, 5, -4, 16, 25,
+	2, -21, 4, -28, 29, -16, 15, -28, 9, 10, 15, 27, 15, -27, -10, -23,
+	13, -30, 20, 23, -9, 18, 21, -54, 6, 14, -19, -5, 0, 14, 64, -15,
+	-48, 17, -28, -45, 23, -24, -8, -22, -18, -12, -28, -4, 12, 5, -22, -23,
+	-2, -21, 32, -19, -13, -35, 7, -9, -6, 19, 10, -28, 4, -18, 20, -29,
+	-11, -31, 34, 11, -17, -9, 19, -43, -26, 3, -40, 10, 13, -11, -9, 7,
+	17, 24, 33, 2, 5, 46, 19, 14, 25, 0, -31, 25, 10, -24, -12, -6,
+	29, 7, -21, -19, 31, 20, -15, 3, -11, 1, -31, 6, 25, 26, 17, 21,
+	-17, 29, -24, -19, 30, -34, 3, 17, -8, -7, 39, -13, -27, 17, -19, 29,
+	-14, 2, 31, 59, 31, 21, 36, -8, 27, 12, -18, 9, -25, -14, -8, -31,
+	-9, 7, -17, 29, 7, -4, -33, 8, 4, 26, 19, 7, -25, 23, 6, 6,
+	4, -34, 16, -54, -54, -3, -8, 6, 58, -17, -41, 23, 6, -23, -28, 21,
+	-14, 53, -25, 14, -16, 14, 6, 13, 9, -31, -12, 11, -25, -6, 9, -9,
+	22, 22, 41, -15, 5, -15, 22, -14, -7, 19, -28, 7, -29, -42, -42, -21,
+	7, -33, 7, -18, -35, -24, 64, -19, 0, 20, -26, -40, 10, -32, -22, -20,
+	16, -6, -4, 18, 18, 4, -23, 15, 20, -20, 7, -19, -31, 6, -14, 13,
+	-18, -3, -27, -26, 28, -5, 34, 22, -21, -2, 17, 5, -45, -29, 23, -24,
+	31, -10, -19, -33, 48, -7, -6, 4, -20, -38, 9, -6, 14, -33, 28, 15,
+	-10, 3, -21, -15, 15, 22, 10, 1, 4, 3, -20, -7, -19, -11, -8, -34,
+	-1, -22, 10, 31, -7, -7, -22, -3, -2, -8, -9, -6, 44, -39, 3, -32,
+	-28, -13, 50, -47, -22, 35, 8, -37, -14, -17, 3, -44, 37, 1, -17, -17,
+	20, -3, 26, -12, -8, 15, 13, -31, -30, -17, 29, -3, 12, 9, -27, -5,
+	16, 7, -20, -30, 23, 20, 2, 10, 6, -32, 42, 13, -14, -34, -18, -34,
+	48, -29, 1, 23, 32, 11, -32, 1, 35, -33, 19, -6, 7, -3, -7, 19,
+	-20, -26, -22, -32, 1, 7, -17, 17, 23, 4, -15, 24, -13, -14, 17, 3,
+	-14, 30, -16, 27, -22, 18, 0, -28, 43, -23, -37, 2, -17, -12, 77, -29,
+	-12, -16, 1, -15, -41, -66, -10, -34, 13, -15, 19, -6, 32, -30, 25, 6,
+	-25, 17, 1, -24, 34, -30, 18, -18, -24, 7, 13, 9, 33, -9, 17, -2,
+	0, -34, -30, 3, 7, 26, -25, 5, 8, -26, 13, 16, -25, 0, -18, 19,
+	33, 0, -31, -18, 29, -7, 3, -11, 51, 1, -33, 23, 25, 6, -23, -30,
+	26, 18, -21, 15, 24, -22, 18, -21, 10, -17, 0, -26, 2, -19, 17, -1,
+	-13, -36, -28, -21, -13, 13, -13, 3, -23, 20, 13, -6, -5, 14, 30, 20,
+	-1, 16, -7, -4, 18, -1, -16, -34, -15, 8, -21, 14, 19, -10, 11, -4,
+	27, 12, 7, -28, -14, -7, 33, -23, -13, -9, -36, -22, 2, -25, -24, 25,
+	-6, 47, 24, 5, 22, -6, -44, 1, 11, 15, 17, -14, -19, 34, 31, 3,
+	39, 34, 46, 36, 29, -1, 8, -12, 5, 9, 26, 23, 32, -22, 10, 6,
+	18, -29, 14, 9, 14, -19, -6, -6, 10, 9, 5, -14, -7, -1, -31, 35,
+	-8, 26, -22, -15, 2, -26, -6, 22, 8, -40, 38, 15, -27, 5, 19, -16,
+	-5, 38, 36, -37, 28, 28, -22, -23, 18, 14, 26, 11, -12, 7, -16, 11,
+	10, 29, -4, -24, -2, -7, 31, -2, -20, 4, 19, 20, -33, 18, 10, 16,
+	12, 25, 13, -20, -1, -13, -4, 8, 18, -24, 22, -9, -10, -29, -28, -15,
+	22, -7, -29, -16, -8, 33, -19, -1, -24, -9, 24, 25, 17, 27, -7, -30,
+	22, 21, 29, -30, 12, 24, 13, 25, 22, 0, -14, -46, 15, 12, -19, -38,
+	-18, 34, -8, -39, 45, 30, 38, 4, 11, -58, 15, -35, -6, 1, 37, -45,
+	-32, -22, -29, -4, 20, 27, 3, -17, 6, -21, 9, 11, -28, 28, 11, 0,
+	6, -6, -17, -7, 6, -20, -4, 12, -9, -44, -48, -5, -34, -28, -26, 20,
+	23, -8, 29, -38, 34, -19, 21, -29, 28, -22, -63, -1, -52, 1, 14, -19,
+	9, 35, 6, 9, 20, -4, -25, -8, 13, -7, -4, 24, -15, 6, -19, 1,
+	-21, 4, 14, 20, 20, -1, -12, -49, -21, -42, 19, -15, 39, -11, 0, -27,
+	33, 21, 41, -21, 12, 20, -2, 15, -52, -23, 18, -23, 20, -16, 7, 30,
+	11, 31, 12, 21, 28, -11, 20, 13, -2, -14, -15, 14, 12, 17, -9, 34,
+	24, 32, -32, -30, -1, -49, -19, -12, 45, -22, 20, 24, 16, -8, 72, -30,
+	13, -3, -8, -4, 1, -19, -21, 13, 32, -14, -4, 12, -5, 24, 29, 25,
+	3, 28, -32, 35, 15, -6, -4, 0, -19, -10, 13, -20, -1, 7, 30, -2,
+	4, -18, -5, -66, -32, -52, -5, 12, 35, 0, 15, -19, 64, 2, 38, -15,
+	0, -13, -34, 30, -56, -13, 14, -15, 26, 31, -24, 19, 2, 1, 24, 16,
+	-20, 23, -17, 17, -13, -29, -23, 35, -2, -19, 21, 32, 8, 31, 9, -53,
+	-29, 7, -39, -14, 0, -18, 11, 6, 34, -29, -7, 20, 36, -46, -24, -2,
+	12, 2, 6, -12, 18, 3, -24, -29, 29, -9, -3, 4, -32, 14, -5, 29,
+	29, 32, 5, -13, 20, 5, 10, -18, 33, 9, -27, 12, -30, -39, -3, 3,
+	0, 15, 16, 15, 16, -31, 9, -25, 52, -8, 44, -26, -6, -15, -16, 7,
+	-1, -17, -5, 30, -26, -9, 22, 5, 10, 15, 35, 24, -25, 25, -18, -28,
+	28, 12, -18, -8, -11, -13, 24, 26, 31, -14, 26, -22, -32, 22, -2, -33,
+	10, -9, -27, 8, 40, -2, 67, 1, 25, -49, 0, 23, -14, 18, -2, -15,
+	16, 39, 37, -1, 34, -16, 7, 18, -1, -33, 28, -12, -10, -34, 7, 6,
+	2, 3, -4, 23, 9, -36, 4, -14, -19, 11, -32, -8, -10, 11, 29, -28,
+	15, -33, -8, 2, 58, -1, 24, -78, -15, -28, 42, -18, 30, 6, -17, 20,
+	-10, 12, 11, 14, -14, -5, -12, -6, 28, 24, 22, 19, 38, -2, 40, 27,
+	17, 0, -28, -15, 35, 7, 5, 9, -32, 46, -55, -25, 17, 16, 13, -32,
+	17, -6, 11, -39, 1, -46, 10, -9, 9, -4, 6, -2, 14, 20, -11, -3,
+	-8, 0, 19, -33, -18, -2, -11, 17, 8, -6, 20, 4, 16, -29, -9, -22,
+	14, 11, -11, -20, 29, -26, -14, -29, 4, -50, 36, -21, -33, 28, -2, 25,
+	-15, -33, 14, -42, 45, 21, 8, 21, 6, 25, -2, 18, 30, 34, -10, -17,
+	-35, 28, -10, -17, 1, -17, -17, -18, 35, 27, 39, 24, -33, 32, -20, -4,
+	-9, 12, 41, -17, 21, -45, 17, -48, 31, 6, -38, 11, -4, 1, 32, 5,
+	-6, -11, 36, 4, 17, 5, 38, 5, 3, 22, -30, 31, -8, -11, 10, -29,
+	-27, -2, 11, 25, 11, 7, 11, 8, 49, -6, 24, 2, -18, 29, -11, -20,
+	52, -10, -54, 4, -34, 4, 39, 10, -12, 14, -21, -7, 35, -11, 26, -51,
+	47, -40, -14, 35, -10, -20, -39, 7, 17, -30, 3, -20, 0, -2, 14, -7,
+	-33, 4, -5, -24, 17, -16, 10, -15, 13, -26, 4, -22, -16, 33, 42, -14,
+	-38, -25, 10, -5, 45, -15, -4, 25, 33, 57, 23, -3, 33, -15, 20, -27,
+	-17, -3, -12, 5, -52, 6, 5, 26, 6, 13, 17, -15, 19, 16, 26, 31,
+	12, 11, -20, -4, 3, 15, 0, -31, -13, -13, -12, 10, 32, -6, 28, 3,
+	18, -38, 26, 28, -5, -10, -35, 13, 32, -15, -15, -29, 24, -18, 28, 23,
+	6, 49, -51, -7, 17, -31, 15, -13, -16, 8, -19, 28, 7, -20, -18, 3,
+	37, -12, 11, 8, -33, 5, -30, -19, 4, 14, -20, 7, 5, -41, -27, -29,
+	-42, -12, -9, -23, 36, -20, 46, -6, 31, 33, -15, 43, -25, -26, -35, 28,
+	14, -14, 22, 2, -10, 28, 4, -11, -34, -12, -31, -33, 27, 25, 3, 21,
+	-13, -32, 27, -32, -32, -16, -32, 20, -12, -5, 2, -39, -2, -1, -50, -29,
+	7, 5, 1, -12, 51, -16, 39, -35, -6, 27, -7, -18, -21, 19, 42, -15,
+	25, 4, -24, -17, -12, -16, -6, 24, -20, 33, -15, -9, -23, -3, -23, -26,
+	-32, 12, -7, 23, -12, 22, -20, -2, -5, -18, 1, 36, -48, -44, 1, -6,
+	29, -62, 74, -1, 13, -36, -13, 6, 24, 8, -2, 31, 28, -6, -30, 13,
+	-11, 2, 3, 27, 27, -4, 13, 32, -32, 26, 4, 20, -16, 13, -33, 10,
+	-17, -9, 25, -25, -39, -13, 2, -10, 0, 4, -55, -27, 12, 48, 6, -64,
+	83, 2, 14, -11, 13, 31, 17, 24, -28, 5, 25, -44, -36, -2, -19, -16,
+	-30, -17, -21, -2, -19, -18, -16, -25, -17, 20, 0, 7, 26, 8, 0, -7,
+	12, 23, 26, 12, 33, -20, -3, -33, -65, 13, -35, 30, 8, -41, 63, 39,
+	11, 6, -38, 28, 4, 17, -16, -10, -14, -35, -6, -11, 1, 34, 19, -21,
+	19, -11, -23, 35, 6, 26, 25, 22, 27, 6, -12, 8, -8, -4, -12, -21,
+	33, -38, -23, 17, 27, 2, 10, -13, 17, -29, 15, 17, -25, 3, 13, -12,
+	4, -42, -16, 21, 30, 11, 18, 18, 30, 5, -1, -31, 19, -28, -9, 6,
+	1, 0, 0, -4, 15, 3, 7, 16, -9, -25, -1, -27, 6, -28, 33, -53,
+	-46, 12, 60, -33, -21, 8, 33, -23, 14, 57, -34, 17, -3, -36, 9, -14,
+	-26, 12, 31, -44, -37, -2, 8, -28, 21, 12, -16, -25, 24, -17, -31, 24,
+	-3, 5, 29, 24, 34, 3, 21, -5, -24, 3, 12, -5, 12, -13, -16, 17,
+	22, -20, 6, -2, -2, 16, 3, 14, 10, 8, 33, 12, -24, 31, -25, 1,
+	16, -14, -19, 1, 30, -20, -2, -2, 4, -18, 1, 4, 12, -14, -11, -29,
+	-15, -9, 29, -25, -25, 10, -20, 29, 3, -32, 32, -60, -28, 18, 43, 28,
+	-11, -14, 24, -20, -36, 29, -39, 23, 21, -21, -37, -16, -22, 39, 30, -10,
+	-7, 0, -8, -19, 13, 1, -20, 17, -2, 24, -25, -1, 9, -6, -19, -17,
+	6, 25, -31, -19, -1, -27, -6, 10, -26, -22, -58, 15, 16, 24, 7, 32,
+	22, 13, -39, 34, -25, -28, 16, -32, -11, -15, -11, -4, 69, -7, 26, 20,
+	27, 7, 12, 19, -17, 30, 4, 9, 25, 13, 31, -28, -14, 29, 30, 31,
+	-32, -2, 29, 2, -18, -12, -4, 15, 55, -33, -29, 18, -10, -19, -12, 0,
+	-44, 20, -9, -37, -28, 19, 7, 31, 25, 8, 6, -11, 5, -12, 23, 12,
+	-29, 33, 33, 10, -32, -31, 18, 31, -25, 31, 15, -13, -4, 23, 9, 9,
+	31, 9, 19, 19, 18, 9, 12, -51, -5, 38, 1, -40, -41, -17, -22, 17,
+	21, 7, 2, 33, 12, 25, -19, 19, -12, -14, 14, 2, 24, 16, -19, 32,
+	1, 9, -25, -33, 7, 0, -30, 3, -24, 19, -23, 6, -14, -5, 5, -6,
+	16, -29, 15, 7, 26, -40, -25, 4, 25, -2, -38, 41, -6, 40, -20, 3,
+	-13, -36, -13, -15, 8, 20, 23, 11, -2, -7, -1, -21, -22, 12, 32, 25,
+	-25, -1, -21, 16, -15, 31, -3, -16, -3, -3, 7, -23, 13, -6, 2, 30,
+	40, 39, 19, -44, -14, -30, -19, 1, -5, 15, -12, -2, 25, -22, 26, -34,
+	-5, 29, -19, 33, 25, -10, -16, -21, -27, -33, 33, 11, -18, -18, 23, 4,
+	-11, -20, 17, -22, -22, 2, -7, 21, 21, 23, 6, -26, 31, 7, 29, 37,
+	43, -57, 1, -13, 25, 13, 15, 48, 19, -24, 11, -23, 49, -17, -30, -8,
+	-33, -6, 17, -8, -23, -32, 23, 5, -17, -27, -20, -16, 30, -1, -16, -5,
+	26, -24, -18, -13, -13, -31, -15, 23, 1, 21, -27, -5, -17, -57, -69, 0,
+	-1, -41, 45, -2, 15, -28, 12, -18, -13, 32, 0, -47, -3, -17, -3, -7,
+	-35, -8, -4, 22, -33, -3, -9, -14, 19, 2, -12, 18, 24, 26, -8, -20,
+	7, 6, -9, 7, -30, -25, -11, -17, -15, 25, 11, -68, -68, 1, 0, -17,
+	74, -6, -38, -23, -16, 19, -26, -7, 23, -12, -17, 19, 13, 17, -4, -11,
+	20, 18, 17, 19, -35, 15, -4, -14, -8, 9, -8, 8, 8, 26, -18, 35,
+	24, 2, -10, -9, -14, 21, -33, -6, -27, -57, -52, 1, 15, -21, 22, -12,
+	9, -25, -13, -1, -42, 21, 12, 6, -33, -10, -16, 26, 23, 7, -4, 27,
+	18, 7, -8, -21, 18, -26, -32, 16, 21, 11, -20, -11, -14, -11, 20, 15,
+	22, -14, -38, 2, 9, -17, -3, -29, -39, -1, 17, -6, 57, 13, -29, -24,
+	-7, 5, -22, -28, -22, 12, -45, -21, 19, -1, -26, -8, 29, 12, -34, -9,
+	-3, 2, 0, 28, -4, -2, -23, -18, -33, -26, 10, -19, -33, 16, -9, -8,
+	-31, 14, -5, -2, -19, -37, -22, 17, -19, -17, 76, -18, -16, -20, 10, 32,
+	21, -25, 52, -18, 11, -19, -2, -31, 6, 10, 25, 15, 3, -6, 1, 36,
+	-10, -17, -37, 29, -17, 31, 15, 35, 14, 17, -15, -23, -15, -14, -9, 6,
+	-29, -21, -5, 27, 53, 32, 4, 1, 15, -3, -2, 34, 10, 49, -23, -37,
+	-13, 32, 5, 63, 21, 63, 18, 9, -6, 14, -24, -23, 16, 5, 29, -33,
+	-25, 22, 9, -25, -31, -16, 20, -2, 20, 5, -10, 8, -29, 4, -10, -7,
+	41, 36, 1, 45, 23, 51, -8, -37, 17, 28, 28, 31, 7, 32, -32, 36,
+	-12, 50, 7, 22, 18, 1, 3, 5, -25, 32, -32, 16, -10, 30, -27, 28,
+	21, -18, -17, -21, 29, 27, -28, -13, 17, 22, -21, -26, -32, -28, 22, 8,
+	46, 53, 37, -4, -14, -37, 18, 41, -32, 52, 26, -35, -21, 11, 19, 4,
+	-21, 52, 2, 25, 38, 24, -36, -19, 8, -18, 3, 4, 23, 7, -10, 26,
+	-17, -13, 5, -2, -31, 9, -10, 34, 18, -3, 30, 19, 3, -10, -11, 76,
+	12, 4, 1, -38, 2, -25, -5, 20, -28, -26, -14, 12, 24, 14, -30, 32,
+	19, -9, -2, -17, -33, -20, 19, 21, 29, 14, 11, 21, 23, 17, 25, 9,
+	32, 27, -32, 31, 1, 12, -21, 6, 31, 32, -24, 57, 34, 56, 0, -14,
+	17, -25, 23, -31, 12, 63, 9, -4, -42, -15, -31, 33, 15, 32, 60, 21,
+	-8, 36, 5, 16, -34, 19, 16, 21, 1, -15, 6, 15, -14, 5, 33, 32,
+	22, 32, -17, 21, -30, 3, 13, 29, 1, -24, -17, 34, 23, -7, 12, -19,
+	5, -12, 40, 53, -33, 29, -55, -15, -63, -24, 11, -23, 7, 17, 48, 19,
+	5, -4, -33, -26, 1, 13, 5, -18, 21, -23, -16, 5, -5, 29, 21, -19,
+	4, 19, -6, 23, -28, 3, 7, -32, 19, -19, -7, 22, 0, 24, 33, 7,
+	27, 47, 1, -11, -47, 8, -45, -15, -27, -21, -39, 4, 11, 5, -20, 3,
+	-3, 2, 18, -13, -24, 26, -4, 20, -8, 5, -31, -4, -38, -23, 30, -5,
+	-19, -24, -26, 0, -12, -4, -5, -17, 8, 4, 8, -13, 7, 45, -5, -2,
+	-9, -27, -32, -28, -33, 5, -38, -9, -47, 17, 54, -10, -27, -1, -11, 2,
+	13, 33, 1, -1, 18, -12, -15, 6, 11, 17, 13, -11, 3, 2, -2, -9,
+	20, -4, 15, -28, 21, 11, 15, 6, -8, -8, 26, 56, -12, -7, -24, -30,
+	-14, -28, -31, 21, -4, -37, -15, 9, 42, -1, 31, 26, -26, -26, 27, -10,
+	28, -29, -9, -6, 27, 31, -14, -27, 10, -10, 23, 8, 4, -8, -27, -29,
+	6, 23, -13, 10, 9, 29, 46, -5, 14, 21, 27, 36, -33, 3, -42, 19,
+	-19, 7, 3, -19, -61, -5, -16, -24, 0, -3, 9, -33, -28, 24, 25, 17,
+	10, 26, -3, 11, -16, -5, 10, 27, 12, -12, -22, -13, 30, 11, 6, -28,
+	-58, -10, 12, -1, 26, -20, 32, 31, -6, -35, 27, -14, 0, -23, 19, 2,
+	-7, 20, 17, -35, -30, 16, 30, -33, -23, 18, 14, 15, 7, 10, 25, -30,
+	8, 25, 24, 7, 14, -9, -24, 5, 24, 10, 25, 2, 16, -13, -39, -15,
+	-21, 18, -12, -25, -21, 32, -2, -2, -19, 3, 16, -25, -35, -43, -6, 43,
+	-33, 32, -50, 27, 1, 20, -5, -8, 7, -17, 6, -30, -28, -22, -28, 20,
+	-14, 20, 2, 32, -31, 20, -28, -12, 4, 21, 14, 0, 5, -6, -3, 0,
+	-5, -18, 36, -6, -18, 3, 10, -29, 1, -38, -14, -2, 25, 26, -6, 36,
+	-30, 24, -27, -9, -20, -22, 33, -24, -17, -18, 15, -23, 11, -9, 11, 20,
+	33, 27, 6, 1, 12, -8, 15, -33, -8, -19, 10, 22, 20, 1, -5, -34,
+	6, 0, 5, -22, -9, -29, 12, -58, -6, -41, 26, 30, 48, -40, -52, 1,
+	-23, -24, 14, 6, 30, -10, -26, 27, -26, 31, -13, -13, 21, -28, 10, 5,
+	31, 8, -18, -16, 4, -30, 8, 36, 19, -28, -10, 31, 6, -4, 12, 13,
+	21, -27, -33, 19, 18, -41, 3, 9, -17, 12, -25, 23, 0, 45, -14, -11,
+	36, -12, -18, 7, 25, 0, 27, 19, -32, -22, 32, 4, 15, -15, -22, 27,
+	12, 15, 28, -17
+};
+constexpr int32_t bias_0[230] = {
+	-84, 64, -67, 192, 3, 164, -38, -242, 75, 8, -279, 170, -79, -229, -171, -237,
+	42, -14, 111, -43, 22, -92, -64, -3, 172, -633, 217, -128, -16, 166, 157, -175,
+	-391, -19, 115, -120, 190, -24, 45, -37, 169, 114, -48, -518, 47, 31, 67, -255,
+	-91, -365, 176, -75, -92, -384, -257, -23, -165, 34, 162, 118, -129, -327, -76, 151,
+	-285, 133, 123, -58, 159, -3, -146, -115, -26, -292, -84, -65, 101, -78, 66, -112,
+	104, -73, 27, -70, -30, 149, 14, -50, 107, 86, -194, 62, -133, -38, 72, -20,
+	-327, 170, 78, -66, -205, -97, 199, 234, 27, -116, 287, -71, 38, 160, -80, 69,
+	88, 104, -360, -34, 93, 164, -181, -188, -100, 4, 221, 105, -304, -90, -71, -128,
+	-70, -124, 35, -52, -82, 13, -81, 125, 64, -13, 44, 352, -119, 109, -197, 18,
+	-52, 183, -109, 65, -178, -135, -28, -270, -24, -149, -63, -251, -346, -42, -97, 342,
+	447, -176, -164, -296, 1, -27, -124, 50, 36, 278, 284, 86, 60, 99, -56, -48,
+	40, -34, -17, -167, 58, -72, -63, -545, -120, 11, -139, -112, -184, -53, 58, 275,
+	52, -50, 63, -202, 210, -69, -47, -43, 146, -39, 21, -201, -37, -273, -89, -353,
+	-115, 66, -103, 88, 42, -325, -19, 189, 58, -134, 85, -19, -169, 65, -174, -63,
+	-7, -16, -405, -46, -7, -32
+};
+constexpr struct aot_fully_connected_params params_0 = { 31, -128, 1369312312, -8, -128, 127 };
+
+//sequential_153/sequential_152/dense_229/MatMul
+constexpr int8_t weights_1[52900] = {
+	0, -31, -4, 18, 49, 6, 33, -19, -13, -51, -36, -43, -14, -28, -37, -50,
+	-46, 29, 47, -45, 49, 45, 44, -41, -6, 11, -29, 18, -28, 12, 0, 3,
+	-35, 30, 8, 13, 40, 11, 49, 25, -39, -18, -11, -50, -9, 8, 26, -34,
+	27, -35, 13, -14, 16, 38, -5, -28, 14, 8, -50, -36, 29, -54, -37, 16,
+	23, 48, -43, -42, -29, -34, -3, -50, 1, 11, 35, -27, -46, -44, 3, 47,
+	40, -28, -6, -9, -26, -37, 21, -15, -39, 12, -36, 10, -23, 41, -49, -46,
+	25, -29, 12, -31, -3, 49, -7, 51, -43, -3, -7, -1, 12, 27, 56, 23,
+	26, 33, 24, -39, -28, -5, -33, -25, -24, -49, 23, 4, 9, 19, 18, -6,
+	44, 10, 16, -20, 23, -35, -53, 50, -11, 16, 45, 7, 23, 37, -29, -19,
+	-22, 50, -43, 44, -30, 51, 13, 26, -20, -18, -3, -36, 3, -14, 42, 11,
+	-28, -29, 1, -31, -33, -21, -23, 23, 31, -17, -7, -27, -30, -39, -51, -45,
+	-44, -18, 35, -35, -21, 46, -34, -44, -25, -37, -2, 28, -30, 29, 13, 43,
+	43, -10, 3, -12, -28, 39, -44, -51, 17, 18, -48, 27, 20, 13, 52, -20,
+	-44, 3, -37, -18, -12, -22, 27, 2, 3, -23, -14, -21, 34, -41, 31, -36,
+	-34, 14, -47, 0, 29, -47, 36, 27, -13, 19, -40, 5, 20, -61, 26, -18,
+	-13, 13, 55, 12, 73, -52, -26, 28, -16, 5, -1, 27, 36, -46, -30, -65,
+	-5, 6, 58, -30, -3, -83, -36, -13, 28, 45, 28, -46, -27, 14, 30, -42,
+	38, -42, 43, -4, -42, -20, -11, 8, -46, -15, 45, 28, 45, 11, -6, 8,
+	17, -42, 12, -23, 19, -39, 33, -37, 52, -41, 4, -34, -21, 35, -19, 25,
+	-8, -1, -27, 18, -41, -58, 47, -17, -14, 40, 62, 10, -45, -25, -9, -65,
+	42, 24, -37, -5, 12, -40, 43, 34, -13, -8, 57, 32, -19, -32, 19, 39,
+	23, -12, 7, 23, -64, 66, 3, -20, 0, -11, 52, -14, -18, -33, 65, 25,
+	30, -56, -60, 16, 41, 25, 14, -27, -19, 84, 19, 42, -20, -69, 3, 58,
+	19, 2, -15, 0, 14, -20, -38, 22, 1, 61, -45, 12, -43, 18, 20, 24,
+	-33, -56, -11, 4, 11, -35, -20, 1, -41, -13, 34, 68, 22, -41, 7, 65,
+	1, 6, -43, 13, -28, 40, 47, -20, -52, 11, -45, -3, 22, 24, -7, -20,
+	63, 3, 16, 51, 23, 65, 23, -23, -50, -30, -19, 19, 8, 40, 34, 4,
+	52, 0, 9, -55, 48, 50, -6, 4, -36, -40, 35, -19, 12, 41, -17, 31,
+	38, 22, -33, 14, -50, -55, -24, 52, -57, -33, 3, -31, 48, 29, -43, -8,
+	-1, 55, 42, 61, 52, -34, 16, -15, -52, 27, 8, -2, -57, -58, -7, 42,
+	-1, 50, -41, -52, 23, 35, 7, -49, -32, -16, -35, 38, 21, -22, 19, -20,
+	-26, 53, 7, 18, -46, 30, 47, -64, -31, 25, 51, -24, 58, 25, -5, 23,
+	36, 62, -17, -38, -58, 23, -32, -40, 16, 48, 45, -12, -35, 40, 15, 7,
+	-27, 4, 7, 16, 36, 41, -34, -49, 63, -45, 23, -24, -49, -27, -2, 8,
+	-47, 37, -41, -34, -11, 32, 37, -53, -16, 16, -35, -27, -20, -10, 13, 9,
+	36, 40, 28, 43, 26, 88, 52, -44, -12, 39, 31, -18, 9, -45, 7, -19,
+	-48, -12, 38, -52, 36, 32, 8, 1, -20, 17, 67, 37, 29, 55, -63, -18,
+	-19, 9, 19, -7, 72, -25, -47, -6, -59, 27, 45, 54, -37, -43, 6, 41,
+	23, 57, 10, 32, 55, 14, 23, 44, 53, -33, 39, -9, 12, 26, -35, 12,
+	34, 54, -63, 20, 24, -46, -8, -2, -26, 14, 7, -17, -53, 31, 12, 33,
+	1, 44, -39, -25, -16, -25, -15, 54, -41, 24, 4, -45, 26, -76, -52, 46,
+	-21, 21, -56, 39, 1, -6, 44, -24, -18, -49, 29, -1, -39, 39, 46, -44,
+	32, -53, 18, 54, 19, -6, -5, 9, 20, -13, -10, 29, 11, -20, 7, 34,
+	-16, 43, 4, 55, 32, -11, 16, 31, -31, -35, -57, 7, -51, -17, 18, 2,
+	-15, -20, 42, -10, -23, -38, 10, 36, 48, 42, -25, 16, -34, -1, -14, 44,
+	44, 44, -26, -19, 48, 51, -37, 1, 32, -21, -28, 33, -27, 34, 70, 3,
+	10, -3, 40, 23, -41, 64, -55, 60, 37, -15, 3, 33, 57, 48, -33, 62,
+	21, 74, 28, 40, 13, 44, -30, 39, -71, 4, 45, -23, -66, -10, -26, -57,
+	-4, 30, 65, 67, 55, 0, -17, 75, -43, 14, 51, -51, -44, 27, -12, 38,
+	-15, -44, -15, 0, 38, 28, 12, 47, 51, 44, -1, 25, 44, 45, 56, 51,
+	9, -49, 3, -45, -59, -35, -58, 41, -1, -29, -53, 20, -5, -20, -18, 40,
+	-6, 16, -43, 12, -2, -12, 51, 2, -13, 11, 5, -40, 16, -38, -36, -75,
+	48, -8, 73, 14, -6, 19, -59, 23, 26, 20, -38, -35, 41, -46, 9, 75,
+	-52, -4, -56, 26, -23, -8, 53, 25, 11, 40, 6, 59, -34, -28, -38, 57,
+	8, 33, 27, 44, 42, -35, -35, 8, -31, -13, -35, -3, -13, 18, 47, -17,
+	28, -16, -63, 0, 33, -64, 48, -41, -64, -19, 21, 32, -10, 42, -8, 6,
+	-42, -3, -32, -10, 23, -16, 37, 58, -8, 2, -61, 58, 10, 30, -74, 53,
+	-46, -49, -17, -46, 26, -59, 2, 33, -29, -8, -57, -38, -60, -27, 57, 4,
+	-26, 43, 52, 74, 80, -25, 73, 77, -29, 15, -17, -20, 4, 1, -25, 16,
+	-22, 25, -16, -18, 51, -11, -49, 55, -68, 0, -33, 34, 28, 74, -51, -20,
+	-23, -8, 11, 22, -81, -60, 25, 12, 62, -80, 1, 32, 48, 39, 39, -25,
+	42, -4, 19, 7, 65, 21, -52, 43, 81, -1, 8, 13, 15, 22, 54, -12,
+	30, -17, -37, -11, -5, 32, -2, 59, 13, 9, -4, 58, -22, -46, 76, 62,
+	46, -6, 71, -49, 53, 6, -23, -29, 62, 62, 50, -20, 90, -88, 8, 30,
+	53, -60, -83, 11, 31, -33, 63, -22, 3, -11, -35, -54, 20, 20, -36, 67,
+	7, -39, -81, -29, -60, -62, 45, 12, -27, -92, -37, 65, 15, -1, -8, 79,
+	17, 7, 22, 26, -18, -23, -1, 45, -13, -9, -41, -45, 6, -15, 78, 22,
+	7, 12, -39, -30, -13, 27, 12, 7, 70, -58, -43, -29, -36, -23, -19, -8,
+	7, -79, -6, -18, -62, -41, -23, 47, 34, 16, -33, -33, 0, 42, -49, 17,
+	-55, -16, 28, -21, -73, 97, -30, 61, -32, -65, 4, 47, -23, 44, 54, -19,
+	-7, -67, 84, -60, 36, 12, 22, -38, 17, -42, -34, 33, -21, 22, 2, 9,
+	-55, 52, 3, -23, 73, -38, 57, -29, -2, 8, -5, 17, -10, 17, 22, 7,
+	67, 41, -44, 48, 46, 4, 70, 1, -27, 52, 12, -14, 33, 1, 43, 70,
+	-27, -33, 35, 50, -32, 38, -36, 1, 54, -28, 27, -16, 38, 15, 82, 19,
+	-10, 10, 17, 59, 15, 36, 16, 41, -3, -40, 29, 14, -37, 63, 13, 37,
+	30, -49, -3, -46, -32, -44, -16, 43, -8, 35, 9, 2, -8, -35, -20, 6,
+	37, 29, -2, -77, -14, -30, -70, 5, 12, -27, -24, 7, -34, -15, 2, 6,
+	52, -46, 52, -3, 46, 78, 16, 26, -59, 11, 26, -26, 76, -33, -13, 2,
+	-4, -13, -30, 13, 32, 45, -5, 34, 62, -25, 26, 23, -52, 66, 40, 58,
+	-46, 2, 30, 26, 45, 20, 10, -36, 21, 47, -17, -7, -31, -18, 23, -20,
+	-34, 41, 32, 28, 7, 3, -8, -36, -57, 60, -24, -57, 6, 34, 51, 25,
+	-3, 40, 35, 24, -12, 27, -56, 4, 22, -46, -39, -23, 16, -9, -27, 15,
+	-86, 24, -14, 57, -17, 51, 66, 66, 59, 34, 56, 28, 17, 6, 40, -35,
+	-68, -4, -35, 11, 51, 30, -45, 64, 1, 19, 46, -36, 8, -5, -29, -4,
+	23, 64, -5, 36, -40, 33, 35, 36, 27, -34, -52, -70, -1, -20, 31, 30,
+	11, 70, 14, 14, 24, 2, -14, -22, 43, -58, 9, -42, -64, -57, -22, -33,
+	18, -56, 22, -19, 10, -4, -33, 16, 31, 19, -30, -34, -37, -18, -55, 21,
+	-55, -40, -49, 2, 0, 18, -39, -36, -4, 4, 31, 2, -49, -24, -41, -50,
+	-3, 67, -8, 4, -61, 41, 31, -15, -6, 1, 41, 36, 26, 18, 41, -38,
+	-25, -53, -11, -10, -47, -28, 55, 53, 38, 64, 34, 32, 60, 19, -40, -3,
+	-11, -28, -37, 49, -1, 28, 44, -21, 15, 13, 25, -13, -15, -27, 55, 55,
+	21, 39, -9, 43, 33, 8, -50, 17, 32, -45, -56, -47, 16, -3, 26, 0,
+	6, 43, -39, -54, -10, -40, -16, -40, 31, 45, 8, -36, 11, 16, 3, 40,
+	-48, -10, -24, 14, 9, 12, -34, 44, 29, -15, -26, -38, -28, 10, -2, 18,
+	-77, 40, -12, -42, 44, 40, -16, -56, -7, 14, -11, -57, 5, -5, 14, 43,
+	-18, 15, -30, -40, -12, 66, 3, -23, -33, -15, -19, -12, -39, -44, 25, 23,
+	-35, -60, 35, -14, 16, 25, 24, 33, -38, 8, -28, -48, 27, 65, 35, 45,
+	54, 40, 51, 22, -26, -6, 33, 14, 31, 12, 1, -30, -38, 29, -24, 3,
+	-22, -36, 20, -50, 5, -9, 9, -57, 26, 6, 4, 59, -35, -21, -9, 19,
+	49, -41, 23, 2, -30, -20, 4, 42, 15, -70, 23, 10, -43, -58, 27, -11,
+	3, 46, 38, -9, 75, -20, -50, 43, -45, 7, 3, 53, -31, 52, 10, -17,
+	25, -41, 7, 2, -34, -41, -31, -5, -55, -33, 49, -21, 25, 33, -6, 3,
+	-17, -35, 41, 31, -13, 17, -41, 43, 51, 61, 62, 53, -11, 22, -15, -47,
+	-43, -45, 48, -22, -63, -54, 4, -18, 24, -8, 37, -21, 48, -11, 21, 20,
+	-48, -37, -25, 23, -33, 23, 31, 42, 34, 49, 1, -39, 38, 21, 28, 40,
+	-23, 47, 8, -30, 25, -31, -11, -34, -19, -22, -62, -40, 2, -8, -19, 6,
+	21, 18, 19, 53, 3, 48, 26, -61, -18, -44, -69, -4, 39, -23, -11, -42,
+	-17, 6, 11, 51, 73, -60, -3, -13, -34, -38, -6, 0, 49, 46, 0, 41,
+	14, -56, -38, -70, -19, -14, 33, -15, -33, -6, -9, 26, -48, -10, 22, -23,
+	44, 17, 3, 2, 61, -44, 7, -8, 36, -59, -14, -28, 11, 25, 56, -33,
+	-44, 31, 19, 11, -28, 68, 50, 15, -29, -20, -11, -27, 13, 72, 31, 44,
+	13, 4, -41, -39, 13, -25, -41, -25, 2, 28, 38, 3, 44, 22, 49, -56,
+	35, -7, 25, 59, -32, -44, -43, 3, -16, -37, 30, 48, -18, -2, 19, 8,
+	-4, 16, -28, -22, -30, 78, -91, 39, -2, -4, 6, -48, -52, -36, -34, -25,
+	-43, 36, 19, 46, 50, 20, 64, 22, -24, 20, -18, 45, 23, -8, 20, -43,
+	-34, -41, -47, 68, -37, -16, -6, 45, 8, 30, 34, 44, -42, 16, -75, -19,
+	-23, -8, 50, 45, 62, -19, 37, 52, 7, -10, -3, 10, -26, 46, -11, 5,
+	33, 25, 8, 31, 63, -14, -12, -34, 64, -17, -43, -50, 8, -37, 20, 24,
+	-59, -40, -26, 32, -65, 8, -29, -22, 16, -52, 4, -21, -56, -23, -17, 49,
+	-27, 17, 63, -64, -57, 42, -1, -101, -12, -15, -38, 34, 19, -7, -27, 33,
+	-47, 42, -37, 40, -50, 103, -4, 19, 32, 30, 27, 87, -45, 3, 50, -2,
+	-32, -55, 13, -95, -37, -4, 42, 38, 38, 44, -14, 76, -27, 36, 3, -72,
+	-26, 11, 20, -26, 23, 16, -2, -1, 11, 44, -19, 59, 0, -18, 83, 40,
+	33, 34, 10, 0, -2, 52, 45, -15, -8, 39, -50, -58, 22, -36, -46, 30,
+	17, 67, 65, 40, -26, 60, -30, -13, -60, 63, 29, 40, -37, 5, -39, -59,
+	-23, -22, -1, -44, 31, -50, -14, 40, -41, -21, -65, 34, -44, 31, -45, 21,
+	-6, 26, 64, -2, 23, 7, -30, 20, -3, 14, 28, 4, -34, -22, -51, -35,
+	-9, 75, 16, 21, -51, -63, 6, -25, -48, 27, -12, -9, -24, -9, -49, 6,
+	-1, -57, -6, 60, 37, 35, 43, 0, -60, -37, -18, -57, 8, 15, 38, -65,
+	107, 42, 48, 9, 37, -13, -63, -19, -18, -37, -34, 2, 74, 44, 24, 39,
+	-6, 33, 58, -16, -11, 56, -53, 1, 24, 52, -46, -2, 3, -9, -22, -7,
+	6, 40, 6, -32, -26, 46, 43, 21, 29, 21, 42, 92, -14, 37, -29, -16,
+	-9, 18, -67, -81, 60, -40, -29, -20, 66, 12, 27, -50, 72, -48, 22, 35,
+	-10, 12, -17, -20, -30, 48, 7, -5, -34, 18, 14, -18, 96, -33, 23, 40,
+	-42, -41, -64, 72, -52, -12, 40, -44, -19, 22, 63, -45, 1, -36, 43, 36,
+	32, -53, -37, -89, 22, 35, 8, 56, 9, -49, 65, -9, 7, 19, 49, -32,
+	-73, -5, 71, 15, 38, -33, 0, 44, -15, -22, 83, -19, -10, 79, 11, 5,
+	-3, 27, 2, 0, 18, 20, -11, -24, -45, 49, 46, 49, 9, 4, 35, -53,
+	-3, 18, 27, -16, -5, 92, 44, -74, 17, -22, 30, -26, 66, -2, -18, -11,
+	19, 39, -85, 57, 32, 47, 41, -4, -73, 8, 32, 3, 80, 21, -22, -39,
+	-8, 40, 17, -38, 31, -34, 25, -8, 14, -70, 12, 35, 4, -28, 63, -44,
+	68, -17, -43, 83, -35, 16, -78, 28, 4, 5, 49, 29, 25, -53, 1, -1,
+	90, -94, 11, -5, -18, -23, 39, -60, -6, 63, -4, 35, -11, -46, 36, 0,
+	-62, 21, 68, -19, 65, 48, -4, -31, -51, -3, -58, 7, 27, -54, 23, -7,
+	-4, -19, 8, 4, 0, 51, -1, 44, -12, -31, 37, -53, -26, 20, 45, -5,
+	-9, -39, -16, 40, 20, 49, 38, -46, -37, -47, -34, 1, -15, 52, 59, -16,
+	40, -47, -26, 61, 70, 5, -35, -46, -10, 12, 58, -27, 6, -27, -54, -21,
+	37, -55, 30, -56, -22, 46, 19, -14, 33, 16, 38, -17, -28, -6, -25, -6,
+	2, -29, -7, 59, -48, 23, 54, 3, 19, 41, -44, 40, 16, -42, -21, -22,
+	-9, -41, 36, -10, 21, -4, 53, 16, 48, 13, 28, 28, 50, 4, -37, -37,
+	-14, 44, -17, 33, -48, -26, 61, -27, 49, 69, -37, 54, 52, 53, -24, 6,
+	19, -38, -25, -3, -4, -37, 4, -4, 8, -43, 56, 11, 62, 48, 12, 74,
+	25, -9, 35, 58, -2, -19, -5, -14, -23, 14, -60, -13, -24, 0, 6, 48,
+	13, -8, 8, -8, -57, -18, 62, -11, -38, 7, 39, -10, -23, -29, -35, 66,
+	58, -7, 35, 30, 25, 45, 18, 20, 18, -30, 31, -48, -13, -66, -3, -38,
+	-29, -36, 42, 62, -55, 78, 32, -48, -28, 14, -14, 24, 55, 0, 31, 58,
+	-36, 61, -21, -29, -16, 34, 47, 17, -75, 6, 43, -4, 38, 7, 52, 23,
+	-2, 30, 42, 39, 2, 43, -50, -18, 15, -38, -45, 22, 6, -19, -40, 6,
+	39, 25, -29, -95, 79, 12, 14, 42, -41, -29, -28, 18, 49, 66, 18, 44,
+	49, -30, 41, 52, -17, -1, -57, -38, 41, 16, -30, 60, -63, 6, 16, -93,
+	-22, 30, 82, 47, 47, 52, 19, -2, -14, 30, 41, -9, -54, 1, 76, -77,
+	6, 25, 2, 32, -55, 9, -13, 13, 15, -51, 4, 38, -15, 43, -32, 20,
+	15, 66, 16, -34, 51, -21, -19, -74, -23, -36, 26, 49, 34, -28, -47, 61,
+	-44, 17, 21, 44, -35, -38, 45, 54, 16, 43, 2, 0, 1, 21, 4, -28,
+	50, -4, -16, 33, 17, -19, -40, 10, -22, -38, -13, 21, -16, -10, 20, -38,
+	48, -26, 29, 13, -63, -14, -34, 42, -7, 44, 67, 65, -46, 4, 70, 6,
+	8, 8, -51, -6, -51, 43, -3, -18, 6, 54, -13, 40, 13, 20, 22, -7,
+	-8, -26, 5, 41, 46, 42, 36, -61, 63, -38, 7, 32, 36, 69, -60, 24,
+	56, 0, 0, -30, -66, -30, 29, 14, -16, -40, -24, 3, 46, 30, 24, 44,
+	-69, 23, 67, -4, -37, 33, 63, -15, 55, 89, -8, 38, 53, 13, -43, 28,
+	55, -53, -11, 77, -14, 45, -39, 21, 9, -34, -24, -31, -24, -58, -60, 51,
+	-45, -22, 41, -22, 44, 91, 63, 11, 41, 64, 19, 69, -46, -13, 19, 44,
+	-28, 43, 55, 60, 23, 28, 55, 9, -49, 66, 37, -73, -46, 19, 8, 82,
+	44, 18, -27, -69, 61, 36, 24, -13, -61, -71, -16, 53, 58, 27, 7, 43,
+	-14, 15, -28, 38, 41, 25, -66, -19, -37, -22, 23, 44, 25, 29, -47, 7,
+	6, 24, -53, -16, -15, 16, -63, 22, 76, 43, 18, -18, 34, -26, -9, 40,
+	-37, 31, 16, -48, 46, -22, -3, -1, -27, -45, -24, -10, -14, -7, 59, 8,
+	58, 35, 31, -17, 13, -19, 56, -33, 57, -4, -25, 67, 32, -27, 34, -53,
+	16, 9, 26, -22, 25, -15, -80, -7, 44, 75, -6, 27, 45, -19, 38, -26,
+	-50, -25, 18, -60, 36, -23, 33, 25, -45, 8, 19, -31, 17, -86, 56, 41,
+	24, 36, -57, 16, 10, 6, 10, -18, 27, 48, -18, -10, -57, -52, 31, 52,
+	-87, -69, 53, 38, 48, -39, 89, 35, -41, -43, -10, -3, 19, -62, -59, 16,
+	-55, 28, 18, 33, 33, 0, -53, 10, 39, -20, 17, 41, -26, 63, 8, 91,
+	43, 0, -4, 9, -43, 1, 38, -43, -86, -72, -7, 28, -50, 18, -36, 23,
+	52, -12, 4, 33, 13, 20, -32, 8, 28, -17, 21, -57, -51, 90, -6, -29,
+	25, -37, 36, -2, 46, 7, 38, 46, -55, -8, -36, -13, 8, -32, -15, -14,
+	2, 13, -7, 44, 41, 5, 6, 14, 9, -10, -21, -73, 8, 36, -21, 37,
+	-7, -23, -28, 41, 37, -41, 12, 56, -36, 21, -35, 59, -54, 30, -8, -39,
+	-36, -36, -49, -20, 49, 59, 37, 47, 1, -32, 12, -17, 49, 3, -20, -49,
+	-61, 31, 51, -27, -42, 17, 36, -5, 7, 0, 6, 26, -48, 26, -33, 54,
+	-10, -26, 6, -20, -17, -20, 27, -55, -5, -51, -18, 19, 42, 46, 27, -9,
+	38, -16, -54, -28, -42, 27, 53, -2, 34, 41, 19, 10, -2, -11, 22, -33,
+	34, -61, 14, 3, 16, -33, 31, -19, 25, -8, -42, 9, 35, -48, -50, -26,
+	43, -13, 0, -25, -17, -6, -43, -36, 17, -35, -10, -35, -23, -12, 58, -27,
+	15, -35, -27, -10, -18, -28, 64, -13, 8, -12, 59, -53, -19, 3, 50, 26,
+	42, -44, 6, -17, -5, 15, 31, 14, 14, -5, -47, -48, 27, 53, -38, -43,
+	22, -18, 56, 7, 13, 31, 43, 29, -7, -27, 26, -22, 10, 12, 2, -36,
+	15, 10, 68, -39, -7, 28, 13, -2, 27, 13, -41, 23, -6, -39, -4, -32,
+	3, 33, -42, -43, -27, 13, 49, -27, -43, 2, -33, 22, -34, 21, 7, -16,
+	27, -47, 7, 21, -53, -4, -32, 58, -27, -18, -13, -44, -5, 35, -4, 36,
+	-38, 11, 15, -7, 23, 34, -37, 53, -14, -39, 37, -30, -18, -47, 26, -20,
+	13, -19, -38, -14, 11, -56, -36, -18, -29, -6, 0, 49, 20, -8, -13, -42,
+	11, -81, -21, 39, -25, -33, 1, 53, -27, 24, -16, 59, -32, 33, -42, -35,
+	-35, 6, 39, 36, 38, 67, -24, -20, -43, -14, 13, -28, -16, -31, -1, 9,
+	-42, -40, -36, 42, 6, -23, -24, 2, 19, -16, 106, -46, 11, 70, -17, 19,
+	-2, 16, -86, 26, -18, 33, 69, -6, -34, 48, -24, -71, -10, 51, -16, 87,
+	18, 24, -27, -26, -26, 44, 32, 71, -42, 32, 16, 1, -5, -10, -42, 45,
+	-42, -34, -71, -2, -32, -3, 42, -68, 29, -48, 70, -22, 4, -20, 22, 56,
+	74, 42, -62, -30, 68, 40, 24, -48, -42, 21, 19, -28, 9, 73, -60, 35,
+	24, -5, 48, 8, -21, -23, -71, -10, 39, -47, 33, -14, 29, 11, -36, 32,
+	36, 10, 4, 19, 22, 54, -31, -14, -20, -1, 44, 78, -61, -7, -54, -31,
+	-30, 58, -33, -25, 1, 9, 63, 1, -10, 19, -4, 57, 39, 12, -2, 64,
+	11, 56, 20, -16, 38, 50, 3, -3, 40, -18, -64, -39, 11, -7, 28, -26,
+	69, 30, -79, -22, -8, -31, 74, 7, 6, 11, 36, -43, 26, 27, -12, -70,
+	-18, -45, 46, 55, 23, 12, -5, 48, -71, 35, 38, 29, 15, -1, 1, 42,
+	-50, -22, 29, 5, 29, 30, 31, 21, -16, 48, 51, 62, 47, -15, -44, 62,
+	68, 25, -2, 63, 5, -28, -58, 95, 5, 13, 8, 69, -64, -25, -26, 7,
+	21, 22, 29, -23, -27, 50, 30, 46, 12, -64, 6, -11, -72, -40, 26, 43,
+	7, -11, 27, -18, 38, -30, 12, -33, -8, -1, 32, -45, 29, -36, 41, 37,
+	23, 3, 19, 25, -30, -8, -17, -55, 53, -27, -12, -47, -10, -14, -7, 26,
+	70, -27, 50, -25, 0, -15, -51, 54, -20, -34, -4, 38, 67, -61, 2, 10,
+	-15, 44, -12, -58, -35, -18, -35, 46, 78, 31, 64, 20, -26, -9, 43, -55,
+	-49, -35, -29, 41, -15, 48, -45, 20, 43, -75, 34, 35, 48, 44, 21, -40,
+	31, 59, 44, 22, 12, 6, -23, -11, 20, -33, 17, 46, -32, 45, 22, 51,
+	-36, -48, 10, 60, -79, 66, -31, 18, -60, -17, 13, 40, -24, -5, 29, 39,
+	21, -25, 58, -9, 26, 89, 71, -53, 73, -38, -1, -20, 43, -33, 28, 27,
+	27, -5, -22, -32, 1, 32, -47, -43, 44, -33, 38, -41, 25, 18, -13, -4,
+	23, 18, 14, 20, 9, 0, -54, 7, -11, 19, 47, 24, 44, -11, -53, 44,
+	52, -35, -71, 67, 44, -26, -52, -57, 18, 31, 70, -74, -37, -13, -29, 47,
+	60, -5, 25, 2, 57, -4, 73, -23, 67, 97, -3, -7, 24, -36, -11, 64,
+	-46, -45, 2, -71, 45, -18, 26, -51, 27, 42, 0, -38, 44, -16, 19, 12,
+	-38, 34, 52, 21, 56, -41, 5, -70, -55, 14, -14, 23, 5, -58, 7, -31,
+	-1, 9, -13, 29, -3, -19, -28, 29, 17, 34, 36, 53, -24, 53, 24, 35,
+	0, -20, -10, -21, -14, -1, 10, -26, 7, -55, -4, -47, 33, 12, 3, -49,
+	64, -59, -39, -5, 58, 31, 34, 26, -48, 26, 12, 11, -53, -8, -5, 19,
+	-43, -60, 5, 12, 0, 13, 24, 3, -41, -17, 6, 43, 7, -30, -54, -44,
+	0, -10, 24, -27, -54, 17, -15, -28, -12, 30, -32, 21, -42, -14, 26, -12,
+	-9, -28, 27, -18, -60, 24, -37, -42, 6, 19, -18, 61, 33, -33, 24, -17,
+	-37, 7, 78, -5, -2, 16, -17, -9, -17, 57, 43, -13, -6, -28, 43, -12,
+	-56, -49, -43, 62, -19, -26, -26, 42, -13, -9, -66, 54, -4, -61, -71, 30,
+	-59, -59, -31, 67, -25, 25, -59, 21, 5, 29, -11, 24, -40, 45, 44, -42,
+	54, -51, 10, -46, 42, -4, 2, 52, -11, 15, -8, -25, -16, 35, 79, 9,
+	-13, 46, -49, 1, 27, -32, -51, -36, 56, -65, -26, 5, -20, 6, 6, -37,
+	37, 6, 5, -5, -27, 40, -32, 13, 20, 63, 21, 48, 42, -42, 16, -9,
+	-17, 42, -12, 32, -52, -44, -39, 17, 30, -3, 31, 56, -29, 29, 2, -49,
+	37, 31, 62, 4, 35, -28, 36, -55, 56, -53, -40, -16, 40, 12, 2, -25,
+	25, -18, 1, -15, -70, -20, -34, -7, 14, -25, -30, 12, -22, 11, 49, 21,
+	51, -30, 15, -59, 55, 11, -63, -52, -21, 5, 26, -13, 22, -29, -3, 65,
+	-7, -18, -65, 14, -38, -13, 7, -29, -5, -22, -61, 23, 34, -50, 5, -25,
+	-57, -20, 52, -3, 60, -25, 43, 28, 14, 57, 59, 15, -55, 7, 54, -44,
+	-38, 22, 54, -33, -1, 18, -4, 23, 50, -44, -14, 46, 27, 13, -60, 6,
+	44, 3, 33, -26, -36, 65, 35, 2, -43, 10, -10, -39, 19, 51, -38, -20,
+	53, 11, -48, -28, 7, 42, -46, -40, -9, 35, -13, 12, -37, -44, 78, 18,
+	20, 2, 12, 58, -22, -19, -54, 62, -45, -41, -55, -19, 22, 31, -42, 26,
+	-55, -39, 49, 11, -62, 42, 21, -43, -42, -70, 55, -11, -7, 23, -7, 88,
+	56, 41, 47, 44, 17, 40, 3, -46, -23, -38, 38, -48, 20, 5, -47, -15,
+	54, -45, -54, 59, 26, -16, 7, 42, -31, -50, 41, 38, 57, -38, 63, -22,
+	-20, 18, -48, -24, 67, 5, 27, -15, -38, -3, 16, 38, -23, -11, 13, -26,
+	18, -3, -22, -66, -36, -19, 24, 41, -34, 6, -15, 30, 12, -30, 47, -47,
+	29, 42, 21, 33, -41, 18, -51, -18, 47, -13, 12, -23, -19, -22, -17, -6,
+	29, 24, -8, -43, -32, -48, 9, 48, 37, 34, -65, -30, -15, -38, -39, 14,
+	-41, -49, -33, 39, -10, -13, -36, -13, -48, -23, 45, -61, -31, -35, -28, -8,
+	2, -13, 7, -27, 17, -8, 62, -6, 44, -49, 36, -8, -30, 20, 1, -45,
+	30, 15, 67, -26, -35, 41, -47, -17, -9, 14, 16, 34, -19, 3, 9, 39,
+	16, 35, -30, 3, -29, 19, 50, 78, -7, -12, 43, -6, 66, -40, 33, -33,
+	38, -21, 3, 20, -42, 21, 17, 18, 2, 0, 27, -12, -25, 19, 48, 38,
+	-43, -1, 19, 10, -29, 6, -30, -1, 15, -28, -27, 6, 31, 30, 73, 33,
+	51, -52, -18, -48, 2, 21, -5, -24, 85, 50, 40, -51, 8, 14, 22, -6,
+	39, 22, -68, 11, -52, -1, -32, 21, 27, -55, 9, 21, 25, 0, -47, -44,
+	48, 14, -34, -10, 44, 24, 54, -7, -45, -3, 41, -31, 15, -36, -20, 14,
+	13, 46, 28, 62, -25, 4, 14, 38, -35, 0, -11, 51, 37, 32, 41, -62,
+	11, 43, 13, 29, 35, -39, 19, -19, -22, 24, -35, -5, 36, 38, -65, -61,
+	38, 18, 53, 44, -31, 6, 52, 36, 15, 27, -3, -13, -40, -37, -32, -41,
+	-39, -3, 33, -30, -28, 18, -7, 41, 35, -25, -14, -16, 6, -32, -22, 36,
+	-26, 41, -3, 42, -21, -52, 48, -25, 37, 35, 35, 26, -42, 26, 32, -17,
+	5, 38, 35, 14, 26, 9, 36, -23, 29, 47, 33, 44, 0, 40, 28, -11,
+	21, -23, -22, 20, -22, -27, -60, -45, 12, 37, 28, -27, 38, -18, -17, 51,
+	-19, 26, 46, 11, -48, -47, -34, -11, -23, -43, -4, 20, 4, 56, 33, -31,
+	46, -47, -36, 34, -37, 47, 29, 1, -18, -21, -11, -21, -22, -50, 2, -18,
+	-31, -34, -28, -16, 27, -16, -33, 10, -44, -21, 17, 43, 1, -12, 37, 39,
+	9, 13, 63, 35, -6, 27, -18, 25, -15, -7, 28, -39, 2, 6, -29, -8,
+	-21, 52, 13, 44, 55, 18, -22, -28, 47, 30, 45, 18, -30, -15, 5, -47,
+	33, -25, -6, 1, 66, -67, -50, -30, -12, 32, -10, 51, 13, 6, -50, 57,
+	9, 25, 15, 11, -16, -47, -30, -54, -30, 42, 12, 24, -60, -12, -33, -1,
+	-24, 41, -40, -33, -8, -31, 57, 47, -45, 1, 19, 26, -2, -33, 19, -11,
+	-48, -5, 48, -8, 39, 16, 15, 27, 26, -51, -28, -12, 13, -32, 14, 40,
+	50, 2, -50, 22, 45, 27, 6, 0, -44, -25, 3, -9, -12, -13, -52, -51,
+	38, -64, -13, -11, -16, -3, -35, -32, -1, 15, -11, -43, 33, -9, 45, -43,
+	-17, -3, -63, 7, -20, -4, 11, 49, -24, 47, 4, 49, -12, -39, -30, 28,
+	-15, -9, -6, 49, -38, -28, 16, 37, -53, -30, -40, -21, -30, 3, -22, 56,
+	-3, -46, 40, 40, -29, 32, -20, -2, 25, -30, -13, -47, 21, -11, 3, -13,
+	-6, 34, -36, 38, 0, 9, -30, 27, -19, 48, 6, 26, 4, -30, -9, 3,
+	-49, 9, 35, -11, -22, 0, 25, 52, -4, 25, -28, -49, -52, -25, -11, 7,
+	47, 4, -16, 30, 47, 33, 33, 32, 31, -28, 8, -22, 36, -18, 3, -30,
+	30, -61, 54, -7, -4, -28, -24, -11, 55, -9, 37, 3, 22, -28, -44, -28,
+	-8, 55, 22, 24, -56, 23, 23, 35, -52, -37, -10, -50, -43, 40, -25, 7,
+	-66, -38, 46, -29, -30, 37, -30, -57, 44, -20, 46, -8, 22, -19, 58, 21,
+	-9, -27, -33, 46, -12, 2, 13, 40, -17, -10, -22, 28, 6, -38, 2, 24,
+	16, 37, 23, -64, -24, -66, -24, 30, -46, 31, -39, 48, -19, 27, -39, 33,
+	-12, -6, -59, -63, 11, -45, -36, 11, 34, -47, 14, -5, -3, -40, -6, 35,
+	-29, -33, -48, 53, -43, 64, -17, 45, -65, 48, 27, -37, -8, -2, -32, 23,
+	-46, -38, 34, -30, -41, 12, -44, 41, -40, 39, 39, -26, -28, 48, -43, 15,
+	-47, 7, -4, -41, -5, -43, -18, 59, 4, 73, -10, 33, -16, -31, -19, -9,
+	3, 77, 25, -57, -26, -22, -34, 24, 39, -18, 20, 15, 73, 64, 44, 68,
+	34, 87, -36, -35, -60, 26, 43, 7, -12, 86, 40, 57, -23, -29, -2, 67,
+	-51, 20, -1, -26, -59, -4, -3, 38, -38, 74, -9, -6, 20, -9, -11, -47,
+	9, -22, 59, -21, -28, 74, -35, 4, 12, -86, 52, -22, 18, 8, -26, -8,
+	28, -31, 4, -28, -38, 17, 13, 62, 26, 4, -32, 11, 50, -52, -11, 1,
+	-8, 9, -60, 96, -30, -58, 35, -18, -31, 31, -62, 31, -20, -27, -72, -42,
+	10, 22, 51, 76, -38, 7, 13, 14, 16, 31, 25, 30, -35, 31, -67, -41,
+	39, -57, -2, -40, 16, 18, -42, -22, -1, 18, -40, 58, 43, 45, -18, -2,
+	-13, 70, -34, 10, -16, -8, -29, 84, 29, 37, -62, 69, -64, -4, -8, -17,
+	3, 92, -7, 55, 47, -49, -23, 38, 15, 32, -43, 71, -8, -58, 33, 1,
+	9, 1, 62, -29, 63, 54, -41, 35, 19, -23, -6, -42, 2, -22, 52, 34,
+	3, 14, 0, -41, -57, -41, 73, 21, 33, 29, 3, -37, 13, 63, 23, 10,
+	1, 31, 59, 44, -44, 48, -20, 62, 28, -3, -40, 36, -66, 4, 75, -38,
+	57, -40, 76, -27, 42, -44, 26, 43, 4, 48, 11, 14, -34, 52, -13, -2,
+	70, 18, 60, -13, -52, -56, -1, 59, 4, 21, 31, -56, -30, -7, 5, 8,
+	-25, -41, 62, -13, -60, 3, 16, 57, 51, -47, 50, 62, -36, 50, -69, -5,
+	-6, -17, -18, -9, -2, 17, 11, -13, 31, 40, 66, 8, -11, -15, -6, -24,
+	23, -35, 47, 37, -75, 63, 26, -12, -58, -59, -2, -27, 15, -56, -21, -9,
+	26, -53, -83, 46, -11, 37, -83, 6, 59, 40, 6, -28, -11, 13, 49, 52,
+	-16, -41, 26, -3, -72, 51, 21, 2, -25, 65, 53, 29, -48, -6, -21, -53,
+	-66, -3, 8, 22, -34, -26, 34, 16, -75, 27, -55, -46, -13, 26, 3, 10,
+	-60, 46, 46, -8, 48, -32, 1, -20, -14, -31, -9, -56, -47, 40, 26, -42,
+	22, -11, -93, -1, 31, -1, 5, 50, -48, -56, -56, -28, -24, 54, 35, 6,
+	-43, 9, -8, -82, 13, 1, 41, -110, 60, 10, 51, 29, -1, 14, -65, 67,
+	-37, 27, -3, 18, 0, -24, 28, 21, -59, 35, -27, 39, -45, -28, 1, -1,
+	-73, -18, 21, 19, 30, -5, -30, -80, -18, -65, -32, 50, 16, 31, 19, 33,
+	-8, 23, -55, 24, 8, -4, 6, -4, -11, 9, 26, 56, 34, 43, 4, -49,
+	28, 53, 8, 30, 33, 56, 24, 30, 48, 26, -30, -34, -58, -20, -54, 35,
+	9, 24, 21, -44, -53, 50, -15, 25, -32, -24, 19, 27, -37, -1, -15, -38,
+	5, -1, 1, 1, -8, -8, 23, 47, -26, -38, 27, 53, -43, 17, 13, -25,
+	17, 24, -49, -28, 57, 23, 19, 2, -38, -16, -40, -9, 45, -34, 10, -38,
+	5, 26, -36, -41, 27, 3, 27, -19, 25, -4, 31, -36, -21, 42, 8, 23,
+	22, -31, 23, -24, -55, 51, -30, -41, -29, -47, -31, -11, 19, 4, 31, 53,
+	-48, -22, -14, -1, 17, -36, 32, 22, -51, 6, 30, 33, 7, 39, -20, -4,
+	-45, -4, -25, -19, -35, 10, -41, -19, -30, -2, -6, -49, 28, 46, 13, -25,
+	37, 34, -49, 35, 47, -11, -26, -21, 39, -10, 4, 27, -21, -62, 10, -50,
+	24, -52, 39, 18, 28, -51, 54, 35, 29, 8, 30, 52, 0, 6, 13, -44,
+	15, 36, -22, -42, 35, -9, 39, 16, -41, -38, 30, 43, 3, -8, 28, 27,
+	-44, -6, -43, -17, 43, 46, -19, 48, 26, -3, -51, 54, 3, -32, -7, -34,
+	-47, -9, 8, 32, -2, -27, 1, 2, 9, 31, 27, 46, -18, -3, 20, -7,
+	3, -33, -13, -45, 2, 9, 0, 46, 60, 48, 22, 17, 29, -41, 0, -18,
+	-45, -31, -23, -48, 42, -1, -4, 48, 49, -46, 38, 12, -42, 19, -8, 25,
+	-34, 13, 12, 15, 53, -13, -16, 13, 9, 35, 32, -25, -26, 7, -10, -45,
+	12, -13, -46, -16, -18, -38, -34, -15, 48, -74, 38, 33, 1, -21, -36, -66,
+	2, 13, -44, 27, 26, 17, 31, 22, 46, 5, -12, 20, -55, -45, 31, -21,
+	1, -64, -33, -5, 24, 15, -23, 22, -38, 72, -25, -21, 41, -68, -61, -25,
+	-9, 27, -6, 34, 20, 4, -23, 18, 23, 9, 29, -33, -22, 40, 41, -78,
+	-2, -5, -9, -1, 19, 38, 25, 18, -10, 7, 34, 45, -27, 23, -73, -66,
+	-49, 34, 61, -48, 6, -65, -53, 59, 32, 22, 41, 29, 39, 55, -36, 46,
+	1, 53, -14, 44, 63, 45, -9, 9, 50, 42, 31, -11, -40, 34, -3, -14,
+	4, -12, 8, 57, 19, 8, 19, -15, 5, -15, 28, 31, -2, -21, 22, -5,
+	-5, -20, 10, 33, 66, 46, 4, -9, -37, -31, -19, 27, -46, -4, 10, 50,
+	12, -60, -41, -53, 32, -3, -9, -44, -44, 57, 15, -12, -17, 29, 50, -1,
+	-49, -20, -48, 42, 38, -7, 21, 53, 39, 31, -5, 3, -24, 64, -4, -13,
+	33, -58, -26, 7, -20, -43, 7, 2, 21, 55, 19, 1, -20, -26, -27, -22,
+	-54, 40, 18, 25, -17, -34, 45, 43, 44, 35, 42, 27, -60, 6, 16, 9,
+	28, -9, -22, 24, 28, 10, 41, 53, 4, -11, 7, 20, -48, -23, -10, -8,
+	31, 3, 26, -61, -23, 21, -26, 44, -8, 7, -21, 2, -57, -28, -4, -9,
+	2, 1, 53, -31, -14, -18, 51, -21, 52, -10, -8, 71, -20, -73, -42, 5,
+	40, 60, -57, -52, -19, 24, 30, 27, 30, 46, 50, -12, 61, 41, -9, 74,
+	58, 59, 11, 25, 42, 46, 19, 10, -22, -32, 37, -15, -35, 10, -30, 0,
+	-44, 1, -38, 6, 72, 13, -3, -45, 14, 72, -65, -57, -2, -47, 40, -25,
+	38, -54, 3, 36, -58, 39, 12, -10, -11, 17, 47, -14, 54, 47, -24, -8,
+	-62, 40, 42, 33, 43, -14, -52, -40, -10, 32, 7, 55, 34, -20, 51, -52,
+	8, -13, 31, -41, 52, 31, 34, -22, -33, 45, 39, -75, -28, -41, 34, -10,
+	45, 45, 17, 35, -1, 31, -43, -3, -16, -18, -4, 52, 60, 44, 32, -14,
+	-16, 14, -33, 11, -6, 0, 33, -37, -6, 1, -22, -38, 9, 67, -46, -2,
+	-33, -53, -9, 25, -41, -17, -58, 5, 3, -26, -11, 45, 22, -40, -7, -44,
+	-43, 20, 20, -14, -8, 31, -16, 29, 0, -19, -17, 40, -34, -55, 33, 17,
+	-9, -54, 58, -43, 41, -49, -59, -36, -13, -28, 13, -3, -19, 13, -43, -29,
+	-54, -13, 54, -57, 24, -30, 32, 27, -14, -40, 18, -11, 70, 25, 8, -48,
+	-4, 39, 18, -11, -36, 32, -56, -10, -4, 15, -66, 9, -1, 7, 33, 12,
+	-6, -1, -9, -33, 80, -40, 44, -7, 8, 70, -67, -15, -57, 70, -4, -27,
+	-21, -10, 77, -11, -38, 61, -52, 50, 36, -39, -58, 45, 1, -43, -31, 98,
+	-43, -84, -13, 76, -28, 0, 13, -14, -4, -1, -16, 40, 3, -8, -39, 53,
+	51, -1, 48, 5, 23, -3, 67, 48, -28, 31, 70, -59, -22, 28, -51, 21,
+	47, 4, 20, -6, -46, -38, 7, -18, -9, 34, -45, -7, -3, -22, 13, 7,
+	14, 4, -42, 64, 4, -5, 40, 26, 73, 40, -31, -38, -70, -65, 21, -49,
+	-22, -35, 11, 0, 12, -7, -7, 45, 25, -11, -21, -45, -42, -47, -23, -54,
+	-22, -57, 9, -30, 22, -46, -23, 31, 18, 12, 3, -24, -34, 64, 22, -42,
+	-27, 98, -34, -19, 19, -60, 17, -23, -2, -70, 22, 50, 4, 16, 65, -53,
+	-71, -2, -5, 7, 24, -9, -25, -14, -3, 7, -52, 51, 26, 59, 10, -16,
+	-14, -36, -47, 24, 24, -52, 20, 0, -38, -20, -8, 29, -36, 9, 79, -32,
+	27, 17, -12, -17, -37, -9, -45, 12, 55, 24, -21, -48, 35, 3, -10, 19,
+	-22, -80, 17, -38, 14, -7, -66, -15, -10, -5, -25, -32, 71, -40, 47, 12,
+	53, -24, -19, 56, -29, 35, -48, -18, -57, 50, 42, -4, 6, 30, -50, 31,
+	-1, 38, -3, 5, -25, 72, 12, 49, -46, -32, -16, 10, -68, 15, -15, -17,
+	-39, 37, -19, 49, 17, 30, 26, -11, -58, -21, -41, -21, -27, 29, -47, 34,
+	57, -7, 21, -2, -5, -43, -25, 85, -7, -67, -39, 35, 7, 23, -43, 66,
+	-7, -20, 44, 47, -19, -39, 23, -24, -3, -25, 32, -7, -15, -33, 57, 21,
+	42, 65, -31, -58, 24, 61, 47, -21, -43, 29, -14, 38, 8, -21, -49, 11,
+	-96, 44, -14, -23, 64, -1, 24, -23, -36, -47, 12, 7, 36, -1, 43, -70,
+	47, -4, -18, -54, 16, 81, 38, -6, -45, -50, -22, -45, 54, -41, -51, 20,
+	-2, -32, -66, 81, 53, 2, -23, -18, -19, 33, -25, 48, -60, -26, 47, -9,
+	-10, -54, 11, 24, -24, 61, 26, -56, -53, 39, 47, -53, -41, -23, 42, 39,
+	-24, 20, 17, -27, -1, 25, 19, 6, -8, 36, -23, -20, 24, 56, 10, 43,
+	-7, 29, -65, 44, 63, 57, -18, -13, -15, -30, -15, 30, 32, 1, -41, -21,
+	-26, -42, 23, 28, 68, 3, -19, 61, -42, 15, 9, -57, -14, 56, -28, -13,
+	-37, 51, -4, -12, -15, -64, -19, 27, -57, -3, -59, 18, 40, 25, 69, 46,
+	11, 25, -42, 24, 55, 36, 28, -48, 24, 13, -10, -16, -4, 48, 18, -33,
+	59, 49, 10, -24, -6, 14, 43, -33, -44, -63, -10, 42, 29, -44, -46, 75,
+	47, -53, 0, 19, -15, -44, -7, -39, 19, 35, -11, -57, 38, 12, -37, -53,
+	16, 47, 26, -40, -61, -4, -51, 91, 60, -37, 1, 42, 54, -65, 27, -1,
+	1, -24, -32, -43, 23, 15, -37, 34, -9, 75, -3, -44, -14, -11, -28, 21,
+	-7, -22, 51, 45, -17, 19, 0, 25, 5, -10, 24, 21, -25, -54, 4, 30,
+	80, 38, -25, 35, -37, 12, -32, 33, -29, 43, -33, 25, -37, -23, 26, 37,
+	62, -65, 21, -3, 46, 70, 1, 10, 0, 79, 24, 16, 3, 30, 6, 77,
+	-63, -1, -38, 19, 18, 16, -24, 0, 40, -10, -46, 19, -18, -9, -17, 106,
+	-45, -43, 38, 62, 24, -14, -38, 38, 46, 22, -54, 28, -13, -35, -57, 42,
+	3, -69, 17, -34, -63, 13, 34, 14, 9, 37, 25, 53, -20, -33, 54, -44,
+	54, -42, 26, 1, 17, -65, 81, 15, -16, -8, -23, -28, 21, -9, -48, -59,
+	-16, -36, 25, 8, 41, 25, 6, 37, 29, 44, -49, 16, -7, 60, 29, -45,
+	56, -46, -7, -39, 46, 29, -3, -54, 0, 9, 44, 28, 22, -52, -25, 39,
+	-41, 62, 7, -4, 65, -10, 43, 0, -2, 49, -47, -19, 32, 12, -50, -54,
+	-18, 44, -39, -37, -2, 32, 36, -29, 37, -40, -49, 4, 30, -46, 37, 24,
+	16, 7, -22, -16, -36, -37, -40, -3, 39, -18, -41, 16, -31, -19, -17, 35,
+	-51, 39, 39, 1, -17, -15, -32, -47, -16, -32, 45, 15, -38, 14, 53, -36,
+	-13, -3, 10, -2, 38, 21, -32, -18, -19, -39, 16, -37, -17, 2, 14, 44,
+	-23, -41, 53, 8, 24, 44, -3, -56, -47, 3, 45, 33, -30, -36, 1, -46,
+	-30, 15, 41, 1, -31, 25, -32, -39, -50, 49, -28, -40, -1, -43, -2, 10,
+	19, -33, -12, -21, -6, -13, -39, -7, 0, -23, 12, 0, -14, 31, -35, -3,
+	-1, -34, -41, -4, -41, 59, -32, -18, 14, -16, 0, 21, -45, -15, 37, 53,
+	12, -23, 37, -28, 24, 41, 30, 17, -13, -24, 16, 30, -44, 43, -5, 16,
+	31, -27, 50, 18, -43, -29, -47, 47, -25, -36, 15, -19, 38, -36, -11, 25,
+	24, -23, -36, -37, -28, -4, 20, -33, -2, -12, -22, 35, 50, 31, 50, -12,
+	-17, 29, 38, -14, -6, -27, 6, -27, -29, -38, -33, -27, -22, -3, 22, -22,
+	-58, -28, 30, -12, 13, -40, -52, 21, -35, 29, -32, -9, -12, -15, -47, 24,
+	-23, -8, 3, 10, 0, 35, 19, -13, -16, -24, 2, 44, 11, -14, 35, -24,
+	61, 34, 36, 0, -4, 24, -28, -37, -46, -39, 23, 36, 18, 33, -46, -61,
+	27, 50, -41, -13, -14, -29, 18, -5, -4, 7, 28, -26, 33, -35, 3, 32,
+	-2, 47, -8, -20, -16, -3, -42, -60, -47, -47, -48, -48, 36, -35, 55, 45,
+	21, 56, 64, -9, 17, -37, 38, 58, -46, -5, -25, 41, 39, -45, 34, -33,
+	40, -10, -24, -52, -51, 9, -24, 36, 8, 55, -33, -18, 43, -49, -35, -15,
+	25, -8, -15, -13, 5, -45, -43, 37, -58, -30, -34, 4, 46, -10, -31, -31,
+	-56, -36, -44, -30, 4, -62, 59, -13, -59, 1, 17, -12, -45, 52, 59, 15,
+	-29, -28, 59, 38, 7, -45, 68, 25, -3, -52, 23, -49, 48, -58, -16, 11,
+	-4, -2, 9, -24, -47, -18, 31, -32, 1, 7, 38, 23, 10, 31, -38, -2,
+	51, 28, -3, -22, -23, 19, -41, 22, -36, 20, -5, 21, 44, -37, -35, 39,
+	36, -26, 29, -38, 62, 39, 2, 23, -5, -1, -54, 49, 23, -5, 52, -42,
+	19, -59, -25, 35, -40, 3, 57, -40, -38, 35, 26, -39, 21, -58, -57, -32,
+	-51, -37, -69, 51, -4, 22, 39, 49, 13, 8, -28, 14, 18, 53, -39, 2,
+	17, 45, -27, -42, -61, 15, -57, -36, 33, 36, -8, 1, 21, -6, -39, -47,
+	4, 26, 19, -21, 7, -25, 62, 61, 25, 27, 21, 48, 16, -36, 51, -18,
+	-16, 1, -28, -18, -39, -3, 15, -15, -16, 44, -28, -5, -28, -16, -45, -37,
+	-6, -7, -42, 26, -15, 41, -18, -17, -10, 14, 18, 8, -20, -29, -1, 79,
+	-46, 37, -20, 20, 28, 38, -37, -43, 4, 12, 33, -47, -41, -8, 29, 12,
+	4, -23, -5, -12, -41, 50, 42, 29, -23, 73, 41, 50, -26, -31, -18, -54,
+	35, -8, -38, 52, 35, 0, -67, -21, -13, -17, 60, -4, 62, 55, 12, -28,
+	-43, -42, 8, -9, -3, 35, 17, -51, 65, -17, 27, -50, -56, 20, 18, 23,
+	-10, 9, 8, 4, -34, 35, 44, 37, -10, -70, 8, -8, -39, 20, -17, 46,
+	-10, 9, 1, 18, -37, -40, 9, 69, -7, 13, -56, 50, -28, -3, 20, 33,
+	-49, -42, 13, 10, 52, 42, 30, 36, 44, 2, 66, 22, 33, 9, -56, 26,
+	-3, -6, -4, 4, -17, 16, -43, 5, 7, 51, 6, 44, 63, -35, -39, 39,
+	-13, 3, -9, -2, -1, -46, 44, -22, -32, 0, -31, 50, 71, -25, 0, 24,
+	-38, -11, 80, -69, -14, -46, 27, -58, -21, -1, 32, -73, 70, 23, 15, 32,
+	-17, -16, -23, 52, 27, 31, 42, 73, 42, -20, -18, 35, 39, -52, -44, 29,
+	-39, -68, 3, -28, 20, 18, -39, -24, 20, 31, 9, -40, 57, -29, -53, 32,
+	-15, 46, 15, 25, -25, -51, 39, -14, 51, -18, 48, 4, -46, 26, 52, 5,
+	13, -60, -49, -19, 31, 47, 17, 54, -8, -29, 20, 11, 82, -29, -71, -29,
+	-11, -68, -28, -45, -3, -37, 50, -4, 31, -28, -37, 9, -9, -20, -46, -20,
+	28, -37, 7, -29, 49, -37, 15, -23, -39, 17, 5, 7, 3, -1, -38, 9,
+	40, 41, -7, -58, -35, 14, 7, -32, 40, 14, 10, -4, -2, 38, 42, 39,
+	29, -52, 4, -38, 40, -32, 5, -33, 47, -36, 58, 3, -43, -43, -31, 2,
+	51, -41, 13, -30, -37, -29, 21, -31, -55, 37, 51, -46, 31, 35, -3, 38,
+	-17, -40, -24, -39, 63, 2, -21, -12, 30, 9, -26, -18, 34, -18, -41, -4,
+	14, -45, -36, -26, -45, 15, 27, 85, -1, -18, -29, -14, -46, -21, 11, -17,
+	17, -7, -1, 47, 20, 11, 49, 53, 42, -42, 48, 57, -40, -21, -54, 16,
+	55, 6, -63, 65, -64, 3, -38, -6, 24, -24, 3, -34, 7, -57, -33, 25,
+	-2, -48, -51, -3, 54, -63, 46, 8, -20, -26, 1, -18, -24, 26, -53, 32,
+	-39, 13, -14, 42, -18, -29, -20, -43, 34, -17, 26, -5, 23, -18, -26, 34,
+	-35, 29, -39, 59, 37, -14, -20, 26, 61, 40, 3, 24, 1, -5, -66, -31,
+	-4, -18, -6, 0, -32, -21, -46, 70, -18, -7, -50, -31, 76, 8, -13, -35,
+	-48, -7, 49, -53, -33, -55, -14, 6, -38, 20, -12, -38, -39, 23, 50, 25,
+	-54, -10, -32, -35, 20, 42, -14, -20, -33, -51, -53, 25, 19, 38, 36, -38,
+	14, -33, 11, -34, 30, 33, 52, 33, 39, -9, -13, -36, 68, 37, 17, 32,
+	1, -38, 12, -30, 32, -35, -27, -3, -15, -44, 2, 1, -38, -12, -17, 27,
+	-31, -43, 9, -9, 19, -40, -36, -38, 49, -40, -19, -36, 3, -37, 9, 69,
+	23, -7, 56, -6, 93, 42, -20, -66, 28, -30, -30, -24, -44, -3, -45, 38,
+	31, 44, 12, 3, -7, 11, 22, 47, -46, -52, -52, -40, 48, -16, -22, 28,
+	-18, -9, -26, 7, 13, -51, -38, 48, -39, 45, 15, 46, 7, -37, 13, 26,
+	17, 35, -32, 6, 77, -1, -20, -47, -54, 34, 16, -18, 14, -53, 22, 11,
+	-31, 8, -36, -41, -30, 39, -52, -60, 57, 12, 45, 0, -13, -30, -14, 4,
+	-1, -5, -33, -63, 18, -54, 14, -4, -39, -19, -14, -16, -33, 18, -14, -3,
+	10, 21, 37, -10, -22, 37, 61, 57, 28, 46, 30, 21, -43, 12, -22, 32,
+	-20, 69, 28, -44, -22, 40, -10, 3, 28, -13, -74, -3, 62, 39, -49, -53,
+	71, 52, 27, 54, 51, 52, 8, -49, 33, -55, -30, 48, 4, -16, 29, 54,
+	-28, 28, -23, 43, 26, 46, -9, -56, -53, -24, 66, -45, -16, -42, -51, 26,
+	-45, 40, -38, -51, -3, -38, -10, -27, 49, 21, 8, 11, 2, -21, 46, -31,
+	-50, 14, 44, 44, 7, 54, -6, -37, 78, 0, -10, -7, -29, -3, 42, -38,
+	49, 16, -62, 30, -6, 9, 75, -18, -39, -51, -16, 49, 16, -31, -52, 18,
+	9, 4, -54, -33, 40, -37, 15, 11, 52, -8, 3, 50, 29, 53, -34, -3,
+	-28, 33, 44, 16, -9, -35, -17, -15, -36, -12, -72, -9, 23, 7, 64, 61,
+	37, -1, 1, 13, 52, 70, -50, -34, -51, 37, -17, -38, -13, -30, -28, 57,
+	-50, -46, 51, -64, 40, -6, 25, -44, 51, -51, 0, -1, -11, 51, 58, 73,
+	13, -8, -48, -17, 52, -2, -24, 14, -34, -34, 20, 30, -14, -11, 49, 0,
+	28, -1, 15, 14, 16, -49, 11, 7, -24, -7, 24, -23, 48, 12, 44, -79,
+	35, 6, -14, 48, 46, 43, -26, -18, -13, 42, -11, 19, -55, 46, -4, -1,
+	-58, 58, 10, -4, 5, 39, 11, 27, 43, 15, -32, -42, 38, -53, -7, 7,
+	53, -47, 35, 73, -43, -24, -19, -15, 2, 50, 5, -30, 46, -37, 34, 1,
+	-11, 12, 54, 17, -12, -20, -1, -23, 37, 15, -7, 3, 11, -37, 46, 28,
+	13, -13, 42, 60, 2, -29, 2, -31, 22, 57, -32, 5, -54, 3, -53, 10,
+	-43, 28, 21, 3, 20, 14, 61, -49, 4, 20, 38, 11, -2, -7, -24, 58,
+	20, -7, 40, -56, -13, -49, 21, 16, -10, -7, -24, 22, 0, 40, -26, -5,
+	-11, 14, -16, 49, -14, 78, -20, 33, 3, 23, -24, -6, 56, 31, -20, -12,
+	10, 4, 1, 20, 34, -17, -60, -46, -26, -35, 26, -18, -9, 70, -33, 4,
+	22, 35, 46, -15, 43, 43, -73, 51, -27, 6, 50, 63, -29, 70, 21, 7,
+	7, -25, 21, -12, 7, 26, 12, 72, 14, 40, -61, 73, 48, 55, 38, 11,
+	-9, 22, 37, -45, -60, -34, -12, -24, 4, -68, -23, 69, 21, 45, 25, 67,
+	29, -34, -1, 20, 39, -43, 29, 40, -19, -25, -8, -25, 9, 32, 31, -16,
+	14, -49, 48, 68, 28, 33, -42, 10, -1, 38, -6, -2, -36, -42, -3, 53,
+	-90, -13, -8, 50, 0, 52, 7, -29, -54, -14, 45, 70, 30, 46, 37, 49,
+	16, 12, 15, 17, 69, 2, 17, -70, 0, 7, -50, -58, -40, -9, 37, -10,
+	22, -27, -23, 26, 61, -15, -40, -69, -21, 8, 27, 5, 28, 6, -42, -14,
+	53, 16, -31, 43, 1, -14, 32, 10, 3, 10, -15, -14, 57, -46, -35, 58,
+	55, -39, 37, 27, 57, -10, -45, 22, 33, 53, -40, 29, 12, 0, 8, 3,
+	8, 19, 39, 47, -38, -8, -43, 74, 0, 15, 73, 14, -86, 47, -36, -8,
+	-42, 12, -48, -8, 67, -47, -25, 37, -2, -45, 65, 8, 51, 70, -56, -21,
+	-11, -32, -37, -45, -37, 13, 75, -27, -19, 33, 64, -72, 42, -14, 27, -42,
+	-30, 8, 30, 45, 60, -33, 43, 8, -14, 33, 40, 18, -38, -15, -30, 77,
+	34, 10, 19, -22, 13, 8, 66, 53, 37, -44, 53, -20, -29, -36, -46, -51,
+	-9, -7, 10, -66, 31, 0, 11, 59, 67, 46, 40, -12, -21, -28, 14, -95,
+	21, 1, -65, -28, -56, 69, -35, 2, 23, 18, 66, 52, 85, -8, 3, 70,
+	43, -29, 75, -7, 43, 1, 16, 13, 11, -45, -7, -37, 15, -34, -41, 29,
+	42, -53, 39, 62, 19, 13, 29, 42, -1, -65, -11, -30, -57, -28, 8, 4,
+	14, -6, 49, 43, -31, -28, -21, 51, 27, -10, 32, 13, 57, -31, -48, -8,
+	36, -32, 8, 14, 54, 50, -24, -31, -30, -58, -73, 30, 31, 24, 58, -24,
+	15, -1, -43, -44, -34, -43, 19, 7, 41, -49, -50, -30, -69, 45, -6, -55,
+	19, 17, 35, 8, -29, 21, -26, -74, -33, -50, -26, 36, -8, -4, -29, 10,
+	74, 15, -77, -40, 12, -20, -64, 9, -61, -14, 45, 29, -17, 62, 43, -25,
+	9, 42, -50, -19, 9, -51, 27, -64, -33, -56, -4, 22, -11, 16, -36, -18,
+	-22, -29, -23, 8, 22, -43, -22, -16, 24, -45, -46, 42, 40, 10, 32, -3,
+	17, 32, -8, -9, -28, -9, 24, -1, 22, 25, 50, -14, 15, -34, -6, 26,
+	27, -4, -46, 16, 15, 55, 4, -2, 10, 64, -66, -43, 61, -21, 5, -30,
+	34, -40, -20, -18, 17, -15, -5, 38, -9, 26, -1, 11, 14, -4, 1, 36,
+	-38, -46, -13, 19, -34, 2, 26, 44, 5, 17, 34, 7, 50, -4, 17, -1,
+	35, -30, -71, 58, -19, 19, 36, 60, 40, 8, 20, -31, 36, -44, 27, -31,
+	-14, -15, -61, 26, -48, -43, 3, 47, -3, 6, 38, 24, 12, -3, 1, -19,
+	22, -61, -63, -19, 56, -33, 17, -39, 61, 9, 41, -19, 40, -37, -37, 82,
+	53, 47, 21, -8, 4, -46, 37, 46, 24, 40, 40, 53, -20, 27, -4, 42,
+	0, 17, 18, 0, -74, 57, 12, 4, -22, 52, 53, 48, -9, -46, 17, 5,
+	32, 14, -30, -21, 20, 63, -14, 23, -63, 28, -20, 16, -11, -31, 25, 20,
+	-3, 39, -34, -47, -50, 34, -17, -11, -36, 18, -32, 47, -9, -31, -7, 47,
+	-25, 52, -32, -57, 32, 47, -17, -7, 9, 5, 9, 34, 29, -51, 8, -56,
+	-22, 10, -16, 36, 46, -50, -34, 18, 8, 35, 2, 13, -1, -12, -44, 45,
+	63, -31, 13, 47, -23, 26, 18, 40, -4, 35, 23, -26, -18, 54, -59, 34,
+	39, 13, 45, 36, 5, 21, -6, 27, -12, 44, 22, -41, 24, -52, -17, -17,
+	49, -17, 21, 65, -5, 40, -75, 33, 32, 10, 55, -41, -1, 41, -34, 24,
+	1, -28, -71, 14, 27, -2, 33, 6, -58, -48, -54, -26, 32, 15, -2, 20,
+	10, 54, -31, 10, -49, 55, 48, 21, -8, -62, 0, -28, 12, 28, -27, 22,
+	-24, -29, 20, -17, -12, -29, 10, -44, -29, 33, -1, -8, -75, -6, -24, 12,
+	-25, 16, -2, -14, -33, 7, -17, -63, 12, -35, 39, -40, -10, 57, -79, -19,
+	49, -23, 22, 20, 8, 20, -63, 29, -22, -29, -23, 10, 45, -5, 62, -30,
+	-1, -33, -41, 20, -12, -72, 4, 27, -62, -31, 26, -10, -77, 11, 48, 38,
+	-67, 67, -36, 39, -37, 55, -11, -68, 0, -25, 48, -51, 24, -45, 46, -59,
+	24, 21, -1, -7, 24, 53, 11, 1, 52, 19, 16, 53, 34, 5, 18, -43,
+	39, 4, -23, -9, -116, 9, 66, 22, 2, -7, 0, 10, -2, -4, 23, -11,
+	71, 79, 20, 41, 24, 48, 33, 3, -27, 85, 72, 48, -49, -39, -38, 28,
+	50, 60, 68, 32, 6, 7, -1, -47, -93, 34, -7, 17, 28, 13, 4, 42,
+	38, -41, 12, -21, 10, 58, 34, -67, -34, 37, 34, 54, 11, -14, -22, 32,
+	-9, 35, -58, -43, 16, 54, -36, 32, -31, 25, 29, 33, -34, 8, -54, -46,
+	-20, 53, 19, -35, 23, 0, -44, -35, -44, -2, 44, -11, 7, 40, -35, 9,
+	12, -28, 24, 42, 21, 38, 31, 60, 21, 43, -9, -65, 23, -25, 56, 0,
+	58, 33, 9, -44, -45, -23, 3, 8, 45, -18, -3, -43, -6, -21, -4, -59,
+	5, 48, 50, 44, 5, 19, -37, -8, -37, -6, 11, -31, -26, -43, -27, 24,
+	9, -6, 51, -8, -26, 36, -16, 46, -3, -38, -18, 47, 29, -21, 33, 6,
+	54, 9, -13, 29, -10, 6, -47, -42, -8, -29, 45, 41, 2, -3, 19, -32,
+	25, -13, 33, -56, -15, 4, 36, 30, -36, 52, -4, 21, 42, -37, -30, 59,
+	49, -23, -13, 34, -4, 14, -19, -37, -14, 63, 44, -28, -6, -30, 53, 23,
+	51, 55, 28, -4, -30, 50, 27, 21, 62, -49, 27, -3, 37, -22, 29, 29,
+	-31, -46, -9, 38, -28, -42, -37, -8, 8, -26, 28, 7, 11, -21, -22, 31,
+	25, 8, 19, -7, 12, -25, -18, -37, -18, -41, 33, -13, 22, 52, 14, -34,
+	-25, -27, -31, 53, 12, -16, -31, 47, 14, -15, -1, 45, 51, 7, 55, -3,
+	-51, 51, 12, 22, -31, -1, 26, 10, -43, 19, -40, -11, -34, 43, -53, -27,
+	48, -3, 28, 15, -13, 30, 50, 32, 31, 30, 52, 19, -22, 26, 26, -46,
+	1, 35, 10, -34, -20, 30, -55, -56, 35, -47, 34, 20, -5, 49, 15, 28,
+	-11, -23, -37, -17, 1, -41, 41, -41, -9, 14, -54, -43, 51, -57, 14, -11,
+	-2, 28, 16, -3, -30, 22, 22, -11, -5, 17, -3, -37, 47, 44, -8, 23,
+	30, 11, -43, 11, -29, 10, 31, -12, 12, -3, 2, 34, 39, -21, 5, 18,
+	-14, -5, 50, -3, 7, 14, 23, -9, -30, -17, -4, -27, -8, -45, -11, -42,
+	-1, 20, -57, 40, 6, -59, -25, 20, -43, -25, -44, -43, 54, 33, 52, 11,
+	13, 11, -5, -4, -14, -23, -42, -41, -16, 7, 34, -36, -20, 0, -20, -21,
+	2, 27, -44, -9, -26, -35, 20, -4, -50, 28, -44, -23, -51, 10, 27, 30,
+	-49, -45, -9, 25, -42, 39, 28, -26, 33, -28, 25, -35, -7, 29, 35, 3,
+	2, 24, 43, -5, -21, -26, 10, -26, 4, 32, -45, 18, -3, 3, 6, -12,
+	15, 2, -49, 37, -39, 32, 29, -27, 18, 51, -17, -12, -2, 41, 5, -55,
+	25, -53, -6, -3, 9, -49, 31, 45, -27, -15, 30, -24, 5, -40, -31, -20,
+	-35, -47, 7, 48, -51, -27, -26, -33, 37, -37, -3, -1, -6, 24, -25, -51,
+	15, -43, -52, -15, -27, 13, 34, -38, -43, 10, -29, -9, 14, 0, -45, 4,
+	7, 2, -28, 46, -6, -41, -17, -42, 36, 24, 0, -5, 45, 45, -19, 1,
+	-34, -43, 69, 44, 48, 20, -52, 35, -13, -33, 20, 48, -6, 45, -4, -55,
+	12, 43, 44, 11, -39, 23, -44, 11, -37, -22, -3, -9, -21, 0, 43, -43,
+	-35, -5, 29, 28, 20, -25, -6, -32, 12, -23, 34, -16, 23, -27, 17, 24,
+	-30, -32, 19, 26, 11, -7, 1, 60, 29, 19, -18, -29, 15, -43, 27, 58,
+	10, 14, 1, 2, -6, 27, -6, 3, 13, -19, 7, -43, -28, 17, 3, -32,
+	-16, -11, -44, -48, 53, -14, -19, 38, 30, 23, 20, -20, -13, 21, 1, 30,
+	32, -8, -44, 2, -54, 37, -31, 19, 53, -10, 10, -50, -44, -15, -15, 21,
+	-31, -4, -7, -15, 19, -55, -38, 45, 11, -32, 37, -5, 68, 44, 45, -12,
+	43, 24, 3, 24, -14, 47, -21, 52, 28, 18, 34, 51, 18, -8, -17, -36,
+	39, 40, 41, -41, -5, -21, -27, 11, 17, -41, -13, -56, -39, -51, 17, 37,
+	-9, -19, -39, 62, 35, -11, -16, -1, -34, -25, -49, -47, 53, -21, -5, 29,
+	23, -34, 42, -19, -14, -47, -32, 46, 9, 29, 43, -36, -5, -18, -11, 72,
+	34, 46, -40, -30, 3, -62, -40, -36, -75, 45, -55, 1, 74, 43, 33, 13,
+	65, -9, 59, -49, 99, -21, 100, 15, -23, 42, 19, 72, 21, 6, 47, 6,
+	69, -25, 6, 4, 4, -27, 26, -7, 17, 63, -55, 15, -14, 24, -60, 58,
+	-32, 47, 0, 76, -48, -49, 33, 14, 9, -24, 1, 60, -38, -5, 0, 44,
+	51, -2, 0, -39, 28, -41, -20, 15, 57, -46, -37, -23, 31, 6, -46, 24,
+	7, 70, -45, -31, -34, 9, -75, 27, 9, 34, -50, -56, -77, 36, -11, -23,
+	-24, 8, 29, 23, 24, 1, 61, 22, -38, -29, -81, 14, 16, -32, -53, -37,
+	0, 40, -80, -54, -20, -36, 3, 20, 59, 7, -24, 10, 4, -35, 64, 33,
+	-60, 28, 51, -12, 74, 0, -2, 58, 27, 12, 15, 20, 15, 108, -17, 88,
+	-39, 62, 3, 3, 48, 30, 33, 10, 16, 38, 38, 28, 60, 41, 35, 4,
+	-26, -77, -88, 43, 56, 52, -46, 44, 75, 54, 23, -7, 39, -14, 1, 24,
+	38, -6, 17, 16, 4, -47, -55, 15, 9, -70, -33, -23, 47, 59, 10, 47,
+	-7, -58, 35, 41, -12, 42, -54, 30, -54, 28, 16, -56, 2, -18, 36, 45,
+	73, -46, 14, 50, 8, -36, 58, -3, -61, 37, 44, -34, 60, -20, 54, 33,
+	59, 28, 51, 2, 1, 40, 34, -29, 29, 56, 15, 0, -12, 12, -31, 58,
+	-20, 94, -50, -15, -4, -39, -14, -8, -22, 57, -16, 48, -43, -38, 46, 25,
+	-19, -24, 8, -100, 5, 6, 31, -14, -47, 54, -14, -58, -17, 11, -17, 18,
+	4, 51, 43, -8, 17, -53, -37, 73, 12, -22, 46, -49, -71, 14, 44, -23,
+	-13, -28, 67, 19, -27, -32, 6, -41, 13, -26, 25, 27, -28, 22, -24, 63,
+	-7, 39, 5, -36, -27, -27, -11, -19, -48, 50, 75, 15, 24, 83, 11, 2,
+	-2, -33, 7, -74, -6, -1, 21, 2, -87, -32, -61, 33, 39, 56, -62, 9,
+	-31, -62, 71, 20, -39, 22, 5, 46, 52, -32, 14, -4, -36, -43, -19, 29,
+	37, 65, -28, 44, 23, -35, 26, 29, -87, -27, -47, 13, 39, 48, -98, 55,
+	38, -14, 65, 39, -54, -41, 14, -20, 7, -32, 13, -45, 7, -10, -6, 44,
+	-44, -10, 60, 46, -17, 28, 31, 33, 56, -51, 34, 55, 46, 32, 74, 16,
+	-25, -36, 30, -57, -55, 67, -19, -66, 56, 54, 17, 4, -25, -11, 33, -47,
+	-43, -33, -28, -19, -44, 62, 8, 29, 58, 0, -10, 13, -6, -4, 88, 72,
+	42, 18, -33, -58, 10, 0, 48, -31, 10, -42, 2, -6, 64, 34, -21, -19,
+	-20, 34, -29, -11, -55, -14, -64, 12, 16, 54, 12, -40, -21, -48, 42, 56,
+	32, -57, -34, 6, 0, 26, -48, -36, 22, -24, -12, 48, -22, 46, 65, -45,
+	-7, -2, -43, 4, -53, -3, -5, -53, 21, 24, -34, -20, -32, 26, 54, -5,
+	-5, -42, 17, 36, 65, 65, -29, 16, 32, -31, 21, -45, 47, 37, -12, 41,
+	-10, -17, 43, 40, 39, -54, -7, -32, -30, -9, -26, -52, 44, -17, -14, -45,
+	11, -5, -42, 36, 6, 41, -36, 29, 47, 7, -69, 63, 20, 56, 9, 5,
+	-26, -1, 21, 39, -40, -9, 22, 56, 11, 15, 17, 21, -73, 59, 28, 55,
+	-44, 18, 62, 62, -9, 15, 32, -40, 10, -39, -15, 34, -50, -40, -2, -6,
+	-21, 61, -13, 33, 33, 58, 19, 20, 0, 28, 41, -7, -5, 10, 34, 17,
+	25, -31, -5, -36, 12, -4, -39, -37, 15, 32, -40, -31, -12, 56, -11, 4,
+	43, -5, 54, 1, 11, 43, -57, -26, 44, -20, -5, 11, 12, -57, 38, -42,
+	28, 38, 6, 6, 42, 32, -5, -26, 0, 60, 51, -8, 9, 18, 1, 44,
+	-8, 8, -21, 12, 52, 49, 22, 28, -40, -21, 15, -29, -25, -30, 34, 0,
+	-51, -14, -8, -25, 39, -16, 70, 22, -43, -50, -36, 33, 3, -35, -46, -21,
+	-4, -5, -9, 45, -41, 23, 44, -18, 57, -48, 33, 7, -29, -29, 36, 49,
+	-7, -22, -24, -3, -14, 27, -31, -35, -23, 6, -20, -45, 30, 31, 27, -30,
+	-50, -10, -9, 25, 35, -19, 38, -4, -20, 1, 17, -53, 40, -40, -22, -38,
+	43, -5, -33, 37, -16, 10, 26, -7, -24, -29, -56, 33, 6, -11, -44, 13,
+	-22, -41, 34, 23, -36, -14, 13, -15, -10, -28, -44, 10, -39, -9, -15, 35,
+	15, 13, 4, -30, -34, -26, -4, -27, -51, 2, -21, -53, 41, -33, -24, 10,
+	19, -36, -20, 5, 48, 0, -27, 16, 10, 32, -42, -19, 37, 19, -38, 32,
+	-12, 6, -42, 50, -53, -47, -53, 38, -43, -24, -18, -4, -36, 3, -3, 6,
+	-48, -16, 44, -36, 9, -34, 20, 22, -46, 39, 7, 27, 14, -1, -18, -28,
+	18, -29, 42, -35, -23, -37, -4, 20, 46, 36, -56, 24, 43, -33, -7, -19,
+	-44, 46, 45, 17, -35, -27, -8, -46, 6, -4, 35, 8, -33, 1, -12, 52,
+	-17, -49, 19, 29, -1, 27, 14, 39, 51, -36, 23, 5, 15, 8, -6, 0,
+	-30, 10, -27, 0, 1, 8, -7, -55, 15, -1, -26, -5, 28, 0, -30, -32,
+	36, 7, 14, -49, 19, -45, -23, 29, 33, -25, 14, -4, 5, -40, -21, 7,
+	31, 9, -16, -4, 1, 22, -1, 10, -59, -6, -2, 14, -39, 50, -17, -14,
+	9, -2, 35, -21, 42, 48, -6, 21, 13, 16, -18, -17, -18, -49, -56, 28,
+	-17, -34, 6, 69, 19, 6, 29, 29, -27, 16, -53, -47, -13, 5, -60, 42,
+	39, -81, 40, 39, 46, -53, -46, 17, 43, 61, 24, -21, -64, 42, 16, -49,
+	-1, -8, 67, 9, 50, -51, 3, 18, 19, -6, -43, -60, -46, 6, 1, 8,
+	-30, 36, 13, 60, 67, -28, 37, -13, -13, -9, 81, -22, 33, -38, 50, 40,
+	-36, 74, -55, 29, -40, -5, 58, -34, -16, -8, -12, -58, 47, -7, 17, -53,
+	30, -43, -26, -17, -7, 17, -12, -30, 60, 4, -46, -24, 66, -56, 21, -18,
+	-93, 16, 61, -60, -32, 78, 28, -24, 27, 28, 18, -33, 22, 28, 45, -23,
+	39, 15, 57, -30, -10, -35, -47, -32, -16, -57, -64, 26, 17, 31, -6, 28,
+	45, 53, -7, 10, 50, 14, -46, -58, 58, 21, -2, 28, -2, 8, -41, 15,
+	-22, 49, 85, 12, 37, 5, 43, 14, -47, -52, -8, 31, 50, -14, 39, -61,
+	7, -35, -18, 21, -5, -16, -48, -29, -72, 63, -40, -16, 47, -7, -17, -30,
+	-50, 5, -25, 34, 56, -49, -12, -2, -24, 62, 13, -27, -49, 14, -6, 48,
+	21, -32, -25, 4, -79, -31, -18, -21, -28, -35, 47, -28, 14, 55, -11, 47,
+	16, -66, 16, 48, -55, -34, -44, -20, 35, 33, 62, 5, 22, -33, 4, -12,
+	20, 40, 56, 50, -39, -19, -18, 17, -19, -26, -32, 58, 18, -16, 22, 50,
+	-48, 2, 35, -4, 29, -20, -39, -26, 51, -20, 13, -27, -18, -40, -45, 23,
+	-28, -11, -21, 35, 51, 4, 24, -11, -1, 12, 35, -7, 24, 16, 54, -8,
+	-18, -47, -36, -3, -27, 50, 6, 12, -41, 18, 7, 42, 40, 13, 27, -47,
+	20, -3, -42, -14, -33, 31, -33, 45, 23, -14, -16, 15, 51, 2, 43, -24,
+	18, -29, 35, -47, -3, 30, 9, -49, -23, 29, -50, -57, 47, 21, 12, -11,
+	-6, 28, 36, -21, 56, -19, -5, 16, -22, 14, -41, -55, -34, -31, 37, 38,
+	-47, -25, 38, 22, 2, -8, -40, 27, 26, -42, 55, 13, -21, -17, 1, -49,
+	22, 31, 17, -43, 6, 40, -25, -40, 9, 41, -23, 49, -49, 12, 35, -17,
+	-46, -4, 42, -48, -25, 54, 53, 48, -46, 13, 2, 0, 5, -45, 4, -3,
+	48, 10, 21, -35, 26, -24, -22, -10, -9, 14, 29, -44, 34, -25, -26, 0,
+	52, -25, -56, -42, 14, 20, -20, -23, 45, -38, 64, 47, -28, -33, 8, -46,
+	-62, -31, 32, 39, -14, -45, -31, -45, -37, -44, -10, -2, -48, 15, -3, 3,
+	46, -41, -23, -20, -12, -47, -30, -36, -10, 54, -16, -12, -36, 23, -51, -36,
+	-22, 39, 28, -21, -25, 19, 31, -34, -28, 30, 17, 45, -69, 81, 29, 29,
+	45, 2, -41, 42, -5, -28, 37, 48, 8, 70, -14, 48, -33, 67, -43, 29,
+	43, -62, 56, -57, -26, 10, 37, 27, -1, 1, 30, -14, 7, -58, 6, -37,
+	2, -39, -7, -24, -64, 37, -30, -4, -39, -12, -24, -13, -31, 62, 30, -6,
+	-24, -69, -39, -32, 32, 2, 22, -14, -21, -24, 58, -53, 39, 48, 9, -39,
+	-9, -48, 16, 4, 40, -18, -41, 3, 9, 32, 10, -22, 36, -32, -32, 28,
+	42, 7, -69, -18, 6, 36, -16, 45, 1, 39, -19, 55, -52, -31, 34, 19,
+	23, 50, 41, 49, 35, -38, 4, -4, -42, -72, 0, -39, 14, -24, -65, 30,
+	21, 4, -8, 11, 2, 8, 32, -21, -24, 79, 61, -34, -48, 2, 25, 0,
+	-24, 45, 45, 14, -34, 34, -10, 0, -8, -41, -49, 15, -32, 53, -5, 59,
+	-15, 25, 26, 34, 33, -38, 41, 13, 23, 85, 4, -18, 17, 23, -36, -14,
+	-37, 24, -32, 42, 24, -2, 2, -6, -28, -13, -63, -2, 33, -55, 37, 36,
+	10, 21, -47, 48, -29, -8, 43, 48, -18, 39, 57, -12, 14, -4, -18, 39,
+	11, 11, 48, -20, 58, -14, 20, 43, 9, -33, -34, 20, 68, -33, -49, -6,
+	26, 23, 56, 21, -38, 12, -32, -72, 25, 43, 32, -45, 4, 36, 31, -34,
+	-9, -33, -59, 4, 16, 29, 66, 11, 17, 51, 48, -40, -59, -24, -46, 55,
+	-62, -9, -18, -4, 46, 0, 68, -30, 27, 39, 41, 6, 34, -54, 16, 5,
+	9, 38, -31, -46, 2, -21, -92, -22, 28, -38, 85, -14, -41, 7, -15, -45,
+	39, 54, 8, 42, 20, 1, -34, 37, -2, -21, -49, -28, 48, 34, 24, 57,
+	4, -11, -23, 34, -31, 13, -6, -27, 34, -41, -6, 16, 52, -2, 49, 73,
+	-65, -26, -13, -17, -61, 35, 28, 91, -17, -39, 25, -61, -8, 16, 1, -40,
+	-16, -23, -45, -47, -6, -25, -39, 5, -11, 70, 54, 14, 8, 7, 64, -10,
+	5, 32, 11, -42, -14, 20, 35, -86, 48, -19, 37, 11, 8, -31, 32, -5,
+	-13, 55, -38, 53, 35, 70, -6, 1, -3, -40, -54, -14, 64, -59, -15, 59,
+	8, 1, -29, 67, 39, 8, 17, 17, 45, -15, -39, -92, -25, 23, -55, 48,
+	-12, 19, -8, 45, -57, -43, -24, 60, 23, -2, 20, 54, -39, 30, 18, 3,
+	37, 21, -22, -43, -41, -51, -24, -29, 29, -12, -18, 51, -7, 30, -22, 20,
+	21, -70, 14, -7, 37, -48, -29, 22, 3, 20, 51, 10, 5, 47, -3, 50,
+	-45, 40, -15, 8, 63, -64, 21, -24, -53, -36, 64, -38, 1, 12, 71, 48,
+	11, -29, -20, -51, 47, 21, 65, 31, 35, 45, -8, -9, 36, -4, -49, 29,
+	52, -22, -6, -15, 37, 4, 15, -1, -17, 12, 27, 25, -29, -17, 4, -9,
+	-14, -8, -6, 10, 19, 72, 39, -9, 7, 39, -32, -34, -50, 84, -30, 28,
+	-47, -34, -71, -15, 33, 51, 47, -21, -26, -57, 55, 15, -16, 42, -61, 4,
+	16, -13, -19, 85, 4, 22, 63, 56, 27, -29, -55, -48, -42, 10, -28, 8,
+	-43, -16, 8, 35, -33, -89, -38, 5, 5, 44, -48, -39, -6, 20, -33, 23,
+	5, 54, 48, 66, 17, -10, 75, 1, -54, 69, 42, 26, 7, 53, -2, 44,
+	34, 75, 25, 13, 42, 24, 69, 7, 37, -27, -10, 43, -15, 3, 35, -6,
+	-57, -36, -20, 32, -69, 18, -23, -41, 47, -23, -73, 62, -28, 31, 10, -7,
+	-18, -60, -40, 50, 62, -39, -1, 44, 34, 4, 4, -43, -36, -35, 32, -6,
+	-33, -44, 54, 15, -25, 58, -8, -20, -47, -2, 45, 37, -36, -65, -2, 29,
+	-33, -40, -28, -53, 40, 50, -65, 53, 67, -23, 9, -27, -5, 21, 3, 10,
+	51, -12, 24, 45, -19, 59, -17, 1, -57, 21, 11, -10, -41, 49, -18, -21,
+	2, -57, 30, 11, 41, 44, 0, 63, 42, -21, 4, 29, 6, -43, -20, 1,
+	35, -50, -2, 6, 26, -37, -22, 31, 68, 44, 25, 56, -44, -21, 52, 68,
+	-3, 60, -23, 19, 23, -15, 31, -57, -1, -40, 10, -27, -47, 55, 53, -43,
+	12, 46, 23, 30, 7, 23, -17, 10, 5, 38, -73, -16, -44, 23, 38, -7,
+	-9, -32, -59, 0, -18, -7, 60, -20, 12, -55, -45, -26, -21, -37, 14, 35,
+	47, 42, -24, 37, -16, -24, 28, -8, -9, 14, 48, 51, 36, -45, 10, 54,
+	-28, 53, 26, 5, -4, -14, 16, -42, 23, 52, -15, 10, 55, -8, 32, -29,
+	-35, -19, 56, -44, 23, -23, 58, -3, 27, -40, 24, -62, -21, -28, -52, -36,
+	-3, 40, -47, -9, 20, -24, -48, 56, -63, 29, -49, -31, 24, -22, -11, -54,
+	-19, 19, 41, -13, -55, -38, 50, 51, 11, 15, -60, -7, 58, 40, -11, -55,
+	-27, 21, 12, -18, -69, -12, 12, -1, -2, 0, -2, -27, -16, -3, 0, 3,
+	46, 43, -9, -40, -21, 35, -58, 34, 21, -52, -64, -29, 30, -17, -30, -52,
+	55, 31, 42, -57, 25, -52, -66, 28, -39, -25, -19, -25, 20, -13, -9, -17,
+	28, -36, -17, -30, -53, 31, 35, -17, 5, -40, -76, 61, 26, -53, -88, -26,
+	-29, -21, 9, -26, -43, 20, -51, 52, 19, -62, -24, 52, 62, -30, 79, 0,
+	37, 20, 17, 22, 26, 28, -49, 37, -13, -10, -24, -35, -49, -22, 24, 77,
+	15, 7, -37, 63, 38, 33, 3, -21, 17, 42, -37, 21, -26, -19, 73, 30,
+	49, 39, -2, -27, -8, 4, 34, 26, -3, 37, 39, 59, -45, 61, 12, 26,
+	-8, -11, 36, 61, 12, -79, -68, 10, 35, 3, -48, -2, -11, -10, -18, 61,
+	34, 24, 34, 0, 29, 47, -11, 3, 15, 7, 63, 6, -7, -50, -9, -69,
+	20, -17, -41, 30, -13, -46, -12, -56, 36, -17, -28, 86, -14, 77, -59, 22,
+	-21, -27, 36, 17, 29, -43, 15, 47, 39, -16, 3, -63, 31, 58, -18, 47,
+	29, -2, 26, 21, 65, -44, -24, 13, 24, -45, -38, 47, 22, -59, -34, -51,
+	25, -14, -22, 17, 17, -38, 72, -10, 41, 23, -43, 15, -21, -32, 23, -21,
+	39, 17, 22, 30, -50, -34, 26, -81, -28, 33, 59, 13, 5, -38, 56, 70,
+	-46, 48, 64, -29, -23, 59, -32, -14, 38, -15, -23, 17, 77, 0, -4, 58,
+	-3, 11, 26, 52, -2, 7, 35, 42, -17, 38, 60, -43, 69, -45, -53, 16,
+	-31, -34, -44, -23, 55, -58, -28, -51, 3, 47, 97, -9, 12, -16, 15, -34,
+	-17, 2, 33, 3, -21, -9, 77, 92, -20, 0, 18, -5, 10, 38, -57, -33,
+	0, 16, 34, 21, -6, 9, 6, 1, 35, -53, -11, -27, -43, 79, 12, 35,
+	3, 2, 32, -3, -2, 29, 35, 36, 10, -29, 25, -18, 33, 1, 50, -74,
+	17, 79, 2, 5, -47, -12, -24, 0, 8, 34, 12, 72, 31, 37, 16, -54,
+	3, -23, 49, 38, -39, 11, -16, 38, 2, -62, -19, 6, -48, -17, 39, -24,
+	27, 46, 43, -24, 5, -20, 21, -40, -46, 32, 7, -42, 45, -54, 11, 0,
+	-57, 6, 72, 18, 10, -9, -18, -46, -23, -47, 16, -28, 18, 56, -36, -20,
+	34, 16, -24, 49, -1, -23, 33, 3, 63, -10, -49, 15, -3, 24, -8, -17,
+	-5, -16, 30, 34, -31, -31, 5, 36, 43, -35, 30, 47, 71, 34, 14, -36,
+	51, 62, -8, 4, 16, 56, -2, -85, -34, 36, -61, -40, -44, -29, 32, -59,
+	-7, -1, 30, 7, 60, 48, 14, 30, 61, 31, -23, -21, 23, -39, -17, 34,
+	23, 73, 36, 80, -22, 63, 25, 13, -55, -67, -25, -51, -67, -21, 5, -29,
+	-63, 26, 31, 95, -35, 34, 44, -8, 74, 50, -25, 33, -7, 30, -60, -7,
+	25, -56, 42, 17, 42, 16, -12, -45, 51, -45, -60, -1, 28, 25, -34, -45,
+	13, -4, 11, -31, -58, 51, 2, -43, 5, 54, -38, 27, -9, -39, -33, 46,
+	-40, -59, -49, 9, 5, 50, 53, -16, -27, 18, -18, -11, -7, 5, 32, 50,
+	16, -10, 3, -63, 40, -27, 16, 29, -1, 42, -6, 46, -20, -1, 62, 94,
+	-44, 50, -65, 55, -26, -18, 18, -31, -24, 62, -13, 47, 2, 26, -38, -53,
+	33, 9, -16, 12, 19, 4, 45, 32, 10, -32, -14, 37, 33, -48, 39, 5,
+	35, -40, 3, 34, -12, 30, 78, -91, 42, -16, 49, 6, 47, 12, 22, 21,
+	-21, 35, 9, 27, 18, -43, -35, 10, -90, -3, 6, 19, -45, 52, 35, -26,
+	33, 27, -30, -22, -38, 4, 32, 1, 66, -23, -37, -22, -38, -24, -61, 42,
+	-46, -24, 17, 10, 22, 12, -36, -33, -18, 57, -29, -58, -22, 49, -49, -20,
+	-14, 38, -3, 21, 54, 4, 28, -16, 7, 42, -2, 5, 81, 43, -22, 27,
+	46, -13, 73, 21, -7, 40, -61, 59, 22, -37, 26, 0, -34, -45, -22, 40,
+	16, 47, -3, 31, 29, -22, 13, -64, -3, -5, 30, 53, 21, 7, -25, -9,
+	-10, 44, 34, 68, 9, 28, -4, 48, -27, -32, 52, -10, 24, -17, 65, -78,
+	29, 21, -8, -47, 49, -22, -57, 7, -2, 8, 22, -30, 37, -9, 5, -5,
+	8, -35, 50, -41, -26, 51, 7, -8, -18, 22, -10, -55, -79, 23, 9, -23,
+	-36, 21, 33, 68, 7, -2, 27, -22, 51, 32, 34, 31, 35, 24, 1, -14,
+	4, 26, 14, -55, 52, 32, 30, 8, -31, 25, 14, 6, -39, 8, 30, 4,
+	-21, -17, 16, 7, -42, -39, 0, 60, 19, -14, 46, 25, -2, 26, 61, 1,
+	-59, -27, -50, 4, -6, 19, 0, -2, -30, 59, 37, 24, 17, -37, -13, 32,
+	21, -48, -48, 11, 45, -14, 58, 63, -20, -55, -1, 51, -41, 3, 46, 16,
+	-7, -2, -15, 14, 8, 38, 50, 34, 49, 11, -14, -56, 2, 24, 53, -16,
+	4, 31, -25, -12, 28, -17, 3, -1, 59, 37, 2, -59, -33, 15, -27, -34,
+	-15, -8, -41, -55, 49, 43, -32, -31, 20, -17, -16, -20, 24, -22, -12, -1,
+	33, -25, 55, -36, -41, -8, -32, -18, -36, -21, -71, 1, -8, -49, 46, 6,
+	37, 1, 29, 35, -9, -19, 48, 43, 31, -36, 29, -25, 49, 13, -24, 1,
+	-12, 40, -21, 0, -32, -3, -28, -4, 53, 34, -30, -6, -54, 57, 45, 59,
+	2, 19, 4, 35, -37, 12, 8, 27, 43, -18, -3, 28, 4, 47, -28, -6,
+	46, -27, 12, -27, -45, 40, -43, -42, -40, -10, 26, -21, 35, -25, -8, -53,
+	6, -17, -67, 47, -64, -33, -50, -26, 15, 4, 7, 3, -33, 49, -40, -4,
+	-58, 3, 42, -38, -57, -9, -23, -30, -1, -29, -13, 2, -6, 63, 24, 35,
+	33, 4, -45, -19, 4, 38, 27, -16, -19, 13, 23, 26, -21, 12, 20, -19,
+	19, 9, -1, 68, 18, -18, -22, 1, -37, 35, -6, 43, -29, -42, 33, 33,
+	43, 34, 58, -5, 18, 6, 42, 16, -34, 39, 25, 5, 41, 29, 41, 38,
+	28, -44, 51, 28, -3, -12, 25, -1, -4, 2, 32, -28, -3, -26, 24, -31,
+	15, 17, 1, -19, -7, -22, 19, -50, 51, 0, 13, -33, -14, -24, 34, -26,
+	-34, -5, 11, -15, -22, -33, 52, -28, -16, -8, -30, -3, -37, 35, -1, 40,
+	61, -2, -18, -41, 59, 16, 7, -44, -18, 4, 36, -45, 47, -1, 47, -41,
+	55, -40, -1, 3, -8, 29, 48, -36, -15, 38, 13, 1, -25, 9, -51, 20,
+	-9, -33, -6, 26, 43, -38, -11, 21, 42, 39, -17, 22, 6, -2, 76, 4,
+	58, -60, 49, -46, 26, 33, -6, 50, 6, 8, -38, -19, -31, 43, 35, -11,
+	-32, -9, -43, -1, -13, 40, -46, -32, -15, 69, 6, 35, 12, 27, 49, 29,
+	1, -2, 24, -40, -4, -19, -27, -32, -5, -42, 37, 7, 6, 38, -65, -20,
+	8, -43, 20, -46, 60, 24, 8, 0, 56, 34, -32, -17, -56, -30, -47, 32,
+	29, 15, -41, -35, 33, -33, -21, -16, -29, 2, 23, 45, 32, 22, 46, -8,
+	1, -51, -15, -17, -23, 54, -33, 1, 50, -22, 0, -4, 6, -19, 57, -16,
+	-19, 33, 36, 25, -10, -22, 25, 15, 73, -21, 50, 54, -17, -67, -50, -27,
+	46, -16, 39, 1, 95, -55, -7, 14, 42, 14, 11, -37, -28, -19, -10, 67,
+	-21, 47, 49, -9, 47, 26, -21, 20, 44, -31, -17, 6, 15, 30, -41, 89,
+	68, -25, -24, 19, -43, -9, -18, -12, -78, 92, -39, 42, 22, -33, 1, -33,
+	-8, 49, -22, 12, 16, 17, 8, 5, 66, -31, 82, -10, -76, 72, -62, -43,
+	51, -33, 57, -88, -69, 66, -18, 45, 18, 56, -36, -22, 33, 60, 3, -16,
+	0, 8, 26, -36, 32, -66, 23, -32, -7, 39, -12, 13, -3, 52, -18, 14,
+	19, 27, 28, 14, -14, 75, -3, -26, 55, -52, -5, 19, -42, 22, -33, 71,
+	22, 1, 34, 30, -25, -66, 14, 11, 38, 0, -10, 16, 51, -34, 22, 35,
+	-17, -67, 10, -38, 7, -32, 8, -40, 28, -22, -39, -28, -22, 48, 47, -3,
+	-24, 4, -49, 59, -35, -57, -28, 84, 2, -15, 60, 33, 18, 18, -37, 34,
+	-4, -19, -17, 12, 94, 34, 1, -10, -4, -50, -44, 28, -14, -45, -11, 20,
+	-58, -69, 1, -39, 9, 67, -23, 14, 42, 14, 16, 12, 35, -36, 9, -2,
+	21, -44, -32, -38, 14, 52, 4, 78, -36, -29, 55, 23, -6, -9, -64, 76,
+	67, 60, 38, 49, 4, -37, -1, -48, 91, -46, 57, -17, 38, 60, -27, -18,
+	11, -14, 33, 1, -4, -15, -46, 9, 2, -41, -16, 52, -24, -17, 30, -1,
+	-29, -18, 46, -8, -38, -63, -23, -37, 36, -19, 38, -74, 13, -47, -56, 18,
+	2, -34, -44, -29, 36, -49, -14, -75, -28, 54, 33, -32, 20, 12, -32, -44,
+	33, 28, 46, -1, 37, 6, 45, 19, 3, 9, -51, 9, 43, 60, -31, 24,
+	-30, -49, 44, 32, -1, 24, 48, 40, -8, -32, 35, -69, -28, 16, -33, -36,
+	-4, 50, 46, -42, -7, 27, -64, -65, -20, -6, 35, 4, 33, -51, 50, -48,
+	6, -50, 49, -44, 37, -4, -10, -46, -9, -6, -32, 17, -17, 21, 54, 55,
+	54, 16, 10, -9, 31, 28, 8, 63, -4, -26, 25, 30, 28, 29, -25, -38,
+	-85, -34, 12, 15, -85, -37, 0, 57, 45, -49, -39, 38, 29, -24, 27, -59,
+	27, 24, 13, 35, -33, -35, 50, -33, -49, 24, 43, -50, 38, 14, -39, 44,
+	-46, 41, 57, 24, 24, 39, 22, 1, 8, -59, 38, -3, 26, 14, -19, -25,
+	70, 64, 11, 35, 1, -18, -17, -41, -4, -5, 5, 16, -9, -55, -6, 25,
+	-23, 59, -61, -9, -63, 8, -37, -36, -9, -32, 12, -9, 16, 65, -25, 49,
+	5, -29, 42, 15, 38, -12, -45, -59, 15, -59, -40, 55, 25, 1, -61, -29,
+	-44, -13, 49, 14, 61, 31, 7, 19, 32, 55, 44, 56, 50, -41, -28, 79,
+	46, 2, 57, 42, 18, -49, -9, -34, -13, -1, 28, -47, -34, -37, 25, -65,
+	8, -6, 5, 36, -28, -36, 11, -16, 77, 21, 31, -58, -11, -14, 63, -40,
+	48, 7, 22, -32, 25, -77, 29, -19, -37, -24, 1, 12, -39, -13, -27, -10,
+	-36, 31, 25, 23, 41, 45, 7, -45, 67, 57, 48, 14, 35, -35, -15, 3,
+	-19, -32, -39, 50, -36, -86, 64, 69, 19, 9, 39, -59, 2, 44, 13, -4,
+	50, -37, 45, -52, -42, -54, -24, -25, 45, -13, -3, -10, -45, -18, 33, -9,
+	11, 17, -7, 1, 11, 59, -25, 80, -28, -51, 41, 4, -19, 24, -21, 23,
+	-25, -29, 1, 21, -24, -41, -29, 0, -68, -8, 3, -11, -40, 13, -54, 49,
+	-10, 15, -20, -48, 42, -27, 30, 24, -9, -70, 30, 4, 47, 92, 26, 6,
+	85, -18, -1, -26, 30, -4, 40, -60, 52, 15, 27, 25, -14, -32, -32, -41,
+	-48, 66, 31, -38, -42, 10, 46, 27, 26, 44, -9, 28, -2, 24, 27, 44,
+	35, -10, -6, -7, 34, -2, 35, -12, 11, 5, -6, 56, -43, -44, -14, -36,
+	1, -36, 8, -57, 37, 65, 34, -28, -21, 48, 63, 19, -4, 6, 62, 46,
+	8, 1, 7, 30, -62, 7, 59, -39, 26, 29, -39, 78, -20, 39, -27, 23,
+	29, -15, -13, -12, -16, 33, -35, 59, 31, 3, 29, -19, 42, -21, -3, -72,
+	-27, -55, 20, -33, -40, -34, 56, 27, -46, -33, -44, -36, -8, -25, -11, 51,
+	15, -44, -31, 19, 23, 55, 8, -49, -25, 13, 17, 31, 22, 35, 30, 18,
+	32, -52, 7, 2, -47, 38, -6, 15, -6, 110, 46, -35, -7, -57, -2, 11,
+	11, -35, 44, -55, 6, -49, -46, -32, -63, 16, 41, -31, -4, -39, -31, 34,
+	-23, 33, 43, 7, -30, 16, -3, -28, 42, -63, 58, 1, -26, 44, -20, -44,
+	-40, -11, 16, -26, -47, 12, 11, 46, 38, -2, 12, -2, -37, 40, 29, -44,
+	52, 8, -11, 30, 17, -17, -4, -8, 2, 6, 9, 24, -48, -36, 22, -3,
+	20, 47, -51, 56, -59, -32, 34, 49, -2, 20, -58, -32, -9, -11, -22, -9,
+	30, -23, -27, 1, 39, -41, -10, -36, -37, 41, 1, -11, 49, 16, -21, 19,
+	-9, 60, 33, 22, 29, -44, -22, -18, -40, -47, -1, 36, -7, 4, 33, -12,
+	-21, -30, -21, -30, 5, 46, 24, -8, -13, -14, -15, 24, -1, -30, 49, 9,
+	-59, 30, 43, 39, -29, 82, 13, -3, -33, -40, -4, -7, 11, -37, -23, -59,
+	-25, -2, 5, -42, 32, -45, -35, 54, -39, 19, -7, -27, 26, 17, -35, 26,
+	8, -22, -6, 27, -11, 44, 25, -40, 42, -48, 44, 39, 17, -20, -37, -46,
+	-7, 10, -6, 32, -22, -14, -11, -29, 52, -22, -37, -20, 1, -23, -66, -21,
+	-5, -3, -31, 36, 26, -30, 34, 4, 32, 2, -22, -46, 36, -1, 37, 43,
+	43, -22, 45, -62, 54, -21, 36, -10, -36, 12, 41, -20, 66, -48, 42, -16,
+	-63, 9, -8, 17, 24, -55, -46, 38, -33, -56, -48, 3, 64, -31, -25, 18,
+	-52, 43, 17, 11, -53, -44, 36, 20, 28, 32, -20, -8, 6, -27, 51, -32,
+	27, 23, 15, 41, -42, 37, -1, -50, -40, -40, -6, 47, -14, -18, 10, -18,
+	7, 61, -34, -33, 24, -17, 35, -11, 32, -44, 2, -28, -42, 14, 8, 40,
+	10, 7, -2, -47, 6, -47, -18, 45, 23, -36, 31, -12, -32, 17, -17, -37,
+	37, -3, 14, 4, 22, 37, 26, 21, -4, 47, 39, 22, 5, -63, 34, -36,
+	34, 5, -9, -18, 36, 49, -20, 40, 37, 68, 18, -12, -40, -38, -43, 23,
+	48, 38, 38, -30, -39, 11, 45, -58, -26, -22, -24, 11, 25, 29, 55, 18,
+	9, 9, -31, -25, -48, -26, -36, -42, -18, 19, 50, -27, -16, -35, -45, 62,
+	-29, 8, -9, -46, 16, -12, -18, 14, 56, 32, 21, 60, -26, -48, 9, -15,
+	-7, 22, -12, -32, 24, -13, -41, -9, -42, -44, -13, 67, 13, -9, 4, 83,
+	-3, -35, -57, 52, -63, 43, -29, 46, 4, 0, -32, -50, -101, -12, -94, -4,
+	41, -74, 11, 1, -62, 11, 50, 17, -40, 55, -46, 36, 46, -66, 14, 39,
+	-49, 4, -3, 34, 17, 33, -28, -47, 3, 57, 23, -67, 49, 11, -63, -20,
+	5, 67, -54, 11, 31, 32, -25, 13, 0, 32, -28, 8, 61, -21, 20, -79,
+	-40, 29, 68, 28, 39, -62, 44, 8, -45, -8, 2, 0, -3, -10, -23, -34,
+	-43, -55, 27, -7, 63, 1, -43, -7, -54, 59, 34, -25, 4, 5, -52, 43,
+	30, 33, 36, -9, 62, -28, 55, 2, 42, 14, 38, 46, 14, 55, -12, -14,
+	-5, 58, 54, 64, 18, -38, 19, 3, 17, 6, -15, 68, -8, -14, 16, 65,
+	35, 43, 32, 44, 48, -73, 1, -48, 19, 3, 16, -34, 23, 66, -70, -15,
+	28, 26, 7, 66, 19, -58, -56, 16, 47, 8, 34, 56, 38, -44, 3, 44,
+	39, -44, -22, -56, -44, -32, -23, -2, -45, -6, 42, 18, 28, -57, -31, 31,
+	-31, -57, -56, -45, 0, -101, 14, -28, -32, -15, -20, -4, -21, 34, 21, 31,
+	-8, 61, -4, 8, 32, 29, 6, -54, -19, -21, -21, -29, 39, -22, 40, 1,
+	31, 41, -11, 60, 37, 18, 20, -97, -46, -1, 45, 12, 35, -5, -8, 6,
+	-13, 22, 42, -26, -46, 12, -21, 45, -3, -13, 35, -8, 36, -58, 32, 25,
+	-23, 10, 41, -53, 28, -2, 20, 47, -39, -10, -12, -20, 10, 31, -39, 23,
+	-53, 24, -13, 18, 60, 29, -44, 26, -46, -31, -30, 22, 32, 19, -43, -22,
+	19, 1, 30, 14, 13, -1, -21, 8, 20, -30, 43, -33, -8, -6, 13, 12,
+	-29, -38, 0, -21, -35, -21, 42, 43, 35, -20, -24, 24, -44, -36, 20, 43,
+	10, 29, -51, -26, -8, -22, 19, -15, -23, -39, 36, 15, 0, 50, 24, -39,
+	-18, -22, -18, 6, 35, -26, 50, 11, 14, 38, -20, 25, -6, -30, -29, -39,
+	40, -12, 53, -18, 24, 11, -48, -52, -48, -29, -2, -31, -4, 5, -52, -9,
+	-15, -2, -37, -23, -12, -14, -49, -41, -59, 19, -27, 26, 13, -8, -4, 19,
+	7, 15, -9, 14, 7, -49, -10, -23, 43, -41, 41, -37, 0, -43, -35, 30,
+	25, 21, -11, 23, -24, 44, -14, -8, -34, 4, -28, 49, 42, 22, 48, 8,
+	9, -52, -18, -13, -44, 41, 34, 32, -22, 69, 7, 44, 45, 40, 49, 36,
+	-12, -21, 46, 61, 2, -26, 4, -35, 31, -2, -24, -37, -35, 16, 20, -30,
+	-40, 38, 21, 7, 19, 6, 49, 15, -43, 11, 6, 18, -38, 48, -53, -41,
+	-33, 34, 1, 18, 8, -46, 25, -52, -47, -1, -30, -5, -12, 44, 29, 39,
+	-18, 21, 47, 49, -36, -14, 27, 54, 35, -14, -33, -6, -19, -3, -12, -25,
+	29, -43, 41, -28, -12, 12, -17, 2, 47, -33, -37, 8, -32, -21, 32, -21,
+	-36, -49, 15, 52, -22, -27, 18, 38, -28, -16, -22, -42, 32, -41, -13, 19,
+	10, 46, -10, -41, -13, 47, -17, 33, -36, 18, -1, -26, -16, -2, -11, -41,
+	-11, 4, -28, 11, 31, 33, 3, -1, 28, 49, -42, -43, 43, 8, -27, 63,
+	40, 18, 34, -37, 16, -49, -34, -49, -15, -52, 13, -19, 2, -28, 47, -41,
+	32, 29, -36, -58, 8, -28, -21, -19, -14, 17, 3, -17, -14, 24, 43, -45,
+	-13, -50, -28, -6, 57, 10, -29, 37, 18, -15, -26, -21, -13, 42, 22, -2,
+	21, -49, -44, 13, 33, 14, 47, 49, 22, 4, -20, 0, 10, -26, -19, 58,
+	26, 16, 53, 66, 13, -47, 32, -33, -27, -4, -22, 47, -22, -19, -46, 6,
+	29, -22, -6, -61, 7, -4, -42, -18, 13, 12, -49, -6, -25, 28, 45, -47,
+	-25, 45, -51, 11, 26, -23, 24, 42, 36, 15, 41, 11, -39, 9, -13, -31,
+	-53, -32, -33, 3, 43, -30, 3, -17, 9, 51, -5, -21, -45, 53, 12, -25,
+	-15, -6, 19, -17, 43, -31, 19, 39, 4, -17, 21, -8, 19, 42, -18, 22,
+	51, 60, 17, 9, -38, 15, 29, -5, 30, -51, 7, -38, 57, 33, 43, 11,
+	-33, -46, -29, 42, 48, 35, 24, 31, -14, 10, -12, -18, 44, 52, -15, -65,
+	3, -41, -3, 5, -11, -54, 47, 12, 34, -44, -1, 23, -66, 52, -63, -4,
+	-46, -31, 31, -32, 25, -5, 17, 32, 44, -52, -12, -59, 27, 38, 56, -29,
+	19, 33, 1, -19, 4, -40, 37, -40, 33, -36, 21, 55, 37, 21, 26, -49,
+	-56, -48, -27, -49, -1, -45, 12, -35, 10, 4, 59, 12, -71, -7, -45, -26,
+	5, 3, -46, -19, 14, 26, 13, -46, -24, -14, -48, 10, 53, 52, 57, -13,
+	40, 5, 37, 28, -6, -6, -2, 3, 24, 16, 7, 13, -55, -30, 36, -2,
+	-25, 53, -64, 31, -26, 44, 38, -26, 43, -4, -26, 28, 12, 21, 0, 2,
+	16, 63, -29, 8, 27, 35, 1, 13, 17, 10, 64, -48, 51, 47, -44, -1,
+	27, -41, 68, -55, 2, 5, 43, -45, -9, 48, -40, 55, -10, -14, 39, -7,
+	58, 47, -57, -6, 32, -43, 61, -4, 8, 4, -28, -55, 26, 13, -53, 33,
+	49, 42, 12, 1, 15, -51, 53, -74, -2, -10, 16, 5, -17, 11, 9, 0,
+	-3, -20, 41, -55, 7, 34, -24, 34, -56, 46, -30, 69, -65, 27, -28, -2,
+	22, 0, 52, -42, 56, -3, -32, 33, -25, 35, -16, 30, 58, 18, 24, -17,
+	-40, -36, -58, -41, 54, 13, 73, 25, -30, 37, -42, -22, -74, 52, 53, -50,
+	26, -2, 10, 19, 18, -43, 19, 28, -8, 40, 8, 35, 10, 19, 11, -5,
+	-51, 20, 29, 16, 7, -43, -35, 7, -26, -9, -26, 23, 4, -54, -11, -18,
+	69, 83, -1, 33, 40, -52, -36, -9, -10, 10, 83, -29, -5, -19, -54, 46,
+	-6, 30, -31, -7, -43, -61, -28, 49, 14, -61, -50, -3, -61, 23, 42, -19,
+	-52, -59, 21, 40, -7, 24, 36, -25, 59, 3, -46, -54, -39, 39, 42, 10,
+	41, -46, 10, 25, -2, -60, 14, 14, -43, -39, -17, -63, -24, -33, 52, 31,
+	24, -12, -16, -2, -17, -30, -50, -30, -16, -20, -40, -28, -10, 30, 20, -23,
+	44, 98, -46, -43, 25, -60, -26, 21, 20, -55, -50, -54, -8, -19, -66, -43,
+	-18, -19, -31, -1, -41, -28, 26, 48, -28, 43, 16, -18, -50, 40, -5, -15,
+	22, 30, -48, -52, -15, -59, -33, -47, -26, 12, -43, 51, 27, 29, 18, 41,
+	47, 1, 35, -20, 35, -10, 3, 57, -30, 9, 39, -2, -47, 47, -21, 31,
+	-44, 28, 6, -9, 23, -4, 30, 4, -32, -22, 15, 5, 80, 5, 40, 27,
+	29, -50, 35, 64, -48, 52, 1, -11, 39, -46, 22, -23, -22, 50, 7, 68,
+	-32, -36, -31, 9, 50, -57, -13, 23, 75, -13, -21, -56, 58, -59, 66, 19,
+	-29, 46, -47, -29, -43, -87, 15, 67, 26, 24, -39, -62, 25, -77, 0, -31,
+	-27, 41, -72, -32, -14, -46, -3, -59, -41, -9, -42, -35, -29, 4, 26, -24,
+	-66, 19, -26, -10, 43, 18, -5, 33, 62, -72, 9, 10, -4, 65, -24, 59,
+	37, -43, 37, 30, 7, 38, 32, 66, 1, 23, 26, -73, 49, 51, -3, 31,
+	64, 33, -8, 26, 6, -8, 30, 15, 12, 50, -9, 52, 92, 38, 1, 41,
+	56, 42, 22, -21, 17, 31, -22, 39, 33, 66, -21, 31, -5, 23, -70, -34,
+	-1, 19, -36, -57, 46, -50, -18, 62, -46, 27, 19, -17, 23, 26, 0, 3,
+	-39, -41, 21, -4, 29, 32, 25, -35, -11, 22, 17, -61, -37, -49, 8, -9,
+	6, 58, -2, -53, -42, -39, -16, 28, -61, -10, -27, 21, -2, 25, 44, 34,
+	57, -29, 87, 2, 3, 14, 31, -32, -41, -59, 32, 30, -38, -68, -41, -24,
+	-34, 14, 36, -2, 23, 13, -44, 12, 22, 40, 44, -51, 16, 32, -7, -2,
+	46, 32, 46, 30, -47, 65, -42, -12, -22, -4, 31, -31, 3, -43, 1, -70,
+	-44, 16, 42, 26, 21, -51, 30, 62, -12, -1, 15, -43, 33, 1, -62, -50,
+	16, 4, 64, 52, 7, -12, 32, -45, -17, -70, 55, -2, 27, 5, 26, -52,
+	38, 61, -26, 1, -13, -6, 18, 50, -39, -24, 28, 5, -42, 19, -33, 23,
+	-41, 38, 20, -33, 44, -4, -29, -39, 11, 66, 42, -23, 11, -63, 22, -22,
+	-69, 0, -4, -27, 22, 46, 31, 36, -45, -17, -36, -2, -27, 21, -39, -39,
+	-58, -15, -30, -11, -31, 5, -22, -33, -19, -54, -46, -31, 7, 73, -1, 19,
+	15, 41, -25, 12, -7, -18, -7, -39, -62, 24, -16, 47, -24, 23, 57, 49,
+	9, 47, -21, 24, 20, 9, -45, 1, -38, -11, 9, 37, -41, -10, -54, 46,
+	-30, -22, -4, 69, -19, 37, -23, 15, -47, 44, 18, -33, 18, -5, 4, -18,
+	-13, -23, -26, -35, -27, -12, 19, -6, -38, 7, 7, -29, 6, 19, 13, -29,
+	28, 2, 63, 13, 24, 22, -37, -14, 41, 47, -19, 39, 15, 29, 28, 44,
+	41, 58, 6, -56, -17, 59, 21, -53, 27, 47, -12, 25, -37, -25, -4, 29,
+	-8, -18, -7, -17, -3, 22, -41, 49, 60, 57, -32, -53, 42, -29, -36, 11,
+	21, -10, 39, 56, -18, 23, -1, 21, 7, 48, -35, 57, 16, 25, 39, -29,
+	43, -38, 46, -44, 1, -15, -23, -45, 31, -14, 33, -41, 11, 10, 20, 46,
+	22, 24, 48, -22, -28, 4, 22, 65, 40, -35, 28, 12, 58, 26, 50, 37,
+	-44, 32, 42, 11, -36, -25, 35, 69, -22, -17, 4, 36, -46, 58, 4, 52,
+	-13, -27, 17, -73, 11, -43, 21, 7, 49, -48, -15, 40, 36, -32, 39, 47,
+	38, -14, -55, 18, -28, 33, 1, -2, 16, 33, 12, 39, 69, -73, 19, -69,
+	-18, 53, 10, 10, -34, 27, -25, -60, 19, -65, 15, -5, -29, -9, -75, 40,
+	-9, -19, -26, -46, 26, 2, -49, 29, 30, -40, -59, -42, -11, -23, 10, 17,
+	-22, -1, -51, 30, -42, 34, 32, -32, 33, -11, -3, -62, 47, 27, -14, -33,
+	12, 23, 45, 31, 7, -60, -37, -14, 39, 10, -36, -17, -33, -42, 2, 65,
+	21, 32, 16, 20, 12, 27, -30, 68, 62, -51, -33, 40, 28, -53, 10, 56,
+	35, 18, 3, -14, 1, 54, 53, 46, -62, 13, 56, -2, -21, -35, -35, 15,
+	12, 18, 60, 10, 21, 29, 17, 43, 28, 31, -6, -20, 18, 46, -47, 22,
+	-16, -11, 23, 24, 45, -16, -56, 50, 2, -31, 10, 24, 5, 9, 37, -6,
+	11, -3, 42, -17, 6, 11, -16, -11, -53, 29, -73, -37, 3, -47, 4, 16,
+	21, 1, 57, 29, -56, 21, 9, 41, 42, -10, 29, 61, 7, 62, -22, -8,
+	38, 3, 48, -64, 50, -29, -13, 51, -16, -14, 11, 32, 9, 26, 65, 20,
+	20, 49, 65, -22, -63, -32, -59, -44, -42, -37, -33, -25, 54, -46, -4, -12,
+	18, -39, 54, -19, -96, -32, 55, 33, 68, 9, 67, 55, 30, -3, -47, 3,
+	59, 14, 9, -10, -16, -43, -45, 7, 2, -14, -47, -17, -17, -33, -15, -62,
+	-38, 18, 16, 15, -37, -16, -10, 8, 7, 13, -6, -5, -45, -9, 86, 2,
+	-31, -47, -43, -57, 1, -22, -40, 12, 13, 1, -19, 28, -12, -57, -21, 26,
+	36, -20, -68, -25, 27, -7, 56, 14, 20, 38, -10, 39, 52, -26, -48, -34,
+	42, 11, -13, 52, -32, 8, -7, 44, -21, -24, 7, 7, 79, -25, 56, -87,
+	-11, -35, 50, 27, 5, 2, 18, 85, -35, 46, 56, -27, -4, 10, -24, -10,
+	57, 8, 9, 51, 7, -24, 59, 4, 18, 20, -83, -31, 13, 4, -37, -41,
+	5, -1, 65, -66, -5, 4, -21, -96, 68, 13, 24, -10, -29, 32, -42, 22,
+	-58, 8, 40, -23, -15, 30, 41, -20, 46, 25, 10, -35, -56, -34, -13, 14,
+	29, 68, -21, 33, -58, -2, -7, -25, 13, 60, 53, -35, 54, 5, -12, -65,
+	-14, -32, -23, 25, 6, -20, -17, -23, 5, 58, -24, 28, -24, 23, -1, 25,
+	48, -51, -29, 29, 4, -8, -14, 17, -27, -25, 21, -42, 50, -8, -22, 25,
+	48, -35, 11, 34, 27, 20, -60, -22, -25, 14, 42, -1, 50, 44, -24, 30,
+	29, 42, -14, 27, 14, -7, 5, 10, -45, 38, 15, 14, 25, -19, 21, 11,
+	52, -3, 12, -48, -38, 60, -43, -30, -57, 16, 24, 55, -55, -13, -40, 18,
+	27, 24, 54, 31, -12, -20, 53, 65, 43, 37, -40, -59, 43, 56, 44, 35,
+	5, 31, -33, -37, 73, 0, 22, 36, 44, -30, -31, 12, -25, 28, 4, -28,
+	3, -46, -3, 23, -70, 15, -46, 7, -15, -7, -43, 18, 31, 8, -18, -17,
+	6, -2, 45, 49, 37, 11, 25, -4, -30, -26, 24, -47, -40, -3, 50, -37,
+	17, -9, 16, 1, 15, 17, -41, 40, -45, 21, -16, -31, -37, -46, 6, 46,
+	-12, 18, 8, -30, 11, 27, -36, -35, 58, -66, -3, 32, 20, -28, 30, -5,
+	60, -23, 25, 8, 30, -35, 10, -13, 45, 34, -48, -1, 17, -36, -54, 29,
+	-9, 3, 41, 9, -53, -8, -13, -1, -51, -19, -54, 76, 11, 0, 55, -8,
+	-18, 28, -24, -34, 9, 4, -7, -42, 33, 41, -9, -20, -20, -59, 36, 5,
+	-13, 57, -18, 37, 7, 13, 5, 29, 13, 23, -25, -47, -51, -34, -33, -58,
+	-13, -6, -35, -23, 27, 41, -67, 7, -46, -47, -18, -37, -6, 45, 45, 35,
+	23, -39, 0, -9, -16, -17, 70, -54, 27, 21, -10, 73, 21, 13, 17, 63,
+	27, 52, -8, -3, -67, -18, -77, 4, -28, 11, -31, 0, 68, -7, 41, 49,
+	68, -3, 16, -9, 41, 4, -32, 3, -30, -72, 15, 14, -43, -37, 13, -51,
+	-27, -70, -8, -36, -24, -4, 2, -8, -43, 33, 2, -17, 37, 8, -9, 82,
+	51, 43, 59, 9, 26, 21, 3, -25, -28, 36, -12, -11, 19, 3, -58, 2,
+	54, -30, -28, 12, 74, 29, 55, 11, 41, 37, 29, 15, 25, -24, 75, 2,
+	-8, 15, 27, -38, 36, -45, -22, -1, -64, -22, -45, -35, -25, -26, 25, -67,
+	45, 24, -17, 44, 31, 8, 65, 26, -34, -55, -13, 51, 47, -2, 47, 1,
+	10, 15, 20, 1, 38, 20, 4, 62, 11, 32, 56, -13, 12, 42, 8, 48,
+	37, 14, -26, -10, 34, -2, 92, -24, -49, -17, 66, 39, -10, 38, 33, 14,
+	30, -24, -72, -31, 11, 37, -32, -37, -65, 31, 46, -40, -45, 24, -48, -47,
+	75, -41, -69, 32, 12, -37, -20, -29, 18, 40, 69, 28, -20, 34, -4, -24,
+	12, 71, -5, 65, 17, 40, -31, -73, 60, -31, 11, -42, 4, -50, -72, 55,
+	68, 23, -13, -2, 30, 45, -8, -25, 41, 63, 39, -8, -29, 1, -39, 0,
+	44, 64, -6, 39, 40, 23, -7, 18, 58, 2, -35, -35, -61, -10, 33, -37,
+	20, -53, -14, 37, 5, 47, -39, 16, -27, -65, -42, 17, 36, 20, 19, 33,
+	51, 18, 58, -17, -34, 47, 53, -35, 45, 58, -12, -42, -51, 4, 29, 17,
+	16, 38, -38, -22, 46, 10, 33, 42, -24, 21, -42, 36, -55, -47, 28, 41,
+	55, -23, 10, 28, 100, -48, 22, -11, 13, 1, -5, 1, -40, -59, 54, 77,
+	-21, 62, -34, 34, -6, 20, 34, 63, 40, 50, -24, 30, 62, -22, -17, -66,
+	-30, -27, 16, -4, -7, -43, 3, 24, 2, 74, -30, 23, 27, 0, -53, -2,
+	24, -49, 33, 47, -54, -9, -27, 0, -26, 41, -40, 16, 52, -41, -19, -24,
+	39, 19, 53, -27, -35, 57, -15, 27, -41, -12, -7, -41, -37, -19, 73, -39,
+	25, 59, 13, -17, 19, -5, 3, 17, 2, 5, 51, -66, 30, -7, -11, -44,
+	20, -48, 61, -54, 38, 34, 47, 7, 19, 52, -10, -32, -46, 14, -49, 15,
+	-35, 44, 30, 8, -14, -15, -7, -2, 46, 42, -7, 15, 9, -31, 31, 22,
+	-38, 38, -26, -9, 34, 7, 26, 19, 30, -32, -52, 10, -18, -40, 55, -17,
+	-13, -17, -14, -37, 14, -59, -55, 41, 63, 1, -4, 20, 31, -22, 58, 28,
+	-14, -37, -46, -81, 40, -34, -30, 43, -35, 84, -14, 39, 19, -42, 22, 14,
+	-3, -46, 40, 38, -23, 10, 42, -33, 36, 18, -46, -16, -21, 0, 6, 38,
+	-21, -43, -10, 37, 22, 25, 13, 56, -47, 7, 15, 1, -39, 50, -23, -45,
+	43, -37, -20, -6, -13, 3, 7, 17, 7, 35, -40, 40, -10, -52, -48, 48,
+	28, -14, -11, 19, 28, 58, 25, -51, 26, -56, 14, 3, -43, -25, -13, 19,
+	-33, 31, -11, -5, -16, 28, 18, 41, 3, -29, 62, -44, -26, 44, -28, 3,
+	3, -33, -32, 8, 30, -54, 20, -49, 9, 44, -44, -2, 19, -29, 47, -4,
+	17, -33, -34, 53, 45, 3, 27, -43, 2, -10, -48, 18, 25, -44, -31, -49,
+	19, 6, -10, 6, -18, 18, -13, 22, 0, -36, -60, 7, -41, 0, 12, 40,
+	-17, -30, 54, -31, -48, -11, 2, -36, 33, -28, -19, 27, 27, 34, 20, 40,
+	-33, 39, -36, 34, 38, 10, 14, -42, -17, 28, 49, 29, 29, 8, 8, 2,
+	-22, -47, -39, -44, 4, 15, 10, 3, -36, 59, 13, 47, 18, 9, 46, -55,
+	45, -18, 47, 45, 66, 29, -43, 16, 20, -45, -32, -13, 38, -15, 61, 2,
+	-25, -22, 58, 37, -21, -8, -9, 19, 39, -43, 1, 4, 21, 41, 3, -13,
+	-10, -19, -34, -41, 47, 4, -3, 10, -40, -2, -11, -48, 41, 45, -37, 33,
+	-2, 19, -3, -24, -25, 22, -20, -47, -24, 61, -65, 67, 67, -2, 75, -48,
+	-18, 40, 22, 47, 0, -6, -1, 24, 2, -10, 31, 10, -72, -8, -76, 13,
+	14, 3, -26, 28, -52, -17, 17, 63, 50, 1, -34, 26, -25, -39, 20, 42,
+	-5, -50, -18, -43, 33, -28, 55, -15, 12, -6, -47, 21, 5, -42, 39, -50,
+	-20, -5, 24, -44, -30, 45, -21, 27, -2, -30, 17, -5, -12, -56, -55, 40,
+	-52, -40, 25, 57, 18, -5, 64, 36, 41, -57, -12, 33, -36, 17, 39, -48,
+	2, 22, -17, 23, 16, -55, 17, -34, 45, 14, -23, 21, -24, -15, 10, -34,
+	20, -25, 65, -27, 16, 27, -28, 7, -15, 49, 12, 40, -15, 27, 45, -30,
+	63, 12, 25, -45, -53, 33, 21, 14, 29, -40, 41, 42, 39, -22, -34, -22,
+	-11, 54, 22, -12, 21, -14, 27, 19, 0, 29, -44, 38, -22, 17, -34, -33,
+	47, -15, -54, 41, 44, -49, 29, 31, -3, 10, 0, 24, 28, -8, -14, 41,
+	-47, 12, 44, -11, 5, 40, -5, -1, 39, 42, 25, -8, 29, -25, -51, -19,
+	48, 31, -16, -22, -55, -38, 14, -9, -11, -22, -19, 45, 59, 17, -13, -25,
+	2, -9, -23, -17, 14, -26, -38, 26, 11, 56, -14, 41, -19, -13, -24, 64,
+	78, 14, 43, 17, 27, -21, 9, 59, 28, 67, -54, 59, 64, 41, -8, -29,
+	24, -15, -33, -28, 15, 49, -34, 68, 39, 12, -6, -6, -10, -13, 21, -5,
+	-44, -31, -65, -32, 49, 36, -34, -65, 9, -67, -49, 42, 34, -1, -10, 36,
+	31, -12, 21, -42, -58, 58, 80, -74, -25, -27, 12, 4, 71, 54, 5, -6,
+	27, -46, 23, 44, 27, -64, 41, 25, 14, -39, -56, 10, -5, -26, 19, -18,
+	-4, 53, 28, -69, 39, 21, 40, -26, 27, 52, -12, 13, 39, 8, 47, -59,
+	14, 19, -21, -52, -21, -28, -75, -38, -23, -44, 18, -30, -24, 36, -38, 2,
+	12, 64, -14, 58, -43, 13, -61, 33, 35, -56, 1, 26, -40, 38, 54, -9,
+	-20, 3, 6, 79, -17, 62, 69, -15, -20, -23, 26, 23, -73, 1, -14, 56,
+	9, -24, -46, -7, -77, -37, 55, 94, 27, -23, 33, -57, -43, -32, 2, -42,
+	12, 70, 4, 37, -35, -18, 87, 49, 42, -39, -45, -10, 29, -89, -11, 55,
+	-20, 2, -13, 25, 37, 21, -18, 9, -22, -33, 46, -27, 28, 34, 74, 78,
+	77, 27, 18, 10, -101, -40, 52, 15, 31, 17, -56, 59, -33, 36, 56, 34,
+	57, 33, 48, 72, -4, 56, -48, -53, -57, 10, 74, -37, 86, -39, 8, -68,
+	66, 27, -19, 39, -31, 0, 35, 75, -38, 23, -60, -18, 5, 18, 19, -32,
+	40, -2, -17, -20, -39, 3, 49, -52, -39, -12, -24, -53, 9, 0, 56, 46,
+	52, -40, -46, -2, 56, 22, 0, -2, -12, 28, 15, -24, 50, -16, 27, 72,
+	-9, 49, 27, -37, 2, -4, -35, -24, 59, 61, 37, -34, -24, 2, 17, 23,
+	18, 38, 60, -23, -24, 30, 10, 32, 41, -32, -27, 6, 12, 47, 3, 51,
+	-4, 1, -40, 30, -45, 7, 43, 25, -6, 2, -42, -17, -28, 37, 30, 33,
+	68, 62, -72, -5, -48, -34, -20, 3, -14, 19, 18, -6, -34, 14, 74, 56,
+	-35, -38, 41, -62, 32, -1, -6, 5, -34, 56, 40, 40, 21, -64, -54, 43,
+	-5, 6, 5, -20, 75, -37, 20, 38, 17, 10, -17, 11, 7, 56, -33, 44,
+	29, 19, 82, -52, -3, -50, 25, -72, 44, 42, 46, -34, 11, 10, -38, -10,
+	51, -32, 1, -5, 60, -15, 31, -31, 19, -27, 7, -58, -1, -24, -30, -55,
+	26, 25, -66, -80, 21, 11, -27, 16, -30, 43, -12, -6, -19, -36, -49, 28,
+	-5, -40, -31, -12, 20, -13, -7, -47, -23, -23, -24, 57, -35, 28, -53, 20,
+	8, -1, -52, -28, 27, -37, 69, 9, -30, -13, 78, -21, 82, 22, -52, -3,
+	44, 33, -12, -40, 30, -28, 9, -19, -52, 10, -24, -62, 2, 0, 1, -40,
+	20, 58, 4, -40, 26, 12, -1, 15, 23, 59, 36, -8, -63, 43, 8, -10,
+	32, 13, -11, -67, -74, 14, 2, 3, 27, 53, -10, -3, -63, -16, 10, 32,
+	-12, 4, 36, 0, 0, 55, 11, 22, -21, -27, -13, 40, 31, -24, 30, 70,
+	85, 35, -66, 55, 25, 31, 4, -3, 4, 60, -33, 1, 66, 47, -40, 24,
+	-32, 15, 5, 1, 19, 16, -27, -20, -44, 16, -37, 8, 30, 62, -48, 26,
+	-51, -45, -42, 14, 43, 25, -22, 1, -23, 52, -37, 58, -30, 44, 38, -9,
+	34, 18, 39, -18, -29, 24, -24, 44, -48, 83, 34, -43, -41, 41, -17, 45,
+	-16, -22, 31, 27, -6, -55, -13, -18, -43, -47, -28, -29, -9, 65, -30, 21,
+	-20, -13, 32, 64, 9, 37, 7, -2, 75, 23, 50, -16, 43, 39, 46, 1,
+	-9, -21, 54, -6, 36, -45, -1, 31, -37, 5, -53, 48, -63, 13, 9, 47,
+	-28, -7, -24, 0, -37, 34, 24, 71, 78, 25, -11, 13, -18, 48, 36, 46,
+	9, -19, 23, -54, 55, 30, 20, 53, 28, -10, -12, 64, -63, 79, 22, -31,
+	60, -58, 20, -20, 34, 23, -12, -38, 48, -15, -33, 31, 14, -53, -31, 9,
+	19, 24, -25, 103, 24, 13, -47, 35, 6, 65, -58, 32, 2, -1, 37, 0,
+	13, 32, 49, -14, 71, 45, 58, -83, 11, -8, 21, 6, -48, -11, 46, -1,
+	31, -28, 34, 36, -2, 58, -35, -33, -23, 40, -9, 4, 18, 2, -18, -43,
+	-6, -26, -54, 16, 39, -14, -23, 15, 42, -40, -17, -47, 40, 32, 27, 2,
+	-25, 1, -22, 6, 36, 27, -41, -47, -17, 46, 57, 31, -29, -24, 16, 52,
+	28, -20, -40, -12, -29, -17, 40, 46, -14, 39, 13, 15, -41, -33, 11, 32,
+	-45, 55, -12, -6, 55, -9, -1, 32, 21, 17, 42, 9, -18, -5, -1, -27,
+	30, -52, -9, 38, 19, 34, -42, -29, 59, -38, -2, -27, -55, 47, -42, 18,
+	-16, -41, 50, 18, 10, -29, -1, -8, 46, -9, 1, 2, -13, -24, 37, 30,
+	62, 3, -36, -19, -25, -58, 36, 56, 14, -21, -56, -5, 3, 20, 59, -52,
+	-48, -30, 1, -45, 12, 68, -41, 16, -4, -48, -18, -39, 30, -9, -38, 13,
+	75, -2, -23, -32, -31, 14, 14, 5, -3, 15, 18, -29, 0, 26, -44, -50,
+	4, 54, -35, 54, 26, -46, 47, 44, 19, 42, -17, -9, 15, -49, -1, -15,
+	37, -44, 63, -67, 35, 6, -3, 20, 10, 48, -16, -44, 48, 28, -44, -20,
+	-33, 49, 48, 11, -37, -18, 80, 53, 0, -4, -45, -34, -25, -28, 6, -32,
+	10, 9, 13, 28, -16, 39, 25, -39, 15, -7, -22, -22, 62, -30, -33, 9,
+	2, 4, 42, 69, 46, 14, -33, -20, -65, -26, 35, -8, 18, -15, -29, 51,
+	12, 28, -45, -24, -22, -2, -10, -107, -54, 0, -15, 39, -45, 42, -9, -55,
+	-26, -4, 17, 50, 43, 51, -45, -19, -50, 5, -1, -1, -43, 15, 44, 35,
+	66, -35, -52, 39, 45, 110, -27, -27, 20, -68, -5, 52, -54, -32, -21, 47,
+	-6, 111, -20, 25, -14, -27, 33, 20, 45, -22, -6, -56, -23, 25, -83, -25,
+	-19, -14, -5, 15, 69, 17, 41, -11, -27, 51, 24, 57, -15, 25, 67, 38,
+	-59, 19, -12, -9, -75, 48, -38, -34, -29, 103, 5, 84, -27, -36, 4, 4,
+	20, 61, 12, 7, 37, 53, -18, -50, -11, 91, 71, -28, 14, 54, 89, -87,
+	-3, 24, 7, 18, -40, -29, -41, -79, 57, -26, -43, 0, -17, -41, -45, 63,
+	67, 13, -24, 60, 44, -80, -19, -5, -30, 78, -34, -51, 22, 5, -26, -37,
+	2, 41, -14, -57, 44, 71, 14, -7, 28, -19, 28, 19, -30, -22, -34, 20,
+	31, 30, -61, 4, -45, 16, 7, 10, 66, 2, -22, 32, -5, -35, 22, -54,
+	40, -9, -50, -29, 21, -1, -1, -9, -63, -50, 16, 23, -7, 52, 10, -11,
+	1, 56, -19, 8, -12, 68, 27, 25, -55, 79, 48, 48, -19, 14, -45, 14,
+	-6, -19, -45, -1, 0, 82, -48, -21, -3, 46, 11, 29, -42, -53, 40, -23,
+	41, -4, -4, -36, -29, 6, -6, 38, -29, 9, -40, 26, -13, 25, -34, 24,
+	28, 19, 41, 1, -3, -42, -1, -10, 41, 25, -2, -50, 34, -41, -24, -3,
+	-3, 42, -7, 17, 24, 3, -14, -42, -22, 30, -50, 23, 15, -52, -12, 12,
+	53, 49, -22, 32, 70, 34, -41, 28, -24, 13, 28, 17, 40, -25, 36, -8,
+	2, 49, -20, 40, -33, 28, 30, -3, 11, -36, 46, -36, 46, -47, 34, -60,
+	55, 7, 0, -19, 37, 21, -17, -23, 14, 43, 80, 0, -33, 17, 29, -6,
+	35, 1, -11, 10, -16, -26, 37, 5, -12, -31, 28, -29, -26, 35, 25, 32,
+	-40, -50, 45, -3, 42, 23, -25, -31, -59, 14, -21, 29, 22, 28, 28, 17,
+	-55, -5, -19, 50, 39, 57, 17, -38, -4, -49, -3, -14, -34, 47, 19, -17,
+	-1, -40, -14, -30, 29, 30, 58, -49, 20, 20, 42, -20, -20, -3, -40, -30,
+	-28, -15, -43, -23, 32, 11, -47, 11, -49, 20, -40, -26, -52, -7, 32, -10,
+	63, 53, -41, 67, 11, 58, 1, 11, -4, -18, -35, 6, 20, 26, -6, 24,
+	-4, -55, -30, -38, 62, -3, 33, 48, 17, 21, 20, -47, 17, 42, 48, 12,
+	38, 9, -46, 17, -8, 4, -70, 20, -12, 12, 41, -30, 5, 52, -23, 53,
+	38, -34, 40, -69, 57, -4, -7, -41, -19, 16, -7, 20, 22, 71, 15, 21,
+	-30, 1, -23, -23, 9, -47, 29, -8, 38, 53, -19, 26, -1, 11, 27, -100,
+	-19, 25, -45, -55, 40, -37, -53, 0, 37, 31, 13, -56, -23, -68, 56, 24,
+	-17, -36, 27, -23, -22, 27, -23, -12, 5, 24, -48, 17, 68, -30, 33, -30,
+	47, -12, 40, 2, -6, -30, 69, -37, -14, -22, 93, -39, -14, -105, 81, -46,
+	46, 22, 39, 34, 29, 2, -18, -59, -34, -20, -39, -70, 14, 5, -71, 26,
+	56, -89, 30, 66, 38, 23, 78, -9, 4, 97, 7, 14, 41, 5, 46, 10,
+	-6, 56, 18, 3, 50, -50, 11, 53, -10, -7, -65, 45, -74, 32, 45, 12,
+	-60, 10, -46, -33, -23, 69, -1, 48, -40, 57, -31, 39, -7, 16, 11, -1,
+	-12, 20, -45, -65, 28, -32, -29, -25, 50, 24, 59, 62, 77, -75, -74, 52,
+	11, -61, -1, -21, -5, 63, 25, 9, 14, -78, 46, -86, 4, 7, -52, -32,
+	-37, 45, 52, -9, -25, 19, 33, 30, 0, -21, -25, 78, 2, 39, -36, 57,
+	8, 46, 11, -48, 25, 26, 10, -5, -16, -24, 12, -68, -3, 39, -16, 77,
+	11, -41, -65, -39, 68, -5, -33, 2, -22, -58, -77, -29, -32, 1, -33, 7,
+	48, -90, -61, -49, -39, -38, -52, -13, 8, -14, 17, -31, -22, -29, -22, 10,
+	22, -35, -19, 22, 20, -11, 5, 4, 20, 37, -34, -51, 1, -34, 42, 30,
+	30, -45, -29, 19, -11, 17, -36, 7, -42, 51, -42, -38, -22, -59, -33, 19,
+	-5, 3, 26, -32, 16, 39, 27, 9, 19, 19, -26, 31, -15, -51, 34, 49,
+	-39, -33, 41, -33, -48, -33, -4, 54, 32, -26, 19, -5, -2, 40, -15, 15,
+	12, 62, -16, -35, 33, 39, 51, -10, -17, 21, -17, -18, -6, -29, 33, -15,
+	11, 41, 31, 2, 20, 29, -11, -5, 11, -13, 45, -49, 19, -14, -28, 43,
+	-36, 38, -48, -12, 46, 28, 28, -12, 12, -8, 5, -36, 21, -42, 10, 11,
+	33, -23, 39, -47, -4, 11, -26, 56, -33, 10, 4, -46, 41, 44, 29, -20,
+	-60, -28, -31, 11, -16, 35, -9, -22, 16, 5, -13, -39, 24, 26, -45, 49,
+	-28, -27, 40, -35, -22, 38, -35, -15, 7, 5, -1, 17, -39, 48, 15, -41,
+	-19, -41, 37, 46, -30, 28, 10, -17, 1, -34, -46, -32, 18, -52, 27, -4,
+	-29, 36, 13, 32, 20, -43, 27, 39, 20, 3, 4, 47, -4, 5, 10, 47,
+	6, -47, -21, -13, 7, 5, 50, -14, -12, -8, -12, -11, 26, -1, -49, 9,
+	-20, -12, 28, 36, 6, 39, 29, -14, -50, 60, -39, -4, 17, -46, 39, -62,
+	-16, -41, -22, -34, 6, 11, -57, -1, -17, 26, -19, 31, 10, -48, -46, -29,
+	52, -3, -30, -36, 18, -12, 37, 28, -15, 10, -54, -13, 3, -26, -47, 42,
+	-41, 3, -14, -27, -64, -22, -29, -38, 47, -40, -31, 35, 22, 41, -42, -22,
+	-24, 23, -29, -11, -47, -37, 37, -46, -7, 43, 26, 15, -37, -28, 36, 39,
+	54, 40, 39, 33, 42, -39, 1, -40, 19, 33, 37, 1, -6, -4, 45, 24,
+	2, 35, -12, -18, 40, 50, -26, 31, 36, -4, -32, 23, 20, -42, 2, 16,
+	-45, 36, 21, -19, 21, 21, -39, -16, -11, -39, -54, 40, -9, 26, -29, -3,
+	-10, 9, 21, 47, -25, 41, -25, 9, 40, 48, 13, -40, -40, 43, 18, 34,
+	-43, 2, 20, 37, 24, -38, 24, 11, -49, 42, 20, 45, 39, 1, -24, 40,
+	-11, 9, -19, -45, -33, 18, 9, 42, 53, 35, -33, 76, -5, 1, -7, -43,
+	45, 39, 9, 32, 44, 7, 50, -5, 23, -8, -10, -21, -7, -46, 21, 4,
+	-50, -24, -8, -31, 9, -24, 29, 15, -4, 13, -38, -27, -43, 23, 9, -29,
+	-26, 48, 7, 51, -34, 24, 18, -39, 3, 7, 13, 47, -15, -33, 54, -42,
+	16, 55, 31, -45, -38, -26, -28, -10, 4, -4, -3, 61, 54, 29, -18, 7,
+	-23, -18, 57, -71, -8, -20, 6, -42, 18, 14, -65, -8, -55, 31, 55, 28,
+	-31, -26, 24, -41, -11, -77, 5, 25, 2, -7, -4, -60, 50, 17, 74, 35,
+	-12, -24, 27, -4, 1, -33, 9, -32, 24, -41, -44, 2, 4, -31, -38, -5,
+	48, -59, 54, -1, 30, 54, -29, -12, -10, 44, 56, 26, 52, 49, 57, 39,
+	1, 15, -60, 24, -7, 14, -17, -1, 49, 7, 57, 64, -1, 27, -30, 12,
+	44, -66, 32, -33, -24, -11, -67, 51, -78, -65, -50, 15, 12, 3, 22, -10,
+	13, 5, -48, 59, -66, 52, -12, -50, -36, 2, -59, -2, 35, -67, 41, -57,
+	64, 8, 24, -6, -39, 37, -15, 21, 35, 40, -11, 66, -17, -34, -20, 9,
+	42, -9, 12, 25, 20, 42, -22, -19, -28, -25, -57, 10, 41, 34, 22, 29,
+	28, -43, 11, 60, -8, -34, 38, -14, 19, 11, 58, -21, 73, 9, 43, 31,
+	58, -30, 16, -39, 31, -39, -26, 26, 2, -20, 8, 36, -5, 24, -17, 51,
+	4, -42, 40, 17, 24, -12, 47, 1, -2, -40, -28, -16, 20, 9, 8, -30,
+	2, 26, -1, 30, 62, -7, 15, -21, 30, 49, 30, -16, -51, 49, 34, -32,
+	28, 17, 27, 23, 35, 30, -15, 27, -9, 5, 69, -51, -7, 17, 60, -21,
+	17, -68, 31, 23, -18, -36, 20, -39, 14, 28, 3, -40, -41, 45, 38, -26,
+	-50, 24, 2, 23, -34, -21, -14, -8, -55, -34, -6, 39, -28, 10, 40, 13,
+	-51, 17, 36, -22, -16, 24, 19, -53, 25, 10, 8, 34, 39, 12, 20, -23,
+	-38, -54, -24, -48, -50, -70, -31, 27, 10, 50, 45, 10, 49, -8, -45, 3,
+	-46, -10, -46, -21, 0, -5, -46, 39, 10, 27, -5, 7, 24, 31, -20, 28,
+	-25, -4, -47, -34, -26, 51, -22, -49, 14, 4, -41, -51, -9, -24, -20, -35,
+	-1, 17, -49, 29, -53, -3, -5, -34, -3, -5, -32, 47, -40, -27, -24, -15,
+	40, -47, 21, -30, 7, 43, -7, 14, -1, 1, -25, -7, -27, 34, 20, 30,
+	3, 25, 22, -47, 44, -9, 29, -62, -31, -37, 34, -43, 49, -31, 41, 33,
+	38, -26, 0, -48, 41, 11, 32, 22, -25, -5, 46, 39, -33, -53, 30, 25,
+	29, -5, -46, -41, 17, -17, 27, 47, 20, -40, 33, 35, 4, -19, -46, -46,
+	23, 30, -38, 42, -17, 23, 25, 26, -31, 16, 39, 43, 10, 11, -5, -5,
+	10, -62, -38, -36, 7, -46, 8, 9, -44, -1, 21, 33, 13, 27, 16, -2,
+	-2, -41, 43, 42, 45, -36, 41, 49, -57, -53, -9, -36, -6, 20, 39, 28,
+	-18, 40, 4, -57, 12, -19, -10, 38, -21, -27, 49, 49, 36, 80, 28, -2,
+	-2, 13, 19, 64, 48, 37, -64, -12, -68, 48, 16, -19, 13, -79, -45, -51,
+	78, -21, 68, -76, -60, 17, 39, -69, -24, -30, -62, 28, -58, 45, -41, 53,
+	54, 18, 18, -15, -16, -45, 15, 43, 61, -76, 46, 23, 69, -52, 30, 25,
+	-44, -46, 47, -46, -57, -73, 16, -49, -12, -6, 30, 46, 49, -27, 27, -36,
+	17, 22, 24, 49, 32, -56, 33, 48, 26, 69, -1, 12, -40, -42, 50, 12,
+	73, 33, -30, -35, -10, 61, -10, 26, 58, 0, -16, 5, 27, 2, 46, 41,
+	46, 21, -38, 23, 49, 25, -21, -18, 28, 7, 36, 12, 57, -16, -38, -58,
+	-50, 45, 71, -24, 3, -16, -40, -30, 54, -53, -21, 0, 4, -54, -11, 2,
+	-8, 90, -40, -18, -48, 61, -88, -30, -63, 12, -18, 29, 6, -29, 29, -39,
+	30, 20, -8, -26, -14, 56, -44, -52, 69, -4, 40, -40, -19, -5, -5, 32,
+	3, 38, 7, 20, 54, -20, 13, -46, -54, 2, 72, -31, -12, 46, 55, 73,
+	-2, -73, -28, 48, -11, 36, -26, -12, 21, 10, -19, 48, -70, 27, -75, 59,
+	66, -5, -33, 71, 14, -29, -53, 55, -4, 6, -18, -64, -27, 56, 25, 42,
+	-3, -79, -27, -10, 64, 40, 24, 15, 56, -15, 16, -3, -73, -7, -21, 15,
+	53, 11, -44, 44, -22, 56, -64, 0, 64, -80, -59, -57, 6, 85, 9, -46,
+	-12, 5, 59, 57, 66, 56, 13, 59, -28, 26, -5, -2, -15, 18, 26, -20,
+	-38, -11, -37, 78, -47, -16, 44, 34, -21, 13, 13, 0, -11, 59, 17, -30,
+	-19, 83, 49, 34, 45, -2, -5, -6, 24, -8, 76, 50, 8, 27, 48, 57,
+	-72, 29, -41, 23, 13, -48, -54, -52, 39, 39, 1, 46, 51, -41, 34, 40,
+	-6, 53, 0, -7, 18, 22, -88, 12, -13, -9, -49, -11, -31, 22, -83, 8,
+	-1, 20, 15, -8, 25, 73, -19, 51, 18, 18, 42, 32, -53, -21, -3, 10,
+	-62, -70, -18, -13, 21, -61, 48, -78, 72, -40, 96, -12, -10, 56, 79, 19,
+	-14, -13, 20, -5, 12, 25, -10, -18, 42, 35, -18, -12, -40, 32, -30, 4,
+	-27, 51, 37, 46, -34, 5, -4, 30, -28, 4, 14, -33, 2, 36, 15, -23,
+	-38, -29, 55, -69, 52, 7, 13, -28, 19, -16, -35, 27, -43, 34, -2, 57,
+	-54, 28, 84, 74, 32, 35, -33, -55, -49, -30, -55, 36, -25, -15, -5, -49,
+	51, 54, 39, -61, -9, -44, 1, 47, -34, -4, 9, -2, 0, -31, 49, -35,
+	45, -14, 18, 42, -68, 6, 44, 34, 23, -54, 23, 59, -16, 63, 67, -56,
+	10, 50, 5, 51, 8, 41, 59, -21, 50, 60, -46, -8, 14, 55, 52, -26,
+	-40, -5, -47, 12, 17, 20, 21, 8, 2, -55, 48, 46, -14, 16, 22, -41,
+	28, -51, -30, -25, 27, 23, -30, 8, -5, -43, -38, 73, 75, -48, 41, -14,
+	-35, -86, 29, -19, 42, -20, -15, -19, -7, 19, -28, 48, 17, -15, -54, 17,
+	37, 13, 5, 12, -37, 44, -12, -3, -1, 73, -73, -14, -47, -63, 18, -15,
+	28, -19, 48, 7, 32, -6, 42, -24, 54, -6, 4, 38, 7, 3, 49, 47,
+	-37, 53, 18, 51, 17, -55, -37, -21, 57, -60, -36, 4, 40, 53, -31, 18,
+	-3, -59, 23, 56, -50, -23, 6, -10, -73, -28, 25, 33, -37, 13, 0, -20,
+	-18, -13, -43, 41, 52, -28, -2, 4, -26, 44, 4, 11, 20, -44, 55, 52,
+	-33, 36, -27, -8, -55, 4, 0, 67, -30, 43, -6, 6, 80, 19, 48, -18,
+	57, -6, -40, 27, 1, 33, -10, -41, -23, -5, -14, 8, -14, 16, -55, 10,
+	58, -19, 74, -24, -42, -3, 37, -26, 7, 4, 37, -35, 36, -34, -29, -44,
+	-31, -68, 28, 1, -22, -25, 46, 34, 40, 9, -8, 10, 3, 28, 24, 20,
+	-50, 53, -60, -53, -10, 12, 46, -3, -46, -9, 51, 14, 6, -13, -22, 47,
+	4, -37, -22, 26, 9, 24, 4, 55, 34, -18, -34, 37, 15, 46, 40, 11,
+	-29, 39, -10, 24, -73, 23, -17, 30, 33, 8, 8, 6, -6, -3, 32, 46,
+	-2, 26, -17, 34, -25, 39, 7, -19, 29, 21, -19, 47, 29, 39, -14, 24,
+	-20, -23, 8, -34, 34, 5, -49, 33, 46, 32, -41, 12, 21, 40, -29, 34,
+	50, 53, 35, -47, 10, 0, 52, -26, -74, 36, -25, 62, -42, 54, 38, -24,
+	-35, -33, -21, 32, -8, 39, -56, -10, -22, -11, -71, -4, 7, 13, -27, -6,
+	-59, 37, 2, -48, -35, 28, 51, -7, -25, 4, 30, -22, -48, 50, 55, -54,
+	-58, 48, 46, -9, -47, 58, -39, 0, -21, -51, -31, -17, -37, -73, -1, -14,
+	31, -57, -26, 59, -18, 47, -24, 7, -24, 3, 24, -38, 34, 1, 38, -38,
+	42, -31, 29, -16, 35, -3, 61, -35, -40, 37, -17, -2, -20, 15, 40, 75,
+	47, -74, -31, 1, 17, 1, -16, 58, -11, -41, 30, 56, -28, -16, -37, 8,
+	8, 29, -15, -39, 44, 19, -48, -35, -53, 59, -23, 42, 30, -16, -19, 64,
+	31, 12, 45, 60, 20, 7, -25, -15, 48, -20, -31, -27, -8, 3, 15, -37,
+	47, -8, -17, -19, 24, -35, -42, 7, -50, 56, -25, 0, -9, 24, -24, 45,
+	-32, -20, -3, 44, 5, 0, -42, -46, -30, -12, 62, 15, 64, 19, -32, 8,
+	-10, 54, -26, -14, 50, -20, 15, 46, 14, -3, -2, -26, 10, -31, -41, -27,
+	-48, -2, -45, 40, 41, 52, 18, -43, -27, -25, -55, 43, 53, 40, -20, -29,
+	-1, 43, 47, 8, 41, -47, 49, 37, 28, -60, 33, -21, -50, -18, 22, 2,
+	-11, -28, -25, -6, 42, -12, 44, 57, -53, 29, -32, 41, 10, -44, -19, 31,
+	30, 38, -46, -25, -23, -36, 8, 2, -41, 24, 6, 52, -30, -37, -47, 44,
+	-10, -9, -40, 35, -20, -48, -31, -53, 55, -14, 37, 44, 52, 33, -10, -12,
+	-42, -24, 7, 35, -31, -33, -21, -5, 15, -35, 44, 2, 4, -40, -1, 55,
+	32, 21, -25, 13, -37, 0, 15, 36, 44, 55, 17, -17, 20, -23, -14, 24,
+	-4, -10, -25, -5, -34, -19, -30, -19, -36, 2, 3, -7, -49, -25, -15, -2,
+	-7, 12, -49, 15, -28, 18, -31, 47, 29, -9, 18, 15, -50, -17, 7, 17,
+	21, 7, -42, -38, -16, 31, -41, -59, -43, -25, -39, 17, 27, 46, 45, 31,
+	15, 14, -27, -30, -15, -23, -11, -3, -51, 21, -32, -39, 23, -32, -13, -4,
+	-35, 22, -37, -54, 25, -28, 33, 14, -29, 3, 39, -6, 24, 36, -48, -9,
+	17, -67, -7, 23, -42, -27, -54, -56, -36, -14, 0, 39, -22, -2, 12, 40,
+	8, 20, 24, -2, -24, -28, -25, -17, -34, -32, -53, -59, -52, 60, -69, 52,
+	12, 49, -39, -32, 22, 91, -2, -34, -20, -3, 18, -10, -41, 24, 7, -17,
+	44, -2, 26, 18, -9, -4, -32, 11, -16, 33, -48, 34, -2, 20, -50, 41,
+	2, 27, 92, 14, -65, -22, 34, 54, 14, 34, 41, 57, -15, -39, -7, 13,
+	48, -47, -5, -54, -33, 17, 59, -11, 6, 45, -29, -40, -20, 44, -17, -62,
+	10, 34, -27, 45, -54, -38, -26, 69, 8, 62, -14, 3, 10, -7, 10, -50,
+	-3, -58, -22, 6, -20, 36, 6, -24, 49, 7, 64, 44, 19, 43, -10, 11,
+	48, -6, -30, 33, -6, -22, -5, 33, -37, 12, 56, 69, -11, 19, 22, -11,
+	-41, 12, -13, -12, 13, -16, -59, -7, -19, 43, -31, -52, -6, 16, 16, -19,
+	-26, -13, 15, -20, -25, 3, -29, -25, 66, 9, 7, 13, 55, 13, 48, 46,
+	34, 3, -29, -72, 44, 7, 35, -26, -24, -14, 16, -15, -35, 21, 26, -26,
+	39, -25, 23, 31, -4, 20, -8, 30, 1, 58, 24, 2, 3, 11, 27, -21,
+	52, 7, -27, 29, -16, 36, -62, -43, -53, 2, -36, -33, 40, -43, 22, -32,
+	-13, 36, 29, 37, 52, 52, 2, 4, -10, 54, -10, 13, 21, -45, -37, -3,
+	11, -14, 10, 61, -19, -22, 57, -13, -32, -24, 2, 72, -48, -54, 21, -41,
+	-12, 28, 5, -33, -22, 55, -22, 44, 1, -13, -1, -23, -56, -53, -27, -4,
+	25, 29, 9, -42, 12, 49, -45, -13, 9, 12, 25, -18, 29, -6, 50, -52,
+	2, 29, 8, 11, -25, 22, -31, 34, -1, 46, 94, -41, 17, -36, -48, -19,
+	37, 3, -21, 71, -49, -9, -28, -55, -1, -51, -81, 7, 31, 40, -29, 45,
+	-20, -52, -55, 14, -43, -64, -13, 15, 28, 30, 26, 16, 46, -31, 21, 30,
+	9, 28, -49, 17, 1, -39, 62, 59, 52, 43, -45, -28, -2, 9, -9, -56,
+	55, -40, -22, 35, -22, -17, -28, 77, 43, 70, 19, -38, 6, 16, -26, -44,
+	-22, -55, 20, -53, 18, -42, 39, 48, -13, 28, 23, 60, 82, 27, 30, -27,
+	-38, -60, 42, 31, -13, 39, 59, 31, -33, 12, 53, 26, -8, -47, 12, 73,
+	73, 83, -13, -47, 28, 42, 29, 53, -23, -33, 34, -34, -60, 42, 20, 8,
+	-37, -33, 53, -22, -74, 44, -31, 69, -29, 24, -7, -32, -42, -67, 42, -40,
+	41, 0, 50, -9, 60, -10, 38, 14, 16, 40, -2, -81, 51, -87, -26, 33,
+	30, 10, 31, -35, -12, 53, -33, 25, 34, 12, -6, 28, 5, -17, 49, 13,
+	-5, 54, 40, 39, -44, 28, -32, -33, -33, 27, -1, -34, 11, 23, -4, 40,
+	-18, 12, 23, 24, 30, -27, -43, 24, -50, 38, 11, 31, 42, 22, 1, -16,
+	-49, 25, 16, 0, -26, -7, 51, -18, 4, 58, -24, 32, -31, 30, 10, -26,
+	-22, -24, -9, 23, 34, -45, 0, 3, -44, 42, 45, -21, 15, -5, 10, 41,
+	63, -46, -39, 64, -24, -18, -12, 37, 33, -33, -27, 45, 26, 0, 66, -6,
+	11, 1, 15, -18, -37, 49, 40, -26, -7, -24, -44, 32, 2, 19, -50, 61,
+	12, 28, 27, -37, 12, -22, -23, 43, -9, 22, -34, -22, 13, 42, -50, 23,
+	-45, -39, 2, -12, 27, 21, -14, -25, -49, 53, -1, 0, -4, -16, -4, 41,
+	31, 15, 25, 29, -19, -38, 39, -10, -42, 43, 12, 1, 37, 28, -11, 7,
+	-15, -18, 55, -18, 43, -49, -38, 17, -21, -44, 25, 18, 25, 18, 51, 48,
+	-44, 53, 5, 33, 27, 58, -24, 48, 6, 5, -42, -1, -32, 33, 21, -10,
+	21, -50, -6, -10, 13, 35, 30, 1, 26, 17, -6, 45, -33, -23, -29, 27,
+	40, 13, 29, 31, -38, -36, -14, -22, 49, -48, 50, -48, 34, -28, -32, 11,
+	3, -4, -42, 46, -43, -4, 54, -66, 22, -14, -59, 34, -11, 28, -22, -51,
+	-5, -34, -6, -18, 3, -36, 17, 22, 49, 15, -31, 61, -10, -31, -4, 42,
+	-56, 34, 52, -58, 32, 4, 20, -63, -45, 9, -33, -13, -46, -15, 71, -69,
+	-49, -31, -40, 61, 50, 56, -29, -48, -25, -16, 0, -57, 52, -33, -39, 47,
+	55, 30, -17, -42, -27, 43, 42, -66, -34, 26, 15, 26, 26, -36, -19, -32,
+	24, 57, 63, -23, 18, -36, 30, -23, 31, 35, -3, 15, 21, -40, -55, -40,
+	32, -13, 4, 19, -24, -15, 43, 31, -42, -80, 82, -43, -63, 2, 16, 20,
+	69, -17, -54, 29, 30, -59, -57, 22, 17, 62, 3, -33, 8, -17, 29, 48,
+	66, 31, -44, -26, -35, 28, 0, -2, -14, -35, 16, -1, -34, 71, -18, 94,
+	-34, -19, 79, -54, 4, 54, 12, 76, 54, 10, 5, -21, 88, 8, 29, 27,
+	27, 49, 59, -4, -34, -33, -18, -14, 48, 42, 46, 2, -60, 58, -17, -10,
+	-17, -25, -7, 5, 29, 40, 4, 7, 17, 32, -41, -20, 60, -28, 24, -9,
+	-11, 40, 33, 50, -3, -22, -5, 24, 68, 7, -3, -54, 36, 30, -6, 7,
+	75, -33, -4, 51, 25, 20, 46, 40, 34, -20, 65, -8, -91, -55, 72, 17,
+	61, -5, 24, -30, 38, -24, -51, 16, 34, -6, 58, -33, -28, -40, -44, -20,
+	-4, 37, -31, 37, -5, -35, -28, -4, 9, 42, 59, -15, 18, 1, -32, 70,
+	-35, -31, 34, -55, 9, -48, 52, -33, -62, 22, -2, 51, 47, -12, 22, 63,
+	-12, 56, -26, -6, -26, 45, 18, 15, 21, 12, -28, 7, 44, 79, 39, 33,
+	-20, -53, 5, 50, 6, 25, 20, -40, 59, -51, -31, -18, 24, 30, -7, 12,
+	-22, -25, 37, -42, -2, 7, -5, -23, -16, 54, 17, -54, 6, 60, 19, -42,
+	-60, 19, -32, -6, 39, 18, 7, 15, -51, 30, 58, 4, -57, -35, 4, 31,
+	-29, 59, -4, -39, 31, -13, -61, -23, 48, 7, 7, 48, 56, 48, 4, 1,
+	4, 21, 41, 52, 46, 15, -30, 45, 39, 50, -35, -13, -55, -9, -30, -10,
+	23, 34, -14, -19, 7, 39, 60, -15, 35, -28, 49, 47, 30, -24, -27, -20,
+	3, -43, 11, -7, -58, 52, -35, -48, 39, -25, 49, 9, -40, 42, 37, -32,
+	38, 24, 10, 20, -67, 1, -22, -37, -41, -5, -3, 39, 15, 25, -66, 18,
+	-17, 77, -36, 43, -34, -40, -21, 26, -11, -13, 15, 34, 33, 55, 23, -9,
+	65, 16, 54, -42, 49, 17, -9, 1, -45, 10, -63, -8, -27, -44, -20, 21,
+	31, -41, 70, -5, 30, 53, -45, -52, 31, 31, -7, -44, -19, -41, 33, 25,
+	38, 61, 63, 57, -8, -45, -51, 46, -30, 16, -45, -25, 42, -5, -52, -30,
+	68, 9, 49, 11, 3, -44, 31, 29, 48, -3, -14, 19, -47, -2, 43, -40,
+	52, 21, -34, -27, -25, -44, 18, -57, 40, -45, 21, -40, 33, 57, 20, -32,
+	-11, 48, 31, 42, 6, 49, 1, -36, 21, 44, -34, 11, -36, -6, 18, 49,
+	2, 0, -41, -54, 49, 1, 22, -39, -35, 49, 38, 8, 26, 0, 6, 25,
+	6, -13, 25, -39, 58, 30, 28, -64, -7, 3, 8, 4, 19, -43, -16, -47,
+	45, -69, 0, 64, 10, 11, -3, -29, -8, 55, 39, -37, 42, -47, 37, -7,
+	24, 11, 29, -23, 24, -2, 39, -33, -37, -4, -1, -64, 15, 29, -24, 60,
+	54, -57, 73, 22, -56, 16, 50, 5, 40, 45, 29, -37, -6, -26, 42, -33,
+	-12, 3, -23, 5, -14, -49, -34, -11, 57, -24, -28, -61, 46, 50, -43, -56,
+	3, 2, 1, -23, 38, 23, -13, -48, 5, 3, -14, -10, 57, 16, -36, -29,
+	-39, -16, 59, -31, 44, 1, -37, -5, 20, -3, 78, -43, 21, 43, -41, -18,
+	19, -9, 51, -42, 8, -55, -33, -31, -9, -74, -15, 36, 37, 7, -21, -51,
+	11, 39, -63, 52, -25, 4, -2, -34, 30, -12, -82, -1, -18, 28, 45, -55,
+	48, -36, -2, -2, -45, -28, 9, -26, 49, 7, 27, -8, 3, -58, 16, 20,
+	64, -3, 26, 0, 9, 59, -11, 45, 13, -3, 0, 49, 43, -22, 33, -5,
+	-47, 32, 23, 67, 30, 2, -21, 29, 3, -36, 37, 27, -65, -28, 28, -56,
+	4, -47, -31, -4, -41, -8, 22, 8, 17, -26, -24, -72, -7, 1, 53, -39,
+	-10, -41, -48, -48, 72, 55, -3, 49, -9, -8, -21, 61, 31, 42, 35, 0,
+	-4, -57, -34, -13, 19, 68, 42, 8, -13, 41, 23, 18, 30, 5, -22, 40,
+	-51, 36, -32, -39, -17, 22, 35, 34, 11, -45, 64, 3, -52, 11, -21, -20,
+	-16, 53, -67, 5, 20, -6, -31, -31, 14, 18, -9, -28, -4, 2, 50, -21,
+	-49, 19, -23, 61, 10, 33, 11, 45, -46, -41, 35, -45, -43, -40, 70, 55,
+	-3, 8, -37, 53, -28, 12, -15, 36, -30, 36, -3, 53, -17, 7, 2, -59,
+	-54, -4, -39, -34, -93, 12, -16, 52, -16, -29, -15, -28, 1, 60, 57, 40,
+	36, 2, 45, 27, 11, 31, 21, -14, 18, -30, 35, -17, 7, 12, -37, 23,
+	13, -42, 20, 76, -4, -19, -36, -5, -1, 31, -29, 21, -24, -5, 0, -25,
+	-1, -13, -5, 47, 26, -19, -13, -24, 39, 8, 19, 30, -14, 50, -6, -55,
+	-12, -55, -30, 31, -25, 11, -56, -34, -13, 25, -24, -37, 25, -25, 13, 12,
+	82, 30, -62, 9, 27, 21, 3, 38, 37, -57, 19, -34, 40, 83, 25, 10,
+	56, -11, -41, 38, -43, -52, 53, 35, -45, -5, 38, 44, -3, -32, 48, 6,
+	-15, -59, 32, -5, -21, 34, 14, 8, 29, 35, 5, -35, 14, 1, 40, -48,
+	31, -4, -56, 7, -35, -48, -26, -16, 63, 5, -76, 29, -98, 9, -91, 4,
+	15, -7, -12, -32, -8, 39, -33, 72, -15, -23, 32, 24, -11, -9, 45, -46,
+	17, 9, 58, 28, 40, -1, -16, 76, 4, 29, 64, -23, -6, 51, -16, 12,
+	-21, 77, -47, 99, 61, -44, -52, 12, -70, -8, 2, 59, -88, 79, -17, -30,
+	-11, -30, -30, 89, -28, 49, 20, 83, -24, 9, 23, -30, -22, 32, -22, -4,
+	64, -10, 10, -44, 28, 13, 30, 23, 13, -12, -59, 46, -12, 20, -59, -51,
+	-52, -37, -6, 16, -51, -58, 9, 20, 49, -15, 46, 78, 79, -24, -57, 31,
+	62, -14, -51, 48, -13, -43, 20, -48, 49, -36, -6, 18, 9, 8, 23, 21,
+	-85, 38, 74, 23, -22, -17, -27, -77, -23, 12, 17, 25, 34, -61, -6, 61,
+	-5, -72, 33, 14, -16, -19, 59, -21, -4, 33, -22, 36, 17, 40, 46, 10,
+	41, 32, -40, -27, 2, 76, -45, -1, -66, -2, 62, 39, -11, 55, 60, 19,
+	-10, -70, -56, 73, 40, -62, 6, -30, -32, 45, -24, 48, -61, -15, 0, 73,
+	-54, 9, 2, 6, 29, 71, 21, 58, 15, -35, -65, 26, -6, 22, -7, -19,
+	18, 51, 2, 12, 36, -35, 20, 12, -29, -44, -58, 66, 3, 45, -21, -33,
+	28, 4, 32, 26, -26, -26, 1, -19, 13, 21, -18, -49, 14, 43, -17, 72,
+	-28, -9, -41, -44, 78, -4, 6, -53, 6, 8, 29, -34, -23, -14, 41, 1,
+	38, 36, 45, 58, 27, -34, -50, 25, 31, -58, 14, -9, 14, 40, -5, -18,
+	9, -17, 13, 19, 10, 9, -9, 2, 19, -34, -27, -17, -48, -44, -32, 25,
+	-20, 15, -54, 48, 1, 5, 10, -17, 45, 34, -63, 63, -39, 19, 47, 32,
+	68, -47, 80, -50, -17, 2, -57, -43, 64, 51, 59, 22, -24, -57, -36, -22,
+	-11, 20, 29, 2, 75, 13, 35, 62, -51, -3, -37, 26, -36, 33, 53, 22,
+	-49, 55, -29, -27, 16, 20, 26, 24, 27, -44, 12, -37, 19, 16, -27, 69,
+	69, -4, -62, -32, -5, 29, 52, -49, -52, 43, 45, 2, -25, -22, 4, 33,
+	-2, -38, -11, -32, -8, 20, -64, 55, 14, -24, -37, 12, 9, -12, -51, 35,
+	-4, -47, 26, -23, -37, -38, 47, 21, 25, 4, 24, -7, -44, 11, -27, -45,
+	-41, 62, 67, 49, 22, 78, -2, -21, 34, 23, 6, -44, 34, 63, 42, -3,
+	9, 19, 43, -48, 24, 31, 0, -74, -6, -39, 6, 8, 31, -17, -56, -45,
+	-47, -46, -25, 35, -14, -56, 20, 36, -56, -18, -57, 38, 8, -14, 20, 36,
+	9, -29, -44, 51, -9, 6, 41, 15, 25, -63, -32, -18, 18, -45, 57, 13,
+	25, -6, -16, -6, -35, -34, -12, -20, 31, 0, -52, -34, -26, -39, 8, 37,
+	37, 57, 25, 27, 27, -43, 41, 71, -61, -9, 22, 24, 30, 27, -33, -32,
+	45, 74, 8, -36, 1, 51, -38, 53, -6, -16, 50, -14, 47, -53, 6, -25,
+	22, -23, 7, -9, 6, 20, -39, 16, -5, -26, 55, 12, 12, -23, 50, -10,
+	-4, 56, -49, 31, 15, -39, -5, -13, -27, -64, 30, -26, 39, 28, 5, 9,
+	14, 33, -19, -56, 46, -20, 20, 11, 43, 41, -1, -11, -29, -2, -49, 28,
+	-34, -52, 5, -27, -9, 7, 11, -57, -35, 53, 35, -7, 0, -30, -61, 18,
+	-25, -20, -37, 9, 40, 7, 18, -50, 12, -30, -36, 25, -48, 59, 32, -48,
+	59, 23, 22, 71, -28, -1, 26, -46, -15, -46, 22, -37, 12, -45, 26, 15,
+	33, -47, -56, -52, -50, 65, 36, 36, 41, -58, 18, 34, -37, -7, 40, -11,
+	31, -24, 0, 28, -33, -33, 48, -67, -39, 34, -11, 9, -30, 64, 9, 29,
+	74, -41, 42, -19, 3, 1, 24, -31, 5, -2, 7, -64, -12, 15, 27, 10,
+	-45, 12, -31, -34, -33, 35, 7, 9, -63, -13, -24, 15, -39, -48, -6, -29,
+	-7, -29, 55, 0, -51, -60, -9, -3, 1, 4, 34, -31, -74, -6, 42, -51,
+	-54, -42, 21, -44, -61, 15, 36, 56, -45, -24, -21, 9, -24, 64, -66, -66,
+	53, -32, 25, 14, 89, 78, -36, 64, 35, 31, -71, -29, 27, -22, 30, 70,
+	1, 36, -33, 6, 20, 37, -52, 45, -50, -54, 52, 36, 28, 26, -2, -59,
+	49, -31, -25, -54, -46, -72, 40, -47, -36, -11, -31, -33, 5, 66, 7, 47,
+	-50, 29, 30, -20, -15, 30, 45, 64, -28, -47, -15, 78, 26, 9, 25, 5,
+	-19, 17, 68, -65, -5, 16, -10, 19, 44, 15, -26, -57, -17, -32, -63, 46,
+	67, 48, -27, 30, 28, -57, -42, -26, -87, -61, 33, 22, -34, 7, -4, 40,
+	42, -63, 46, -8, -13, 61, -40, 11, 35, -10, 85, -24, -61, -21, -34, -70,
+	34, -6, 19, -77, 33, -60, -13, -43, -27, 4, 51, 27, -12, 24, -37, 10,
+	-4, 61, -58, 23, -80, 19, -36, 97, -75, 30, 2, -42, -24, -50, 52, 20,
+	-13, 5, -7, -61, 103, -1, -21, 5, 43, 9, -23, 37, -25, 92, 17, 27,
+	10, 12, 34, 12, 28, 46, 55, 20, 22, -49, -33, 35, -7, -41, -43, 7,
+	4, -20, 12, 113, 25, 50, 46, -16, -58, 6, 1, -49, -94, -32, 26, -22,
+	-14, 56, 40, -64, -56, -46, 10, 1, -67, -37, 3, -43, 26, 27, 26, 58,
+	26, -36, -46, -31, -18, -77, 3, -8, -20, -10, -33, 48, 8, -32, -27, 44,
+	50, 61, 58, 44, 40, 25, 3, 34, -1, 52, 10, 43, -30, 0, -51, -45,
+	11, -40, -35, -10, -10, -16, -30, -52, 11, 41, -33, 23, 38, 26, 33, 39,
+	23, 22, -51, 39, 58, -21, -22, 48, 3, 31, -26, 42, -11, 65, -34, -35,
+	1, -31, -1, 25, 21, 60, 46, -13, 28, -54, 13, 7, 63, -5, 45, 64,
+	-45, 22, -37, 26, -35, -19, 18, 50, 21, 5, 1, 38, 75, 21, -15, 11,
+	4, -37, 22, 26, 35, -40, 29, 39, 38, 2, 25, 16, 11, -28, -43, -40,
+	-28, 4, -13, -4, -35, -36, 43, 40, 16, -21, 9, -23, -27, -25, 50, 0,
+	-38, -30, 0, 50, -33, -17, 21, -64, 54, -14, 21, -19, -29, -24, 37, -4,
+	1, 31, -49, -34, -41, -8, -32, -34, -32, -39, 25, 3, 4, -19, -6, -42,
+	-40, -33, -13, 38, -44, 3, -33, -23, 17, 22, -6, 68, -19, 47, -28, 34,
+	-62, -43, 29, -9, -49, 26, 12, 57, 60, -15, -35, 4, -21, -18, 21, 6,
+	-37, -3, -34, -23, -31, 27, 14, -69, 54, -13, -18, 14, 20, 9, 71, -34,
+	2, -37, -7, 11, -8, -36, -57, -43, 28, 3, 46, 22, -42, 73, -1, 39,
+	-16, -7, -18, 4, -40, 39, 9, -7, 58, 1, 3, -39, -34, -19, 4, -54,
+	-30, 24, -45, -25, 17, -47, 31, 34, -24, -18, 66, 48, -2, -12, 2, 49,
+	-18, -15, -54, 11, -39, -38, 30, 24, 31, -8, -37, -21, -28, 11, 4, -21,
+	36, -26, -33, -27, -6, 34, 15, 5, -41, 50, -26, 28, 11, 4, 25, -14,
+	-18, 24, 9, -13, -9, -33, -25, 22, -13, -30, 53, 41, 0, 35, 13, 47,
+	-36, -36, 38, 0, -9, -7, -8, 26, 48, 24, -34, -51, 33, -36, -39, -37,
+	-27, 11, -24, -40, 37, 52, -23, 74, 37, 49, 16, -4, -27, 28, -24, 7,
+	-48, 20, 48, 16, 39, -39, -14, 36, -25, -40, -42, 44, 54, 31, -11, -16,
+	11, 21, -17, -52, -41, -7, -7, 12, -31, 11, 0, 17, 35, 3, -34, -46,
+	17, -55, -5, 22, -20, 70, -23, 23, 6, 10, -17, 40, -31, -50, 9, 30,
+	14, 41, -29, 9, 30, -27, 23, 59, -30, 28, -17, -17, -16, -29, -10, -26,
+	-35, 54, 59, -31, 62, 39, 25, 31, 34, -8, 7, 22, 5, -30, -33, -23,
+	26, 38, 51, 1, 1, -43, 38, -10, 52, 48, -23, -8, 10, -27, 19, -67,
+	-38, -46, 31, -18, -1, 21, -39, 6, -40, -13, 29, -12, 4, 27, -32, 50,
+	-18, 7, 61, -36, -53, -53, 19, 19, -39, -15, -14, 12, -26, 17, -38, -2,
+	-52, -47, -20, -8, -18, -18, 54, -32, -19, 69, 28, -47, 8, -2, 38, -26,
+	72, -14, 105, -32, 23, 61, 7, -69, -18, 21, 43, 32, -23, -64, 51, 32,
+	-61, 12, -5, 35, -55, 24, 16, -59, 24, 23, 30, 16, 45, -44, -19, 27,
+	56, 2, 3, 25, 8, 58, -33, 44, -7, -61, 27, -19, 26, 98, 29, -28,
+	-18, 10, 46, -19, 21, 29, 40, 10, 25, 14, -4, -22, -12, -16, 16, 11,
+	23, -77, 2, -48, -52, -44, -22, 25, 25, -13, 35, -23, -17, -18, -3, 61,
+	-14, 24, 29, 22, -31, 24, -7, 31, 38, -45, -43, 42, -19, 3, 52, -48,
+	37, 13, -59, -7, -17, 12, -12, -90, -8, -10, 13, -85, -42, 69, 32, -46,
+	33, 71, 43, 50, 50, 73, -2, -34, 29, -21, 32, 60, -29, 40, -24, -9,
+	4, 29, -55, 33, -24, 14, 82, 30, 1, 14, -28, -26, -1, 35, -3, -71,
+	-6, -51, 47, -30, 15, -44, -38, 28, -13, -43, -8, 80, 23, 43, -3, -45,
+	52, 30, -22, 16, -62, 51, 12, 22, 30, 56, 81, 15, -31, -1, 22, 60,
+	-14, -27, -30, 35, 10, -127, -2, 29, 34, -3, 58, -44, 26, 35, -28, 23,
+	-38, 57, 17, 22, -40, 16, -57, -6, -64, -64, -43, 10, -22, 24, 4, -15,
+	-35, 0, -40, 22, -59, 22, -39, -23, 36, 60, -19, 27, -6, 25, 35, 1,
+	-19, -44, -13, -32, -11, 32, 10, -35, -29, 49, 13, 57, -8, 11, 52, -32,
+	-29, -53, -42, 14, -28, 46, 4, -38, 42, 29, -21, -17, -29, 0, -35, 12,
+	10, -24, -41, -65, -15, 14, 37, 32, -25, 46, -22, -9, 31, 38, -38, -28,
+	-28, -8, -60, -7, 30, -10, 28, 29, 20, 38, -51, 53, -48, -24, 61, -32,
+	-12, -53, 18, 28, -8, 6, -10, 3, -20, -11, -52, 1, -23, 10, -56, -1,
+	-5, -21, 59, -1, -18, 41, 45, -66, -78, -47, -33, 56, 49, -38, -15, 28,
+	37, 13, -29, -24, 8, -47, 51, -39, -7, 43, -42, -30, 24, 22, -61, 3,
+	44, -38, 11, 22, 6, 42, -1, 80, 31, 35, -56, -25, -45, 58, 12, 28,
+	-53, 13, 10, -46, -18, -51, -13, 16, 43, -1, 4, -15, -24, 15, -19, 55,
+	-57, -48, -72, 16, -62, -36, 13, -10, 25, 21, -33, 9, -61, -50, -19, 30,
+	-10, -52, 20, 4, 58, -10, 20, 36, 17, -76, 56, -13, 45, -47, 4, 69,
+	26, -5, -16, -40, -24, 24, -54, -34, -19, -32, -10, -31, 33, 50, 28, 37,
+	93, -24, 17, 61, -9, 18, -45, -1, -5, -5, 6, 56, -53, 11, -45, -16,
+	-51, -44, -31, -25, 24, 39, -25, -40, 45, 47, 31, -34, -7, -5, -27, -21,
+	-49, -23, -8, 44, -4, 28, -32, 3, -35, -8, -47, 58, 31, -41, -35, 40,
+	8, 36, -5, -13, -56, 41, 37, -14, -32, -35, -11, 13, -8, 36, -41, -42,
+	29, 11, -1, -30, 15, 21, 11, -38, -26, 42, -40, -9, 9, 3, -38, -35,
+	-35, 61, 5, 11, -17, 20, -23, -36, -8, 17, -24, -49, 16, 33, -16, 31,
+	-32, 21, 47, -3, 50, -19, -38, -38, -13, -5, -42, 13, 10, -12, 41, -50,
+	22, 48, 21, 18, -49, 46, 20, 61, -7, -29, -1, 48, 21, -3, -42, -48,
+	-27, -11, -7, 37, -50, 16, 8, -24, -53, -28, -41, -35, 22, -24, 53, -13,
+	37, -20, -12, -15, 51, -26, -31, 8, -4, -66, -12, -60, 1, 20, 3, -21,
+	-28, -48, -40, -23, -62, 13, -16, -6, 44, -8, -23, 78, -41, -26, -19, 37,
+	18, 7, -7, -37, 36, 42, -38, 44, 9, -5, -20, -29, -7, 4, 50, -2,
+	-37, 39, -10, -13, -6, -36, 21, 54, 9, -6, -2, 7, -14, -26, -53, -4,
+	-25, -3, 12, -38, 2, -20, -45, 28, 30, -44, 36, -50, 43, 26, -39, 36,
+	-47, 45, -1, -22, -27, 67, -47, -26, -15, -29, -49, 19, 5, 24, -33, -43,
+	7, -35, -46, 17, 44, 12, 17, 43, 16, 37, -23, 14, 55, -54, -48, -16,
+	43, 26, 32, -9, -22, 95, 7, 4, 0, 55, -40, 28, 57, 3, -43, -76,
+	-2, -1, 40, -34, -58, 13, 71, -44, -4, 5, -39, 18, 33, -35, 43, -39,
+	22, 30, 31, 20, -36, 62, -47, -37, -39, 5, 37, 6, 15, 4, -39, 20,
+	-40, 16, -27, 73, -2, 22, 46, 60, -25, 11, 15, 39, 43, 12, -47, 74,
+	25, -13, -12, 9, 33, -47, -56, 44, 3, -25, 38, -6, -5, 10, 33, 36,
+	-19, -27, 23, -7, -3, -11, 2, -49, 35, -36, 24, 53, 14, 3, 26, 25,
+	-37, -19, 40, -20, -26, -1, 50, 49, 42, 34, -27, 65, -63, 37, 9, -42,
+	46, 60, 68, 56, -22, 36, 21, -56, 14, 17, 60, 28, 64, 57, 24, -19,
+	-48, 42, 79, -65, -5, 10, -48, 52, 26, -22, -11, -18, -23, -58, 3, 22,
+	4, 28, 13, 32, 25, 61, -18, -3, -18, -30, 8, 37, 14, -28, 37, -5,
+	-44, 10, -50, 19, 4, 17, -38, 45, -52, -21, -33, 2, -37, 2, -24, 15,
+	41, -48, -53, 7, 0, 39, 56, 44, 26, 43, 9, 73, 33, 19, 18, -25,
+	-50, -28, -4, -15, -19, 35, -67, 52, 9, 19, -18, 64, 64, -52, -46, -38,
+	38, 67, -24, 49, 13, -11, -31, 31, 28, -20, -31, -39, 18, 22, -53, 13,
+	-15, -48, -22, 25, -10, -34, 17, -37, 22, 27, -10, -18, 49, 8, 22, 24,
+	-20, 52, -24, 1, -64, 6, -39, 54, 10, 36, -35, -50, -7, -32, 53, 23,
+	39, 1, -10, 16, -3, -31, 2, -8, 10, 48, 18, 46, 2, 23, 41, 5,
+	-9, -22, -41, -38, -39, -9, 9, -21, 26, 15, 11, -17, 26, -43, 52, -35,
+	-34, -16, 10, 21, 42, 54, -41, -1, -8, 8, 30, -47, -10, -20, -61, -13,
+	-28, 37, -25, -30, -24, 33, -40, 36, 6, 24, 35, -45, -37, -50, 46, 36,
+	43, 58, 22, 32, 10, -26, 77, 9, 4, -2, 28, -46, -3, -33, -57, -35,
+	39, 20, 5, 24, 26, -3, 16, -56, -35, 65, 13, -13, 24, -39, -37, 39,
+	-2, 36, 70, -4, 23, 15, -13, 33, 6, -71, 42, 0, -34, 20, -16, -40,
+	24, 12, -36, 16, 37, 42, 38, -28, 11, 58, 13, 13, 44, -13, -33, 16,
+	17, -14, -38, 15, 11, 14, -35, -24, -25, 32, -46, -21, 10, 33, -1, 50,
+	47, 14, 50, 28, 41, 17, -58, -19, -28, 24, -42, 14, 11, 54, -21, -47,
+	37, -16, 21, 37, 36, -31, 12, 53, 34, -40, -62, 18, -15, 38, 8, 49,
+	-51, 5, 38, 42, 5, 42, -15, 7, 30, 26, 17, -1, -53, 30, 43, -4,
+	-4, 57, 47, -64, -5, 71, -64, 48, 58, -16, 40, 20, -15, -23, 36, -15,
+	32, -62, -62, 54, -17, 3, 17, -7, -6, -47, 20, 52, -65, -29, 40, 43,
+	0, 24, 11, 10, -14, 8, 9, 10, 4, 74, -12, 58, 49, 25, 13, 0,
+	-67, -33, -50, -40, 10, -74, -2, 17, -25, -44, 16, -34, 14, 64, 30, 38,
+	3, 17, -50, 64, 51, 45, 15, -3, -10, -16, 48, 34, -28, 15, 37, 4,
+	44, -21, 30, 5, 16, -13, 26, 37, -39, -64, 29, -40, -20, 19, -4, 2,
+	29, -11, 25, 12, 37, -57, -19, 1, -12, 7, -16, 11, 52, -49, -12, 9,
+	18, 31, 63, 35, 49, 40, -46, 8, 3, 9, -9, 17, -5, 22, 0, -41,
+	-55, 24, -11, -45, 64, -2, 29, 3, 27, -40, -45, 27, -58, 33, 25, 63,
+	-8, 23, -32, 15, 48, -3, -57, 37, -36, 29, 51, 16, -46, -46, 3, 32,
+	-28, -45, 38, -23, 56, 6, 42, 49, 30, -37, -3, 0, -36, -51, -12, -7,
+	57, 6, -18, 32, 11, 2, 9, 18, -23, 12, -1, -28, -39, -32, -9, -47,
+	19, 17, -66, -34, 33, -52, 4, 5, -22, -48, 12, -5, -27, -15, -1, 40,
+	-39, 69, 60, -9, -27, -15, -42, 12, 21, -36, 41, -28, -39, -28, -24, -12,
+	64, 1, -22, -39, -52, -41, 40, -27, 17, 60, -10, 41, 29, 25, 52, -25,
+	-59, -43, 37, -9, 10, 47, 34, 54, 28, 16, 20, -7, 37, 37, -40, 29,
+	-28, -40, -55, -35, -30, -7, 31, -7, -51, -60, -86, 26, 28, -38, 46, -70,
+	47, -46, -14, 27, -17, 14, 26, -2, -17, 47, -12, 2, -5, -60, -49, -43,
+	-23, -34, 40, 42, 58, 2, -32, -27, 46, 11, 47, 13, 8, -21, 35, 31,
+	46, 54, 29, -31, 50, 41, -1, -2, 13, -5, 37, 29, 13, -19, 51, 37,
+	37, 37, -4, -28, 38, -13, 19, 17, -65, -27, 43, 25, 18, 59, 36, -3,
+	45, 20, -21, 6, 77, 9, -39, 23, -61, 33, 48, 20, -31, 45, 49, -24,
+	12, 24, 67, 43, 38, -19, -67, 39, 41, -16, 26, -27, -22, 6, 1, -4,
+	-38, -11, -27, 52, -21, 14, -49, 26, 27, -24, -14, 54, 12, 12, 58, -1,
+	-85, 43, 37, -95, -8, 22, 60, 37, 10, -41, 40, 19, 44, -20, 26, 50,
+	-38, 13, 7, 51, -22, 19, -53, -17, 35, 10, -75, -47, -40, -27, -38, -35,
+	2, 20, 34, 61, 38, 33, 35, -23, 62, 24, -23, 26, -55, -64, 32, 29,
+	21, -20, -26, 47, 21, 20, 16, -4, 54, 19, 19, 53, -20, 46, 10, 51,
+	42, -35, -52, 2, -10, -32, -33, 26, 40, 2, 33, 20, -12, -49, 20, 43,
+	15, 34, 68, 22, 19, 71, -6, 6, 4, 18, -89, -18, 48, 19, 47, -37,
+	45, 23, 0, 10, 21, 53, -22, 41, 20, 34, 30, 45, -37, 38, -10, -46,
+	-33, 24, -28, 1, 21, -23, -39, -76, -27, -33, 77, -27, 30, 17, 14, -12,
+	64, 13, 2, 24, -13, 32, -36, -24, -3, -37, 18, 8, -42, -19, 48, 46,
+	12, 11, -15, 46, -27, -43, -17, -10, 34, -49, 7, 70, 5, -30, 35, 36,
+	-21, 66, 78, 39, 35, 19, 13, 6, 26, 19, -40, -26, 10, 37, -58, -37,
+	4, -38, -2, -33, 4, 22, 50, 5, -55, 41, 27, -38, -61, -1, -54, 13,
+	35, -42, 44, -29, 22, -28, -17, -60, 53, -1, 70, -57, 11, -45, -53, 39,
+	45, -4, -3, -16, 51, 24, 42, -57, -6, -13, 25, -55, -29, 24, -24, -52,
+	-29, 69, -27, 69, 11, -41, 32, 36, 4, -22, -36, 38, 65, -11, 5, -52,
+	30, -22, 3, 43, 28, 56, -35, 30, 60, 43, -15, 7, 70, -42, 3, 47,
+	-81, 58, 28, 66, -26, -41, -37, 42, 38, 53, 45, -12, 74, 63, 18, 37,
+	69, -34, -37, 38, 40, -56, -62, -1, -10, 80, -82, -6, 50, 17, 6, -39,
+	50, 4, -5, -2, 65, 20, -32, -6, 53, 31, -2, -32, -48, 8, -54, -46,
+	3, 2, -21, 22, -8, -24, -45, -29, 44, 26, -49, 3, 46, 3, -34, -25,
+	40, 23, 39, 34, -12, -51, -20, 45, -43, 50, -38, -8, -46, -40, -2, -14,
+	46, 6, -18, 45, 42, 25, -8, -28, 21, -37, 18, -40, -32, -51, -18, 12,
+	40, 25, -47, -2, 0, -30, -4, -10, 25, -25, -31, -7, -17, -14, -4, 47,
+	44, -50, -29, -42, -37, -32, -3, 15, -16, -27, -46, -39, 30, 33, -4, 6,
+	-52, -42, 33, -54, 24, -15, -5, 34, 10, -33, -16, 24, -11, 46, -4, 11,
+	-29, -36, -7, 46, -42, 6, 48, 6, 18, -47, -39, 40, -53, 15, -29, 19,
+	50, -40, 14, 15, 60, 4, 28, -14, 3, 48, 43, 43, 16, -36, 49, -35,
+	14, -42, -55, 27, 14, -21, -48, 3, 15, -34, -13, -39, -22, 18, -21, 19,
+	14, -4, 42, 33, -22, 37, -29, 9, -36, 31, -53, 0, 4, 0, -11, -34,
+	46, -3, -12, -25, -22, 6, 43, -45, -50, -1, -33, -25, 24, 19, -41, -1,
+	10, -16, 2, -51, 0, -39, -53, 13, 2, -25, -43, -47, -53, -19, -22, 9,
+	-48, -12, 30, -17, 45, -16, 10, 26, 4, -15, -23, -19, -46, 33, -26, -39,
+	-29, -7, -7, -33, 13, -17, -40, -34, -28, 51, -34, -34, 28, 15, -23, -16,
+	37, 12, 64, 11, -20, 51, 33, -33, 44, -9, -21, -42, 22, -43, -16, -14,
+	-71, 5, 13, -17, -68, -16, 32, -8, 65, 38, -13, -2, 80, 23, 63, 8,
+	15, -43, 15, 43, -26, -5, -32, -31, -25, -35, 31, 23, -10, 14, 37, -25,
+	8, -33, 27, -7, -30, 8, -33, 78, 24, -89, 55, -30, 23, -37, -30, 65,
+	0, 70, -20, 42, 17, -6, -27, -46, -45, 65, -26, -22, -18, 24, 9, 69,
+	-5, -5, 60, -51, 11, -11, 51, -47, 0, 12, -53, 39, -25, 51, 20, 16,
+	66, -9, -23, -13, -18, -6, 40, -83, -35, 22, -11, 10, 23, 7, 5, -55,
+	6, 54, -80, 11, -56, 39, -34, 57, -7, 14, -55, -37, -55, -81, -18, 23,
+	50, 15, 57, -7, 31, -24, 8, -8, -25, -7, -32, 3, -28, 29, -10, -77,
+	17, 37, -33, 44, 33, -7, 52, 23, 24, 41, 49, -62, 3, -27, -1, -10,
+	10, 41, 58, 6, 42, -19, 77, 53, 17, 28, 17, 32, -33, 60, 27, -31,
+	50, -56, -25, 45, -72, 2, -40, -1, 10, -44, -106, 53, -31, 94, -37, -31,
+	-15, -15, -8, 61, 50, -9, 50, 25, 15, 24, -18, -18, 25, -31, 18, 32,
+	10, 25, 86, 23, 39, -15, 14, -61, -7, 55, -10, -31, -61, -76, -47, 69,
+	64, -30, -38, 48, 62, -60, -65, -41, 28, -39, 50, 37, 81, 1, 34, 53,
+	-22, -20, 25, -52, -2, 14, -45, -21, -23, -24, -56, -60, 10, 35, 2, -43,
+	-37, -40, 5, -36, 41, -62, 40, 31, 19, 48, 22, 9, -42, -8, 14, 0,
+	15, -6, 21, -18, 19, -10, 8, -18, 72, 22, 44, -40, 17, 25, 35, -61,
+	25, 9, -21, 4, 16, 36, -64, 22, 9, 3, 60, -23, -17, -29, -16, -5,
+	-9, 53, -36, 8, -39, -33, -40, 21, 24, -23, -31, 71, 29, -26, 4, -13,
+	-33, 13, 51, 38, 13, 23, -37, -10, -75, -22, -24, 25, -57, 48, -50, -22,
+	16, -16, -16, -65, -56, -13, 22, 69, 29, -21, -34, -33, 44, 80, -19, 48,
+	-20, 17, 29, -22, -61, 50, 47, -32, 1, 15, -75, 51, -9, 67, 62, 63,
+	-46, 38, 13, 59, -41, 2, 40, 50, 10, 16, -57, 18, 50, -45, 31, -60,
+	14, -91, 20, -4, 46, -33, 33, 13, 7, -16, 38, -48, -10, 9, -13, 61,
+	25, 51, -18, 48, -46, -31, 21, -28, -1, -6, -32, 41, -10, -61, -20, 1,
+	-34, 48, 61, 4, -10, 35, 59, -77, 48, 55, 34, 11, 43, 5, 46, 0,
+	15, 29, -35, 54, 50, -44, -66, 28, 48, 38, -4, -35, 18, -6, 0, -37,
+	-45, 86, 5, -26, -41, 25, -46, 35, -14, 28, -62, 7, 11, -19, -20, -50,
+	-41, -68, 70, 28, -16, 13, 21, 8, 66, 21, 0, -25, 9, -26, 68, -31,
+	-51, 25, 48, -26, 73, -65, 28, -25, 35, -59, 55, 7, -53, -17, 16, -24,
+	51, -16, -30, 14, -49, -29, -44, -9, -22, -11, -19, -15, 0, -43, -16, -21,
+	-11, 52, 36, -32, 21, -36, 5, -2, 44, -21, 25, 33, -27, -55, 57, 18,
+	54, 42, -45, 4, -26, 5, -55, -7, 13, 3, 29, 49, -41, -11, -30, 0,
+	-22, 4, 49, -57, -19, -4, -42, 51, 17, -18, -49, -17, 42, 20, 62, 34,
+	-5, 28, 78, 1, 18, 37, -44, 8, 21, 33, -27, -4, -33, -28, -23, 40,
+	-16, 9, -65, -7, 13, -37, -16, -24, 53, -22, -20, -38, 45, 18, 46, 25,
+	-37, -13, 46, 53, -11, 9, -32, 39, -28, 6, -55, -41, 32, -7, 34, 19,
+	-47, -9, 1, 1, 17, -52, 51, -40, 38, 39, 39, -16, 27, 41, 43, 25,
+	-30, -48, 21, 40, -32, -11, 14, 10, 16, 20, 53, -22, -13, 28, -8, -7,
+	-8, -51, -11, 6, -4, -55, -35, 46, -41, -1, -25, 16, -16, -52, -6, 53,
+	4, 58, 57, -22, 33, -26, 9, -34, 9, 60, 4, 30, -11, 20, 45, 44,
+	28, 42, -7, 50, -38, -42, 29, 33, 16, -40, -8, 74, 3, 46, 49, 16,
+	2, -33, -63, 12, -1, 5, 46, 48, 48, 57, 17, 9, 16, 2, 39, 12,
+	31, -30, 40, 19, -30, -33, 16, -43, 30, 15, -49, 42, 52, -19, -39, 42,
+	13, -30, 58, 39, 15, -31, 20, 5, 15, 8, 45, 34, -22, 39, 80, -67,
+	-3, -96, 63, -25, -2, 69, -54, -51, -7, -8, 63, -24, 50, -56, -79, -16,
+	57, -24, -45, -42, -37, 63, -65, 23, -51, 40, -36, -9, 38, -38, -46, 44,
+	0, 34, -6, 29, 8, -24, -55, 32, 42, -45, -8, -13, 52, -94, -2, -16,
+	41, -50, 37, -19, 19, -15, -16, -71, -52, -28, -58, 15, 24, -24, -31, 18,
+	7, 53, 18, 36, -1, 8, -24, 49, -13, 26, -65, 22, -79, 10, -20, 16,
+	-61, 23, -26, -13, -10, -19, -42, -17, 40, 48, -23, -27, -36, 16, 1, 25,
+	28, -25, -45, 46, -26, 29, 28, -67, 1, -2, -59, 52, -12, -24, 6, 69,
+	-49, -47, 14, 22, 32, -30, 37, -74, -32, -35, -14, 52, 14, 2, 49, -21,
+	3, 37, 22, -24, 19, -49, 9, -16, -19, -5, 33, -44, -45, 43, -11, 32,
+	32, 64, 33, -11, 27, 44, -36, 9, 39, 6, -7, 18, -22, 5, 43, 0,
+	23, -7, -17, 31, -5, 60, 47, 16, 44, 21, 1, -52, -33, -12, 40, 6,
+	53, -20, -6, -55, -24, -3, 1, -5, 31, 24, -57, -3, 1, 21, -11, 39,
+	-16, -16, 34, -25, -8, -22, -25, -4, 19, 45, -11, 16, 19, -36, -21, -25,
+	0, -20, 40, 43, -25, -58, 47, 58, 39, 28, -43, 4, -15, 19, 7, -1,
+	-34, -56, 35, -29, -63, 14, -49, -20, 53, 34, 39, -39, -29, 34, 33, 7,
+	48, -6, -25, -2, -31, 17, -11, 41, -34, -22, -20, -4, 10, -47, 55, -49,
+	-28, 22, -10, -46, 1, -41, -3, -27, 45, 57, 2, -52, -22, 27, 37, 42,
+	20, 9, -8, 62, 2, 43, -35, -4, 5, -11, -17, -2, -12, 61, -5, -49,
+	-10, 9, -78, 23, -17, 14, 50, 9, 14, -2, 33, 41, -4, -62, -9, -34,
+	63, -62, 0, -11, -18, -37, 34, 11, -28, -73, 33, 47, 51, -21, -46, -15,
+	-9, -45, 43, -4, 47, 22, -2, 15, -4, 4, 31, 29, 41, 12, -41, 4,
+	-30, 8, 2, 25, -44, 22, 25, -5, 25, 16, -4, 28, 34, 8, 47, -3,
+	57, -18, -25, 22, 13, 52, 44, -57, 16, 32, 63, 33, -49, 33, -13, 41,
+	13, -46, -25, -25, -1, 67, 60, 41, -1, 12, -15, -35, 38, 19, -36, -31,
+	-36, -23, -27, 9, 37, 5, -34, -35, 21, 23, 15, 32, -45, -27, 3, 50,
+	14, -26, 5, 9, 2, 48, 20, 29, -17, 26, 34, 51, 55, -10, -43, -9,
+	17, -30, 54, -27, -29, 21, 17, 34, 41, 39, 61, 33, 37, -31, 43, 26,
+	32, 22, 40, -34, -33, 29, -24, -50, 8, -60, 35, -28, -30, -10, -11, 10,
+	37, 23, -8, -17, -9, 25, -6, -24, 25, -53, -33, -55, -28, -15, -41, -18,
+	11, 26, 10, 65, 12, 51, -45, -32, 26, 15, 5, -30, 50, 51, 18, -40,
+	-38, 51, 26, 15, 19, 5, -21, -35, 22, 78, -14, 95, 21, 68, 16, 20,
+	-4, 71, -8, -45, -27, 0, 33, -30, 68, 25, 56, 58, -53, -14, -26, -27,
+	-37, -44, -5, 19, -42, 23, 31, 30, -13, 7, -12, -27, -35, -55, -39, 16,
+	20, 17, -29, -32, -16, 4, 22, 39, 15, 3, -24, 72, -50, -51, 29, 32,
+	19, 21, 28, 25, 13, -15, -56, -6, 8, -37, -36, 3, 49, 35, 40, 48,
+	-42, 13, -31, 4, 27, -13, 20, 30, -27, 11, 56, 59, 6, 46, 45, 67,
+	-34, 49, 65, -74, 60, -13, -41, -52, -6, 46, 30, 66, 13, -50, -41, 5,
+	15, 34, -23, 0, -30, 9, -17, -55, 18, 63, -37, 70, -12, -49, -13, -13,
+	-17, -4, 8, 32, 39, -19, 54, -4, -11, 67, 38, -30, -30, -35, -31, -52,
+	29, 29, 5, -26, -10, -56, 70, 12, 32, -69, 22, -4, -50, 67, 61, 3,
+	23, -34, 23, 37, -43, -40, -49, 23, -13, 30, -30, 13, -66, 0, 59, -54,
+	-25, 30, -5, 22, -32, -85, -63, 32, 14, 28, -37, -26, 43, 28, -58, 18,
+	-13, 41, 15, 77, -32, -46, -39, 41, -85, 48, -55, 8, -11, -48, 91, 63,
+	55, -43, 41, 55, 44, 39, -73, 9, -30, -71, 22, 32, -28, 18, 3, -65,
+	-20, -15, 56, -45, 47, 60, -60, -86, 7, 13, 30, 34, -2, -29, 33, 23,
+	43, -45, 6, -24, 23, 43, -52, 36, 25, 68, -16, -29, 18, -47, 56, 62,
+	-32, -32, 59, -40, -29, 29, -32, -50, 28, -11, -18, 28, -17, -39, -10, 39,
+	14, 35, -29, -24, -16, 42, 24, -97, 50, 42, -53, -14, -29, 66, -29, 33,
+	-69, -30, -30, -28, -26, 71, 68, 50, -49, -24, -11, 8, 30, -15, -6, -19,
+	-18, -57, 33, -59, -20, -15, 54, 67, -13, 2, 9, 5, -50, 12, 66, 16,
+	-52, 13, 36, 69, 9, -37, 37, -62, 35, 31, -47, 66, -27, 19, -9, 48,
+	35, -29, -95, 49, 45, -35, 20, 13, 16, 10, 47, 17, 44, 44, -23, -65,
+	48, -52, 19, 6, 22, 37, -8, 53, -8, -27, -34, 29, 12, 13, 15, -9,
+	35, -63, -90, 35, -53, 38, 17, 4, -10, -45, 7, -7, -1, -31, -15, 2,
+	-62, 24, 50, -5, 70, 50, -75, -36, 17, 59, 15, 52, 49, 16, -62, -3,
+	16, 18, -53, 13, 27, 18, 1, 70, -22, 77, 2, 68, 55, 44, 44, 47,
+	-59, -4, 46, 56, -61, -17, 44, -58, 61, 49, -21, 19, -2, 28, 32, -65,
+	9, 35, -15, 8, 7, -36, 3, -66, 0, 1, 20, -7, 26, 15, 49, -20,
+	-28, -51, -62, -6, 52, 48, 4, -39, 71, -52, 23, 41, -3, -66, -76, 21,
+	42, 38, -4, -22, -36, -27, 40, 90, 36, -18, 37, 47, 25, -23, 59, -36,
+	-12, -17, -2, -11, 1, 23, 10, 16, 5, -47, 16, 44, 70, 17, 81, 13,
+	-35, 5, -60, 7, -57, 43, 14, -12, 16, -43, 74, -32, 33, 20, -16, -34,
+	94, -64, 16, -2, 23, 29, 50, -20, 54, -15, -8, 13, 9, 54, -5, 20,
+	21, 45, -49, -3, 17, 37, -67, -23, 3, 13, 20, -11, -35, 14, -5, -30,
+	-26, 45, 50, 36, 33, 36, -44, 8, -10, 34, -27, 31, 11, 7, 41, -44,
+	-28, -16, -37, -36, 21, 54, 81, -42, -29, -21, -42, -28, -16, 50, -17, -60,
+	43, 56, 61, -69, -51, -11, -82, -59, 16, -32, -36, 12, -6, -48, 82, -20,
+	22, -36, 17, 24, 23, -6, 2, -7, -69, -33, 14, 41, 35, 51, 8, 61,
+	-6, 28, -47, 45, -9, -13, -26, -42, -27, 21, -26, -11, -13, 47, 49, -43,
+	24, -41, 63, 29, -39, 26, -28, 49, -61, 68, -42, 28, -4, 31, 38, -52,
+	-13, -44, 40, -18, 56, 92, 65, 35, 58, 32, 27, -13, -10, -17, 48, 10,
+	-49, -17, -60, -2, 31, 51, -35, 20, 26, -74, 39, 54, 60, 20, -40, 1,
+	-26, 14, -15, -15, 45, 13, 16, -10, -37, -46, 16, -61, 41, -38, -19, 3,
+	18, 16, 17, -46, -24, -54, -48, -23, 26, 20, 29, 7, 43, -53, 64, 22,
+	37, 78, 44, 3, -19, -45, -12, -20, -20, -3, -4, 42, -40, 6, 48, 38,
+	72, -41, 81, 17, 6, -11, 76, -45, -23, 3, 33, 5, -12, -38, 25, 33,
+	1, 9, 62, -44, 33, -62, 45, -54, 45, 13, -2, -26, -11, 69, 80, 3,
+	63, 21, -3, 63, 24, -26, -28, 39, 4, -20, -23, -47, -26, 49, 26, 14,
+	-16, 57, 56, -25, -19, 12, -3, 5, 52, -40, -37, 2, -55, -81, -33, 14,
+	79, 44, 22, 8, -3, 30, -6, 39, -43, 24, -13, 14, -5, 52, -23, 13,
+	-8, 101, 52, 17, -47, 33, 2, -30, -48, -58, 12, 50, 43, -10, 29, -32,
+	20, -43, 8, 9, -24, 10, -21, -68, 10, 27, 56, 63, -4, -13, 20, -3,
+	-32, 11, 13, -18, -30, -20, -27, 11, -87, -40, -52, 51, -20, 53, 21, -16,
+	-38, 7, -40, -53, -60, 77, 16, 48, 24, 58, 14, 4, 55, 27, -21, 16,
+	-16, -59, 54, 15, 53, 21, 70, -33, -27, -22, -25, 50, -10, 45, -7, 25,
+	-38, 87, -29, 44, 25, 50, -23, -37, -38, -80, 22, -13, -15, -21, 1, -52,
+	56, 26, 28, -67, 5, 49, 4, 33, 19, 5, 15, 4, 68, 35, -54, 80,
+	-52, -48, 24, -13, -54, 7, 51, -33, -22, -7, 5, -9, -12, -15, 72, -19,
+	44, 27, 23, 14, -61, -4, 30, -30, -29, 90, -66, -1, 10, -1, 53, 19,
+	-24, 36, -39, -20, 63, 2, -25, -75, 21, 40, -55, 49, -86, -22, 48, 1,
+	0, 36, -43, -33, 10, 77, -11, 83, -26, -34, 47, -29, 32, -25, 20, -20,
+	49, 34, 3, -18, 45, 57, 17, 20, 59, -72, -18, 74, 3, -14, 37, 72,
+	4, 48, 8, 53, 9, -17, 15, -19, 29, -40, -38, -39, 42, 46, -7, 19,
+	6, -13, -44, -34, -1, 10, -54, -35, 49, -13, 71, 1, 11, 14, 28, -27,
+	-15, -15, -15, 57, 25, -15, -45, -6, 32, -29, 0, -12, -16, -55, 25, -20,
+	19, 82, 15, -5, 18, 46, -65, 14, -22, -8, -3, -41, -84, 49, 39, 40,
+	-24, -20, 42, -40, -47, 81, 45, -29, 15, -16, 50, 44, 1, 39, -24, 32,
+	-44, 29, -5, -15, 70, 39, 19, -57, 45, -42, -50, 74, 26, 49, -24, 17,
+	-52, 7, -23, 15, 68, 26, 36, 31, 26, 54, 24, -2, -35, -10, -6, -10,
+	-36, 6, 6, -43, 38, -34, 24, -36, 0, 55, 2, 6, 24, -15, -12, -6,
+	-12, -22, 21, 31, -22, 48, 49, 47, -12, 4, 38, -26, -22, 22, 6, -63,
+	14, 58, -9, 53, 17, 55, 9, 56, -57, -44, -40, 7, 2, 62, -27, -1,
+	10, 34, -1, 16, -4, -15, -31, -2, -43, 47, 63, 9, 32, -51, -101, 38,
+	-54, 4, 17, 79, 61, -25, -61, 31, -16, -41, 47, 1, -69, 51, -13, 25,
+	26, 53, -75, -47, -56, 26, 29, -53, -72, -44, 21, -16, -12, -81, 18, -6,
+	-40, -36, 46, 28, 33, 75, -48, -34, -6, 35, -59, 11, 14, -26, -68, -47,
+	41, -20, 47, 23, -9, 35, 4, -28, -38, 41, 53, 44, 47, -37, 6, 29,
+	47, -4, 41, 25, 20, -42, 56, -23, 32, 41, 4, 5, -53, 30, 28, 38,
+	21, -20, 48, -56, -20, -8, 31, 21, 65, -27, -42, 52, 14, 30, -24, -42,
+	40, 16, -44, -48, 16, 2, 39, -39, -46, -22, -60, 3, -19, -9, -36, -43,
+	-76, -28, 54, -41, -17, 50, 28, -12, 11, 10, 33, 1, -18, 44, 17, 14,
+	69, -25, -48, 38, -70, -13, -20, 2, -7, 62, -29, 52, -16, -35, -6, 59,
+	-23, 33, 38, 20, 8, -56, -27, -38, -46, -5, 68, 34, 0, 39, -49, 38,
+	-38, -22, 45, -39, 58, 39, -50, -59, -31, 43, 76, 7, 16, 40, -49, 4,
+	29, 52, -7, -49, 28, -12, 20, -27, 2, 12, -23, 45, -43, -25, -38, -39,
+	14, -46, 44, -26, -51, -51, -20, 31, -32, -17, -23, 73, -50, 20, 12, -44,
+	22, 46, 22, -25, -17, -37, -19, -27, -5, 13, -37, -5, -16, -11, 53, 15,
+	2, -46, -23, 5, 36, -40, 23, 23, -16, 88, 34, 33, -14, 6, 27, -13,
+	-28, 77, 2, -18, 10, 52, -31, 9, -16, -27, 1, 12, -56, -24, -19, -35,
+	21, 42, 62, 6, 44, 19, 16, -39, 75, -6, 38, 54, 67, -9, 52, 8,
+	-50, -58, 1, -4, 38, 21, -34, 20, 14, 2, -10, 37, 36, 17, -9, 3,
+	-45, 54, -77, -12, -25, 71, -75, -45, 31, 44, 42, -45, -23, 87, -50, 47,
+	16, 36, -21, 20, 13, 21, -28, -29, -30, 26, -24, 42, 25, 16, 101, -31,
+	-42, -55, -23, -14, 12, 58, -38, -5, 69, 19, -2, -23, 102, -2, -27, -24,
+	53, -31, 23, 22, 21, 44, 55, 23, 9, 24, -21, -8, -13, 18, -24, 5,
+	-16, -12, 52, -9, -1, 42, 38, -8, -11, 33, -57, 42, -5, -30, 17, 50,
+	-61, 15, -37, 50, -18, 6, 23, 28, 80, 29, 47, 47, -15, 9, -2, -24,
+	11, -4, -25, 41, 66, 9, -30, -36, 3, 13, -49, -21, -6, 13, 42, 21,
+	35, 27, -1, -58, 62, -33, -18, 28, -16, 11, 63, 8, 43, -69, 74, 31,
+	-37, -20, -2, -2, -20, 23, -48, 20, 12, 4, -19, 28, -2, 14, -9, -50,
+	-33, -65, -35, -29, 24, 50, 40, 66, 32, 51, 29, -21, 36, 6, -37, -26,
+	34, 28, 16, 65, -25, -5, 3, 29, 42, -4, -2, -78, -2, 28, -16, -29,
+	23, -49, -25, 15, 7, 13, -15, 60, -50, 71, -27, -36, -10, -40, -15, 14,
+	-20, 17, 29, 4, 32, -51, 3, -4, 13, 25, -53, 8, 42, 49, -30, -4,
+	-4, -10, -4, 0, -18, 4, 23, 82, 48, -21, -39, -17, 57, -15, 34, 2,
+	-21, -2, 30, 13, -39, -3, 41, -11, 14, -26, 30, -6, 18, -17, -74, -63,
+	35, -9, -31, 47, -48, 60, 46, -32, 11, 66, -37, -50, 0, 66, 56, -45,
+	58, -1, -46, 14, -30, 55, -15, -1, 73, -4, -7, 24, 16, 43, 14, 4,
+	41, 14, -62, -21, -8, 81, 71, -5, 92, -45, 35, -77, -3, -10, 10, -39,
+	-44, -4, 25, -20, -29, 11, 95, 4, -38, -41, 15, 22, -3, 24, -36, 40,
+	-20, -8, -20, 81, 8, -14, 23, 0, 18, 28, 3, 8, -29, 37, 52, 9,
+	-10, 31, -25, -43, 86, -22, -31, 50, 56, 41, 66, 52, 57, 103, -7, -40,
+	4, -34, 70, 61, 2, -34, -12, 39, 2, -81, 41, 66, -58, -59, -24, -26,
+	56, 45, 98, -115, 105, 33, 41, 1, -10, -32, 4, 7, 0, -16, 41, -60,
+	61, -27, 82, 50, -23, -64, -8, 10, 30, 35, 57, 76, -54, 40, -86, -55,
+	-70, -18, 36, 32, 2, -50, 67, -56, 11, 13, -24, 3, -53, 9, 48, 79,
+	8, 100, 39, -57, 17, 54, -2, 27, 14, -81, 47, 18, -26, 41, 70, 73,
+	72, -51, 9, -106, -50, -42, 53, -3, -27, -79, -85, 65, -27, -25, -60, 51,
+	51, 83, 36, -32, 10, 5, 62, 81, -45, -2, 24, 9, 20, -24, 43, 0,
+	-29, -35, 30, -47, 56, 1, -18, -23, 2, -56, 34, 21, -6, 72, -18, 42,
+	25, -41, 13, -10, -75, -25, 13, -10, -45, 40, 69, -8, 51, -45, -26, 78,
+	-48, 34, 3, -8, 72, 27, -19, 38, 27, -36, -16, 46, 47, -98, 14, -37,
+	27, -26, -4, 91, -31, 66, 5, 26, -30, 70, -72, 38, 17, -32, 20, 6,
+	54, -7, -21, 7, -47, 51, 54, 54, 53, 94, 40, -51, 66, -14, 3, -65,
+	61, 13, 49, 13, -44, 14, 70, -82, 34, 4, 50, 30, 26, -17, 93, -16,
+	38, 54, 60, -36, -27, 51, -43, -29, -43, 11, 61, -13, -27, 13, 55, 34,
+	36, 24, -17, -4, -57, -24, -22, 37, 32, -13, 46, 4, -21, -9, 4, 10,
+	-53, 9, -55, 18, 25, 30, 36, 43, 22, 30, -24, -6, 13, -27, 12, -15,
+	-13, 21, 11, -40, -23, -39, -42, 21, -12, 44, -17, -46, 17, -32, -19, 51,
+	-58, -9, 26, 25, -4, -19, 37, -28, 47, -11, -47, -28, 39, -28, -39, -51,
+	52, -31, -55, -33, -14, 24, 13, -34, -44, -25, 38, -28, -27, 36, 54, 45,
+	-44, 24, -23, 8, -23, -2, 55, 9, -20, 25, 41, -27, 3, -42, 12, -14,
+	32, 58, -19, -5, -5, -12, -24, 19, -17, 21, -32, -11, -28, -34, -19, -55,
+	32, 21, 52, 21, 34, 16, 39, -42, -22, 22, -18, -39, -48, 23, 29, 8,
+	40, -9, 50, -45, 13, 15, -51, 8, -2, 13, 3, -22, 8, 43, 22, -12,
+	-19, -13, -31, 36, -30, -40, 7, -6, 44, 11, 24, -8, 47, 19, 6, -58,
+	-14, 33, -34, 23, -17, 33, 51, 20, -33, 23, 39, 27, -16, 51, 17, 7,
+	-40, -26, 25, -21, 21, 21, 8, 9, -16, -20, 3, 22, -12, 50, -45, -45,
+	-16, 15, 1, 9, 9, -19, -42, 34, -25, -39, 11, 31, 11, 50, -42, 10,
+	-35, -19, 4, 53, -36, 0, -23, -11, 8, 13, 25, 3, 12, -28, -33, -35,
+	-17, 47, -19, -16, -5, -21, -49, 21, 45, 12, 11, 30, 46, -2, 23, -53,
+	-28, -12, -6, -54, 40, 26, 55, 28, 59, -46, 43, 45, -32, -22, 43, -54,
+	-29, -32, 45, -12, 46, -5, -18, -11, -34, 39, -36, -36, -51, 39, -43, -22,
+	6, -41, -53, -9, 14, -29, -13, -40, -32, 12, -42, 35, 28, -16, -18, -22,
+	-34, 45, -59, -10, 8, 44, -9, 30, -19, 11, -16, 9, 27, -38, 5, -29,
+	-26, 14, -23, 4, 8, -14, 3, 7, 41, 18, -26, -14, -22, -37, 33, -27,
+	-6, 33, -46, -27, -17, 28, -34, -29, 1, -53, -1, -16, -18, 33, 35, -21,
+	45, 0, -31, 0, 18, -21, 18, -44, -10, -25, 22, 28, -63, -9, -52, -12,
+	3, 4, 41, -26, -1, -26, 2, 4, -33, 33, 49, -8, 40, -1, -28, 33,
+	18, 48, -9, 44, -20, -43, -19, 1, 55, 56, 26, -8, 25, -26, 6, -35,
+	36, 8, 12, -32, -22, 41, -15, -24, 45, -16, -3, 22, -36, 42, 51, -20,
+	36, -24, -37, -31, -2, 1, -12, 36, 30, 33, -42, 19, -43, 25, 6, -8,
+	36, -44, 57, -12, -16, 59, -28, -9, 47, 4, 20, 3, 12, 30, 15, 32,
+	-22, -20, 15, -39, 2, 49, 17, 24, 35, 41, -37, 41, -25, -35, -13, 47,
+	5, -28, 35, -18, 35, -52, 41, 56, 38, -45, 42, 30, -4, 32, -62, 42,
+	37, 25, 40, 66, 32, -10, 25, -5, 71, 26, -25, -23, 78, -125, 38, 46,
+	-64, -55, 92, 84, -25, -28, -10, 7, -87, -27, -11, 4, -27, 46, -45, -5,
+	-7, -7, -14, -22, 22, 25, -66, -10, -40, 37, -36, -22, -39, -13, 41, 51,
+	-38, 54, -27, 69, -39, -68, 10, 21, 37, 8, -61, -4, -33, 58, -1, 34,
+	43, 75, 37, -30, -6, -20, 18, 7, -32, -5, 34, -28, 62, 42, -23, 24,
+	-29, 63, -33, -44, 0, -41, -13, -17, 2, 60, 39, 28, -7, 1, 7, -71,
+	-71, -52, 35, 22, 13, -45, 55, 1, 50, -67, 22, -12, 47, -29, -2, -15,
+	39, -23, -32, -49, 25, 58, 69, -20, -31, 3, 19, 4, -7, 35, 26, 12,
+	-80, 22, -9, -4, 2, 51, -37, 17, 84, 54, 18, 55, -50, -43, -26, 12,
+	74, 15, -17, 14, 19, 17, -38, -34, -44, 48, -10, 34, -25, -21, -25, 63,
+	29, 2, -14, -42, -72, -12, 10, -29, 70, -47, 32, 70, 16, 79, -14, -36,
+	50, 46, -20, -93, 36, -12, 42, -60, -69, 31, -57, -9, -80, -2, 67, -67,
+	-34, -22, -15, 45, -52, 18, -49, 59, 5, 27, 33, 108, 36, 18, 0, -35,
+	-47, -54, 19, -40, 46, 31, -44, -33, 54, 24, -29, -34, 16, -10, -38, 66,
+	-31, 4, -12, 10, 2, 34, 21, -6, 23, -21, -29, -18, 6, 24, -70, -42,
+	-33, -28, -66, 39, -41, -40, 11, 8, 35, 67, -3, -18, -64, 44, 3, 16,
+	72, -3, 56, -6, 27, -36, -46, 56, 40, 46, -11, -34, -4, 37, -7, -34,
+	54, 22, -35, -16, -32, -39, -57, 33, 15, 16, 50, -2, -7, -11, 8, -39,
+	23, -38, 48, 4, 5, -33, -78, -17, -5, 25, -32, -4, 54, 31, -60, -9,
+	-22, 30, 17, 30, 12, -26, 10, 31, -37, 5, 62, 10, -58, -28, 42, -39,
+	62, 11, 4, -54, -49, 40, -23, 58, -73, -55, -60, -36, -66, -30, 50, -11,
+	-21, -41, -7, 3, 32, -3, -11, 29, -17, -28, -13, 15, -14, 35, 14, -8,
+	-23, 37, 68, -2, -12, 32, -24, -45, -54, -28, 42, 15, -13, 36, 12, -41,
+	-33, 52, 17, -7, -40, -73, -8, -11, 46, 1, 55, -10, 8, 62, -21, 44,
+	31, -9, 36, 46, 33, -11, -4, -9, -1, 40, -29, -23, 14, 19, 29, 34,
+	17, -18, 27, 25, -1, -11, -7, 21, 62, 66, -25, -23, 50, -49, 9, -45,
+	56, 3, -62, 7, 6, 4, -11, 38, 34, 11, -16, 47, 10, -36, -36, -37,
+	-24, 2, 52, 12, 30, -55, 49, 8, 7, 18, -4, -42, 22, -16, -47, -14,
+	42, -9, -46, -48, 41, -38, -61, 62, 54, -22, 29, -46, -34, 3, 62, -2,
+	43, -5, -30, 41, 4, 14, 15, -10, 0, 15, 15, 25, 7, -7, -10, 24,
+	-5, 34, -17, 16, -24, -51, 22, 43, -35, 41, -34, 37, -5, 29, 0, 31,
+	36, -23, -10, 4, -78, -20, 36, 23, -61, 27, 25, 31, 8, 27, -24, -63,
+	14, -50, -57, -44, -42, -25, 19, -13, 25, -39, 14, 42, 34, -33, 30, -7,
+	-12, 55, 79, -41, 28, 26, -77, -25, -2, -41, -80, -41, 32, -37, 83, 32,
+	5, 80, 46, -58, 43, 25, -24, 25, 59, 50, -31, 25, -47, -1, 56, -5,
+	-22, -37, -66, -16, 38, -29, -26, -3, -12, 37, 40, -4, 4, -16, -28, -3,
+	16, -35, -37, 33, 16, 23, -48, 13, 14, -17, 21, 6, -47, -34, -5, 31,
+	-47, 49, 18, -5, -60, 4, 10, 46, -26, 13, -29, 11, 0, 10, -30, 53,
+	27, 23, 54, 55, -16, 1, -1, 63, -43, 39, 44, -74, -36, 26, 11, -6,
+	-55, -62, 33, -70, -44, -48, 8, 22, 2, -23, -64, -25, -11, 22, 55, 22,
+	-21, 7, 0, 0, -24, 42, 64, -2, -64, 36, -59, 25, 34, -25, 54, -4,
+	26, 13, 65, -18, -2, -8, -21, -58, 16, -19, 0, -32, 42, 25, 35, 0,
+	9, -24, -67, 39, 82, -16, -33, 46, -41, 2, 7, -28, -74, -52, -51, 69,
+	-26, -76, -2, 36, -40, -18, -78, 14, -12, 22, 18, -59, -14, -14, 20, -9,
+	48, 58, 66, -16, 5, 13, 3, 67, 1, -12, 3, 86, -32, 18, 14, 46,
+	-5, 35, 8, -22, -83, 18, -4, 42, 79, -14, -10, 38, -81, -15, 40, 29,
+	-58, 45, -17, 26, 42, 55, 19, 16, 34, 19, -7, -20, 2, -21, -66, -33,
+	-27, -97, -22, -16, -22, -11, -25, -11, -106, 82, -21, -2, 19, 3, -37, -17,
+	76, 81, -97, -83, 14, 2, -33, 76, -37, 58, -6, -12, 14, 49, -28, -75,
+	38, 2, 15, 16, -25, -19, 14, 34, -38, 64, -32, 53, -19, 69, 39, -43,
+	1, -21, 9, -29, -53, -2, -56, 13, -82, 58, 19, -40, 45, -58, 15, -10,
+	21, 24, -35, 23, 67, -34, 22, -29, -19, -16, 63, 13, 0, -22, -33, 5,
+	46, 61, -62, -5, 3, 25, -18, 37, 15, 0, 46, 38, -12, 63, 45, -42,
+	-71, 40, -50, 78, -27, -1, 17, -39, 17, 14, 33, 18, 96, 12, 30, 44,
+	38, 17, -49, -2, -35, 66, 44, 61, 9, 18, 1, -35, 20, 22, -6, 27,
+	-2, -33, 81, -6, -61, -35, 48, 5, -20, 54, 40, 49, 50, -8, -20, 112,
+	-34, -65, 12, -13, -38, -24, -74, -34, 87, -2, -35, 8, 34, -36, 58, -16,
+	34, -33, -6, 29, 32, 12, -35, 26, -35, 11, 57, 50, 32, 2, -2, -1,
+	49, 0, 65, 42, -4, 5, -3, 14, 4, 34, -25, -44, -37, 11, -5, 20,
+	31, -12, -38, -43, -39, 52, -36, 51, -37, 4, -29, 20, 14, 36, 4, 29,
+	24, 42, -21, -54, 20, 40, -31, -33, -25, 54, -10, 22, -45, -61, -36, -56,
+	40, -25, -13, -6, 6, 31, 33, 40, 4, 44, -1, 4, 46, 6, 31, -24,
+	-34, -42, 42, 17, -59, 17, -28, -11, 59, 29, -20, 8, 16, 66, 23, -13,
+	35, -11, 24, -1, 48, 5, 11, 24, -19, 45, 32, 1, -13, -22, -4, 0,
+	6, -58, 77, 10, 24, -49, -27, 52, -45, -9, 40, -10, 15, -22, -1, 15,
+	48, -7, -12, -55, 1, -37, -42, 46, -38, -22, 3, 51, -39, 30, 40, 47,
+	-21, 6, 16, 60, 43, 22, 39, 19, -28, 39, -33, 10, 23, 12, -1, 49,
+	18, -52, 5, 42, -58, -19, -28, 14, -37, 9, -2, -37, -42, -18, 15, 35,
+	-41, -1, -27, 31, -4, 10, -13, -47, -41, 39, 52, 37, 36, 32, 40, -24,
+	-16, 8, 27, 0, -46, -38, -9, 31, -15, 49, 45, 8, -45, 0, 56, 12,
+	11, -29, -25, -6, 38, -11, -8, 26, 11, -6, -25, -42, -13, -36, -54, 9,
+	73, 47, -4, 8, 25, 38, 28, -8, 30, 41, 14, 44, 28, -17, -26, -48,
+	13, 49, 39, 47, 14, 2, 20, 39, 57, 61, 10, -99, 21, 22, 40, 6,
+	29, 12, 68, -35, -52, 26, -8, 18, -31, -11, -46, 40, -38, 19, -19, -36,
+	69, 11, -31, 5, 22, -9, 16, 10, 30, 14, 6, -10, 56, -17, 79, 11,
+	-23, -46, -38, 9, 19, -78, -65, 32, 35, -50, -25, -39, -41, 14, 24, -5,
+	18, -23, 4, -52, -36, -39, -7, 27, -31, 36, -13, 14, -26, 33, 9, 20,
+	47, -44, -49, 88, -19, -55, 38, -41, -37, 57, -22, -30, 81, 65, 3, 1,
+	17, 27, 27, -37, -28, 24, -19, 37, 44, 39, -1, 22, 24, 64, -43, -88,
+	-32, -4, 78, -5, -18, -28, -24, -21, 5, -46, -4, 17, -54, 70, -69, -31,
+	54, 12, 24, -39, -25, -52, 46, -60, 50, 58, 33, 36, 103, 23, 81, -53,
+	-72, 48, 8, 58, 29, -34, 45, 40, 58, 53, -5, 23, -27, -60, 7, 15,
+	56, -4, 42, -47, -16, 60, -2, -18, 39, 57, -117, -6, 30, -39, 48, 85,
+	9, -14, -19, -49, 42, -45, -22, 3, 40, 10, -13, -53, 1, -21, 22, 17,
+	54, 26, -37, -10, 21, -22, -38, -28, 26, -6, 36, -26, -39, -2, -43, -15,
+	38, -11, 32, -51, -43, -52, 22, 35, 76, 38, -30, 1, 9, 16, -32, 31,
+	-50, 26, 7, 40, -38, -15, 36, -6, -6, 38, 48, 9, 44, 39, 26, 41,
+	53, -54, -46, -10, 31, 49, -54, 15, -37, 36, 34, -37, 2, 15, 57, 12,
+	-19, 47, -14, 11, 6, -4, 20, 5, -22, -51, -37, -25, -31, -6, 38, 19,
+	-38, 11, -54, 6, -23, 35, -22, 27, 32, -49, -17, 22, -30, 38, -40, -27,
+	13, -48, -19, -19, -25, -36, 3, -51, 43, -40, -38, -3, -7, 29, -43, 8,
+	8, 41, 1, -2, -50, -17, 35, 2, 32, -18, 51, 50, 41, -27, -4, 46,
+	7, 27, -34, 23, -30, 14, -3, 41, -25, 36, 61, 19, -38, 32, 43, 20,
+	16, 8, -48, -23, -50, 35, -70, 9, -16, 12, 29, 16, 21, -48, -34, 17,
+	1, 30, -40, -39, 12, -35, 50, 0, -29, -6, -16, 5, 26, 30, -67, -46,
+	11, -40, 4, 10, -29, -48, 50, 20, -37, 19, 9, -20, 15, -14, 29, -17,
+	11, -52, -29, 27, -30, -28, -17, 35, -7, 7, -55, -17, 6, 40, 40, -51,
+	63, 42, 14, 40, -40, -3, 45, -1, -9, 58, -28, 16, -28, -12, 24, 43,
+	4, -5, 3, 24, 45, -34, -48, -1, -28, 48, 29, 1, -31, 43, -4, 59,
+	-45, 26, 36, 30, -46, 44, 21, -43, -15, 23, 49, -8, 3, -33, -18, 18,
+	-8, 28, -15, 25, 7, 17, -20, -55, 23, 36, 52, 24, 29, 18, -24, 39,
+	71, -21, -51, 38, 55, 17, 35, 4, 0, 4, -49, -24, 7, 17, 36, 49,
+	-16, -27, -35, 44, 15, 52, 8, -37, -37, -48, -22, 21, 27, 54, -36, 33,
+	5, -6, -4, -36, 28, 14, 36, -24, 26, -23, -40, 13, -19, -14, -28, 43,
+	-6, 24, -29, 39, 71, -14, 50, -8, -2, 6, 14, 46, 54, 44, -2, 37,
+	24, 30, -15, -7, -27, -37, -39, 15, -43, 15, 35, -36, 66, 60, -38, -28,
+	-10, 25, -48, 0, -25, 15, -30, 29, -34, 26, 62, 49, -1, -36, 62, 21,
+	-27, 2, 6, 59, 5, 61, -35, -51, -18, -5, -29, 39, -13, 4, 8, 35,
+	-2, 11, -37, -41, -31, -15, 3, -21, 8, 24, -25, -30, 46, 47, 35, -20,
+	56, -60, 39, 27, -49, -40, -44, -39, -5, -64, 31, -21, -29, -2, -9, -13,
+	-34, -42, 19, 28, -34, -33, 39, -14, 35, -25, -46, 61, 30, 0, 23, 78,
+	1, 17, -30, 27, -16, 37, 31, 45, -36, 10, -26, -4, 5, 14, 41, -37,
+	36, -43, 22, 9, 75, -36, 16, 28, 5, -44, -19, -37, 6, -38, 19, 4,
+	-9, -44, 22, -11, 7, 36, -20, 73, 27, 12, -31, 68, -1, 14, 44, -1,
+	10, -31, -43, 3, -62, -20, 13, -45, -10, -53, -16, 32, -19, 55, -27, -9,
+	-23, -13, -27, -18, 23, 17, -46, 14, -40, -34, 14, 19, -50, 37, -16, 8,
+	-4, 35, 18, 28, -18, -31, 14, 52, 35, -26, -34, -46, -31, 18, 35, 37,
+	-43, 33, 40, -35, -12, -16, 45, -23, -52, -31, -8, -9, -31, -28, 11, 8,
+	12, 0, -49, -13, 41, 26, 11, -19, -48, 25, 34, -25, 15, -43, 22, -14,
+	-43, 20, -8, 39, -42, -1, -32, 25, 34, -28, 20, -50, -40, 26, -16, -18,
+	-14, -21, -46, 21, 1, 22, 43, 4, 45, 7, -8, 35, -9, 28, 25, -37,
+	-33, 4, -10, 51, -8, 51, -45, -36, -20, -10, -5, 27, -25, -47, 25, -40,
+	25, -17, -39, -23, 46, -23, 54, -43, -3, 25, -28, -9, 25, -42, 31, -13,
+	42, 19, -52, -56, 11, 20, -8, -37, 43, -21, 7, -1, -42, 49, -37, 12,
+	-28, 33, -4, -38, 49, 2, -52, -3, -8, -39, 37, -18, -20, -6, 40, -53,
+	15, -4, 28, 36, -32, 13, 18, -27, -1, -14, 43, 28, -21, -39, 50, -37,
+	3, -17, 4, 11, 42, 26, -7, 53, 18, -24, -30, -35, 37, 38, -8, -4,
+	14, 11, -52, -24, 4, 32, -15, -2, -44, -28, -16, 14, -40, -23, 2, -20,
+	-12, 20, -21, 23, -13, -40, 5, 57, -5, 11, -8, -14, -40, -32, -18, -15,
+	35, -27, 4, 67, 3, -14, 51, -28, -41, -24, 53, -54, -31, -49, 19, 19,
+	9, 93, 53, -28, -24, 59, 59, 11, -19, -50, 31, -13, 24, 64, -3, -26,
+	21, 42, -73, -4, 35, -44, -51, 8, 36, -43, 43, 21, 75, -45, -1, 47,
+	-6, 16, -1, 12, 7, 35, 29, 53, 16, -18, -11, -23, -31, 38, -50, 39,
+	-16, 38, 61, 43, -35, -48, -5, 13, -33, -29, 4, 20, -25, -44, 21, -17,
+	61, -41, -2, 2, 63, 37, -24, -28, 5, 55, -14, 41, -57, -15, -57, 53,
+	63, 53, 44, -62, 27, 20, -22, -7, -8, -20, 81, -12, 31, 29, 54, 21,
+	77, -30, 38, 56, 55, 14, -48, -26, -61, -11, 11, 15, -17, -16, -62, 42,
+	-35, -39, -57, 68, 23, -25, -102, 46, -14, -43, 5, 39, -1, -9, 56, -29,
+	-17, -22, -3, -11, 20, -51, -8, 32, -4, 40, 12, 17, -43, 26, 22, 24,
+	-51, 11, 30, -35, 17, -76, 6, -50, -30, -46, 55, -13, -27, 44, 20, -13,
+	30, 56, 20, 28, -16, -29, 24, -15, -28, -41, -17, -55, -1, -5, -63, -32,
+	-70, -15, 10, 26, 64, -6, 2, 36, 15, 33, -16, -5, 33, -11, 19, -9,
+	-15, 41, -34, -19, -52, -42, -56, -20, 11, 12, -50, 42, 37, -16, -9, -18,
+	38, -50, 68, 24, 73, -37, -64, 39, -2, -25, -34, -2, -25, 34, 25, 1,
+	36, 40, 29, 25, -27, -14, -37, -13, -3, 38, 29, -19, 1, -40, 45, 9,
+	0, -53, 18, 40, -10, -10, -3, 31, -24, -18, 3, 28, -39, -28, 22, -49,
+	50, -8, 9, 64, 38, -48, -8, -19, 44, 19, -30, -22, 1, -44, 17, -31,
+	0, 28, 16, -5, 91, 31, 57, 26, 76, -58, 6, -8, 42, 5, 85, 69,
+	39, 44, -19, 9, -13, 62, 62, 51, 11, -98, 33, 28, 38, 10, 10, -56,
+	54, -8, -8, -37, 61, -62, 34, -49, 55, 71, -31, 18, -20, -17, -29, -56,
+	36, -29, 11, 37, 27, 17, -59, -4, -66, -41, 49, -19, 65, -51, 33, -21,
+	29, -74, 54, 49, 20, 16, -10, 4, 16, -54, 29, -43, 41, -34, -32, 34,
+	46, -31, -47, 21, 29, 50, -9, -57, -41, -49, -48, 52, -45, -27, -11, -54,
+	38, 14, 48, 48, -23, 15, 53, 65, 74, -60, -35, -21, -9, -43, -9, 69,
+	36, 42, 23, 48, -41, 8, 13, 5, 37, -66, 30, -54, -53, 8, 47, -23,
+	27, -44, -43, -24, 30, 37, 32, -19, 23, 20, -38, 44, -42, -5, 8, 33,
+	36, -51, 54, 21, 29, -64, -44, -82, -5, -67, 20, 34, -23, -38, -18, 5,
+	69, 0, -40, 73, 13, -20, 2, 66, 28, -32, 10, -52, -3, -72, 50, -16,
+	-19, 35, 60, -57, -37, -4, -33, -32, -35, 53, 1, -71, -2, -12, -30, 16,
+	-17, 6, -39, 26, 30, 76, -45, -4, 15, -15, 48, 35, -42, 21, 49, -47,
+	-26, -2, 36, 49, 53, -32, -38, 47, -27, 64, -15, 35, 7, 20, 16, 53,
+	44, 68, -58, 41, 7, 18, 1, 20, -35, -16, -21, 45, -18, -21, 12, -9,
+	-25, 4, -2, -53, 39, 37, 52, 0, 38, 64, 3, -52, -38, -5, 13, 55,
+	30, 26, 3, 43, -24, -51, 4, -50, 53, -62, -2, 39, -15, -44, 30, -33,
+	-55, 29, 52, -12, -47, -39, 50, -37, -12, -23, 18, 44, -5, 28, -44, -19,
+	-6, -41, -32, 52, 64, 41, -66, -36, 31, 32, -37, 61, -24, 38, -30, 9,
+	-26, -3, 18, -27, -46, 47, 2, -30, 17, -3, 23, -8, -27, -11, 50, 39,
+	15, -15, -34, 7, 12, 29, 23, 9, 23, -9, -60, -26, 15, 5, -38, -3,
+	15, 30, -8, 14, 39, 2, 1, 43, 35, 5, -32, -19, 41, 72, -35, 3,
+	12, -31, 21, -7, 5, 43, -20, -29, 20, 0, -55, 37, -21, 44, 7, -51,
+	37, 21, 1, 38, -32, 51, -14, -32, 8, 31, 9, 21, 41, 16, -56, -25,
+	9, -55, -10, -1, -2, -2, 33, -25, -68, 33, -37, 21, -60, -37, -29, -6,
+	-41, 19, -32, -33, -5, -2, -25, -29, 2, 31, 50, -21, -32, -44, 16, 30,
+	-5, 45, 11, 0, -16, -30, 14, 47, -1, 11, 25, 7, 9, 16, -47, 37,
+	2, -8, -33, -39, -42, 10, -6, 10, 1, 1, 61, 46, -36, -37, 3, -76,
+	28, 46, 24, -23, -3, -28, 32, 11, 37, 67, 19, 24, -28, -28, 13, -63,
+	-36, 47, -27, -9, -1, 17, -56, -32, -31, -11, 52, -20, -5, -23, 8, -30,
+	20, -18, -2, 43, -47, -4, -50, -29, 51, 33, -19, -15, -8, 1, 19, 13,
+	-8, 28, -67, 48, 17, -9, -20, 58, 77, -37, 52, 44, 41, -12, -25, 7,
+	-8, -15, 70, 60, 69, 37, 41, 30, 19, -51, -3, -6, 27, 29, 23, -46,
+	22, 33, 58, -19, 30, -53, -34, 67, -29, 5, 57, -17, -30, 35, 31, 51,
+	-11, -28, 5, -25, -37, -27, 18, 51, 3, -45, -63, -25, -47, 16, 22, 29,
+	27, -31, -5, 55, 69, 11, -39, -47, -9, -14, 19, -1, -2, 40, 10, -42,
+	-20, -16, -18, -40, -79, -79, -32, 8, -63, 66, -37, -26, 43, -33, 66, 7,
+	-51, 68, -17, 19, -20, 29, 15, -36, 21, 46, 0, -31, -23, -29, -6, 56,
+	-40, -4, -35, -47, 39, 53, -6, 20, -23, 20, 27, 24, -12, 1, -8, -13,
+	53, 49, 23, 69, 17, 18, -17, 52, -5, 7, -35, 42, 12, 66, -19, -48,
+	-45, 56, 2, 30, -24, -11, 24, 53, -29, 22, -16, -77, 11, -5, 20, 36,
+	-14, 5, 61, -16, -1, -10, -41, 49, -34, 46, -20, 29, -9, 47, 61, 37,
+	20, 4, -17, -36, -62, 1, 16, 25, 70, -21, 16, 54, 29, -48, 53, 2,
+	-31, 4, -68, -16, 77, -23, 5, 45, 7, -14, 8, 25, -74, -43, -34, -25,
+	-45, -33, 46, -8, 66, -41, -31, 38, -12, 13, -49, 28, -45, -69, 58, 2,
+	-5, -67, 14, -9, 7, 16, -55, -27, 28, 39, 32, 2, 52, -71, -51, 33,
+	-12, 15, 33, 32, 35, 46, -25, -58, 22, -3, -8, 27, 61, 66, -29, -42,
+	-45, 6, 52, 32, 71, -38, 13, -3, -7, 43, 36, 20, -20, -39, -40, -41,
+	-1, -25, 28, 2, 14, -51, -22, 39, 9, -26, -49, 69, 68, 23, 31, 50,
+	-41, -16, 27, 14, 22, 21, -10, 2, 7, 15, 64, 16, 3, 45, 32, -1,
+	18, -25, -7, 64, -19, -18, 64, -16, -39, 27, -2, 13, 45, 44, 78, 52,
+	48, -70, 28, -45, -9, 34, -56, -19, 7, -31, 27, -48, -52, -5, 23, 48,
+	52, 71, -11, -4, -30, -24, 9, 72, -31, 4, 34, -52, 53, 0, 9, -4,
+	19, -37, 70, -50, -22, -48, -12, 39, 31, 20, -30, 34, 29, -14, 10, 38,
+	-25, -20, -14, 32, 41, 56, 34, 28, 43, -29, -57, -66, -14, -1, -55, 7,
+	37, 34, 40, 42, 16, 20, 39, 20, 68, -63, 87, -1, -7, 14, 46, 14,
+	43, -52, 51, 15, 60, -1, 39, -42, -6, 13, -7, 16, -52, 44, 80, -1,
+	-26, -68, 65, -61, 29, 35, -74, -10, -71, 6, 10, 18, 18, -26, 13, 29,
+	25, 25, 28, -23, 40, 77, 39, 6, -53, 11, -2, 7, 17, -42, 10, 45,
+	65, 0, -4, 46, 45, 52, 14, -13, 59, 19, -12, -59, -58, 67, -16, 33,
+	-34, 70, 32, -37, -15, -93, 22, 28, 58, 29, 0, -72, 51, 31, 16, 48,
+	-58, -16, -31, 16, 45, 23, -8, 10, -58, -4, 74, -36, -40, -26, -26, 19,
+	-58, -29, 39, -63, -7, -27, -48, 17, 65, 3, -16, 2, 2, 65, -22, 29,
+	-20, 23, 15, -27, 22, 42, 6, -25, 14, -21, 10, -67, -3, 5, -9, 34,
+	33, -2, 13, 3, -31, -23, -17, -37, -55, -49, 52, 45, -8, -6, -41, -27,
+	-23, 50, -1, 19, 22, 11, 15, -47, 2, -5, 14, -25, 10, -16, 5, 57,
+	46, -31, -36, -14, 16, -5, -37, 41, -33, 19, 10, -48, 6, -32, 33, -104,
+	38, -20, 5, 32, 5, -52, 23, 21, 50, 13, 37, 45, 4, -44, 2, -63,
+	32, -23, -51, 93, -25, 9, 37, 13, -23, 56, -20, 57, 16, 46, -22, 22,
+	24, 52, 29, -18, 10, 19, 36, -45, -26, -16, 65, -15, -59, 9, -29, -8,
+	-71, 27, -104, 23, 41, -22, -11, -3, -64, 20, 31, 56, -12, -7, -17, -3,
+	-21, -7, 88, -1, -24, -16, -23, -9, 26, 46, 26, 23, 46, -11, -32, -84,
+	42, 43, -36, -75, 60, -27, -51, 42, 37, 32, -59, -37, -41, -4, 17, -37,
+	-20, 49, 22, -54, -28, 59, -1, 56, -31, 37, -18, 35, 8, 38, -23, -13,
+	65, 14, 19, 13, 62, 35, -74, -62, -9, 18, -22, 30, 45, -52, -26, 55,
+	41, 66, -93, -36, -5, -40, 56, -81, -12, -12, -40, 2, -31, -47, 38, 57,
+	58, 3, -58, 34, 45, -64, 6, -22, -47, 31, -66, -46, 60, 22, -39, 48,
+	-44, -74, 10, -40, -83, -4, 18, -3, 19, 31, -9, -7, 2, -30, 28, 26,
+	63, -4, -28, 53, -55, -27, 28, 65, 2, -46, 68, 42, -1, 9, -68, -17,
+	-16, 22, 32, 20, -42, 7, 74, 25, 8, -12, 13, 21, 38, -2, 56, 29,
+	3, 27, -10, -5, -2, -86, 8, 3, 14, -31, -36, 4, 0, -20, -26, -23,
+	-29, 24, -40, 65, -18, -4, 71, -1, 38, 30, 12, 6, -39, 68, -39, 21,
+	6, -19, 6, 8, 99, 58, 24, -1, 50, 23, 14, 39, -61, 38, 3, 15,
+	56, -27, 41, -11, 13, -51, -23, 30, -29, -3, -47, 49, 8, -52, -28, 3,
+	33, -9, -34, 4, 4, -31, 59, -34, 44, 38, -34, 4, -35, -23, 43, -36,
+	13, 47, 16, 20, 45, -22, -22, 12, -17, -15, 40, -18, -62, -59, -42, 42,
+	-24, -2, -22, -33, -36, 43, 26, 53, -65, -21, -31, 39, -53, 55, -8, -49,
+	-36, -35, 66, -67, -31, 23, -42, 9, -4, 15, -43, -26, -4, 7, -55, -11,
+	24, 5, -6, -50, -9, -4, 10, 51, 30, -21, 5, 40, 34, 39, 62, -25,
+	42, 2, -26, -26, -47, -34, 48, -23, 23, 12, -38, 52, -58, 7, -37, -14,
+	52, 39, 50, -35, 41, -27, 38, -27, -16, 35, -8, -18, -12, -83, -16, 9,
+	14, -36, -31, 54, 31, -1, 49, 57, -33, -32, 84, 27, -52, 61, -44, 76,
+	-3, -7, -30, -25, -40, 32, -14, 18, -64, 22, -50, 84, 88, 44, -60, -15,
+	-8, 62, -6, 69, -43, 26, 32, -54, -22, -6, 71, 18, -2, -11, -61, 1,
+	4, 29, 7, 2, 9, -28, 51, 11, -27, -14, -56, 44, -52, -44, 22, -10,
+	35, 59, -47, -25, -12, -54, -5, -2, 12, -7, 0, -88, 23, 54, -56, 37,
+	-52, -18, -35, 38, 24, -25, -23, 14, -47, -27, 23, 56, -22, 40, -66, 12,
+	-28, -51, -45, 76, 15, 39, -20, 38, -26, 37, 65, 14, 15, 59, 0, 62,
+	-12, -74, 41, -83, -11, -46, 72, -29, 28, 10, 13, -11, 44, -26, -49, 60,
+	-11, -11, -21, 0, -33, 60, -17, 42, 37, 88, -14, -83, 17, 12, 86, -17,
+	-27, -12, 16, -46, -27, -34, 8, -34, 1, -9, -29, -10, 12, -48, 9, -1,
+	-48, 26, -9, 39, 15, -57, -56, -44, 36, -17, -13, -1, -55, -42, 30, 35,
+	-62, -50, 58, -38, -36, 25, -37, 47, -38, 12, 43, 52, 23, 7, 15, -39,
+	2, -6, -24, 28, 18, -35, -71, 20, 5, -21, -29, 36, 89, 47, -51, 27,
+	-52, 13, -9, 24, -5, 47, 34, 30, -16, -42, 39, -28, 71, 55, 16, 10,
+	103, 16, -50, 54, 56, -2, -58, -13, 72, -85, 48, 2, -58, -43, -44, 21,
+	-45, 4, -39, 18, 73, 84, -29, -34, -32, -33, 71, 34, 22, -31, -26, 37,
+	-45, -21, 45, -2, -49, 19, 36, 15, -10, 12, 25, 7, -47, -8, 19, 12,
+	-28, -10, 49, 6, 50, -9, 71, -53, 8, -73, 6, -58, 44, -80, -75, 12,
+	4, -63, 56, 80, -8, -99, -46, -5, -39, 49, -1, 29, 4, 57, -86, -40,
+	2, 65, 55, 26, 22, 4, -35, -66, 30, 55, 16, -48, 50, -31, -62, 4,
+	8, -46, 57, -32, -3, 21, 21, 25, 10, 16, -30, -17, -26, -50, -28, 36,
+	-7, -60, -8, -6, 15, -34, -78, -48, -30, -19, 12, -49, -50, 19, 100, 71,
+	56, 0, 29, -27, 15, 39, -35, 55, -32, 3, -5, 11, -8, 38, -35, -13,
+	-8, -59, 32, 53, -87, -12, 65, -63, -30, 9, -7, -37, -14, 91, -45, 35,
+	69, -8, -28, 12, 15, -9, 3, -56, -22, -21, -62, 14, 2, -52, -63, -74,
+	7, 6, 77, -56, -41, -46, -42, -29, 54, 10, -25, -60, 46, 17, 12, -33,
+	-23, -32, -44, -22, -31, -16, -56, 16, 51, -38, 27, -4, 7, 72, -37, 5,
+	23, -33, 39, -2, 8, 19, -17, -74, -24, 15, 38, -5, 20, 7, 48, 4,
+	48, -9, 21, -64, 67, 40, 33, 57, -35, 59, 44, -37, 22, 73, 18, -42,
+	23, -48, 23, -15, -27, 38, -50, 64, -45, -30, 60, 14, 0, 2, 27, 23,
+	30, 64, 20, -75, 44, 50, 22, -31, 32, 35, 32, 39, 42, -4, 20, 29,
+	-60, 48, 22, -9, 21, 4, 33, 52, -47, 17, 7, 17, 18, 16, -30, -76,
+	-1, -32, -27, 40, -27, -43, 35, -60, 24, -38, -37, -38, -55, -46, 37, -9,
+	-37, 89, -8, 25, 50, 68, -52, 103, 18, -36, 3, -75, -28, -21, -1, 5,
+	28, 33, -46, 0, -33, -25, 25, -61, -37, 12, 7, -38, 54, 36, -37, 13,
+	28, -52, 9, 2, 40, 8, -7, -40, -40, -21, -52, 51, 1, 78, 24, -15,
+	-34, 16, 32, -25, 24, -41, 46, -25, -15, -11, -5, 33, -45, -62, -15, 31,
+	16, -9, 35, -49, -5, 52, 39, 46, 41, -36, 10, 65, 6, 31, 62, -9,
+	53, 75, -6, -6, 4, -43, 37, -46, -11, 7, 24, 12, 20, -44, 48, 76,
+	-1, -55, -32, 15, -52, 27, -33, -34, 39, 12, -40, 3, -49, -5, -49, 29,
+	-9, -32, -2, -41, 22, 4, 10, 31, 22, 43, 15, 21, 61, 18, -48, -65,
+	-47, -30, 23, 0, -14, 17, -24, 44, 59, -8, 20, -35, -16, -26, 0, 45,
+	14, 1, 28, -38, 65, -35, 7, 61, 24, -36, -31, 69, 23, 3, -63, 55,
+	-6, 1, -6, -24, 38, 20, -26, 22, 53, -60, 58, 5, 3, -3, 53, -39,
+	18, 29, -10, -5, 5, -34, 0, -49, 51, -27, -11, -23, 13, -26, -18, 24,
+	13, -9, -17, 51, -36, -17, 38, 2, -18, -55, -58, -14, 31, -1, 24, 26,
+	36, -17, -24, 31, 42, 43, -17, 8, -62, 1, 26, -51, 3, 48, -28, -37,
+	33, 36, -19, -47, 21, 39, 64, 14, -9, -41, 74, 14, 31, -19, -52, 17,
+	-11, -12, 63, 41, 28, 58, 28, 32, 9, 43, 40, -37, -62, 61, -21, -32,
+	-67, 5, 21, 9, -6, -50, 49, 40, -52, 55, -13, -8, 5, -49, -31, 45,
+	56, 37, -40, -20, 39, 24, 36, -14, 4, 54, 45, 77, 59, -18, 18, -20,
+	51, 75, 7, -29, -40, -21, 24, 14, 71, -9, -10, -10, -16, -10, -31, 15,
+	37, -13, 51, -27, -112, -82, 25, -43, -12, -18, -9, -38, -58, 12, 50, -26,
+	-42, -23, -28, -5, -66, -24, 46, -13, 6, 43, 6, -42, 48, -5, 12, 92,
+	-35, 47, -13, -43, 71, 22, 41, 44, -23, 37, 8, 15, -19, -23, 40, 82,
+	-55, 6, 64, 73, 44, -51, 64, -69, 3, -14, 3, 45, -61, -21, 65, 60,
+	28, -35, -32, 17, 30, -36, 18, -21, -18, 5, -12, 7, 41, 66, 40, 71,
+	-28, -31, -12, 83, 27, -77, -33, 9, 13, 17, -30, -29, -45, -13, -43, -20,
+	65, -1, 21, -32, 12, 27, 49, 21, 6, 10, 6, -32, -7, -49, 62, 11,
+	-19, 8, -33, 68, -26, -41, -17, 41, -7, 32, -79, 12, -58, 60, -5, -54,
+	39, -15, -40, -23, 4, -34, 1, -11, 51, -64, 13, -24, -56, -23, 84, -24,
+	21, 15, -39, -30, 37, 45, -19, 32, 26, -2, -21, 23, 7, 10, 11, 10,
+	-33, -27, -21, 46, -18, 10, 5, 57, -11, -40, -21, 31, 36, -15, 56, -17,
+	-31, -4, 12, -58, -34, 10, -27, 75, -52, 36, -48, 25, -13, -30, -5, 6,
+	4, -34, -13, -1, 35, 26, -40, -44, 2, 34, 60, -25, 61, 4, -12, -23,
+	-11, 8, -49, 39, 43, 17, -5, -36, 52, -26, 61, 0, 40, 22, 16, -29,
+	-25, -1, 25, 34, 47, 49, -15, 20, -12, 15, 18, 76, 1, 19, 17, -21,
+	45, 25, -49, -14, -18, 50, 8, -43, 49, 60, -48, -48, -33, -66, 19, -32,
+	-9, 63, 17, 33, 5, -53, 24, 2, 31, 10, 11, -14, 19, 2, 22, 23,
+	-30, 8, -37, 21, 45, 60, 32, 5, 3, 51, -22, -20, 39, 23, 2, -22,
+	-33, -40, 21, 32, -29, 9, -36, 58, -1, -12, -17, -57, -63, 15, 17, 56,
+	-26, -29, 18, 54, -43, 67, 7, 11, 58, 8, -48, -48, 49, 46, 62, 56,
+	60, -51, 43, 13, 24, -4, 64, 2, 22, -1, -16, -36, -20, 70, 18, 48,
+	12, 49, 4, 14, 32, 55, -31, -26, -15, 63, -20, -53, -37, 31, -28, 16,
+	-51, -47, 50, 15, 60, 23, -25, 76, -58, -50, 36, -3, 13, -37, 42, -35,
+	17, 12, -37, -45, -10, 42, -34, -49, 9, 50, 2, 19, 18, 0, 57, -1,
+	-62, 10, 67, -37, 28, -2, 36, -25, -56, -13, -26, -19, -3, -27, 36, 24,
+	42, 63, -15, -36, -39, -8, 9, 35, 26, -5, -25, -42, 6, 24, 33, -14,
+	35, 19, -55, 17, 31, -31, -38, -8, -18, -32, -34, 47, -17, -75, 34, 13,
+	-54, -31, 29, 69, -71, -40, -1, -21, -14, 60, -16, -30, 17, -65, 0, 63,
+	-29, -17, 26, -17, -16, -50, -22, -50, 54, 27, -17, -21, -37, -38, -3, -29,
+	28, 50, 80, -55, -41, -7, -46, -41, -34, 35, 50, 31, -15, 1, 17, 18,
+	-35, -42, -61, -49, -17, 21, -34, -3, -10, 21, -46, 36, -4, -28, -33, 23,
+	19, -52, -17, 20, 3, 28, 7, -19, -26, 20, 11, 16, -45, -45, -69, 75,
+	-37, 21, -33, -14, -21, 0, 13, -68, 2, -54, -17, -14, -26, -5, -35, 12,
+	21, 24, -35, 6, -14, -24, 27, 68, 1, -59, 43, 8, 65, -17, -28, 44,
+	7, 50, 21, 23, 71, 18, 13, -6, 32, 35, -9, 30, -24, -15, -43, 63,
+	20, -52, 77, 56, -27, -39, 5, 25, 38, 15, -52, -36, -52, -14, -20, 9,
+	78, -18, 18, 24, 33, 33, 4, 44, 10, -29, 48, -19, -4, -9, -8, -60,
+	-6, -9, -5, 32, 18, 16, 9, 13, 1, -66, -47, -24, -26, -45, 40, 19,
+	1, 32, -40, -17, -52, 29, 7, 42, -4, -50, -22, -32, -9, 24, -36, 21,
+	52, 19, -24, -56, 20, 39, 25, 14, 52, -51, -23, -29, -42, 5, -46, -47,
+	-18, 49, -22, -17, 73, -15, 41, 5, 23, 37, -22, 15, 27, -3, 35, -53,
+	26, -42, -14, -4, 19, -33, -32, -15, -28, 37, 45, 43, 41, -3, -38, -45,
+	-12, 29, -5, 23, 14, 31, 38, -36, -35, 37, 19, -17, 49, 22, -16, -56,
+	49, -11, -34, 55, -39, -51, 20, 18, -11, -27, 38, -38, -54, -4, -57, 22,
+	70, -28, 25, -47, -20, 5, -37, 11, -17, 13, 5, 18, -39, 46, 20, -33,
+	38, 51, -36, -32, 33, 36, -45, -24, 6, -29, -41, -34, -34, 24, -54, -38,
+	-57, 44, -62, 70, 68, -5, 4, 55, -30, 32, -33, -5, 39, -38, 11, -19,
+	-12, -42, 7, 40, -44, -37, -26, 48, -7, 27, -57, -15, 21, -15, -35, -13,
+	-20, -30, -41, -9, 18, 10, -27, -45, 44, -31, 28, 48, 47, -15, -28, -18,
+	49, -16, -27, 56, 19, 16, 20, 27, -14, 43, -19, -25, 26, 16, 17, -36,
+	-21, 56, 6, -14, -24, -14, -39, 7, -12, 44, 10, -8, 43, -12, -39, -49,
+	7, -53, 19, 51, -39, 36, 61, 30, 21, 23, -46, -42, 10, -31, -52, -34,
+	-46, -48, 54, -21, -37, -4, -42, -14, -4, -28, 39, 27, 38, -30, -13, -22,
+	-33, -45, -13, -3, -27, -38, 45, 27, 26, 57, -27, -1, 41, -17, -8, 44,
+	-38, 25, -49, -6, 37, 30, 34, 35, 7, 20, -26, -39, -35, -41, 59, -47,
+	-40, 21, -13, 43, 42, -30, 59, -14, -55, 15, 44, -44, 36, -13, 27, 45,
+	13, 54, 34, -15, 44, -30, -4, -23, 0, -29, 23, -31, 28, -46, 15, -74,
+	56, -23, 60, 15, -34, -43, -29, -4, -25, 39, 21, 60, 0, -35, -28, 2,
+	22, -3, -7, 29, -31, -30, -49, -43, 24, -37, 29, 32, 21, 28, -12, -29,
+	-28, 51, 19, 33, 33, 2, 20, -35, 26, 51, 48, 43, -1, 13, -14, -23,
+	-32, -40, -30, 58, 20, -45, 8, 43, 24, 1, -63, 21, 42, -30, 44, -32,
+	14, 13, 21, -5, -11, -31, 48, 11, -46, 46, 22, 59, -2, 10, -36, 39,
+	-43, -26, 33, -40, -28, 1, -32, -24, -36, -20, 11, 40, 4, 8, -33, 39,
+	39, 7, -58, 54, -7, -40, -27, -8, 19, 31, -33, -11, 46, 46, -20, -5,
+	-32, 44, -37, -9, 21, -39, 23, -40, 5, 28, 50, 37, 32, 22, -25, 48,
+	-37, -49, 25, -34, 21, 5, 48, 44, 17, 8, -46, 22, -50, -30, 23, 16,
+	26, 55, -17, 40, -2, 8, -5, 46, 6, -40, -30, 13, -26, 28, -29, 19,
+	23, 0, -42, 50, 21, 5, 31, -45, 40, -3, 6, -1, 8, -41, -2, -38,
+	14, -51, -31, 13, -25, -10, -6, 13, -5, -34, -42, 39, -5, 47, -48, 42,
+	-42, -40, 6, 12, 4, -34, -32, -7, 18, -17, 56, 26, 33, -14, 33, -39,
+	29, -33, 5, -9, 27, -13, 63, 50, 0, -28, 11, -32, 4, -14, 66, 27,
+	60, 44, -7, 27, 43, -48, -12, 0, 15, -36, 15, -44, 59, 5, -37, 34,
+	-45, -44, -14, -8, -3, 48, 6, 9, 60, 60, -13, 36, 66, -3, 59, -7,
+	-46, -16, 46, 57, -14, -4, 38, 35, -59, -57, -25, 29, -55, 33, -18, -29,
+	-6, 17, 16, 6, 44, -11, -3, 20, -17, 7, 14, 27, 15, -23, 50, -50,
+	4, -35, 8, 59, -36, -13, 1, -3, 19, 63, 31, -56, -34, -14, 24, -10,
+	-25, 3, 16, -27, 20, 16, 58, 40, -23, 27, -25, -8, 36, 49, 14, 19,
+	14, -3, 17, -43, 65, -8, -48, 37, 0, -49, 16, 20, 37, -4, 31, 23,
+	-9, 11, 51, 46, -22, 49, -58, 6, 31, 5, 2, -4, -4, -58, -39, 17,
+	21, 49, 8, -22, -6, -53, -23, -51, -36, 53, -19, 45, 11, -34, -25, 40,
+	-31, 44, -33, 63, 63, -36, 33, 52, -29, -45, 37, 19, -66, 20, 6, 20,
+	-48, -14, -35, 21, -21, -1, -47, -3, 19, 36, 63, -15, 1, 3, 32, -49,
+	73, -52, -43, 2, 50, 32, -34, 6, -46, -36, -17, -16, -24, 56, 39, -4,
+	22, -51, 59, -60, 49, -11, 16, -26, -4, 42, 5, -23, -24, 12, -33, 46,
+	-5, 33, 9, 63, 34, -8, -35, -3, -22, 4, 19, -52, 41, 4, 4, -42,
+	3, 20, 6, -47, 16, -46, -24, -6, -5, 49, 2, -11, 10, 40, 10, 26,
+	32, -74, -41, 66, -8, -41, -4, 3, 27, 40, 21, -51, 41, 31, 32, -1,
+	10, 2, -54, 54, 23, 31, -55, 63, 65, 30, 30, -23, -34, -42, 45, 20,
+	45, -23, -34, -31, 2, -61, -45, -17, 29, -47, 63, 39, 31, -54, -1, 27,
+	-2, -14, 25, -3, 67, -21, 10, -46, 42, -19, 0, -37, 26, 37, -23, 21,
+	21, 39, -16, -27, 7, 41, 5, -48, -9, -51, 18, 56, 50, 7, 24, -1,
+	-32, -13, -45, -9, 14, 53, -1, 24, -30, -16, 9, 30, 37, -26, 0, -48,
+	20, -1, -27, -29, -1, 41, 25, -59, -8, -45, -38, -37, -51, -19, -23, -43,
+	42, -38, 48, 40, -39, 54, 17, -33, -9, -44, 36, -61, -36, -27, 18, -5,
+	31, -21, 46, -26, 59, -8, 48, 44, 24, -5, -18, 68, 18, -48, -38, 60,
+	-16, -48, -22, 66, -34, -64, -52, -9, -65, -62, 62, 32, -5, 2, 13, -40,
+	-30, -61, -12, 33, -16, 59, 48, -6, -10, -21, 22, -32, 46, 13, -38, -29,
+	-32, -34, 41, 51, -27, 41, -53, -5, -26, -66, 4, -68, -28, 50, -18, 47,
+	-35, 49, 30, 30, -4, -7, 47, 10, 34, 71, 34, 72, -9, 50, 17, -33,
+	49, -13, -2, 11, -59, -102, -39, 33, -63, 26, 4, 4, 49, 17, -20, -51,
+	-26, 6, -48, 31, -74, 18, -72, 20, -22, -13, -70, -3, -16, -16, 23, -7,
+	24, -46, 84, 65, 16, -35, -3, -67, -33, 75, 15, 30, 44, 15, -48, 38,
+	35, -20, -15, 7, 11, -37, 62, 26, -40, -9, -53, -33, 7, 6, -36, -5,
+	-16, 10, -47, -50, 10, -16, -18, 59, 55, 22, 42, 1, -6, 66, 1, -22,
+	46, 65, 29, -1, -21, -73, -49, 11, 42, 43, -21, -16, 17, 54, 66, 45,
+	-21, -5, 26, -3, -43, -49, 15, 36, -7, -42, -25, -15, -6, -35, -46, 2,
+	49, 13, -56, 50, 29, 3, -30, 48, 26, -17, -15, -4, 9, -11, 61, -43,
+	-65, 38, -24, -41, 28, 62, -27, 14, 9, -10, -10, 25, -51, -17, -11, -39,
+	22, 36, 17, 65, 7, 7, 10, 2, 31, 59, -52, 13, -31, -21, 59, 30,
+	37, -27, -31, -14, -25, -34, 47, -32, -54, -10, -17, -38, 27, -45, -5, -62,
+	-54, -44, -45, 10, 4, 20, -9, 38, 76, -19, -64, 39, -4, -32, 30, 68,
+	-36, -70, 33, -50, 22, 33, 29, 36, 30, -3, 63, -10, -14, 1, 11, 29,
+	-11, -37, -16, 13, -34, -29, -64, 28, 42, -22, 11, 22, 5, -25, 19, 70,
+	-61, 81, -40, -25, -35, 20, 54, -36, -36, -39, 54, -7, 58, -40, 16, 45,
+	12, -4, 8, -28, 21, 49, 30, -29, -9, -27, -34, 23, -5, 7, 10, -18,
+	4, -68, 28, -53, 13, 72, -13, -30, -72, 30, 13, -15, 44, -43, -59, -21,
+	55, 31, -20, -71, 23, -9, -49, -31, 30, 18, 29, -47, 25, 11, 70, -6,
+	-64, 25, 56, 20, -17, 34, 12, 52, 74, 10, 32, -2, 3, -26, 60, 42,
+	-16, -30, 1, 47, 70, -47, 9, 31, 0, -14, -52, 24, 45, -69, -70, 18,
+	17, -37, 78, -52, -22, 6, 92, -12, 37, -28, -40, 9, 28, -18, 31, 25,
+	-43, 30, -2, -21, 5, 49, 49, -2, 58, 3, 41, 4, -38, 46, 26, -16,
+	49, -35, -32, -30, -20, 12, 40, -51, 27, -13, -15, 40, -37, 38, 24, -5,
+	23, 21, 49, -28, -40, 17, 54, -57, 58, 1, -4, -31, -59, 30, -37, 2,
+	-3, 27, -49, -12, -38, 23, 10, -56, -20, -44, 7, 8, 3, -41, 3, -24,
+	41, -48, -31, -24, 46, -14, -1, 7, 46, 15, -5, 16, -37, 2, -2, 27,
+	-24, 30, -23, 53, 34, -14, -24, 67, -23, -6, 34, 0, -24, -3, 16, 57,
+	43, 50, 46, -33, 80, 12, 14, 14, -6, -3, 43, -47, -14, 10, -8, 45,
+	-13, -11, -33, -17, 14, 15, 34, 53, -42, -39, 32, -14, 17, -20, -21, -46,
+	14, -1, -14, 3, 5, -24, 10, -11, -18, -23, -38, -58, -27, -29, 16, 23,
+	39, -38, -41, 3, 61, -15, -29, -17, 12, 38, -44, -34, 39, -41, -2, -18,
+	-26, 1, 31, 7, 37, -51, 6, -14, 62, -29, 3, 21, -24, 50, -7, -30,
+	23, 32, 24, 30, -39, 41, 14, 14, 36, 59, -29, -24, 50, -35, -39, 41,
+	-3, -21, -18, -20, -3, -10, 40, -5, -9, 51, 29, 56, -44, 63, -27, -43,
+	2, -28, 40, 33, -42, -27, -39, -25, -41, -1, -40, -32, 50, 62, -20, 50,
+	15, 12, 43, -34, 26, 8, -40, 40, -58, -6, -38, 8, 35, -27, -25, 51,
+	6, -39, 17, -10, 33, -44, -6, 25, -28, -37, 39, 13, 12, -19, -52, 18,
+	5, 21, 33, -25, -24, 35, 65, -32, -49, -27, -7, -51, 37, 32, -15, -21,
+	43, 27, -27, 16, -20, 41, -26, 6, 59, 55, 9, 18, 51, -2, -29, -12,
+	57, 14, 31, 37, 31, 28, -31, 42, -10, 8, 9, 2, 3, 0, -14, -34,
+	-22, -6, 40, 16, -4, -42, -53, 6, 39, 27, 48, 27, -33, 39, -12, -51,
+	-28, -12, 53, -31, -29, -44, 2, 7, 1, 5, -10, -15, -25, -46, 35, -19,
+	-25, -24, -44, -27, -12, -15, 6, 33, -33, -57, -34, 25, 8, 15, -26, -12,
+	34, 5, 3, -35, -51, 34, -16, -25, -4, 7, 8, 45, -3, 60, 55, -55,
+	-2, -34, 28, 53, -17, 29, -14, -49, 31, 8, -57, 25, -29, 19, 15, 24,
+	25, -64, 2, 29, -6, 44, 31, -31, -12, 17, 53, -9, 50, -25, 25, 9,
+	-56, 29, -33, -14, 25, -36, 2, -11, -15, 49, -18, -30, -29, 0, -25, -35,
+	-41, -30, -75, 34, -28, -12, -34, -29, 26, 3, -5, 1, 41, 14, 11, 43,
+	-41, 49, 38, -23, 31, -45, -51, 2, -12, 40, -40, -6, 43, -29, -46, 32,
+	1, 5, -37, -1, 49, -13, -12, -29, -29, 10, -18, 34, -10, -49, 21, -26,
+	-9, -11, -14, -13, -32, 45, -44, 45, 15, 13, -14, 42, 4, -23, 28, -34,
+	32, 38, -15, 31, 62, 34, -9, 37, 8, 24, -54, -33, -22, -1, -5, 11,
+	-14, -4, 21, -26, -23, -4, -27, -16, 48, 41, 10, -1, -41, -31, -66, -7,
+	34, 24, 0, -9, -7, -21, -18, -22, -40, 1, 29, -5, 41, -17, 33, 60,
+	39, 31, -6, -38, 10, 41, -35, -24, 7, 2, 14, 34, 20, -35, 20, -50,
+	44, -51, 14, -50, 37, -33, 54, -21, 27, -30, -24, 33, -51, 8, -12, -50,
+	-3, -36, 6, -9, 7, 31, -36, 54, -27, -29, -17, -16, 47, -11, -39, 9,
+	33, -3, -43, 85, -35, -7, 41, -42, -48, -36, 3, -17, 14, -67, 36, 21,
+	-41, 20, 12, 21, -27, 14, -15, -8, -65, 6, -18, 4, -53, 20, -30, 62,
+	7, -70, -2, 50, 11, -23, -19, 35, -35, 24, -10, 4, 53, -39, 20, -18,
+	-3, 53, -47, 4, -13, -26, -13, 6, -6, -28, -3, -6, 3, 2, 31, -44,
+	57, 2, -42, 33, 42, -20, -61, 70, -1, 15, -47, -20, 29, -11, -46, -38,
+	26, 38, 38, -16, -9, 10, -36, -47, -40, 25, 4, 68, 3, 30, -5, 4,
+	7, 62, -65, 32, -11, 10, -34, 9, -39, 78, -17, 31, -17, -12, -56, 83,
+	10, 29, -64, 28, 5, 19, 2, 49, 38, 14, -52, -46, -2, 26, 50, 19,
+	-2, -44, -26, -41, -21, -3, -9, 64, 36, 15, -49, -11, 20, -25, -25, 42,
+	-12, -27, 6, -7, 6, -46, 12, 12, 45, -39, 51, 2, 0, -25, 2, 78,
+	20, -45, -36, -42, 56, 68, 48, -15, -21, -2, 17, 14, 5, -20, 56, 20,
+	-7, 46, -6, 6, -46, -24, -11, -51, -48, 29, -37, -22, -3, 54, -35, 28,
+	46, -37, 51, 68, 3, -41, -30, 46, 45, 2, 34, -25, -25, -35, -28, 2,
+	-1, -32, -36, -4, 45, 69, -18, 32, -10, -31, 0, 10, 0, 0, -19, 2,
+	31, -21, -7, 7, -33, -32, 53, -35, -5, -77, 5, -55, -75, 47, 54, 31,
+	-4, -24, 14, -11, -29, -2, -36, -2, 7, -48, -24, 92, 64, -6, 42, 60,
+	-10, -25, -41, 13, 69, -3, 23, 93, 41, 22, -44, 59, 52, 85, -37, 47,
+	30, 1, 35, 25, -31, 69, 32, -9, 16, 42, -26, 18, 16, -52, 0, -91,
+	38, -33, 32, -31, -55, 28, -81, 50, 38, 24, 37, -27, -36, 5, -21, 42,
+	-62, -21, -24, -45, 34, 57, 41, -19, -28, -58, -13, -17, 57, -6, -2, 33,
+	12, 8, -37, -51, -20, 3, -39, 12, -19, 62, -59, -46, 21, -2, -62, -94,
+	16, -28, 59, -8, -12, 9, -33, 13, 6, -33, 57, 3, 34, 45, 53, 10,
+	43, -32, 31, 17, -22, -48, -12, -25, 0, 40, 1, 19, -35, -49, -51, 16,
+	-34, 0, -39, 41, -50, 51, -20, -12, -49, 17, -64, 63, 21, -57, -10, 28,
+	-37, -47, 42, 23, -20, -29, 31, -5, -2, 38, 18, 2, 28, -42, -34, -58,
+	50, -48, -40, -5, 4, 21, -11, 33, 35, 53, -46, -21, 14, 23, -33, 15,
+	-34, 12, -66, 30, 80, 12, -2, -3, 64, -7, 70, 24, -12, -56, 71, -33,
+	-34, 28, -40, 1, -24, -16, -38, 13, -52, 12, 4, -14, 8, -49, 46, -88,
+	12, 55, 46, -19, -28, -66, 12, 12, 25, -19, -16, -21, 34, 36, -20, 73,
+	45, -46, -9, -25, 26, 1, -11, -28, 27, -56, 21, -15, 4, -5, 3, 27,
+	-43, -42, 17, -32, 19, -24, -65, -40, 46, -33, -40, 1, 54, -7, 53, 54,
+	20, -57, 33, -33, -8, 53, 18, -22, -1, 27, 2, 35, 5, -21, 20, -16,
+	20, 57, -14, -7, 63, 42, 57, -35, -33, -44, 29, 18, -50, 24, -21, -26,
+	-15, 28, 24, 47, -24, 24, -45, -8, -41, -24, 29, 44, 20, -37, -38, -29,
+	63, 9, 26, 31, 22, -52, -44, 21, 36, 36, 3, 25, -29, -16, 10, 11,
+	20, 3, 39, -52, 12, -22, -14, -1, 35, -47, -16, -13, 5, 30, 18, 30,
+	7, 27, -55, 36, 30, -50, 14, 67, 41, -39, -50, 15, 9, -27, 44, -17,
+	-7, 21, 15, 40, -44, 17, 42, 17, 31, -15, 28, 46, 48, 7, 54, 41,
+	-27, 5, -40, -26, 2, -17, 23, -37, -22, -6, 61, 29, 39, -27, 22, -22,
+	26, 41, 18, -9, 6, -46, 48, -41, 33, 28, 3, -27, 12, -28, 2, 10,
+	31, 62, 44, -26, 10, -19, -47, -55, 31, -37, -5, -7, 47, 43, -40, -15,
+	1, 29, -35, -39, -4, 4, -25, 8, 19, -9, -7, -30, 59, -49, -41, 13,
+	-6, 27, 36, -24, -34, 26, 67, -38, 20, 46, -18, -18, 43, -3, 5, 37,
+	12, 46, -19, -13, 28, 80, -24, 16, -21, -8, -12, 49, 24, 39, 26, -76,
+	26, -44, 25, 12, -49, 57, -53, -61, 10, -63, -35, -31, 9, 59, -27, 69,
+	-18, 37, 49, 1, 60, -31, 29, 29, -14, 21, 35, 22, 28, 78, 21, 32,
+	31, -77, -20, -38, -63, -60, 60, -69, 6, 45, 25, 0, -15, -34, -40, 3,
+	34, 8, -5, 14, -23, -33, -43, 42, -10, 65, -6, 56, -24, 9, 60, -48,
+	-31, 27, 47, 14, 33, 22, 65, -8, -49, -21, 52, 33, -57, 90, 43, 25,
+	-18, 46, 62, -14, -63, 10, -33, 9, 28, 38, 24, -24, -47, -51, 6, -47,
+	-59, 28, 39, -37, -26, 24, 39, -40, 23, -48, -18, -36, -35, -46, -15, 15,
+	-16, 14, -19, 19, 15, 15, -43, -7, 21, 43, -37, 6, -14, -51, -34, -23,
+	-7, 36, -54, 8, -23, -22, -27, -37, 32, 11, -41, 20, 26, 79, -42, -29,
+	20, 71, -8, -4, 16, 53, -23, -31, 22, 15, 1, 16, -32, -49, -19, 22,
+	23, 27, -49, 10, 38, -62, -11, 24, 22, -6, -33, -19, -9, 30, 6, 55,
+	-37, -11, 25, 49, 21, -18, -25, 25, -26, 79, 21, -18, -6, 15, -25, -23,
+	-6, -10, 51, -18, 29, 49, -51, 70, 26, 47, -36, 26, -17, -43, 57, -28,
+	15, -31, -28, -15, -23, -41, 37, -10, -49, -50, -21, 22, -61, 60, 39, 19,
+	75, 35, -9, -27, 12, 55, -16, 37, -10, -14, -14, 52, -26, 42, 4, -48,
+	58, -18, -11, -27, 4, -20, -79, 5, -38, 30, -48, 30, -44, 13, -51, -49,
+	13, 81, 35, 68, -27, -2, 19, -59, 20, 70, -36, 42, 21, -1, 4, 22,
+	-39, -1, -19, -16, -15, -41, 51, -15, -14, 52, 21, -58, -33, -31, 19, 2,
+	29, 33, -27, -7, -23, -28, 1, -1, 12, -2, 34, 72, -5, -31, -22, 20,
+	10, 4, 17, -6, -7, -1, 6, -57, 58, -13, -57, -24, -31, -10, -38, -3,
+	3, -44, 5, 39, 27, -3, -47, 8, 4, 24, 29, 54, -18, -7, -45, 6,
+	-7, -72, -32, 51, -34, -8, -9, -13, 50, -22, 16, 49, -30, -47, -9, 85,
+	-12, -18, 43, -19, 14, -19, 73, -65, -3, -25, 46, 58, -38, 56, 6, 44,
+	7, 29, -33, 27, 21, -52, -47, 34, -55, 11, 24, -65, -43, 53, 8, 36,
+	26, 23, 15, 28, 29, 4, 4, -1, -34, -35, 30, -13, 6, 53, -36, 59,
+	-38, -14, -9, 46, 6, 42, -3, 44, -61, -36, 45, 39, -35, -46, -8, 66,
+	37, -44, -8, 8, 47, 0, 50, 18, 18, -33, 38, -46, 34, 58, -7, 29,
+	-4, 46, -21, 24, 6, 35, -2, 60, 17, -35, 40, 27, -32, 19, -41, 26,
+	-29, -30, 80, 54, -77, 60, 18, 7, -7, 30, -47, 19, -60, -20, -44, 9,
+	1, -56, 8, 57, 5, -30, 17, -45, -2, 43, -23, 32, 5, -16, -26, 8,
+	25, 30, -4, 45, -33, 57, -6, -43, -11, -17, 27, -14, -10, -27, 49, 63,
+	12, 22, -14, 62, 59, 64, 29, -48, 9, 15, -58, 8, -23, -41, 43, -25,
+	60, 23, -7, 15, 27, 37, 51, 0, 53, 24, -26, -20, 35, 2, -71, -11,
+	15, -30, -43, 19, -19, 51, -31, 43, 43, 19, 34, -24, -47, 30, 24, -52,
+	-19, -2, -18, 6, -12, -10, -19, 0, -32, -21, 14, 39, 18, -15, 55, 0,
+	-13, 24, 16, 10, -18, 10, 14, 47, -52, 24, -39, -38, 53, -31, 45, -11,
+	-6, -41, -5, 28, -11, -39, -15, 21, -8, -58, 1, 27, 45, -16, 23, -29,
+	-34, 18, 51, 18, 42, 4, 44, -60, 5, -3, 64, 34, -21, -23, -16, 46,
+	-4, -4, -40, 59, -7, 23, 26, -40, 37, 77, -2, 5, -44, 23, -45, -6,
+	31, 0, -17, 32, -33, 5, 29, 21, 2, -38, -35, -36, -51, -3, 20, -46,
+	-35, -35, 31, 29, 9, -19, -7, -21, 44, -18, -31, 7, -7, 1, 47, -43,
+	12, -56, -14, -12, -78, -42, -39, 22, 40, 10, 4, -40, 56, 44, -6, -10,
+	-27, -52, 27, -23, -9, -44, -10, -5, -10, -8, -19, 53, -3, -15, 24, 28,
+	-9, 29, -48, -58, -9, 0, 83, 21, -71, -25, 28, 1, -6, 4, 30, -62,
+	-49, -49, 24, -41, 45, -56, 38, -62, -6, 12, -10, 47, 68, -3, -65, -19,
+	4, 25, -19, -14, 44, 11, 15, 28, 22, 4, 39, -22, -7, -20, -50, -17,
+	-34, 2, 52, -29, 18, -6, -47, -36, -22, 31, 1, 22, 77, -50, 19, 50,
+	-23, 65, 31, -35, 28, -17, -46, -10, 38, 40, -27, -12, -11, 52, 49, -22,
+	49, -37, -14, -47, 29, 30, 27, 60, -48, 17, 72, -35, 13, -13, -42, -30,
+	5, -24, -64, 19, 27, -1, -22, 39, -25, -5, 19, 57, -49, -6, 54, 31,
+	8, 65, 64, 8, -66, 7, 2, 34, 23, -37, 8, -14, 17, -21, 25, -17,
+	-8, -20, -70, -103, -30, -64, 42, -29, 18, 4, 19, 14, -11, 20, -21, -66,
+	-40, 42, 11, -34, -14, 1, 77, 15, 61, -69, 36, -13, 14, 35, 88, 9,
+	32, 13, 23, 4, 57, 5, 58, -20, -39, 17, 43, -19, 18, 21, -4, 20,
+	59, -40, 34, -38, -10, 26, -29, -28, 65, 58, 25, 42, -22, 48, 22, 42,
+	0, -48, 1, -38, -18, 10, -10, 11, -48, -59, 31, -13, 5, -11, 26, 35,
+	-25, -3, -17, -10, -27, 51, 0, 14, 56, -2, -38, 26, 64, 15, 50, 45,
+	36, -53, -2, 42, 13, 36, 6, 16, 12, 49, 8, 44, 16, 32, -13, -20,
+	-37, 16, -5, -7, 24, 35, -50, -55, -11, -38, 68, -22, -52, -9, -47, 31,
+	-3, 7, -56, 49, -13, -17, 25, 52, -22, -57, -4, -36, -12, 3, -10, -52,
+	-20, -16, -18, -2, 47, -14, -43, 33, 2, -68, 10, 41, -26, -13, 20, -29,
+	-23, -38, 41, 54, -33, -21, 48, 12, -18, 10, 20, 32, -14, 19, -2, 24,
+	-41, -40, 48, -30, -9, 39, 66, -41, -8, -37, -32, 33, -40, -16, -13, 43,
+	3, -38, 16, 43, -15, -52, 10, -37, 21, -59, 35, 48, -54, 34, 30, 28,
+	0, 49, -19, 52, -34, 46, 41, 56, 13, -2, 60, 43, 52, 20, -11, 22,
+	-47, 47, -46, 46, 54, -44, -4, -6, 7, -34, -50, 24, 16, -1, 0, 21,
+	61, 21, 7, -1, -17, 70, -11, 16, 12, 24, -32, -7, 25, 9, 39, -49,
+	25, 51, 12, -6, -2, -2, -21, 2, 19, 37, -35, -27, -54, -25, -27, -35,
+	2, -21, 56, 27, 24, 73, 1, 13, -28, 3, 4, 46, -52, 20, 11, 25,
+	-15, 50, 8, -6, 17, -11, -35, -37, -49, -60, 71, 29, -7, 41, 16, 41,
+	45, 26, 30, -55, -25, -12, -10, -62, -22, -22, 31, -2, 64, 57, 9, 57,
+	71, 19, -73, 52, 36, 20, -36, 55, -5, -23, -24, -44, -25, 13, -32, 21,
+	-35, 57, -17, 17, -12, -28, 62, 48, -18, 63, -12, 50, -9, 9, 5, -32,
+	57, 24, 44, -17, 20, -31, -30, 26, 46, 18, 20, -4, 58, 47, 20, 2,
+	-38, -58, -41, -16, -10, 32, -5, -35, 32, 40, 42, -24, 6, -29, 2, -25,
+	-6, 17, -47, 6, -7, 86, -69, -45, 37, -21, 27, -51, 17, -18, -3, 28,
+	-1, -9, -12, -78, 52, -32, 59, 43, -78, 67, 63, -6, -56, -34, 13, -18,
+	-31, 25, -40, -18, -3, 35, -22, 68, 50, 53, 11, -42, 22, 66, 6, -17,
+	-36, -35, 68, -53, 1, -59, 69, 48, -37, 3, 50, 28, -1, -15, -35, 0,
+	-40, 16, -53, 34, 17, -39, -4, -73, -33, -49, 3, -40, 30, 16, -25, -35,
+	-35, -30, 43, -21, -4, 23, -28, 41, 52, 37, 4, 23, -8, -30, 1, 41,
+	-36, 2, -17, -40, 23, 46, -14, -4, -46, 3, 1, -15, 8, -22, 18, -30,
+	28, -2, -53, 51, 25, -9, 13, 31, -3, -20, 6, -46, 0, -24, 15, -23,
+	66, -9, -63, 53, 27, 10, 40, 36, 8, 4, 6, 57, -12, 8, -29, 40,
+	22, 29, 65, 63, 11, 31, 8, -50, 52, 31, 28, -26, -26, 8, -30, 20,
+	45, 13, 3, -40, -30, -6, -51, -41, -46, -20, -30, -51, 9, 8, -45, -47,
+	13, 53, -49, -33, -40, -49, -3, 2, -36, -46, -13, -3, -3, -27, 52, 40,
+	16, 2, 20, -31, 19, 68, 23, -7, -49, 34, 2, -36, -35, -20, 44, 29,
+	-51, 0, -35, -40, 12, -30, -42, -15, 7, 32, -2, -54, 34, 42, 12, 50,
+	-13, 27, 10, 12, 0, 35, -6, 10, 9, -49, 11, -10, 10, 48, -16, -40,
+	-9, 46, 14, -45, -27, -21, -20, 34, 13, -21, 31, -1, -32, 36, 51, 7,
+	-49, 51, -6, -32, -33, 6, -5, -37, -21, -47, -11, -31, 43, 51, 32, -35,
+	-37, -16, 3, 20, -47, 47, -49, 32, -33, 13, 28, -44, 40, -35, 36, -20,
+	5, -25, 48, 8, -13, 16, -6, -25, -36, -26, -43, 52, -16, -30, 10, 26,
+	29, -43, -24, -19, -3, 19, -3, -13, 20, 4, -15, -36, 36, 11, 20, 0,
+	-58, 5, 52, 38, 24, -26, -28, 1, -20, -16, -48, 48, -8, -36, 44, -14,
+	20, 52, 33, 49, 30, 47, 21, -31, -18, -34, 46, 36, -44, -17, -36, 36,
+	-47, -15, -42, 21, 15, -40, 21, -34, -18, -51, 1, 8, 26, -40, 6, 49,
+	-32, -31, 4, -32, 45, -31, -35, 10, -50, 23, -16, 34, -13, 42, 14, -22,
+	15, 3, -3, 10, 39, -33, 31, 8, 27, 23, -22, -57, -31, 3, 68, -53,
+	38, 10, -29, -44, 29, 61, 54, 39, -25, 25, -55, 16, -38, 59, 40, -1,
+	39, 7, -1, -12, 40, 1, 53, 63, -25, -7, -41, -6, 11, -70, -40, 63,
+	32, -20, -30, -38, -10, -38, 74, 14, 2, -47, -20, 22, -39, 63, -9, -24,
+	-2, -7, -26, 40, -20, 33, 14, -29, 63, -27, -13, -61, -16, 65, 7, 55,
+	37, -16, -41, 42, 14, 30, -20, -60, 49, 23, -10, 4, 13, -18, -21, 6,
+	10, -29, 49, -14, -6, 42, -3, -67, 18, -42, 27, -63, 51, -43, 23, 45,
+	1, -29, 20, 61, -35, -41, 37, 41, 36, 18, -30, 50, 44, 6, 55, -51,
+	42, 7, -34, 17, -5, -55, 18, -31, -7, -40, 69, 17, -51, 37, 28, -41,
+	-20, -26, -30, -17, -84, -39, -71, 11, 67, 17, 47, 45, -14, -69, -19, 12,
+	44, 50, -28, -33, -54, -24, -56, -45, 6, -19, 19, -64, 13, -26, -37, -13,
+	66, 30, -15, -18, -53, -51, -16, -10, -53, -61, -3, 28, 55, -2, -4, 57,
+	-6, 0, -26, 47, -7, 41, 12, -36, -30, 34, 32, 18, 50, -27, 37, 11,
+	-12, 10, -43, 64, 49, 10, -20, -7, -10, -47, -25, -20, 3, 24, 35, -2,
+	-30, 26, 22, -12, 48, -56, 27, -22, 2, 37, 58, 0, -15, -1, -54, -43,
+	27, -12, 7, 17, 33, 1, 48, -35, -49, -18, 32, -34, 15, 35, -27, 16,
+	38, -23, 67, 13, -23, 25, -16, 47, 60, 40, 25, 14, 21, -11, -18, 34,
+	29, -34, 49, 27, 34, -25, -52, -23, -18, 57, 52, -13, -5, 10, -41, -37,
+	-60, 19, -22, -18, 30, -16, 56, 2, -20, -56, -47, 0, 47, -9, -25, 39,
+	-35, -35, 24, 34, -16, -33, -38, 14, 1, -51, 0, 20, 35, -32, -11, -11,
+	30, -38, -37, -17, -32, 54, 36, 34, 18, 13, 7, 20, -41, 83, -8, 32,
+	-1, 25, -39, 46, -19, 48, -6, 44, -30, 32, -45, -34, -33, -17, -9, -28,
+	48, -25, 38, 13, 57, -14, 22, -28, -10, 52, 26, -4, 55, 5, 12, 7,
+	55, -45, -11, -51, 32, -17, 8, 23, 67, 38, 18, 45, -33, -32, -7, 58,
+	32, 49, 41, 41, -29, -20, -15, 61, 5, 15, -43, 93, -11, 45, -57, 21,
+	71, 25, 1, -40, -21, 62, -23, -32, 18, 28, 14, 23, -12, -46, 49, 72,
+	-23, -23, -56, -46, 43, -38, 32, 24, 26, 56, 10, 40, 31, 29, 37, -12,
+	-37, 4, 16, -32, -20, 38, -11, -7, 22, -23, 40, 50, 41, -1, -43, -24,
+	-53, 16, 14, -33, -63, 37, -3, -52, -41, -45, -5, -45, 63, -1, 30, 28,
+	-39, 34, 21, 53, -16, -42, 32, 28, 54, -4, -25, -15, -48, 23, 32, 32,
+	-37, -34, -21, 22, 41, -23, -42, -14, 20, -29, 54, 19, 10, 9, -49, 8,
+	54, 13, -20, 14, 5, -35, -14, -8, 34, 38, 9, -5, -15, -44, -25, 35,
+	9, -27, 16, 20, -15, 21, -15, 21, 47, -37, -6, 8, 74, 24, 13, -35,
+	-69, 2, 16, -24, -24, 51, 14, -22, -19, -33, -44, -17, -13, 34, -7, -14,
+	39, 58, 40, 1, 45, 16, -71, -49, -19, -10, 16, -31, -49, -45, -30, 41,
+	8, 44, 34, -29, 67, 43, 41, 41, 48, -53, 22, -16, -21, -19, 28, -3,
+	12, 60, 12, 25, 35, -46, 12, -36, -18, -18, -48, 45, -3, 11, -15, 34,
+	-10, 11, -64, 3, 5, -38, -35, 66, 25, -41, -22, 33, -10, -10, -14, -4,
+	-6, -42, -49, -56, -55, -32, 35, 33, -20, -46, 10, 35, -29, -56, -22, 49,
+	76, -9, -5, -19, 30, 44, 37, 44, -9, 16, 33, 65, 41, 16, -60, -11,
+	40, -26, 30, 32, -52, 9, 59, -55, -25, -37, 33, 10, 41, 44, 45, 22,
+	51, -11, -34, -5, -6, 34, -12, 53, -19, -47, 7, 42, -20, 46, -40, 69,
+	-22, -14, 56, 34, -33, 44, 35, -44, -52, 10, 12, -10, 23, 30, 0, 3,
+	-28, 42, -13, -34, -42, -53, -37, 54, 32, 32, 8, -43, 67, 13, 45, -21,
+	-33, -13, 24, -10, 7, -25, -30, -23, 35, -41, 19, 35, -11, 28, 22, -30,
+	93, -12, 16, -11, -58, 18, -38, 31, -1, -58, -68, -4, 26, -18, 59, -3,
+	8, -9, -39, -32, -37, -55, -36, 10, 20, 19, 3, -21, 27, 62, -22, 11,
+	15, 34, -25, -42, -17, 54, -27, -68, 1, 25, 59, -33, -27, 47, -23, 70,
+	-16, 62, -17, -50, 74, 13, -49, 3, -44, -3, -12, 40, -6, -41, 33, -27,
+	-29, 36, -27, -32, 38, 50, 0, 61, 57, -41, 41, 37, 31, -31, -7, -17,
+	57, 71, -48, 36, -11, 60, 24, -16, -23, -6, 69, -23, -8, 26, -22, 40,
+	-28, -1, 5, -3, 8, 7, -55, -13, -68, -16, -33, 93, 11, -30, 7, 53,
+	-36, 63, 55, -15, 22, 8, -28, -34, 2, -39, -40, 31, -69, -87, -44, 48,
+	49, 5, -27, 62, 87, -25, -90, -49, 14, -57, 40, 2, 0, -31, 35, 39,
+	37, -50, 90, 40, 37, -38, -45, 34, 8, 53, -17, -52, 32, 38, 7, 28,
+	13, 4, -48, -23, 9, -19, 53, -35, -30, 26, -14, 31, -14, -65, -14, 12,
+	-2, -24, 16, 31, 32, 19, -40, 87, -21, -1, 40, -36, -6, 13, 31, 21,
+	26, -64, -3, 47, -62, 53, -55, -24, 16, -36, 37, 51, 51, -5, -24, 55,
+	-22, -5, -40, 38, 49, -2, 15, 44, 53, 28, 7, 11, 7, -19, 55, 20,
+	16, -39, -17, -51, -30, 25, 7, -47, 20, -9, -41, -27, 10, 32, 4, -5,
+	36, 8, 1, 24, -7, -9, 64, 55, -6, 15, 0, 43, 25, 32, 10, 0,
+	-36, 5, -20, -50, -21, -30, -51, -25, 20, 11, -38, 7, -6, 28, -32, -14,
+	-46, -9, 23, 28, -21, -27, 11, -22, -15, 11, 39, -3, -47, 29, -40, 44,
+	50, 38, 11, -7, 46, 23, -50, -30, -26, -45, -35, -1, 3, -11, -38, 44,
+	-19, 39, 37, 15, 23, -13, -34, -29, -11, -24, 14, -7, 36, -9, -8, -37,
+	44, -15, 58, 53, 60, -11, -6, 5, 42, -15, 23, 21, -18, 15, -9, 39,
+	41, -9, 24, -1, -47, -25, -26, 19, -8, 45, -38, -3, -30, 12, 30, 15,
+	32, -17, 39, 48, -8, -26, 35, -13, -23, 17, -29, 43, 1, -58, -33, -44,
+	-13, -44, 42, 4, 12, -6, -49, 9, -21, 32, 29, 53, -47, 22, -36, -32,
+	6, -47, 46, -28, -29, -36, 37, 29, -41, -40, -10, -10, -12, -32, -3, 28,
+	7, 18, 2, 56, -32, -19, 23, 45, -24, -11, 38, -17, -16, -26, -28, -41,
+	-24, 22, -19, -25, 64, 28, 35, -1, -16, -29, 39, 16, -2, 21, 46, -3,
+	-49, 31, 4, -12, -32, -1, 8, 16, -18, -13, -13, 55, -41, 8, 7, 26,
+	44, -5, 46, -22, 63, 31, -52, 27, -44, -11, 55, -1, -18, -50, 59, -17,
+	31, 55, -4, -25, 10, 9, 24, 11, 46, -27, -7, -25, 13, -15, -26, -15,
+	-44, 13, 43, -30, -34, -22, 54, 48, -23, 16, -39, -45, 3, 34, -1, 58,
+	-10, 19, -32, -25, -11, 34, 18, 48, -6, -45, 43, 43, 41, 24, 27, -10,
+	-46, -60, -2, -39, 43, -31, -49, 48, -40, 33, -49, 23, -26, -34, -15, 32,
+	14, -9, -43, 9, 18, 7, -72, -29, 27, -26, -5, 16, 9, -2, 41, -48,
+	-36, 37, 50, -56, 47, -13, 45, -38, -39, -22, 42, 38, 33, 25, -40, 48,
+	-35, 24, -2, -44, 44, -9, -50, -45, -48, -43, 6, 33, -43, -19, 59, -46,
+	-20, -7, 16, 11, -36, 57, 55, -14, -34, 7, -26, 62, -12, -19, 57, 1,
+	45, -40, 18, -32, -27, -41, 28, -10, 18, 53, 47, 43, 8, 14, 11, -49,
+	-30, 13, 28, 40, -23, -22, -25, 18, -10, -1, -6, 40, 46, -20, -42, -7,
+	28, -12, -17, -22, -36, -50, -51, 39, 5, -51, -11, -19, -24, -12, 46, -56,
+	48, 11, 43, -4, 13, -42, -8, -11, 6, 48, -50, 29, -7, -24, -3, 55,
+	-28, -47, -5, -46, 12, 0, -31, -42, 39, 36, 21, 28, 22, -44, 50, -36,
+	-8, 18, 20, -26, 61, -43, 1, 63, 36, -63, -53, -21, 6, 25, -23, -17,
+	1, -69, 64, 86, -46, 57, 39, 61, -31, 47, -17, 27, -70, 9, 37, -41,
+	9, 38, -42, -49, 26, 17, 4, 50, -23, 13, -40, 60, -1, -35, -4, 56,
+	-47, 26, 5, 27, -10, 19, 1, -19, 58, 22, -32, -76, 9, -37, -25, 30,
+	-78, 6, -41, 32, 53, -56, -26, 10, 52, 33, -28, -46, -42, 3, 37, -50,
+	51, 40, -13, -11, -16, -51, 26, -2, 17, 48, 17, -25, -43, -2, -40, 24,
+	31, 9, 74, -11, -77, 26, -6, -39, -20, 17, -17, 35, 45, -26, -52, 79,
+	34, 35, 35, -46, 40, 57, -2, -9, -47, 29, 24, -10, -13, 18, 26, -68,
+	-48, -7, 55, -27, 62, -60, 39, -10, 33, -52, -22, 3, 18, 92, -50, 41,
+	0, -24, 31, -11, -85, -12, -13, 63, -18, 58, -5, -26, 28, -16, 34, -10,
+	41, -4, 82, -15, 101, 17, 51, -14, 59, -19, -22, -35, -25, 59, -10, -3,
+	54, 52, -30, 13, -33, -39, 25, 20, 22, -57, 35, -6, -20, -22, 27, -54,
+	-24, -66, 38, -19, 89, 74, 6, 47, 13, 75, -91, -5, -7, -33, -9, -63,
+	-20, -52, 6, 32, 44, -68, -31, 32, 13, -33, -52, 39, 19, -14, -36, -35,
+	4, 51, 45, 2, 22, 13, 13, -1, 3, 12, -55, -25, 0, 43, 55, -39,
+	-46, 53, 24, -10, 59, 29, 60, 7, 53, -27, 17, -17, -1, -25, 32, 15,
+	37, 31, 64, -19, 55, -21, 28, -25, 13, 28, 59, -49, 13, 17, 51, -52,
+	-58, 13, 19, 39, -23, -18, -28, -18, 23, 12, -59, 5, 17, -6, 49, -26,
+	-76, -9, 26, 20, 13, -1, -45, -10, 47, 69, 26, -42, 36, 34, 63, 39,
+	34, 23, -18, 37, -12, -38, 21, 34, -31, -2, 6, 43, -45, 35, -15, -30,
+	64, -44, -39, 28, -20, 1, -8, -55, 49, 28, 62, -47, -20, -7, -25, -16,
+	65, 19, 18, 31, 35, 40, -28, 14, 23, 26, -24, 5, -16, -29, -46, -26,
+	34, 15, -32, 23, 57, 60, 37, 44, 36, -1, 14, 15, 6, 30, 29, 52,
+	31, 8, 57, -39, -50, -66, 10, -55, 33, 45, 27, 33, -8, 31, -49, 20,
+	34, -42, 32, -19, 0, 29, -11, -27, -10, -23, 8, 16, 72, -6, -27, 22,
+	-33, 9, -16, -44, -5, -52, 61, -29, -41, -48, -51, 39, -54, 42, 8, 16,
+	-7, 3, 61, -1, -34, 15, 9, -24, -31, -31, -28, 63, 72, -39, -10, 73,
+	-15, -29, 8, 31, 2, -3, 0, 22, -9, 10, 47, -66, -1, -3, -37, 20,
+	-52, -22, 41, -32, -51, -27, 45, 0, -2, -52, 35, -35, 23, 12, -10, -64,
+	35, 12, 30, -33, -29, -15, -38, -34, 12, 28, -39, 5, 10, -16, -48, -21,
+	-46, -43, -1, -25, 34, 28, -18, -47, -45, 23, 25, -38, 16, -7, -27, -14,
+	-8, -19, -27, -35, -38, -40, 25, 38, 5, -11, 25, 67, -30, 29, -3, -51,
+	49, 47, 43, -10, 29, 31, 12, -39, 15, 74, -17, 59, -23, -50, 50, -51,
+	7, 2, 55, -20, 11, 29, -43, 24, 48, -12, 5, 18, 7, -45, 3, 17,
+	-35, -40, 18, -41, 20, -53, 37, -45, 59, 14, -39, -33, 38, -13, 3, -27,
+	-36, -39, 23, 54, -15, 23, 3, -37, 24, 1, -30, 1, -2, 42, -27, 18,
+	2, -16, -33, -43, -8, 4, 43, 48, -7, 27, 5, 2, 14, 11, -7, -19,
+	-33, 23, 33, -50, -14, -8, -36, 40, -53, -55, 34, -25, 10, 60, 3, -38,
+	-49, 54, 14, -36, -22, -48, 39, 18, -29, 66, -23, 2, 16, -2, -27, 1,
+	-40, -14, -29, 33, 47, 49, 11, -27, 25, -9, 31, 17, -28, -12, -9, -32,
+	12, 23, 21, -48, 49, -19, -31, -56, -15, 17, 31, 16, 45, -32, -11, -40,
+	-31, -23, -9, 28, 49, 47, -21, -11, 15, 13, -48, -39, -57, -5, -47, -6,
+	-49, 48, 39, -36, -53, 13, 23, -20, 8, 62, 3, -28, 26, 49, 93, 52,
+	60, -29, -18, 62, 23, 33, 32, 11, -12, 17, -49, -43, 14, 15, -52, 62,
+	-68, -30, -75, -4, -18, -16, -5, -1, 50, 1, 17, -35, -28, -4, 1, -16,
+	57, -32, -12, 29, -41, -16, -21, 38, 3, 12, 4, -44, 49, -47, 55, -6,
+	57, -6, -80, -6, 63, -19, 10, 34, 34, -48, 54, -30, 38, -33, 69, 51,
+	-73, 54, -34, 21, 15, 36, -59, -7, 16, -76, -47, -13, 34, -27, 19, -24,
+	-13, -39, 24, 40, 58, 21, -9, -7, 43, -76, -17, 74, -47, 26, -82, -13,
+	28, -33, -27, -57, 27, -61, 26, -32, 6, -26, 21, 11, 23, 9, -5, 32,
+	-5, -46, 14, -6, -27, -65, 10, -34, 0, 45, -51, -29, 73, 37, 3, 53,
+	-54, -11, -3, -4, -84, 1, 44, -47, 32, -27, -46, 34, 9, -21, 17, 28,
+	-41, -36, 17, 89, 34, -35, 7, -3, 16, -9, 22, 53, 46, -10, 45, -30,
+	73, -35, -13, -36, 24, -17, 81, -31, -6, -47, -5, -55, -23, -57, -10, 59,
+	-23, 30, -1, 8, -19, 10, -24, -35, 7, -19, -6, 17, -42, -27, 5, -52,
+	-19, -54, 55, 44, 15, -24, -41, 33, 4, -49, -61, 2, 16, -27, 32, 18,
+	-42, 27, -1, -10, 91, -35, -25, 81, 9, -3, 37, 34, 40, 26, 36, 12,
+	19, -51, 15, 30, -30, 41, 30, 1, 18, -35, 70, 48, 7, 9, -61, -8,
+	-39, 53, 24, 10, 10, 24, -13, 44, -1, 34, -34, 64, 63, -60, 33, -77,
+	-31, -17, 22, -30, -7, 39, -41, 88, -23, 0, 34, -9, 13, -46, -49, 26,
+	20, 71, 25, 67, 23, -18, -15, -13, 21, 19, 44, -16, -45, 66, 36, 46,
+	14, 30, 79, -14, -28, -21, 10, -27, 53, -22, 34, 0, 33, -17, -34, -29,
+	-7, 38, -51, 5, -12, -17, -40, 18, -29, -17, -52, 37, -25, 11, 56, -11,
+	-21, 72, 26, 28, -22, 3, -61, -24, 47, 37, -51, 26, 42, 21, 4, -24,
+	-3, 36, -35, -19, -59, -24, -1, 26, 5, 19, -25, 52, -16, -18, -15, 11,
+	-27, 26, 49, 51, -25, -21, -63, 33, 84, -34, 48, 47, -70, 49, -32, -16,
+	-14, -22, -75, -37, -41, 70, -38, -48, 28, -7, -42, 5, 4, -22, 59, 4,
+	-25, 38, 14, -36, 21, -7, 68, -30, -45, 44, -28, -24, 26, 10, -14, 1,
+	29, -11, -76, 48, 4, -24, -9, -45, -8, -53, 52, 45, 48, 7, -38, 25,
+	-36, -35, 9, -27, 10, 37, 19, -21, 16, -7, 28, 39, -44, -1, -35, 16,
+	-54, 9, 9, -49, -26, 32, -37, 53, 69, 31, -10, 13, -7, 31, -37, -50,
+	64, -67, -55, 20, 19, -8, 18, 60, 4, -12, 15, 31, -2, -7, 28, 22,
+	-17, 20, 21, -6, -3, -15, -10, 22, 9, 45, 40, 39, 43, -2, 95, -20,
+	56, 1, -72, 75, 4, -9, 11, -40, 46, 24, -18, 23, 39, -56, 71, -14,
+	-30, 9, 15, -15, -71, 62, 51, -39, -61, 12, -52, 48, 17, 58, -19, -25,
+	-8, 35, 8, -47, 61, -71, 9, 44, 30, -40, 13, 21, -35, -17, -55, -39,
+	63, -46, 22, 25, 48, -52, 26, 4, 8, -45, 4, -13, 17, -31, 9, 6,
+	-32, -43, 29, -39, -15, -31, -70, 29, -16, -17, -14, 67, 55, 33, -3, 7,
+	31, 85, 47, -10, 58, -1, 65, -16, 36, 51, -50, 10, -37, -59, -26, 28,
+	-56, 32, -37, 0, -52, 47, 54, 31, -65, -36, -41, 19, 55, 48, -17, 21,
+	-53, 48, 13, -34, 8, -41, 61, -39, -10, 38, 19, -9, 25, -39, -2, -18,
+	42, 28, 0, 33, 15, -12, 51, 60, -34, 13, 49, 10, -11, 48, 52, 38,
+	16, -30, -40, 34, 13, -7, -11, 23, 13, 33, 1, 0, -31, -34, 3, -54,
+	-36, 7, 27, 55, -48, 31, -38, 24, 47, 47, 89, 46, -1, -54, -32, -23,
+	-36, 19, 58, 32, 1, -33, 23, 12, 40, 25, -48, 1, 70, -64, -58, 32,
+	-11, 17, -25, -54, 5, 68, -20, 0, 25, -50, 19, -44, -39, -24, 48, 43,
+	-10, 23, 0, -7, -13, 33, 0, -32, -27, 12, -43, -37, -66, -27, 36, -53,
+	30, -24, -25, -25, -28, -22, 26, 25, 49, -16, -40, 34, -68, 77, 21, 6,
+	-52, -7, -52, 36, 8, 9, -65, 51, 57, 9, 25, -34, 44, 14, 65, 61,
+	15, -40, 71, -30, -53, 22, -44, -37, -53, -1, 60, 58, -19, -9, -61, -50,
+	63, 30, -22, 48, 54, -16, -8, -16, 11, 2, -8, 15, 10, -43, -39, 23,
+	63, -54, 31, 33, 34, 21, 18, -2, 10, 47, -41, 44, -14, 32, -4, -15,
+	56, -28, -27, -47, 1, 47, 41, -73, 4, -10, -1, 32, -43, 37, 49, 0,
+	-33, 13, -31, 72, -54, 40, -47, 64, 2, -8, 19, -39, 10, 5, 11, 42,
+	33, 35, -5, -30, -42, -6, -38, -32, -13, 82, 39, 11, -7, -63, 67, -16,
+	-55, -20, -50, 34, 39, 3, -44, 58, 1, -10, -38, 38, 48, -28, -28, -7,
+	38, -28, -25, 5, 7, 29, 20, 22, 39, 33, 68, 56, 24, -46, 24, 52,
+	-28, -17, 16, -20, 15, 21, -16, 35, -23, -9, 4, -4, 34, -1, 22, -3,
+	36, 23, -18, 19, 26, -24, 3, 83, -45, 53, 42, -52, -2, -8, -32, 4,
+	66, -28, -48, 79, -17, 25, 37, -11, 49, 71, 9, -36, -61, 16, 19, 55,
+	6, 0, -54, -1, 15, -8, -26, 24, -10, 41, -60, 9, -35, 87, -47, 54,
+	12, -16, 69, 32, -32, -3, 26, -8, 47, 37, 72, 11, 43, -46, 17, 9,
+	62, -20, 92, -57, -13, -18, -28, -2, -29, -45, -18, 74, -48, 4, -19, -38,
+	-11, -31, -62, -11, 32, 13, -58, -45, 1, -16, 42, 79, 21, 69, -4, -32,
+	-4, 23, -54, 55, 11, -3, 0, 14, 50, -3, 50, -44, -18, 7, 29, 27,
+	-9, 54, 18, 3, 40, 24, 16, -29, -9, 35, -20, -51, -26, 20, -54, -10,
+	61, 31, -4, -58, -28, -41, -90, 13, -23, 16, -30, -16, -20, -42, 3, -59,
+	1, -30, -19, 42, 51, 40, -10, 80, -28, -34, 72, -5, -6, 60, -76, -43,
+	-93, 38, 71, -56, 84, 0, -32, 25, 38, 39, 102, 42, 19, 25, 15, -10,
+	-17, -49, -8, 87, 5, 55, 103, 19, 44, -78, -3, 20, 28, -3, 55, -28,
+	-3, 74, -2, -81, 16, 6, -47, 13, -70, 8, -43, -31, 5, 36, -73, 70,
+	-57, 13, 17, 1, 7, -40, 22, -40, 71, -39, -41, -1, 27, -82, -7, 36,
+	-1, -22, -4, -12, 35, -14, 41, 50, 58, -41, -25, -23, 66, 23, 12, 22,
+	-53, -38, 54, -6, 8, -66, -83, 79, 33, -24, -77, 78, 37, 27, 25, 46,
+	13, 16, 89, -20, 0, -77, -5, -2, 4, -15, -8, 53, 15, -26, 31, -12,
+	-12, -10, 24, 60, -3, 10, -22, -28, 13, 21, 56, 48, 47, 28, -18, 73,
+	59, -35, -33, 40, -39, 58, 26, 60, 36, 31, 26, -21, -12, 53, 56, 43,
+	1, 70, 13, 26, 5, 36, 39, 57, -73, 76, 11, -9, -24, 43, -46, 38,
+	-8, -17, -53, -26, -54, -43, -22, 42, 38, -34, 1, -27, -31, 35, -41, 4,
+	-22, 38, -3, 31, 0, -32, -63, 17, 5, 72, -19, 65, 44, 38, -21, -17,
+	-9, 13, -12, 25, -10, -42, 13, -36, 32, 2, -30, 25, -29, -10, 34, -2,
+	36, -36, 3, 60, 27, 0, -9, -2, -14, -31, 4, -3, -57, -40, 32, -30,
+	-39, 65, -3, -6, -34, 2, 10, 60, -21, -41, -11, 48, 11, -34, 1, -6,
+	65, -8, -25, -26, -28, -32, 54, 49, 1, 54, -42, 22, -37, 28, -57, 32,
+	-11, -54, 64, 64, -101, 40, 26, 60, -4, -38, 6, 29, -12, -49, -21, -6,
+	-30, 6, -3, 52, 32, -5, 2, 28, 7, 1, 36, -75, -57, 39, -74, 35,
+	-51, 19, 5, -37, 22, 36, 13, 35, 59, 33, 28, 22, -53, -1, 29, 19,
+	39, 61, 62, -61, 35, 52, 29, 63, -26, -47, 15, 53, 32, 10, 4, 50,
+	16, 4, 17, 21, 5, 9, 3, 2, 70, 12, 12, 37, 14, 2, 53, 37,
+	-62, 26, 83, 84, 30, -7, 27, 26, 11, 6, -23, -41, 17, 7, 38, -34,
+	-49, 20, 34, 7, -33, 55, -66, 5, -28, -65, 55, -4, 27, -29, 9, 36,
+	-9, -12, 39, 54, 8, -73, -33, 17, 53, -77, 0, -5, -39, -50, 30, 18,
+	-21, 67, -21, -45, 28, -34, -28, -16, -18, 16, -69, 10, 7, -14, 64, -50,
+	-103, -45, 27, -7, 15, -19, 55, -57, -20, 35, 31, 9, 26, 30, 17, -66,
+	91, -14, -4, -35, 18, 41, 30, 30, -67, -38, 38, 13, -28, -18, -41, 14,
+	35, 47, -41, 27, -18, 45, 56, -26, 54, -51, 27, -46, 91, 5, -42, -19,
+	19, -36, 32, 33, 41, 41, 35, 57, 30, -32, 58, 2, -39, 48, -64, 45,
+	-1, 5, -52, 63, 14, -34, -49, -17, -71, -22, -47, 46, -32, -39, -17, 25,
+	2, -50, 52, -61, -19, 29, -6, 46, 14, 23, -25, 35, -58, 26, 23, 44,
+	42, 64, -32, 9, -46, 29, 61, 1, 41, 33, -17, -43, 86, -60, 13, -24,
+	65, 22, 20, 74, 28, -22, 2, 3, -33, -12, 55, -58, 9, 52, -44, -12,
+	-45, -13, 49, 9, -12, 53, 45, -18, -18, 34, 3, 38, 76, -13, -57, 60,
+	27, 30, -24, -3, -48, -38, 48, 17, -3, 44, -4, 12, 34, 61, -2, -62,
+	24, 69, 11, -33, 13, 3, 2, -35, -33, -54, 13, -32, 45, -37, -32, 41,
+	-50, -1, -11, 58, -10, -28, 17, -10, 8, 32, -50, -35, 38, 25, 7, 21,
+	-12, -49, 16, -50, 39, -22, -24, -37, -32, 20, 40, 4, 14, -11, -40, -24,
+	21, 20, -10, -35, 7, 33, -52, -18, 47, -44, 47, 52, -11, 41, -16, -10,
+	48, -26, 3, -42, 7, -19, 5, 15, 54, 23, 28, 36, -18, 7, 2, -3,
+	24, 30, -26, 30, 61, -54, 27, 55, 11, -6, -34, -48, -41, -35, 46, -32,
+	-14, 24, 31, 43, -14, -7, -22, 16, 38, -44, 7, -26, 7, 36, 22, 3,
+	-24, 6, 50, -19, -17, 51, -48, 26, -23, -15, 9, -11, -2, -44, -45, -41,
+	-51, -34, -32, -12, 19, 11, 13, 29, -54, -14, 27, 20, -34, 39, -20, 39,
+	-49, -20, -41, -42, -53, -44, -24, 33, 64, 31, -20, 6, -38, -31, 2, -4,
+	-42, 4, -25, 12, -30, -24, -52, -38, 24, -29, -48, -17, -17, 30, -10, -10,
+	22, 40, 7, 33, -26, 26, 0, -51, -1, 42, -3, -21, 57, 47, -18, -36,
+	34, -20, -26, 41, -44, -10, 27, 0, -4, -50, -7, -31, 36, -55, 48, -2,
+	-34, 28, -4, -44, -25, 14, 5, 48, 32, -17, 3, -28, 0, -3, 7, 0,
+	19, 19, -26, 56, 21, 4, 41, -19, -1, -14, 29, 14, -1, 18, 57, -55,
+	-4, 46, -2, 15, -35, 56, 32, -12, -24, 3, -38, -37, 58, 16, -40, 15,
+	94, 3, 25, -17, 30, 26, 21, -39, -12, -28, 28, 15, -50, 26, -10, 22,
+	-45, -26, 54, -11, 42, 51, -26, 57, 20, 1, 23, 11, 36, -61, -31, 40,
+	-6, 15, -25, -30, 47, 4, 55, 66, 28, -15, -7, 29, 1, 42, 12, 52,
+	-29, -49, 87, 57, -14, 69, -8, 20, -27, 49, 32, -64, -1, 21, 48, 31,
+	41, -48, -39, -16, 26, -1, 27, -16, 4, -47, 22, 56, 48, -10, 37, 8,
+	56, -29, 32, -45, -54, 11, 56, 14, 42, 52, 16, 52, 73, 65, -20, -5,
+	-5, -27, -31, -16, -29, 30, -54, 16, -28, 12, 13, 37, -29, 25, 42, -41,
+	0, -24, -20, -20, 22, 45, -33, 17, -36, 11, -58, -34, 67, -30, -24, 29,
+	16, 20, 17, -52, 25, -29, 15, 16, -41, 38, 6, 6, -26, 40, 62, -46,
+	10, -1, -55, 27, 31, 41, 20, 59, 68, -4, 12, 30, 7, 12, -27, 20,
+	37, 8, 69, -2, 15, 20, -16, 35, 54, 21, -57, 24, 54, -26, 65, 14,
+	-60, -30, 55, -33, 52, -49, -15, -40, 61, -9, -14, -18, 35, -3, 48, -42,
+	-41, 17, -7, -39, -19, -59, -20, 59, 23, 23, -19, 32, -6, 30, -57, -34,
+	26, 8, 32, -5, 64, 37, 11, 34, 25, -8, -40, 35, 56, 57, 13, -16,
+	46, 2, 9, -41, -72, -51, -39, 38, -17, 42, 35, -94, 64, 58, 51, 22,
+	0, 3, 11, -48, -39, 6, -50, 27, 23, 49, -9, -70, 3, 12, 10, -16,
+	58, 33, 41, 16, 22, -28, -36, -58, -31, -21, 47, 39, -14, -59, 40, 15,
+	54, 24, 9, 53, 63, 78, 30, -43, 37, -73, 50, 78, -24, 46, -50, -72,
+	15, 31, -1, 13, -4, -2, -49, 47, -28, -37, -21, -67, -53, 3, 54, 36,
+	42, -30, 17, 23, -4, -84, 26, 1, 12, -15, 19, -5, 85, -15, -52, 44,
+	-34, -35, 15, 25, -21, 36, -1, -23, -30, 13, -3, 43, -26, -6, 45, -80,
+	62, 25, 93, -20, -3, 53, 25, -36, 44, 30, 47, 45, 55, 82, -67, -12,
+	5, -3, -23, -22, -14, -36, 28, 49, -56, 102, -28, -24, 54, 26, -16, 29,
+	-8, -21, -24, -29, 9, 1, -16, 50, -5, -19, -88, -12, -62, -86, -36, -23,
+	11, -47, 13, 17, 8, 1, -15, -14, 17, 5, -29, 42, 68, -44, 6, 7,
+	16, 33, 23, 43, -4, 40, 15, 1, 14, -78, -18, -31, -49, -5, 26, -6,
+	-12, 61, 58, 37, 17, -20, -54, 12, -4, 51, 101, -47, 22, -5, -33, -43,
+	-29, 41, 44, 14, -18, 45, 2, -9, 58, 20, 42, -5, 29, 46, -42, 4,
+	-19, -80, 3, 18, 32, -10, 29, 1, 30, 42, 65, 6, -66, 42, -66, -39,
+	11, 6, 45, 32, -48, 16, 19, -44, -23, -13, 40, 13, 36, 27, -1, 11,
+	-12, 6, 48, -12, -4, 0, 66, 63, 18, 42, -28, -26, -1, 19, -16, 37,
+	77, 49, 5, -18, 10, -9, -40, -55, -2, 26, -13, 5, -46, 6, 74, 11,
+	0, -6, -21, 29, -33, -34, 12, 34, 9, -19, -33, -27, -35, -39, -32, 64,
+	-41, -25, -18, 22, 39, 47, 4, -11, -55, 24, -3, -27, 48, -52, -2, 65,
+	45, 0, 13, 30, -14, -3, -13, -35, -25, 24, 7, 45, 21, -1, -48, 35,
+	-1, 58, -25, 18, -8, 3, 26, -33, -27, 11, 8, 15, -35, 3, -4, -13,
+	-51, -36, -13, 46, 1, -34, -16, -25, -48, -39, 30, -42, -3, 46, 44, 34,
+	-69, 28, -26, 43, 43, 6, 3, 39, -44, -32, 43, 31, -25, 68, 4, -50,
+	50, 50, -7, 53, 61, -23, -37, -3, -34, -33, 37, -15, 74, 34, -1, 19,
+	-5, -24, 23, -55, 52, -4, 58, 21, -56, 41, -27, -60, 18, -12, 11, 15,
+	61, 82, 30, 63, -10, 12, 44, 24, -20, 28, -28, -34, -15, 25, 7, 23,
+	-37, 39, 29, -33, 16, -18, -46, -57, -4, 41, -4, 6, 35, 21, -38, -8,
+	-49, 21, 59, 41, -29, 58, 23, -11, 29, 36, 43, -2, -34, 26, 12, -17,
+	-16, 21, 54, 32, -36, -21, 21, 63, 23, 21, 38, -52, 42, 34, 27, 53,
+	34, 59, -12, 20, 41, -24, -30, -27, 1, -14, 46, 13, 16, 56, 21, 44,
+	-7, 14, 24, -4, -48, -50, -4, 0, 4, -9, 17, 32, 3, 15, -44, 30,
+	-39, -29, -8, 25, -28, -19, 9, 42, 55, -21, 22, -41, 34, -45, 54, 74,
+	-59, 6, 35, 3, -45, -32, -30, 3, -36, 35, 10, -56, -24, 24, -51, 70,
+	-23, 44, -25, 14, -8, 14, 37, 0, -22, 61, 52, -64, 6, 54, 13, -52,
+	-14, -10, 55, -12, 48, 32, 15, -2, -11, 0, -42, 10, 24, 4, 4, -48,
+	-15, 48, 48, 24, -32, 18, -41, -50, 30, 23, 39, 9, -16, -15, 32, -10,
+	-54, -5, -9, 49, -38, 6, -6, 5, -11, 32, 10, -54, -47, -23, 31, 40,
+	-63, 23, 10, 36, -5, -19, -12, 46, -12, 14, 39, -19, -6, -37, 18, -30,
+	51, -15, -7, 11, -41, -39, 32, -12, -29, 23, 8, 24, -32, 18, 36, 2,
+	45, 14, 18, 30, -53, 61, -11, -18, 28, 29, 48, 4, 16, -37, -25, -25,
+	36, -34, 5, -12, -34, 8, 9, -35, 6, -6, -8, -31, 42, 11, -40, 7,
+	-53, 35, 44, -8, 56, 53, -57, -4, -18, 32, -33, -61, -48, -7, 52, -17,
+	-52, -11, -13, -52, 62, -23, -45, -49, 6, -15, 5, -28, 14, 20, 61, -24,
+	28, 49, 4, 43, 5, -69, -52, 25, -43, -30, -3, -4, -41, 45, -6, 30,
+	55, 20, -19, -22, 44, -14, 19, 33, -5, -16, 48, 30, -16, 6, 54, 4,
+	12, 52, -8, -6, 62, -21, -80, 27, -49, 8, -36, 49, -33, -18, -9, -52,
+	33, 42, -15, 27, -55, -16, 9, -34, 20, -37, -11, -43, 61, 10, 39, -50,
+	9, -48, 19, 37, -4, -5, -37, 58, -35, 63, 66, -20, 34, -58, -64, 6,
+	13, 18, -22, -60, -30, 0, -33, -22, 15, 31, 59, -40, 48, 35, -16, 49,
+	-2, -10, 38, 56, 38, 0, 0, -30, 55, -31, 19, -1, -32, -2, -48, 40,
+	21, 11, 32, 64, -34, -74, 50, 48, 55, 45, 38, -9, 26, -9, 37, -42,
+	28, -16, 22, -7, -55, 7, -7, 11, -26, 8, 2, 39, 6, 45, 3, 43,
+	18, -81, -43, 34, 5, 50, -58, -24, 24, 52, 24, 55, 61, 39, 25, -36,
+	79, 64, -44, 32, -42, -84, -30, -44, 1, 28, 21, 39, 31, -42, 48, 30,
+	18, 47, 35, -14, 36, -62, 61, -51, 20, -2, 33, -30, -1, -5, -39, 6,
+	-28, -41, 16, 51, 43, 35, 49, 1, 6, 0, 32, 34, 30, -16, 34, 21,
+	35, 30, 4, -30, 62, -5, -9, 29, 6, -24, 26, 25, 7, -25, -62, -11,
+	38, 42, 36, -31, 29, 39, -2, -2, -13, 23, -34, -30, 8, 52, -8, -12,
+	60, -68, 22, -22, -53, 37, 36, -31, -70, -42, 44, -20, 50, -9, -13, -1,
+	1, -9, -31, 32, -14, 56, 37, 40, 57, 31, 35, -34, -3, -17, -39, -1,
+	59, 36, -9, 27, 51, 60, -29, 8, 68, 10, -53, 24, 4, 11, 17, -27,
+	20, 22, 1, 10, 76, 16, 45, 13, -59, 61, 6, -57, -30, 16, 22, 0,
+	-8, -20, 25, 43, 28, 66, 2, 58, 54, -39, 43, -28, -31, 39, -33, 31,
+	23, 31, 37, -35, -56, -57, 42, 25, -70, -29, -37, -3, -1, -50, -55, 32,
+	-24, -39, 66, -28, -68, 35, 2, 22, 18, -75, 5, 12, 5, 20, -6, -26,
+	-31, -45, -56, 54, 12, -10, 34, 20, 49, -21, -34, -9, -17, -43, -38, -24,
+	-36, -20, 31, -15, 62, 3, 20, -17, 21, -24, -33, 46, -73, 11, 4, -23,
+	-58, -48, -28, 52, -21, 15, 27, 43, 9, 58, 43, 55, 44, 21, -20, -26,
+	-11, -23, -1, -21, -14, 40, -3, 22, -17, 5, -34, 66, -4, 29, -22, 55,
+	22, 30, 5, -21, -36, 4, -53, -43, 60, 7, -54, 7, 12, 23, 94, -14,
+	-7, 44, 17, -65, 19, -35, 13, -46, 43, -47, -13, 8, -2, -42, 19, -13,
+	-37, -10, 58, -7, 76, -27, 41, -8, -15, 25, 32, 15, -29, 10, 31, 38,
+	-29, -2, -5, 26, 10, -37, -9, 52, -26, 9, 1, 60, 21, -7, -64, 19,
+	-54, -10, 15, -17, -4, 18, 33, -4, -6, 28, 72, 26, -34, 27, 38, 80,
+	24, -5, -57, -55, -40, 56, -2, 21, 26, 27, -61, 50, -34, 19, -34, 45,
+	-14, 5, -29, 4, 36, 3, -26, 32, 69, 2, -64, 1, 1, 18, 85, -48,
+	42, 22, 32, 38, -30, 65, -47, 23, 40, -20, -40, 30, 1, -1, 8, -52,
+	14, -30, 2, -36, -59, 14, -17, 3, 24, 22, 17, 30, 45, 2, 21, 93,
+	49, -47, 4, -50, -4, 50, -17, 21, 18, -45, 21, 9, -29, 63, -3, 56,
+	-5, -59, -16, 16, -31, 13, -6, -8, -59, -9, 15, 63, -50, 18, 60, -80,
+	58, 22, 31, 43, -37, 11, 17, -29, -7, 63, -50, 46, -61, 4, -73, 15,
+	-46, 19, -47, 35, -26, 32, 34, -35, 14, 22, 7, -34, -23, 44, 23, -26,
+	-25, -23, -4, -1, 4, 41, -36, 26, -42, -59, -28, 44, -48, 16, -30, -59,
+	35, 17, -19, 45, 44, 46, 7, 33, 18, -20, 40, 17, -61, -35, -27, 79,
+	18, -19, -8, 57, -19, 55, -5, -36, -21, 8, -37, 3, -23, 73, -11, -51,
+	-57, 40, -39, 8, -56, -24, -51, 27, -8, 50, -24, -30, 9, -39, 27, 2,
+	2, 8, -19, 7, 30, -52, -23, 51, -3, 72, -23, -52, -8, 9, 36, -22,
+	17, 61, 0, 24, -21, -52, 38, 10, 39, 16, 56, 2, -64, -44, -19, -35,
+	21, -25, -27, 17, 47, -27, 36, -31, 18, 24, -22, 21, -22, -50, -44, -13,
+	-35, 36, 27, 31, -11, -59, -4, -65, -57, 30, -28, -23, 41, 20, -30, -38,
+	-19, -23, -24, 1, -56, -13, -9, -18, -66, -27, -3, -12, -2, 50, -32, -54,
+	18, -50, 32, -23, 54, -45, 16, 37, -22, -28, -53, 60, -43, 20, 28, -16,
+	-15, 43, -29, 4, 23, 27, -59, 1, -87, 0, 38, 43, -24, 14, -71, -39,
+	26, 6, 11, -5, 24, -25, 39, -41, 17, 22, -40, 35, -41, 65, 14, 21,
+	37, 33, 35, -40, 45, 16, -21, 34, 7, 38, 43, 39, 68, -16, -24, -11,
+	25, 41, 75, 26, -44, 35, -10, 34, 5, -19, 22, 30, -25, -25, 34, 29,
+	34, -29, -28, -43, -35, 32, 36, 45, -44, -37, -60, -19, 55, -32, 9, -22,
+	-26, -45, 50, -3, 40, -40, 26, 47, 1, -54, -61, 30, 56, 48, -42, -23,
+	-27, 44, 10, -59, -29, -27, -24, 76, 19, -35, -27, -25, -44, 28, 21, -9,
+	1, 3, 32, -5, 49, 35, 21, -30, 6, -8, 8, 64, 52, -22, -34, 2,
+	-37, -44, -40, -22, 35, 21, -44, 23, -32, -33, -15, -68, -58, -2, -16, 41,
+	-12, 22, -5, 41, -32, -34, 25, -30, -33, -3, -2, 15, -3, 40, 41, -26,
+	-29, -63, 14, -13, 12, -20, -7, -43, -39, -1, 53, 34, -25, -28, 32, 37,
+	25, -24, -6, 9, 58, 45, 77, 22, -10, 5, -50, -31, 41, -17, -20, 10,
+	19, 33, -4, -13, 32, -21, -57, 11, 33, 3, 0, 22, 56, 52, -34, -41,
+	23, -21, 43, -12, 44, -46, -39, 73, -31, -8, 7, -41, 18, 19, 21, 66,
+	-15, 10, -10, -42, -26, 23, -5, 21, -18, -17, 66, 61, 33, 30, -12, 9,
+	57, 14, 57, 15, 15, 29, 49, -2, -12, 20, -12, -46, -26, 17, -30, 55,
+	-18, -6, -56, 57, 4, -56, -41, 0, -37, 14, -18, -61, 9, -27, 13, 16,
+	45, -37, 30, -4, -21, 4, -60, -46, -50, -3, -39, -41, 14, 60, -37, 58,
+	-16, -62, -19, -28, -33, -22, 18, -6, -38, -45, -52, 45, 64, 26, 13, 0,
+	57, -27, 54, -32, -15, -31, 0, -52, -22, 1, -52, 5, 13, -3, -31, 13,
+	-49, 0, -5, 68, 28, -58, -41, -14, 2, -24, -49, 44, 31, -52, -26, 27,
+	55, -23, 22, 55, 44, 60, 55, -11, 34, 12, 64, 6, 16, 19, -11, -21,
+	-6, -3, -12, -25, -27, 46, 34, -44, 46, 66, 12, 48, 3, 47, -4, 40,
+	39, -14, 32, 10, 60, 33, -44, -13, 30, -52, 57, -46, 41, -67, -63, -54,
+	12, -54, 30, -50, -37, 31, -45, 49, -10, -36, -28, 44, 5, -43, -30, 10,
+	54, -38, -21, -3, 69, -26, -28, -11, 24, -19, 11, 33, 4, -21, 30, -36,
+	27, 54, 1, 57, 53, -20, -35, 38, -35, -1, 24, -18, -69, -7, -9, 4,
+	-16, 23, 13, -56, 29, 57, -38, 12, 49, -35, 22, 12, 69, 12, -48, 1,
+	-1, 34, 2, -3, 3, -24, -19, 23, -9, -16, -54, -10, 46, -35, 15, -74,
+	-69, 27, -16, -45, 21, 47, -1, 6, -20, 20, 39, 47, 18, 60, -30, -10,
+	16, 37, -32, -40, 11, 5, 5, -71, -35, -14, 34, 24, -37, 27, 59, 12,
+	-21, -59, -7, -28, 21, -10, -57, 39, 42, -13, -11, -53, 45, 4, -60, -54,
+	-3, 19, 2, 50, -52, 29, 10, -11, -20, -48, -17, 33, -61, 7, -42, -51,
+	-46, 0, 48, 67, -40, 21, -48, 33, -44, -46, -41, -11, 23, 10, -51, 54,
+	23, 45, -10, -11, -29, -34, 0, -20, -23, 1, 53, -23, 13, 69, 11, 63,
+	-19, -25, 40, -20, -6, 65, 43, 41, 18, -14, -9, 0, -3, -24, 21, 28,
+	11, 51, -8, 51, 24, -23, 18, -45, 54, -40, -17, 28, -38, -2, -24, 26,
+	-18, 73, -48, -31, -22, -9, -20, -56, 12, 60, 10, 1, 45, 2, -26, -31,
+	57, 15, -49, 48, -6, -65, -43, 35, -17, 20, 28, -14, -11, 15, -41, 54,
+	-15, 18, -49, 40, -2, 38, -18, 13, -33, -3, 0, 37, -55, 5, -20, 71,
+	51, 33, 12, 16, -20, -25, 6, -27, -37, 38, -25, 31, -5, -48, -20, 60,
+	-23, 44, -32, 30, -46, 8, -29, -34, 20, 14, 33, -48, 35, 17, 14, -21,
+	26, -44, 10, -23, -22, 39, -7, -30, 15, 55, -44, 58, 3, -11, 22, 41,
+	-46, -50, 9, -1, -6, -16, -44, 65, -17, 30, 43, -6, 16, -14, -1, 41,
+	-5, 45, 48, -44, 29, -12, -63, 29, 14, -34, -37, -23, 43, -24, -42, -28,
+	-37, 38, -2, 24, 43, 15, -54, 4, 44, 20, 25, -40, 39, 2, 42, 22,
+	55, -30, 55, -9, -56, 36, 43, -37, 37, -16, -53, -33, -13, 25, -24, 25,
+	48, -6, 1, 56, 3, -12, 29, -20, 32, 18, 39, 16, -13, -41, 36, 33,
+	-5, -11, 11, -14, -38, 72, -46, -6, -49, -46, 6, 12, -50, 1, 69, -6,
+	-27, -6, 30, -37, -47, 14, 22, 34, -38, 5, -39, 30, 55, 16, 4, -20,
+	-13, 41, -23, 49, 5, -39, -30, -36, 54, 21, -43, -20, -21, 32, -35, 39,
+	-49, 25, 16, -10, 69, -40, -9, 25, 56, 24, -31, -1, 34, -15, -31, 37,
+	-37, 51, 18, 58, 55, 3, 63, 69, -13, 48, -14, 52, 51, -54, -5, 32,
+	9, 4, -59, 16, -4, -26, 24, 1, 29, 70, -24, -2, 26, -10, -45, -54,
+	56, 9, -5, 24, 2, 80, 42, 58, -46, 40, -44, 51, -15, -8, -26, -19,
+	-20, 24, 50, 15, -48, -29, 37, 13, -9, -34, 10, -7, -9, 19, -12, 49,
+	6, -48, -25, 61, 27, -19, -14, 72, -1, 66, 18, -5, -69, -23, -8, 8,
+	-19, 42, 4, 16, 3, 23, -20, -44, 5, -12, 15, 17, -24, 31, -32, -31,
+	35, 21, 29, -13, 16, 73, -4, 43, -22, 7, 67, 56, -59, -7, -6, 13,
+	-12, 46, 58, -33, -32, -6, -59, -21, -6, 42, -5, -8, 22, -2, 52, -7,
+	17, -24, 66, 46, 53, 25, 68, 14, 32, 54, -46, -27, -46, 34, 29, 31,
+	26, -26, 16, 25, -14, -9, -32, 10, -21, 64, 57, -27, -50, -11, 65, -9,
+	-28, -5, 22, 38, -8, -31, 22, -18, 51, -17, -5, -38, 56, 26, 16, -45,
+	-32, 20, 7, 40, 40, 28, -8, 14, -62, -11, -68, 1, -46, 23, -44, 73,
+	-7, 25, 50, 43, 51, 4, -30, -11, 15, 17, 1, 46, -31, 73, 83, -2,
+	-46, 34, 22, 42, -9, -32, -33, 4, -1, -58, 62, -16, 54, 13, 48, -37,
+	-22, -29, 14, -75, 13, -21, 38, -19, -40, 7, -20, -87, -15, 80, -28, 35,
+	-20, -43, 51, -47, -34, -13, 0, 2, -66, -25, 53, -7, 14, -10, -2, -23,
+	11, 34, 35, 52, 6, 34, -3, 32, 26, -53, 75, -29, 53, 40, 3, 26,
+	37, -26, 21, -13, 69, 22, -12, 8, 39, 7, 36, -46, 50, 59, -16, 30,
+	39, 46, 50, 14, 64, -14, 58, 26, -28, -18, 24, -79, -35, 66, 31, 55,
+	9, 39, -13, 39, 44, 58, -41, 3, -16, -6, 6, -54, -23, -33, -57, 16,
+	2, -35, -13, 42, 32, -11, -27, 21, -19, 48, 29, 63, -34, 12, 13, 2,
+	-51, 38, -50, 2, 21, -64, 61, 48, 52, -35, -36, -52, 48, -16, 40, -23,
+	63, 33, -13, 34, -16, 36, 19, 46, -1, 34, 42, -29, 9, -33, -13, 40,
+	-43, -93, -62, -26, -30, 2, 1, -33, -56, -14, 13, -44, -57, 51, 27, 38,
+	1, 34, -29, 14, 59, 54, 0, 6, 54, -29, -41, -45, -1, -39, -14, -96,
+	-28, 40, -14, 4, -32, -57, -24, -32, 27, 16, -44, -34, -28, -65, 6, 5,
+	-80, 6, 6, 49, 39, 19, -41, -52, 7, -46, -1, -31, -39, -25, -18, 14,
+	4, 48, -42, 26, -28, 33, -14, -21, 27, -11, -8, 41, 20, 35, 36, 19,
+	6, 14, 17, 31, -43, -25, 13, -48, -21, -29, -4, -46, 33, 12, -25, -14,
+	28, 36, -44, -47, 5, -28, -46, 14, 11, 2, 29, -8, 1, 31, -53, -39,
+	-15, -51, 22, 10, -34, -21, 27, -46, 50, 45, 34, 1, 53, 15, 30, 1,
+	-52, 40, 16, -24, -20, 4, -3, -52, -2, -21, 52, -30, -37, 17, 1, -38,
+	-47, 13, 5, -2, 44, -41, -52, -22, -31, -30, 42, 37, 26, 15, -12, 34,
+	-3, -24, 15, 14, -50, 1, -8, -1, -45, -20, 8, 26, -32, 15, -39, 19,
+	49, 17, -33, -40, -3, 46, 3, -47, 23, -51, 33, -49, -46, -40, 24, 32,
+	46, 22, -8, 4, 24, -42, 32, -49, 19, 15, -5, 48, -39, -22, -38, 42,
+	11, 16, 50, 8, -28, -18, -18, -25, -8, -4, -39, -51, -21, -12, 2, 33,
+	-45, -41, -12, -46, -54, -44, -29, 7, 38, -6, -18, 20, -30, 36, -4, -24,
+	3, -32, -42, -14, 2, 47, 49, -42, 46, 35, -51, 29, -18, -36, -6, 43,
+	44, 18, -36, -50, -14, 36, -13, -26, 21, 16, 47, 6, -52, -9, 43, -36,
+	31, 13, -40, -31, -7, 11, -12, -24, 14, 42, 26, 18, -4, -108, -29, -18,
+	22, -2, 14, -45, 54, -32, -38, 53, 21, 22, 63, -76, -35, 18, -15, -24,
+	-38, -26, 41, -1, -54, -1, 36, -4, 11, -31, 25, 46, 56, 2, -12, 26,
+	-31, -15, -15, 41, -14, 15, 3, 3, -30, 36, -1, -39, 50, 12, 26, 2,
+	-54, 3, -17, -5, 55, 22, 7, -13, 4, 51, -26, 12, 43, 8, 18, -41,
+	-9, -45, -28, 27, -52, -61, -46, 1, 28, -7, -16, -3, 29, 36, -16, 42,
+	-30, 52, 19, 54, -4, 21, 27, 4, 6, 8, -13, 8, 35, 39, -65, -13,
+	62, 59, -66, -32, 50, 13, -70, 59, -24, 60, -15, 19, 56, -26, -16, 17,
+	21, 74, 21, -2, 34, 37, -23, -10, 56, -54, -33, -33, 43, -48, -37, 24,
+	73, 22, -5, -54, 25, 54, -7, -39, 19, -51, -65, 45, 67, -22, -17, -22,
+	-84, -41, -23, 9, -62, 54, -31, -18, -20, 41, -59, -70, -70, 55, -22, -32,
+	63, 13, 1, -36, -4, 26, -60, 27, 27, -1, 26, -16, -37, 26, -19, 61,
+	28, 39, -18, 43, 36, -8, -8, 69, 13, 11, 37, -32, -51, 23, 38, 65,
+	41, -78, -35, -4, 36, -19, 10, -49, -2, -3, 44, 0, 71, 8, 32, -32,
+	-14, 20, 52, 13, 8, 5, 27, 21, 27, 42, 57, -49, 29, -28, 77, -5,
+	21, 43, -26, 49, -31, 75, 8, -4, 1, 28, 3, -56, 6, -56, 52, -7,
+	-52, -1, -20, 27, -5, 48, -22, -30, -61, 4, 7, -42, 26, -22, -21, -16,
+	5, 15, -38, -21, 22, -57, 17, -2, 31, -20, -1, -8, 1, 7, 11, 95,
+	-3, -10, -7, 32, 28, 24, 10, 84, -57, -31, 11, 17, 82, 62, 14, -32,
+	62, 13, 16, 78, -10, 35, 11, 53, -33, -37, 79, -23, 43, -24, 19, -57,
+	41, 18, 8, 42, 58, -22, 35, -59, -29, 23, 16, -57, 11, 16, -61, 41,
+	-109, 9, 51, 61, 59, -41, 27, -45, 37, -15, -37, -14, 72, -14, -52, 35,
+	22, 59, 11, 48, 50, -11, 31, 78, 20, -58, -18, -31, 36, -5, -36, -41,
+	-67, -41, -30, -69, -15, 47, -54, 5, -46, 56, 62, 42, 30, 33, 32, 60,
+	40, 62, -48, -38, -54, -11, -1, 31, 17, 49, 42, 5, -36, -51, -49, 42,
+	-15, 52, 83, 19, 23, 21, -17, -23, 7, 43, 4, 5, -26, 26, 71, 25,
+	34, 46, -97, -26, -4, 25, -25, 45, -64, -57, -15, -54, 37, -21, 9, 12,
+	-2, 29, 8, -80, -23, -21, -22, 1, 3, 39, 40, 44, -57, 9, -31, 33,
+	31, -25, -10, 59, 9, -49, -19, -42, 48, 34, 39, 50, 9, 37, 1, -42,
+	-8, -17, -73, 52, -26, -18, 20, 51, -3, 83, 59, -15, 65, -11, -29, -46,
+	19, 21, 51, -41, -23, 35, 61, -2, 12, -49, -31, -4, 25, 21, -35, -71,
+	10, 25, 3, 55, 14, 10, -1, 13, -14, -21, -39, -47, -52, -29, 49, -31,
+	14, 87, 63, -72, -7, 52, 0, 36, -7, -20, -34, -1, 57, -29, -15, 15,
+	39, -9, -55, -44, 24, 22, 36, -27, 46, -29, 11, 25, 69, 62, 79, -6,
+	18, -3, 28, 47, 40, 12, 9, -39, -51, 27, -16, 27, -42, -11, -1, -2,
+	18, 41, 10, -38, 45, -5, -40, -17, 34, -30, 7, 14, 21, -8, 26, -36,
+	-38, 10, 46, -16, -11, 43, 27, 64, -5, 48, 25, 1, 21, 9, -54, -29,
+	-47, -10, -46, 37, -34, -22, 27, -4, -25, -8, 38, -13, -25, -11, 50, 14,
+	-77, 71, -7, 24, -43, -52, 51, 45, 35, -51, -30, 60, 63, -1, -52, 39,
+	-28, 11, 21, 24, -31, -44, 42, 58, -56, 40, 18, 80, 3, 108, 31, 36,
+	0, -31, 16, -12, 39, 7, 44, 5, 38, -58, 21, -42, -16, -14, 41, 55,
+	-8, 23, -24, -42, 15, -16, 38, -13, 37, 42, 13, 21, 17, 35, 31, -37,
+	-21, -32, 2, -15, -36, 13, -19, 14, 46, 97, 10, -38, -28, 36, 41, -44,
+	15, 33, 54, 11, 9, 18, -58, 18, -32, 53, -4, -33, 5, -27, 29, 41,
+	50, 32, -46, 11, 18, 37, -5, 8, -39, -5, -1, 12, -41, -52, -10, -1,
+	36, -67, -58, -48, 17, 64, 27, -54, 57, 18, -35, -11, -17, -74, -47, -17,
+	-61, -50, -32, -25, 22, -55, 28, -23, 19, -5, 15, -28, 42, 57, -30, -61,
+	-6, 1, -41, -8, -40, 2, -5, 61, 28, -27, -34, 14, -55, 4, -24, 52,
+	47, -25, 22, 37, 39, 26, 39, 22, 17, 27, -4, 34, 49, -4, -18, 22,
+	-35, -48, -22, -23, 45, 45, 2, -45, 42, 30, 31, 2, -40, -12, -19, -7,
+	-9, 35, -49, 39, 52, 24, -29, 9, -3, -32, 30, -23, -12, 33, 38, 36,
+	-30, -48, 54, -9, -23, -28, 21, 13, -9, -10, -29, 28, -36, -46, 4, 34,
+	-8, 6, 19, -3, 32, -51, -33, -14, 1, 13, 19, -8, 4, 24, 36, -12,
+	64, -22, 1, 48, -52, -4, -6, -41, 18, -6, 17, -9, -53, -37, -37, 55,
+	-28, -18, -37, 8, 38, -19, -8, 18, 14, -15, 30, 16, 25, 45, 21, 23,
+	39, -21, 55, -25, -42, 21, 29, 38, 28, 22, 4, -13, -7, 72, 16, -2,
+	37, 25, -40, 30, -38, -3, -32, -28, 5, 34, 16, -9, 46, -21, -39, 54,
+	33, -23, -9, -3, -40, 10, -8, -34, 47, -9, -31, 32, -44, 9, 6, -5,
+	-11, 64, 35, -52, 6, 0, 42, -19, 24, -21, -36, 17, 26, -5, 16, -49,
+	-23, 41, 11, -24, -3, 28, -35, -41, -18, 36, 4, 21, -22, -31, -27, 4,
+	-22, 21, 41, 41, 25, -48, 5, -35, 42, -7, -3, 39, -42, -4, -10, 52,
+	-6, -49, -16, -33, 32, -7, 30, -5, -20, 56, -45, -40, 35, -17, -32, 32,
+	52, -4, -50, -50, -29, 37, 7, -7, -34, -22, 36, -46, 19, 49, -50, -40,
+	-5, -53, -24, 19, -27, -24, 11, 22, -6, -42, -19, -35, 38, 41, 44, 7,
+	-47, -39, -34, -37, -36, 16, -42, -12, 44, 23, -42, 15, -32, 61, 44, 14,
+	5, 24, 31, 11, -32, 8, 23, -39, -35, -8, 2, -46, 26, 8, 46, -30,
+	51, -47, -50, -33, -13, -33, -47, -41, 33, 13, 35, -8, -23, 2, -36, 12,
+	-30, -4, 1, -43, -13, -27, -31, -38, -23, -31, 56, -56, 18, -13, 4, 5,
+	-37, 31, 0, -22, 44, 28, -25, -7, -9, -39, -26, -16, 4, -49, 41, -21,
+	44, -16, 12, -2, -33, -9, -34, 6, -13, -45, 55, -28, 48, 49, -7, -35,
+	18, -29, 28, 37, 15, -53, 5, 43, -29, -8, -13, 47, 28, -9, -9, -12,
+	-26, -6, -51, 11, -50, -3, -31, -3, 23, -47, 1, 26, -9, -47, -8, 7,
+	26, 43, 32, 46, 44, 33, -7, -22, 32, -19, -35, -54, -1, -7, 40, -67,
+	-1, -39, -41, 57, 8, 45, -55, 7, -8, -18, -12, 2, 4, 39, 40, -22,
+	-15, -40, -56, 65, -77, 29, -27, -58, -13, 17, 6, 54, 37, -14, -16, 17,
+	-30, 44, -19, -37, 11, 31, 52, -5, -60, -21, 37, 62, 31, -28, -25, 37,
+	46, 46, 36, 48, -15, 8, 23, 45, -30, -24, 36, 2, -8, -48, -21, -48,
+	-40, 18, 11, -7, 15, -18, -20, 1, 21, -49, 21, 22, -18, 32, 60, -47,
+	-21, 71, 16, 77, -4, 4, 14, -46, 45, 42, 57, -14, -11, 49, 14, 7,
+	-14, -30, -4, -45, -69, -13, 11, -20, 35, 20, -34, 20, 27, -2, -43, 45,
+	-19, 16, -16, 6, 20, -25, 30, 29, -41, 44, 59, 19, 39, -9, 48, 53,
+	-39, 17, -35, -12, -35, -44, 44, -11, 4, 64, 4, -21, 8, 25, 13, 8,
+	-12, 37, -10, -6, 11, 30, -58, 16, -42, 15, -51, -5, -24, 75, 37, 57,
+	-35, 11, -2, 45, 0, -25, -1, -14, 46, -48, 54, -34, 5, 0, 28, -36,
+	47, 33, -51, 35, -39, -30, -48, -42, 31, -17, -3, 13, 30, 55, -20, 29,
+	14, -70, -13, -21, 33, -31, 20, 57, -34, 69, -30, -19, 0, 12, 40, 52,
+	31, -30, 3, 64, -27, -15, -6, 48, -9, 38, -39, -4, 61, -77, 53, -5,
+	-63, 5, 10, -50, 3, 18, 5, -74, -6, -8, -41, -2, 58, 18, -23, 9,
+	56, -48, 19, 49, 53, -15, 26, -54, -31, 2, -17, 48, -10, -36, 28, -9,
+	-24, -32, -6, -11, -53, 31, 14, 33, 39, 29, -27, -34, -38, 54, -64, -39,
+	50, -45, 45, 19, -19, 49, 22, 28, -2, 39, -33, -1, 49, -34, -18, -61,
+	13, 28, -23, 0, 17, 54, -19, -15, 58, -27, 25, -5, 73, -44, -28, -17,
+	-38, -41, -13, 28, -18, -49, 42, -26, 8, 71, 18, 30, -21, -2, -12, -8,
+	-31, -57, 8, 36, 5, 2, 38, 32, 45, 21, 24, 37, 15, -3, 40, 25,
+	-33, -38, 70, -22, 40, 9, -12, 9, -27, -76, 37, -37, -54, 15, -31, 28,
+	28, -8, 24, 16, -60, -7, 21, 33, -59, -34, 43, 8, 53, -14, 60, -22,
+	20, 22, -30, 35, 73, 60, 15, -6, 30, 49, -20, 41, 13, 12, -2, 26,
+	3, -47, -27, 61, -21, 56, -33, 48, 52, 7, -31, 33, 44, -32, -14, -69,
+	14, 14, -7, -49, -35, 6, 11, 3, 24, -48, -1, -39, 31, -6, -6, 39,
+	8, -35, 18, 0, 73, 5, -54, -18, 15, -24, 44, 69, -21, -28, -31, -36,
+	-57, -10, -32, -24, 32, -9, -14, 12, -28, 30, 34, 10, 20, 74, -45, -44,
+	-42, 23, 31, 33, -62, -38, 20, -3, -28, -19, -1, 45, 35, 0, -6, 38,
+	-15, -88, -42, -32, 13, -4, -16, -32, -50, 58, -43, -50, 36, 21, 47, -9,
+	57, 32, -18, -20, -2, 24, -27, -20, 14, 24, -38, 1, -31, -57, 7, 42,
+	58, -10, -20, 70, -9, 25, -30, 9, 10, -12, -6, -11, 1, 14, 33, 6,
+	51, 51, -45, 3, 42, -22, 15, 21, 4, 1, -23, 7, -65, 32, 52, -59,
+	32, 46, 33, 14, -43, -25, -58, 34, 67, -11, -54, 36, 33, -16, -39, -64,
+	-16, -28, -54, -34, 10, 6, 30, -15, 10, 29, 9, -10, 40, 43, -7, -2,
+	36, 30, 15, -18, 72, 40, -30, -4, -26, 23, -9, 27, 3, -21, 45, 1,
+	-25, -19, 27, -17, 22, 4, -43, 45, 53, -36, -11, 40, 14, -4, -13, -43,
+	33, -16, -31, 63, 25, 11, -44, 28, -14, -14, -39, 10, -5, 2, 63, -35,
+	-19, 58, -48, -31, 38, -18, 46, 46, -41, 22, -50, 30, -17, -26, 3, 62,
+	2, -46, -31, -4, -29, 13, -79, -48, 2, 33, -32, 7, -18, -29, 33, -14,
+	-16, -22, -35, 39, 32, -35, -4, 26, 10, 29, 33, -55, -42, -32, -46, 13,
+	-55, -36, 15, -2, -43, -67, -20, 67, 18, 42, 47, 11, 40, 55, 4, 55,
+	19, 8, 28, 3, 14, 44, -1, 42, 48, 18, -16, 23, -25, -40, 14, 0,
+	-7, 8, -19, -55, -29, -43, 57, -23, 6, -2, 43, -11, 17, -8, 3, -44,
+	-1, 46, 3, 38, -27, -19, 54, -2, 72, -12, -47, -2, -28, -50, -4, 26,
+	60, 41, 56, 16, -61, 14, -33, -26, 49, 65, 29, 8, 19, 16, 35, -35,
+	7, -4, -60, 36, 39, 52, 27, 38, -51, 34, -37, 10, -28, -20, -16, 30,
+	-38, 11, 42, 19, 25, -9, -54, -42, 26, -54, -8, -15, -6, -17, -38, -41,
+	21, -9, 17, -2, -9, -40, 21, -37, -37, -37, 5, -39, 40, 5, 42, 3,
+	-25, -16, 41, 55, 43, 43, 46, -21, -62, 30, -49, 31, -37, 5, 28, -29,
+	0, 45, 18, 12, 3, -30, -17, 12, -16, -25, -42, -9, 12, -30, -45, -15,
+	-53, 46, -41, 22, 40, 17, -44, -4, 27, 31, -23, -50, -2, 23, 61, 41,
+	2, 17, 4, -41, -17, -22, -23, -21, -31, 21, 3, 27, 23, 16, -24, -26,
+	28, -23, -3, -12, 31, -2, 25, 29, -6, 40, -23, -34, -55, 10, -35, -30,
+	19, 6, -18, -4, -9, 11, 40, -34, 2, 19, -33, 53, 49, -27, 25, 49,
+	-15, 35, 57, 45, -11, -22, -29, -16, -42, -12, 15, -21, -8, 20, -19, -64,
+	-6, 46, 28, 29, 11, 29, -10, -11, -41, -22, -35, -5, 17, -13, -51, 33,
+	57, -24, -73, 24, -56, 2, 36, 32, 47, 15, -38, -41, -25, -7, -15, -47,
+	11, 13, 5, 40, -30, -18, 49, 14, 49, -3, -46, 70, 7, -10, -8, 30,
+	-3, 29, 64, 66, 58, -23, 60, 2, -41, -19, -23, -11, 58, 34, -47, -17,
+	-40, 79, -47, -14, -20, 28, 14, -8, 28, 11, 68, 13, 47, 27, 0, -12,
+	-71, -25, -49, 79, 17, -103, -10, -23, 37, -68, 32, 19, -7, 67, -38, -39,
+	-75, -21, 17, 37, -12, 22, -70, -65, -33, 64, 79, 63, -70, 63, -69, 51,
+	6, 40, -53, 16, 42, 43, 19, -29, -18, 52, -23, 34, -35, 20, 37, 44,
+	3, 50, 44, 57, -60, -50, 30, 61, -21, -19, -67, -18, -7, 18, -25, 13,
+	59, -35, 58, 16, 8, -19, -8, 28, 78, 49, 4, -61, -40, 72, 76, 33,
+	14, -38, 20, 28, -64, 77, -6, -36, 84, 75, -70, 66, -29, -9, -53, 16,
+	-58, 20, -14, 28, -40, -44, -76, -8, 16, -47, -42, -60, 35, 4, 62, -11,
+	0, -44, 36, 87, -20, -9, 39, -22, -18, 60, 2, 14, 36, 35, -6, 20,
+	-61, 21, 7, 31, 50, -44, 80, 10, 1, -29, -63, -50, 50, 36, 17, 30,
+	63, 62, 29, 0, -29, -54, -14, -4, -13, -19, -42, 30, -32, -27, -82, 66,
+	0, -66, 29, -54, 0, -71, -37, -22, -36, 1, 30, 18, -3, 1, -33, -55,
+	1, -41, -46, 50, 28, 15, 36, -6, -60, 17, 18, -2, 49, 35, -64, 29,
+	42, -34, 44, 41, -21, 62, 31, -32, 27, 1, -15, -38, 20, 9, 3, 30,
+	52, -23, -29, -18, 65, -15, -46, -2, -4, -63, -55, -27, 43, 78, 75, -66,
+	21, -9, -11, 9, 45, 33, -34, 37, -41, 33, 3, -29, -4, -75, 17, -21,
+	-8, 28, -69, -18, -2, 6, -45, 1, -55, -28, -19, -19, -50, -57, -44, -6,
+	33, 39, 42, -13, 35, -8, 26, -3, -41, -73, 1, 38, 21, 77, 9, 50,
+	-64, 62, 31, -12, -42, -22, -72, 12, 28, -55, -4, 39, -48, -36, -46, 19,
+	-6, -15, -28, -20, -1, 11, 48, -28, -50, -44, -7, -20, 0, -46, 64, -87,
+	17, 12, 1, -11, 28, -22, -66, -71, -1, -18, 51, -26, -43, 36, 42, 2,
+	-34, 40, 48, 15, -4, -4, -62, -1, 16, 34, -70, 41, 0, 33, 31, -14,
+	11, 71, 0, -8, 33, 39, 64, -11, 83, -36, 28, 21, -1, -26, -19, 60,
+	-8, -11, 63, -45, 26, -38, -44, 44, -44, 37, 35, -53, 18, -51, -58, -13,
+	44, -28, -9, 32, -72, 37, 22, 17, -32, 80, -34, 53, 9, 58, -47, 56,
+	29, 2, 79, -50, -72, 17, -41, -20, -26, -4, -13, -31, -9, -23, -19, -13,
+	-19, 55, 7, -14, -22, -5, -37, 20, -72, -28, 40, -66, -1, 49, 69, -6,
+	47, 28, -15, -20, 28, -8, 36, -2, 89, -32, 75, 57, 63, 10, -37, -9,
+	70, -54, 10, 92, 26, -54, 17, 6, -41, -19, -44, 31, -56, 6, -55, 17,
+	41, 62, 15, 48, -8, -11, -45, 62, 34, 69, -31, -41, 9, -3, -34, 8,
+	66, -25, -61, -53, -24, 12, 43, 48, -57, 7, 25, -40, 9, -12, 11, -14,
+	42, 49, 19, 26, -20, 3, 80, 44, -75, -4, -62, 28, 43, -14, -51, -31,
+	17, -17, 20, -41, 7, -4, -4, 48, 21, -22, 32, 60, 14, 14, -21, 41,
+	-17, 19, 33, 14, -9, -5, -22, -27, -32, 51, 10, -33, -11, -31, -34, -93,
+	54, 16, -3, -48, 38, 34, 29, 31, 66, 1, 32, -5, 39, 30, -36, 29,
+	-50, 86, -7, 19, -8, 1, -35, 10, 1, -63, -34, 30, -73, 81, 72, -41,
+	-11, -9, 3, -21, -84, 71, -30, -62, 42, -65, 72, 23, -19, -11, 37, 31,
+	43, -55, 2, 53, -46, -15, -29, -35, 38, -30, 42, -51, -45, -27, 56, 42,
+	7, -1, 68, 23, -72, 20, 34, -43, -25, 39, 37, -14, 22, -69, 22, 59,
+	4, 10, -26, 14, -4, -26, -24, 9, 2, -6, 19, -35, 15, -73, -54, 37,
+	10, 27, -54, -33, -48, -22, -27, -19, -38, -1, 28, -5, 0, 24, 48, 23,
+	-35, 29, 27, -6, -65, 42, -15, 33, 36, 4, 15, -25, -43, 59, -35, -51,
+	-44, 26, -51, 1, 47, 35, 36, -10, -44, -37, -5, 3, 48, 18, -13, 63,
+	-19, -16, 20, 15, 69, -18, -28, -21, 36, -30, 17, 43, 61, 38, -11, -55,
+	-5, 41, -14, -27, -13, -59, -21, -43, 66, -7, -1, -39, 39, -24, -18, -54,
+	37, 10, -15, 52, -40, 20, 52, 5, 18, -2, -34, 13, 30, -27, -24, -31,
+	-10, -14, 58, -10, -13, -59, 9, 17, 16, 19, 2, 18, -50, 12, -39, -13,
+	32, 45, 11, 56, 45, 44, 39, -52, -44, -28, 5, 40, 1, -14, -70, 17,
+	15, 27, 40, -1, -16, 74, 40, 45, 17, 39, 10, -1, -19, -47, -17, -13,
+	8, 33, 36, 15, 56, 32, 40, -31, -40, -27, 6, -27, -57, 61, -47, 19,
+	-48, 34, -67, 40, 27, -33, 20, 75, 50, 55, 41, 38, 64, 1, -24, -46,
+	-43, -44, 14, 0, -16, -13, -18, -35, 16, -51, -36, 52, -4, 42, 18, -28,
+	24, -24, 26, -2, 0, 17, 67, 3, -34, 12, -14, -65, 35, -13, 13, 57,
+	-11, 2, -31, 78, 39, -3, -4, -66, -60, 48, -16, -22, -57, -25, 4, 60,
+	44, 50, 49, -11, 52, -8, 41, -84, 40, 23, 42, -83, 67, -61, -59, 34,
+	13, -22, -9, -6, 24, -21, 28, 37, -46, -32, -11, -16, -39, -57, 7, -58,
+	-17, 43, 71, 40, 10, -47, -14, 13, -38, -25, 70, 55, -14, 37, 67, 46,
+	54, 1, 21, 17, -94, 29, 16, -59, -3, -52, 17, 2, -64, 21, -22, -27,
+	-17, 6, -22, 48, -38, -7, -35, 19, -39, 41, 24, -26, 32, 52, -17, -22,
+	63, -25, 49, -9, 50, -54, -47, 48, -11, 4, -21, 63, -38, -66, 79, 95,
+	56, -56, -25, 57, 58, 25, -50, 5, -5, -7, -62, -11, -28, 16, -50, 0,
+	-40, 9, -39, -21, -55, -9, 33, 22, -23, -66, -10, -58, 26, 39, 52, 22,
+	-30, 57, -65, -41, -9, 71, 31, 54, -49, 20, 19, -38, -23, 9, 27, -5,
+	-14, 57, 52, 59, 25, -9, -20, 15, 68, -45, 30, -46, 69, -33, 33, 38,
+	9, 8, -63, 5, 48, -1, 37, 30, 14, 34, -5, 37, 55, 41, 32, 56,
+	-43, 4, -24, 47, -9, -24, 31, -7, -2, 10, 20, 68, -42, -25, -22, -66,
+	-4, 15, -35, -6, 63, 27, 7, -27, 32, -46, 33, 24, 24, -62, -54, 6,
+	9, -2, -43, 27, 8, -63, -53, -1, -59, 44, 67, -8, -10, 65, -6, 26,
+	-56, 35, -32, -12, 22, 17, -12, -10, -3, -6, 20, 46, 13, 83, 4, 24,
+	-32, 15, 38, -34, 24, 18, -25, -14, -56, -14, -28, -3, -23, 69, -16, 18,
+	26, 45, 35, -7, 8, -3, -33, -54, 42, -5, -64, 20, -2, -33, 32, -4,
+	-14, 38, -19, 53, -9, -4, -11, 3, 9, 21, -41, 72, 35, -52, -33, 7,
+	-31, -19, -47, 16, -38, 18, 44, -48, -10, -61, -31, -9, -43, 76, 41, 17,
+	13, 25, 20, 38, 23, -29, 30, -7, 53, -3, 26, -47, 39, 19, 5, 66,
+	-33, -52, 38, -39, -36, 3, -42, 44, -36, -13, -16, 60, -35, -67, -42, 11,
+	17, 25, 6, 20, 31, 64, 23, -46, 24, 8, 2, -29, 33, 13, 61, -4,
+	6, -19, -17, -16, -37, 18, -8, 17, 32, -47, -32, 44, 28, -45, 30, -7,
+	-63, 17, 56, 19, 38, -36, -21, -14, 21, 27, 58, -49, 25, -27, 29, 59,
+	15, -7, 3, 63, 60, -25, -27, -36, -35, 21, -24, -14, -17, 18, 46, -35,
+	30, -66, -16, 14, -34, 27, 43, -29, -37, -6, 11, 61, -43, 28, 4, -9,
+	5, 53, 54, -4, -41, 17, -6, 17, -59, 19, -26, -24, 23, -25, 13, -48,
+	-50, 25, 38, 0, -22, 60, -28, -25, -56, -2, 59, 40, -20, 16, -22, 13,
+	6, 14, 11, -74, 17, 47, -29, 44, 6, 32, 64, 38, 28, 57, 31, 16,
+	16, -39, 48, 27, 38, -52, -42, -34, -7, -41, -8, 50, 40, 23, 1, 11,
+	94, 65, 18, 64, -3, 25, 5, 10, 41, -13, 26, -30, -52, -47, -10, -49,
+	28, -10, 59, 22, -40, -37, -67, 60, -64, 35, -21, -53, 33, -7, -10, -52,
+	23, -63, -30, -54, 84, -69, -11, -48, -36, 13, 22, -51, 12, -35, -34, 54,
+	-49, -35, -58, 44, -19, -32, 52, -76, 34, 11, -42, 58, 101, -59, 14, -8,
+	18, -13, -59, 18, -5, 3, -31, -30, -15, 15, 67, 70, 77, 53, 48, 11,
+	84, 46, -22, -49, 49, 34, 20, -18, -7, -26, 82, -24, 48, -16, -6, -18,
+	42, 14, 74, -1, 0, 56, 9, -13, 55, 70, 39, -43, 57, -3, 20, -73,
+	-36, 13, -44, -58, 52, -9, 42, 34, 34, 12, 2, -32, -15, 32, -27, 34,
+	-73, 38, 5, -14, -9, 3, -46, -19, 40, -14, 92, -41, 5, -17, 22, 6,
+	10, -16, -3, -13, 18, -24, 38, 4, -47, -58, 76, 63, 65, 38, -55, -4,
+	61, 55, -5, 36, -14, -51, 44, -42, -24, -7, 12, 21, 13, 16, -53, 20,
+	-1, -24, 11, 62, 45, 35, -1, 3, -16, -35, -35, 0, 59, 2, -28, 53,
+	34, -25, -71, -54, -21, 28, 62, -47, -47, 39, -46, 8, -1, -10, -20, -50,
+	27, 48, -5, 48, 30, 2, 41, 39, -71, 11, 14, 14, -3, 4, 11, 76,
+	-59, -33, 6, -56, -34, -30, -26, -39, -69, -30, -54, 5, -26, 24, 28, -4,
+	-30, -19, -43, 26, 47, 5, -36, -37, -26, -25, 47, 47, 27, -58, 74, -3,
+	-32, -18, 31, 8, -7, -2, -67, 59, -5, -20, -24, -1, -17, 26, -43, 20,
+	-38, 61, -56, -39, -32, -35, -15, 11, 23, -23, -18, -13, 4, -33, -32, 3,
+	36, 11, -77, 36, 20, -25, -27, -4, -2, 5, -25, 59, 23, 21, 31, -61,
+	-40, -3, -34, -33, -29, -22, 22, -56, -33, 33, -11, -57, -62, 46, 14, -12,
+	-54, -63, -31, 32, 9, -25, -25, -9, -15, 12, 4, -20, -1, -45, 13, -28,
+	17, 31, -35, 47, -23, -27, 35, 15, 57, -26, -48, -55, -15, -49, -21, 13,
+	25, -7, 35, 55, -3, 12, 55, 53, 4, -5, 20, -29, -13, 48, -25, -8,
+	-22, 39, -14, -55, 1, 25, 38, -28, -25, -12, 14, 47, -16, 52, 18, 17,
+	40, -22, -46, 10, 32, -22, 31, -20, 27, 45, -72, 1, -61, -2, -61, 61,
+	-12, 45, -45, 24, -4, -37, -41, 24, -37, 46, -19, 16, 15, 10, 9, 23,
+	-3, -13, -15, -20, 68, 37, -54, 49, -64, 36, -9, -23, 3, -15, 49, -17,
+	82, -4, -53, 39, 25, -52, -39, 32, 32, -43, -41, -11, -30, 48, 38, 45,
+	44, 50, -23, -85, 23, -23, 30, 52, -1, 14, -19, 19, 38, 10, -67, 7,
+	12, 1, 47, -23, 63, -22, 64, 37, -14, -16, 22, 35, 11, -43, -21, 41,
+	-22, 34, 57, 29, -26, 14, -40, -30, 9, -17, -39, -24, 69, 38, 52, 16,
+	24, -24, -16, -14, 31, -14, -48, 42, 51, 47, 14, -24, 43, -39, 27, -3,
+	-6, 28, 0, 13, -12, 63, 40, 18, -37, -44, -44, -12, -1, -13, 27, -9,
+	-53, 3, 59, 10, -8, 49, -26, 17, -25, 11, -38, 7, 56, -40, 28, 1,
+	29, -35, 16, -5, -64, 24, 19, 78, 21, 70, 61, 20, -40, 24, -57, 33,
+	-48, 26, -60, -44, 7, -19, 45, 14, 51, -33, 40, 29, 38, -44, 10, 30,
+	32, -27, -27, -40, 2, -7, 63, -25, 5, -63, 38, 5, 1, -83, 33, 40,
+	-60, 22, 47, -11, 61, -20, -78, -37, 12, 9, 14, -15, -40, -45, 5, 4,
+	-55, -31, -41, -37, 47, 10, 13, -26, -8, -20, -21, -16, -64, 35, -5, 67,
+	-26, 11, -41, 25, 33, 5, -27, -55, 18, 39, 33, 20, -36, 51, 70, -63,
+	16, -36, -19, -49, 72, -8, -8, 28, 38, 50, 45, -16, -46, -26, 31, -27,
+	48, 53, 43, 39, 50, -3, -30, 48, -15, -11, 23, 21, 27, 51, -27, 58,
+	-28, -20, 21, -33, 51, -29, 8, 53, 17, 37, 30, -49, -57, -9, 2, 52,
+	-30, -39, 2, -19, 49, 23, 56, -35, 13, -61, -25, -6, -19, 27, -22, -37,
+	-25, 51, -11, -49, 3, 18, -11, -4, -14, 38, -21, 48, 24, 9, -2, 48,
+	-7, -2, 6, 16, -21, 21, -8, 35, 22, -32, -10, 18, 34, 13, -6, 6,
+	-39, -43, -10, -9, 40, -52, -19, -56, 53, -21, -30, 46, 42, 24, 37, -36,
+	20, 38, -40, -8, 2, -21, 2, -40, -36, -2, -63, 2, 50, -36, 10, 23,
+	11, 14, 6, -53, -7, -44, -27, 25, 26, 9, 2, -10, 31, 33, 59, -60,
+	-9, 32, 44, -3, -6, 27, 61, -1, 44, 51, -2, -5, 7, 4, 28, 13,
+	47, -53, 20, 26, 16, -22, -22, 3, 27, -5, -25, 0, 4, -50, 26, 85,
+	0, 6, 28, 10, 44, 30, 5, 43, -47, 20, -14, 67, -7, -31, 24, 3,
+	-2, 49, 45, -20, 25, -32, 56, -30, 27, 0, 3, 32, -15, -15, -7, -37,
+	26, -54, 34, -20, -1, -8, -44, -10, 37, -69, -16, -14, -35, 65, -8, -18,
+	-15, -44, -7, 9, -8, 21, -3, 45, 16, -41, 3, -40, 65, 43, -47, 21,
+	6, -23, 35, -20, -31, 37, 41, -33, 16, -26, 8, 1, 8, 34, 48, 43,
+	37, -25, -26, 17, -8, -14, -25, 60, -30, -37, 19, -50, 46, 24, -28, -7,
+	-15, -28, -58, -9, 52, 36, -31, 39, -1, 78, 74, -9, -9, 9, 30, -16,
+	50, -20, -8, -1, 44, -8, 51, 42, 34, -73, -30, 36, -47, 22, -22, 29,
+	-65, 2, 26, 64, -8, 45, -9, -42, -62, -63, 15, 34, 15, 32, 51, -11,
+	41, -15, -27, -3, 33, 27, -27, 32, -37, -71, 12, 15, -8, -21, -25, -18,
+	4, -43, 11, -20, 21, 27, -54, 62, 19, -39, 2, 73, 14, -24, 34, -22,
+	-45, 15, -19, 0, 46, 9, 34, 22, 77, 53, -1, -48, 66, -26, -59, -19,
+	12, -64, -1, -11, -24, -33, -45, 67, 68, 16, 51, 37, 0, -10, 37, 49,
+	20, -57, -24, 22, 14, 46, -28, -44, 33, 19, -19, 34, -2, -34, -8, 14,
+	37, 51, -35, 28, 47, 37, 21, 7, -19, 44, 1, 46, 49, 23, -59, 38,
+	28, 58, 90, -23, -45, -40, -14, 18, 23, -16, -7, -18, 41, 53, 38, -56,
+	-68, 13, 4, 13, -38, 9, -62, 18, 25, -29, -17, 11, -24, 0, 81, -45,
+	-73, 39, 25, -27, -45, 23, -48, -7, 86, 51, -44, 22, -25, -25, 50, 72,
+	-69, -46, 26, -6, 32, -2, -38, 33, 71, -16, -46, 14, 17, 8, -35, -36,
+	-34, 12, -67, -56, 29, 21, 14, -52, 46, -50, 15, 28, -54, -54, -24, 3,
+	-46, 40, -15, 39, -13, 34, -31, 49, 52, -74, 27, 25, 29, -34, -6, -3,
+	-5, 12, -5, 83, -46, 33, 37, 10, -49, 13, -41, 55, -48, 8, 4, 4,
+	-40, -8, -14, -6, 37, -29, 59, -23, 45, 18, -2, 60, -25, 9, -23, 3,
+	-39, 6, 2, 11, -35, 44, -2, 21, -5, 24, -51, 36, 62, 44, -50, 28,
+	-2, -34, 22, -23, 17, -13, -39, 25, 15, 28, -40, 28, -39, 44, 58, -55,
+	22, 13, -13, 28, 4, 49, -44, -19, -27, -56, -9, -41, 43, 8, -18, -44,
+	19, -9, 37, -23, 55, -28, -54, 31, -16, 50, -51, -41, -19, -28, 13, 16,
+	8, 16, -33, 15, -4, 16, 34, -42, 62, -9, 48, -2, 7, -19, -8, -37,
+	48, 22, -10, 51, -51, 26, 35, -63, 21, -8, 27, -31, -17, 45, 20, -4,
+	16, 8, -11, 35, -5, 48, 2, 17, -17, 71, -17, -64, 48, 18, 29, -23,
+	50, 54, -25, 40, 60, -30, 13, -20, -21, -29, -5, -40, 22, 79, 42, -65,
+	44, 5, -57, -16, 15, 62, 17, 4, 70, 12, 23, -34, 35, -48, 11, 54,
+	8, -52, -24, 32, 44, -37, -7, 5, -32, 0, 9, 59, 55, 19, -10, -17,
+	-11, 57, 21, 10, -52, 39, -14, 29, 54, -4, -35, -5, 39, -4, -44, 12,
+	72, 19, -51, 41, -12, -40, -27, -85, 64, -4, -10, -48, 58, 49, -47, 11,
+	14, 45, -32, 28, 39, 27, -18, 15, -41, -45, 38, -80, -50, 7, 26, -17,
+	-19, -4, -5, -59, -48, -17, -84, 0, 46, -37, -70, 49, -50, 8, 43, 46,
+	48, 26, 65, -18, -39, -29, 9, -52, 44, -53, -54, 4, 48, 10, -38, 24,
+	40, 35, 37, -55, -51, -3, -18, -50, -12, 56, 1, 21, 54, -2, -80, -27,
+	0, -6, 46, 31, -21, -68, -10, 16, 25, -44, 29, 20, -71, -26, -9, 15,
+	16, -64, -32, -55, 66, 2, 21, -35, 42, 27, 20, 19, 34, -34, -76, -1,
+	-21, -39, 26, 8, 27, 12, 32, -32, -29, 14, 51, 31, 24, 33, -25, -17,
+	33, -45, 68, 71, -50, -2, 11, 29, 55, -55, 77, 22, -17, -46, -33, -11,
+	27, 29, 3, -23, 11, -37, 15, -8, -77, 28, -41, -4, 58, -35, 11, -18,
+	-30, -31, -9, 33, -6, -1, -24, 33, 46, 30, -53, 29, 44, 36, 43, 3,
+	57, -16, -42, -13, 32, -36, 9, 32, -31, -24, 2, 27, -30, 2, 27, -42,
+	-53, -8, 34, 32, 32, -24, -46, -13, 11, 27, -60, -10, 53, -28, -53, -14,
+	10, -30, -19, 37, -9, -45, 25, 39, 2, 2, 34, 5, 50, 87, -45, 67,
+	32, -45, 4, 45, -40, -5, 63, -32, 98, 38, 15, 45, -9, -22, 0, -13,
+	-57, -27, 11, -24, 42, -40, 11, -7, -21, -24, 12, -20, -26, 5, 59, -18,
+	-27, -7, -1, 56, -36, -8, -17, -18, -38, 22, 10, 22, 36, 53, 34, 59,
+	52, 40, 29, 5, -28, 18, -35, 23, 22, -43, -2, -16, -58, 31, -72, 43,
+	62, 31, 11, -14, 30, -46, 2, -15, 12, 47, -5, -50, -27, -17, -1, -5,
+	26, -31, -10, 13, 26, -34, -33, 26, 16, -47, -53, 48, -13, 31, -53, -3,
+	38, 0, 35, -23, -40, 22, -29, 43, -19, 13, 18, -39, 20, 55, 86, 21,
+	18, -57, 32, -8, 16, 16, 21, 20, -50, 44, -42, -19, 61, -6, -23, -1,
+	-24, 57, -39, 15, 24, 15, 3, -24, 12, 13, -54, 0, 10, -8, 51, 58,
+	15, -19, 2, 18, 28, 34, 4, 57, 24, -48, -29, 31, 27, -32, 12, 34,
+	18, -6, 39, -39, -46, 26, -10, 9, 39, 35, 24, -8, -18, 28, 37, 36,
+	-41, -52, -6, 74, 1, 58, -5, -28, -8, -40, -20, -35, 28, -19, 61, -41,
+	79, -68, 44, 38, 23, -11, 38, -22, -53, -13, 35, 11, 43, -45, 24, 32,
+	-39, 5, -24, 4, -13, 26, -24, -41, -21, -16, -24, 53, -23, -33, 49, -44,
+	53, 15, 5, 29, -46, -28, 60, 5, -30, 20, 20, -46, -53, -35, 7, 24,
+	-49, -51, 19, 23, -32, -20, 29, -22, 6, -29, -8, 26, 7, -2, 5, 52,
+	-43, 37, 30, -68, -46, -8, 12, 5, -52, -35, -39, 22, -45, -33, -51, 10,
+	-36, 13, -105, -21, 81, -16, -22, 24, -43, 3, 35, 22, -34, -24, -12, -15,
+	-17, 36, -79, -61, -26, 6, 81, 6, -25, 30, 53, 56, 15, -7, 81, 32,
+	-77, 52, -26, -7, 3, 5, 33, -32, 64, -50, 36, -72, 8, -48, -45, -34,
+	-31, 39, -50, 23, -44, 34, 4, -48, -23, 51, -30, -80, -34, -33, -24, 52,
+	-43, 81, 70, -46, 26, -15, -27, -31, -1, -33, 23, -6, 1, -11, 31, 20,
+	-1, -33, -17, 3, 8, 8, 45, 39, -10, -26, -13, -44, -7, -37, -27, -10,
+	-49, -15, -27, -18, -6, -41, 74, 47, 18, 5, 71, 40, -39, -21, 66, -1,
+	34, -61, -24, -10, 42, 23, 40, -21, -96, 47, 14, 56, 50, -1, -12, 27,
+	-30, -18, -12, -41, -58, 28, -81, -62, 44, 67, 53, 16, -27, 0, 25, -10,
+	-44, 20, 23, -41, 28, 11, 84, -43, 50, 38, -68, -36, 11, -13, -51, -4,
+	79, 10, 60, 8, -38, -37, 70, 25, 39, -24, 42, -66, -44, -10, 9, 29,
+	18, 5, 24, 0, -40, -19, 60, -8, 5, -53, -93, -46, 46, 26, 23, 60,
+	55, 13, -8, 44, 7, -16, -21, -1, 73, 16, -54, 49, 6, 21, 34, -22,
+	-49, -40, -25, -43, 27, 59, 23, -45, 16, 43, 57, 34, 29, 27, -4, 39,
+	41, -4, -42, 20, 10, 18, -34, 22, -27, -2, 2, 47, 32, -19, 11, 10,
+	-22, -32, -24, -19, 0, -11, -14, -43, 21, 28, 0, -49, 15, 23, -9, -54,
+	-25, -10, -4, -56, -15, 6, -50, -48, 60, -22, -7, 35, -19, -73, -22, 2,
+	-11, 74, 59, 64, 25, -24, 14, -33, 67, 26, -34, 12, -32, 1, -9, -59,
+	-21, 1, -23, -23, -3, 25, 89, -32, -59, -1, 68, -28, -23, 24, -24, 46,
+	-29, 13, -11, -51, -18, -1, 54, -48, -24, 30, 41, 47, 19, 42, 66, 31,
+	-11, -13, -36, 21, -13, -52, -16, 46, -48, 23, -42, -6, -10, -27, 39, -35,
+	-13, 47, 22, 65, -13, 54, 5, 22, -48, -48, 24, 16, -14, -49, -3, 40,
+	49, 32, -32, 28, -39, -22, 39, 6, 6, 1, -47, -35, -35, -18, -36, 77,
+	-9, 68, 10, 8, 22, 67, -22, 55, 23, 45, 46, -41, -14, -30, -38, 14,
+	-17, -50, 29, 19, -37, 18, -35, 4, -62, -12, 12, 41, 40, -33, -19, 56,
+	-34, 35, 7, -49, -3, -6, 44, 39, -87, 41, -29, -24, 0, 47, -49, 64,
+	19, 28, -11, 13, 17, 44, 12, -37, 38, 17, 36, 77, 25, 8, 15, 6,
+	40, -15, 62, 46, -16, -41, 80, -14, 4, 6, 56, 18, 81, 22, -13, 32,
+	46, 24, 4, -7, 71, -26, 28, 8, 23, -11, -9, -70, 35, -43, -1, 53,
+	-49, -23, -21, 50, -29, -20, -17, -14, 40, 15, 49, -41, 2, -44, 14, 9,
+	48, 25, 32, 14, -54, -81, 4, -18, -30, -12, -23, 9, 47, -56, 29, -21,
+	-69, 26, -15, -66, -61, 67, 5, 30, -22, 43, -19, -12, 18, -60, -16, 45,
+	9, -50, 43, -14, 44, 47, -17, -5, 8, 45, -51, -36, -10, -53, 34, -46,
+	-16, -42, -39, 29, 64, -38, 58, -59, 77, -29, 11, -14, 61, -42, 6, 2,
+	-62, -24, -15, -24, -34, 7, 78, -12, 6, -16, 68, 17, 58, -41, -45, -37,
+	16, 8, 35, -17, 9, 63, -74, -42, 63, -30, -8, 26, 23, -36, 72, 25,
+	-49, 25, -3, -41, 70, 9, 64, -11, -74, -21, 53, 17, -3, 10, 44, 43,
+	36, -12, -26, -34, 3, -30, 44, 12, 25, 20, 8, 32, -35, -49, 36, 54,
+	-2, -51, -20, -51, -65, -56, 6, 12, 51, -18, -8, -8, 61, 27, -25, 22,
+	-19, -8, 52, 19, -54, -17, -3, 55, 71, -1, 9, 46, -2, 31, -46, -67,
+	-3, 67, -34, 31, 33, -68, -21, -22, 60, 2, 71, 3, -43, -34, -41, -63,
+	-36, 40, -42, 2, -31, 11, 75, -11, 52, 21, -57, -37, 37, 29, 55, 3,
+	-30, -43, 17, -30, -38, -27, -40, -15, 69, 5, -51, 2, -19, 20, 32, -9,
+	15, -47, 95, -11, -4, 8, -53, -37, -30, 56, -58, 45, -67, 30, -44, -47,
+	86, 73, -62, 17, -25, -28, 32, 26, 22, 16, 11, 30, 47, -66, 26, -41,
+	-41, -43, 26, -42, 52, -72, -29, 55, -52, -25, 13, -35, 43, -45, 43, 26,
+	-41, 46, 2, -29, -6, -10, 55, -62, -14, -19, -36, -23, -19, 42, -26, 6,
+	-11, -12, -46, -24, -65, -32, 30, -16, -47, -50, 31, -9, -85, 33, -9, 74,
+	70, 49, -14, 50, 67, 34, -40, 34, -20, -42, 6, -55, -64, -31, 21, -32,
+	21, -23, 20, 2, 37, -2, -8, -22, -80, -26, 17, -61, -25, -20, -1, -63,
+	30, -15, -54, -13, 45, -29, -19, -30, 26, 48, -25, 14, 16, 45, -21, -7,
+	2, -22, 27, 33, -26, -25, 54, 22, -12, 35, 36, -21, -17, -40, 27, 28,
+	37, -51, -37, -53, -52, -28, -44, -32, -42, 90, 31, 5, 60, 60, 9, -33,
+	43, 28, -37, -56, -42, 50, -8, 36, 22, -6, 51, -16, -41, -39, -77, -52,
+	4, -8, -18, -7, 5, 1, 64, 22, -37, -21, -17, 57, -16, 22, -45, 50,
+	18, 0, -25, 55, 44, -14, -8, 40, 43, 14, 20, -6, -12, -33, 54, 42,
+	43, -37, -41, -28, -20, 25, -49, 15, 6, -11, 6, -10, 18, -7, -12, -61,
+	-25, -55, 7, -26, -6, 21, 64, -61, 2, -18, -19, 0, -15, 38, -43, -15,
+	-35, -11, 13, -14, 17, -8, -5, 17, 0, -35, 22, -10, -25, 16, -55, -50,
+	-53, 44, 21, 1, 49, -30, -21, 32, -58, 24, -30, 28, 65, -1, 4, -9,
+	51, 11, -35, 28, -36, 16, -2, 29, 23, 46, -62, -13, -57, 10, 3, 70,
+	-22, -7, -16, -13, 21, -20, 39, -25, 67, 52, 12, 4, 46, -13, -35, -56,
+	-23, 30, 74, 27, -36, 31, 40, -17, -1, 9, -18, -4, 56, 34, 49, -14,
+	34, 45, -49, 27, -46, 19, 45, 46, -18, 1, -20, 54, 16, 39, -9, 58,
+	-57, 13, 13, -39, -43, -41, -46, -16, -60, 33, -67, 6, -75, 61, 11, 18,
+	13, -25, 37, 1, 36, -32, 19, -7, 41, 25, 19, 61, 32, -16, 20, 39,
+	40, -9, 33, 15, 71, 36, -37, -14, -61, 33, -14, 30, 54, 37, 71, -26,
+	-41, 4, 19, -58, 47, -45, 54, 29, 40, -31, -33, 51, 19, 36, -15, 57,
+	-33, 29, -5, -13, 59, -33, 25, 9, -39, -69, 64, 50, -32, 32, -15, -37,
+	29, 43, -47, 55, 60, -1, 20, 31, 10, -1, 5, -19, -26, 31, 30, 64,
+	-49, 11, 26, 22
+};
+constexpr int32_t bias_1[230] = {
+	27, 40, 109, 117, -102, 327, -139, 157, 195, 161, 238, 280, -390, 55, -135, 86,
+	-102, 288, -16, -117, -7, 184, 79, -1, 113, 133, -148, -54, 251, -25, -53, -166,
+	-7, -149, 15, 36, 372, 100, -14, 28, -23, 21, 414, -144, 43, 7, 203, 71,
+	-26, 360, 72, 2, -54, 215, 39, 107, 2, 47, 82, 245, 17, -89, -108, 31,
+	22, 143, -75, 236, 148, -158, -57, -68, 580, 96, -10, -16, 120, 7, -192, 5,
+	106, 68, 524, 2, 129, -3, -122, 267, 143, 370, 42, 74, -56, 51, 78, -120,
+	313, -242, 109, 145, 52, 20, -139, 148, 0, 297, 180, 10, 225, -48, 184, -68,
+	65, 46, 11, -160, -122, 18, -161, 131, 312, 449, 53, -44, 290, 197, 185, 279,
+	-103, 106, 139, 21, -221, -230, -47, -187, 35, -125, 30, -30, 152, -20, -24, 122,
+	473, 77, 420, 318, 11, -58, 309, 194, 181, 47, 101, 204, -62, -87, -98, 7,
+	82, -2, -97, 30, -38, 203, 190, -108, -12, -142, 9, 206, 82, 77, 33, -8,
+	35, -240, 357, 21, -208, 19, 116, -119, 202, -13, 68, 4, 137, -15, -143, 12,
+	54, -32, 238, -127, 103, 242, 172, 260, 523, 27, -6, 511, -47, 82, -8, -126,
+	94, 200, 86, -13, 75, 599, -260, 23, -25, 145, 203, -14, -60, 204, 99, 101,
+	-45, -54, -59, 130, 49, -12
+};
+constexpr struct aot_fully_connected_params params_1 = { 128, -128, 1499079801, -9, -128, 127 };
+
+//sequential_153/dense_230/MatMul
+constexpr int8_t weights_2[3680] = {
+	12, 1, -66, 31, 79, -5, -17, -22, 53, 95, 40, 97, 30, 22, 55, 83,
+	49, -24, 27, -28, -26, -22, 23, -18, 12, 3, -29, 34, -2, 30, 12, 26,
+	-41, -15, -3, -40, -34, -40, 45, 1, -30, -5, -89, -35, -37, -6, 5, -28,
+	-19, 2, -35, 66, 39, -64, 17, -36, 8, 32, -5, 60, 2, -28, 17, -23,
+	22, 3, 28, -24, -41, -9, 69, -8, 67, -24, 7, 60, -14, -25, 35, -27,
+	4, -1, -80, 17, -36, -11, 12, 76, -66, 1, 14, -1, -36, 37, -33, 20,
+	-37, 56, 11, 44, 12, -24, 78, 7, -13, -60, -6, -29, -36, 32, -23, 12,
+	-33, 25, 58, 46, 72, -66, 38, -28, -34, -18, 87, -82, -60, 2, -11, 7,
+	-5, 14, 28, 40, 100, -48, 38, 66, 27, 19, 7, -7, -36, 17, 30, -13,
+	-51, 40, -4, -25, -27, -10, 14, -36, -38, -44, -52, -41, -12, -23, 67, -24,
+	-38, 20, 14, -24, 10, -17, -9, -18, -28, 62, -21, -3, -41, -36, -29, 13,
+	-37, 48, 27, -9, 28, -56, -55, 53, 0, 2, 92, 21, 19, 72, -16, -16,
+	-53, 21, 28, 3, -32, 37, -18, -41, -34, -3, 15, -88, 5, 0, -34, 42,
+	-52, -26, -26, 34, -22, -76, 15, 93, 55, 97, -50, -37, 24, 38, -56, 75,
+	-44, -21, 18, 9, -67, 72, -7, -23, -8, 4, 57, 26, -29, -49, 6, 67,
+	21, 7, 93, -9, 57, -64, -35, -51, -48, 35, 19, 22, -47, -18, -38, 51,
+	1, -68, 58, -12, -9, 60, 43, 51, 9, 8, 35, -12, 67, 38, -20, -5,
+	-64, 62, -46, -15, 4, -9, -15, -5, -42, -34, 54, 13, 76, -28, 24, 24,
+	48, -88, 39, -19, 87, 11, 12, 6, -24, -17, -21, -71, 10, -22, 0, -35,
+	6, 40, 29, 16, 35, 40, 101, -22, -21, -6, -36, 2, 17, -13, -22, -37,
+	-1, -33, -41, -7, 38, 78, -36, 0, -31, 29, 10, 29, 38, -23, 17, 38,
+	-88, 29, -49, -1, 57, -17, -59, -17, -38, 5, -7, -26, 2, -37, 19, -42,
+	-5, 25, -50, 30, -65, -7, -18, 2, -79, 65, 8, 38, 3, 71, -20, 31,
+	-23, 27, 28, 33, 4, -34, -73, 21, -21, -43, -20, -46, -60, 13, 23, -31,
+	1, 17, 60, 56, 0, 6, -30, -14, 87, -62, -2, -73, 24, 23, 10, 26,
+	23, 17, 35, 8, 31, -32, 21, 63, -5, 27, 64, 10, 27, 61, -62, -1,
+	38, -15, -63, 7, 55, 15, -30, 43, -50, 72, -28, -7, -4, 21, -54, -5,
+	80, -36, -7, -18, -5, 47, -18, -47, -14, 84, 18, 13, 57, -60, -10, -74,
+	-57, 36, 37, -9, 16, -40, 35, 95, -49, 32, -47, -49, 4, 41, -28, -21,
+	-12, 14, 23, 59, -38, -47, 29, 25, -41, -11, -32, -30, 78, -15, 30, -23,
+	10, 127, -25, -9, 13, -55, 0, 5, -17, 30, -48, -31, -5, 21, -25, 10,
+	-29, 21, -19, 36, -30, -1, -18, -56, -20, 21, -45, 22, 27, -36, 27, 11,
+	-28, 44, -46, 52, -16, 81, -17, -12, 19, 14, -22, 16, 20, -58, 23, -37,
+	25, 64, -14, 9, 15, -66, -18, -66, 2, -61, 54, -38, -39, -34, 12, 15,
+	16, 3, -4, -24, -50, -61, -6, -28, 18, -23, -13, 29, -35, -45, 56, -71,
+	-5, 14, 49, -57, -29, -13, -5, -2, 69, 66, -4, 0, -21, -42, -13, -43,
+	0, -20, -36, -18, 37, -76, 83, 45, 19, -16, 45, -18, -7, 13, -41, -45,
+	-18, 38, 15, -65, 30, 39, 18, -14, 4, -31, -49, -55, -35, -53, -19, -43,
+	11, 31, -50, 75, -3, 25, -23, -17, -26, 9, 42, 12, 33, 14, 37, 5,
+	3, -11, -9, -43, 7, 30, 26, -34, 59, -28, -53, 12, 13, -34, -38, 14,
+	27, 36, 15, -47, 29, 47, -30, -20, -3, 57, 7, -15, -32, 13, -46, -16,
+	24, -48, -12, -36, -1, -14, 19, -46, 63, 9, 5, 80, 44, 8, -22, -24,
+	47, -31, 56, -38, 45, -4, 55, 12, -14, -29, 22, -5, 6, -3, 78, -34,
+	26, 15, -11, 25, -7, 61, -54, 64, 25, -1, 69, -59, 19, 63, -35, 6,
+	56, -46, -12, 45, 29, 27, -39, 10, 90, 23, 1, -22, -18, -28, -3, -4,
+	-37, -32, -20, 19, 49, 95, -71, 48, 49, -7, 12, 17, 76, -57, 26, -2,
+	-100, 0, -57, -38, -38, -37, 77, -6, -6, -37, -9, 20, -67, -57, -40, -27,
+	-56, -11, -23, -49, -46, 17, 25, -56, -64, 21, 5, 48, -49, 22, -96, 37,
+	70, -50, 37, -14, -35, 3, -17, -88, 23, -91, 54, 67, 64, -23, 30, 77,
+	64, -76, 13, -39, 56, 67, 53, -44, 115, 44, -43, -10, 33, -25, -24, -42,
+	-31, 45, 88, 25, -3, 58, -47, -9, -32, 20, -35, -6, -40, -63, 57, 32,
+	13, -70, -8, 22, -70, -17, -7, 82, -49, -25, 40, -26, -8, -31, -91, -9,
+	-23, -43, 2, 74, 84, 88, -30, -25, 87, 35, -50, 36, 14, 9, -27, -30,
+	-60, 19, -10, -54, 55, 20, 42, 11, 3, 72, 11, -58, 5, -7, 55, -41,
+	34, 10, -34, 91, 18, -41, -76, 26, -30, -48, -68, 64, 33, 0, -44, -72,
+	-26, 27, 21, 13, 51, -44, 22, -19, 26, 30, -22, -1, 11, -15, -21, -13,
+	8, 3, -30, -4, -11, 97, 112, 68, 26, 44, -2, -33, 44, 27, -13, 39,
+	-60, -33, 46, 41, -53, -89, -42, -31, -3, -21, 42, -5, -83, -17, 33, 24,
+	73, 3, -19, 64, -31, 34, -40, 15, -42, -45, -10, -15, 36, 52, 38, -3,
+	-40, 1, 85, 61, -81, -28, 15, 35, -26, -49, -27, 21, 71, 42, -3, -25,
+	-21, -16, 40, 74, 27, 14, -16, -20, 51, 74, -72, -43, 15, -43, 45, -1,
+	21, -108, 0, 31, 45, -19, 81, -19, -4, 37, 2, 58, 46, -23, -66, 23,
+	67, -5, 9, 21, 92, 36, 4, 50, -27, -38, 34, -15, -17, 59, 10, 56,
+	53, 31, 50, -7, 37, 68, 39, -11, 37, -31, -61, 48, -47, 42, -75, -18,
+	40, -41, 28, -31, 5, -10, -7, -80, -51, -9, 82, 45, -6, 37, -1, -47,
+	116, 14, -20, -5, -58, -81, 56, -112, -9, -38, 96, 34, -55, -94, 5, -25,
+	-26, -10, 1, 9, 58, 42, -45, 93, 8, 62, -76, 99, 108, -4, 38, 33,
+	90, 19, -25, -10, 40, 20, 8, -27, -34, 37, -9, 27, 39, 18, -16, -27,
+	-45, -44, -19, -64, 13, -44, -105, 22, 38, -84, 42, -33, -36, -65, 23, -11,
+	113, -48, 76, 14, -15, 47, 17, 34, -55, -76, -74, 13, -22, -78, -55, -36,
+	-74, 32, -66, -7, -73, -42, 37, 9, -52, -8, -45, -76, -33, -3, -13, 49,
+	23, 13, 34, -40, -21, 27, 55, 73, -26, -86, 9, -21, 64, 12, 26, -53,
+	-13, 14, 54, 23, 15, 8, 2, 33, -34, -8, -88, -23, 39, 16, -29, -15,
+	-41, -14, 11, -28, -37, 23, 41, 30, 17, 19, 44, -23, 64, 27, -27, -30,
+	-2, 13, -17, -30, 36, 5, -12, 17, 36, -22, -18, -4, 39, -9, -7, 66,
+	-25, 55, 18, 43, -18, 8, -38, 45, 11, 41, -4, -20, -18, 55, 14, -30,
+	85, -5, -48, -12, -3, -14, 58, -48, 17, -10, -31, -6, -51, 8, -36, -21,
+	49, 18, -1, 2, -5, 7, -6, 51, -50, 1, 24, -57, 2, -66, 42, -32,
+	24, -18, -54, 53, -52, 21, 27, 20, 6, -13, 41, 17, 41, -43, 8, 14,
+	-42, -43, -19, -27, -9, 53, -41, 39, 45, 33, 48, 40, 9, 115, 13, 37,
+	46, 33, -42, 2, -6, -51, -2, -37, 3, 70, -52, -42, -21, -37, 59, -61,
+	21, -50, -43, -24, -23, -17, -39, 30, 6, 55, -5, 25, 2, 1, 19, -39,
+	-57, 2, -58, 30, 53, -36, 45, 3, -2, 54, -47, 5, -23, -38, -33, -51,
+	61, 23, -42, 50, 14, -5, 46, 13, -24, -17, 25, -14, -29, -25, -17, 49,
+	1, -11, -32, 50, 45, -9, 55, 15, 29, 77, -24, 59, -38, -32, 34, 38,
+	-11, 41, -30, 92, -16, -23, 7, -33, -6, -48, -41, -40, -12, 28, -10, -1,
+	-39, -34, 68, -21, -24, 57, 32, -86, 27, 77, -45, 67, -40, 32, 81, 17,
+	-35, 45, -45, 76, -29, 64, -13, -15, -31, -55, -63, -39, 67, -46, -58, -15,
+	17, 14, -22, -45, 51, 30, -38, -64, 40, -37, -77, 10, 30, -28, -4, 31,
+	-53, -28, 3, 25, 32, -52, 42, 8, -28, 34, 25, 28, 16, -38, 46, 35,
+	-19, -24, -36, -11, -9, 55, -67, 91, 11, 2, 29, -19, 64, 20, -20, -2,
+	14, -92, -44, -32, -70, 30, 110, -5, 23, -19, -11, 53, -62, 48, -45, 13,
+	-37, -28, 5, 40, -14, -19, -27, -81, 26, -17, -22, -20, 1, 25, 25, 17,
+	17, -22, 49, 50, 2, 17, -54, 0, -14, 84, -32, -28, -6, 80, 48, -27,
+	17, 10, -37, 9, 10, -8, 25, -11, -14, -70, 3, -7, 18, 21, 5, -61,
+	34, -4, 29, -11, 37, -77, 45, 57, 14, -49, 51, -38, -8, 9, 10, -36,
+	-39, -83, -49, 11, 27, -42, -61, 13, -79, -29, -3, 68, -4, 22, -14, 20,
+	28, 37, 50, -16, -3, 5, 48, -1, 60, -20, 89, -29, -64, -48, 42, 39,
+	71, -18, -10, 24, 29, 45, 0, 0, 27, 65, 23, 22, 78, 25, -33, 8,
+	58, -21, -18, -31, 36, 19, 31, -33, -6, 21, -12, 16, -49, 98, -25, -6,
+	22, 106, -19, -47, 29, 39, 47, 93, 6, -4, -25, -14, -22, 1, -52, -21,
+	-26, 0, 49, -46, 11, -49, 18, -7, 6, 16, -16, 21, 15, 15, 25, 19,
+	-11, 14, 15, -9, 8, 38, -23, -3, -8, -9, -4, -2, 34, 23, -2, 6,
+	-31, 25, 7, -13, 78, 2, 40, 24, 8, -18, -2, -2, 16, -17, 57, 12,
+	-9, -16, 18, 7, -7, -3, -28, 33, 11, -2, 9, -8, 48, 1, 3, 45,
+	35, 6, -69, -29, 20, 22, -12, 5, 3, -30, -50, -23, -18, 9, -22, 22,
+	-27, -40, 56, 16, -33, -10, -26, -5, 37, 45, 22, -29, 8, -24, -30, -14,
+	-3, 0, 8, -47, 0, 21, -38, 38, -42, 9, 9, 23, -1, -6, -9, 11,
+	29, -38, -1, -41, -2, -43, -29, -11, 63, 81, 23, -2, -7, 20, -14, -11,
+	-8, 51, -35, -21, -19, 32, 33, 9, -31, 31, 25, -16, -37, 50, 42, -28,
+	-29, -17, -6, -26, 7, 38, -2, -16, 29, 20, -26, -31, 3, 13, -46, -28,
+	-2, 6, 26, 10, -2, 12, 33, 21, -34, 6, 27, 12, -28, -8, 24, -16,
+	32, -21, 1, 54, -36, 1, -38, -23, -31, 29, -40, -11, -3, -29, -13, 22,
+	-8, -36, 5, -11, 14, -10, -39, -31, 24, -34, -20, -39, 36, -4, 14, -43,
+	13, -21, 11, 32, -5, 61, -32, -63, 8, -27, -2, 23, -15, 47, -13, -41,
+	27, -32, -14, -16, 66, -3, 10, -29, -53, 64, 34, 25, -2, -21, 11, -45,
+	-3, 24, 35, -23, 10, 8, -27, 13, 20, 76, 20, -46, 49, 8, 29, -5,
+	15, -49, 1, -36, 73, 1, -1, 26, -2, 20, 24, -14, 14, 23, 66, -25,
+	-36, 79, -23, 7, -37, 13, -46, 28, 34, -6, -25, -17, -51, 9, 8, -31,
+	28, -10, -31, -49, 16, -36, -13, -40, 37, 38, 17, -17, 51, 42, -60, 29,
+	-42, 11, 29, -33, -27, -46, 4, -35, -41, -23, 18, 36, -45, 23, 26, -29,
+	-41, -21, 1, -21, 71, 28, -29, -20, 30, 102, 42, 35, -36, 4, 33, -35,
+	-19, 8, 36, -70, -36, -15, 4, 32, 82, 48, -27, -23, 1, 19, -29, 20,
+	-32, 4, -44, -38, 31, -33, -25, -63, 2, -32, 1, -72, 55, 39, -41, -4,
+	80, -29, 47, -30, -68, 25, 18, 39, 8, 11, 30, 29, -24, -25, -49, -22,
+	44, -19, 48, -15, -16, 17, 21, -27, -45, -78, -26, 57, 22, -1, 7, -21,
+	7, 6, -10, 23, -64, -15, 5, -2, 44, -34, -39, 17, -22, 58, -7, -36,
+	6, -25, 4, 6, 62, 15, -35, 32, 50, 11, -51, 53, -31, -25, -18, -34,
+	-31, 13, 16, 25, 10, 66, -68, 2, -19, 0, 49, -54, 33, 18, 24, -24,
+	-13, -53, -37, -2, 23, -43, 15, -37, 42, -12, -9, -49, 6, 20, -42, -29,
+	-49, -79, 51, -6, -14, 18, -4, -24, 50, -42, -21, -46, 13, 29, 22, 13,
+	-26, 43, -40, 23, 54, -11, -2, 40, -4, 16, -28, 10, -47, -10, -22, -33,
+	-35, -11, -4, -9, -23, -13, 9, -42, -26, 47, 13, 72, -71, -2, 0, -1,
+	-31, -54, 16, 44, 30, 22, 20, 0, 14, 14, -15, 29, -10, -38, -67, 22,
+	5, 11, 23, -1, -2, -25, -42, -11, -16, 7, 2, -29, 19, 1, 24, -22,
+	29, -1, 56, 17, 20, -34, 7, 35, 38, -32, 24, 17, -62, -24, 0, 11,
+	16, 6, 4, 18, 21, 1, 14, -18, -24, -2, 20, 6, 27, -29, -10, 59,
+	23, -20, -7, 39, -36, -77, -1, -1, 27, -16, 23, 42, 32, 58, -18, -3,
+	-18, 26, -11, -31, 54, 7, -11, 5, 21, -26, -30, -39, -28, 5, -35, -29,
+	-7, -27, 3, 73, 28, 50, 24, -24, -28, 10, 46, -21, -40, 5, 64, 23,
+	25, 4, -14, 23, -32, 11, -24, 7, -38, 16, -3, 67, -40, -18, -16, 4,
+	-10, 21, -12, -1, -44, 28, -34, 16, -7, 28, 35, 14, 14, -33, 26, 22,
+	13, 43, 52, 6, 0, -35, 62, 24, -2, 30, -32, 5, 21, -11, 28, 27,
+	-13, -33, 34, 44, -43, -44, -24, -7, 30, 14, -53, -36, 9, 31, -13, 33,
+	24, -42, 0, -10, 8, 30, -29, -58, 42, -10, 40, 42, -5, 34, -17, 20,
+	-28, -49, -8, 18, -36, 39, -18, 46, -20, -12, 1, 31, -9, 11, -3, -10,
+	-10, -33, 3, 0, -4, -24, -34, 11, -10, -26, -29, 23, -5, -16, -13, -20,
+	48, -20, -34, -23, 9, -45, -24, -21, -30, 30, 24, 12, 1, -24, -8, -21,
+	-28, -26, -25, 15, 22, 50, 6, -19, -16, 65, 20, 10, -33, 32, -15, -9,
+	-19, -28, -26, 14, 32, 11, -3, -6, 39, -25, 1, -23, -20, 30, -19, 22,
+	31, -17, 44, 7, -16, -46, -35, -2, 15, 15, 8, 34, 26, 12, 18, 33,
+	13, -20, -6, -35, -12, -13, -4, 30, -25, -31, 31, 20, 30, 23, 34, -5,
+	18, 16, -35, 15, -12, -26, 22, 4, 39, 12, -4, -24, -7, -30, -2, 14,
+	19, -12, -5, 1, -15, -1, -20, 36, 34, -24, 2, 17, -3, -2, 10, 7,
+	14, -18, -15, 25, -2, -11, -20, -8, -25, 49, 20, 2, -18, 48, 17, 2,
+	30, -28, -15, -8, 27, -26, -32, 32, -11, -53, 6, -30, 39, 25, 38, 7,
+	-21, 18, -12, -35, -1, 1, 16, -9, -41, 1, -11, -9, -18, -23, -29, -31,
+	5, -44, 22, -8, 6, 24, -10, 43, -17, -27, -13, 11, -20, 36, 12, -2,
+	-1, -3, 24, 11, 38, 33, -28, 28, -13, -24, -24, -62, -13, 40, -39, 22,
+	-62, -10, -19, -30, -11, -12, -44, 11, 68, -11, 5, -6, -45, -33, -34, 1,
+	0, -49, 5, 12, 65, -28, 23, 10, -21, -39, -19, 51, 21, -41, -12, -6,
+	-2, 17, -30, -3, 54, -41, -38, -27, 15, 21, -12, 18, -14, 26, 56, -2,
+	-58, -16, -17, 58, 0, -62, 16, 24, 71, -44, -50, 36, -20, 1, 47, 23,
+	6, 8, 44, 18, -30, 0, 8, 11, -43, 43, 56, 4, 5, 6, 14, 1,
+	-8, -28, 37, -25, 21, 43, -32, -28, -40, 24, 3, 18, 32, 12, 63, -29,
+	-44, 15, 32, 28, -27, -40, -40, 5, 1, -37, -60, 9, -26, 55, -16, -23,
+	6, 52, -26, -34, -28, 29, 4, -25, 7, 23, -25, 13, 32, -60, 22, -1,
+	34, 21, -28, 24, -34, -33, 36, -19, -48, -55, 13, 28, -18, -31, -39, -48,
+	-27, -14, -12, -6, -43, -29, 32, -34, 50, 13, -2, -6, 24, -56, 25, 16,
+	-5, 41, 22, -8, -24, -14, 14, 15, -36, -16, -2, -17, 7, -7, 20, -29,
+	-15, 12, 62, -9, 32, -19, 9, 1, -10, 54, 26, -13, 43, 49, 0, -36,
+	0, -30, -16, 39, -11, -36, -42, -31, -1, -36, -33, -37, 16, -24, 7, -46,
+	-8, -3, -39, -4, -32, 21, -53, 1, 3, -12, -4, 54, -7, -2, 12, -32,
+	-29, -33, -3, -41, -30, -1, -22, -34, 1, -34, 3, 17, 2, -27, -12, 7,
+	-20, -28, 65, -31, 42, -13, 5, 15, 26, 17, 5, -4, -17, -7, -42, -21,
+	19, -7, 34, 2, 4, -29, 39, -19, -22, -25, 41, -21, 4, -30, -19, -29,
+	-15, 51, -26, -5, -31, -18, -14, 27, -10, -41, -15, 13, 3, 18, -15, 2,
+	-20, -35, 9, -32, -38, -1, 9, -22, 2, -25, 5, 15, -19, 33, -3, -34,
+	7, -4, 17, 19, 32, -30, 21, 2, 31, -8, -20, 24, -5, 35, -24, 33,
+	-8, 21, -25, -2, 19, -9, -31, 23, 18, -28, 5, 32, 39, -10, -11, 62,
+	5, -10, -5, 12, -2, -21, -1, 52, 15, 10, 5, -29, 11, -38, 15, -6,
+	-6, 13, 7, 9, -7, 30, -14, -25, 10, 21, 15, -13, -30, 37, -35, 2,
+	-12, 13, -18, 23, -4, -1, -24, 4, 28, 32, 5, 41, -13, 29, -27, -32,
+	1, -14, 24, -28, 18, 22, -11, 23, 2, -16, -41, -26, 8, 5, -4, 6,
+	0, 19, -53, -28, 32, -7, 18, 6, -8, 32, -12, -28, -16, -11, 5, -1,
+	-34, -19, -21, -43, 13, -6, -14, 3, 0, 6, -22, -32, 1, -13, -26, 10,
+	-13, -31, -30, 31, 8, -39, 15, -35, -3, 1, -5, -39, 29, 14, 19, -25,
+	17, -34, -13, 15, 18, -18, -13, -6, -17, 4, -9, -9, -23, -5, 7, -19,
+	-13, -12, -17, -15, -22, -10, 17, -24, -11, -4, 31, 0, -11, -17, -18, -10,
+	47, -18, -33, -14, 33, -18, 12, 22, -19, 48, 20, -17, 20, 30, 33, 14,
+	3, 22, -36, -31, 14, -22, -27, -34, 16, 11, -10, -4, -4, 21, -7, 3,
+	-10, 2, 13, -6, -24, -21, -21, 20, 11, 24, -12, 16, 9, 26, -10, -30,
+	12, -11, -21, 14, 3, -20, -5, -32, -8, -1, 45, 13, -16, 30, -3, -14,
+	1, -27, -10, -12, -10, 0, -3, -33, -3, 6, -28, -19, 1, -21, 19, -1,
+	12, -14, 6, 25, 10, -6, -13, 28, -33, 13, 4, -9, -29, 1, 33, -20,
+	-16, -15, -8, -16, 1, 47, 18, 14, 23, 37, -32, 0, -23, 22, 25, -29,
+	-14, -22, 16, 36, -7, 12, -6, 23, 37, 2, 24, -16, 1, -8, -21, 22,
+	-14, 24, 37, -19, 31, 19, 4, -21, -20, 16, -2, -13, 26, 7, 10, 13,
+	11, 7, 28, 17, 20, 6, 21, 18, -13, -20, 53, 0, -19, -7, 20, 30,
+	-2, -4, 1, -7, 11, 46, -3, 13, -9, -19, 0, -1, 8, -32, 20, 21,
+	-8, 6, -25, 1, -21, 5, -24, -27, 0, 10, 11, -18, 27, -2, -3, -27,
+	12, 8, -27, 31, 1, -19, -27, -24, 4, -29, 32, 16, -26, -31, 2, -16,
+	-13, 27, 14, 16, 20, -17, -17, -24, 13, 6, 2, 21, 35, 25, 48, -7,
+	20, -8, -7, -31, 18, -8, -27, 7, -14, -18, -13, -33, 13, 9, 32, -38,
+	-21, -30, -31, -3, 34, -20, -15, 8, -14, 25, -5, -16, -23, 13, -13, 4,
+	10, 1, -10, 25, 7, 1, -3, -30, -24, 12, -7, 44, -36, -16, 39, 0,
+	-13, 6, -3, 8, -3, 19, 1, -27, 13, -7, 18, -30, 6, -3, -31, 24,
+	-13, -49, 3, 5, -29, -18, -10, -38, -20, 17, 20, -14, 20, 8, 15, 6,
+	-39, 12, 0, 12, 34, -13, 45, 35, 33, 24, 21, 52, -16, -29, -26, 21,
+	-37, -18, 31, 60, 26, -20, 35, 14, 29, -29, -34, -1, -15, 29, -23, 7,
+	-6, 34, -12, 18, 21, -34, -8, -23, 42, 24, -12, -29, -26, -17, 13, -11,
+	-17, 12, 20, 2, -25, -23, -38, -6, -24, 44, -38, -20, 2, -27, -10, -21,
+	-28, 6, -15, 2, -17, 16, 12, 9, -31, -6, 31, 20, 13, -6, -31, 17,
+	17, 8, -23, 27, -4, 4, 29, 24, -16, 20, -17, -27, -26, -21, -17, 9,
+	-8, 19, -20, -15, -30, -4, 21, 22, -25, -32, 8, 30, -18, -23, 28, -14,
+	21, 3, 5, -24, 10, -25, 19, -1, -30, 21, 20, -36, -35, 2, -22, -36,
+	40, -2, -9, -31, -4, -35, 0, -17, 17, 27, -25, -25, -7, -26, 45, -45,
+	-2, -13, 22, -1, -32, -28, 12, 15, -6, 43, 25, -17, -28, 44, -21, 33,
+	9, 2, 7, 12, 22, 38, 20, -19, -3, -9, -32, -36, 47, 8, -48, -29,
+	-16, 16, -41, 23, 36, -31, 30, 21, 5, -23, 5, -20, 6, 1, 12, -27,
+	9, -43, -50, 11, 21, -4, 16, 7, 0, 7, 11, 21, -30, -9, 28, -19,
+	-7, 27, -14, -2, 18, -27, -15, 5, -29, -37, 47, -16, -5, 69, -17, 23,
+	-21, -27, -13, -29, -5, 26, 14, -15, 39, 15, 18, 21, -45, 20, -34, -1,
+	-23, -12, 2, 16, -36, 20, 18, 47, 0, -38, 5, 11, 41, 2, -19, 20,
+	-26, -13, 10, -22, 1, 36, 4, 28, 1, 10, 16, -3, 24, -8, 30, 45,
+	17, -23, -16, -5, -26, -13, -29, 7, -13, 19, -17, 50, -35, -16, 29, 54,
+	-2, -12, 3, -3, 5, 13, -41, 18, -3, 13, -28, -13, -46, 19, 25, 42,
+	-23, 63, -21, -23, -7, 9, -5, -44, 44, -33, 19, 0, -36, -10, 25, -4,
+	29, -1, -24, 17, -1, 28, 28, 19, -10, 4, -29, 41, -31, 37, 10, -26,
+	5, -51, -22, -37, -27, -38, -6, 8, 28, -15, -30, 0, -17, -29, 14, 38
+};
+constexpr int32_t bias_2[16] = {
+	-78, -154, 4, 125, 125, 202, 150, -41, 136, -133, -74, 47, -88, -75, -99, -48
+};
+constexpr struct aot_fully_connected_params params_2 = { 128, -29, 1425104935, -9, -128, 127 };
+
+constexpr struct aot_softmax_params softmax_params = { 1335877120, 27, -15 };
+
+//outputs of the layers, the layers write to both buffers in turn
+int8_t activations[2][230];
+} 
+
+int classify(const int8_t *input, float *probability)
+{
+	aot_fully_connected<230, 230>(input, weights_0, bias_0, params_0, activations[0]);
+	aot_fully_connected<230, 230>(activations[0], weights_1, bias_1, params_1, activations[1]);
+	aot_fully_connected<230, 16>(activations[1], weights_2, bias_2, params_2, activations[0]);
+	aot_softmax<16>(activations[0], softmax_params, activations[1]);
+
+	//environment with highest probability, -1 if all are 0
+	const int8_t *output = activations[1];
+	int index = -1;
+	int max_value = INT8_MIN;
+
+	for (int i = 0; i < 16; i++) {
+		if (output[i] > max_value) {
+			max_value = output[i];
+			index = i;
+		}
+	}
+	if (probability != NULL) {
+		*probability = (max_value - INT8_MIN) / 256.0f;
+	}
+
+	return index;
+}
+
+const int8_t *classify_output(void)
+{
+	return activations[1];
+}
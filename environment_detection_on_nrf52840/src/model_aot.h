@@ -0,0 +1,21 @@
+/*
+Ahead-of-time compiled model (AOT_MODEL build option): the raw input model (g_model_raw) as plain
+C++ code generated by tools/aot_model (model_aot.cc) with the kernels of aot_kernels.h.
+*/
+
+#ifndef MODEL_AOT_H_
+#define MODEL_AOT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+//predict the environment of a data sample given as int8 input of the raw input model
+//return index of the environment with the highest probability (-1 if all are 0), its probability
+//is written to probability (if not NULL)
+int classify(const int8_t *input, float *probability);
+
+//int8 output values of the last classify() (softmax with scale 1/256 and zero point -128), one per
+//environment, to compare them with the interpreter (tools/model_outputs)
+const int8_t *classify_output(void);
+
+#endif
@@ -0,0 +1,15 @@
+/*
+Input of the neural network in constants.cc: feature values per scan (the length of mean_list and
+std_list), whether the RSSI quantiles (RSSI_QUANTILES build option) follow the other features and
+whether the TxPower features are signed (dBm) or in the unsigned encoding of older firmware.
+Generated by neural_network.ipynb together with constants.cc.
+*/
+
+#ifndef MODEL_INPUT_H_
+#define MODEL_INPUT_H_
+
+#define MODEL_INPUT_FEATURES 46
+#define MODEL_INPUT_RSSI_QUANTILES 0
+#define MODEL_INPUT_TXPOWER_SIGNED 0
+
+#endif
@@ -0,0 +1,15 @@
+//generated by tools/model_ops from the models in constants.cc and model_raw.cc, do not edit
+//builtin ops used by the models: OP(name) for every MicroMutableOpResolver::Add<name>()
+
+#ifndef MODEL_OPS_H_
+#define MODEL_OPS_H_
+
+//g_modelurd
+#define MODEL_OPS_COUNT 5
+#define MODEL_OPS(OP) OP(Quantize) OP(Reshape) OP(FullyConnected) OP(Softmax) OP(Dequantize)
+
+//g_model_raw (RAW_INPUT)
+#define MODEL_RAW_OPS_COUNT 3
+#define MODEL_RAW_OPS(OP) OP(Reshape) OP(FullyConnected) OP(Softmax)
+
+#endif
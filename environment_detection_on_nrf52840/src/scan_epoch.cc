@@ -0,0 +1,335 @@
+/*
+Collects the data of received BLE beacons for one scan epoch and processes it to feature values.
+*/
+
+#include "scan_epoch.h"
+#include "ad_iter.h"
+
+#include <sys/printk.h>
+#include <sys/util.h>
+#include <string.h>
+
+#include <bluetooth/bluetooth.h>
+#include <sys/byteorder.h>
+
+static_assert(MOST_COMMON_SERVICES_COUNT <= 32, "services must fit into the bits of dev_services");
+
+/*
+mark service uuid as provided by device at index
+the device counts of the most common services are updated right away
+*/
+static void add_service(struct scan_epoch *epoch, int index, uint16_t uuid)
+{
+	int bit = service_column(uuid);
+
+	if (bit == -1) {
+		//service that is no feature
+		int j;
+
+		for (j = 0; j < epoch->other_services_count; j++) {
+			if (epoch->other_services[j] == uuid) {
+				break;
+			}
+		}
+
+		if (j == epoch->other_services_count) {
+			//new service
+			if (j == MAX_OTHER_SERVICES) {
+				epoch->services_overflow++;
+				return;
+			}
+			epoch->other_services[j] = uuid;
+			epoch->other_services_count++;
+			epoch->different_services++;
+		}
+		bit = MOST_COMMON_SERVICES_COUNT + j;
+
+	} else if (!(epoch->common_services_seen & BIT(bit))) {
+		//new service
+		epoch->common_services_seen |= BIT(bit);
+		epoch->different_services++;
+	}
+
+	if (!(epoch->dev_services[index] & BIT(bit))) {
+		epoch->dev_services[index] |= BIT(bit);
+		epoch->services_count++;
+
+		if (bit < MOST_COMMON_SERVICES_COUNT) {
+			epoch->service_devices[bit]++;
+		}
+	}
+}
+
+/*
+remove the services of the device at index from the counts of services provided by devices
+*/
+static void remove_services(struct scan_epoch *epoch, int index)
+{
+	uint32_t services = epoch->dev_services[index];
+
+	for (int bit = 0; services != 0; bit++, services >>= 1) {
+		if (services & 1) {
+			epoch->services_count--;
+
+			if (bit < MOST_COMMON_SERVICES_COUNT) {
+				epoch->service_devices[bit]--;
+			}
+		}
+	}
+	epoch->dev_services[index] = 0;
+}
+
+/*
+select the device to be replaced when the device table is full:
+the device with the fewest beacons, among those the one that was seen least recently
+*/
+static int select_eviction(const struct scan_epoch *epoch)
+{
+	const struct beacon_stats *stats = epoch->beacons_received;
+	int victim = 0;
+
+	for (int i = 1; i < epoch->devices.count; i++) {
+		if (stats[i].count < stats[victim].count ||
+		    (stats[i].count == stats[victim].count &&
+		     (int32_t)(stats[i].last - stats[victim].last) < 0)) {
+			victim = i;
+		}
+	}
+
+	return victim;
+}
+
+/*
+obtain txpower, manufacturer data and service UUIDs from an AD structure of the device at index
+return false to stop parsing the beacon
+*/
+static bool eir_found(struct scan_epoch *epoch, int index, const struct bt_data *data)
+{
+	switch (data->type) {
+	case BT_DATA_TX_POWER:
+		if (data->data_len < 1) {
+			printk("AD malformed\n");
+			return true;
+		}
+
+#if MODEL_INPUT_TXPOWER_SIGNED
+		//TxPower level is signed (dBm)
+		histogram_add(&epoch->txPower, (int8_t)data->data[0]);
+#else
+		//unsigned byte (-20 dBm as 236) as in the data the model was trained on
+		histogram_add(&epoch->txPower, data->data[0]);
+#endif
+		break;
+	case BT_DATA_MANUFACTURER_DATA:
+		histogram_add(&epoch->manufacturer_data_len, data->data_len);
+		break;
+
+	case BT_DATA_UUID16_SOME:
+	case BT_DATA_UUID16_ALL:
+		if (data->data_len % sizeof(uint16_t) != 0U) {
+			printk("AD malformed\n");
+			return true;
+		}
+
+		//only the first UUID of a beacon is taken into account and parsing stops there
+		//(as for the recorded training data)
+		if (data->data_len > 0) {
+			add_service(epoch, index, sys_get_le16(data->data));
+			return false;
+		}
+	}
+	return true;
+}
+
+void scan_epoch_reset(struct scan_epoch *epoch, uint32_t start)
+{
+	histogram_clear(&epoch->txPower);
+#ifdef RSSI_QUANTILES
+	histogram_clear(&epoch->rssi);
+#endif
+	histogram_clear(&epoch->manufacturer_data_len);
+	for (int i = 0; i < MOST_COMMON_SERVICES_COUNT; i++) {
+		epoch->service_devices[i] = 0;
+	}
+
+	device_table_clear(&epoch->devices);
+	epoch->devices_evicted = 0;
+	hll_clear(&epoch->addresses);
+	epoch->different_services = 0;
+	epoch->common_services_seen = 0;
+	epoch->services_count = 0;
+	epoch->other_services_count = 0;
+	epoch->services_overflow = 0;
+
+	epoch->start = start;
+	epoch->end = start;
+}
+
+void scan_epoch_add(struct scan_epoch *epoch, const struct adv_record *record)
+{
+	hll_add(&epoch->addresses, &record->addr);
+
+	int index = device_table_find(&epoch->devices, &record->addr);
+
+	if (index == -1) {
+		//new device
+		index = device_table_add(&epoch->devices, &record->addr);
+
+		if (index == -1) {
+			//device table is full
+			index = select_eviction(epoch);
+			remove_services(epoch, index);
+			device_table_replace(&epoch->devices, index, &record->addr);
+			epoch->devices_evicted++;
+		}
+		beacon_stats_init(&epoch->beacons_received[index]);
+		epoch->dev_services[index] = 0;
+	}
+
+	beacon_stats_add(&epoch->beacons_received[index], record->rssi, record->timestamp);
+
+#ifdef RSSI_QUANTILES
+	//a RSSI of 0 is not valid (see beacon_stats_add())
+	if (record->rssi != 0) {
+		histogram_add(&epoch->rssi, record->rssi);
+	}
+#endif
+
+	//single pass over the AD structures, the device is resolved once per beacon
+	struct ad_iter iter;
+	struct bt_data element;
+
+	ad_iter_init(&iter, record->data, record->data_len);
+	while (ad_iter_next(&iter, &element)) {
+		if (!eir_found(epoch, index, &element)) {
+			break;
+		}
+	}
+}
+
+void scan_epoch_features(const struct scan_epoch *epoch, const struct scan_epoch *previous,
+			 int features[DATA_RECORD_LENGTH])
+{
+	const struct device_table *devices = &epoch->devices;
+	const struct device_table *old_devices = &previous->devices;
+
+	//compare to last scan: new devices, lost devices
+	//devices are unique in both scans, so one lookup per device gives both counts
+	int common_device_count = 0;
+
+	for (int k = 0; k < devices->count; k++) {
+		if (device_table_find(old_devices, &devices->addr[k]) != -1) {
+			common_device_count++;
+		}
+	}
+
+	int device_count = devices->count;
+	int old_device_count = old_devices->count;
+
+	//if devices were replaced, the device table does not hold all devices of the scan
+	//the counts are estimated from the address sketches then
+	if (epoch->devices_evicted != 0 || previous->devices_evicted != 0) {
+		if (epoch->devices_evicted != 0) {
+			device_count = MAX(device_count, hll_estimate(&epoch->addresses));
+		}
+		if (previous->devices_evicted != 0) {
+			old_device_count = MAX(old_device_count, hll_estimate(&previous->addresses));
+		}
+
+		int union_count = hll_union_estimate(&epoch->addresses, &previous->addresses);
+
+		common_device_count = MIN(device_count + old_device_count - union_count,
+					  MIN(device_count, old_device_count));
+		common_device_count = MAX(common_device_count, 0);
+	}
+
+	//no devices are new if the last scan had none, none are lost if this scan has none
+	//(as for the recorded training data)
+	int new_device_count = 0;
+	int lost_device_count = 0;
+
+	if (old_device_count != 0) {
+		new_device_count = device_count - common_device_count;
+	}
+	if (device_count != 0) {
+		lost_device_count = old_device_count - common_device_count;
+	}
+	features[0] = device_count;
+	features[1] = lost_device_count;
+	features[2] = new_device_count;
+
+	//TxPower count, min, max, avg
+	const struct histogram *txPower = &epoch->txPower;
+	int txpower_count = txPower->count;
+	int txpower_avg = 0;
+
+	int min_txpower = 200;
+	int max_txpower = 0;
+
+	if (txpower_count != 0) {
+		txpower_avg = txPower->sum / txpower_count;
+		min_txpower = txPower->min;
+		max_txpower = txPower->max;
+	}
+
+	//manufacturer packet length count, avg and sum (of different lengths)
+	const struct histogram *man_len = &epoch->manufacturer_data_len;
+	int man_packet_len_count = man_len->count;
+	int man_packet_len_avg = 0;
+	int man_packet_len_sum = man_len->distinct_sum;
+
+	if (man_packet_len_count != 0) {
+		man_packet_len_avg = man_len->sum / man_packet_len_count;
+	}
+
+	features[3] = epoch->different_services;
+	features[4] = epoch->services_count;
+	features[5] = txpower_count;
+	features[6] = txpower_avg;
+	features[7] = min_txpower;
+	features[8] = max_txpower;
+	features[9] = man_packet_len_count;
+	features[10] = man_packet_len_sum;
+	features[11] = man_packet_len_avg;
+
+	// RSSI feature values
+	beacon_stats_features(epoch->beacons_received, devices->count, &features[12]);
+
+	//most common services
+	//without any service the values of the previous scan are kept (as for the recorded training data)
+	if (epoch->different_services != 0) {
+		for (int s = 0; s < MOST_COMMON_SERVICES_COUNT; s++) {
+			features[23 + s] = epoch->service_devices[s];
+		}
+	}
+
+#ifdef RSSI_QUANTILES
+	scan_epoch_rssi_quantiles(epoch, &features[SCAN_FEATURES_COUNT]);
+#endif
+}
+
+#ifdef RSSI_QUANTILES
+void scan_epoch_rssi_quantiles(const struct scan_epoch *epoch,
+			       int features[RSSI_QUANTILE_FEATURES_COUNT])
+{
+	//average RSSI of the devices is only known at the end of the epoch
+	//(only used while processing an epoch)
+	static struct histogram avg_rssi;
+
+	histogram_clear(&avg_rssi);
+	for (int i = 0; i < epoch->devices.count; i++) {
+		const struct beacon_stats *stats = &epoch->beacons_received[i];
+
+		if (stats->count != 0) {
+			histogram_add(&avg_rssi, stats->rssi_sum / stats->count);
+		}
+	}
+
+	features[0] = histogram_quantile(&epoch->rssi, 10);
+	features[1] = histogram_quantile(&epoch->rssi, 50);
+	features[2] = histogram_quantile(&epoch->rssi, 90);
+	features[3] = histogram_quantile(&avg_rssi, 10);
+	features[4] = histogram_quantile(&avg_rssi, 50);
+	features[5] = histogram_quantile(&avg_rssi, 90);
+}
+#endif
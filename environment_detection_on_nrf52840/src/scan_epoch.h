@@ -0,0 +1,120 @@
+/*
+Data extracted from the BLE beacons received during one scan epoch (SCAN_TIME seconds)
+and the feature values computed from it.
+Epochs overlap in time: a new epoch starts every SCAN_TIME / SCAN_EPOCH_OVERLAP seconds, so
+SCAN_EPOCH_OVERLAP epochs are collecting beacons at the same time and each beacon is added to all
+of them. Every epoch is a complete scan, its features are identical to a scan that started at
+the same time without any overlap.
+The epoch that ended is processed while the newer ones keep collecting, the epochs that ended
+before provide the devices of the last scan (for new and lost devices).
+Resetting an epoch takes constant time, data of a device is initialized when it is first seen.
+*/
+
+#ifndef SCAN_EPOCH_H_
+#define SCAN_EPOCH_H_
+
+#include "device_table.h"
+#include "beacon_stats.h"
+#include "adv_queue.h"
+#include "histogram.h"
+#include "hll.h"
+#include "service_map.h"
+#include "model_input.h"
+
+#include <zephyr/types.h>
+#include <bluetooth/addr.h>
+
+//optional RSSI quantile values (RSSI_QUANTILES build option)
+//p10, median and p90 of the RSSI of all beacons and of the average RSSI of all devices
+#define RSSI_QUANTILE_FEATURES_COUNT 6
+
+//feature values of one scan computed from the beacons
+#define SCAN_FEATURES_COUNT 46
+
+//values of one scan recorded in the data samples (CSV files): the feature values, followed by the
+//RSSI quantiles with RSSI_QUANTILES
+#ifdef RSSI_QUANTILES
+#define DATA_RECORD_LENGTH (SCAN_FEATURES_COUNT + RSSI_QUANTILE_FEATURES_COUNT)
+#else
+#define DATA_RECORD_LENGTH SCAN_FEATURES_COUNT
+#endif
+
+//model input of one scan as exported with the model (model_input.h): the first values of the
+//record, the feature values and the RSSI quantiles if the model was trained with them
+#define DATA_LINE_LENGTH MODEL_INPUT_FEATURES
+
+#if MODEL_INPUT_RSSI_QUANTILES && !defined(RSSI_QUANTILES)
+#error "the model takes the RSSI quantiles as input, build with RSSI_QUANTILES"
+#endif
+static_assert(DATA_LINE_LENGTH == SCAN_FEATURES_COUNT +
+				  (MODEL_INPUT_RSSI_QUANTILES ? RSSI_QUANTILE_FEATURES_COUNT : 0),
+	      "model input does not match the feature values of a scan");
+
+//feature values that compare a scan with the scan before (unknown for the first scan)
+#define FEATURE_LOST_DEVICES 1
+#define FEATURE_NEW_DEVICES 2
+
+//Limitations that max out SRAM
+#define MAX_OTHER_SERVICES (32 - MOST_COMMON_SERVICES_COUNT) //max unique services that are no feature
+
+struct scan_epoch {
+	//CPU cycles when the epoch started and ended, an epoch ends when the next one starts
+	uint32_t start;
+	uint32_t end;
+
+	//unique devices we receive at least one beacon
+	//when MAX_DEVICES is reached, the device with the fewest beacons is replaced by a new one
+	struct device_table devices;
+	struct beacon_stats beacons_received[MAX_DEVICES]; //beacons accumulated by device
+	int devices_evicted; //devices replaced because the device table was full
+	struct hll addresses; //sketch of all devices, for device counts beyond MAX_DEVICES
+#ifdef RSSI_QUANTILES
+	struct histogram rssi; //RSSI of all beacons (for quantiles)
+#endif
+
+	//TxPower (dBm) and manufacturer data length
+	struct histogram txPower;
+	struct histogram manufacturer_data_len;
+
+	//provided services
+	int different_services; //also counts services of replaced devices
+	uint32_t common_services_seen; //one bit per most common service
+	int services_count;
+	uint16_t service_devices[MOST_COMMON_SERVICES_COUNT]; //devices per most common service
+	int other_services_count;
+	uint16_t other_services[MAX_OTHER_SERVICES]; //UUIDs of services that are no feature
+	int services_overflow; //service UUIDs ignored because MAX_OTHER_SERVICES was reached
+	//which devices provide which service: one bit per most common service (feature column),
+	//followed by one bit per other service
+	//services_count and service_devices only count devices in the device table
+	uint32_t dev_services[MAX_DEVICES];
+};
+
+//epochs collecting beacons at the same time (1: epochs follow each other back to back), can be
+//set at build time (see CMakeLists.txt), RAM grows with the epoch buffers
+#ifndef SCAN_EPOCH_OVERLAP
+#define SCAN_EPOCH_OVERLAP 1
+#endif
+
+//epochs in use: collecting ones, the one that ended and the previous ones (the last scan of the
+//epoch that ended started SCAN_EPOCH_OVERLAP epochs before)
+#define SCAN_EPOCH_BUFFERS (2 * SCAN_EPOCH_OVERLAP + 1)
+
+//reset all data variables before the epoch starts collecting beacons
+void scan_epoch_reset(struct scan_epoch *epoch, uint32_t start);
+
+//add received beacon to the epoch
+void scan_epoch_add(struct scan_epoch *epoch, const struct adv_record *record);
+
+//process data of a finished epoch to feature values (and RSSI quantiles with RSSI_QUANTILES)
+//previous is the epoch that ended before (for new and lost devices)
+void scan_epoch_features(const struct scan_epoch *epoch, const struct scan_epoch *previous,
+			 int features[DATA_RECORD_LENGTH]);
+
+#ifdef RSSI_QUANTILES
+//process data of a finished epoch to the RSSI quantile values
+void scan_epoch_rssi_quantiles(const struct scan_epoch *epoch,
+			       int features[RSSI_QUANTILE_FEATURES_COUNT]);
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+/*
+The pause grows exponentially from SCHEDULE_MIN_PAUSE to SCHEDULE_MAX_PAUSE while the predictions
+are stable and goes back to 0 with the first prediction that is not.
+*/
+
+#include "scan_schedule.h"
+
+#include <sys/util.h>
+#include <string.h>
+
+void scan_schedule_init(struct scan_schedule *schedule, int64_t now)
+{
+	memset(schedule, 0, sizeof(*schedule));
+	schedule->start = now;
+}
+
+/*
+true if the latest SCHEDULE_HISTORY predictions are the same environment with high probability
+*/
+static bool stable(const struct scan_schedule *schedule)
+{
+	if (schedule->count < SCHEDULE_HISTORY) {
+		return false;
+	}
+
+	for (int i = 0; i < SCHEDULE_HISTORY; i++) {
+		if (schedule->indexes[i] == -1 || schedule->indexes[i] != schedule->indexes[0] ||
+		    schedule->probabilities[i] < SCHEDULE_MIN_PROBABILITY) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int scan_schedule_update(struct scan_schedule *schedule, int index, float probability)
+{
+	schedule->indexes[schedule->next] = index;
+	schedule->probabilities[schedule->next] = probability;
+	schedule->next = (schedule->next + 1) % SCHEDULE_HISTORY;
+	if (schedule->count < SCHEDULE_HISTORY) {
+		schedule->count++;
+	}
+
+	if (!stable(schedule)) {
+		schedule->pause = 0;
+	} else if (schedule->pause == 0) {
+		schedule->pause = SCHEDULE_MIN_PAUSE;
+	} else {
+		schedule->pause = MIN(2 * schedule->pause, SCHEDULE_MAX_PAUSE);
+	}
+
+	return schedule->pause;
+}
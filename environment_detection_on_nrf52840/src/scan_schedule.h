@@ -0,0 +1,44 @@
+/*
+Adaptive scan scheduling (ADAPTIVE_SCAN build option): while the latest predictions agree on the
+environment with a high probability, scanning pauses after a prediction, each confirmation doubles
+the pause. When the probability drops or the environment changes, scanning continues without
+pauses. A data sample needs back to back scans, so after a pause the next prediction is made once
+a full data sample is scanned again.
+*/
+
+#ifndef SCAN_SCHEDULE_H_
+#define SCAN_SCHEDULE_H_
+
+#include <zephyr/types.h>
+
+//latest predictions that have to agree before scanning pauses
+#define SCHEDULE_HISTORY 5
+
+//probability all of them need at least
+#define SCHEDULE_MIN_PROBABILITY 0.8f
+
+//first and longest pause (seconds)
+#define SCHEDULE_MIN_PAUSE 10
+#define SCHEDULE_MAX_PAUSE 120
+
+struct scan_schedule {
+	int indexes[SCHEDULE_HISTORY]; //ring of the latest predicted environments
+	float probabilities[SCHEDULE_HISTORY];
+	int count; //predictions in the ring
+	int next; //position of the next prediction in the ring
+	int pause; //seconds of the latest pause, 0 while scanning at full rate
+
+	//cost, to evaluate the schedule
+	int64_t start; //uptime (ms) when scanning started
+	int64_t radio_on; //ms scanned
+	uint64_t cpu_cycles; //CPU cycles of feature processing and classification
+};
+
+//start with full rate scanning at uptime now (ms)
+void scan_schedule_init(struct scan_schedule *schedule, int64_t now);
+
+//add the latest prediction (index -1: none)
+//return seconds to pause scanning before the next scan, 0 to keep scanning
+int scan_schedule_update(struct scan_schedule *schedule, int index, float probability);
+
+#endif
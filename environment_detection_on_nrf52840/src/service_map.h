@@ -0,0 +1,99 @@
+/*
+Compile-time perfect hash from a 16-bit service UUID to the feature column of the service.
+The hash is a multiplication with the upper SERVICE_MAP_BITS bits of the product as slot,
+the multiplier is searched at compile time so that no two services share a slot.
+*/
+
+#ifndef SERVICE_MAP_H_
+#define SERVICE_MAP_H_
+
+#include "services.h"
+
+#include <zephyr/types.h>
+
+constexpr uint16_t most_common_services[MOST_COMMON_SERVICES_COUNT] = { MOST_COMMON_SERVICES };
+
+#define SERVICE_MAP_BITS 6
+#define SERVICE_MAP_SLOTS (1 << SERVICE_MAP_BITS)
+
+static_assert(MOST_COMMON_SERVICES_COUNT <= SERVICE_MAP_SLOTS, "too many services for the map");
+
+struct service_map {
+	uint32_t multiplier;
+	uint16_t uuids[SERVICE_MAP_SLOTS];
+	int8_t columns[SERVICE_MAP_SLOTS]; //-1 if slot is empty
+};
+
+constexpr int service_map_slot(uint32_t multiplier, uint16_t uuid)
+{
+	return (int)((uuid * multiplier) >> (32 - SERVICE_MAP_BITS));
+}
+
+constexpr bool service_map_is_perfect(uint32_t multiplier)
+{
+	bool used[SERVICE_MAP_SLOTS] = {};
+
+	for (int i = 0; i < MOST_COMMON_SERVICES_COUNT; i++) {
+		int slot = service_map_slot(multiplier, most_common_services[i]);
+
+		if (used[slot]) {
+			return false;
+		}
+		used[slot] = true;
+	}
+	return true;
+}
+
+constexpr struct service_map make_service_map()
+{
+	struct service_map map = {};
+
+	//try multiples of Knuth's golden ratio constant (made odd), multiplier stays 0 if none fits
+	for (uint32_t i = 1; i < 10000; i++) {
+		uint32_t multiplier = (i * 2654435761u) | 1;
+
+		if (service_map_is_perfect(multiplier)) {
+			map.multiplier = multiplier;
+			break;
+		}
+	}
+
+	for (int slot = 0; slot < SERVICE_MAP_SLOTS; slot++) {
+		map.columns[slot] = -1;
+	}
+
+	for (int i = 0; i < MOST_COMMON_SERVICES_COUNT; i++) {
+		int slot = service_map_slot(map.multiplier, most_common_services[i]);
+
+		map.uuids[slot] = most_common_services[i];
+		map.columns[slot] = i;
+	}
+
+	return map;
+}
+
+constexpr struct service_map services_map = make_service_map();
+
+static_assert(services_map.multiplier != 0, "no perfect hash found for the services");
+
+//feature column of service uuid, -1 if the service is not a feature
+constexpr int service_column(uint16_t uuid)
+{
+	int slot = service_map_slot(services_map.multiplier, uuid);
+
+	return services_map.uuids[slot] == uuid ? services_map.columns[slot] : -1;
+}
+
+constexpr bool service_map_is_valid()
+{
+	for (int i = 0; i < MOST_COMMON_SERVICES_COUNT; i++) {
+		if (service_column(most_common_services[i]) != i) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static_assert(service_map_is_valid(), "service map does not match the services");
+
+#endif
@@ -0,0 +1,12 @@
+/*
+Service UUIDs whose device counts are features, in the order of the feature columns.
+Generated by neural_network.ipynb from the same list that is used for training.
+*/
+
+#ifndef SERVICES_H_
+#define SERVICES_H_
+
+#define MOST_COMMON_SERVICES_COUNT 23
+#define MOST_COMMON_SERVICES 0x0af0, 0x1802, 0x180f, 0x1812, 0x1826, 0x2222, 0xec88, 0xfd5a, 0xfd6f, 0xfdd2, 0xfddf, 0xfe03, 0xfe07, 0xfe0f, 0xfe61, 0xfe9f, 0xfea0, 0xfeb9, 0xfebe, 0xfee0, 0xff0d, 0xffc0, 0xffe0
+
+#endif
@@ -0,0 +1,401 @@
+/*
+Host tool: replays advertisements with realistic payloads (iBeacon, Eddystone, Apple Continuity,
+Google Fast Pair, Microsoft Swift Pair, Tile, a named sensor with TxPower and several UUIDs) of
+150 devices and measures nanoseconds per advertisement:
+- AD parsing alone: the AD iterator (src/ad_iter.cc) against bt_data_parse() with a callback per
+  element, both with the same handler; the elements of both have to be identical, also for
+  random (malformed) data
+- current path: scan_epoch_add() (device lookup, beacon stats, single pass over the AD structures)
+- path before the device table, as scan_cb() and eir_found() were: address to string and linear
+  getIndex() per advertisement and again per AD structure, bt_data_parse(), linear TxPower and
+  manufacturer data length tables, service UUIDs compared as strings
+
+build (in this folder):
+	g++ -std=c++14 -O2 -Wall -I../src -Izephyr_stubs ad_parse_bench.cc ../src/ad_iter.cc \
+		../src/scan_epoch.cc ../src/device_table.cc ../src/beacon_stats.cc \
+		../src/histogram.cc ../src/hll.cc zephyr_stubs/bluetooth.cc -o ad_parse_bench
+usage:
+	./ad_parse_bench
+returns 1 if the AD iterator and bt_data_parse() give different elements
+*/
+
+#include "ad_iter.h"
+#include "scan_epoch.h"
+
+#include <bluetooth/bluetooth.h>
+#include <bluetooth/uuid.h>
+#include <net/buf.h>
+#include <sys/byteorder.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <random>
+#include <vector>
+
+#define DEVICES 150
+
+//advertisements per epoch (10 per device) and epochs per measurement
+#define EPOCH_ADVERTISEMENTS (10 * DEVICES)
+#define EPOCHS 200
+
+static const std::vector<std::vector<uint8_t> > payloads = {
+	//iBeacon: flags, Apple manufacturer data
+	{ 0x02, 0x01, 0x06, 0x1a, 0xff, 0x4c, 0x00, 0x02, 0x15, 0xe2, 0xc5, 0x6d, 0xb5, 0xdf, 0xfb,
+	  0x48, 0xd2, 0xb0, 0x60, 0xd0, 0xf5, 0xa7, 0x10, 0x96, 0xe0, 0x00, 0x01, 0x00, 0x02, 0xc5 },
+	//Eddystone URL: flags, UUID 0xfeaa, service data
+	{ 0x02, 0x01, 0x06, 0x03, 0x03, 0xaa, 0xfe, 0x0e, 0x16, 0xaa, 0xfe, 0x10, 0xeb, 0x03, 0x65,
+	  0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x07 },
+	//Apple Continuity (nearby info): flags, TxPower, manufacturer data
+	{ 0x02, 0x01, 0x1a, 0x02, 0x0a, 0x0c, 0x0b, 0xff, 0x4c, 0x00, 0x10, 0x06, 0x1d, 0x1e, 0x4f,
+	  0x8a, 0x1c, 0x78 },
+	//Google Fast Pair: UUID 0xfe2c, service data, TxPower
+	{ 0x03, 0x03, 0x2c, 0xfe, 0x06, 0x16, 0x2c, 0xfe, 0x00, 0xb7, 0x27, 0x02, 0x0a, 0xf6 },
+	//exposure notification: flags, UUID 0xfd6f, service data
+	{ 0x02, 0x01, 0x1a, 0x03, 0x03, 0x6f, 0xfd, 0x17, 0x16, 0x6f, 0xfd, 0x8f, 0x2a, 0x61, 0x0c,
+	  0x9d, 0x44, 0x3e, 0x11, 0x5a, 0x04, 0x6e, 0x73, 0x0b, 0x99, 0x53, 0xe1, 0x2c, 0x3d, 0x4b },
+	//Microsoft Swift Pair: manufacturer data
+	{ 0x1e, 0xff, 0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0x3e, 0x8d, 0x41, 0x31, 0x02, 0x66, 0x70,
+	  0x0e, 0x24, 0xd0, 0x88, 0xa3, 0x54, 0x13, 0x4c, 0xcc, 0x99, 0xc2, 0x9d, 0x5f, 0x2f, 0x11, 0x06 },
+	//Tile: flags, UUID 0xfeed, service data
+	{ 0x02, 0x01, 0x06, 0x03, 0x03, 0xed, 0xfe, 0x0b, 0x16, 0xed, 0xfe, 0x02, 0x00, 0x3d, 0x48,
+	  0xa1, 0x7c, 0x52, 0x8f },
+	//sensor: flags, several 16 bit UUIDs, TxPower, name
+	{ 0x02, 0x01, 0x06, 0x07, 0x03, 0x0f, 0x18, 0x0a, 0x18, 0x1a, 0x18, 0x02, 0x0a, 0x00, 0x08,
+	  0x09, 0x53, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x31 },
+};
+
+static struct scan_epoch epoch;
+
+//results of the measured parsing, so it is not optimized away
+static volatile long parse_sum;
+
+static double now_ns(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+/*
+path before the device table (scan_cb() and eir_found() of the original firmware)
+*/
+#define MAX_DEVICES_BEFORE 150
+#define MAX_BEACONS_RECEIVED_BEFORE 140
+#define MAX_DIFFERENT_TX_POWERS 30
+#define MAX_DIFFERENT_MAN_PACKET_LEN 30
+
+static int device_count = 0;
+static int beacons_received[MAX_DEVICES_BEFORE][MAX_BEACONS_RECEIVED_BEFORE][2];
+static char devices[MAX_DEVICES_BEFORE][BT_ADDR_LE_STR_LEN];
+static int txPower[MAX_DIFFERENT_TX_POWERS][2];
+static int manufacturer_data_len[MAX_DIFFERENT_MAN_PACKET_LEN][2];
+static int different_services = 0;
+static int services_count = 0;
+static char services[MOST_COMMON_SERVICES_COUNT][10];
+static bool dev_services[MAX_DEVICES_BEFORE][MOST_COMMON_SERVICES_COUNT];
+
+static int getIndex(char *addr)
+{
+	for (int i = 0; i < device_count; i++) {
+		if (!strcmp(devices[i], addr)) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static void addDevice(char *addr)
+{
+	strcpy(devices[device_count], addr);
+	if (device_count < MAX_DEVICES_BEFORE) {
+		device_count++;
+	}
+}
+
+static void addRssi(int rssi, int index, uint32_t timestamp)
+{
+	for (int i = 0; i < MAX_BEACONS_RECEIVED_BEFORE; i++) {
+		if (beacons_received[index][i][0] == 0) {
+			beacons_received[index][i][0] = rssi;
+			beacons_received[index][i][1] = timestamp;
+			break;
+		}
+	}
+}
+
+static bool eir_found_before(struct bt_data *data, void *user_data)
+{
+	bt_addr_le_t *addr = static_cast<bt_addr_le_t *>(user_data);
+	char result[BT_ADDR_LE_STR_LEN];
+
+	bt_addr_le_to_str(addr, result, BT_ADDR_LE_STR_LEN);
+
+	uint8_t txp = 0;
+	uint8_t len = 0;
+
+	switch (data->type) {
+	case BT_DATA_TX_POWER:
+		txp = data->data[0];
+		for (int i = 0; i < MAX_DIFFERENT_TX_POWERS; i++) {
+			if (txPower[i][0] == txp) {
+				txPower[i][1]++;
+				break;
+			}
+			if (txPower[i][1] == 0) {
+				txPower[i][1]++;
+				txPower[i][0] = txp;
+				break;
+			}
+		}
+		break;
+	case BT_DATA_MANUFACTURER_DATA:
+		len = data->data_len;
+		for (int i = 0; i < MAX_DIFFERENT_MAN_PACKET_LEN; i++) {
+			if (manufacturer_data_len[i][0] == len) {
+				manufacturer_data_len[i][1]++;
+				break;
+			}
+			if (manufacturer_data_len[i][1] == 0) {
+				manufacturer_data_len[i][1]++;
+				manufacturer_data_len[i][0] = len;
+				break;
+			}
+		}
+		break;
+	case BT_DATA_UUID16_SOME:
+	case BT_DATA_UUID16_ALL:
+		if (data->data_len % sizeof(uint16_t) != 0U) {
+			return true;
+		}
+
+		for (int i = 0; i < data->data_len; i += sizeof(uint16_t)) {
+			uint16_t u16;
+
+			memcpy(&u16, &data->data[i], sizeof(u16));
+
+			struct bt_uuid_16 temp[] = { { { BT_UUID_TYPE_16 }, sys_le16_to_cpu(u16) } };
+			struct bt_uuid *uuid = (struct bt_uuid *)temp;
+			char uuid_str[100];
+
+			bt_uuid_to_str(uuid, uuid_str, sizeof(uuid_str));
+
+			//only MOST_COMMON_SERVICES_COUNT different services fit
+			for (int j = 0; j <= different_services && j < MOST_COMMON_SERVICES_COUNT; j++) {
+				if (!strcmp(services[j], uuid_str)) {
+					if (!dev_services[getIndex(result)][j]) {
+						dev_services[getIndex(result)][j] = true;
+						services_count++;
+					}
+					return false;
+				}
+				if (j == different_services) {
+					strcpy(services[j], uuid_str);
+					different_services++;
+					dev_services[getIndex(result)][j] = true;
+					services_count++;
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+static void scan_cb_before(const struct adv_record *record)
+{
+	char result[BT_ADDR_LE_STR_LEN];
+
+	bt_addr_le_to_str(&record->addr, result, BT_ADDR_LE_STR_LEN);
+
+	int index = getIndex(result);
+
+	if (index == -1) {
+		addDevice(result);
+		addRssi(record->rssi, getIndex(result), record->timestamp);
+	} else {
+		addRssi(record->rssi, index, record->timestamp);
+	}
+
+	struct net_buf_simple buf;
+
+	net_buf_simple_init_with_data(&buf, (void *)record->data, record->data_len);
+	bt_data_parse(&buf, eir_found_before, (void *)&record->addr);
+}
+
+static void reset_before(void)
+{
+	memset(beacons_received, 0, sizeof(beacons_received));
+	memset(txPower, 0, sizeof(txPower));
+	memset(manufacturer_data_len, 0, sizeof(manufacturer_data_len));
+	memset(services, 0, sizeof(services));
+	memset(dev_services, 0, sizeof(dev_services));
+	device_count = 0;
+	different_services = 0;
+	services_count = 0;
+}
+
+/*
+handler of both parsers: remembers type and data of the elements
+*/
+struct parsed {
+	long sum;
+	std::vector<uint8_t> *elements; //NULL while measuring
+};
+
+static bool element_found(struct bt_data *data, void *user_data)
+{
+	struct parsed *parsed = static_cast<struct parsed *>(user_data);
+
+	parsed->sum += data->type + data->data_len + (data->data_len > 0 ? data->data[0] : 0);
+	if (parsed->elements != NULL) {
+		parsed->elements->push_back(data->type);
+		parsed->elements->push_back(data->data_len);
+		parsed->elements->insert(parsed->elements->end(), data->data,
+					 data->data + data->data_len);
+	}
+
+	return true;
+}
+
+static void parse_iter(const uint8_t *data, int len, struct parsed *parsed)
+{
+	struct ad_iter iter;
+	struct bt_data element;
+
+	ad_iter_init(&iter, data, len);
+	while (ad_iter_next(&iter, &element)) {
+		if (!element_found(&element, parsed)) {
+			break;
+		}
+	}
+}
+
+static void parse_bt_data(const uint8_t *data, int len, struct parsed *parsed)
+{
+	struct net_buf_simple buf;
+
+	net_buf_simple_init_with_data(&buf, (void *)data, len);
+	bt_data_parse(&buf, element_found, parsed);
+}
+
+/*
+the AD iterator and bt_data_parse() give the same elements for the payloads and random data
+*/
+static bool check_elements(std::mt19937 &random)
+{
+	std::vector<std::vector<uint8_t> > inputs = payloads;
+
+	for (int i = 0; i < 1000000; i++) {
+		std::vector<uint8_t> data(random() % (ADV_DATA_MAX_LEN + 1));
+
+		for (uint8_t &value : data) {
+			//mostly short lengths, so there are several elements
+			value = random() % 4 == 0 ? random() % 8 : random();
+		}
+		inputs.push_back(data);
+	}
+
+	for (const std::vector<uint8_t> &data : inputs) {
+		std::vector<uint8_t> iter_elements;
+		std::vector<uint8_t> bt_data_elements;
+		struct parsed iter_parsed = { 0, &iter_elements };
+		struct parsed bt_data_parsed = { 0, &bt_data_elements };
+
+		parse_iter(data.data(), (int)data.size(), &iter_parsed);
+		parse_bt_data(data.data(), (int)data.size(), &bt_data_parsed);
+		if (iter_elements != bt_data_elements) {
+			printf("AD iterator and bt_data_parse() differ\n");
+			return false;
+		}
+	}
+
+	printf("AD iterator and bt_data_parse() give the same elements (%d payloads)\n",
+	       (int)inputs.size());
+
+	return true;
+}
+
+int main(void)
+{
+	std::mt19937 random(1);
+
+	if (!check_elements(random)) {
+		return 1;
+	}
+
+	//replay: every device sends one of the payloads
+	std::vector<struct adv_record> records(EPOCH_ADVERTISEMENTS);
+
+	for (int i = 0; i < EPOCH_ADVERTISEMENTS; i++) {
+		struct adv_record *record = &records[i];
+		int device = random() % DEVICES;
+		const std::vector<uint8_t> &payload = payloads[device % payloads.size()];
+
+		memset(record, 0, sizeof(*record));
+		record->addr.type = BT_ADDR_LE_RANDOM;
+		record->addr.a.val[0] = (uint8_t)device;
+		record->addr.a.val[1] = (uint8_t)(device >> 8);
+		record->addr.a.val[5] = 0xc0 | (device & 0x3f);
+		record->rssi = -50 - (int)(random() % 40);
+		record->timestamp = i * 2000;
+		record->data_len = (uint8_t)payload.size();
+		memcpy(record->data, payload.data(), payload.size());
+	}
+
+	long sum = 0;
+	double iter_ns = 0;
+	double bt_data_ns = 0;
+	double epoch_ns = 0;
+	double before_ns = 0;
+
+	for (int e = 0; e < EPOCHS; e++) {
+		struct parsed parsed = { 0, NULL };
+		double start = now_ns();
+
+		for (const struct adv_record &record : records) {
+			parse_iter(record.data, record.data_len, &parsed);
+		}
+
+		double middle = now_ns();
+
+		for (const struct adv_record &record : records) {
+			parse_bt_data(record.data, record.data_len, &parsed);
+		}
+		bt_data_ns += now_ns() - middle;
+		iter_ns += middle - start;
+		sum += parsed.sum;
+
+		scan_epoch_reset(&epoch, 0);
+		start = now_ns();
+		for (const struct adv_record &record : records) {
+			scan_epoch_add(&epoch, &record);
+		}
+		epoch_ns += now_ns() - start;
+		sum += epoch.services_count;
+
+		reset_before();
+		start = now_ns();
+		for (const struct adv_record &record : records) {
+			scan_cb_before(&record);
+		}
+		before_ns += now_ns() - start;
+		sum += services_count;
+	}
+	parse_sum = sum;
+
+	double advertisements = (double)EPOCH_ADVERTISEMENTS * EPOCHS;
+
+	printf("%d devices, %d payloads, %.0f advertisements\n", DEVICES, (int)payloads.size(),
+	       advertisements);
+	printf("AD parsing: AD iterator %.1f ns, bt_data_parse() %.1f ns per advertisement\n",
+	       iter_ns / advertisements, bt_data_ns / advertisements);
+	printf("scan_epoch_add(): %.1f ns per advertisement\n", epoch_ns / advertisements);
+	printf("before the device table (strings): %.1f ns per advertisement\n",
+	       before_ns / advertisements);
+
+	return 0;
+}
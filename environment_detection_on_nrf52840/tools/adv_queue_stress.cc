@@ -0,0 +1,189 @@
+/*
+Host tool: stress test of the advertisement queue (src/adv_queue.cc) with a producer and a
+consumer thread, like the scan callback and the aggregation thread of the firmware.
+The producer pushes numbered advertisements at a fixed rate (the ones due back to back, then it
+sleeps for 100 us), every 50th one with more data than ADV_DATA_MAX_LEN. The consumer checks that
+the records arrive complete and in order. Every advertisement has to be either received or counted
+as dropped, every received long one as truncated.
+
+Runs:
+- 20k and 50k advertisements/s with a fast consumer, drops only come from the scheduling of the
+  host (the producer sleeps longer than ADV_QUEUE_SIZE advertisements take)
+- 100k advertisements/s with a consumer that needs 20 us per record: the queue overflows
+
+build (in this folder):
+	g++ -std=c++14 -O2 -Wall -pthread -I../src -Izephyr_stubs adv_queue_stress.cc \
+		../src/adv_queue.cc -o adv_queue_stress
+usage:
+	./adv_queue_stress
+returns 1 if a check fails
+*/
+
+#include "adv_queue.h"
+
+#include <sys/util.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+//advertisement data longer than ADV_DATA_MAX_LEN (extended advertising)
+#define LONG_DATA_LEN 40
+
+static struct adv_queue queue;
+
+struct stress_result {
+	uint32_t pushed;
+	uint32_t received;
+	uint32_t dropped;
+	uint32_t truncated;
+	uint32_t long_received; //received advertisements with LONG_DATA_LEN bytes of data
+	uint32_t errors; //records out of order or with wrong content
+	double seconds;
+};
+
+static double now_ns(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+/*
+advertisement number seq: address, RSSI and data are derived from it
+*/
+static void make_adv(uint32_t seq, bt_addr_le_t *addr, uint8_t *data, uint16_t *data_len)
+{
+	addr->type = seq & 1;
+	memcpy(addr->a.val, &seq, sizeof(seq));
+	addr->a.val[4] = 0xc0;
+	addr->a.val[5] = (uint8_t)(seq >> 24);
+
+	*data_len = seq % 50 == 0 ? LONG_DATA_LEN : 3 + seq % 28;
+	for (int i = 0; i < *data_len; i++) {
+		data[i] = (uint8_t)(seq + i);
+	}
+}
+
+static bool valid_record(const struct adv_record *record, uint32_t seq)
+{
+	bt_addr_le_t addr;
+	uint8_t data[LONG_DATA_LEN];
+	uint16_t data_len;
+
+	make_adv(seq, &addr, data, &data_len);
+
+	return bt_addr_le_cmp(&record->addr, &addr) == 0 && record->rssi == -(int)(seq % 100) &&
+	       record->adv_type == seq % 4 && record->timestamp == seq &&
+	       record->epoch == (uint8_t)(seq / 1000) &&
+	       record->data_len == MIN(data_len, ADV_DATA_MAX_LEN) &&
+	       memcmp(record->data, data, record->data_len) == 0;
+}
+
+/*
+push count advertisements at rate per second, the consumer spends consumer_ns per record
+*/
+static struct stress_result stress(uint32_t count, double rate, double consumer_ns)
+{
+	struct stress_result result;
+	std::atomic<bool> done(false);
+
+	memset(&queue, 0, sizeof(queue));
+	memset(&result, 0, sizeof(result));
+
+	std::thread consumer([&]() {
+		uint32_t expected = 0;
+
+		for (;;) {
+			//done is read before the queue, so no record pushed before done is missed
+			bool finished = done.load();
+			const struct adv_record *record = adv_queue_peek(&queue);
+
+			//the aggregation thread waits for a semaphore instead
+			if (record == NULL) {
+				if (finished) {
+					break;
+				}
+				std::this_thread::yield();
+				continue;
+			}
+
+			//dropped advertisements are missing, the others arrive in order
+			uint32_t seq = record->timestamp;
+
+			if (seq < expected || seq >= count || !valid_record(record, seq)) {
+				result.errors++;
+			}
+			expected = seq + 1;
+			result.received++;
+			result.long_received += seq % 50 == 0;
+
+			if (consumer_ns > 0) {
+				double until = now_ns() + consumer_ns;
+
+				while (now_ns() < until) {
+				}
+			}
+			adv_queue_release(&queue);
+		}
+	});
+
+	double start = now_ns();
+
+	for (uint32_t seq = 0; seq < count; seq++) {
+		bt_addr_le_t addr;
+		uint8_t data[LONG_DATA_LEN];
+		uint16_t data_len;
+
+		make_adv(seq, &addr, data, &data_len);
+
+		//sleep once the advertisements due are pushed
+		double at = start + seq * 1e9 / rate;
+
+		while (now_ns() < at) {
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+
+		adv_queue_push(&queue, &addr, -(int)(seq % 100), seq % 4, data, data_len, seq,
+			       (uint8_t)(seq / 1000));
+	}
+	result.seconds = (now_ns() - start) / 1e9;
+	done.store(true);
+	consumer.join();
+
+	result.pushed = count;
+	result.dropped = (uint32_t)atomic_get(&queue.dropped);
+	result.truncated = (uint32_t)atomic_get(&queue.truncated);
+
+	return result;
+}
+
+static bool report(const char *name, const struct stress_result &result)
+{
+	bool ok = result.errors == 0 && result.received + result.dropped == result.pushed &&
+		  result.truncated == result.long_received;
+
+	printf("%s: %u pushed in %.2f s (%.0f/s), %u received, %u dropped (%.3f%%), %u truncated, %u errors: %s\n",
+	       name, result.pushed, result.seconds, result.pushed / result.seconds, result.received,
+	       result.dropped, 100.0 * result.dropped / result.pushed, result.truncated,
+	       result.errors, ok ? "ok" : "FAILED");
+
+	return ok;
+}
+
+int main(void)
+{
+	bool ok = true;
+
+	ok &= report("20k/s, fast consumer", stress(100000, 20000, 0));
+	ok &= report("50k/s, fast consumer", stress(250000, 50000, 0));
+	ok &= report("100k/s, consumer 20 us per record", stress(500000, 100000, 20000));
+
+	return ok ? 0 : 1;
+}
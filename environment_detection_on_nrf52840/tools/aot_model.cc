@@ -0,0 +1,347 @@
+/*
+Host tool: compiles the raw input model (g_model_raw of model_raw.cc, int8 input and output)
+ahead of time into plain C++ code for the AOT_MODEL build option. The generated model_aot.cc
+holds the weights and the quantization of every layer as constants and a classify() function
+that runs the layers with the kernels of src/aot_kernels.h. No flatbuffer, interpreter, op
+resolver or tensor arena is needed.
+
+Supported ops: RESHAPE (no op for the flat input), FULLY_CONNECTED (int8, per tensor quantized
+weights, no or ReLU activation) and SOFTMAX at the end. The quantization parameters are computed
+like the TFLM kernels do in Prepare().
+
+build (in this folder):
+	g++ -std=c++14 -O2 -I../src aot_model.cc tflite_reader.cc ../src/constants.cc \
+		../src/model_raw.cc -o aot_model
+usage:
+	./aot_model ../src/model_aot.cc
+	./aot_model --check ../src/model_aot.cc
+Has to be run again whenever model_raw.cc changes. With --check the source is not written but
+compared to the generated one, the build runs this check (see CMakeLists.txt) and fails if
+model_aot.cc is not generated from the current model_raw.cc.
+*/
+
+#include "constants.h"
+#include "tflite_reader.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+//FullyConnectedOptions field
+#define FULLY_CONNECTED_ACTIVATION 0
+//SoftmaxOptions field
+#define SOFTMAX_BETA 0
+
+/*
+multiplier as Q0.31 and shift (QuantizeMultiplier() of TFLM)
+*/
+static void quantize_multiplier(double value, int32_t *multiplier, int *shift)
+{
+	if (value == 0) {
+		*multiplier = 0;
+		*shift = 0;
+		return;
+	}
+
+	double q = frexp(value, shift);
+	int64_t q_fixed = (int64_t)round(q * (1ll << 31));
+
+	if (q_fixed == (1ll << 31)) {
+		q_fixed /= 2;
+		++*shift;
+	}
+	if (*shift < -31) {
+		*shift = 0;
+		q_fixed = 0;
+	}
+	*multiplier = (int32_t)q_fixed;
+}
+
+static void write_values(FILE *file, const char *declaration, const std::vector<int> &values)
+{
+	fprintf(file, "%s[%d] = {", declaration, (int)values.size());
+	for (size_t i = 0; i < values.size(); i++) {
+		fprintf(file, "%s%d", i == 0 ? "\n\t" : (i % 16 == 0 ? ",\n\t" : ", "), values[i]);
+	}
+	fprintf(file, "\n};\n");
+}
+
+/*
+write weights, bias and quantization of the fully connected op as constants
+return the call of the layer, empty on error
+*/
+static std::string fully_connected(const struct tflite_model *tflite,
+				   const struct tflite_operator *op, int layer, FILE *file,
+				   int *out_size)
+{
+	struct tflite_tensor input, weights, bias, output;
+
+	if (op->inputs.size() != 3 || !tflite_get_tensor(tflite, op->inputs[0], &input) ||
+	    !tflite_get_tensor(tflite, op->inputs[1], &weights) ||
+	    !tflite_get_tensor(tflite, op->inputs[2], &bias) ||
+	    !tflite_get_tensor(tflite, op->outputs[0], &output)) {
+		fprintf(stderr, "fully connected layer %d: tensors could not be read\n", layer);
+		return "";
+	}
+
+	if (input.type != TFLITE_INT8 || weights.type != TFLITE_INT8 ||
+	    bias.type != TFLITE_INT32 || output.type != TFLITE_INT8 || weights.scale.size() != 1 ||
+	    weights.zero_point[0] != 0 || weights.shape.size() != 2 || weights.data == NULL ||
+	    bias.data == NULL) {
+		fprintf(stderr, "fully connected layer %d: only int8 with per tensor quantized weights is supported\n",
+			layer);
+		return "";
+	}
+
+	int activation = tflite_option_int(tflite, op, FULLY_CONNECTED_ACTIVATION,
+					   TFLITE_ACTIVATION_NONE);
+
+	if (activation != TFLITE_ACTIVATION_NONE && activation != TFLITE_ACTIVATION_RELU) {
+		fprintf(stderr, "fully connected layer %d: activation %d is not supported\n", layer,
+			activation);
+		return "";
+	}
+
+	int out = weights.shape[0];
+	int in = weights.shape[1];
+	std::vector<int> values;
+
+	fprintf(file, "\n//%s\n", weights.name.c_str());
+	for (int i = 0; i < out * in; i++) {
+		values.push_back((int8_t)weights.data[i]);
+	}
+	write_values(file, ("constexpr int8_t weights_" + std::to_string(layer)).c_str(), values);
+
+	values.clear();
+	for (int i = 0; i < out; i++) {
+		int32_t value;
+
+		memcpy(&value, bias.data + 4 * i, sizeof(value));
+		values.push_back(value);
+	}
+	write_values(file, ("constexpr int32_t bias_" + std::to_string(layer)).c_str(), values);
+
+	//as GetQuantizedConvolutionMultipler() and CalculateActivationRangeQuantized() of TFLM
+	double real_multiplier =
+		(double)(input.scale[0] * weights.scale[0]) / (double)output.scale[0];
+	int32_t multiplier;
+	int shift;
+	int output_min = activation == TFLITE_ACTIVATION_RELU ?
+				 std::max(-128, (int)output.zero_point[0]) :
+				 -128;
+
+	quantize_multiplier(real_multiplier, &multiplier, &shift);
+	fprintf(file,
+		"constexpr struct aot_fully_connected_params params_%d = { %d, %d, %d, %d, %d, %d };\n",
+		layer, (int)-input.zero_point[0], (int)output.zero_point[0], multiplier, shift,
+		output_min, 127);
+
+	*out_size = out;
+
+	char call[256];
+
+	snprintf(call, sizeof(call),
+		 "aot_fully_connected<%d, %d>(%%s, weights_%d, bias_%d, params_%d, %%s);", in, out,
+		 layer, layer, layer);
+
+	return call;
+}
+
+/*
+write the quantization of the softmax op as constants
+return false on error
+*/
+static bool softmax(const struct tflite_model *tflite, const struct tflite_operator *op, FILE *file)
+{
+	struct tflite_tensor input, output;
+
+	if (!tflite_get_tensor(tflite, op->inputs[0], &input) ||
+	    !tflite_get_tensor(tflite, op->outputs[0], &output) || input.type != TFLITE_INT8 ||
+	    output.type != TFLITE_INT8 || output.scale[0] != 1.0f / 256 ||
+	    output.zero_point[0] != -128) {
+		fprintf(stderr, "softmax: only int8 with output scale 1/256 and zero point -128 is supported\n");
+		return false;
+	}
+
+	//as PreprocessSoftmaxScaling() and CalculateInputRadius() of TFLM
+	const int scaled_diff_integer_bits = 5;
+	double beta = tflite_option_float(tflite, op, SOFTMAX_BETA, 1.0f);
+	double real_multiplier = std::min(beta * (double)input.scale[0] *
+						  (1 << (31 - scaled_diff_integer_bits)),
+					  (1ll << 31) - 1.0);
+	int32_t multiplier;
+	int left_shift;
+
+	quantize_multiplier(real_multiplier, &multiplier, &left_shift);
+
+	double max_input_rescaled = 1.0 * ((1 << scaled_diff_integer_bits) - 1) *
+				    (1ll << (31 - scaled_diff_integer_bits)) / (1ll << left_shift);
+	int diff_min = -(int)floor(max_input_rescaled);
+
+	fprintf(file, "\nconstexpr struct aot_softmax_params softmax_params = { %d, %d, %d };\n",
+		multiplier, left_shift, diff_min);
+
+	return true;
+}
+
+/*
+read a whole file, empty if it can not be read
+*/
+static std::string read_file(FILE *file)
+{
+	std::string content;
+	char buffer[1024];
+	size_t len;
+
+	while ((len = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+		content.append(buffer, len);
+	}
+
+	return content;
+}
+
+/*
+compare the generated source (written to a temporary file) with the file at path
+*/
+static bool same_source(FILE *generated, const char *path)
+{
+	FILE *file = fopen(path, "r");
+
+	if (file == NULL) {
+		return false;
+	}
+
+	std::string current = read_file(file);
+
+	fclose(file);
+	rewind(generated);
+
+	return read_file(generated) == current;
+}
+
+int main(int argc, char **argv)
+{
+	bool check = argc == 3 && strcmp(argv[1], "--check") == 0;
+
+	if (argc != 2 && !check) {
+		fprintf(stderr, "usage: %s [--check] model_aot.cc\n", argv[0]);
+		return 1;
+	}
+
+	const char *path = argv[argc - 1];
+
+	std::vector<uint8_t> data(g_model_raw, g_model_raw + g_model_raw_len);
+	struct tflite_model tflite = { data.data(), data.size() };
+	struct tflite_tensor input;
+
+	if (!tflite_get_tensor(&tflite, tflite_inputs(&tflite)[0], &input) ||
+	    input.type != TFLITE_INT8) {
+		fprintf(stderr, "model input is not int8, run fold_normalization first\n");
+		return 1;
+	}
+
+	FILE *file = check ? tmpfile() : fopen(path, "w");
+
+	if (file == NULL) {
+		fprintf(stderr, "%s could not be written\n", check ? "temporary file" : path);
+		return 1;
+	}
+
+	fprintf(file, "//generated by tools/aot_model from g_model_raw (model_raw.cc), do not edit\n");
+	fprintf(file, "#include \"model_aot.h\"\n#include \"aot_kernels.h\"\n\nnamespace\n{\n");
+
+	//layer calls with the input and output buffer left open
+	std::vector<std::string> calls;
+	int max_size = 0;
+	int size = tflite_elements(&input);
+	bool has_softmax = false;
+
+	for (int i = 0; i < tflite_operator_count(&tflite); i++) {
+		struct tflite_operator op;
+
+		if (!tflite_get_operator(&tflite, i, &op) || has_softmax) {
+			fprintf(stderr, "op %d: softmax has to be the last op\n", i);
+			return 1;
+		}
+
+		switch (op.builtin_code) {
+		case TFLITE_BUILTIN_RESHAPE:
+			//the values are flat already
+			break;
+		case TFLITE_BUILTIN_FULLY_CONNECTED: {
+			std::string call = fully_connected(&tflite, &op, (int)calls.size(), file, &size);
+
+			if (call.empty()) {
+				return 1;
+			}
+			calls.push_back(call);
+			break;
+		}
+		case TFLITE_BUILTIN_SOFTMAX:
+			if (!softmax(&tflite, &op, file)) {
+				return 1;
+			}
+			calls.push_back("aot_softmax<" + std::to_string(size) +
+					">(%s, softmax_params, %s);");
+			has_softmax = true;
+			break;
+		default:
+			fprintf(stderr, "op %d: builtin op %d is not supported\n", i, op.builtin_code);
+			return 1;
+		}
+		max_size = std::max(max_size, size);
+	}
+
+	if (!has_softmax) {
+		fprintf(stderr, "the model does not end with softmax\n");
+		return 1;
+	}
+
+	fprintf(file, "\n//outputs of the layers, the layers write to both buffers in turn\n");
+	fprintf(file, "int8_t activations[2][%d];\n} \n\n", max_size);
+
+	fprintf(file, "int classify(const int8_t *input, float *probability)\n{\n");
+	for (size_t i = 0; i < calls.size(); i++) {
+		std::string in = i == 0 ? "input" : "activations[" + std::to_string((i - 1) % 2) + "]";
+		std::string out = "activations[" + std::to_string(i % 2) + "]";
+		char call[256];
+
+		snprintf(call, sizeof(call), calls[i].c_str(), in.c_str(), out.c_str());
+		fprintf(file, "\t%s\n", call);
+	}
+
+	//softmax output: scale 1/256, zero point -128
+	fprintf(file, "\n\t//environment with highest probability, -1 if all are 0\n");
+	fprintf(file, "\tconst int8_t *output = activations[%d];\n", (int)(calls.size() - 1) % 2);
+	fprintf(file, "\tint index = -1;\n\tint max_value = INT8_MIN;\n\n");
+	fprintf(file, "\tfor (int i = 0; i < %d; i++) {\n", size);
+	fprintf(file, "\t\tif (output[i] > max_value) {\n\t\t\tmax_value = output[i];\n\t\t\tindex = i;\n\t\t}\n\t}\n");
+	fprintf(file, "\tif (probability != NULL) {\n\t\t*probability = (max_value - INT8_MIN) / 256.0f;\n\t}\n\n");
+	fprintf(file, "\treturn index;\n}\n\n");
+
+	fprintf(file, "const int8_t *classify_output(void)\n{\n");
+	fprintf(file, "\treturn activations[%d];\n}\n", (int)(calls.size() - 1) % 2);
+
+	if (check) {
+		bool same = same_source(file, path);
+
+		fclose(file);
+		if (!same) {
+			fprintf(stderr, "%s is not generated from the current model_raw.cc, run tools/aot_model\n",
+				path);
+			return 1;
+		}
+
+		return 0;
+	}
+	fclose(file);
+
+	printf("written %s: %d layers, activations 2 x %d bytes\n", path, (int)calls.size(),
+	       max_size);
+
+	return 0;
+}
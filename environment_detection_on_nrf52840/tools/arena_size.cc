@@ -0,0 +1,134 @@
+/*
+Host tool: computes the exact tensor arena size the models need and writes it to a header
+(model_arena.h) for the firmware. It runs at build time (see CMakeLists.txt) and is linked with a
+host build of the same TFLM sources as the firmware, with the ops of the generated src/model_ops.h.
+
+The models are allocated like in setup(): the arena size is the smallest one for which
+AllocateTensors() succeeds (binary search), with an arena aligned like the one of the firmware.
+Tool and TFLM are built for 32 bit with double and int64 aligned to 8 bytes in structs as in the
+ARM EABI of the target (-m32 -malign-double, i386 aligns them to 4 bytes otherwise, e.g. the double
+beta of SoftmaxParams), so the interpreter data in the arena is laid out like on the target. This is
+still a host build: kernels that size their scratch buffers for the target CPU (CMSIS-NN runs its
+portable C code on the host) can need more, TENSOR_ARENA_SIZE sets a larger arena then.
+
+build (in this folder, TF_SRC_DIR: tensorflow folder with a host build of microlite with
+"CC=gcc -m32 -malign-double" "CXX=g++ -m32 -malign-double"):
+	g++ -m32 -malign-double -std=c++11 -O2 -I../src -I$TF_SRC_DIR \
+		-I$TF_SRC_DIR/tensorflow/lite/micro/tools/make/downloads/flatbuffers/include \
+		arena_size.cc ../src/constants.cc ../src/model_raw.cc \
+		$TF_SRC_DIR/tensorflow/lite/micro/tools/make/gen/linux_x86_32/lib/libtensorflow-microlite.a \
+		-o arena_size
+usage:
+	./arena_size model_arena.h
+*/
+
+#include "constants.h"
+#include "model_ops.h"
+
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#include <stdio.h>
+
+//alignment of the arena in the firmware
+#define ARENA_ALIGNMENT 16
+
+//largest arena that is tried
+#define MAX_ARENA_SIZE (256 * 1024)
+
+alignas(ARENA_ALIGNMENT) static uint8_t arena[MAX_ARENA_SIZE];
+
+//allocation fails for every too small arena of the search, these errors are not shown
+class SilentErrorReporter : public tflite::ErrorReporter {
+public:
+	int Report(const char *format, va_list args) override
+	{
+		return 0;
+	}
+};
+
+/*
+true if model can be allocated in an arena of size bytes
+*/
+static bool allocates(const unsigned char *model_data, const tflite::MicroOpResolver &resolver,
+		      size_t size)
+{
+	static SilentErrorReporter error_reporter;
+	tflite::MicroInterpreter interpreter(tflite::GetModel(model_data), resolver, arena, size,
+					     &error_reporter);
+
+	return interpreter.AllocateTensors() == kTfLiteOk;
+}
+
+/*
+smallest arena size the model can be allocated in, -1 if MAX_ARENA_SIZE is not enough
+*/
+static int arena_size(const char *name, const unsigned char *model_data,
+		      const tflite::MicroOpResolver &resolver)
+{
+	if (!allocates(model_data, resolver, MAX_ARENA_SIZE)) {
+		fprintf(stderr, "%s can not be allocated in %d bytes\n", name, MAX_ARENA_SIZE);
+		return -1;
+	}
+
+	int too_small = 0;
+	int enough = MAX_ARENA_SIZE;
+
+	while (enough - too_small > 1) {
+		int size = too_small + (enough - too_small) / 2;
+
+		if (allocates(model_data, resolver, size)) {
+			enough = size;
+		} else {
+			too_small = size;
+		}
+	}
+	printf("%s: %d bytes\n", name, enough);
+
+	return enough;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s model_arena.h\n", argv[0]);
+		return 1;
+	}
+
+#define ADD_OP(name) resolver.Add##name();
+	tflite::MicroMutableOpResolver<MODEL_OPS_COUNT> resolver;
+	MODEL_OPS(ADD_OP)
+
+	tflite::MicroMutableOpResolver<MODEL_RAW_OPS_COUNT> raw_resolver;
+#undef ADD_OP
+#define ADD_OP(name) raw_resolver.Add##name();
+	MODEL_RAW_OPS(ADD_OP)
+#undef ADD_OP
+
+	int size = arena_size("g_modelurd", g_modelurd, resolver);
+	int raw_size = arena_size("g_model_raw", g_model_raw, raw_resolver);
+
+	if (size == -1 || raw_size == -1) {
+		return 1;
+	}
+
+	FILE *file = fopen(argv[1], "w");
+
+	if (file == NULL) {
+		fprintf(stderr, "%s could not be written\n", argv[1]);
+		return 1;
+	}
+
+	fprintf(file, "//generated by tools/arena_size at build time, do not edit\n");
+	fprintf(file, "//tensor arena bytes the models need, the arena has to be aligned to MODEL_ARENA_ALIGNMENT\n");
+	fprintf(file, "\n#ifndef MODEL_ARENA_H_\n#define MODEL_ARENA_H_\n\n");
+	fprintf(file, "#define MODEL_ARENA_ALIGNMENT %d\n", ARENA_ALIGNMENT);
+	fprintf(file, "#define MODEL_ARENA_SIZE %d //g_modelurd\n", size);
+	fprintf(file, "#define MODEL_RAW_ARENA_SIZE %d //g_model_raw (RAW_INPUT)\n", raw_size);
+	fprintf(file, "\n#endif\n");
+	fclose(file);
+
+	return 0;
+}
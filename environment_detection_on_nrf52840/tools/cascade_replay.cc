@@ -0,0 +1,193 @@
+/*
+Host tool: replays the cascade classifier (CASCADE build option) on data samples. The first
+stage (cascade_model.cc, exported by neural_network.ipynb) classifies the feature values of the
+latest scan, the data samples it is not confident about are classified by the neural network
+(the raw input model as in model_aot.cc, checked against the interpreter by model_outputs).
+Use other data samples than the ones the tree was trained on.
+
+Prints the accuracy of the neural network alone and of the cascade, the escalation rate and the
+time per classification on the host. The device cycles per classification are estimated from the
+cycles of the first stage and of the neural network as printed by the firmware (optional).
+With --signed-txpower the TxPower features of the data samples (recorded as unsigned bytes, -20 dBm
+as 236) are re-encoded as signed values before they are classified, to estimate the effect of
+signed TxPower on a model trained on the unsigned encoding (MODEL_INPUT_TXPOWER_SIGNED). Scans
+with positive and negative TxPower are approximated as having only two TxPower values: the min
+(positive) and the max (negative) in the unsigned encoding.
+
+build (in this folder):
+	g++ -std=c++14 -O2 -I../src cascade_replay.cc data_sample.cc ../src/constants.cc \
+		../src/model_raw.cc ../src/model_aot.cc ../src/cascade_model.cc -o cascade_replay
+usage:
+	./cascade_replay [--cycles first_stage neural_network] [--signed-txpower] [data sample CSV files]
+*/
+
+#include "constants.h"
+#include "data_sample.h"
+#include "cascade_model.h"
+#include "model_aot.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+
+//features of a scan (input of the raw input model: DATA_ROWS scans)
+#define FEATURES MODEL_INPUT_FEATURES
+
+//TxPower features of a scan: count, average, min, max
+#define FEATURE_TXPOWER_COUNT 5
+#define FEATURE_TXPOWER_AVG 6
+#define FEATURE_TXPOWER_MIN 7
+#define FEATURE_TXPOWER_MAX 8
+
+static double now_ns(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+/*
+re-encode the TxPower features of a scan as signed values, return 0 if the scan has no negative
+TxPower, 1 if it is exact and 2 if it is approximated (positive and negative TxPower)
+*/
+static int signed_txpower(int *scan)
+{
+	int count = scan[FEATURE_TXPOWER_COUNT];
+	int avg = scan[FEATURE_TXPOWER_AVG];
+	int min = scan[FEATURE_TXPOWER_MIN];
+	int max = scan[FEATURE_TXPOWER_MAX];
+
+	if (count == 0 || max < 128) {
+		return 0;
+	}
+
+	if (min >= 128) {
+		scan[FEATURE_TXPOWER_AVG] = avg - 256;
+		scan[FEATURE_TXPOWER_MIN] = min - 256;
+		scan[FEATURE_TXPOWER_MAX] = max - 256;
+		return 1;
+	}
+
+	//share of negative values from the average of the two values min and max
+	double negative = (double)(avg - min) / (max - min);
+
+	scan[FEATURE_TXPOWER_AVG] = (int)(avg - 256 * negative);
+	scan[FEATURE_TXPOWER_MIN] = max - 256;
+	scan[FEATURE_TXPOWER_MAX] = min;
+	return 2;
+}
+
+int main(int argc, char **argv)
+{
+	int arg = 1;
+	double first_stage_cycles = 0;
+	double model_cycles = 0;
+	bool txpower_signed = false;
+
+	if (argc > arg + 2 && strcmp(argv[arg], "--cycles") == 0) {
+		first_stage_cycles = atof(argv[arg + 1]);
+		model_cycles = atof(argv[arg + 2]);
+		arg += 3;
+	}
+	if (argc > arg && strcmp(argv[arg], "--signed-txpower") == 0) {
+		txpower_signed = true;
+		arg++;
+	}
+
+	int samples = 0;
+	int model_correct = 0;
+	int escalations = 0;
+	int first_stage_correct = 0;
+	int cascade_correct = 0;
+	double first_stage_ns = 0;
+	double model_ns = 0;
+	int txpower_scans[3] = { 0 };
+	std::vector<int> sample;
+
+	for (; arg < argc; arg++) {
+		std::string label = read_data_label(argv[arg]);
+		int index = -1;
+
+		for (int e = 0; e < available_env_len; e++) {
+			if (label == available_env[e]) {
+				index = e;
+			}
+		}
+
+		if (index == -1 || !read_data_sample(argv[arg], FEATURES, &sample)) {
+			continue;
+		}
+		samples++;
+
+		for (int row = 0; txpower_signed && row < DATA_ROWS; row++) {
+			txpower_scans[signed_txpower(&sample[row * FEATURES])]++;
+		}
+
+		//int8 input as in quantize_data()
+		int8_t input[FEATURES * DATA_ROWS];
+
+		for (int i = 0; i < FEATURES * DATA_ROWS; i++) {
+			int feature = i % FEATURES;
+			int value = (int)roundf(sample[i] * raw_input_scale[feature] +
+						raw_input_zero_point[feature]);
+
+			input[i] = (int8_t)(value < -128 ? -128 : (value > 127 ? 127 : value));
+		}
+
+		float probability;
+		double start = now_ns();
+		int first_stage = cascade_classify(sample.data(), &probability);
+		double middle = now_ns();
+		int model = classify(input, &probability);
+		double end = now_ns();
+
+		first_stage_ns += middle - start;
+		model_ns += end - middle;
+		model_correct += model == index;
+
+		if (first_stage == -1) {
+			escalations++;
+			cascade_correct += model == index;
+		} else {
+			first_stage_correct += first_stage == index;
+			cascade_correct += first_stage == index;
+		}
+	}
+
+	if (samples == 0) {
+		fprintf(stderr, "no labelled data samples\n");
+		return 1;
+	}
+
+	int answered = samples - escalations;
+	double escalation_rate = (double)escalations / samples;
+
+	printf("data samples: %d\n", samples);
+	if (txpower_signed) {
+		printf("signed TxPower: %d scans re-encoded, %d of them approximated (positive and negative TxPower)\n",
+		       txpower_scans[1] + txpower_scans[2], txpower_scans[2]);
+	}
+	printf("neural network: %.2f%% right, %.2f us per classification\n",
+	       100.0 * model_correct / samples, model_ns / samples / 1000);
+	printf("first stage: answered %d (%.2f%% right), %.3f us per classification\n", answered,
+	       answered == 0 ? 0 : 100.0 * first_stage_correct / answered,
+	       first_stage_ns / samples / 1000);
+	printf("cascade: %.2f%% right, escalation rate %.2f%%, %.2f us per classification\n",
+	       100.0 * cascade_correct / samples, 100 * escalation_rate,
+	       (first_stage_ns + escalation_rate * model_ns) / samples / 1000);
+
+	//every classification runs the first stage, the escalated ones the neural network as well
+	if (model_cycles > 0) {
+		printf("device: %.0f cycles per classification (neural network alone: %.0f)\n",
+		       first_stage_cycles + escalation_rate * model_cycles, model_cycles);
+	}
+
+	return 0;
+}
@@ -0,0 +1,66 @@
+#!/bin/sh
+# Host check: the CMSIS-NN kernels (CMSIS_NN build option) give the same model outputs as the TFLM
+# reference kernels. The TFLM host library is built twice from the same sources, with and without
+# TAGS=cmsis-nn (on the host CMSIS-NN uses its portable C code), model_outputs is linked with each
+# and run on the data samples, and the predictions and output values of both are compared.
+# model_outputs fails if the ahead-of-time compiled model (AOT_MODEL) is not bit-exact to the
+# interpreter with the reference or the CMSIS-NN kernels.
+# The host time per Invoke() of both variants is printed; the cycles on the device are printed by
+# the firmware with every prediction (built with and without CMSIS_NN).
+#
+# usage (in this folder, TF_SRC_DIR: tensorflow folder as in CMakeLists.txt, WORK_DIR: folder for
+# the builds and outputs, default cmsis_nn_check, gcc and g++ with 32 bit support are needed):
+#	./cmsis_nn_check.sh $TF_SRC_DIR unseen_data/*/*.CSV
+# returns 1 if the outputs differ (the differing lines are printed), the AOT model differs from the
+# interpreter or no data sample was read
+
+set -e
+
+if [ $# -lt 2 ]; then
+	echo "usage: $0 TF_SRC_DIR [data sample CSV files]" >&2
+	exit 1
+fi
+
+#32 bit with double and int64 aligned as on the target, as the host build of CMakeLists.txt
+#(MEASURE_ARENA) and model_outputs
+host_flags="-m32 -malign-double"
+
+tf_src_dir=$(cd "$1" && pwd)
+shift
+work_dir=$(mkdir -p "${WORK_DIR:-cmsis_nn_check}" && cd "${WORK_DIR:-cmsis_nn_check}" && pwd)
+
+for variant in reference cmsis_nn; do
+	tags=
+	if [ $variant = cmsis_nn ]; then
+		tags=TAGS=cmsis-nn
+	fi
+	gen_dir=$work_dir/$variant/gen
+
+	make -C "$tf_src_dir" -f tensorflow/lite/micro/tools/make/Makefile GENDIR="$gen_dir/" \
+		"CC=gcc $host_flags" "CXX=g++ $host_flags" $tags microlite
+	g++ $host_flags -std=c++11 -O2 -I../src -I"$tf_src_dir" \
+		-I"$tf_src_dir/tensorflow/lite/micro/tools/make/downloads/flatbuffers/include" \
+		model_outputs.cc data_sample.cc ../src/constants.cc ../src/model_raw.cc ../src/model_aot.cc \
+		"$gen_dir/lib/libtensorflow-microlite.a" -o "$work_dir/$variant/model_outputs"
+
+	echo "$variant:"
+	if ! "$work_dir/$variant/model_outputs" "$@" > "$work_dir/$variant/outputs.txt"; then
+		echo "$variant: model_outputs failed" >&2
+		exit 1
+	fi
+done
+
+# one line per data sample and model (g_modelurd, g_model_raw, model_aot)
+samples=$(($(wc -l < "$work_dir/reference/outputs.txt") / 3))
+
+if [ "$samples" -eq 0 ]; then
+	echo "no data sample was read" >&2
+	exit 1
+fi
+
+if ! diff "$work_dir/reference/outputs.txt" "$work_dir/cmsis_nn/outputs.txt"; then
+	echo "CMSIS-NN outputs differ from the reference kernels" >&2
+	exit 1
+fi
+
+echo "$samples data samples: CMSIS-NN outputs are identical to the reference kernels"
@@ -0,0 +1,96 @@
+#include "data_sample.h"
+#include "model_input.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+columns that are no model input: label, time points, old test features and the RSSI quantiles
+(RSSI_QUANTILES build option) unless the model was trained with them (model_input.h)
+*/
+static bool is_feature(const char *name)
+{
+	static const char *const other_columns[] = { "label", "services", "manufacturer_data_lengths" };
+	static const char *const rssi_quantile_columns[] = { "rssi_p10",     "rssi_median",
+							     "rssi_p90",     "avg_rssi_p10",
+							     "avg_rssi_median", "avg_rssi_p90" };
+
+	for (const char *column : other_columns) {
+		if (strcmp(name, column) == 0) {
+			return false;
+		}
+	}
+	for (const char *column : rssi_quantile_columns) {
+		if (!MODEL_INPUT_RSSI_QUANTILES && strcmp(name, column) == 0) {
+			return false;
+		}
+	}
+
+	return strncmp(name, "time_point", 10) != 0;
+}
+
+/*
+read the feature values of a data sample from a CSV file (as written by the firmware)
+columns that are no features (see is_feature()) are skipped
+return false if the file does not contain DATA_ROWS rows of features values
+*/
+bool read_data_sample(const char *path, int features, std::vector<int> *sample)
+{
+	FILE *file = fopen(path, "r");
+
+	if (file == NULL) {
+		return false;
+	}
+
+	char line[4096];
+	std::vector<bool> is_feature_column;
+
+	//header
+	if (fgets(line, sizeof(line), file) != NULL) {
+		for (char *name = strtok(line, ",\r\n"); name != NULL; name = strtok(NULL, ",\r\n")) {
+			while (*name == ' ') {
+				name++;
+			}
+			is_feature_column.push_back(is_feature(name));
+		}
+	}
+
+	sample->clear();
+	while (fgets(line, sizeof(line), file) != NULL) {
+		int column = 0;
+
+		for (char *value = strtok(line, ",\r\n"); value != NULL; value = strtok(NULL, ",\r\n")) {
+			if (column < (int)is_feature_column.size() && is_feature_column[column]) {
+				sample->push_back(atoi(value));
+			}
+			column++;
+		}
+	}
+	fclose(file);
+
+	return (int)sample->size() == features * DATA_ROWS;
+}
+
+/*
+read the label of a data sample from the first column of its first scan
+*/
+std::string read_data_label(const char *path)
+{
+	FILE *file = fopen(path, "r");
+
+	if (file == NULL) {
+		return "";
+	}
+
+	char line[4096];
+	std::string label;
+
+	//header, then the first scan
+	if (fgets(line, sizeof(line), file) != NULL && fgets(line, sizeof(line), file) != NULL) {
+		label = strtok(line, ",\r\n") != NULL ? line : "";
+	}
+	fclose(file);
+
+	return label;
+}
@@ -0,0 +1,22 @@
+/*
+Data samples recorded by the firmware (CSV files with a header line and one line per scan),
+for the host tools.
+*/
+
+#ifndef DATA_SAMPLE_H_
+#define DATA_SAMPLE_H_
+
+#include <string>
+#include <vector>
+
+//scans in a data sample
+#define DATA_ROWS 5
+
+//read the feature values of the DATA_ROWS scans of a data sample (latest scan first)
+//return false if the file does not contain DATA_ROWS rows of features feature values
+bool read_data_sample(const char *path, int features, std::vector<int> *sample);
+
+//label of a data sample (environment in the first column), empty if the file has none
+std::string read_data_label(const char *path);
+
+#endif
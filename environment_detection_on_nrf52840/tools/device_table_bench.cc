@@ -0,0 +1,199 @@
+/*
+Host tool: checks the device table (src/device_table.cc) against std::map with random add, find,
+replace and clear operations, then measures lookups per second of known devices with 50, 150 and
+1000 devices in the table. For comparison the same lookups are measured like before the device
+table: address to string and a linear strcmp() search.
+
+build (in this folder, MAX_DEVICES: largest device count measured):
+	g++ -std=c++14 -O2 -Wall -DMAX_DEVICES=1000 -I../src -Izephyr_stubs device_table_bench.cc \
+		../src/device_table.cc -o device_table_bench
+usage:
+	./device_table_bench
+returns 1 if the table differs from std::map
+*/
+
+#include "device_table.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <map>
+#include <random>
+#include <vector>
+
+//lookups per measurement
+#define LOOKUPS 2000000
+
+static double now_ns(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+static bool operator<(const bt_addr_le_t &a, const bt_addr_le_t &b)
+{
+	return bt_addr_le_cmp(&a, &b) < 0;
+}
+
+static bt_addr_le_t random_addr(std::mt19937 &random)
+{
+	bt_addr_le_t addr;
+
+	addr.type = random() % 2;
+	for (int i = 0; i < (int)sizeof(addr.a.val); i++) {
+		addr.a.val[i] = (uint8_t)random();
+	}
+
+	return addr;
+}
+
+static struct device_table table;
+
+//results of the measured lookups, so they are not optimized away
+static volatile long lookup_sum;
+
+/*
+random operations on the table and on std::map, the results have to be the same
+*/
+static bool check(std::mt19937 &random)
+{
+	//addresses repeat like devices advertising several times per scan
+	std::vector<bt_addr_le_t> pool;
+
+	for (int i = 0; i < 3 * MAX_DEVICES; i++) {
+		pool.push_back(random_addr(random));
+	}
+
+	std::map<bt_addr_le_t, int> expected;
+	std::vector<bt_addr_le_t> addrs;
+
+	device_table_clear(&table);
+
+	for (int op = 0; op < 2000000; op++) {
+		const bt_addr_le_t &addr = pool[random() % pool.size()];
+		auto found = expected.find(addr);
+		int want = found == expected.end() ? -1 : found->second;
+		int action = random() % 1000;
+
+		if (action == 0) {
+			device_table_clear(&table);
+			expected.clear();
+			addrs.clear();
+		} else if (action < 500) {
+			if (device_table_find(&table, &addr) != want) {
+				printf("find differs after %d operations\n", op);
+				return false;
+			}
+		} else if (action < 950 || found != expected.end() || addrs.empty()) {
+			if (want == -1 && (int)addrs.size() < MAX_DEVICES) {
+				want = (int)addrs.size();
+				expected[addr] = want;
+				addrs.push_back(addr);
+			}
+			if (device_table_add(&table, &addr) != want) {
+				printf("add differs after %d operations\n", op);
+				return false;
+			}
+		} else {
+			//replace a device by one that is not in the table (as the eviction does)
+			int index = random() % addrs.size();
+
+			expected.erase(addrs[index]);
+			expected[addr] = index;
+			addrs[index] = addr;
+			device_table_replace(&table, index, &addr);
+		}
+
+		if (table.count != (int)addrs.size()) {
+			printf("count differs after %d operations\n", op);
+			return false;
+		}
+	}
+
+	//every device still has its index
+	for (int i = 0; i < (int)addrs.size(); i++) {
+		if (device_table_find(&table, &addrs[i]) != i) {
+			printf("device %d lost\n", i);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*
+lookups of known devices per second with the hash table and with the string search
+*/
+static void bench(std::mt19937 &random, int devices)
+{
+	std::vector<bt_addr_le_t> addrs;
+	std::vector<int> order;
+	static char strings[MAX_DEVICES][BT_ADDR_LE_STR_LEN];
+
+	device_table_clear(&table);
+	for (int i = 0; i < devices; i++) {
+		addrs.push_back(random_addr(random));
+		device_table_add(&table, &addrs[i]);
+		bt_addr_le_to_str(&addrs[i], strings[i], BT_ADDR_LE_STR_LEN);
+	}
+	for (int i = 0; i < LOOKUPS; i++) {
+		order.push_back(random() % devices);
+	}
+
+	long sum = 0;
+	double start = now_ns();
+
+	for (int i = 0; i < LOOKUPS; i++) {
+		sum += device_table_add(&table, &addrs[order[i]]);
+	}
+
+	double table_ns = now_ns() - start;
+
+	//before: bt_addr_le_to_str() and getIndex() for every advertisement
+	int string_lookups = LOOKUPS / 20;
+
+	start = now_ns();
+	for (int i = 0; i < string_lookups; i++) {
+		char result[BT_ADDR_LE_STR_LEN];
+
+		bt_addr_le_to_str(&addrs[order[i]], result, BT_ADDR_LE_STR_LEN);
+		for (int j = 0; j < devices; j++) {
+			if (!strcmp(strings[j], result)) {
+				sum += j;
+				break;
+			}
+		}
+	}
+
+	double string_ns = now_ns() - start;
+
+	lookup_sum = sum;
+	printf("%4d devices: hash table %6.1f M lookups/s (%5.1f ns), string search %6.2f M lookups/s (%7.1f ns)\n",
+	       devices, LOOKUPS / table_ns * 1000, table_ns / LOOKUPS,
+	       string_lookups / string_ns * 1000, string_ns / string_lookups);
+}
+
+int main(void)
+{
+	std::mt19937 random(1);
+
+	if (!check(random)) {
+		return 1;
+	}
+	printf("device table matches std::map (MAX_DEVICES %d, %d hash slots)\n", MAX_DEVICES,
+	       DEVICE_TABLE_SLOTS);
+
+	const int counts[] = { 50, 150, 1000 };
+
+	for (int devices : counts) {
+		if (devices <= MAX_DEVICES) {
+			bench(random, devices);
+		}
+	}
+
+	return 0;
+}
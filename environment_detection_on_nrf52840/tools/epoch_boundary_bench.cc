@@ -0,0 +1,192 @@
+/*
+Host tool: measures the cost at the boundary of two scan epochs (switchEpoch() and processing of
+the epoch that ended) with 50 to 1000 devices: scan_epoch_reset() of the next epoch and
+scan_epoch_features() of the ended epoch, which compares its devices with the ones of the epoch
+before (new and lost devices). Half of the devices are in both epochs.
+For comparison the same is measured like before the device table: every address string copied
+to old_devices and the two nested strcmp() loops for new and lost devices.
+
+build (in this folder, MAX_DEVICES: largest device count measured):
+	g++ -std=c++14 -O2 -Wall -DMAX_DEVICES=1000 -I../src -Izephyr_stubs \
+		epoch_boundary_bench.cc ../src/scan_epoch.cc ../src/device_table.cc \
+		../src/beacon_stats.cc ../src/histogram.cc ../src/hll.cc ../src/ad_iter.cc \
+		-o epoch_boundary_bench
+usage:
+	./epoch_boundary_bench
+returns 1 if new and lost devices differ from the nested loops
+*/
+
+#include "scan_epoch.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <random>
+#include <vector>
+
+//epoch boundaries per measurement
+#define BOUNDARIES 200
+
+//beacons per device and epoch
+#define BEACONS 5
+
+static struct scan_epoch previous;
+static struct scan_epoch ended;
+static struct scan_epoch next;
+
+static char devices[MAX_DEVICES][BT_ADDR_LE_STR_LEN];
+static char old_devices[MAX_DEVICES][BT_ADDR_LE_STR_LEN];
+static char old_strings[MAX_DEVICES][BT_ADDR_LE_STR_LEN]; //devices of the epoch before
+
+//results of the measured boundaries, so they are not optimized away
+static volatile long feature_sum;
+
+static double now_ns(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+/*
+epoch with a beacon of every device per round, with TxPower, a service and manufacturer data
+*/
+static void fill_epoch(struct scan_epoch *epoch, const std::vector<bt_addr_le_t> &addrs)
+{
+	static const uint8_t data[] = { 2, 0x0a, 0xf4, 3, 0x03, 0x6f, 0xfd,
+					5, 0xff, 0x4c, 0x00, 0x10, 0x05 };
+	struct adv_record record;
+
+	memset(&record, 0, sizeof(record));
+	record.data_len = sizeof(data);
+	memcpy(record.data, data, sizeof(data));
+
+	scan_epoch_reset(epoch, 0);
+	for (int b = 0; b < BEACONS; b++) {
+		for (int i = 0; i < (int)addrs.size(); i++) {
+			bt_addr_le_copy(&record.addr, &addrs[i]);
+			record.rssi = -40 - (i + b) % 50;
+			record.timestamp += 1000;
+			scan_epoch_add(epoch, &record);
+		}
+	}
+}
+
+/*
+new and lost devices as computed before the device table
+*/
+static void string_diff(int device_count, int old_device_count, int *new_device_count,
+			int *lost_device_count)
+{
+	*new_device_count = 0;
+	*lost_device_count = 0;
+
+	for (int k = 0; k < device_count; k++) {
+		for (int l = 0; l < old_device_count; l++) {
+			if (!strcmp(devices[k], old_devices[l])) {
+				break;
+			}
+			if (l == old_device_count - 1) {
+				(*new_device_count)++;
+			}
+		}
+	}
+
+	for (int k = 0; k < old_device_count; k++) {
+		for (int l = 0; l < device_count; l++) {
+			if (!strcmp(old_devices[k], devices[l])) {
+				break;
+			}
+			if (l == device_count - 1) {
+				(*lost_device_count)++;
+			}
+		}
+	}
+}
+
+static bt_addr_le_t random_addr(std::mt19937 &random)
+{
+	bt_addr_le_t addr;
+
+	addr.type = random() % 2;
+	for (int i = 0; i < (int)sizeof(addr.a.val); i++) {
+		addr.a.val[i] = (uint8_t)random();
+	}
+
+	return addr;
+}
+
+static bool bench(std::mt19937 &random, int device_count)
+{
+	//half of the devices are in both epochs
+	std::vector<bt_addr_le_t> old_addrs;
+	std::vector<bt_addr_le_t> addrs;
+
+	for (int i = 0; i < device_count; i++) {
+		old_addrs.push_back(random_addr(random));
+		addrs.push_back(i % 2 == 0 ? old_addrs[i] : random_addr(random));
+	}
+	fill_epoch(&previous, old_addrs);
+	fill_epoch(&ended, addrs);
+
+	int features[DATA_LINE_LENGTH];
+	long sum = 0;
+	double start = now_ns();
+
+	for (int i = 0; i < BOUNDARIES; i++) {
+		scan_epoch_reset(&next, i);
+		scan_epoch_features(&ended, &previous, features);
+		sum += features[1] + features[2];
+	}
+
+	double epoch_ns = (now_ns() - start) / BOUNDARIES;
+
+	//before: address strings copied to old_devices, nested strcmp() loops
+	for (int i = 0; i < device_count; i++) {
+		bt_addr_le_to_str(&addrs[i], devices[i], BT_ADDR_LE_STR_LEN);
+		bt_addr_le_to_str(&old_addrs[i], old_strings[i], BT_ADDR_LE_STR_LEN);
+	}
+
+	int new_device_count = 0;
+	int lost_device_count = 0;
+
+	start = now_ns();
+	for (int i = 0; i < BOUNDARIES; i++) {
+		for (int k = 0; k < device_count; k++) {
+			strcpy(old_devices[k], old_strings[k]);
+		}
+		string_diff(device_count, device_count, &new_device_count, &lost_device_count);
+		sum += new_device_count + lost_device_count;
+	}
+
+	double string_ns = (now_ns() - start) / BOUNDARIES;
+
+	feature_sum = sum;
+
+	bool ok = features[1] == lost_device_count && features[2] == new_device_count &&
+		  features[0] == device_count;
+
+	printf("%4d devices (%d new, %d lost): scan epoch %8.2f us, string diff %9.2f us per boundary%s\n",
+	       device_count, features[2], features[1], epoch_ns / 1000, string_ns / 1000,
+	       ok ? "" : ": new or lost devices differ");
+
+	return ok;
+}
+
+int main(void)
+{
+	std::mt19937 random(1);
+	const int counts[] = { 50, 150, 500, 1000 };
+	bool ok = true;
+
+	for (int devices : counts) {
+		if (devices <= MAX_DEVICES) {
+			ok &= bench(random, devices);
+		}
+	}
+
+	return ok ? 0 : 1;
+}
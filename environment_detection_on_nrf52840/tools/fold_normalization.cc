@@ -0,0 +1,278 @@
+/*
+Host tool: folds the normalization of the feature values (mean_list and std_list of constants.cc)
+into the input of the pretrained neural network (g_modelurd) for the raw input mode (RAW_INPUT).
+
+The model is int8-quantized internally, its first op quantizes the normalized float input with a
+single scale and zero point. Normalization and this quantization are combined into a scale and a
+zero point per feature, so the firmware quantizes the raw feature values straight into the int8
+input. The Quantize op is removed from the model, the int8 tensor becomes the model input.
+The Dequantize op at the end of the model is removed as well, the int8 output of Softmax becomes the
+model output (the firmware takes the argmax of the int8 values).
+The weights of the model are not changed (raw feature values from 0 to about 10^5 can not share
+one int8 input quantization, so folding into the first fully connected layer is not possible).
+
+The generated model_raw.cc has to be regenerated whenever constants.cc is exported again. With
+--check it is not written but compared to the generated source, the build runs this check (see
+CMakeLists.txt) and fails if model_raw.cc is not generated from the current constants.cc.
+
+build (in this folder):
+	g++ -std=c++14 -O2 -I../src fold_normalization.cc tflite_reader.cc data_sample.cc \
+		../src/constants.cc -o fold_normalization
+usage:
+	./fold_normalization ../src/model_raw.cc [data sample CSV files]
+	./fold_normalization --check ../src/model_raw.cc
+the data samples (e.g. unzipped data/unseen_data.zip) are used to compare the int8 input of both
+models, the rest of the models is identical (up to the removed Dequantize op)
+*/
+
+#include "constants.h"
+#include "tflite_reader.h"
+#include "data_sample.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+//per feature quantization of the raw feature values
+struct raw_quantization {
+	std::vector<float> scale;
+	std::vector<float> zero_point;
+};
+
+/*
+quantize a value like the Quantize op of TFLM (round half away from zero)
+*/
+static int8_t quantize(float value, float scale, int zero_point)
+{
+	int q = (int)roundf(value / scale) + zero_point;
+
+	return (int8_t)(q < -128 ? -128 : (q > 127 ? 127 : q));
+}
+
+/*
+quantize a raw feature value like the firmware in raw input mode
+*/
+static int8_t quantize_raw(int value, float scale, float zero_point)
+{
+	int q = (int)roundf(value * scale + zero_point);
+
+	return (int8_t)(q < -128 ? -128 : (q > 127 ? 127 : q));
+}
+
+/*
+write the patched model and the per feature quantization as C++ source
+*/
+static void write_source(FILE *file, const std::vector<uint8_t> &model,
+			 const struct raw_quantization &raw)
+{
+	fprintf(file, "//generated by tools/fold_normalization from constants.cc, do not edit\n");
+	fprintf(file, "#include \"constants.h\"\n");
+
+	fprintf(file, "const float raw_input_scale[] = {");
+	for (size_t i = 0; i < raw.scale.size(); i++) {
+		fprintf(file, "%s%.9g", i != 0 ? ", " : "", raw.scale[i]);
+	}
+	fprintf(file, "};\n");
+
+	fprintf(file, "const float raw_input_zero_point[] = {");
+	for (size_t i = 0; i < raw.zero_point.size(); i++) {
+		fprintf(file, "%s%.9g", i != 0 ? ", " : "", raw.zero_point[i]);
+	}
+	fprintf(file, "};\n");
+
+	fprintf(file, "alignas(16) const unsigned char g_model_raw[] = {");
+	for (size_t i = 0; i < model.size(); i++) {
+		fprintf(file, "%s0x%02x", i == 0 ? "\n  " : (i % 12 == 0 ? ",\n  " : ", "), model[i]);
+	}
+	fprintf(file, "\n};\n");
+	fprintf(file, "const int g_model_raw_len = %d;\n", (int)model.size());
+}
+
+/*
+read a whole file, empty if it can not be read
+*/
+static std::string read_file(FILE *file)
+{
+	std::string content;
+	char buffer[1024];
+	size_t len;
+
+	while ((len = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+		content.append(buffer, len);
+	}
+
+	return content;
+}
+
+/*
+compare the generated source (written to a temporary file) with the file at path
+*/
+static bool same_source(FILE *generated, const char *path)
+{
+	FILE *file = fopen(path, "r");
+
+	if (file == NULL) {
+		return false;
+	}
+
+	std::string current = read_file(file);
+
+	fclose(file);
+	rewind(generated);
+
+	return read_file(generated) == current;
+}
+
+int main(int argc, char **argv)
+{
+	bool check = argc == 3 && strcmp(argv[1], "--check") == 0;
+
+	if (argc < 2 || (strcmp(argv[1], "--check") == 0 && !check)) {
+		fprintf(stderr, "usage: %s [--check] model_raw.cc [data sample CSV files]\n", argv[0]);
+		return 1;
+	}
+
+	const char *path = check ? argv[2] : argv[1];
+
+	std::vector<uint8_t> model(g_modelurd, g_modelurd + g_model_len);
+	struct tflite_model tflite = { model.data(), model.size() };
+
+	//the first op has to quantize the float model input to int8
+	struct tflite_operator quantize_op;
+
+	if (!tflite_get_operator(&tflite, 0, &quantize_op) ||
+	    quantize_op.builtin_code != TFLITE_BUILTIN_QUANTIZE || quantize_op.inputs.size() != 1 ||
+	    quantize_op.inputs[0] != tflite_inputs(&tflite)[0]) {
+		fprintf(stderr, "first op of the model does not quantize the model input\n");
+		return 1;
+	}
+
+	struct tflite_tensor input;
+
+	if (!tflite_get_tensor(&tflite, quantize_op.outputs[0], &input) || input.type != TFLITE_INT8 ||
+	    input.scale.size() != 1) {
+		fprintf(stderr, "model input is not quantized to int8 with one scale\n");
+		return 1;
+	}
+
+	int features = tflite_elements(&input) / DATA_ROWS;
+	float input_scale = input.scale[0];
+	int input_zero_point = (int)input.zero_point[0];
+
+	if (!check) {
+		printf("input: %d features, scale %g, zero point %d\n", features, input_scale,
+		       input_zero_point);
+	}
+
+	//normalized value: (raw - mean) / std, quantized: normalized / input_scale + input_zero_point
+	//features without deviation are normalized to 0
+	struct raw_quantization raw;
+
+	for (int i = 0; i < features; i++) {
+		double scale = 0;
+
+		if (std_list[i] != 0) {
+			scale = 1.0 / ((double)std_list[i] * input_scale);
+		}
+		raw.scale.push_back((float)scale);
+		raw.zero_point.push_back((float)(input_zero_point - mean_list[i] * scale));
+	}
+
+	//the last op has to dequantize the int8 output to the float model output
+	struct tflite_operator dequantize_op;
+	struct tflite_tensor output;
+
+	if (!tflite_get_operator(&tflite, tflite_operator_count(&tflite) - 1, &dequantize_op) ||
+	    dequantize_op.builtin_code != TFLITE_BUILTIN_DEQUANTIZE ||
+	    dequantize_op.inputs.size() != 1 ||
+	    dequantize_op.outputs[0] != tflite_outputs(&tflite)[0] ||
+	    !tflite_get_tensor(&tflite, dequantize_op.inputs[0], &output) ||
+	    output.type != TFLITE_INT8) {
+		fprintf(stderr, "last op of the model does not dequantize the int8 model output\n");
+		return 1;
+	}
+
+	//the int8 tensors become model input and output, the Quantize and Dequantize ops are removed
+	if (!tflite_set_input(&tflite, 0, quantize_op.outputs[0]) ||
+	    !tflite_set_output(&tflite, 0, dequantize_op.inputs[0]) ||
+	    !tflite_remove_last_operator(&tflite) || !tflite_remove_first_operator(&tflite)) {
+		fprintf(stderr, "model could not be patched\n");
+		return 1;
+	}
+
+	FILE *file = check ? tmpfile() : fopen(path, "w");
+
+	if (file == NULL) {
+		fprintf(stderr, "%s could not be written\n", check ? "temporary file" : path);
+		return 1;
+	}
+	write_source(file, model, raw);
+
+	if (check) {
+		bool same = same_source(file, path);
+
+		fclose(file);
+		if (!same) {
+			fprintf(stderr, "%s is not generated from the current constants.cc, run tools/fold_normalization\n",
+				path);
+			return 1;
+		}
+
+		return 0;
+	}
+	fclose(file);
+	printf("written %s (%d bytes model)\n", path, (int)model.size());
+
+	//compare the int8 input of the float input model and the raw input model
+	int samples = 0;
+	int different_samples = 0;
+	int different_values = 0;
+	int max_difference = 0;
+	std::vector<int> sample;
+
+	for (int f = 2; f < argc; f++) {
+		if (!read_data_sample(argv[f], features, &sample)) {
+			continue;
+		}
+		samples++;
+
+		bool different = false;
+
+		for (int i = 0; i < features * DATA_ROWS; i++) {
+			int feature = i % features;
+			float normalized = 0;
+
+			if (std_list[feature] != 0) {
+				normalized = (sample[i] - mean_list[feature]) / std_list[feature];
+			}
+
+			int8_t expected = quantize(normalized, input_scale, input_zero_point);
+			int8_t actual =
+				quantize_raw(sample[i], raw.scale[feature], raw.zero_point[feature]);
+			int difference = abs(expected - actual);
+
+			if (difference != 0) {
+				different = true;
+				different_values++;
+				if (difference > max_difference) {
+					max_difference = difference;
+				}
+			}
+		}
+		if (different) {
+			different_samples++;
+		}
+	}
+
+	if (samples != 0) {
+		printf("data samples: %d, with different input: %d, different values: %d of %d, max difference: %d\n",
+		       samples, different_samples, different_values, samples * features * DATA_ROWS,
+		       max_difference);
+	}
+
+	return 0;
+}
@@ -0,0 +1,124 @@
+/*
+Host tool: estimation error of the HyperLogLog sketch (src/hll.cc) against exact counts on
+synthetic traces. Every trace is a scan with a given amount of distinct devices (random
+addresses) that advertise 1 to 10 times, and the scan after it, in which half of the devices are
+still there and as many are new. For every amount of devices the relative error of the device
+count (hll_estimate()) and of the new devices from the union of both sketches
+(hll_union_estimate(), as in scan_epoch_features()) is reported over many traces: mean (bias),
+root mean square and max.
+
+build (in this folder):
+	g++ -std=c++14 -O2 -Wall -I../src -Izephyr_stubs hll_error.cc ../src/hll.cc -o hll_error
+usage:
+	./hll_error
+returns 1 if the RMS error of the device count is larger than 1.5 times the standard error
+(1.04 / sqrt(HLL_REGISTERS), about 6.5%)
+*/
+
+#include "hll.h"
+
+#include <sys/util.h>
+
+#include <math.h>
+#include <stdio.h>
+
+#include <random>
+#include <vector>
+
+#define TRACES 500
+
+struct error_stats {
+	double sum;
+	double square_sum;
+	double max;
+};
+
+static void add_error(struct error_stats *stats, double estimate, double exact)
+{
+	double error = (estimate - exact) / exact;
+
+	stats->sum += error;
+	stats->square_sum += error * error;
+	stats->max = fmax(stats->max, fabs(error));
+}
+
+static bt_addr_le_t random_addr(std::mt19937 &random)
+{
+	bt_addr_le_t addr;
+
+	addr.type = BT_ADDR_LE_RANDOM;
+	for (int i = 0; i < (int)sizeof(addr.a.val); i++) {
+		addr.a.val[i] = (uint8_t)random();
+	}
+
+	return addr;
+}
+
+/*
+add every device 1 to 10 times
+*/
+static void add_devices(struct hll *hll, const std::vector<bt_addr_le_t> &addrs,
+			std::mt19937 &random)
+{
+	for (const bt_addr_le_t &addr : addrs) {
+		int beacons = 1 + random() % 10;
+
+		for (int b = 0; b < beacons; b++) {
+			hll_add(hll, &addr);
+		}
+	}
+}
+
+int main(void)
+{
+	const int counts[] = { 10, 50, 150, 300, 1000, 3000, 10000 };
+	double standard_error = 1.04 / sqrt(HLL_REGISTERS);
+	std::mt19937 random(1);
+	bool ok = true;
+
+	printf("%d registers (%d bytes), standard error %.1f%%, %d traces per device count\n",
+	       HLL_REGISTERS, (int)sizeof(struct hll), 100 * standard_error, TRACES);
+	printf("devices | device count: bias    rms    max | new devices: bias    rms    max\n");
+
+	for (int devices : counts) {
+		struct error_stats count_error = {};
+		struct error_stats new_error = {};
+
+		for (int t = 0; t < TRACES; t++) {
+			std::vector<bt_addr_le_t> scan;
+			std::vector<bt_addr_le_t> next_scan;
+
+			for (int i = 0; i < devices; i++) {
+				scan.push_back(random_addr(random));
+				next_scan.push_back(i % 2 == 0 ? scan[i] : random_addr(random));
+			}
+
+			struct hll hll;
+			struct hll next_hll;
+
+			hll_clear(&hll);
+			hll_clear(&next_hll);
+			add_devices(&hll, scan, random);
+			add_devices(&next_hll, next_scan, random);
+
+			//new devices as in scan_epoch_features()
+			int count = hll_estimate(&hll);
+			int next_count = hll_estimate(&next_hll);
+			int common = count + next_count - hll_union_estimate(&hll, &next_hll);
+
+			common = MAX(MIN(common, MIN(count, next_count)), 0);
+			add_error(&count_error, count, devices);
+			add_error(&new_error, next_count - common, devices / 2);
+		}
+
+		double count_rms = sqrt(count_error.square_sum / TRACES);
+
+		printf("%7d | %19.1f%% %5.1f%% %5.1f%% | %18.1f%% %5.1f%% %5.1f%%\n", devices,
+		       100 * count_error.sum / TRACES, 100 * count_rms, 100 * count_error.max,
+		       100 * new_error.sum / TRACES, 100 * sqrt(new_error.square_sum / TRACES),
+		       100 * new_error.max);
+		ok &= count_rms <= 1.5 * standard_error;
+	}
+
+	return ok ? 0 : 1;
+}
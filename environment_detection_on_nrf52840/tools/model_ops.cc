@@ -0,0 +1,184 @@
+/*
+Host tool: generates src/model_ops.h with the builtin ops used by the models (g_modelurd of
+constants.cc and g_model_raw of model_raw.cc). The firmware registers exactly these ops in a
+MicroMutableOpResolver instead of linking all kernels with the AllOpsResolver.
+
+With --check the header is not written but compared to the models, the build runs this check
+(see CMakeLists.txt) and fails if a model needs an op that is not registered.
+
+build (in this folder):
+	g++ -std=c++14 -O2 -I../src model_ops.cc tflite_reader.cc ../src/constants.cc \
+		../src/model_raw.cc -o model_ops
+usage:
+	./model_ops ../src/model_ops.h
+	./model_ops --check ../src/model_ops.h
+*/
+
+#include "constants.h"
+#include "tflite_reader.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+//names of the Add...() methods of MicroMutableOpResolver for the builtin operators
+struct op_name {
+	int builtin_code;
+	const char *name;
+};
+
+static const struct op_name op_names[] = {
+	{ TFLITE_BUILTIN_ADD, "Add" },
+	{ TFLITE_BUILTIN_AVERAGE_POOL_2D, "AveragePool2D" },
+	{ TFLITE_BUILTIN_CONCATENATION, "Concatenation" },
+	{ TFLITE_BUILTIN_CONV_2D, "Conv2D" },
+	{ TFLITE_BUILTIN_DEPTHWISE_CONV_2D, "DepthwiseConv2D" },
+	{ TFLITE_BUILTIN_DEQUANTIZE, "Dequantize" },
+	{ TFLITE_BUILTIN_FULLY_CONNECTED, "FullyConnected" },
+	{ TFLITE_BUILTIN_LOGISTIC, "Logistic" },
+	{ TFLITE_BUILTIN_MAX_POOL_2D, "MaxPool2D" },
+	{ TFLITE_BUILTIN_MUL, "Mul" },
+	{ TFLITE_BUILTIN_RELU, "Relu" },
+	{ TFLITE_BUILTIN_RELU6, "Relu6" },
+	{ TFLITE_BUILTIN_RESHAPE, "Reshape" },
+	{ TFLITE_BUILTIN_SOFTMAX, "Softmax" },
+	{ TFLITE_BUILTIN_TANH, "Tanh" },
+	{ TFLITE_BUILTIN_QUANTIZE, "Quantize" },
+};
+
+//models of the firmware and the prefix of their macros
+struct model {
+	const char *name;
+	const char *prefix;
+	const unsigned char *data;
+	int len;
+};
+
+static const char *find_op_name(int builtin_code)
+{
+	for (size_t i = 0; i < sizeof(op_names) / sizeof(op_names[0]); i++) {
+		if (op_names[i].builtin_code == builtin_code) {
+			return op_names[i].name;
+		}
+	}
+
+	return NULL;
+}
+
+/*
+append the op count and op list macros of a model to header
+only the ops used by the operators of the model are listed (once, in the order of first use)
+return false if an op is not known
+*/
+static bool add_model(const struct model *model, std::string *header)
+{
+	std::vector<uint8_t> data(model->data, model->data + model->len);
+	struct tflite_model tflite = { data.data(), data.size() };
+	std::vector<int> codes;
+
+	for (int i = 0; i < tflite_operator_count(&tflite); i++) {
+		struct tflite_operator op;
+
+		if (!tflite_get_operator(&tflite, i, &op)) {
+			fprintf(stderr, "%s: op %d could not be read\n", model->name, i);
+			return false;
+		}
+
+		bool listed = false;
+
+		for (size_t j = 0; j < codes.size(); j++) {
+			listed = listed || codes[j] == op.builtin_code;
+		}
+		if (!listed) {
+			codes.push_back(op.builtin_code);
+		}
+	}
+
+	char line[256];
+
+	snprintf(line, sizeof(line), "\n//%s\n#define %s_COUNT %d\n#define %s(OP)", model->name,
+		 model->prefix, (int)codes.size(), model->prefix);
+	header->append(line);
+
+	for (size_t i = 0; i < codes.size(); i++) {
+		const char *name = find_op_name(codes[i]);
+
+		if (name == NULL) {
+			fprintf(stderr, "%s: builtin op %d is not known, add it to op_names\n",
+				model->name, codes[i]);
+			return false;
+		}
+		snprintf(line, sizeof(line), " OP(%s)", name);
+		header->append(line);
+	}
+	header->append("\n");
+
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	bool check = argc == 3 && strcmp(argv[1], "--check") == 0;
+
+	if (argc != 2 && !check) {
+		fprintf(stderr, "usage: %s [--check] model_ops.h\n", argv[0]);
+		return 1;
+	}
+
+	const char *path = argv[argc - 1];
+	const struct model models[] = {
+		{ "g_modelurd", "MODEL_OPS", g_modelurd, g_model_len },
+		{ "g_model_raw (RAW_INPUT)", "MODEL_RAW_OPS", g_model_raw, g_model_raw_len },
+	};
+
+	std::string header =
+		"//generated by tools/model_ops from the models in constants.cc and model_raw.cc, do not edit\n"
+		"//builtin ops used by the models: OP(name) for every MicroMutableOpResolver::Add<name>()\n"
+		"\n"
+		"#ifndef MODEL_OPS_H_\n"
+		"#define MODEL_OPS_H_\n";
+
+	for (size_t i = 0; i < sizeof(models) / sizeof(models[0]); i++) {
+		if (!add_model(&models[i], &header)) {
+			return 1;
+		}
+	}
+	header.append("\n#endif\n");
+
+	if (check) {
+		std::string current;
+		FILE *file = fopen(path, "r");
+
+		if (file != NULL) {
+			char buffer[1024];
+			size_t len;
+
+			while ((len = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+				current.append(buffer, len);
+			}
+			fclose(file);
+		}
+
+		if (current != header) {
+			fprintf(stderr, "%s does not match the ops of the models, run tools/model_ops\n",
+				path);
+			return 1;
+		}
+
+		return 0;
+	}
+
+	FILE *file = fopen(path, "w");
+
+	if (file == NULL) {
+		fprintf(stderr, "%s could not be written\n", path);
+		return 1;
+	}
+	fputs(header.c_str(), file);
+	fclose(file);
+	printf("written %s\n", path);
+
+	return 0;
+}
@@ -0,0 +1,180 @@
+/*
+Host tool: runs the models (g_modelurd and the RAW_INPUT g_model_raw) with TFLM on data samples and
+prints the prediction and all output values, one line per data sample and model.
+The ahead-of-time compiled model (AOT_MODEL, model_aot.cc) runs on the same int8 input as
+g_model_raw, its output values have to be bit-exact to the ones of the interpreter.
+
+It is built twice, with a host build of TFLM with the reference kernels and with the CMSIS-NN
+kernels (CMSIS_NN build option, on the host CMSIS-NN uses its portable C code). Both outputs
+have to be identical, cmsis_nn_check.sh builds both and compares them. The host time per Invoke()
+of both models is printed to stderr.
+
+build (in this folder, TF_SRC_DIR: tensorflow folder, GENDIR: gen folder of the TFLM host build,
+e.g. linux_x86_32 and linux_x86_32_cmsis_nn as built by CMakeLists.txt with "CC=gcc -m32 -malign-double"
+"CXX=g++ -m32 -malign-double"):
+	g++ -m32 -malign-double -std=c++11 -O2 -I../src -I$TF_SRC_DIR \
+		-I$TF_SRC_DIR/tensorflow/lite/micro/tools/make/downloads/flatbuffers/include \
+		model_outputs.cc data_sample.cc ../src/constants.cc ../src/model_raw.cc \
+		../src/model_aot.cc $GENDIR/lib/libtensorflow-microlite.a -o model_outputs
+usage:
+	./model_outputs [data sample CSV files] > outputs.txt
+	diff reference.txt cmsis_nn.txt
+returns 1 if the output values of the AOT model differ from the ones of g_model_raw
+*/
+
+#include "constants.h"
+#include "model_ops.h"
+#include "data_sample.h"
+#include "model_aot.h"
+
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <vector>
+
+#define ARENA_SIZE (64 * 1024)
+
+alignas(16) static uint8_t arena[ARENA_SIZE];
+alignas(16) static uint8_t raw_arena[ARENA_SIZE];
+
+static double now_ns(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+/*
+prediction as in loop(): index of the highest output value, -1 if all are 0
+*/
+template <typename T> static int prediction(const T *values, int count, T zero)
+{
+	int index = -1;
+	T max_value = zero;
+
+	for (int i = 0; i < count; i++) {
+		if (values[i] > max_value) {
+			max_value = values[i];
+			index = i;
+		}
+	}
+
+	return index;
+}
+
+int main(int argc, char **argv)
+{
+	static tflite::MicroErrorReporter error_reporter;
+
+#define ADD_OP(name) resolver.Add##name();
+	static tflite::MicroMutableOpResolver<MODEL_OPS_COUNT> resolver;
+	MODEL_OPS(ADD_OP)
+#undef ADD_OP
+#define ADD_OP(name) raw_resolver.Add##name();
+	static tflite::MicroMutableOpResolver<MODEL_RAW_OPS_COUNT> raw_resolver;
+	MODEL_RAW_OPS(ADD_OP)
+#undef ADD_OP
+
+	tflite::MicroInterpreter interpreter(tflite::GetModel(g_modelurd), resolver, arena,
+					     ARENA_SIZE, &error_reporter);
+	tflite::MicroInterpreter raw_interpreter(tflite::GetModel(g_model_raw), raw_resolver,
+						 raw_arena, ARENA_SIZE, &error_reporter);
+
+	if (interpreter.AllocateTensors() != kTfLiteOk ||
+	    raw_interpreter.AllocateTensors() != kTfLiteOk) {
+		fprintf(stderr, "tensor allocation failed\n");
+		return 1;
+	}
+
+	TfLiteTensor *input = interpreter.input(0);
+	TfLiteTensor *output = interpreter.output(0);
+	TfLiteTensor *raw_input = raw_interpreter.input(0);
+	TfLiteTensor *raw_output = raw_interpreter.output(0);
+	int features = input->dims->data[1] / DATA_ROWS;
+	std::vector<int> sample;
+	int samples = 0;
+	int aot_different = 0;
+	double invoke_ns = 0;
+	double raw_invoke_ns = 0;
+
+	for (int f = 1; f < argc; f++) {
+		if (!read_data_sample(argv[f], features, &sample)) {
+			continue;
+		}
+
+		//normalized float input and int8 raw input as in prepare_data() and quantize_data()
+		for (int i = 0; i < features * DATA_ROWS; i++) {
+			int feature = i % features;
+			int value = (int)roundf(sample[i] * raw_input_scale[feature] +
+						raw_input_zero_point[feature]);
+
+			input->data.f[i] = 0;
+			if (std_list[feature] != 0) {
+				input->data.f[i] = (sample[i] - mean_list[feature]) / std_list[feature];
+			}
+			raw_input->data.int8[i] = (int8_t)(value < -128 ? -128 : (value > 127 ? 127 : value));
+		}
+
+		double start = now_ns();
+		TfLiteStatus status = interpreter.Invoke();
+		double invoked = now_ns();
+		TfLiteStatus raw_status = raw_interpreter.Invoke();
+
+		raw_invoke_ns += now_ns() - invoked;
+		invoke_ns += invoked - start;
+		samples++;
+
+		if (status != kTfLiteOk || raw_status != kTfLiteOk) {
+			fprintf(stderr, "%s: Invoke() failed\n", argv[f]);
+			return 1;
+		}
+
+		printf("%s g_modelurd %d", argv[f],
+		       prediction(output->data.f, available_env_len, 0.0f));
+		for (int i = 0; i < available_env_len; i++) {
+			printf(" %.9g", output->data.f[i]);
+		}
+		printf("\n");
+
+		printf("%s g_model_raw %d", argv[f],
+		       prediction(raw_output->data.int8, available_env_len,
+				  (int8_t)raw_output->params.zero_point));
+		for (int i = 0; i < available_env_len; i++) {
+			printf(" %d", raw_output->data.int8[i]);
+		}
+		printf("\n");
+
+		int aot_index = classify(raw_input->data.int8, NULL);
+		const int8_t *aot_output = classify_output();
+		bool different = false;
+
+		printf("%s model_aot %d", argv[f], aot_index);
+		for (int i = 0; i < available_env_len; i++) {
+			printf(" %d", aot_output[i]);
+			different |= aot_output[i] != raw_output->data.int8[i];
+		}
+		printf("\n");
+		aot_different += different;
+	}
+
+	int invokes = samples > 0 ? samples : 1;
+
+	fprintf(stderr, "%d data samples, Invoke() on the host: g_modelurd %.1f us, g_model_raw %.1f us\n",
+		samples, invoke_ns / invokes / 1000, raw_invoke_ns / invokes / 1000);
+
+	if (aot_different != 0) {
+		fprintf(stderr, "%d data samples: output values of model_aot differ from g_model_raw\n",
+			aot_different);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,173 @@
+/*
+Host tool: cost of the RSSI quantiles (RSSI_QUANTILES build option) with 50, 150 and 1000 devices
+that advertise 10 times per epoch:
+- per advertisement: scan_epoch_add() with the quantiles and the histogram_add() of the RSSI it
+  adds to it (the part that is only done with RSSI_QUANTILES)
+- per epoch: scan_epoch_rssi_quantiles()
+- RAM: RSSI histogram of every epoch buffer
+The quantiles of the RSSI of all beacons are checked against the sorted values (nearest rank).
+
+build (in this folder, MAX_DEVICES: largest device count measured):
+	g++ -std=c++14 -O2 -Wall -DRSSI_QUANTILES -DMAX_DEVICES=1000 -I../src -Izephyr_stubs \
+		rssi_quantile_bench.cc ../src/scan_epoch.cc ../src/device_table.cc \
+		../src/beacon_stats.cc ../src/histogram.cc ../src/hll.cc ../src/ad_iter.cc \
+		-o rssi_quantile_bench
+usage:
+	./rssi_quantile_bench
+returns 1 if a quantile differs from the sorted values
+*/
+
+#include "scan_epoch.h"
+
+#include <sys/util.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#ifndef RSSI_QUANTILES
+#error "build with -DRSSI_QUANTILES"
+#endif
+
+//advertisements per device and epoch, epochs per measurement
+#define BEACONS 10
+#define EPOCHS 100
+
+static struct scan_epoch epoch;
+static struct histogram rssi;
+
+//results of the measurements, so they are not optimized away
+static volatile long quantile_sum;
+
+static double now_ns(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+static bt_addr_le_t random_addr(std::mt19937 &random)
+{
+	bt_addr_le_t addr;
+
+	addr.type = random() % 2;
+	for (int i = 0; i < (int)sizeof(addr.a.val); i++) {
+		addr.a.val[i] = (uint8_t)random();
+	}
+
+	return addr;
+}
+
+/*
+nearest rank of the sorted values, as histogram_quantile()
+*/
+static int sorted_quantile(const std::vector<int> &sorted, int percent)
+{
+	int rank = MAX((percent * (int)sorted.size() + 99) / 100, 1);
+
+	return sorted[rank - 1];
+}
+
+static bool bench(std::mt19937 &random, int device_count)
+{
+	static const uint8_t data[] = { 2, 0x0a, 0xf4, 3, 0x03, 0x6f, 0xfd,
+					5, 0xff, 0x4c, 0x00, 0x10, 0x05 };
+	std::vector<struct adv_record> records;
+	std::vector<bt_addr_le_t> addrs;
+	struct adv_record record;
+
+	memset(&record, 0, sizeof(record));
+	record.data_len = sizeof(data);
+	memcpy(record.data, data, sizeof(data));
+
+	for (int i = 0; i < device_count; i++) {
+		addrs.push_back(random_addr(random));
+	}
+
+	//every device has its own distance, the RSSI varies around it
+	for (int b = 0; b < BEACONS; b++) {
+		for (int i = 0; i < device_count; i++) {
+			bt_addr_le_copy(&record.addr, &addrs[i]);
+			record.rssi = -40 - i % 50 - random() % 11;
+			record.timestamp += 1000;
+			records.push_back(record);
+		}
+	}
+
+	long sum = 0;
+	double add_ns = 0;
+	double histogram_ns = 0;
+	double quantiles_ns = 0;
+	int features[RSSI_QUANTILE_FEATURES_COUNT];
+
+	for (int e = 0; e < EPOCHS; e++) {
+		scan_epoch_reset(&epoch, e);
+		histogram_clear(&rssi);
+
+		double start = now_ns();
+
+		for (const struct adv_record &r : records) {
+			scan_epoch_add(&epoch, &r);
+		}
+
+		double added = now_ns();
+
+		for (const struct adv_record &r : records) {
+			histogram_add(&rssi, r.rssi);
+		}
+
+		double histogram_added = now_ns();
+
+		scan_epoch_rssi_quantiles(&epoch, features);
+
+		add_ns += added - start;
+		histogram_ns += histogram_added - added;
+		quantiles_ns += now_ns() - histogram_added;
+		sum += features[0] + features[4] + rssi.count;
+	}
+
+	quantile_sum = sum;
+
+	//quantiles of the RSSI of all beacons
+	std::vector<int> sorted;
+
+	for (const struct adv_record &r : records) {
+		sorted.push_back(r.rssi);
+	}
+	std::sort(sorted.begin(), sorted.end());
+
+	bool ok = features[0] == sorted_quantile(sorted, 10) &&
+		  features[1] == sorted_quantile(sorted, 50) &&
+		  features[2] == sorted_quantile(sorted, 90);
+	int advertisements = EPOCHS * (int)records.size();
+
+	printf("%4d devices: scan_epoch_add() %6.1f ns, RSSI histogram %5.1f ns per advertisement, quantiles %7.2f us per epoch%s\n",
+	       device_count, add_ns / advertisements, histogram_ns / advertisements,
+	       quantiles_ns / EPOCHS / 1000, ok ? "" : ": quantiles differ from the sorted values");
+
+	return ok;
+}
+
+int main(void)
+{
+	std::mt19937 random(1);
+	const int counts[] = { 50, 150, 1000 };
+	bool ok = true;
+
+	printf("RSSI histogram: %d bytes per epoch, %d epoch buffers\n", (int)sizeof(struct histogram),
+	       SCAN_EPOCH_BUFFERS);
+
+	for (int devices : counts) {
+		if (devices <= MAX_DEVICES) {
+			ok &= bench(random, devices);
+		}
+	}
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,335 @@
+/*
+Flatbuffers basics: a table starts with a signed offset back to its vtable, the vtable holds
+its own size, the table size and one 16-bit offset per field (0 if the field is not set).
+References to tables, vectors and strings are unsigned 32-bit offsets relative to their own
+position, vectors and strings start with their 32-bit length.
+*/
+
+#include "tflite_reader.h"
+
+#include <string.h>
+
+//field indices of the schema tables
+#define MODEL_OPERATOR_CODES 1
+#define MODEL_SUBGRAPHS 2
+#define MODEL_BUFFERS 4
+#define OPERATOR_CODE_DEPRECATED_BUILTIN_CODE 0
+#define OPERATOR_CODE_BUILTIN_CODE 3
+#define SUBGRAPH_TENSORS 0
+#define SUBGRAPH_INPUTS 1
+#define SUBGRAPH_OUTPUTS 2
+#define SUBGRAPH_OPERATORS 3
+#define TENSOR_SHAPE 0
+#define TENSOR_TYPE 1
+#define TENSOR_BUFFER 2
+#define TENSOR_NAME 3
+#define TENSOR_QUANTIZATION 4
+#define QUANTIZATION_SCALE 2
+#define QUANTIZATION_ZERO_POINT 3
+#define OPERATOR_OPCODE_INDEX 0
+#define OPERATOR_INPUTS 1
+#define OPERATOR_OUTPUTS 2
+#define OPERATOR_BUILTIN_OPTIONS 4
+#define BUFFER_DATA 0
+
+template <typename T> static T read(const struct tflite_model *model, size_t pos)
+{
+	T value;
+
+	if (pos + sizeof(T) > model->len) {
+		return 0;
+	}
+	memcpy(&value, model->data + pos, sizeof(T));
+
+	return value;
+}
+
+template <typename T> static void write(struct tflite_model *model, size_t pos, T value)
+{
+	if (pos + sizeof(T) <= model->len) {
+		memcpy(model->data + pos, &value, sizeof(T));
+	}
+}
+
+/*
+position of a field of the table at pos, 0 if the field is not set
+*/
+static size_t field(const struct tflite_model *model, size_t table, int index)
+{
+	if (table == 0) {
+		return 0;
+	}
+
+	size_t vtable = table - read<int32_t>(model, table);
+	uint16_t vtable_len = read<uint16_t>(model, vtable);
+
+	if (4 + 2 * index >= vtable_len) {
+		return 0;
+	}
+
+	uint16_t offset = read<uint16_t>(model, vtable + 4 + 2 * index);
+
+	return offset == 0 ? 0 : table + offset;
+}
+
+/*
+follow the reference at pos, 0 if pos is 0
+*/
+static size_t deref(const struct tflite_model *model, size_t pos)
+{
+	return pos == 0 ? 0 : pos + read<uint32_t>(model, pos);
+}
+
+/*
+length of the vector referenced by the field at pos (0 if not set), *elements is its first element
+*/
+static int vector(const struct tflite_model *model, size_t pos, size_t *elements)
+{
+	size_t vec = deref(model, pos);
+
+	if (vec == 0) {
+		*elements = 0;
+		return 0;
+	}
+	*elements = vec + 4;
+
+	return (int)read<uint32_t>(model, vec);
+}
+
+/*
+table at index of the vector of tables referenced by the field at pos, 0 if out of range
+*/
+static size_t vector_table(const struct tflite_model *model, size_t pos, int index)
+{
+	size_t elements;
+	int len = vector(model, pos, &elements);
+
+	if (index < 0 || index >= len) {
+		return 0;
+	}
+
+	return deref(model, elements + 4 * index);
+}
+
+static std::vector<int> int_vector(const struct tflite_model *model, size_t pos)
+{
+	size_t elements;
+	int len = vector(model, pos, &elements);
+	std::vector<int> values;
+
+	for (int i = 0; i < len; i++) {
+		values.push_back(read<int32_t>(model, elements + 4 * i));
+	}
+
+	return values;
+}
+
+static size_t root(const struct tflite_model *model)
+{
+	//the reference to the root table is the first field of the buffer
+	return read<uint32_t>(model, 0);
+}
+
+static size_t subgraph(const struct tflite_model *model)
+{
+	return vector_table(model, field(model, root(model), MODEL_SUBGRAPHS), 0);
+}
+
+int tflite_elements(const struct tflite_tensor *tensor)
+{
+	int elements = 1;
+
+	for (size_t i = 0; i < tensor->shape.size(); i++) {
+		elements *= tensor->shape[i];
+	}
+
+	return elements;
+}
+
+std::vector<int> tflite_operator_codes(const struct tflite_model *model)
+{
+	size_t codes = field(model, root(model), MODEL_OPERATOR_CODES);
+	size_t elements;
+	int len = vector(model, codes, &elements);
+	std::vector<int> builtin_codes;
+
+	for (int i = 0; i < len; i++) {
+		size_t code = vector_table(model, codes, i);
+		size_t deprecated = field(model, code, OPERATOR_CODE_DEPRECATED_BUILTIN_CODE);
+		size_t builtin = field(model, code, OPERATOR_CODE_BUILTIN_CODE);
+		int value = deprecated != 0 ? read<int8_t>(model, deprecated) : 0;
+
+		//newer models keep codes beyond 127 in builtin_code only
+		if (builtin != 0 && read<int32_t>(model, builtin) > value) {
+			value = read<int32_t>(model, builtin);
+		}
+		builtin_codes.push_back(value);
+	}
+
+	return builtin_codes;
+}
+
+int tflite_operator_count(const struct tflite_model *model)
+{
+	size_t elements;
+
+	return vector(model, field(model, subgraph(model), SUBGRAPH_OPERATORS), &elements);
+}
+
+bool tflite_get_operator(const struct tflite_model *model, int index, struct tflite_operator *op)
+{
+	size_t table = vector_table(model, field(model, subgraph(model), SUBGRAPH_OPERATORS), index);
+
+	if (table == 0) {
+		return false;
+	}
+
+	std::vector<int> codes = tflite_operator_codes(model);
+	size_t opcode = field(model, table, OPERATOR_OPCODE_INDEX);
+	uint32_t opcode_index = opcode != 0 ? read<uint32_t>(model, opcode) : 0;
+
+	if (opcode_index >= codes.size()) {
+		return false;
+	}
+
+	op->builtin_code = codes[opcode_index];
+	op->inputs = int_vector(model, field(model, table, OPERATOR_INPUTS));
+	op->outputs = int_vector(model, field(model, table, OPERATOR_OUTPUTS));
+	op->options = deref(model, field(model, table, OPERATOR_BUILTIN_OPTIONS));
+
+	return true;
+}
+
+int tflite_tensor_count(const struct tflite_model *model)
+{
+	size_t elements;
+
+	return vector(model, field(model, subgraph(model), SUBGRAPH_TENSORS), &elements);
+}
+
+bool tflite_get_tensor(const struct tflite_model *model, int index, struct tflite_tensor *tensor)
+{
+	size_t table = vector_table(model, field(model, subgraph(model), SUBGRAPH_TENSORS), index);
+
+	if (table == 0) {
+		return false;
+	}
+
+	size_t type = field(model, table, TENSOR_TYPE);
+	tensor->type = type != 0 ? read<int8_t>(model, type) : TFLITE_FLOAT32;
+	tensor->shape = int_vector(model, field(model, table, TENSOR_SHAPE));
+
+	size_t name;
+	int name_len = vector(model, field(model, table, TENSOR_NAME), &name);
+	tensor->name.assign((const char *)model->data + name, name_len);
+
+	size_t quantization = deref(model, field(model, table, TENSOR_QUANTIZATION));
+	size_t elements;
+	int len = vector(model, field(model, quantization, QUANTIZATION_SCALE), &elements);
+
+	tensor->scale.clear();
+	for (int i = 0; i < len; i++) {
+		tensor->scale.push_back(read<float>(model, elements + 4 * i));
+	}
+
+	len = vector(model, field(model, quantization, QUANTIZATION_ZERO_POINT), &elements);
+	tensor->zero_point.clear();
+	for (int i = 0; i < len; i++) {
+		tensor->zero_point.push_back(read<int64_t>(model, elements + 8 * i));
+	}
+
+	size_t buffer_field = field(model, table, TENSOR_BUFFER);
+	uint32_t buffer_index = buffer_field != 0 ? read<uint32_t>(model, buffer_field) : 0;
+	size_t buffer = vector_table(model, field(model, root(model), MODEL_BUFFERS), buffer_index);
+	size_t data;
+
+	tensor->data_len = vector(model, field(model, buffer, BUFFER_DATA), &data);
+	tensor->data = tensor->data_len != 0 ? model->data + data : NULL;
+
+	return true;
+}
+
+std::vector<int> tflite_inputs(const struct tflite_model *model)
+{
+	return int_vector(model, field(model, subgraph(model), SUBGRAPH_INPUTS));
+}
+
+std::vector<int> tflite_outputs(const struct tflite_model *model)
+{
+	return int_vector(model, field(model, subgraph(model), SUBGRAPH_OUTPUTS));
+}
+
+int tflite_option_int(const struct tflite_model *model, const struct tflite_operator *op, int field_index,
+		      int default_value)
+{
+	size_t pos = field(model, op->options, field_index);
+
+	//all integer options of our ops are stored as single bytes (enums, bools)
+	return pos != 0 ? read<int8_t>(model, pos) : default_value;
+}
+
+float tflite_option_float(const struct tflite_model *model, const struct tflite_operator *op,
+			  int field_index, float default_value)
+{
+	size_t pos = field(model, op->options, field_index);
+
+	return pos != 0 ? read<float>(model, pos) : default_value;
+}
+
+/*
+replace the element at position of the int vector referenced by the field at pos
+*/
+static bool set_int(struct tflite_model *model, size_t pos, int position, int value)
+{
+	size_t elements;
+	int len = vector(model, pos, &elements);
+
+	if (position < 0 || position >= len) {
+		return false;
+	}
+	write<int32_t>(model, elements + 4 * position, value);
+
+	return true;
+}
+
+bool tflite_set_input(struct tflite_model *model, int position, int tensor)
+{
+	return set_int(model, field(model, subgraph(model), SUBGRAPH_INPUTS), position, tensor);
+}
+
+bool tflite_set_output(struct tflite_model *model, int position, int tensor)
+{
+	return set_int(model, field(model, subgraph(model), SUBGRAPH_OUTPUTS), position, tensor);
+}
+
+bool tflite_remove_first_operator(struct tflite_model *model)
+{
+	size_t pos = field(model, subgraph(model), SUBGRAPH_OPERATORS);
+	size_t elements;
+	int len = vector(model, pos, &elements);
+
+	if (len == 0) {
+		return false;
+	}
+
+	//the vector starts one element later: the length replaces the reference to the first
+	//operator, the references to the other operators are relative to their own position
+	write<uint32_t>(model, elements, len - 1);
+	write<uint32_t>(model, pos, read<uint32_t>(model, pos) + 4);
+
+	return true;
+}
+
+bool tflite_remove_last_operator(struct tflite_model *model)
+{
+	size_t pos = field(model, subgraph(model), SUBGRAPH_OPERATORS);
+	size_t elements;
+	int len = vector(model, pos, &elements);
+
+	if (len == 0) {
+		return false;
+	}
+	write<uint32_t>(model, elements - 4, len - 1);
+
+	return true;
+}
@@ -0,0 +1,97 @@
+/*
+Minimal reader for TensorFlow Lite models (flatbuffers) used by the host tools.
+Only the parts of the schema needed for our models are read: operator codes, the tensors, inputs,
+outputs and operators of the first subgraph and the buffers.
+Small changes that keep the size of the model (inputs, outputs, removing the first or last
+operator) are done in place.
+*/
+
+#ifndef TFLITE_READER_H_
+#define TFLITE_READER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+//tensor types (schema TensorType)
+#define TFLITE_FLOAT32 0
+#define TFLITE_INT32 2
+#define TFLITE_INT8 9
+
+//builtin operators (schema BuiltinOperator)
+#define TFLITE_BUILTIN_ADD 0
+#define TFLITE_BUILTIN_AVERAGE_POOL_2D 1
+#define TFLITE_BUILTIN_CONCATENATION 2
+#define TFLITE_BUILTIN_CONV_2D 3
+#define TFLITE_BUILTIN_DEPTHWISE_CONV_2D 4
+#define TFLITE_BUILTIN_DEQUANTIZE 6
+#define TFLITE_BUILTIN_FULLY_CONNECTED 9
+#define TFLITE_BUILTIN_LOGISTIC 14
+#define TFLITE_BUILTIN_MAX_POOL_2D 17
+#define TFLITE_BUILTIN_MUL 18
+#define TFLITE_BUILTIN_RELU 19
+#define TFLITE_BUILTIN_RELU6 21
+#define TFLITE_BUILTIN_RESHAPE 22
+#define TFLITE_BUILTIN_SOFTMAX 25
+#define TFLITE_BUILTIN_TANH 28
+#define TFLITE_BUILTIN_QUANTIZE 114
+
+//fused activation functions (schema ActivationFunctionType)
+#define TFLITE_ACTIVATION_NONE 0
+#define TFLITE_ACTIVATION_RELU 1
+
+struct tflite_model {
+	uint8_t *data;
+	size_t len;
+};
+
+struct tflite_tensor {
+	int type;
+	std::vector<int> shape;
+	std::string name;
+	std::vector<float> scale; //empty if not quantized
+	std::vector<int64_t> zero_point;
+	const uint8_t *data; //constant data, NULL if the tensor has none
+	size_t data_len;
+};
+
+struct tflite_operator {
+	int builtin_code;
+	std::vector<int> inputs; //tensor indices, -1 for optional inputs
+	std::vector<int> outputs;
+	size_t options; //position of the builtin options table, 0 if there are none
+};
+
+//amount of elements of tensor
+int tflite_elements(const struct tflite_tensor *tensor);
+
+//builtin codes of the operators used by the model (index: opcode index)
+std::vector<int> tflite_operator_codes(const struct tflite_model *model);
+
+int tflite_operator_count(const struct tflite_model *model);
+bool tflite_get_operator(const struct tflite_model *model, int index, struct tflite_operator *op);
+
+int tflite_tensor_count(const struct tflite_model *model);
+bool tflite_get_tensor(const struct tflite_model *model, int index, struct tflite_tensor *tensor);
+
+//tensor indices of the model inputs and outputs
+std::vector<int> tflite_inputs(const struct tflite_model *model);
+std::vector<int> tflite_outputs(const struct tflite_model *model);
+
+//scalar field of the builtin options of op, default_value if not set
+int tflite_option_int(const struct tflite_model *model, const struct tflite_operator *op, int field,
+		      int default_value);
+float tflite_option_float(const struct tflite_model *model, const struct tflite_operator *op,
+			  int field, float default_value);
+
+//replace input or output (by position) with tensor
+bool tflite_set_input(struct tflite_model *model, int position, int tensor);
+bool tflite_set_output(struct tflite_model *model, int position, int tensor);
+
+//remove the first or last operator of the subgraph
+bool tflite_remove_first_operator(struct tflite_model *model);
+bool tflite_remove_last_operator(struct tflite_model *model);
+
+#endif
@@ -0,0 +1,35 @@
+/*
+Functions of the Zephyr Bluetooth host that are not inline, same behaviour as there.
+*/
+
+#include <bluetooth/bluetooth.h>
+
+void bt_data_parse(struct net_buf_simple *ad, bool (*func)(struct bt_data *data, void *user_data),
+		   void *user_data)
+{
+	while (ad->len > 1) {
+		struct bt_data data;
+		uint8_t len;
+
+		len = net_buf_simple_pull_u8(ad);
+		if (len == 0U) {
+			//early termination
+			return;
+		}
+
+		if (len > ad->len) {
+			//malformed data
+			return;
+		}
+
+		data.type = net_buf_simple_pull_u8(ad);
+		data.data_len = len - 1;
+		data.data = ad->data;
+
+		if (!func(&data, user_data)) {
+			return;
+		}
+
+		net_buf_simple_pull(ad, len - 1);
+	}
+}
@@ -0,0 +1,53 @@
+#ifndef ZEPHYR_STUBS_BLUETOOTH_ADDR_H_
+#define ZEPHYR_STUBS_BLUETOOTH_ADDR_H_
+
+#include <zephyr/types.h>
+#include <sys/printk.h>
+#include <string.h>
+
+#define BT_ADDR_LE_PUBLIC 0x00
+#define BT_ADDR_LE_RANDOM 0x01
+
+#define BT_ADDR_LE_STR_LEN 30
+
+typedef struct {
+	uint8_t val[6];
+} bt_addr_t;
+
+typedef struct {
+	uint8_t type;
+	bt_addr_t a;
+} bt_addr_le_t;
+
+static inline int bt_addr_le_cmp(const bt_addr_le_t *a, const bt_addr_le_t *b)
+{
+	return memcmp(a, b, sizeof(*a));
+}
+
+static inline void bt_addr_le_copy(bt_addr_le_t *dst, const bt_addr_le_t *src)
+{
+	memcpy(dst, src, sizeof(*dst));
+}
+
+static inline int bt_addr_le_to_str(const bt_addr_le_t *addr, char *str, size_t len)
+{
+	char type[10];
+
+	switch (addr->type) {
+	case BT_ADDR_LE_PUBLIC:
+		strcpy(type, "public");
+		break;
+	case BT_ADDR_LE_RANDOM:
+		strcpy(type, "random");
+		break;
+	default:
+		snprintk(type, sizeof(type), "0x%02x", addr->type);
+		break;
+	}
+
+	return snprintk(str, len, "%02X:%02X:%02X:%02X:%02X:%02X (%s)", addr->a.val[5],
+			addr->a.val[4], addr->a.val[3], addr->a.val[2], addr->a.val[1],
+			addr->a.val[0], type);
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef ZEPHYR_STUBS_BLUETOOTH_BLUETOOTH_H_
+#define ZEPHYR_STUBS_BLUETOOTH_BLUETOOTH_H_
+
+#include <zephyr/types.h>
+#include <bluetooth/addr.h>
+#include <net/buf.h>
+
+#define BT_DATA_UUID16_SOME 0x02
+#define BT_DATA_UUID16_ALL 0x03
+#define BT_DATA_UUID32_SOME 0x04
+#define BT_DATA_UUID32_ALL 0x05
+#define BT_DATA_UUID128_SOME 0x06
+#define BT_DATA_UUID128_ALL 0x07
+#define BT_DATA_NAME_COMPLETE 0x09
+#define BT_DATA_TX_POWER 0x0a
+#define BT_DATA_MANUFACTURER_DATA 0xff
+
+struct bt_data {
+	uint8_t type;
+	uint8_t data_len;
+	const uint8_t *data;
+};
+
+//bt_data_parse() of the Zephyr Bluetooth host, not inline as in Zephyr (zephyr_stubs/bluetooth.cc)
+void bt_data_parse(struct net_buf_simple *ad, bool (*func)(struct bt_data *data, void *user_data),
+		   void *user_data);
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef ZEPHYR_STUBS_BLUETOOTH_UUID_H_
+#define ZEPHYR_STUBS_BLUETOOTH_UUID_H_
+
+#include <zephyr/types.h>
+#include <sys/printk.h>
+
+enum {
+	BT_UUID_TYPE_16,
+	BT_UUID_TYPE_32,
+	BT_UUID_TYPE_128,
+};
+
+struct bt_uuid {
+	uint8_t type;
+};
+
+struct bt_uuid_16 {
+	struct bt_uuid uuid;
+	uint16_t val;
+};
+
+//16 bit UUIDs only
+static inline void bt_uuid_to_str(const struct bt_uuid *uuid, char *str, size_t len)
+{
+	snprintk(str, len, "%04x", ((const struct bt_uuid_16 *)uuid)->val);
+}
+
+#endif
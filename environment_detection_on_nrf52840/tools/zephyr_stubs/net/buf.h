@@ -0,0 +1,39 @@
+#ifndef ZEPHYR_STUBS_NET_BUF_H_
+#define ZEPHYR_STUBS_NET_BUF_H_
+
+#include <zephyr/types.h>
+
+struct net_buf_simple {
+	uint8_t *data;
+	uint16_t len;
+	uint16_t size;
+	uint8_t *__buf;
+};
+
+static inline void net_buf_simple_init_with_data(struct net_buf_simple *buf, void *data,
+						 size_t size)
+{
+	buf->__buf = (uint8_t *)data;
+	buf->data = (uint8_t *)data;
+	buf->size = (uint16_t)size;
+	buf->len = (uint16_t)size;
+}
+
+static inline uint8_t net_buf_simple_pull_u8(struct net_buf_simple *buf)
+{
+	uint8_t value = buf->data[0];
+
+	buf->data++;
+	buf->len--;
+
+	return value;
+}
+
+static inline void *net_buf_simple_pull(struct net_buf_simple *buf, size_t len)
+{
+	buf->len -= (uint16_t)len;
+
+	return buf->data += len;
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef ZEPHYR_STUBS_SYS_ATOMIC_H_
+#define ZEPHYR_STUBS_SYS_ATOMIC_H_
+
+//sequentially consistent like the Zephyr atomics (full memory barrier)
+typedef long atomic_t;
+typedef atomic_t atomic_val_t;
+
+static inline atomic_val_t atomic_get(const atomic_t *target)
+{
+	return __atomic_load_n(target, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_set(atomic_t *target, atomic_val_t value)
+{
+	return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_add(atomic_t *target, atomic_val_t value)
+{
+	return __atomic_fetch_add(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_inc(atomic_t *target)
+{
+	return atomic_add(target, 1);
+}
+
+#endif
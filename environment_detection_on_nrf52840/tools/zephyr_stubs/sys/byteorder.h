@@ -0,0 +1,14 @@
+#ifndef ZEPHYR_STUBS_SYS_BYTEORDER_H_
+#define ZEPHYR_STUBS_SYS_BYTEORDER_H_
+
+#include <zephyr/types.h>
+
+//the host is little endian like the nRF52840
+#define sys_le16_to_cpu(val) (val)
+
+static inline uint16_t sys_get_le16(const uint8_t src[2])
+{
+	return (uint16_t)(src[0] | (src[1] << 8));
+}
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef ZEPHYR_STUBS_SYS_PRINTK_H_
+#define ZEPHYR_STUBS_SYS_PRINTK_H_
+
+#include <stdio.h>
+
+#define printk printf
+#define snprintk snprintf
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef ZEPHYR_STUBS_SYS_UTIL_H_
+#define ZEPHYR_STUBS_SYS_UTIL_H_
+
+#define BIT(n) (1UL << (n))
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+
+#endif
@@ -0,0 +1,13 @@
+/*
+Host stubs of the Zephyr headers the scan data modules of src/ include, so the host tools can be
+built with them (-Izephyr_stubs). Only what these modules use, with the behaviour of Zephyr.
+*/
+
+#ifndef ZEPHYR_STUBS_TYPES_H_
+#define ZEPHYR_STUBS_TYPES_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#endif